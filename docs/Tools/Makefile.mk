@@ -17,3 +17,4 @@ DOCS_UTILITIES += docs/Tools/Substation.md
 DOCS_UTILITIES += docs/Tools/Timeseries.md
 DOCS_UTILITIES += docs/Tools/Unitcalc.md
 DOCS_UTILITIES += docs/Tools/Weather.md
+DOCS_UTILITIES += docs/Tools/Weather_compile.md
@@ -11,7 +11,10 @@ module_climate_climate_la_LIBADD =
 module_climate_climate_la_SOURCES =
 module_climate_climate_la_SOURCES += module/climate/init.cpp module/climate/main.cpp
 module_climate_climate_la_SOURCES += module/climate/climate.cpp module/climate/climate.h
+module_climate_climate_la_SOURCES += module/climate/cloud_pattern.cpp module/climate/cloud_pattern.h
 module_climate_climate_la_SOURCES += module/climate/csv_reader.cpp module/climate/csv_reader.h
 module_climate_climate_la_SOURCES += module/climate/solar_angles.cpp module/climate/solar_angles.h
+module_climate_climate_la_SOURCES += module/climate/solar_cache.cpp module/climate/solar_cache.h
 module_climate_climate_la_SOURCES += module/climate/weather.cpp module/climate/weather.h
+module_climate_climate_la_SOURCES += module/climate/weather_binary.cpp module/climate/weather_binary.h
 module_climate_climate_la_SOURCES += module/climate/weather_reader.cpp module/climate/weather_reader.h
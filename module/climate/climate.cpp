@@ -4,12 +4,15 @@
 	@author David P. Chassin
  **/
 
+#include <memory>
+#include <vector>
 #include "climate.h"
 
 EXPORT_CREATE(climate)
 EXPORT_INIT(climate)
 EXPORT_SYNC(climate)
 EXPORT_ISA(climate)
+EXPORT_FINALIZE(climate)
 
 #define RAD(x) (x*PI)/180
 
@@ -27,31 +30,6 @@ double surface_angles[] = {
 bool is_TMY2 = 0;
 
 
-//Cloud pattern constants
-//The off-screen pattern size is affected by the following two constants.
-// These have been set under the assumption of a max wind speed (after altitude adjustment to 1000m)
-// of 80 m/s.  At 256 pixles/tile * 20m/pixle  the off-screen pattern size is sufficient to ensure
-// that  no undefined areas of the pattern make it on-screen in the 60 s update period.
-// Adjusting either of these breaks that assumption and may force other change to be made, such
-// as reducing the time between cloud pattern updates.
-
-//EDITME
-const int CLOUD_TILE_SIZE = 512;
-const int PIXEL_EDGE_SIZE = 20; //Pixel size example: 10m per edge, 100 m^2 area.
-const double KM_PER_DEG = 111.32;
-const long EMPTY_VALUE = -999;
-//const int ALPHA = 300;
-//const int NUM_FUZZY_LAYERS = 20;
-
-#include <vector>
-
-std::vector<std::vector<double > > cloud_pattern;
-std::vector<std::vector<double > > normalized_cloud_pattern;
-std::vector<std::vector<int > > binary_cloud_pattern;
-std::vector<std::vector<std::vector<double> > > fuzzy_cloud_pattern;
-int on_screen_size = 0;
-int cloud_pattern_size = 0;
-TIMESTAMP last_binary_conversion_time = 0;
 
 
 
@@ -73,14 +51,12 @@ EXPORT int64 calculate_solar_radiation_shading_radians(OBJECT *obj, double tilt,
 }
 
 EXPORT int64 calculate_solar_radiation_shading_position_radians(OBJECT *obj, double tilt, double orientation, double latitude, double longitude, double shading_value, double *value ) {
-	static SolarAngles sa; // just for the functions
-	double ghr, dhr, dnr = 0.0;
-	double cos_incident = 0.0;
-	double std_time = 0.0;
-	double solar_time = 0.0;
-	short int doy = 0;
-	DATETIME dt;
+	return calculate_solar_radiation_batch_radians(obj, 1, &tilt, &orientation, &latitude, &longitude, &shading_value, value);
+}
 
+//Isotropic sky model for many surfaces at once
+EXPORT int64 calculate_solar_radiation_batch_radians(OBJECT *obj, int64 count, double *tilt, double *orientation, double *latitude, double *longitude, double *shading_value, double *value)
+{
 	climate *cli;
 	if(obj == 0 || value == 0 ) {
 		//throw "climate/calc_solar: null object pointer in argument";
@@ -91,17 +67,7 @@ EXPORT int64 calculate_solar_radiation_shading_position_radians(OBJECT *obj, dou
 		//throw "climate/calc_solar: input object is not a climate object";
 		return 0;
 	}
-
-	cli->get_solar_for_location(latitude, longitude, &dnr, &ghr, &dhr);
-
-	gl_localtime(obj->clock, &dt);
-	std_time = (double)(dt.hour) + ((double)dt.minute)/60.0  + (dt.is_dst ? -1.0:0.0);
-	doy=sa.day_of_yr(dt.month,dt.day);
-	solar_time = sa.solar_time(std_time, doy, RAD(cli->get_tz_meridian()), RAD(obj->longitude));
-	cos_incident = sa.cos_incident(RAD(obj->latitude), tilt, orientation, solar_time, doy);
-	*value = (shading_value*dnr*cos_incident) + dhr*(1+cos(tilt))/2. + ghr*(1-cos(tilt))*cli->get_ground_reflectivity()/2.;
-
-	return 1;
+	return cli->get_solar_poa(SCM_LIUJORDAN, (size_t)count, tilt, orientation, latitude, longitude, shading_value, value);
 }
 
 //Degree version of the new solpos-based solar position/radiation algorithms
@@ -119,13 +85,12 @@ EXPORT int64 calc_solar_solpos_shading_rad(OBJECT *obj, double tilt, double orie
 //Solar radiation calcuation based on solpos and Perez tilt models
 EXPORT int64 calc_solar_solpos_shading_position_rad(OBJECT *obj, double tilt, double orientation, double latitude, double longitude, double shading_value, double *value)
 {
-	static SolarAngles sa; // just for the functions
-	double ghr, dhr, dnr;
-	double cos_incident;
-	double temp_value;
-	DATETIME dt;
-	TIMESTAMP offsetclock;
+	return calc_solar_solpos_batch_rad(obj, 1, &tilt, &orientation, &latitude, &longitude, &shading_value, value);
+}
 
+//Solpos and Perez tilt models for many surfaces at once
+EXPORT int64 calc_solar_solpos_batch_rad(OBJECT *obj, int64 count, double *tilt, double *orientation, double *latitude, double *longitude, double *shading_value, double *value)
+{
 	climate *cli;
 	if(obj == 0 || value == 0 ) {
 		return 0;
@@ -134,68 +99,7 @@ EXPORT int64 calc_solar_solpos_shading_position_rad(OBJECT *obj, double tilt, do
 	if(gl_object_isa(obj, "climate", "climate") == 0 ) {
 		return 0;
 	}
-
-	cli->get_solar_for_location(latitude, longitude, &dnr, &ghr, &dhr);
-
-	if (cli->reader_type==1)//check if reader_type is TMY2.
-	{
-		//Adjust time by half an hour - adjusts per TMY "reading" intervals - what they really represent
-		offsetclock = obj->clock + 1800;
-	}
-	else	//Just pass it in
-	{
-		offsetclock = obj->clock;
-	}
-
-	gl_localtime(offsetclock, &dt);
-
-	//Convert temperature back to centrigrade - since we seem to like imperial units
-	temp_value = ((cli->get_temperature() - 32.0)*5.0/9.0);
-
-	//Initialize solpos algorithm
-	sa.S_init(&sa.solpos_vals);
-
-	//Assign in values
-	sa.solpos_vals.longitude = obj->longitude;
-	sa.solpos_vals.latitude = RAD(obj->latitude);
-	if (dt.is_dst == 1)
-	{
-		sa.solpos_vals.timezone = cli->get_tz_offset_val()-1.0;
-	}
-	else
-	{
-		sa.solpos_vals.timezone = cli->get_tz_offset_val();
-	}
-	sa.solpos_vals.year = dt.year;
-	sa.solpos_vals.daynum = (dt.yearday+1);
-	sa.solpos_vals.hour = dt.hour+(dt.is_dst?-1:0);
-	sa.solpos_vals.minute = dt.minute;
-	sa.solpos_vals.second = dt.second;
-	sa.solpos_vals.temp = temp_value;
-	sa.solpos_vals.press = cli->get_pressure();
-
-	// Solar constant associated with extraterrestrial DNI, 1367 W/sq m - pull from TMY for now
-	//sa.solpos_vals.solcon = 126.998456;	//Use constant value for direct normal extraterrestrial irradiance - doesn't seem right to me
-	sa.solpos_vals.solcon = cli->get_direct_normal_extra();	//Use weather-read version (TMY)
-
-	sa.solpos_vals.aspect = orientation;
-	sa.solpos_vals.tilt = tilt;
-	sa.solpos_vals.diff_horz = dhr;
-	sa.solpos_vals.dir_norm = dnr;
-
-	//Calculate different solar position values
-	sa.S_solpos(&sa.solpos_vals);
-
-	//Pull off new cosine of incidence
-	if (sa.solpos_vals.cosinc >= 0.0)
-		cos_incident = sa.solpos_vals.cosinc;
-	else
-		cos_incident = 0.0;
-
-	//Apply the adjustment
-	*value = (shading_value*dnr*cos_incident) + dhr*sa.solpos_vals.perez_horz + ghr*((1-cos(tilt))*cli->get_ground_reflectivity()/2.0);
-
-	return 1;
+	return cli->get_solar_poa(SCM_SOLPOS, (size_t)count, tilt, orientation, latitude, longitude, shading_value, value);
 }
 
 EXPORT int64 calc_solar_ideal_shading_position_radians(OBJECT *obj, double tilt, double latitude, double longitude, double shading_value, double *value) 
@@ -727,6 +631,9 @@ climate::climate(MODULE *module) : gld_object()
 				PT_OUTPUT,
 				PT_DEFAULT,"0.95 pu",
 				PT_DESCRIPTION,"cloud aerosal transmissivity",
+			PT_bool,"cloud_precompute",PADDR(cloud_precompute),
+				PT_DEFAULT,"FALSE",
+				PT_DESCRIPTION,"compute the cloud pattern a day ahead in a background thread",
 			PT_double,"heat_index[degF]",PADDR(heat_index),
 				PT_OUTPUT,
 				PT_DESCRIPTION,"heat index based on temperature and humidity",
@@ -739,6 +646,8 @@ climate::climate(MODULE *module) : gld_object()
 		gl_publish_function(oclass,	"calculate_solar_radiation_shading_position_radians", (FUNCTIONADDR)calculate_solar_radiation_shading_position_radians);
 		gl_publish_function(oclass,	"calculate_solpos_radiation_shading_position_radians", (FUNCTIONADDR)calc_solar_solpos_shading_position_rad);
 		gl_publish_function(oclass,	"calc_solar_ideal_shading_position_radians", (FUNCTIONADDR)calc_solar_ideal_shading_position_radians);
+		gl_publish_function(oclass,	"calculate_solar_radiation_batch_radians", (FUNCTIONADDR)calculate_solar_radiation_batch_radians);
+		gl_publish_function(oclass,	"calculate_solpos_radiation_batch_radians", (FUNCTIONADDR)calc_solar_solpos_batch_rad);
 	}
 }
 
@@ -758,6 +667,7 @@ int climate::create(void)
 		error("memory allocation failed for solar angle");
 		return 0;
 	}
+	solar = new solar_cache();
 	return 1;
 }
 
@@ -767,8 +677,16 @@ void climate::set_defaults(bool is_template)
 	reader = NULL;
 	memset(solar_flux,0,sizeof(solar_flux));
 	sa = NULL;
+	solar = NULL;
 	reader_hndl = NULL;
 	tmy = NULL;
+	binary = NULL;
+	binary_columns = NULL;
+	binary_row = -1;
+	clouds = NULL;
+	cloud_ahead = NULL;
+	cloud_frame = NULL;
+	cloud_start = TS_ZERO;
 	reader_type = RT_NONE;
 	prev_NTime = TS_NEVER;
 	MIN_LAT_INDEX = 0;
@@ -852,14 +770,20 @@ int climate::init(OBJECT *parent)
 		}
 		warning("This cloud model places a large burden on computational resources. Patience and/or a more capable computer may be required.");
 		init_cloud_pattern();
+		if ( clouds == NULL )
+		{
+			return 0;
+		}
 		//write_out_cloud_pattern('C');
-		convert_to_binary_cloud();
+		clouds->convert_to_binary(get_opq_sky_cov());
 		//write_out_cloud_pattern('B');
-		convert_to_fuzzy_cloud(EMPTY_VALUE, cloud_num_layers, cloud_alpha);
+		clouds->convert_to_fuzzy(EMPTY_VALUE, cloud_num_layers, cloud_alpha);
 		prev_NTime = t0-60;
 	}
 	
-	if(strstr(tmyfile, ".tmy2") || strstr(tmyfile,".tmy") ) {
+	if(strstr(tmyfile, ".glw") ) {
+		reader_type = RT_BINARY;
+	} else if(strstr(tmyfile, ".tmy2") || strstr(tmyfile,".tmy") ) {
 		reader_type = RT_TMY2;
 	} else if(strstr(tmyfile, ".csv") ) {
 		reader_type = RT_CSV;
@@ -933,6 +857,11 @@ int climate::init(OBJECT *parent)
 		return rv;
 	}
 
+	if ( reader_type == RT_BINARY )
+	{
+		return init_binary(found_file);
+	}
+
 	// implicit if(reader_type == RT_TMY2) ~ do the following
 	if( file->open(found_file) < 3  ) {
 		error("climate::init() -- weather file header improperly formed");
@@ -1134,6 +1063,108 @@ int climate::init(OBJECT *parent)
 	return 1;
 }
 
+/** Open a compiled weather file and match its columns to climate properties
+ **/
+int climate::init_binary(const char *filename)
+{
+	OBJECT *obj = THISOBJECTHDR;
+	binary = weather_binary::open(filename);
+	if ( binary == NULL )
+	{
+		error("compiled weather file '%s' could not be loaded", filename);
+		return 0;
+	}
+	const GLWHEADER *info = binary->get_header();
+
+	// location of the station (use the climate's own location if the file has none)
+	if ( ! isnan(info->latitude) )
+	{
+		set_latitude(info->latitude);
+	}
+	if ( ! isnan(info->longitude) )
+	{
+		set_longitude(info->longitude);
+	}
+	if ( fabs(obj->latitude) > 90 )
+	{
+		error("climate:%s - Latitude is outside +/-90!",obj->name);
+		return 0;
+	}
+	if ( fabs(obj->longitude) > 180 )
+	{
+		error("climate:%s - Longitude is outside +/-180!",obj->name);
+		return 0;
+	}
+	if ( info->city[0] != '\0' && strcmp(city,"") == 0 )
+	{
+		char station[sizeof(info->city)+1];
+		memcpy(station,info->city,sizeof(info->city));
+		station[sizeof(info->city)] = '\0';
+		set_city(station);
+	}
+
+	// standard time of the station (use the model's timezone if the file has none)
+	if ( isnan(info->tz_offset) )
+	{
+		DATETIME dt;
+		gl_localtime(gl_globalclock,&dt);
+		tz_offset_val = -(dt.tzoffset + (dt.is_dst ? 3600 : 0))/3600.0;
+	}
+	else
+	{
+		tz_offset_val = info->tz_offset;
+	}
+	tz_meridian = 15 * tz_offset_val;
+
+	// each column is a property name with an optional unit, e.g., "temperature[degC]"
+	binary_columns = new BINARYCOLUMN[binary->get_columns()];
+	for ( int n = 0 ; n < binary->get_columns() ; n++ )
+	{
+		BINARYCOLUMN &column = binary_columns[n];
+		char name[GLW_NAMESIZE], unit[GLW_NAMESIZE] = "";
+		column.value = NULL;
+		column.scale = 1.0;
+		column.offset = 0.0;
+		if ( sscanf(binary->get_name(n),"%[^[][%[^]]]",name,unit) < 1 )
+		{
+			warning("%s: column %d has no name and is ignored", filename, n);
+			continue;
+		}
+		PROPERTY *prop = gl_find_property(oclass,name);
+		if ( prop == NULL || prop->ptype != PT_double )
+		{
+			warning("%s: column '%s' is not a climate property and is ignored", filename, name);
+			continue;
+		}
+		if ( unit[0] != '\0' && prop->unit != NULL && strcmp(unit,prop->unit->name) != 0 )
+		{
+			double zero = 0.0, one = 1.0;
+			if ( gl_convert(unit,prop->unit->name,&zero) == 0 || gl_convert(unit,prop->unit->name,&one) == 0 )
+			{
+				error("%s: column '%s' cannot be converted from '%s' to '%s'", filename, name, unit, prop->unit->name);
+				return 0;
+			}
+			column.scale = one - zero;
+			column.offset = zero;
+		}
+		column.value = (double*)((char*)this + (size_t)prop->addr);
+	}
+
+	if ( interpolate == CI_QUADRATIC )
+	{
+		warning("quadratic interpolation is not supported for compiled weather files, using linear interpolation instead");
+		interpolate = CI_LINEAR;
+	}
+	if ( gl_globalclock < binary->get_time(0) || ( gl_globalstoptime != TS_NEVER && gl_globalstoptime > binary->get_time(binary->get_rows()-1) + info->interval ) )
+	{
+		warning("%s does not cover the entire simulation, the first and last rows will be used outside the range of the weather data", filename);
+	}
+
+	/* initialize climate to starttime */
+	presync(gl_globalclock);
+	return 1;
+}
+
 int climate::get_solar_for_location(double latitude, double longitude, double *direct, double *global, double *diffuse) 
 {
 	int retval = 1;
@@ -1178,11 +1209,131 @@ int climate::get_solar_for_location(double latitude, double longitude, double *d
 	return retval;
 }
 
+/* plane-of-array irradiance of a set of surfaces at the current clock */
+int climate::get_solar_poa(SOLARCACHEMODEL model, size_t count, const double *tilt, const double *orientation, const double *latitude, const double *longitude, const double *shading_value, double *value)
+{
+	OBJECT *obj = THISOBJECTHDR;
+	SOLARCACHEEPOCH epoch;
+	epoch.clock = obj->clock;
+	epoch.temperature = get_temperature();
+	epoch.pressure = get_pressure();
+	epoch.solcon = get_direct_normal_extra();
+	epoch.tz_offset = get_tz_offset_val();
+	epoch.tz_meridian = get_tz_meridian();
+
+	// working arrays are reused by each thread's later calls
+	static thread_local std::vector<double> dnr, ghr, dhr;
+	static thread_local std::vector<SOLARCACHEKEY> key;
+	static thread_local std::vector<SOLARCACHEVALUE> surface;
+	static thread_local std::vector<size_t> missing;
+	if ( key.size() < count )
+	{
+		dnr.resize(count);
+		ghr.resize(count);
+		dhr.resize(count);
+		key.resize(count);
+		surface.resize(count);
+		missing.resize(count);
+	}
+	for ( size_t n = 0 ; n < count ; n++ )
+	{
+		get_solar_for_location(latitude[n], longitude[n], &dnr[n], &ghr[n], &dhr[n]);
+		// the Perez model depends on the beam and diffuse irradiance too
+		SOLARCACHEKEY surface_key = {model, tilt[n], orientation[n], model==SCM_SOLPOS ? dnr[n] : 0.0, model==SCM_SOLPOS ? dhr[n] : 0.0};
+		key[n] = surface_key;
+	}
+
+	// compute the surfaces that are not cached without holding the cache lock
+	size_t n_missing = solar->find(epoch, count, key.data(), surface.data(), missing.data());
+	if ( n_missing > 0 )
+	{
+		DATETIME dt;
+		if ( model == SCM_LIUJORDAN )
+		{
+			gl_localtime(obj->clock, &dt);
+			double std_time = (double)(dt.hour) + ((double)dt.minute)/60.0  + (dt.is_dst ? -1.0:0.0);
+			short int doy = sa->day_of_yr(dt.month,dt.day);
+			double solar_time = sa->solar_time(std_time, doy, RAD(epoch.tz_meridian), RAD(obj->longitude));
+			for ( size_t m = 0 ; m < n_missing ; m++ )
+			{
+				size_t n = missing[m];
+				surface[n].cos_incident = sa->cos_incident(RAD(obj->latitude), tilt[n], orientation[n], solar_time, doy);
+				surface[n].sky_factor = 1+cos(tilt[n]);
+				surface[n].ground_factor = 1-cos(tilt[n]);
+			}
+		}
+		else
+		{
+			//Adjust time by half an hour for TMY2 - per TMY "reading" intervals - what they really represent
+			gl_localtime(reader_type==1 ? obj->clock+1800 : obj->clock, &dt);
+			for ( size_t m = 0 ; m < n_missing ; m++ )
+			{
+				size_t n = missing[m];
+				SolarAngles::SOLPOS_POSDATA solpos_vals;
+
+				//Initialize solpos algorithm
+				sa->S_init(&solpos_vals);
+
+				//Assign in values
+				solpos_vals.longitude = obj->longitude;
+				solpos_vals.latitude = RAD(obj->latitude);
+				solpos_vals.timezone = ( dt.is_dst == 1 ? epoch.tz_offset-1.0 : epoch.tz_offset );
+				solpos_vals.year = dt.year;
+				solpos_vals.daynum = (dt.yearday+1);
+				solpos_vals.hour = dt.hour+(dt.is_dst?-1:0);
+				solpos_vals.minute = dt.minute;
+				solpos_vals.second = dt.second;
+				solpos_vals.temp = ((epoch.temperature - 32.0)*5.0/9.0); // degC
+				solpos_vals.press = epoch.pressure;
+				solpos_vals.solcon = epoch.solcon; //Use weather-read version (TMY)
+				solpos_vals.aspect = orientation[n];
+				solpos_vals.tilt = tilt[n];
+				solpos_vals.diff_horz = dhr[n];
+				solpos_vals.dir_norm = dnr[n];
+
+				//Calculate different solar position values
+				sa->S_solpos(&solpos_vals);
+
+				surface[n].cos_incident = ( solpos_vals.cosinc >= 0.0 ? solpos_vals.cosinc : 0.0 );
+				surface[n].sky_factor = solpos_vals.perez_horz;
+				surface[n].ground_factor = 1-cos(tilt[n]);
+			}
+		}
+		solar->add(epoch, n_missing, missing.data(), key.data(), surface.data());
+	}
+
+	for ( size_t n = 0 ; n < count ; n++ )
+	{
+		if ( model == SCM_LIUJORDAN )
+		{
+			value[n] = (shading_value[n]*dnr[n]*surface[n].cos_incident) + dhr[n]*surface[n].sky_factor/2. + ghr[n]*surface[n].ground_factor*get_ground_reflectivity()/2.;
+		}
+		else
+		{
+			value[n] = (shading_value[n]*dnr[n]*surface[n].cos_incident) + dhr[n]*surface[n].sky_factor + ghr[n]*((surface[n].ground_factor)*get_ground_reflectivity()/2.0);
+		}
+	}
+	return 1;
+}
+
+/* pixel of the cloud pattern over a location */
+bool climate::get_cloud_pixel(double latitude, double longitude, int *pixel_x, int *pixel_y)
+{
+	double x = floor(gl_lerp(latitude, MIN_LAT, MIN_LAT_INDEX, MAX_LAT, MAX_LAT_INDEX));
+	double y = floor(gl_lerp(longitude, MIN_LON, MIN_LON_INDEX, MAX_LON, MAX_LON_INDEX));
+	if ( clouds == NULL || ! ( x >= 0 && x < clouds->get_size() && y >= 0 && y < clouds->get_size() ) )
+	{
+		return false;
+	}
+	*pixel_x = (int)x;
+	*pixel_y = (int)y;
+	return true;
+}
+
 int climate::get_binary_cloud_value_for_location(double latitude, double longitude, int *cloud) 
 {
-	int pixel_x = floor(gl_lerp(latitude, MIN_LAT, MIN_LAT_INDEX, MAX_LAT, MAX_LAT_INDEX));
-	int pixel_y = floor(gl_lerp(longitude, MIN_LON, MIN_LON_INDEX, MAX_LON, MAX_LON_INDEX));
-	*cloud = binary_cloud_pattern[pixel_x][pixel_y];
+	int pixel_x, pixel_y;
+	*cloud = ( get_cloud_pixel(latitude, longitude, &pixel_x, &pixel_y) ? clouds->get_binary(pixel_x,pixel_y) : 1 );
 	//Debugging and validation
 	//write_out_cloud_pattern('C');
 //	write_out_cloud_pattern('B');
@@ -1195,9 +1346,21 @@ int climate::get_binary_cloud_value_for_location(double latitude, double longitu
 int climate::get_fuzzy_cloud_value_for_location(double latitude, double longitude, double *cloud) 
 {
 	//write_out_cloud_pattern('F');
-	int pixel_x = floor(gl_lerp(latitude, MIN_LAT, MIN_LAT_INDEX, MAX_LAT, MAX_LAT_INDEX));
-	int pixel_y = floor(gl_lerp(longitude, MIN_LON, MIN_LON_INDEX, MAX_LON, MAX_LON_INDEX));
-	*cloud = fuzzy_cloud_pattern[0][pixel_x][pixel_y];
+	int pixel_x, pixel_y;
+	if ( ! get_cloud_pixel(latitude, longitude, &pixel_x, &pixel_y) )
+	{
+		*cloud = 0; // locations outside the pattern are clear
+	}
+	else if ( cloud_ahead != NULL )
+	{
+		// the pattern itself belongs to the thread computing the clouds ahead
+		int slot = cloud_ahead->find((int64)pixel_x*clouds->get_size() + pixel_y);
+		*cloud = ( cloud_frame != NULL && slot >= 0 ? (*cloud_frame)[slot] : 0 );
+	}
+	else
+	{
+		*cloud = clouds->get_fuzzy(pixel_x,pixel_y);
+	}
 	//Debugging and validation
 //	write_out_cloud_pattern('F');
 //	write_out_cloud_pattern('B');
@@ -1210,88 +1373,54 @@ int climate::get_fuzzy_cloud_value_for_location(double latitude, double longitud
 void climate::init_cloud_pattern() {
 
 	using std::vector;
-	int num_points = 0;
+	OBJECT *obj = THISOBJECTHDR;
 
-	// find the solar objects and count them
-	OBJECT *gr_obj = 0;
+	// find the solar objects that have a lat and lon
+	vector<vector<double> > coord_list;
 	FINDLIST *items = gl_find_objects(FL_GROUP, "class=solar");
-	for(gr_obj = gl_find_next(items, 0); gr_obj != 0; gr_obj = gl_find_next(items, gr_obj)  ) {
-		num_points++;
-	}
-
-	// resize the container to the max number of objects
-	vector<vector<double > > coord_list;
-	coord_list.resize(num_points);
-	for (int i = 0; i < num_points; ++i ) {
-	    coord_list[i].resize(2);
-	}
-
-	// now populate the lat and lon, but only for those that have it
-	PROPERTY *p_ptr;
-	double latitude, longitude;
-	num_points = 0;
-	for(gr_obj = gl_find_next(items, 0); gr_obj != 0; gr_obj = gl_find_next(items, gr_obj)  ) {
-		p_ptr = gl_get_property(gr_obj, "latitude");
-		latitude = *gl_get_double(gr_obj, p_ptr);
-		p_ptr = gl_get_property(gr_obj, "longitude");
-		longitude = *gl_get_double(gr_obj, p_ptr);
-		if (longitude != NaN && latitude != NaN) {
-			coord_list[num_points][0] = latitude;
-			coord_list[num_points][1] = longitude;
-			num_points++;
+	for ( OBJECT *gr_obj = gl_find_next(items, 0) ; gr_obj != 0 ; gr_obj = gl_find_next(items, gr_obj) )
+	{
+		if ( ! isnan(gr_obj->latitude) && ! isnan(gr_obj->longitude) )
+		{
+			vector<double> coord(2);
+			coord[0] = gr_obj->latitude;
+			coord[1] = gr_obj->longitude;
+			coord_list.push_back(coord);
 		}
 	}
-
-	// finally resize to the number of solar objects that have lat and lon
-	coord_list.resize(num_points);
-
+	if ( coord_list.empty() )
+	{
+		error("the cumulus cloud model requires at least one solar object with a latitude and longitude");
+		/* TROUBLESHOOT
+			The cumulus cloud model covers the area of the solar objects that have a latitude
+			and longitude, but no such solar objects were found.  Set the latitude and longitude
+			of the solar objects and try again.
+		 */
+		return;
+	}
 
 	int num_tile_edge = calc_cloud_pattern_size(coord_list);
-	cloud_pattern_size = num_tile_edge * CLOUD_TILE_SIZE + 1; //pattern must be 2^x + 1 square
-	on_screen_size = (num_tile_edge - 2) * CLOUD_TILE_SIZE; //Off-screen area is one tile width around the perimeter of the on-screen area.
-
-	//Build empty cloud pattern array
-	cloud_pattern.resize(cloud_pattern_size);
-	binary_cloud_pattern.resize(cloud_pattern_size);
-	normalized_cloud_pattern.resize(cloud_pattern_size);
-	for (int i = 0; i < cloud_pattern_size; ++i ) {
-	    cloud_pattern[i].resize(cloud_pattern_size);
-	    binary_cloud_pattern[i].resize(cloud_pattern_size);
-	    normalized_cloud_pattern[i].resize(cloud_pattern_size);
-	}
-
-	//Initializing array to EMPTY_VALUE
-  //TDH: trivially parallelizable
-	for (int i = 0; i < cloud_pattern_size; i++  ) {
-			for (int j = 0; j < cloud_pattern_size; j++ ) {
-				cloud_pattern[i][j] = EMPTY_VALUE;
-				binary_cloud_pattern[i][j] = EMPTY_VALUE;
-				normalized_cloud_pattern[i][j] = EMPTY_VALUE;
-			}
-	}
 
-	for (int i = 0; i < num_tile_edge; i++  ) {
-		for (int j = 0; j < num_tile_edge; j++ ) {
-			//Building pattern as a series of tiles
-			int col_min = i*CLOUD_TILE_SIZE;
-			int col_max = ((i+1)*CLOUD_TILE_SIZE);
-			int row_min = j*CLOUD_TILE_SIZE;
-			int row_max = ((j+1)*CLOUD_TILE_SIZE);
-			build_cloud_pattern(col_min, col_max, row_min, row_max); //Min/Max x/y must always define a 2^x + 1 region of cloud_pattern
-			//write_out_cloud_pattern('C');
-		}
-	}
+	//Building pattern as a series of tiles
+	clouds = new cloud_pattern(num_tile_edge, obj->rng_state);
+	clouds->build();
+	//write_out_cloud_pattern('C');
 }
 
 void climate::update_cloud_pattern(TIMESTAMP delta_t) {
+	move_cloud_pattern(clouds, get_wind_speed(), get_wind_dir(), get_solar_zenith(), get_opq_sky_cov(), delta_t);
+}
+
+/* move a cloud pattern with the wind and update its shading (does not change the climate, so it may be used by another thread) */
+void climate::move_cloud_pattern(cloud_pattern *pattern, double windspeed_tmy2, double wind_direct, double solar_zenith, double opq_sky_cov, TIMESTAMP delta_t)
+{
 	int col_shifted_px = 0;
 	int row_shifted_px = 0;
 	double col_shift_request_px = 0;
 	double row_shift_request_px = 0;
 
 	// Calculating pattern shift vector due to wind
-	double windspeed_tmy2 = get_wind_speed() * cloud_speed_factor;
-	double wind_direct = get_wind_dir();
+	windspeed_tmy2 = windspeed_tmy2 * cloud_speed_factor;
 
 	//Using European Wind Atlas terrain roughness class and length to translate TMY2 windspeed at 10m to
 	// cumulus cloud height, 1000m.
@@ -1340,572 +1469,196 @@ void climate::update_cloud_pattern(TIMESTAMP delta_t) {
 		row_shifted_px = row_shifted_px + row_shift;
 	}
 
-	int row_boundary = abs(row_shift);
-	int col_boundary = abs(col_shift);
-
-	int col = 0;
-	int row = 0;
-
 	if (row_shift != 0 || col_shift != 0 ) {
-		if (row_shift >= 0 && col_shift >= 0  ) { //Wind blows from SW to NE
-			if (col_shift > 0) {
-				col = CLOUD_TILE_SIZE - col_boundary;
-				//Checking to see if barely off-screen values are empty before shifting the pattern.
-				// If check is not done, may result in EMPTY_VALUES getting shifted on_screen.
-				for (row = CLOUD_TILE_SIZE; row < CLOUD_TILE_SIZE + on_screen_size; row++ ) {
-					if (cloud_pattern[row][col] == EMPTY_VALUE) {
-						rebuild_cloud_pattern_edge('W');
-						break;
-					}
-				}
-			}
-			if (row_shift > 0 ) {
-				row = CLOUD_TILE_SIZE - row_boundary;
-				for (col = CLOUD_TILE_SIZE; col < CLOUD_TILE_SIZE + on_screen_size; col++ ) {
-					if (cloud_pattern[row][col] == EMPTY_VALUE) {
-						rebuild_cloud_pattern_edge('S');
-						break;
-					}
-				}
-			}
-			//Shifting pattern (after any edges have been rebuilt).
-			for (row = cloud_pattern_size - 1; row >= 0; row-- ) {
-				for (col = cloud_pattern_size - 1; col >= 0; col-- ) {
-					if (row + row_shift > cloud_pattern_size -1  ) {
-						cloud_pattern[row][col] = EMPTY_VALUE;
-					}else if (col + col_shift > cloud_pattern_size -1  ) {
-						cloud_pattern[row][col] = EMPTY_VALUE;
-					} else {
-						cloud_pattern[row + row_shift][col + col_shift] = cloud_pattern[row][col];
-						cloud_pattern[row][col] = EMPTY_VALUE;
-					}
-				}
-			}
-		} else if (row_shift >= 0 && col_shift <= 0  ) { //Wind blows from SE to NW
-			if (col_shift < 0) {
-				col = CLOUD_TILE_SIZE + on_screen_size +  col_boundary;
-				//Checking to see if barely off-screen values are empty before shifting the pattern.
-				// If check is not done, may result in EMPTY_VALUES getting shifted on_screen.
-				for (row = CLOUD_TILE_SIZE; row < CLOUD_TILE_SIZE + on_screen_size; row++ ) {
-					if (cloud_pattern[row][col] == EMPTY_VALUE) {
-						rebuild_cloud_pattern_edge('E');
-						break;
-					}
-				}
-			}
-			if (row_shift > 0 ) {
-				row = CLOUD_TILE_SIZE - row_boundary;
-				for (col = CLOUD_TILE_SIZE; col < CLOUD_TILE_SIZE + on_screen_size; col++ ) {
-					if (cloud_pattern[row][col] == EMPTY_VALUE) {
-						rebuild_cloud_pattern_edge('S');
-						break;
-					}
-				}
-			}
-			//Shifting pattern (after any edges have been rebuilt).
-			for (row = cloud_pattern_size - 1; row >= 0; row-- ) {
-				for (col = 0; col < cloud_pattern_size; col++ ) {
-					if (row + row_shift > cloud_pattern_size -1  ) {
-						cloud_pattern[row][col] = EMPTY_VALUE;
-					}else if (col + col_shift < 0  ) {
-						cloud_pattern[row][col] = EMPTY_VALUE;
-					} else {
-						cloud_pattern[row + row_shift][col + col_shift] = cloud_pattern[row][col];
-						cloud_pattern[row][col] = EMPTY_VALUE;
-					}
-				}
-			}
-		} else if (row_shift <= 0 && col_shift >= 0  ) { //Wind blows from NW to SE
-			if (col_shift > 0) {
-				col = CLOUD_TILE_SIZE - col_boundary;
-				//Checking to see if barely off-screen values are empty before shifting the pattern.
-				// If check is not done, may result in EMPTY_VALUES getting shifted on_screen.
-				for (row = CLOUD_TILE_SIZE; row <= CLOUD_TILE_SIZE + on_screen_size; row++ ) {
-					if (cloud_pattern[row][col] == EMPTY_VALUE) {
-						rebuild_cloud_pattern_edge('W');
-						break;
-					}
-				}
-			}
-			if (row_shift < 0 ) {
-				row = CLOUD_TILE_SIZE + on_screen_size + row_boundary;
-				for (col = CLOUD_TILE_SIZE; col < CLOUD_TILE_SIZE + on_screen_size; col++ ) {
-					if (cloud_pattern[row][col] == EMPTY_VALUE) {;
-						rebuild_cloud_pattern_edge('N');
-						break;
-					}
-				}
-			}
-			//Shifting pattern (after any edges have been rebuilt).
-			for (row = 0; row < cloud_pattern_size ; row++ ) {
-				for (col = cloud_pattern_size - 1; col >= 0; col-- ) {
-					if (row + row_shift <  0  ) {
-						cloud_pattern[row][col] = EMPTY_VALUE;
-					}else if (col + col_shift > cloud_pattern_size -1  ) {
-						cloud_pattern[row][col] = EMPTY_VALUE;
-					} else {
-						cloud_pattern[row + row_shift][col + col_shift] = cloud_pattern[row][col];
-						cloud_pattern[row][col] = EMPTY_VALUE;
-					}
-				}
-			}
-		} else if (row_shift <= 0 && col_shift <= 0  ) { //Wind blows from NE to SW
-			if (col_shift < 0) {
-				col = CLOUD_TILE_SIZE + on_screen_size + col_boundary;
-				//Checking to see if barely off-screen values are empty before shifting the pattern.
-				// If check is not done, may result in EMPTY_VALUES getting shifted on_screen.
-				for (row = CLOUD_TILE_SIZE; row < CLOUD_TILE_SIZE + on_screen_size; row++ ) {
-					if (cloud_pattern[row][col] == EMPTY_VALUE) {
-						rebuild_cloud_pattern_edge('E');
-						break;
-					}
-				}
-			}
-			if (row_shift < 0 ) {
-				row = CLOUD_TILE_SIZE + on_screen_size + row_boundary;
-				for (col = CLOUD_TILE_SIZE; col < CLOUD_TILE_SIZE + on_screen_size; col++ ) {
-					if (cloud_pattern[row][col] == EMPTY_VALUE) {
-						rebuild_cloud_pattern_edge('N');
-						break;
-					}
-				}
-			}
-			//Shifting pattern (after any edges have been rebuilt).
-			for (row = 0; row < cloud_pattern_size ; row++ ) {
-				for (col = 0; col < cloud_pattern_size; col++ ) {
-					if (row + row_shift <  0  ) {
-						cloud_pattern[row][col] = EMPTY_VALUE;
-					}else if (col + col_shift < 0  ) {
-						cloud_pattern[row][col] = EMPTY_VALUE;
-					} else {
-						cloud_pattern[row + row_shift][col + col_shift] = cloud_pattern[row][col];
-						cloud_pattern[row][col] = EMPTY_VALUE;
-					}
-				}
-			}
-		} else {
-			//Shouldn't be able to get here.
-		}
-		solar_zenith = get_solar_zenith();
+		pattern->move(row_shift, col_shift);
 		if (solar_zenith < (110*PI/180)) { //Only do these things if the sun is above (or slightly below) the horizon).
 				//Fractal cloud pattern is preserved and shifted appropriately but since the sun is below the horizon
 				//  and the solar radiation on the surface is zero, we don't need to fully define the clouds.
 			//Finding cloud outline shape
-			double cut_elevation = 0;
-			cut_elevation = convert_to_binary_cloud();
+			double cut_elevation = pattern->convert_to_binary(opq_sky_cov);
 			//write_out_cloud_pattern('B');
-			convert_to_fuzzy_cloud(cut_elevation, cloud_num_layers, cloud_alpha);
+			pattern->convert_to_fuzzy(cut_elevation, cloud_num_layers, cloud_alpha);
 			//write_out_cloud_pattern('F');
 		}
 	}
-
-}
-double climate::convert_to_binary_cloud( ) {
-	//Convert fractal cloud pattern to binary value based on TMY2 opaque sky value.
-	//Place-holder location.  Eventually needs to be driven by objects asking for updated
-	//  cloud values.  If the time since the last conversion is non-zero, this function needs
-	//  to run to generate the new binary value.
-	double cloud_value = get_opq_sky_cov(); //get_tot_sky_cov() or get_opq_sky_cov()
-
-	/* TDH:
-	 * Trying to counteract the fuzzification process by artificially boosting the coverage.
-	 * This is a bit of a hack. The best way to handle this is to include the fuzzification process
-	 * in the elevation cut adjustment. This way, the percentage of the sky covered by opaque clouds
-	 * is ensured after the fuzzification has taken place. I've tested this and it REALLY slows things
-	 * down (in an already slow function). For now, this is what I've chosen to do because it more
-	 * or less works.
-	*/
-	cloud_value = cloud_value * 2.0;
-	if (cloud_value >= 1 ) {
-		cloud_value = 0.99;
-	}
-
-
-
-	double search_tolerance = 0.005; //Defines how close is close enough when dialing in the binary cloud pattern.
-	//OBJECT *obj=THISOBJECTHDR;
-	//TIMESTAMP t1 = obj->clock;
-
-
-	//TDH: trivially parallelizable
-	 double cloud_pattern_max = cloud_pattern[CLOUD_TILE_SIZE][CLOUD_TILE_SIZE];
-	 double cloud_pattern_min = cloud_pattern[CLOUD_TILE_SIZE][CLOUD_TILE_SIZE];
-	 //Finding max and min value
-	 for (int i = 0; i < cloud_pattern_size; i++ ) {
-		for (int j = 0; j < cloud_pattern_size; j++ ) {
-			if (cloud_pattern[i][j] != EMPTY_VALUE ) {
-				if (cloud_pattern[i][j] > cloud_pattern_max ) {
-					cloud_pattern_max = cloud_pattern[i][j];
-				}
-				if (cloud_pattern[i][j] < cloud_pattern_min ) {
-					cloud_pattern_min = cloud_pattern[i][j];
-				}
-			}
-		}
-	 }
-
-	 double cloud_pattern_range = cloud_pattern_max - cloud_pattern_min;
-	 double cut_elevation = cloud_pattern_min;
-	 int running_count = 0;
-	 double measured_coverage = 0;
-	 double step_size = 0;
-	 double max_cut_elevation = cloud_pattern_max;
-	 double min_cut_elevation = cloud_pattern_min;
-
-	 //Creating normalized cloud pattern
-	 for (int i = 0; i < cloud_pattern_size; i++ ) {
-		for (int j = 0; j < cloud_pattern_size; j++ ) {
-			if (cloud_pattern[i][j] != EMPTY_VALUE ) {
-				normalized_cloud_pattern[i][j] = (cloud_pattern[i][j] - cloud_pattern_min)/cloud_pattern_range;
-			}
-		}
-	 }
-
-	 do{
-		 cut_elevation += step_size;
-		 running_count = 0;
-		 for (int i = CLOUD_TILE_SIZE; i < CLOUD_TILE_SIZE + on_screen_size; i++ ) {
-			 for (int j = CLOUD_TILE_SIZE; j < CLOUD_TILE_SIZE + on_screen_size; j++ ) {
-				 if (normalized_cloud_pattern[i][j] != EMPTY_VALUE && normalized_cloud_pattern[i][j] <= cut_elevation ) {//Values less than cut elevation are clouds
-					 running_count++;
-				 }
-			 }
-		 }
-		 measured_coverage = double(running_count)/(on_screen_size * on_screen_size); //Factor, range [0 1]
-
-		 //Calculating next cut elevation.
-		 if (measured_coverage > (cloud_value + search_tolerance) ) {
-			 max_cut_elevation = cut_elevation;
-			 step_size = (max_cut_elevation - min_cut_elevation)/-2;
-		 }else if (measured_coverage < (cloud_value - search_tolerance) ) {
-			 min_cut_elevation = cut_elevation;
-			 step_size = (max_cut_elevation - min_cut_elevation)/2;
-		 }
-	 } while (measured_coverage < (cloud_value - search_tolerance) || measured_coverage > (cloud_value + search_tolerance));
-
-	 //Converting cloud_pattern to binary_cloud_pattern
- //TDH: trivially parallelizable
-	 for (int i = 0; i < cloud_pattern_size; i++ ) {
-		 for (int j = 0; j < cloud_pattern_size; j++ ) {
-			 if (normalized_cloud_pattern[i][j] == EMPTY_VALUE) {
-				 binary_cloud_pattern[i][j] = EMPTY_VALUE;
-			 }else if (normalized_cloud_pattern[i][j] <= cut_elevation ) {
-				 binary_cloud_pattern[i][j] = 0; //Cloud
-			 }else if (normalized_cloud_pattern[i][j] > cut_elevation ) {
-				 binary_cloud_pattern[i][j] = 1; //Blue sky
-			 }
-		 }
-	 }
-	 return cut_elevation;
-
 }
 
-void climate::convert_to_fuzzy_cloud( double cut_elevation, int num_fuzzy_layers, double alpha ) {
-
-	double shade_step_size = 1.0/alpha;
-
-	if (cut_elevation == EMPTY_VALUE ) { //Initialization call uses EMPTY_VALUE as the cut elevation.
-    //TDH: trivially parallelizable
-		//Resizing fuzzy cloud pattern
-		fuzzy_cloud_pattern.resize(num_fuzzy_layers);
-		for (int i = 0; i < num_fuzzy_layers; ++i ) {
-			fuzzy_cloud_pattern[i].resize(cloud_pattern_size);
-			for(int j = 0; j < cloud_pattern_size; j++ ) {
-				fuzzy_cloud_pattern[i][j].resize(cloud_pattern_size);
-			}
-		}
-
-		//Initializing fuzzy cloud pattern
-    //TDH: trivially parallelizable
-		for (int i = 0; i < num_fuzzy_layers; i++ ) {
-			for (int j = 0; j < cloud_pattern_size; j++ ) {
-				for (int k = 0; k < cloud_pattern_size; k++ ) {
-					fuzzy_cloud_pattern[i][j][k] = 0;
-				 }
-			 }
-		 }
-	}
-
-	//Filling in fuzzy pattern with random values
-  //TDH: trivially parallelizable
-	for (int i = 0; i < num_fuzzy_layers; i++ ) 
+/* weather used by the cloud model at any time (does not change the climate, so it may be used by another thread)
+   the values given are kept for the columns a compiled weather file does not have */
+bool climate::get_cloud_weather(TIMESTAMP t, SolarAngles *angles, double *wind_speed_at, double *wind_dir_at, double *opq_sky_cov_at, double *solar_zenith_at)
+{
+	if ( reader_type == RT_BINARY )
 	{
-		double rand_upper = ((double)(i+1)/(double)num_fuzzy_layers)*cut_elevation;
-		double rand_lower = (((double)(i+1)-1)/(double)num_fuzzy_layers)*cut_elevation;
-		for (int j = 0; j < cloud_pattern_size; j++ ) 
+		int64 row = binary->find(t);
+		double f = 0.0;
+		if ( row < 0 )
 		{
-			for (int kk = 0; kk < cloud_pattern_size; kk++ ) 
-			{
-				if (binary_cloud_pattern[j][kk] == 0.0 && normalized_cloud_pattern[j][kk] != EMPTY_VALUE && fuzzy_cloud_pattern[0][j][kk] != EMPTY_VALUE ) 
-				{ 
-					//Areas with 0 in the binary pattern are cloudy
-					if (normalized_cloud_pattern[j][kk] <= cut_elevation - ((i+1)*shade_step_size) ) 
-					{ 
-						//only values below the cut elevation accumulate
-						fuzzy_cloud_pattern[0][j][kk] = gl_random_uniform(RNGSTATE,rand_lower, rand_upper)  + fuzzy_cloud_pattern[0][j][kk];
-					}
-				}
-				else 
-				{ 
-					//EMPTY_VALUES get coerced into 0.
-					fuzzy_cloud_pattern[0][j][kk] = 0;
-				}
-			}
-		}
-	}
-
-	//write_out_cloud_pattern('F');
-	//Normalizing fuzzy pattern
-	double max_value = fuzzy_cloud_pattern[0][0][0];
-	double min_value = fuzzy_cloud_pattern[0][0][0];
-	for (int j = 0; j < cloud_pattern_size; j++ ) {
-		for (int k = 0; k < cloud_pattern_size; k++ ) {
-			if (fuzzy_cloud_pattern[0][j][k] > max_value ) {
-				max_value = fuzzy_cloud_pattern[0][j][k];
-			}
-			if (fuzzy_cloud_pattern[0][j][k] < min_value ) {
-				min_value = fuzzy_cloud_pattern[0][j][k];
-			}
-		}
-	}
-	double range = max_value - min_value;
-	if (range != 0 ) {
-		for (int j = 0; j < cloud_pattern_size; j++ ) {
-			for (int k = 0; k < cloud_pattern_size; k++ ) {
-				double value = (fuzzy_cloud_pattern[0][j][k] - min_value)/range;
-				fuzzy_cloud_pattern[0][j][k] = value;
-			}
-		}
-	}else{
-		//Do we need to to anything if the pattern is uniform?
-	}
-
-	///
-	//Put EMPTY_VALUEs back in before calling it good.
-  //TDH: trivially parallelizable
-	for (int j = 0; j < cloud_pattern_size; j++ ) {
-		for (int k = 0; k < cloud_pattern_size; k++ ) {
-			if (cloud_pattern[j][k] == EMPTY_VALUE ) {
-				fuzzy_cloud_pattern[0][j][k] = EMPTY_VALUE;
-			}
-
-		}
-	}
-	//write_out_cloud_pattern('F');
-
-}
-
-
-void climate::rebuild_cloud_pattern_edge( char edge_needing_rebuilt ) {
-	int col_min = 0;
-	int row_min = 0;
-	int i = 0;
-
-	if (edge_needing_rebuilt == 'W' ) {
-		col_min = 0;
-		row_min = 0;
-		erase_off_screen_pattern('W');
-		for (i = 0; i < 1 + on_screen_size/CLOUD_TILE_SIZE + 1; i++  ) {
-			build_cloud_pattern(col_min, col_min + CLOUD_TILE_SIZE, row_min, row_min + CLOUD_TILE_SIZE); //Min/Max x/y must always define a 2^x + 1 region of cloud_pattern
-			row_min = row_min + CLOUD_TILE_SIZE;
-		}
-		trim_pattern_edge('W');
-	} else if (edge_needing_rebuilt == 'E' ) {
-		col_min = CLOUD_TILE_SIZE + on_screen_size - 1;
-		row_min = 0;
-		erase_off_screen_pattern('E');
-		for (i = 0; i < 1 + on_screen_size/CLOUD_TILE_SIZE + 1; i++  ) {
-			build_cloud_pattern(col_min, col_min + CLOUD_TILE_SIZE, row_min, row_min + CLOUD_TILE_SIZE); //Min/Max x/y must always define a 2^x + 1 region of cloud_pattern
-			row_min = row_min + CLOUD_TILE_SIZE;
-		}
-		trim_pattern_edge('E');
-	} else if (edge_needing_rebuilt == 'N' ) {
-		col_min = 0;
-		row_min = CLOUD_TILE_SIZE + on_screen_size - 1;
-		erase_off_screen_pattern('N');
-		for (i = 0; i < 1 + on_screen_size/CLOUD_TILE_SIZE + 1; i++  ) {
-			build_cloud_pattern(col_min, col_min + CLOUD_TILE_SIZE, row_min, row_min + CLOUD_TILE_SIZE); //Min/Max row/col must always define a 2^x + 1 region of cloud_pattern
-			col_min = col_min + CLOUD_TILE_SIZE;
-		}
-		trim_pattern_edge('N');
-	} else if (edge_needing_rebuilt == 'S' ) {
-		col_min = 0;
-		row_min = 0;
-		erase_off_screen_pattern('S');
-		for (i = 0; i < 1 + on_screen_size/CLOUD_TILE_SIZE + 1; i++  ) {
-			build_cloud_pattern(col_min, col_min + CLOUD_TILE_SIZE, row_min, row_min + CLOUD_TILE_SIZE); //Min/Max row/col must always define a 2^x + 1 region of cloud_pattern
-			col_min = col_min + CLOUD_TILE_SIZE;
-		}
-		trim_pattern_edge('S');
-	} else{
-		// Shouldn't be able to get here.
-	}
-}
-
-void climate::trim_pattern_edge( char rebuilt_edge ) {
-	int min_edge = 0;
-	int min_edge_1 = 0;
-	int min_edge_2 = min_edge_1;
-	int min_edge_3 = min_edge_1;
-	int max_edge = 0;
-	int max_edge_1 = CLOUD_TILE_SIZE + on_screen_size + CLOUD_TILE_SIZE;
-	int max_edge_2 = max_edge_1;
-	int max_edge_3 = max_edge_1;
-	int i = 0;
-	int j = 0;
-	//write_out_cloud_pattern('C');
-	if (rebuilt_edge == 'W' || rebuilt_edge == 'E' ) {
-		//Checking for boundary at southern edge of pattern.
-		//Check three regions in areas south of on-screen: W, center, and E
-    //TDH: trivially parallelizable - all three of these loops
-		for (i = 0; i < CLOUD_TILE_SIZE; i++ ) {
-			if (cloud_pattern[i][10] != EMPTY_VALUE ) {
-				min_edge_1 = i;
-				break;
-			}
+			row = 0;
 		}
-		for (i = 0; i < CLOUD_TILE_SIZE; i++ ) {
-			if (cloud_pattern[i][CLOUD_TILE_SIZE + 10] != EMPTY_VALUE ) {
-				min_edge_2 = i;
-				break;
-			}
-		}
-		for (i = 0; i < CLOUD_TILE_SIZE; i++ ) {
-			if (cloud_pattern[i][CLOUD_TILE_SIZE + on_screen_size + 10] != EMPTY_VALUE ) {
-				min_edge_3 = i;
-				break;
-			}
-		}
-		min_edge = std::max(min_edge_1,min_edge_2);
-		min_edge = std::max(min_edge,min_edge_3);
-
-
-		//Checking for boundary at northern edge of pattern
-		for (i = CLOUD_TILE_SIZE + on_screen_size; i < cloud_pattern_size; i++ ) {
-			if (cloud_pattern[i][10] == EMPTY_VALUE ) {
-				max_edge_1 = i;
-				break;
-			}
-		}
-		for (i = CLOUD_TILE_SIZE + on_screen_size; i < cloud_pattern_size; i++ ) {
-			if (cloud_pattern[i][CLOUD_TILE_SIZE + 10] == EMPTY_VALUE ) {
-				max_edge_2 = i;
-				break;
-			}
-		}
-		for (i = CLOUD_TILE_SIZE + on_screen_size; i < cloud_pattern_size; i++ ) {
-			if (cloud_pattern[i][CLOUD_TILE_SIZE + on_screen_size + 10] == EMPTY_VALUE ) {
-				max_edge_3 = i;
-				break;
-			}
-		}
-		max_edge = std::min(max_edge_1,max_edge_2);
-		max_edge = std::min(max_edge,max_edge_3);
-
-		//Trimming pattern
-    //TDH: trivially parallelizable
-		for(j = 0; j < cloud_pattern_size; j++ ) {
-			for(i = 0; i < min_edge; i++ ) {
-				cloud_pattern[i][j] = EMPTY_VALUE;
-			}
-			for(i = max_edge; i < cloud_pattern_size; i++ ) {
-				cloud_pattern[i][j] = EMPTY_VALUE;
-			}
-		}
-		//write_out_cloud_pattern('C');
-	} else 	if (rebuilt_edge == 'N' || rebuilt_edge == 'S' ) {
-		//Checking for boundary at western edge of pattern.
-		//Check three regions in areas south of on-screen: S, center, and N
-		//write_out_cloud_pattern('C');
-    //TDH: trivially parallelizable - all three of these loops
-		for (j = 0; j < CLOUD_TILE_SIZE; j++ ) {
-			if (cloud_pattern[10][j] != EMPTY_VALUE ) {
-				min_edge_1 = j;
-				break;
-			}
+		else if ( interpolate != CI_NONE && row+1 < binary->get_rows() )
+		{
+			f = (double)(t - binary->get_time(row)) / (double)(binary->get_time(row+1) - binary->get_time(row));
 		}
-		for (j = 0; j < CLOUD_TILE_SIZE; j++ ) {
-			if (cloud_pattern[CLOUD_TILE_SIZE + 10][j] != EMPTY_VALUE ) {
-				min_edge_2 = j;
-				break;
-			}
+		const double *data = binary->get_data(row);
+		const double *next = binary->get_data(f > 0 ? row+1 : row);
+		for ( int n = 0 ; n < binary->get_columns() ; n++ )
+		{
+			BINARYCOLUMN &column = binary_columns[n];
+			double value = column.offset + column.scale * (data[n] + f*(next[n]-data[n]));
+			if ( column.value == &wind_speed ) *wind_speed_at = value;
+			else if ( column.value == &wind_dir ) *wind_dir_at = value;
+			else if ( column.value == &opq_sky_cov ) *opq_sky_cov_at = value;
+		}
+		short month, day;
+		double hour;
+		weather_binary::standard_time(t,tz_offset_val,&month,&day,&hour);
+		short doy = angles->day_of_yr(month,day);
+		double sol_time = angles->solar_time(hour,doy,RAD(tz_meridian),RAD(get_longitude()));
+		*solar_zenith_at = (90. * PI_OVER_180) - angles->altitude(doy,RAD(get_latitude()),sol_time);
+		return true;
+	}
+	else if ( tmy != NULL )
+	{
+		// same hour of the year as presync()
+		DATETIME ts;
+		if ( gl_localtime(t,&ts) == 0 )
+		{
+			return false;
 		}
-		for (j = 0; j < CLOUD_TILE_SIZE; j++ ) {
-			if (cloud_pattern[CLOUD_TILE_SIZE + on_screen_size + 10][j] != EMPTY_VALUE ) {
-				min_edge_3 = j;
-				break;
-			}
+		int hoy = (angles->day_of_yr(ts.month,ts.day) - 1) * 24 + ts.hour;
+		if ( ! is_TMY2 )
+		{
+			hoy -= ( ts.is_dst ? 2 : 1 );
 		}
-		min_edge = std::max(min_edge_1,min_edge_2);
-		min_edge = std::max(min_edge,min_edge_3);
-
-		//Checking for boundary at eastern edge of pattern
-		for (j = CLOUD_TILE_SIZE + on_screen_size; j < cloud_pattern_size; j++ ) {
-			if (cloud_pattern[10][j] == EMPTY_VALUE ) {
-				max_edge_1 = j;
+		if ( hoy < 0 )
+		{
+			hoy += 8760;
+		}
+		// same interpolation and limits as presync()
+		int next = (hoy + 1) % 8760;
+		int next2 = (hoy + 2) % 8760;
+		double now = hoy+ts.minute/60.0;
+		double hoy0 = hoy;
+		double hoy1 = hoy+1.0;
+		double hoy2 = hoy+2.0;
+		switch ( interpolate ) {
+			case CI_NONE:
+				*wind_speed_at = tmy[hoy].windspeed;
+				*wind_dir_at = tmy[hoy].wind_dir;
+				*opq_sky_cov_at = tmy[hoy].opq_sky_cov;
+				*solar_zenith_at = tmy[hoy].solar_zenith;
 				break;
-			}
-		}
-		for (j = CLOUD_TILE_SIZE + on_screen_size; j < cloud_pattern_size; j++ ) {
-			if (cloud_pattern[CLOUD_TILE_SIZE + 10][j] == EMPTY_VALUE ) {
-				max_edge_2 = j;
+			case CI_LINEAR:
+				*wind_speed_at = gl_lerp(now, hoy0, tmy[hoy].windspeed, hoy1, tmy[next].windspeed);
+				*wind_dir_at = gl_lerp(now, hoy0, tmy[hoy].wind_dir, hoy1, tmy[next].wind_dir);
+				*opq_sky_cov_at = gl_lerp(now, hoy0, tmy[hoy].opq_sky_cov, hoy1, tmy[next].opq_sky_cov);
+				*solar_zenith_at = gl_lerp(now, hoy0, tmy[hoy].solar_zenith, hoy1, tmy[next].solar_zenith);
 				break;
-			}
-		}
-		for (j = CLOUD_TILE_SIZE + on_screen_size; j < cloud_pattern_size; j++ ) {
-			if (cloud_pattern[CLOUD_TILE_SIZE + on_screen_size + 10][j] == EMPTY_VALUE ) {
-				max_edge_3 = j;
+			case CI_QUADRATIC:
+				*wind_speed_at = gl_qerp(now, hoy0, tmy[hoy].windspeed, hoy1, tmy[next].windspeed, hoy2, tmy[next2].windspeed);
+				if ( *wind_speed_at < 0.0 )
+				{
+					*wind_speed_at = 0.0;
+				}
+				*wind_dir_at = gl_qerp(now, hoy0, tmy[hoy].wind_dir, hoy1, tmy[next].wind_dir, hoy2, tmy[next2].wind_dir);
+				if ( *wind_dir_at < 0.0 )
+				{
+					*wind_dir_at = 360.0 + *wind_dir_at;
+				}
+				if ( *wind_dir_at > 360.0 )
+				{
+					*wind_dir_at = *wind_dir_at - 360.0;
+				}
+				*opq_sky_cov_at = gl_qerp(now, hoy0, tmy[hoy].opq_sky_cov, hoy1, tmy[next].opq_sky_cov, hoy2, tmy[next2].opq_sky_cov);
+				if ( *opq_sky_cov_at < 0.0 )
+				{
+					*opq_sky_cov_at = 0.0;
+				}
+				*solar_zenith_at = gl_qerp(now, hoy0, tmy[hoy].solar_zenith, hoy1, tmy[next].solar_zenith, hoy2, tmy[next2].solar_zenith);
 				break;
-			}
-		}
-		max_edge = std::min(max_edge_1,max_edge_2);
-		max_edge = std::min(max_edge,max_edge_3);
-
-		//Trimming pattern
-    //TDH: trivially parallelizable
-		for(i = 0; i < cloud_pattern_size; i++ ) {
-			for(j = 0; j < min_edge; j++ ) {
-				cloud_pattern[i][j] = EMPTY_VALUE;
-			}
-			for(j = max_edge; j < cloud_pattern_size; j++ ) {
-				cloud_pattern[i][j] = EMPTY_VALUE;
-			}
+			default:
+				return false;
 		}
-	} else {
-		//Shouldn't be able to get here.
+		return true;
+	}
+	else
+	{
+		// readers cannot be read ahead
+		return false;
 	}
-	//write_out_cloud_pattern('C');
 }
 
-void climate::erase_off_screen_pattern( char edge_to_erase)
+/* run the cloud model a day ahead of the simulation, keeping the cloud shading over the solar objects every minute */
+void climate::start_cloud_precompute(TIMESTAMP t0)
 {
-  //TDH: trivially parallelizable - all four of these loops
-	if (edge_to_erase == 'W' ) {
-		for (int i = 0; i < cloud_pattern_size; i++ ) { //rows
-			for (int j = 0; j < CLOUD_TILE_SIZE - 1; j++ ) { //cols
-				cloud_pattern[i][j] = EMPTY_VALUE;
-			}
-		}
-	} else if (edge_to_erase == 'E' ) {
-		for (int i = 0; i < cloud_pattern_size; i++ ) { //rows
-			for (int j = cloud_pattern_size - CLOUD_TILE_SIZE + 1; j < cloud_pattern_size; j++ ) { //cols
-				cloud_pattern[i][j] = EMPTY_VALUE;
-			}
-		}
-	} else if (edge_to_erase == 'N' ) {
-		for (int i = cloud_pattern_size - CLOUD_TILE_SIZE + 1; i < cloud_pattern_size; i++ ) { //rows
-			for (int j = 0; j < cloud_pattern_size; j++ ) { //cols
-				cloud_pattern[i][j] = EMPTY_VALUE;
-			}
+	double value = 0.0;
+	if ( ! get_cloud_weather(t0, sa, &value, &value, &value, &value) )
+	{
+		warning("cloud_precompute is not supported with weather readers, the clouds will be computed as the simulation runs");
+		/* TROUBLESHOOT
+			Clouds can only be computed ahead of the simulation when the weather is read from
+			a TMY or compiled weather file, because the weather readers only read the weather
+			at the current time.  Use a TMY or compiled weather file, or set cloud_precompute
+			to FALSE to remove this warning.
+		 */
+		cloud_precompute = false;
+		return;
+	}
+
+	// pixels over the solar objects
+	std::vector<int64> pixels;
+	FINDLIST *items = gl_find_objects(FL_GROUP, "class=solar");
+	for ( OBJECT *gr_obj = gl_find_next(items, 0) ; gr_obj != 0 ; gr_obj = gl_find_next(items, gr_obj) )
+	{
+		int pixel_x, pixel_y;
+		if ( get_cloud_pixel(gr_obj->latitude, gr_obj->longitude, &pixel_x, &pixel_y) )
+		{
+			pixels.push_back((int64)pixel_x*clouds->get_size() + pixel_y);
+		}
+	}
+	std::sort(pixels.begin(),pixels.end());
+	pixels.erase(std::unique(pixels.begin(),pixels.end()),pixels.end());
+
+	// frame n is the cloud shading at t0 + n minutes, using the wind and sky cover at t0
+	// when a compiled weather file does not have them, since the climate changes them as it runs
+	cloud_start = t0;
+	std::shared_ptr<SolarAngles> angles(new SolarAngles());
+	double wind_speed0 = wind_speed;
+	double wind_dir0 = wind_dir;
+	double opq_sky_cov0 = opq_sky_cov;
+	cloud_ahead = new cloud_frames(pixels, 86400/60, [this,angles,pixels,wind_speed0,wind_dir0,opq_sky_cov0](int64 n, std::vector<double> &values) {
+		TIMESTAMP t = cloud_start + n*60;
+		double ws = wind_speed0, wd = wind_dir0, opq = opq_sky_cov0, zenith;
+		if ( ( gl_globalstoptime != TS_NEVER && t > gl_globalstoptime ) || ! get_cloud_weather(t, angles.get(), &ws, &wd, &opq, &zenith) )
+		{
+			return false;
 		}
-	} else if (edge_to_erase == 'S' ) {
-		for (int i = 0; i < CLOUD_TILE_SIZE - 1; i++ ) { //rows
-			for (int j = 0; j < cloud_pattern_size; j++ ) { //cols
-				cloud_pattern[i][j] = EMPTY_VALUE;
-			}
+		move_cloud_pattern(clouds, ws, wd, zenith, opq, 60);
+		for ( size_t k = 0 ; k < pixels.size() ; k++ )
+		{
+			values[k] = clouds->get_fuzzy(pixels[k]/clouds->get_size(), pixels[k]%clouds->get_size());
 		}
+		return true;
+	});
+}
+
+int climate::finalize(void)
+{
+	// stop computing the clouds ahead
+	if ( cloud_ahead != NULL )
+	{
+		delete cloud_ahead;
+		cloud_ahead = NULL;
+		cloud_frame = NULL;
 	}
-	//write_out_cloud_pattern('C');
+
+	// release the surface geometry cache
+	if ( solar != NULL )
+	{
+		delete solar;
+		solar = NULL;
+	}
+	return 1;
 }
 
 void climate::write_out_pattern_shift(int row_shift, int col_shift ) 
@@ -1923,158 +1676,10 @@ void climate::write_out_pattern_shift(int row_shift, int col_shift )
 void climate::write_out_cloud_pattern( char pattern ) 
 { 
 	//Used only for verification.
-	
-	std::ofstream out_file;
-
 	char buffer [100];
 	snprintf (buffer,sizeof(buffer)-1, "cloud_pattern_%010lld.csv", prev_NTime);
-	std::string file_string = buffer;
-	out_file.open(file_string.c_str(), std::ios::out);
-
-	if (pattern == 'C' ) 
-	{
-		for (size_t i = 0; i < cloud_pattern.size(); i++  ) 
-		{
-				for (size_t j = 0; j < cloud_pattern.size(); j++ ) 
-				{
-					if (j == (cloud_pattern.size()-1) ) 
-					{
-						out_file << cloud_pattern[i][j] << std::endl;
-					} 
-					else 
-					{
-						out_file << cloud_pattern[i][j] << ",";
-					}
-				}
-		}
-		out_file.close();
-	}
-	else if (pattern == 'B')
-	{
-		for (size_t i = 0; i < binary_cloud_pattern.size(); i++ )
-		{
-				for (size_t j = 0; j < binary_cloud_pattern.size(); j++)
-				{
-					if (j == (binary_cloud_pattern.size()-1))
-					{
-						out_file << binary_cloud_pattern[i][j] << std::endl;
-					} 
-					else 
-					{
-					out_file << binary_cloud_pattern[i][j] << ",";
-					}
-				}
-		}
-		out_file.close();
-	}
-	else if (pattern == 'F')
-	{
-		for (int i = 0; i < cloud_pattern_size; i++ )
-		{
-			for (int j = 0; j < cloud_pattern_size; j++)
-			{
-				if (j == (cloud_pattern_size-1))
-				{
-					out_file << fuzzy_cloud_pattern[0][i][j] << std::endl;
-				} 
-				else 
-				{
-					out_file << fuzzy_cloud_pattern[0][i][j] << ",";
-				}
-			}
-	}
-	out_file.close();
+	clouds->write(buffer,pattern);
 }
-}
-void climate::build_cloud_pattern(int col_min, int col_max, int row_min, int row_max ) { //Min/Max row/col must always define a 2^x + 1 region of cloud_pattern
-	int const SIGMA = 5;
-	int step = col_max - col_min;
-	int half_step = step / 2;
-	int max_num_recursions = log((double)(col_max - col_min))/log(2.0); //Change of base since c++ doesn't have a built-in log base 2.
-	int col_start = col_min;
-	int row_start = row_min;
-	float stdev = SIGMA * SIGMA;
-
-	//Seed corner values that are empty
-	if (cloud_pattern[row_start][col_start] < EMPTY_VALUE * 0.98 ) {
-		cloud_pattern[row_start][col_start] = gl_random_normal(RNGSTATE,0,stdev);
-	}
-	if (cloud_pattern[row_start + step][col_start] < EMPTY_VALUE * 0.98 ) {
-		cloud_pattern[row_start + step][col_start] = gl_random_normal(RNGSTATE,0,stdev);
-	}
-	if (cloud_pattern[row_start][col_start + step] < EMPTY_VALUE * 0.98 ) {
-		cloud_pattern[row_start][col_start + step] = gl_random_normal(RNGSTATE,0,stdev);
-	}
-	if (cloud_pattern[row_start + step][col_start + step] < EMPTY_VALUE * 0.98 ) {
-		cloud_pattern[row_start + step][col_start + step] = gl_random_normal(RNGSTATE,0,stdev);
-	}
-
-
-	//Filling in rest of pattern
-	float D = 0;
-	double delta = 0;
-	for (int k = 0; k < max_num_recursions; k++ ) {
-		col_start = col_min;
-		row_start = row_min;
-		if (k <= 3 ) {
-			D = 1.9;
-		} else {
-			D = 1.33;
-		}
-
-		if (k==0 ) {
-			delta = SIGMA * pow(0.5,(0.5 * (2-D)));
-		} else {
-			delta = delta * pow(0.5,(0.5 * (2-D)));
-		}
-
-		stdev = delta*delta;
-		int end = pow(2.0,(double)(k));
-		for (int i = 0; i < end; i++ ) {
-			for (int j = 0; j < end; j++ ) {
-				//	- - -> inc col
-				//
-				//	|	c1		e_b		c2
-				//	|
-				//	v	e_a		x		e_c
-				// inc
-				// row	c3		e_d		c4
-				double c1 = cloud_pattern[row_start][col_start];
-				double c2 = cloud_pattern[row_start][col_start + step];
-				double c3 = cloud_pattern[row_start + step][col_start];
-				double c4 = cloud_pattern[row_start + step][col_start + step];
-				double x = (c1 + c2 + c3 + c4)/4 + gl_random_normal(RNGSTATE,0,stdev);
-				double e_a = (x + c1 + c3)/3 + gl_random_normal(RNGSTATE,0, stdev);
-				double e_b = (x + c1 + c2)/3 + gl_random_normal(RNGSTATE,0, stdev);
-				double e_c = (x + c2 + c4)/3 + gl_random_normal(RNGSTATE,0, stdev);
-				double e_d = (x + c3 + c4)/3 + gl_random_normal(RNGSTATE,0, stdev);
-
-
-				if (cloud_pattern[row_start + half_step][col_start + half_step] < EMPTY_VALUE * 0.98 ) {
-					cloud_pattern[row_start + half_step][col_start + half_step] = x;
-				}
-				if (cloud_pattern[row_start + half_step][col_start] < EMPTY_VALUE * 0.98 ) {
-					cloud_pattern[row_start + half_step][col_start] = e_a;
-				}
-				if (cloud_pattern[row_start][col_start + half_step] < EMPTY_VALUE * 0.98 ) {
-					cloud_pattern[row_start][col_start + half_step] = e_b;
-				}
-				if (cloud_pattern[row_start + half_step][col_start + step] < EMPTY_VALUE * 0.98 ) {
-					cloud_pattern[row_start + half_step][col_start + step] = e_c;
-				}
-				if (cloud_pattern[row_start + step][col_start + half_step] < EMPTY_VALUE * 0.98 ) {
-					cloud_pattern[row_start + step][col_start + half_step] = e_d;
-				}
-				row_start = row_start + step;
-			}
-			row_start = row_min;
-			col_start = col_start + step;
-		}
-		step = half_step;
-		half_step = half_step/2;
-	}
-}
-
 
 int climate::calc_cloud_pattern_size(std::vector< std::vector<double> > &location_list)
 {
@@ -2172,10 +1777,67 @@ void climate::update_forecasts(TIMESTAMP t0)
 }
 
 
+/** Update the weather from the rows of the compiled weather file in effect at t0
+	@return the time of the next row (soft event)
+ **/
+TIMESTAMP climate::presync_binary(TIMESTAMP t0)
+{
+	binary_row = binary->find(t0,binary_row);
+	int64 row = ( binary_row < 0 ? 0 : binary_row );
+	const double *data = binary->get_data(row);
+	if ( interpolate != CI_NONE && binary_row >= 0 && row+1 < binary->get_rows() )
+	{
+		const double *next = binary->get_data(row+1);
+		double f = (double)(t0 - binary->get_time(row)) / (double)(binary->get_time(row+1) - binary->get_time(row));
+		for ( int n = 0 ; n < binary->get_columns() ; n++ )
+		{
+			BINARYCOLUMN &column = binary_columns[n];
+			if ( column.value != NULL )
+			{
+				*column.value = column.offset + column.scale * (data[n] + f*(next[n]-data[n]));
+			}
+		}
+	}
+	else
+	{
+		for ( int n = 0 ; n < binary->get_columns() ; n++ )
+		{
+			BINARYCOLUMN &column = binary_columns[n];
+			if ( column.value != NULL )
+			{
+				*column.value = column.offset + column.scale * data[n];
+			}
+		}
+	}
+	temperature_raw = (temperature-32)/1.8;
+	solar_raw = solar_direct;
+
+	// solar position at the station's standard time
+	short month, day;
+	double hour;
+	weather_binary::standard_time(t0,tz_offset_val,&month,&day,&hour);
+	short doy = sa->day_of_yr(month,day);
+	double sol_time = sa->solar_time(hour,doy,RAD(tz_meridian),RAD(get_longitude()));
+	solar_elevation = sa->altitude(doy,RAD(get_latitude()),sol_time);
+	solar_azimuth = sa->azimuth(doy,RAD(get_latitude()),sol_time);
+	solar_zenith = (90. * PI_OVER_180) - solar_elevation;
+	for ( COMPASS_PTS c_point = CP_H ; c_point < CP_LAST ; c_point = COMPASS_PTS(c_point+1) )
+	{
+		if ( c_point == CP_H )
+			solar_flux[c_point] = file->calc_solar(CP_E,doy,RAD(get_latitude()),sol_time,solar_direct,solar_diffuse,solar_global,ground_reflectivity,0.0);
+		else
+			solar_flux[c_point] = file->calc_solar(c_point,doy,RAD(get_latitude()),sol_time,solar_direct,solar_diffuse,solar_global,ground_reflectivity);
+	}
+	update_heatindex();
+
+	return ( row+1 < binary->get_rows() ? -binary->get_time(row+1) : TS_NEVER );
+}
+
 TIMESTAMP climate::presync(TIMESTAMP t0) /* called in presync */
 {
 	TIMESTAMP csv_rv = 0;
 	TIMESTAMP tmy_rv = 0;
+	TIMESTAMP binary_rv = 0;
 	TIMESTAMP cloud_rv = 0;
 	DATETIME dt;
 
@@ -2203,6 +1865,11 @@ TIMESTAMP climate::presync(TIMESTAMP t0) /* called in presync */
 		}
 	}
 
+	if ( t0 > TS_ZERO && reader_type == RT_BINARY )
+	{
+		binary_rv = presync_binary(t0);
+	}
+
 	if (t0>TS_ZERO && tmy!=NULL)
 	{
 		DATETIME ts;
@@ -2394,7 +2061,18 @@ TIMESTAMP climate::presync(TIMESTAMP t0) /* called in presync */
 			double Pa = cloud_aerosol_transmissivity; // e^-(alpha*M)
 			double PRPA = 1.041-(0.15*sqrt(((p*0.00949)+0.051)/M));
 			global_transmissivity = std::max(0.0,(PRPA-aw)*Pa);
-			update_cloud_pattern(t0 - prev_NTime);
+			if ( cloud_precompute && cloud_ahead == NULL )
+			{
+				start_cloud_precompute(t0);
+			}
+			if ( cloud_ahead != NULL )
+			{
+				cloud_frame = cloud_ahead->get((t0 - cloud_start)/60);
+			}
+			else
+			{
+				update_cloud_pattern(t0 - prev_NTime);
+			}
 			//write_out_cloud_pattern('F');
 			prev_NTime = t0;
 		}
@@ -2408,6 +2086,8 @@ TIMESTAMP climate::presync(TIMESTAMP t0) /* called in presync */
 	else if (cloud_model == CM_NONE)
 		if (reader_type == RT_CSV)
 			return csv_rv;
+		else if (reader_type == RT_BINARY)
+			return binary_rv;
 		else if (tmy!=NULL)
 			return tmy_rv;
 		else
@@ -2418,6 +2098,11 @@ TIMESTAMP climate::presync(TIMESTAMP t0) /* called in presync */
 				return cloud_rv;
 			else
 				return 	csv_rv;
+		else if (reader_type == RT_BINARY)
+			if (binary_rv == TS_NEVER || cloud_rv <= fabs(binary_rv))
+				return cloud_rv;
+			else
+				return binary_rv;
 		else
 			if (cloud_rv <= fabs(tmy_rv))
 				return cloud_rv;
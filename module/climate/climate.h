@@ -13,10 +13,13 @@
 #include <fstream>
 
 #include "gridlabd.h"
+#include "cloud_pattern.h"
 #include "csv_reader.h"
 #include "solar_angles.h"
+#include "solar_cache.h"
 #include "test.h"
 #include "weather.h"
+#include "weather_binary.h"
 #include "weather_reader.h"
 
 extern char climate_library_path[sizeof(char1024)];
@@ -75,9 +78,11 @@ EXPORT int64 calculate_solar_radiation_radians(OBJECT *obj, double tilt, double
 EXPORT int64 calculate_solar_radiation_shading_degrees(OBJECT *obj, double tilt, double orientation, double shading_value, double *value);
 EXPORT int64 calculate_solar_radiation_shading_position_radians(OBJECT *obj, double tilt, double orientation, double latitude, double longitude, double shading_value, double *value);
 EXPORT int64 calculate_solar_radiation_shading_radians(OBJECT *obj, double tilt, double orientation, double shading_value, double *value);
+EXPORT int64 calculate_solar_radiation_batch_radians(OBJECT *obj, int64 count, double *tilt, double *orientation, double *latitude, double *longitude, double *shading_value, double *value);
 EXPORT int64 calc_solar_solpos_shading_deg(OBJECT *obj, double tilt, double orientation, double shading_value, double *value);
 EXPORT int64 calc_solar_solpos_shading_position_rad(OBJECT *obj, double tilt, double orientation, double latitude, double longitude, double shading_value, double *value);
 EXPORT int64 calc_solar_solpos_shading_rad(OBJECT *obj, double tilt, double orientation, double shading_value, double *value);
+EXPORT int64 calc_solar_solpos_batch_rad(OBJECT *obj, int64 count, double *tilt, double *orientation, double *latitude, double *longitude, double *shading_value, double *value);
 EXPORT int64 calc_solar_ideal_shading_position_radians(OBJECT *obj, double tilt, double latitude, double longitude, double shading_value, double *value);
 
 /**
@@ -151,8 +156,16 @@ typedef	enum e_record_type {
 		RT_NONE,
 		RT_TMY2,
 		RT_CSV,
+		RT_BINARY,
 } RECORDTYPE;
 
+/// Climate property set from a column of a compiled weather file
+typedef struct s_binary_column {
+	double *value; ///< property (NULL if the column is not used)
+	double scale; ///< unit conversion factor
+	double offset; ///< unit conversion offset
+} BINARYCOLUMN;
+
 class climate : public gld_object 
 {
 	
@@ -200,14 +213,23 @@ class climate : public gld_object
 	GL_ATOMIC(double,cloud_reflectivity);
 	GL_ATOMIC(double,cloud_speed_factor);
 	GL_ATOMIC(enumeration,cloud_model);
+	GL_ATOMIC(bool,cloud_precompute);
 	GL_ATOMIC(double,heat_index);
 
 	// data not shared with classes in this module (no locks needed)
 private:
 	SolarAngles *sa;
+	solar_cache *solar; ///< surface geometry at the current clock
 	tmy2_reader *file;
 	weather_reader *reader_hndl;
 	TMYDATA *tmy;
+	weather_binary *binary; ///< compiled weather file (shared with other climate objects)
+	BINARYCOLUMN *binary_columns;
+	int64 binary_row; ///< row of the compiled weather file in effect
+	cloud_pattern *clouds; ///< cumulus cloud pattern
+	cloud_frames *cloud_ahead; ///< cloud values computed ahead of the simulation (cloud_precompute only)
+	const std::vector<double> *cloud_frame; ///< cloud values at the current clock (cloud_precompute only)
+	TIMESTAMP cloud_start; ///< time of the first precomputed cloud frame
 public:
 	enumeration reader_type;
 	static CLASS *oclass;
@@ -218,19 +240,20 @@ public:
 	void init_cloud_pattern(void);
 	void update_cloud_pattern(TIMESTAMP dt);
 	int get_solar_for_location(double latitude, double longitude, double *direct, double *global, double *diffuse);
+	int get_solar_poa(SOLARCACHEMODEL model, size_t count, const double *tilt, const double *orientation, const double *latitude, const double *longitude, const double *shading_value, double *value);
 private:
 	int calc_cloud_pattern_size(std::vector<std::vector<double> > &location_list);
-	void build_cloud_pattern(int col_min, int col_max, int row_min, int row_max);
 	void write_out_cloud_pattern(char pattern);
 	void write_out_pattern_shift(int row_shift, int col_shift);
-	void rebuild_cloud_pattern_edge( char edge_needing_rebuilt);
-	void trim_pattern_edge( char rebuilt_edge);
-	void erase_off_screen_pattern( char edge_to_erase);
+	bool get_cloud_pixel(double latitude, double longitude, int *pixel_x, int *pixel_y);
 	int get_fuzzy_cloud_value_for_location(double latitude, double longitude, double *cloud);
 	int get_binary_cloud_value_for_location(double latitude, double longitude, int *cloud);
-	double convert_to_binary_cloud();
-	void convert_to_fuzzy_cloud( double cut_elevation, int num_fuzzy_layers, double alpha);
+	void move_cloud_pattern(cloud_pattern *pattern, double wind_speed, double wind_dir, double solar_zenith, double opq_sky_cov, TIMESTAMP delta_t);
+	void start_cloud_precompute(TIMESTAMP t0);
+	bool get_cloud_weather(TIMESTAMP t, SolarAngles *angles, double *wind_speed, double *wind_dir, double *opq_sky_cov, double *solar_zenith);
 	void update_heatindex(void);
+	int init_binary(const char *filename);
+	TIMESTAMP presync_binary(TIMESTAMP t0);
 private:
 	TIMESTAMP prev_NTime;
 	int MIN_LAT_INDEX;
@@ -248,6 +271,7 @@ public:
 	int init(OBJECT *parent);
 	int isa(CLASSNAME classname);
 	TIMESTAMP presync(TIMESTAMP t0);
+	int finalize(void);
 	inline TIMESTAMP sync(TIMESTAMP t0) { return TS_NEVER; };
 	inline TIMESTAMP postsync(TIMESTAMP t0) { return TS_NEVER; };
 }; ///< climate data 
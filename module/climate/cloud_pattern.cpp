@@ -0,0 +1,811 @@
+/** $Id: cloud_pattern.cpp $
+	Copyright (C) 2008 Battelle Memorial Institute
+	@file cloud_pattern.cpp
+	@addtogroup climate
+	@ingroup modules
+
+ @{
+ **/
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <math.h>
+#include "cloud_pattern.h"
+
+cloud_pattern::cloud_pattern(int n_tiles, unsigned int rng_state)
+{
+	size = n_tiles * CLOUD_TILE_SIZE + 1; //pattern must be 2^x + 1 square
+	on_screen = (n_tiles - 2) * CLOUD_TILE_SIZE; //Off-screen area is one tile width around the perimeter of the on-screen area.
+	size_t n_pixels = (size_t)size*size;
+	elevation = new double[n_pixels];
+	normalized = new double[n_pixels];
+	binary = new int[n_pixels];
+	fuzzy = new double[n_pixels];
+	scratch = new double[n_pixels];
+	std::fill(elevation,elevation+n_pixels,(double)EMPTY_VALUE);
+	std::fill(normalized,normalized+n_pixels,(double)EMPTY_VALUE);
+	std::fill(binary,binary+n_pixels,(int)EMPTY_VALUE);
+	std::fill(fuzzy,fuzzy+n_pixels,0.0);
+	seed = rng_state;
+	generation = 0;
+	batch = gl_threadpool_batch("climate cloud pattern");
+}
+
+cloud_pattern::~cloud_pattern(void)
+{
+	delete [] elevation;
+	delete [] normalized;
+	delete [] binary;
+	delete [] fuzzy;
+	delete [] scratch;
+}
+
+unsigned int cloud_pattern::stream(unsigned int item) const
+{
+	// mix the seed, update, and item so that neighboring tiles get unrelated streams
+	unsigned int x = seed ^ (generation*0x9e3779b9u) ^ (item*0x85ebca6bu);
+	x ^= x >> 16;
+	x *= 0x7feb352du;
+	x ^= x >> 15;
+	x *= 0x846ca68bu;
+	x ^= x >> 16;
+	return x | 1; // the multiplicative generator needs an odd state
+}
+
+double cloud_pattern::unit(unsigned int *state)
+{
+	// same as randunit() with RNG3
+	double u;
+	do {
+		*state = (unsigned int)((44485709377909ULL*(unsigned long long)(*state))&0xffffffffffffULL);
+		u = (((*state)>>16)&0x7fff)/(0x7fff+1.0);
+	} while ( u <= 0 );
+	return u;
+}
+
+double cloud_pattern::normal(unsigned int *state, double m, double s)
+{
+	// same as random_normal()
+	double r = unit(state);
+	return sqrt(-2*log(r)) * sin(2*PI*unit(state))*s+m;
+}
+
+/// Items of a parallel pass shared by the thread pool tasks
+struct CLOUDWORK {
+	const std::function<void(int)> *task;
+	int n_items;
+	std::atomic<int> next;
+};
+
+/* thread pool task that runs items until there are none left */
+static void cloud_task(void *data, unsigned int n)
+{
+	CLOUDWORK *work = (CLOUDWORK*)data;
+	for ( int item = work->next++ ; item < work->n_items ; item = work->next++ )
+	{
+		(*work->task)(item);
+	}
+}
+
+void cloud_pattern::parallel(int n_items, const std::function<void(int)> &task)
+{
+	unsigned int n_tasks = gl_threadpool_size();
+	if ( (int)n_tasks > n_items )
+	{
+		n_tasks = (unsigned int)n_items;
+	}
+	if ( n_tasks <= 1 )
+	{
+		for ( int item = 0 ; item < n_items ; item++ )
+		{
+			task(item);
+		}
+		return;
+	}
+	CLOUDWORK work;
+	work.task = &task;
+	work.n_items = n_items;
+	work.next = 0;
+	gl_threadpool_run(batch, cloud_task, &work, n_tasks);
+}
+
+void cloud_pattern::parallel_rows(int row_min, int row_max, const std::function<void(int,int,int)> &task)
+{
+	int n_bands = (row_max - row_min + CLOUD_TILE_SIZE - 1) / CLOUD_TILE_SIZE;
+	parallel(n_bands, [&](int band) {
+		int begin = row_min + band*CLOUD_TILE_SIZE;
+		task(band, begin, std::min(begin+CLOUD_TILE_SIZE,row_max));
+	});
+}
+
+void cloud_pattern::build(void)
+{
+	// neighboring tiles share an edge, so the tiles are built in four passes in which none are neighbors
+	int n_tiles = (size - 1) / CLOUD_TILE_SIZE;
+	for ( int pass = 0 ; pass < 4 ; pass++ )
+	{
+		int i0 = pass / 2;
+		int j0 = pass % 2;
+		int n_j = (n_tiles - j0 + 1) / 2;
+		parallel(((n_tiles - i0 + 1) / 2) * n_j, [&](int item) {
+			int i = i0 + 2*(item/n_j);
+			int j = j0 + 2*(item%n_j);
+			unsigned int state = stream(i*n_tiles + j);
+			//Building pattern as a series of tiles
+			build_tile(i*CLOUD_TILE_SIZE, (i+1)*CLOUD_TILE_SIZE, j*CLOUD_TILE_SIZE, (j+1)*CLOUD_TILE_SIZE, &state); //Min/Max x/y must always define a 2^x + 1 region of cloud_pattern
+		});
+	}
+	generation++;
+}
+
+void cloud_pattern::move(int row_shift, int col_shift)
+{
+	if ( row_shift == 0 && col_shift == 0 )
+	{
+		return;
+	}
+
+	//Checking to see if barely off-screen values are empty before shifting the pattern.
+	// If check is not done, may result in EMPTY_VALUES getting shifted on_screen.
+	int first = CLOUD_TILE_SIZE;
+	int last = CLOUD_TILE_SIZE + on_screen;
+	if ( col_shift != 0 )
+	{
+		int col = ( col_shift > 0 ? first - col_shift : last - col_shift );
+		for ( int row = first ; row < last ; row++ )
+		{
+			if ( at(row,col) == EMPTY_VALUE )
+			{
+				rebuild_edge(col_shift > 0 ? 'W' : 'E');
+				break;
+			}
+		}
+	}
+	if ( row_shift != 0 )
+	{
+		int row = ( row_shift > 0 ? first - row_shift : last - row_shift );
+		for ( int col = first ; col < last ; col++ )
+		{
+			if ( at(row,col) == EMPTY_VALUE )
+			{
+				rebuild_edge(row_shift > 0 ? 'S' : 'N');
+				break;
+			}
+		}
+	}
+
+	//Shifting pattern (after any edges have been rebuilt).
+	shift(row_shift, col_shift);
+}
+
+void cloud_pattern::shift(int row_shift, int col_shift)
+{
+	// pixels that move in from outside the pattern are empty
+	int col_min = std::max(0,col_shift);
+	int col_max = std::min(size,size+col_shift);
+	parallel_rows(0, size, [&](int band, int begin, int end) {
+		for ( int row = begin ; row < end ; row++ )
+		{
+			double *to = scratch + (size_t)row*size;
+			int from = row - row_shift;
+			if ( from < 0 || from >= size || col_min >= col_max )
+			{
+				std::fill(to,to+size,(double)EMPTY_VALUE);
+				continue;
+			}
+			std::fill(to,to+col_min,(double)EMPTY_VALUE);
+			memcpy(to+col_min,elevation+(size_t)from*size+col_min-col_shift,sizeof(double)*(col_max-col_min));
+			std::fill(to+col_max,to+size,(double)EMPTY_VALUE);
+		}
+	});
+	std::swap(elevation,scratch);
+}
+
+void cloud_pattern::rebuild_edge(char edge)
+{
+	erase_edge(edge);
+
+	// tiles along the edge share an edge with the next one, so alternate tiles are built together
+	int n_tiles = (size - 1) / CLOUD_TILE_SIZE; // 1 + on_screen/CLOUD_TILE_SIZE + 1
+	int col_min = ( edge == 'E' ? CLOUD_TILE_SIZE + on_screen - 1 : 0 );
+	int row_min = ( edge == 'N' ? CLOUD_TILE_SIZE + on_screen - 1 : 0 );
+	bool vertical = ( edge == 'W' || edge == 'E' );
+	for ( int pass = 0 ; pass < 2 ; pass++ )
+	{
+		parallel((n_tiles - pass + 1) / 2, [&](int item) {
+			int i = pass + 2*item;
+			unsigned int state = stream(i);
+			int col = ( vertical ? col_min : i*CLOUD_TILE_SIZE );
+			int row = ( vertical ? i*CLOUD_TILE_SIZE : row_min );
+			build_tile(col, col + CLOUD_TILE_SIZE, row, row + CLOUD_TILE_SIZE, &state); //Min/Max row/col must always define a 2^x + 1 region of cloud_pattern
+		});
+	}
+	generation++;
+
+	trim_edge(edge);
+}
+
+void cloud_pattern::erase_edge(char edge)
+{
+	int row_min = ( edge == 'N' ? size - CLOUD_TILE_SIZE + 1 : 0 );
+	int row_max = ( edge == 'S' ? CLOUD_TILE_SIZE - 1 : size );
+	int col_min = ( edge == 'E' ? size - CLOUD_TILE_SIZE + 1 : 0 );
+	int col_max = ( edge == 'W' ? CLOUD_TILE_SIZE - 1 : size );
+	parallel_rows(row_min, row_max, [&](int band, int begin, int end) {
+		for ( int row = begin ; row < end ; row++ )
+		{
+			std::fill(&at(row,0)+col_min,&at(row,0)+col_max,(double)EMPTY_VALUE);
+		}
+	});
+}
+
+void cloud_pattern::trim_edge(char edge)
+{
+	int min_edge = 0;
+	int min_edge_1 = 0;
+	int min_edge_2 = min_edge_1;
+	int min_edge_3 = min_edge_1;
+	int max_edge = 0;
+	int max_edge_1 = CLOUD_TILE_SIZE + on_screen + CLOUD_TILE_SIZE;
+	int max_edge_2 = max_edge_1;
+	int max_edge_3 = max_edge_1;
+	int i = 0;
+	int j = 0;
+	if ( edge == 'W' || edge == 'E' )
+	{
+		//Checking for boundary at southern edge of pattern.
+		//Check three regions in areas south of on-screen: W, center, and E
+		for ( i = 0 ; i < CLOUD_TILE_SIZE ; i++ )
+		{
+			if ( at(i,10) != EMPTY_VALUE )
+			{
+				min_edge_1 = i;
+				break;
+			}
+		}
+		for ( i = 0 ; i < CLOUD_TILE_SIZE ; i++ )
+		{
+			if ( at(i,CLOUD_TILE_SIZE + 10) != EMPTY_VALUE )
+			{
+				min_edge_2 = i;
+				break;
+			}
+		}
+		for ( i = 0 ; i < CLOUD_TILE_SIZE ; i++ )
+		{
+			if ( at(i,CLOUD_TILE_SIZE + on_screen + 10) != EMPTY_VALUE )
+			{
+				min_edge_3 = i;
+				break;
+			}
+		}
+		min_edge = std::max(min_edge_1,min_edge_2);
+		min_edge = std::max(min_edge,min_edge_3);
+
+		//Checking for boundary at northern edge of pattern
+		for ( i = CLOUD_TILE_SIZE + on_screen ; i < size ; i++ )
+		{
+			if ( at(i,10) == EMPTY_VALUE )
+			{
+				max_edge_1 = i;
+				break;
+			}
+		}
+		for ( i = CLOUD_TILE_SIZE + on_screen ; i < size ; i++ )
+		{
+			if ( at(i,CLOUD_TILE_SIZE + 10) == EMPTY_VALUE )
+			{
+				max_edge_2 = i;
+				break;
+			}
+		}
+		for ( i = CLOUD_TILE_SIZE + on_screen ; i < size ; i++ )
+		{
+			if ( at(i,CLOUD_TILE_SIZE + on_screen + 10) == EMPTY_VALUE )
+			{
+				max_edge_3 = i;
+				break;
+			}
+		}
+		max_edge = std::min(max_edge_1,max_edge_2);
+		max_edge = std::min(max_edge,max_edge_3);
+
+		//Trimming pattern
+		parallel_rows(0, size, [&](int band, int begin, int end) {
+			for ( int row = begin ; row < end ; row++ )
+			{
+				if ( row < min_edge || row >= max_edge )
+				{
+					std::fill(&at(row,0),&at(row,0)+size,(double)EMPTY_VALUE);
+				}
+			}
+		});
+	}
+	else if ( edge == 'N' || edge == 'S' )
+	{
+		//Checking for boundary at western edge of pattern.
+		//Check three regions in areas south of on-screen: S, center, and N
+		for ( j = 0 ; j < CLOUD_TILE_SIZE ; j++ )
+		{
+			if ( at(10,j) != EMPTY_VALUE )
+			{
+				min_edge_1 = j;
+				break;
+			}
+		}
+		for ( j = 0 ; j < CLOUD_TILE_SIZE ; j++ )
+		{
+			if ( at(CLOUD_TILE_SIZE + 10,j) != EMPTY_VALUE )
+			{
+				min_edge_2 = j;
+				break;
+			}
+		}
+		for ( j = 0 ; j < CLOUD_TILE_SIZE ; j++ )
+		{
+			if ( at(CLOUD_TILE_SIZE + on_screen + 10,j) != EMPTY_VALUE )
+			{
+				min_edge_3 = j;
+				break;
+			}
+		}
+		min_edge = std::max(min_edge_1,min_edge_2);
+		min_edge = std::max(min_edge,min_edge_3);
+
+		//Checking for boundary at eastern edge of pattern
+		for ( j = CLOUD_TILE_SIZE + on_screen ; j < size ; j++ )
+		{
+			if ( at(10,j) == EMPTY_VALUE )
+			{
+				max_edge_1 = j;
+				break;
+			}
+		}
+		for ( j = CLOUD_TILE_SIZE + on_screen ; j < size ; j++ )
+		{
+			if ( at(CLOUD_TILE_SIZE + 10,j) == EMPTY_VALUE )
+			{
+				max_edge_2 = j;
+				break;
+			}
+		}
+		for ( j = CLOUD_TILE_SIZE + on_screen ; j < size ; j++ )
+		{
+			if ( at(CLOUD_TILE_SIZE + on_screen + 10,j) == EMPTY_VALUE )
+			{
+				max_edge_3 = j;
+				break;
+			}
+		}
+		max_edge = std::min(max_edge_1,max_edge_2);
+		max_edge = std::min(max_edge,max_edge_3);
+
+		//Trimming pattern
+		parallel_rows(0, size, [&](int band, int begin, int end) {
+			for ( int row = begin ; row < end ; row++ )
+			{
+				double *pixel = &at(row,0);
+				std::fill(pixel,pixel+std::min(min_edge,size),(double)EMPTY_VALUE);
+				if ( max_edge < size )
+				{
+					std::fill(pixel+max_edge,pixel+size,(double)EMPTY_VALUE);
+				}
+			}
+		});
+	}
+}
+
+double cloud_pattern::convert_to_binary(double opq_sky_cov)
+{
+	//Convert fractal cloud pattern to binary value based on TMY2 opaque sky value.
+	double cloud_value = opq_sky_cov;
+
+	/* TDH:
+	 * Trying to counteract the fuzzification process by artificially boosting the coverage.
+	 * This is a bit of a hack. The best way to handle this is to include the fuzzification process
+	 * in the elevation cut adjustment. This way, the percentage of the sky covered by opaque clouds
+	 * is ensured after the fuzzification has taken place. I've tested this and it REALLY slows things
+	 * down (in an already slow function). For now, this is what I've chosen to do because it more
+	 * or less works.
+	*/
+	cloud_value = cloud_value * 2.0;
+	if ( cloud_value >= 1 )
+	{
+		cloud_value = 0.99;
+	}
+	double search_tolerance = 0.005; //Defines how close is close enough when dialing in the binary cloud pattern.
+
+	//Finding max and min value
+	int n_bands = (size + CLOUD_TILE_SIZE - 1) / CLOUD_TILE_SIZE;
+	std::vector<double> band_max(n_bands,at(CLOUD_TILE_SIZE,CLOUD_TILE_SIZE));
+	std::vector<double> band_min(n_bands,at(CLOUD_TILE_SIZE,CLOUD_TILE_SIZE));
+	parallel_rows(0, size, [&](int band, int begin, int end) {
+		for ( size_t k = (size_t)begin*size ; k < (size_t)end*size ; k++ )
+		{
+			if ( elevation[k] != EMPTY_VALUE )
+			{
+				band_max[band] = std::max(band_max[band],elevation[k]);
+				band_min[band] = std::min(band_min[band],elevation[k]);
+			}
+		}
+	});
+	double cloud_pattern_max = *std::max_element(band_max.begin(),band_max.end());
+	double cloud_pattern_min = *std::min_element(band_min.begin(),band_min.end());
+
+	double cloud_pattern_range = cloud_pattern_max - cloud_pattern_min;
+	double cut_elevation = cloud_pattern_min;
+	double measured_coverage = 0;
+	double step_size = 0;
+	double max_cut_elevation = cloud_pattern_max;
+	double min_cut_elevation = cloud_pattern_min;
+
+	//Creating normalized cloud pattern
+	parallel_rows(0, size, [&](int band, int begin, int end) {
+		for ( size_t k = (size_t)begin*size ; k < (size_t)end*size ; k++ )
+		{
+			if ( elevation[k] != EMPTY_VALUE )
+			{
+				normalized[k] = (elevation[k] - cloud_pattern_min)/cloud_pattern_range;
+			}
+		}
+	});
+
+	std::vector<int64> band_count(n_bands);
+	do
+	{
+		cut_elevation += step_size;
+		parallel_rows(CLOUD_TILE_SIZE, CLOUD_TILE_SIZE + on_screen, [&](int band, int begin, int end) {
+			int64 count = 0;
+			for ( int i = begin ; i < end ; i++ )
+			{
+				const double *pixel = normalized + (size_t)i*size;
+				for ( int j = CLOUD_TILE_SIZE ; j < CLOUD_TILE_SIZE + on_screen ; j++ )
+				{
+					if ( pixel[j] != EMPTY_VALUE && pixel[j] <= cut_elevation ) //Values less than cut elevation are clouds
+					{
+						count++;
+					}
+				}
+			}
+			band_count[band] = count;
+		});
+		int64 running_count = 0;
+		for ( int band = 0 ; band < on_screen/CLOUD_TILE_SIZE ; band++ )
+		{
+			running_count += band_count[band];
+		}
+		measured_coverage = double(running_count)/((double)on_screen * on_screen); //Factor, range [0 1]
+
+		//Calculating next cut elevation.
+		if ( measured_coverage > (cloud_value + search_tolerance) )
+		{
+			max_cut_elevation = cut_elevation;
+			step_size = (max_cut_elevation - min_cut_elevation)/-2;
+		}
+		else if ( measured_coverage < (cloud_value - search_tolerance) )
+		{
+			min_cut_elevation = cut_elevation;
+			step_size = (max_cut_elevation - min_cut_elevation)/2;
+		}
+	} while ( measured_coverage < (cloud_value - search_tolerance) || measured_coverage > (cloud_value + search_tolerance) );
+
+	//Converting cloud_pattern to binary_cloud_pattern
+	parallel_rows(0, size, [&](int band, int begin, int end) {
+		for ( size_t k = (size_t)begin*size ; k < (size_t)end*size ; k++ )
+		{
+			if ( normalized[k] == EMPTY_VALUE )
+			{
+				binary[k] = EMPTY_VALUE;
+			}
+			else if ( normalized[k] <= cut_elevation )
+			{
+				binary[k] = 0; //Cloud
+			}
+			else if ( normalized[k] > cut_elevation )
+			{
+				binary[k] = 1; //Blue sky
+			}
+		}
+	});
+	return cut_elevation;
+}
+
+void cloud_pattern::convert_to_fuzzy(double cut_elevation, int num_fuzzy_layers, double alpha)
+{
+	double shade_step_size = 1.0/alpha;
+
+	if ( cut_elevation == EMPTY_VALUE ) //Initialization call uses EMPTY_VALUE as the cut elevation.
+	{
+		std::fill(fuzzy,fuzzy+(size_t)size*size,0.0);
+	}
+
+	//Filling in fuzzy pattern with random values
+	parallel_rows(0, size, [&](int band, int begin, int end) {
+		unsigned int state = stream(band);
+		for ( size_t k = (size_t)begin*size ; k < (size_t)end*size ; k++ )
+		{
+			if ( num_fuzzy_layers < 1 )
+			{
+				break;
+			}
+			if ( binary[k] != 0 || normalized[k] == EMPTY_VALUE )
+			{
+				//EMPTY_VALUES get coerced into 0.
+				fuzzy[k] = 0;
+				continue;
+			}
+			//Areas with 0 in the binary pattern are cloudy
+			double value = fuzzy[k];
+			int i = 0;
+			if ( value == EMPTY_VALUE )
+			{
+				value = 0;
+				i = 1;
+			}
+			//only values below the cut elevation accumulate, and fewer do in each layer
+			for ( ; i < num_fuzzy_layers && normalized[k] <= cut_elevation - ((i+1)*shade_step_size) ; i++ )
+			{
+				double rand_upper = ((double)(i+1)/(double)num_fuzzy_layers)*cut_elevation;
+				double rand_lower = (((double)(i+1)-1)/(double)num_fuzzy_layers)*cut_elevation;
+				value = uniform(&state,rand_lower,rand_upper) + value;
+			}
+			fuzzy[k] = value;
+		}
+	});
+	generation++;
+
+	//Normalizing fuzzy pattern
+	int n_bands = (size + CLOUD_TILE_SIZE - 1) / CLOUD_TILE_SIZE;
+	std::vector<double> band_max(n_bands,fuzzy[0]);
+	std::vector<double> band_min(n_bands,fuzzy[0]);
+	parallel_rows(0, size, [&](int band, int begin, int end) {
+		for ( size_t k = (size_t)begin*size ; k < (size_t)end*size ; k++ )
+		{
+			band_max[band] = std::max(band_max[band],fuzzy[k]);
+			band_min[band] = std::min(band_min[band],fuzzy[k]);
+		}
+	});
+	double max_value = *std::max_element(band_max.begin(),band_max.end());
+	double min_value = *std::min_element(band_min.begin(),band_min.end());
+	double range = max_value - min_value;
+
+	//Put EMPTY_VALUEs back in before calling it good.
+	parallel_rows(0, size, [&](int band, int begin, int end) {
+		for ( size_t k = (size_t)begin*size ; k < (size_t)end*size ; k++ )
+		{
+			if ( elevation[k] == EMPTY_VALUE )
+			{
+				fuzzy[k] = EMPTY_VALUE;
+			}
+			else if ( range != 0 )
+			{
+				fuzzy[k] = (fuzzy[k] - min_value)/range;
+			}
+		}
+	});
+}
+
+void cloud_pattern::build_tile(int col_min, int col_max, int row_min, int row_max, unsigned int *state) //Min/Max row/col must always define a 2^x + 1 region of cloud_pattern
+{
+	int const SIGMA = 5;
+	int step = col_max - col_min;
+	int half_step = step / 2;
+	int max_num_recursions = log((double)(col_max - col_min))/log(2.0); //Change of base since c++ doesn't have a built-in log base 2.
+	int col_start = col_min;
+	int row_start = row_min;
+	float stdev = SIGMA * SIGMA;
+
+	//Seed corner values that are empty
+	if ( at(row_start,col_start) < EMPTY_VALUE * 0.98 )
+	{
+		at(row_start,col_start) = normal(state,0,stdev);
+	}
+	if ( at(row_start + step,col_start) < EMPTY_VALUE * 0.98 )
+	{
+		at(row_start + step,col_start) = normal(state,0,stdev);
+	}
+	if ( at(row_start,col_start + step) < EMPTY_VALUE * 0.98 )
+	{
+		at(row_start,col_start + step) = normal(state,0,stdev);
+	}
+	if ( at(row_start + step,col_start + step) < EMPTY_VALUE * 0.98 )
+	{
+		at(row_start + step,col_start + step) = normal(state,0,stdev);
+	}
+
+	//Filling in rest of pattern
+	float D = 0;
+	double delta = 0;
+	for ( int k = 0 ; k < max_num_recursions ; k++ )
+	{
+		col_start = col_min;
+		row_start = row_min;
+		if ( k <= 3 )
+		{
+			D = 1.9;
+		}
+		else
+		{
+			D = 1.33;
+		}
+
+		if ( k == 0 )
+		{
+			delta = SIGMA * pow(0.5,(0.5 * (2-D)));
+		}
+		else
+		{
+			delta = delta * pow(0.5,(0.5 * (2-D)));
+		}
+
+		stdev = delta*delta;
+		int end = pow(2.0,(double)(k));
+		for ( int i = 0 ; i < end ; i++ )
+		{
+			for ( int j = 0 ; j < end ; j++ )
+			{
+				//	- - -> inc col
+				//
+				//	|	c1		e_b		c2
+				//	|
+				//	v	e_a		x		e_c
+				// inc
+				// row	c3		e_d		c4
+				double c1 = at(row_start,col_start);
+				double c2 = at(row_start,col_start + step);
+				double c3 = at(row_start + step,col_start);
+				double c4 = at(row_start + step,col_start + step);
+				double x = (c1 + c2 + c3 + c4)/4 + normal(state,0,stdev);
+				double e_a = (x + c1 + c3)/3 + normal(state,0,stdev);
+				double e_b = (x + c1 + c2)/3 + normal(state,0,stdev);
+				double e_c = (x + c2 + c4)/3 + normal(state,0,stdev);
+				double e_d = (x + c3 + c4)/3 + normal(state,0,stdev);
+
+				if ( at(row_start + half_step,col_start + half_step) < EMPTY_VALUE * 0.98 )
+				{
+					at(row_start + half_step,col_start + half_step) = x;
+				}
+				if ( at(row_start + half_step,col_start) < EMPTY_VALUE * 0.98 )
+				{
+					at(row_start + half_step,col_start) = e_a;
+				}
+				if ( at(row_start,col_start + half_step) < EMPTY_VALUE * 0.98 )
+				{
+					at(row_start,col_start + half_step) = e_b;
+				}
+				if ( at(row_start + half_step,col_start + step) < EMPTY_VALUE * 0.98 )
+				{
+					at(row_start + half_step,col_start + step) = e_c;
+				}
+				if ( at(row_start + step,col_start + half_step) < EMPTY_VALUE * 0.98 )
+				{
+					at(row_start + step,col_start + half_step) = e_d;
+				}
+				row_start = row_start + step;
+			}
+			row_start = row_min;
+			col_start = col_start + step;
+		}
+		step = half_step;
+		half_step = half_step/2;
+	}
+}
+
+void cloud_pattern::write(const char *filename, char pattern)
+{
+	//Used only for verification.
+	std::ofstream out_file;
+	out_file.open(filename, std::ios::out);
+	for ( int i = 0 ; i < size ; i++ )
+	{
+		for ( int j = 0 ; j < size ; j++ )
+		{
+			size_t k = (size_t)i*size+j;
+			if ( pattern == 'C' )
+			{
+				out_file << elevation[k];
+			}
+			else if ( pattern == 'B' )
+			{
+				out_file << binary[k];
+			}
+			else
+			{
+				out_file << fuzzy[k];
+			}
+			out_file << ( j == size-1 ? "\n" : "," );
+		}
+	}
+	out_file.close();
+}
+
+cloud_frames::cloud_frames(const std::vector<int64> &list, int64 n, PRODUCER produce)
+{
+	pixels = list;
+	std::sort(pixels.begin(),pixels.end());
+	pixels.erase(std::unique(pixels.begin(),pixels.end()),pixels.end());
+	first = 0;
+	wanted = 0;
+	lead = n;
+	stop = false;
+	done = false;
+	worker = new std::thread(&cloud_frames::run,this,produce);
+}
+
+cloud_frames::~cloud_frames(void)
+{
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		stop = true;
+	}
+	changed.notify_all();
+	worker->join();
+	delete worker;
+}
+
+void cloud_frames::run(PRODUCER produce)
+{
+	for ( int64 n = 0 ; ; n++ )
+	{
+		{
+			std::unique_lock<std::mutex> guard(lock);
+			while ( ! stop && n >= wanted + lead )
+			{
+				changed.wait(guard);
+			}
+			if ( stop )
+			{
+				break;
+			}
+		}
+		std::vector<double> values(pixels.size());
+		if ( ! produce(n,values) )
+		{
+			break;
+		}
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			frames.push_back(values);
+		}
+		changed.notify_all();
+	}
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		done = true;
+	}
+	changed.notify_all();
+}
+
+int cloud_frames::find(int64 pixel) const
+{
+	std::vector<int64>::const_iterator item = std::lower_bound(pixels.begin(),pixels.end(),pixel);
+	return ( item != pixels.end() && *item == pixel ) ? (int)(item - pixels.begin()) : -1;
+}
+
+const std::vector<double> *cloud_frames::get(int64 n)
+{
+	std::unique_lock<std::mutex> guard(lock);
+	if ( n > wanted )
+	{
+		wanted = n;
+		changed.notify_all();
+	}
+	while ( n > first && frames.size() > 1 )
+	{
+		frames.pop_front();
+		first++;
+	}
+	while ( ! done && n >= first + (int64)frames.size() )
+	{
+		changed.wait(guard);
+	}
+	if ( frames.empty() )
+	{
+		return NULL;
+	}
+	int64 k = std::max((int64)0,std::min(n - first,(int64)frames.size()-1));
+	return &frames[k];
+}
+
+/**@}*/
@@ -0,0 +1,134 @@
+/** $Id: cloud_pattern.h $
+	Copyright (C) 2008 Battelle Memorial Institute
+	@file cloud_pattern.h
+	@addtogroup climate
+	@ingroup modules
+
+	Cumulus cloud pattern
+
+	The cumulus cloud model moves a fractal cloud pattern over the area
+	covered by the solar objects with the wind.  The pattern is a square of
+	tiles of CLOUD_TILE_SIZE pixels, with one tile of off-screen pattern
+	around the on-screen area, stored as flat row-major arrays.  The work
+	is divided among the core thread pool's workers by tile: tiles are built in an order in which
+	neighboring tiles, which share an edge, are never built at the same
+	time, and the conversions to binary and fuzzy patterns work on bands
+	one tile high.  Each tile or band draws its random numbers from its own
+	stream, seeded from the climate object's random state, the tile, and
+	the number of updates, so the pattern does not depend on the number of
+	threads.  The streams use the core's RNG3 generator, inlined because a
+	single update draws hundreds of millions of numbers.
+
+	The cloud_frames class runs the cloud model ahead of the simulation in
+	a background thread and keeps the cloud values at the pixels of the
+	solar objects for each minute.
+
+ @{
+ **/
+
+#ifndef _CLOUD_PATTERN_H
+#define _CLOUD_PATTERN_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "gridlabd.h"
+
+//Cloud pattern constants
+//The off-screen pattern size is affected by the following two constants.
+// These have been set under the assumption of a max wind speed (after altitude adjustment to 1000m)
+// of 80 m/s.  At 256 pixles/tile * 20m/pixle  the off-screen pattern size is sufficient to ensure
+// that  no undefined areas of the pattern make it on-screen in the 60 s update period.
+// Adjusting either of these breaks that assumption and may force other change to be made, such
+// as reducing the time between cloud pattern updates.
+
+//EDITME
+const int CLOUD_TILE_SIZE = 512;
+const int PIXEL_EDGE_SIZE = 20; //Pixel size example: 10m per edge, 100 m^2 area.
+const double KM_PER_DEG = 111.32;
+const long EMPTY_VALUE = -999;
+
+class cloud_pattern {
+private:
+	int size; ///< pixels along each edge of the pattern (2^x + 1)
+	int on_screen; ///< pixels along each edge of the on-screen area
+	double *elevation; ///< fractal cloud pattern
+	double *normalized; ///< fractal cloud pattern scaled to [0,1]
+	int *binary; ///< 0 for cloud, 1 for blue sky
+	double *fuzzy; ///< cloud shading in [0,1]
+	double *scratch; ///< buffer used to shift the pattern
+	unsigned int seed; ///< random state of the climate object
+	unsigned int generation; ///< number of updates that used random streams
+	TPBATCH *batch; ///< thread pool batch that runs the parallel passes
+private:
+	inline double &at(int row, int col) { return elevation[(size_t)row*size+col]; };
+	unsigned int stream(unsigned int item) const;
+	static double unit(unsigned int *state);
+	static inline double uniform(unsigned int *state, double a, double b) { return unit(state)*(b-a)+a; };
+	static double normal(unsigned int *state, double m, double s);
+	void parallel(int n_items, const std::function<void(int)> &task);
+	void parallel_rows(int row_min, int row_max, const std::function<void(int,int,int)> &task);
+	void build_tile(int col_min, int col_max, int row_min, int row_max, unsigned int *state);
+	void erase_edge(char edge);
+	void trim_edge(char edge);
+	void rebuild_edge(char edge);
+	void shift(int row_shift, int col_shift);
+public:
+	/** Create an empty pattern of n_tiles by n_tiles tiles (including the off-screen tiles) **/
+	cloud_pattern(int n_tiles, unsigned int seed);
+	~cloud_pattern(void);
+	inline int get_size(void) const { return size; };
+	inline int get_binary(int row, int col) const { return binary[(size_t)row*size+col]; };
+	inline double get_fuzzy(int row, int col) const { return fuzzy[(size_t)row*size+col]; };
+	/** Build all the tiles of the pattern **/
+	void build(void);
+	/** Move the pattern, rebuilding the off-screen edge first if empty pixels would move on-screen **/
+	void move(int row_shift, int col_shift);
+	/** Convert the fractal pattern to a binary pattern with the sky coverage given
+		@return the cut elevation
+	 **/
+	double convert_to_binary(double opq_sky_cov);
+	/** Convert the binary pattern to a fuzzy pattern (EMPTY_VALUE as the cut elevation initializes it) **/
+	void convert_to_fuzzy(double cut_elevation, int num_fuzzy_layers, double alpha);
+	/** Write the fractal ('C'), binary ('B') or fuzzy ('F') pattern to a CSV file (used only for verification) **/
+	void write(const char *filename, char pattern);
+};
+
+/// Cloud values at fixed pixels computed ahead of the simulation
+class cloud_frames {
+public:
+	/** Compute frame number n, returning false after the last frame **/
+	typedef std::function<bool(int64 n, std::vector<double> &values)> PRODUCER;
+private:
+	std::mutex lock;
+	std::condition_variable changed;
+	std::deque< std::vector<double> > frames;
+	std::vector<int64> pixels; ///< sorted pixel numbers whose values are kept
+	int64 first; ///< number of the first frame kept
+	int64 wanted; ///< number of the frame last requested
+	int64 lead; ///< number of frames computed ahead of the frame requested
+	bool stop;
+	bool done;
+	std::thread *worker;
+private:
+	void run(PRODUCER produce);
+public:
+	cloud_frames(const std::vector<int64> &pixels, int64 lead, PRODUCER produce);
+	~cloud_frames(void);
+	inline const std::vector<int64> &get_pixels(void) const { return pixels; };
+	/** Find the position of a pixel in each frame
+		@return -1 if the pixel is not kept
+	 **/
+	int find(int64 pixel) const;
+	/** Get a frame, waiting for it if it is not ready, and release the frames before it
+		@return the last frame computed if n is after the last frame, or NULL if there is none
+	 **/
+	const std::vector<double> *get(int64 n);
+};
+
+#endif
+
+/**@}*/
@@ -0,0 +1,72 @@
+/** $Id: solar_cache.cpp $
+	Copyright (C) 2008 Battelle Memorial Institute
+	@file solar_cache.cpp
+	@addtogroup climate
+	@ingroup modules
+
+ @{
+ **/
+
+#include "solar_cache.h"
+
+bool solar_cache::key_order::operator()(const SOLARCACHEKEY &a, const SOLARCACHEKEY &b) const
+{
+	if ( a.model != b.model ) return a.model < b.model;
+	if ( a.tilt != b.tilt ) return a.tilt < b.tilt;
+	if ( a.orientation != b.orientation ) return a.orientation < b.orientation;
+	if ( a.direct != b.direct ) return a.direct < b.direct;
+	return a.diffuse < b.diffuse;
+}
+
+solar_cache::solar_cache(void)
+{
+	valid = false;
+}
+
+bool solar_cache::is_current(const SOLARCACHEEPOCH &now) const
+{
+	return valid
+		&& epoch.clock == now.clock
+		&& epoch.temperature == now.temperature
+		&& epoch.pressure == now.pressure
+		&& epoch.solcon == now.solcon
+		&& epoch.tz_offset == now.tz_offset
+		&& epoch.tz_meridian == now.tz_meridian;
+}
+
+size_t solar_cache::find(const SOLARCACHEEPOCH &now, size_t count, const SOLARCACHEKEY *key, SOLARCACHEVALUE *value, size_t *missing)
+{
+	size_t n_missing = 0;
+	std::shared_lock<std::shared_mutex> reader(lock);
+	bool current = is_current(now);
+	for ( size_t n = 0 ; n < count ; n++ )
+	{
+		std::map<SOLARCACHEKEY,SOLARCACHEVALUE,key_order>::const_iterator item;
+		if ( current && (item=surfaces.find(key[n])) != surfaces.end() )
+		{
+			value[n] = item->second;
+		}
+		else
+		{
+			missing[n_missing++] = n;
+		}
+	}
+	return n_missing;
+}
+
+void solar_cache::add(const SOLARCACHEEPOCH &now, size_t count, const size_t *missing, const SOLARCACHEKEY *key, const SOLARCACHEVALUE *value)
+{
+	std::unique_lock<std::shared_mutex> writer(lock);
+	if ( ! is_current(now) )
+	{
+		surfaces.clear();
+		epoch = now;
+		valid = true;
+	}
+	for ( size_t n = 0 ; n < count ; n++ )
+	{
+		surfaces[key[missing[n]]] = value[missing[n]];
+	}
+}
+
+/**@}*/
@@ -0,0 +1,87 @@
+/** $Id: solar_cache.h $
+	Copyright (C) 2008 Battelle Memorial Institute
+	@file solar_cache.h
+	@addtogroup climate
+	@ingroup modules
+
+	Solar geometry cache
+
+	Every solar object that uses a climate asks it for the plane-of-array
+	irradiance of its panel each time it syncs, and each request used to
+	recompute the solar time, declination and angle of incidence for the
+	same timestamp.  The cache keeps the results that depend only on the
+	orientation of the surface (and, for the Perez model, on the beam and
+	diffuse irradiance at the panel) for the current timestamp, so panels
+	sharing a surface orientation (and a cloud pattern cell) cost one
+	lookup each.  The cache is cleared whenever the clock or the weather
+	values the geometry depends on change.
+
+	Lookups share the lock, so panels syncing on different threads only
+	wait on each other when one of them adds the surfaces it missed, which
+	are computed before the lock is taken.
+
+ @{
+ **/
+
+#ifndef _SOLAR_CACHE_H
+#define _SOLAR_CACHE_H
+
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include "gridlabd.h"
+
+typedef enum {
+	SCM_LIUJORDAN = 0, ///< isotropic sky tilt model
+	SCM_SOLPOS = 1, ///< solpos position and Perez tilt model
+} SOLARCACHEMODEL;
+
+/// Values that invalidate all the cached surfaces when they change
+typedef struct s_solar_cache_epoch {
+	TIMESTAMP clock;
+	double temperature;
+	double pressure;
+	double solcon;
+	double tz_offset;
+	double tz_meridian;
+} SOLARCACHEEPOCH;
+
+/// Surface whose geometry is cached
+typedef struct s_solar_cache_key {
+	int model;
+	double tilt; ///< radians
+	double orientation; ///< radians
+	double direct; ///< beam normal irradiance (SOLPOS only)
+	double diffuse; ///< diffuse horizontal irradiance (SOLPOS only)
+} SOLARCACHEKEY;
+
+/// Cached geometry of a surface
+typedef struct s_solar_cache_value {
+	double cos_incident; ///< cosine of the angle of incidence (clipped at 0 for SOLPOS)
+	double sky_factor; ///< 1+cos(tilt) (LIUJORDAN) or Perez diffuse factor (SOLPOS)
+	double ground_factor; ///< 1-cos(tilt)
+} SOLARCACHEVALUE;
+
+class solar_cache {
+private:
+	struct key_order {
+		bool operator()(const SOLARCACHEKEY &a, const SOLARCACHEKEY &b) const;
+	};
+	std::shared_mutex lock;
+	std::map<SOLARCACHEKEY,SOLARCACHEVALUE,key_order> surfaces;
+	SOLARCACHEEPOCH epoch;
+	bool valid;
+	bool is_current(const SOLARCACHEEPOCH &now) const;
+public:
+	solar_cache(void);
+	/** Find a series of surfaces in the given epoch
+		@return the number of surfaces not cached, whose indexes are stored in missing
+	 **/
+	size_t find(const SOLARCACHEEPOCH &now, size_t count, const SOLARCACHEKEY *key, SOLARCACHEVALUE *value, size_t *missing);
+	/** Add the surfaces that were missing, clearing the cache first if the epoch changed **/
+	void add(const SOLARCACHEEPOCH &now, size_t count, const size_t *missing, const SOLARCACHEKEY *key, const SOLARCACHEVALUE *value);
+};
+
+#endif
+
+/**@}*/
@@ -0,0 +1,213 @@
+/** $Id: weather_binary.cpp $
+	Copyright (C) 2008 Battelle Memorial Institute
+	@file weather_binary.cpp
+	@addtogroup climate
+	@ingroup modules
+
+ @{
+ **/
+
+#include <fcntl.h>
+#include <mutex>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "weather_binary.h"
+
+weather_binary *weather_binary::first = NULL;
+static std::mutex open_lock;
+
+weather_binary::weather_binary(void)
+{
+	filename = NULL;
+	map = NULL;
+	size = 0;
+	header = NULL;
+	names = NULL;
+	rows = NULL;
+	stride = 0;
+	next = NULL;
+}
+
+weather_binary *weather_binary::open(const char *file)
+{
+	std::lock_guard<std::mutex> guard(open_lock);
+	for ( weather_binary *item = first ; item != NULL ; item = item->next )
+	{
+		if ( strcmp(item->filename,file) == 0 )
+		{
+			return item;
+		}
+	}
+	weather_binary *item = new weather_binary;
+	if ( ! item->load(file) )
+	{
+		delete item;
+		return NULL;
+	}
+	item->next = first;
+	first = item;
+	return item;
+}
+
+bool weather_binary::load(const char *file)
+{
+	int fd = ::open(file,O_RDONLY);
+	if ( fd < 0 )
+	{
+		gl_error("weather_binary::load(file='%s'): %s",file,strerror(errno));
+		return false;
+	}
+	struct stat info;
+	if ( fstat(fd,&info) != 0 || (size_t)info.st_size < sizeof(GLWHEADER) )
+	{
+		gl_error("weather_binary::load(file='%s'): file is too short to be a compiled weather file",file);
+		::close(fd);
+		return false;
+	}
+	size = (size_t)info.st_size;
+	map = mmap(NULL,size,PROT_READ,MAP_SHARED,fd,0);
+	::close(fd);
+	if ( map == MAP_FAILED )
+	{
+		gl_error("weather_binary::load(file='%s'): %s",file,strerror(errno));
+		map = NULL;
+		return false;
+	}
+	header = (const GLWHEADER*)map;
+	if ( strncmp(header->magic,GLW_MAGIC,sizeof(header->magic)) != 0 )
+	{
+		gl_error("weather_binary::load(file='%s'): not a compiled weather file",file);
+		/* TROUBLESHOOT
+			The weather file has the extension of a compiled weather file but does not
+			start with the compiled weather file signature.  Recompile the weather data
+			using `gridlabd weather compile` and try again.
+		 */
+		munmap(map,size);
+		return false;
+	}
+	if ( header->version != GLW_VERSION )
+	{
+		gl_error("weather_binary::load(file='%s'): compiled weather file version %d is not supported (expected version %d)",file,header->version,GLW_VERSION);
+		/* TROUBLESHOOT
+			The weather file was compiled for a different version of GridLAB-D or on a
+			system with a different byte order.  Recompile the weather data using
+			`gridlabd weather compile` and try again.
+		 */
+		munmap(map,size);
+		return false;
+	}
+	if ( header->n_columns < 0 || header->n_rows < 1 )
+	{
+		gl_error("weather_binary::load(file='%s'): file header is invalid (%lld rows of %d columns)",file,(long long)header->n_rows,header->n_columns);
+		/* TROUBLESHOOT
+			The header of the compiled weather file gives a negative number of columns
+			or no rows.  The file is damaged or was not written by `gridlabd weather compile`.
+			Recompile the weather data and try again.
+		 */
+		munmap(map,size);
+		return false;
+	}
+
+	// check the sizes by division so that a damaged header cannot overflow them
+	stride = sizeof(int64) + sizeof(double)*(size_t)header->n_columns;
+	size_t available = size - sizeof(GLWHEADER);
+	size_t names_size = (size_t)header->n_columns*GLW_NAMESIZE;
+	if ( names_size > available || (uint64)header->n_rows > (available-names_size)/stride )
+	{
+		gl_error("weather_binary::load(file='%s'): file is truncated (%lld rows of %d columns do not fit in %lld bytes)",
+			file,(long long)header->n_rows,header->n_columns,(long long)size);
+		/* TROUBLESHOOT
+			The compiled weather file is shorter than its header says it should be.  The
+			file was not completely written or has been damaged.  Recompile the weather
+			data using `gridlabd weather compile` and try again.
+		 */
+		munmap(map,size);
+		return false;
+	}
+	names = (const char*)map + sizeof(GLWHEADER);
+	for ( int n = 0 ; n < header->n_columns ; n++ )
+	{
+		if ( memchr(names+(size_t)n*GLW_NAMESIZE,'\0',GLW_NAMESIZE) == NULL )
+		{
+			gl_error("weather_binary::load(file='%s'): name of column %d is not terminated",file,n);
+			/* TROUBLESHOOT
+				Each column name of a compiled weather file must end with a null character
+				within its GLW_NAMESIZE bytes.  The file is damaged or was not written by
+				`gridlabd weather compile`.  Recompile the weather data and try again.
+			 */
+			munmap(map,size);
+			return false;
+		}
+	}
+	rows = names + (size_t)header->n_columns*GLW_NAMESIZE;
+	filename = strdup(file);
+	return true;
+}
+
+int64 weather_binary::find(TIMESTAMP t, int64 hint) const
+{
+	int64 last = header->n_rows - 1;
+	if ( t < get_time(0) )
+	{
+		return -1;
+	}
+	if ( t >= get_time(last) )
+	{
+		return last;
+	}
+
+	// the row used last time or the one after it is almost always the answer
+	for ( int64 row = hint ; row >= 0 && row < last && row <= hint+1 ; row++ )
+	{
+		if ( get_time(row) <= t && t < get_time(row+1) )
+		{
+			return row;
+		}
+	}
+
+	// evenly spaced rows can be indexed directly
+	if ( header->interval > 0 )
+	{
+		int64 row = (t - header->start) / header->interval;
+		if ( row >= 0 && row < last && get_time(row) <= t && t < get_time(row+1) )
+		{
+			return row;
+		}
+	}
+
+	// otherwise bisect
+	int64 lo = 0, hi = last;
+	while ( hi - lo > 1 )
+	{
+		int64 mid = lo + (hi-lo)/2;
+		if ( get_time(mid) <= t )
+		{
+			lo = mid;
+		}
+		else
+		{
+			hi = mid;
+		}
+	}
+	return lo;
+}
+
+void weather_binary::standard_time(TIMESTAMP t, double tz_offset, short *month, short *day, double *hour)
+{
+	// civil date from days since 1970-01-01 (see http://howardhinnant.github.io/date_algorithms.html)
+	int64 lst = t + (int64)(tz_offset*3600);
+	int64 days = ( lst >= 0 ? lst/86400 : (lst-86399)/86400 );
+	int64 seconds = lst - days*86400;
+	int64 z = days + 719468;
+	int64 era = ( z >= 0 ? z : z-146096 ) / 146097;
+	int64 doe = z - era*146097;
+	int64 yoe = (doe - doe/1460 + doe/36524 - doe/146096) / 365;
+	int64 doy = doe - (365*yoe + yoe/4 - yoe/100); // counted from March 1
+	int64 mp = (5*doy + 2) / 153;
+	if ( month ) *month = (short)( mp < 10 ? mp+3 : mp-9 );
+	if ( day ) *day = (short)( doy - (153*mp + 2)/5 + 1 );
+	if ( hour ) *hour = seconds/3600.0;
+}
+
+/**@}*/
@@ -0,0 +1,86 @@
+/** $Id: weather_binary.h $
+	Copyright (C) 2008 Battelle Memorial Institute
+	@file weather_binary.h
+	@addtogroup climate
+	@ingroup modules
+
+	Compiled weather files
+
+	A compiled weather file (extension `.glw`) holds the weather as fixed-size
+	rows, each made of an int64 UTC timestamp followed by one double per
+	column.  The file is mapped into memory rather than parsed, and a file
+	used by several climate objects is mapped only once per process.  When
+	the rows are evenly spaced the row in effect at a given time is found by
+	index arithmetic, otherwise by bisection.
+
+	Compiled weather files are written by `gridlabd weather compile`.  The
+	layout is a GLWHEADER, followed by `n_columns` column names of
+	GLW_NAMESIZE characters, followed by `n_rows` rows.  Column names are the
+	names of climate properties, optionally followed by the unit of the data
+	in brackets, e.g., `temperature[degC]`.  All values are little-endian.
+
+ @{
+ **/
+
+#ifndef _WEATHER_BINARY_H
+#define _WEATHER_BINARY_H
+
+#include "gridlabd.h"
+
+#define GLW_MAGIC "GLDWTHR" ///< first bytes of a compiled weather file
+#define GLW_VERSION 1 ///< version of the file layout
+#define GLW_NAMESIZE 64 ///< size of a column name (including the terminating null)
+
+/// Compiled weather file header
+typedef struct s_glwheader {
+	char magic[8]; ///< GLW_MAGIC (null terminated)
+	int32 version; ///< GLW_VERSION
+	int32 n_columns; ///< number of values in each row
+	int64 n_rows; ///< number of rows
+	int64 start; ///< time of the first row (s since epoch, UTC)
+	int64 interval; ///< time between rows (s), or 0 if the rows are not evenly spaced
+	double latitude; ///< latitude of the station (deg, NaN if unknown)
+	double longitude; ///< longitude of the station (deg, NaN if unknown)
+	double tz_offset; ///< offset of local standard time from UTC (h, NaN if unknown)
+	double elevation; ///< elevation of the station (m, NaN if unknown)
+	char city[32]; ///< name of the station
+	char region[32]; ///< state or province of the station
+} GLWHEADER;
+
+class weather_binary {
+private:
+	char *filename;
+	void *map;
+	size_t size;
+	const GLWHEADER *header;
+	const char *names;
+	const char *rows;
+	size_t stride;
+	weather_binary *next; ///< files already mapped
+	static weather_binary *first;
+private:
+	weather_binary(void);
+	bool load(const char *file);
+public:
+	/** Map a compiled weather file, or get the file already mapped by another object
+		@return NULL on failure (the error is reported)
+	 **/
+	static weather_binary *open(const char *file);
+	/** Convert a UTC time to the month, day and hour of local standard time **/
+	static void standard_time(TIMESTAMP t, double tz_offset, short *month, short *day, double *hour);
+public:
+	inline const GLWHEADER *get_header(void) const { return header; };
+	inline int get_columns(void) const { return header->n_columns; };
+	inline int64 get_rows(void) const { return header->n_rows; };
+	inline const char *get_name(int column) const { return names + (size_t)column*GLW_NAMESIZE; };
+	inline TIMESTAMP get_time(int64 row) const { return (TIMESTAMP)*(const int64*)(rows + (size_t)row*stride); };
+	inline const double *get_data(int64 row) const { return (const double*)(rows + (size_t)row*stride + sizeof(int64)); };
+	/** Find the row in effect at a time
+		@return the last row whose time is not after t, or -1 if t precedes the first row
+	 **/
+	int64 find(TIMESTAMP t, int64 hint = -1) const;
+};
+
+#endif
+
+/**@}*/
@@ -13,6 +13,8 @@ module_market_market_la_SOURCES += module/market/auction.cpp
 module_market_market_la_SOURCES += module/market/auction.h
 module_market_market_la_SOURCES += module/market/bid.cpp
 module_market_market_la_SOURCES += module/market/bid.h
+module_market_market_la_SOURCES += module/market/bidbuffer.cpp
+module_market_market_la_SOURCES += module/market/bidbuffer.h
 module_market_market_la_SOURCES += module/market/collect.cpp
 module_market_market_la_SOURCES += module/market/collect.h
 module_market_market_la_SOURCES += module/market/controller.cpp
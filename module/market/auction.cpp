@@ -221,6 +221,7 @@ int auction::create(void)
 	warmup = 1;
 	market_id = 1;
 	clearing_scalar = 0.5;
+	bid_buffer = NULL;
 	/* process dynamic statistics */
 	if(statistic_check == -1){
 		int rv;
@@ -287,6 +288,13 @@ int auction::init(OBJECT *parent)
 		curve_log_count = curve_log_max;
 	}
 
+	if ( bid_buffering )
+	{
+		char threadcount[32] = "1";
+		gl_global_getvar("threadcount",threadcount,sizeof(threadcount));
+		bid_buffer = new bidbuffer((unsigned int)atoi(threadcount));
+	}
+
 	if (pricecap==0){
 		pricecap = 9999.0;
 	}
@@ -874,6 +882,19 @@ void auction::clear_market(void)
 
 	memset((void*)&unresponsive, 0, sizeof(unresponsive));
 
+	/* replay the buffered bids in the order they were submitted */
+	if ( bid_buffer != NULL )
+	{
+		std::vector<BUFFEREDBID> &bids = bid_buffer->merge();
+		for ( std::vector<BUFFEREDBID>::iterator bid = bids.begin() ; bid != bids.end() ; bid++ )
+		{
+			if ( submit_nolock(bid->from.c_str(), bid->quantity, bid->price, bid->key, bid->state, bid->rebid, bid->market_id, bid->submit_time) == 0 && bid->accepted != NULL )
+			{
+				*(bid->accepted) = false;
+			}
+		}
+	}
+
 	/* handle unbidding capacity */
 	if(capacity_reference_property != NULL && special_mode != MD_FIXED_BUYER){
 		char name[256];
@@ -928,7 +949,7 @@ void auction::clear_market(void)
 		}
 		else if (unresponsive.quantity > 0.001)
 		{
-			submit_nolock(unresponsive.from, -unresponsive.quantity, unresponsive.price, unresponsive.bid_id, BS_ON, false, market_id);
+			submit_nolock(unresponsive.from, -unresponsive.quantity, unresponsive.price, unresponsive.bid_id, BS_ON, false, market_id, gl_globalclock);
 			gl_verbose("capacity_reference_property %s has %.3f unresponsive load", gl_name(linkref,name,sizeof(name)), -unresponsive.quantity);
 		}
 	}
@@ -951,7 +972,7 @@ void auction::clear_market(void)
 					snprintf(msg,sizeof(msg)-1, "capacity_reference_property %s uses units of %s and is incompatible with auction units (%s)", capacity_reference_property->name, capacity_reference_property->unit->name, unit.get_string());
 					throw msg;
 				} else {
-					submit_nolock((const char *)THISOBJECTHDR->name, max_capacity_reference_bid_quantity, capacity_reference_bid_price, (int64)THISOBJECTHDR->id, BS_ON, false, market_id);
+					submit_nolock((const char *)THISOBJECTHDR->name, max_capacity_reference_bid_quantity, capacity_reference_bid_price, (int64)THISOBJECTHDR->id, BS_ON, false, market_id, gl_globalclock);
 					if (verbose) gl_output("Capacity reference object: %s bids %.2f at %.2f", capacity_reference_object->name, max_capacity_reference_bid_quantity, capacity_reference_bid_price);
 				}
 			}
@@ -1068,7 +1089,7 @@ void auction::clear_market(void)
 				gl_warning("Seller-only auction was given purchasing bids");
 			}
 			asks.clear();
-			submit((const char *)THISOBJECTHDR->name, -fixed_quantity, fixed_price, (int64)THISOBJECTHDR->id, BS_ON, false, market_id);
+			submit_nolock((const char *)THISOBJECTHDR->name, -fixed_quantity, fixed_price, (int64)THISOBJECTHDR->id, BS_ON, false, market_id, gl_globalclock);
 			break;
 		case MD_FIXED_BUYER:
 			asks.sort(true);
@@ -1076,7 +1097,7 @@ void auction::clear_market(void)
 				gl_warning("Buyer-only auction was given offering bids");
 			}
 			offers.clear();
-			submit((const char *)THISOBJECTHDR->name, fixed_quantity, fixed_price, (int64)THISOBJECTHDR->id, BS_ON, false, market_id);
+			submit_nolock((const char *)THISOBJECTHDR->name, fixed_quantity, fixed_price, (int64)THISOBJECTHDR->id, BS_ON, false, market_id, gl_globalclock);
 			break;
 		case MD_NONE:
 			offers.sort(false);
@@ -1449,7 +1470,7 @@ void auction::clear_market(void)
 	}
 }
 
-void auction::record_bid(const char *from, double quantity, double real_price, BIDDERSTATE state)
+void auction::record_bid(const char *from, double quantity, double real_price, BIDDERSTATE state, TIMESTAMP submit_time)
 {
 	const char *unkState = "unknown";
 	const char *offState = "off";
@@ -1460,7 +1481,6 @@ void auction::record_bid(const char *from, double quantity, double real_price, B
 	const char *pState = NULL;
 	const char *tStr;
 	DATETIME dt;
-	TIMESTAMP submit_time = gl_globalclock;
 	if(trans_file){ // copied from version below
 		if((this->trans_log_max <= 0) || (trans_log_count > 0)){
 			gl_localtime(submit_time,&dt);
@@ -1487,18 +1507,23 @@ void auction::record_bid(const char *from, double quantity, double real_price, B
 	}
 }
 
-int auction::submit(const char *from, double quantity, double real_price, KEY key, BIDDERSTATE state, bool rebid, int64 mkt_id)
+int auction::submit(const char *from, double quantity, double real_price, KEY key, BIDDERSTATE state, bool rebid, int64 mkt_id, bool *accepted)
 {
+	/* the market id does not change until the market clears, so bids into future markets are rejected now
+	   and the curves are only checked when the buffered bids are replayed */
+	if ( bid_buffer != NULL && mkt_id <= market_id )
+	{
+		bid_buffer->append(from,quantity,real_price,key,state,rebid,mkt_id,gl_globalclock,accepted);
+		return 1;
+	}
 	gld_wlock lock(my());
-	return submit_nolock(from,quantity,real_price,key,state, rebid, mkt_id);
+	return submit_nolock(from,quantity,real_price,key,state, rebid, mkt_id, gl_globalclock);
 }
-int auction::submit_nolock(const char *from, double quantity, double real_price, KEY key, BIDDERSTATE state, bool rebid, int64 mkt_id)
+int auction::submit_nolock(const char *from, double quantity, double real_price, KEY key, BIDDERSTATE state, bool rebid, int64 mkt_id, TIMESTAMP submit_time)
 {
 	char myname[64];
-	TIMESTAMP submit_time = gl_globalclock;
 	DATETIME dt;
 	double price;
-	gl_localtime(submit_time,&dt);
 	char buffer[256];
 	BIDDEF biddef;
 	KEY b_id = key;
@@ -1539,6 +1564,7 @@ int auction::submit_nolock(const char *from, double quantity, double real_price,
 	{
 		KEY out;
 		if (verbose){
+			gl_localtime(submit_time,&dt);
 			gl_output("   ...  %s resubmits %s from object %s for %.2f %s at $%.2f/%s at %s", 
 				gl_name(THISOBJECTHDR,myname,sizeof(myname)), quantity<0?"ask":"offer", from,
 				fabs(quantity), unit.get_string(), price, unit.get_string(), gl_strtime(&dt,buffer,sizeof(buffer))?buffer:"unknown time");
@@ -1565,7 +1591,7 @@ int auction::submit_nolock(const char *from, double quantity, double real_price,
 			return 0;
 		}
 
-		record_bid(from, quantity, real_price, state);
+		record_bid(from, quantity, real_price, state, submit_time);
 		return 1;
 	} 
 	else if (mkt_id == market_id && rebid == false)
@@ -1573,6 +1599,7 @@ int auction::submit_nolock(const char *from, double quantity, double real_price,
 		char myname[64];
 		KEY out;
 		if (verbose){
+			gl_localtime(submit_time,&dt);
 			gl_output("   ...  %s receives %s from object %s for %.2f %s at $%.2f/%s at %s", 
 				gl_name(THISOBJECTHDR,myname,sizeof(myname)), quantity<0?"ask":"offer", from,
 				fabs(quantity), unit.get_string(), price, unit.get_string(), gl_strtime(&dt,buffer,sizeof(buffer))?buffer:"unknown time");
@@ -1591,7 +1618,7 @@ int auction::submit_nolock(const char *from, double quantity, double real_price,
 		biddef.bid_type = (quantity > 0 ? BID_SELL : BID_BUY);
 		write_bid(out, biddef.market, biddef.bid, biddef.bid_type);
 		// interject transaction log file writing here
-		record_bid(from, quantity, real_price, state);
+		record_bid(from, quantity, real_price, state, submit_time);
 		biddef.raw = out;
 		return 1;
 	} else { // key between cleared market and 'market_id' ~ points to an old market
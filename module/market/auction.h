@@ -15,6 +15,7 @@
 #include "market.h"
 #include "bid.h"
 #include "curve.h"
+#include "bidbuffer.h"
 
 typedef struct s_statistic {
 	char32 statname;
@@ -72,7 +73,7 @@ private:
 	int push_market_frame(TIMESTAMP t1);
 	int check_next_market(TIMESTAMP t1);
 	TIMESTAMP pop_market_frame(TIMESTAMP t1);
-	void record_bid(const char *from, double quantity, double real_price, BIDDERSTATE state);
+	void record_bid(const char *from, double quantity, double real_price, BIDDERSTATE state, TIMESTAMP submit_time);
 	void record_curve(double, double);
 	// variables
 	curve asks;			/**< demand curve */ 
@@ -153,10 +154,11 @@ private:
 	int64 trans_log_count;
 	FILE *curve_file;
 	int64 curve_log_count;
+	bidbuffer *bid_buffer; ///< per-thread bids waiting for the clearing (market::bid_buffering)
 public:
-	int submit(const char *from, double quantity, double real_price, KEY key, BIDDERSTATE state, bool rebid, int64 mkt_id);
+	int submit(const char *from, double quantity, double real_price, KEY key, BIDDERSTATE state, bool rebid, int64 mkt_id, bool *accepted=NULL);
 private:
-	int submit_nolock(const char *from, double quantity, double real_price, KEY key, BIDDERSTATE state, bool rebid, int64 mkt_id);
+	int submit_nolock(const char *from, double quantity, double real_price, KEY key, BIDDERSTATE state, bool rebid, int64 mkt_id, TIMESTAMP submit_time);
 public:
 	TIMESTAMP nextclear() const;
 private:
@@ -0,0 +1,71 @@
+"""Measure the bid submission rate of the auction
+
+Syntax: python3 benchmark.py [-T THREADS] [SIZE ...]
+
+Each size is a synthetic population of stub bidders, half buyers and half
+sellers with prices spread over the price range, that bid every minute
+into a 5 minute market for one day.  The population is run once with bids
+submitted directly to the auction and once with market::bid_buffering, and
+the number of bids processed per second of elapsed time is compared.
+"""
+import sys, time, subprocess
+
+args = sys.argv[1:]
+threads = 1
+if len(args) > 1 and args[0] == "-T":
+    threads = int(args[1])
+    args = args[2:]
+sizes = [int(x) for x in args] if args else [1000,5000,20000]
+modes = ["FALSE","TRUE"]
+duration = 86400
+bid_period = 60
+
+def run(size,mode):
+    name = f"benchmark_bids{size}_{mode.lower()}"
+    with open(f"{name}.glm","w") as fh:
+        print(f"""#set threadcount={threads}
+clock
+{{
+    timezone "PST+8PDT";
+    starttime "2020-01-01 00:00:00 PST";
+    stoptime "2020-01-02 00:00:00 PST";
+}}
+module market
+{{
+    bid_buffering {mode};
+}}
+object auction
+{{
+    name market;
+    unit MWh;
+    period 300;
+    warmup 0;
+    init_price 50;
+    init_stdev 5;
+}}""",file=fh)
+        for n in range(size):
+            print(f"""object stub_bidder
+{{
+    market market;
+    role {"BUYER" if n%2 else "SELLER"};
+    bid_period {bid_period};
+    count {duration//bid_period+1};
+    price {10+(n*37)%80};
+    quantity {1+n%5};
+}}""",file=fh)
+    tic = time.perf_counter()
+    result = subprocess.run(["gridlabd",f"{name}.glm"],capture_output=True,text=True)
+    toc = time.perf_counter()
+    if result.returncode != 0:
+        print(result.stderr,file=sys.stderr)
+        return None
+    return size*(duration//bid_period)/(toc-tic)
+
+print("Bidders  Direct(bid/s) Buffered(bid/s) Speedup")
+print("-------- ------------- --------------- -------")
+for size in sizes:
+    rates = [run(size,mode) for mode in modes]
+    if None in rates:
+        print(f"{size:8d} failed")
+    else:
+        print(f"{size:8d} {rates[0]:13.0f} {rates[1]:15.0f} {rates[1]/rates[0]:7.2f}")
@@ -29,11 +29,11 @@ EXPORT void submit_bid_state(const char *from, const char *to, const char *funct
 			if(bidding_info->state == BS_UNKNOWN) {// not a stateful bid
 				gl_verbose("%s submits stateless bid for Q:%.2f at P:%.4f", from,bidding_info->quantity,bidding_info->price);
 				auction *mkt = OBJECTDATA(obj,auction);
-				rv = mkt->submit(from,bidding_info->quantity,bidding_info->price,bidding_info->bid_id,bidding_info->state,bidding_info->rebid, bidding_info->market_id);
+				rv = mkt->submit(from,bidding_info->quantity,bidding_info->price,bidding_info->bid_id,bidding_info->state,bidding_info->rebid, bidding_info->market_id, &bidding_info->bid_accepted);
 			} else {
 				gl_verbose("%s submits stateful (%s) bid for Q:%.2f at P:%.4f", from,bidding_info->state,bidding_info->quantity,bidding_info->price);
 				auction *mkt = OBJECTDATA(obj,auction);
-				rv = mkt->submit(from,bidding_info->quantity,bidding_info->price,bidding_info->bid_id,bidding_info->state,bidding_info->rebid, bidding_info->market_id);
+				rv = mkt->submit(from,bidding_info->quantity,bidding_info->price,bidding_info->bid_id,bidding_info->state,bidding_info->rebid, bidding_info->market_id, &bidding_info->bid_accepted);
 			}
 			if(rv == 0) {
 				bidding_info->bid_accepted = false;
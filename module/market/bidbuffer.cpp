@@ -0,0 +1,84 @@
+/** $Id: bidbuffer.cpp $
+	Copyright (C) 2008 Battelle Memorial Institute
+	@file bidbuffer.cpp
+	@addtogroup auction
+	@ingroup market
+
+ @{
+ **/
+
+#include <algorithm>
+#include <thread>
+#include "bidbuffer.h"
+
+/* each thread that submits a bid gets its own slot number */
+static std::atomic<unsigned int> next_thread(0);
+static thread_local unsigned int thread_slot = next_thread++;
+
+static bool by_sequence(const BUFFEREDBID &a, const BUFFEREDBID &b)
+{
+	return a.sequence < b.sequence;
+}
+
+bidbuffer::bidbuffer(unsigned int n)
+{
+	// threadcount 0 means the core uses all the processors
+	n_slots = ( n > 0 ? n : std::thread::hardware_concurrency() );
+	if ( n_slots == 0 )
+	{
+		n_slots = 1;
+	}
+	slots = new SLOT[n_slots];
+	sequence = 0;
+}
+
+bidbuffer::~bidbuffer(void)
+{
+	delete [] slots;
+}
+
+void bidbuffer::append(const char *from, double quantity, double price, KEY key, BIDDERSTATE state, bool rebid, int64 market_id, TIMESTAMP submit_time, bool *accepted)
+{
+	BUFFEREDBID bid;
+	bid.sequence = sequence++;
+	bid.from = from;
+	bid.quantity = quantity;
+	bid.price = price;
+	bid.key = key;
+	bid.state = state;
+	bid.rebid = rebid;
+	bid.market_id = market_id;
+	bid.submit_time = submit_time;
+	bid.accepted = accepted;
+
+	SLOT &slot = slots[thread_slot%n_slots];
+	while ( slot.busy.test_and_set(std::memory_order_acquire) )
+	{
+		// spin
+	}
+	slot.list.push_back(bid);
+	slot.busy.clear(std::memory_order_release);
+}
+
+std::vector<BUFFEREDBID> &bidbuffer::merge(void)
+{
+	merged.clear();
+	for ( unsigned int n = 0 ; n < n_slots ; n++ )
+	{
+		SLOT &slot = slots[n];
+		while ( slot.busy.test_and_set(std::memory_order_acquire) )
+		{
+			// spin
+		}
+		merged.insert(merged.end(),slot.list.begin(),slot.list.end());
+		slot.list.clear();
+		slot.busy.clear(std::memory_order_release);
+	}
+	if ( n_slots > 1 )
+	{
+		std::sort(merged.begin(),merged.end(),by_sequence);
+	}
+	return merged;
+}
+
+/**@}*/
@@ -0,0 +1,69 @@
+/** $Id: bidbuffer.h $
+	Copyright (C) 2008 Battelle Memorial Institute
+	@file bidbuffer.h
+	@addtogroup auction
+	@ingroup market
+
+	Per-thread bid buffers
+
+	When market::bid_buffering is set, an auction does not take its object
+	lock when a bid is submitted.  Instead the bid is appended to the buffer
+	of the submitting thread together with a sequence number, and the
+	auction replays all the buffered bids in order of submission when it
+	clears the market.  Rebids are resolved at that time, so they must be
+	replayed in the order they were submitted regardless of which thread
+	submitted them.  A bid rejected during the replay clears the bidder's
+	acceptance flag, which the bidder checks when it bids again.
+
+ @{
+ **/
+
+#ifndef _bidbuffer_h_
+#define _bidbuffer_h_
+
+#include <atomic>
+#include <string>
+#include <vector>
+#include "gridlabd.h"
+#include "market.h"
+
+extern bool bid_buffering;
+
+/** Bid held until the market clears */
+typedef struct s_bufferedbid {
+	int64 sequence; ///< order of submission
+	std::string from; ///< name of the bidder (the caller's buffer does not outlive the call)
+	double quantity;
+	double price;
+	KEY key;
+	BIDDERSTATE state;
+	bool rebid;
+	int64 market_id;
+	TIMESTAMP submit_time;
+	bool *accepted; ///< bidder's acceptance flag, cleared if the replay rejects the bid (may be NULL)
+} BUFFEREDBID;
+
+class bidbuffer {
+private:
+	typedef struct s_slot {
+		std::atomic_flag busy = ATOMIC_FLAG_INIT; ///< only contended when threads share a slot
+		std::vector<BUFFEREDBID> list;
+	} SLOT;
+	SLOT *slots;
+	unsigned int n_slots;
+	std::atomic<int64> sequence;
+	std::vector<BUFFEREDBID> merged; ///< bids of the market being cleared
+public:
+	bidbuffer(unsigned int n_slots);
+	~bidbuffer(void);
+	/** Add a bid to the buffer of the calling thread **/
+	void append(const char *from, double quantity, double price, KEY key, BIDDERSTATE state, bool rebid, int64 market_id, TIMESTAMP submit_time, bool *accepted);
+	/** Collect the bids of all threads in order of submission and empty the buffers
+		@return the bids, which remain valid until the next merge
+	 **/
+	std::vector<BUFFEREDBID> &merge(void);
+};
+
+#endif
+
+/**@}*/
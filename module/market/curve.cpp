@@ -12,6 +12,10 @@ curve::curve(void)
 	bid_ids = NULL;
 	n_bids = 0;
 	total = 0;
+	sort_len = 0;
+	sort_keys = NULL;
+	sort_tmp = NULL;
+	sort_idx = NULL;
 }
 
 curve::~curve(void)
@@ -19,6 +23,9 @@ curve::~curve(void)
 	delete [] bids;
 	delete [] keys;
 	delete [] bid_ids;
+	delete [] sort_keys;
+	delete [] sort_tmp;
+	delete [] sort_idx;
 }
 
 void curve::clear(void)
@@ -258,43 +265,90 @@ int curve::remove_bid(KEY bid_id)
 		return n_bids;
 	}
 }
-void curve::sort(bool reverse)
+/* map a price to an unsigned key with the same ordering */
+static inline unsigned long long price_key(double price)
 {
-	sort(bids, keys, n_bids, reverse);
+	unsigned long long key;
+	price += 0.0; // -0 and +0 must compare equal
+	memcpy(&key,&price,sizeof(key));
+	return ( key & 0x8000000000000000ULL ) ? ~key : ( key | 0x8000000000000000ULL );
 }
 
-void curve::sort(BID *list, KEY *key, const int len, const bool reverse)
+/* Sort the bids by price using an LSD radix sort of the keys
+	
+	Ascending sorts place equal prices in reverse order of submission and
+	descending sorts keep them in order of submission, which is the order
+	the merge sort this replaces produced.
+ */
+void curve::sort(bool reverse)
 {
-	//merge sort
-	if (len>1)
+	if ( n_bids < 2 )
 	{
-		int split = len/2;
-		KEY *a = key, *b = key+split;
-		if (split>1) sort(list,a,split,reverse);
-		if (len-split>1) sort(list,b,len-split,reverse);
-		KEY *res = new KEY[len];
-		KEY *p = res;
-		do {
-			bool altb = list[*a].price < list[*b].price;
-			if ((reverse && !altb) || (!reverse && altb))
-			{
-				*p++ = *a++;
-			}
-			else
-			{
-				*p++ = *b++;
-			}
-		} while (a<key+split && b<key+len);
-		while (a<key+split)
+		return;
+	}
+	if ( n_bids > sort_len )
+	{
+		delete [] sort_keys;
+		delete [] sort_tmp;
+		delete [] sort_idx;
+		sort_len = len;
+		sort_keys = new unsigned long long[sort_len];
+		sort_tmp = new unsigned long long[sort_len];
+		sort_idx = new KEY[sort_len];
+	}
+	int i;
+	if ( ! reverse )
+	{
+		for ( i = 0 ; i < n_bids/2 ; i++ )
 		{
-			*p++ = *a++;
+			KEY k = keys[i];
+			keys[i] = keys[n_bids-1-i];
+			keys[n_bids-1-i] = k;
 		}
-		while (b<key+len)
+	}
+	unsigned int count[8][256];
+	memset(count,0,sizeof(count));
+	for ( i = 0 ; i < n_bids ; i++ )
+	{
+		unsigned long long key = price_key(bids[keys[i]].price);
+		if ( reverse )
 		{
-			*p++ = *b++;
+			key = ~key;
 		}
-		memcpy(key,res,sizeof(KEY)*len);
-		delete[] res;
+		sort_keys[i] = key;
+		for ( int d = 0 ; d < 8 ; d++ )
+		{
+			count[d][(key>>(8*d))&0xff]++;
+		}
+	}
+	unsigned long long *src_key = sort_keys, *dst_key = sort_tmp;
+	KEY *src_idx = keys, *dst_idx = sort_idx;
+	for ( int d = 0 ; d < 8 ; d++ )
+	{
+		unsigned int *c = count[d];
+		if ( c[(src_key[0]>>(8*d))&0xff] == (unsigned int)n_bids )
+		{
+			continue; // all keys share this digit
+		}
+		unsigned int offset = 0;
+		for ( int b = 0 ; b < 256 ; b++ )
+		{
+			unsigned int n = c[b];
+			c[b] = offset;
+			offset += n;
+		}
+		for ( i = 0 ; i < n_bids ; i++ )
+		{
+			unsigned int pos = c[(src_key[i]>>(8*d))&0xff]++;
+			dst_key[pos] = src_key[i];
+			dst_idx[pos] = src_idx[i];
+		}
+		unsigned long long *tk = src_key; src_key = dst_key; dst_key = tk;
+		KEY *ti = src_idx; src_idx = dst_idx; dst_idx = ti;
+	}
+	if ( src_idx != keys )
+	{
+		memcpy(keys,src_idx,sizeof(KEY)*n_bids);
 	}
 }
 
@@ -16,8 +16,10 @@ private:
 	double total;
 	double total_on;
 	double total_off;
-private:
-	static void sort(BID *list, KEY *keys, const int len, const bool reverse);
+	int sort_len; ///< capacity of the sort buffers
+	unsigned long long *sort_keys; ///< radix keys of the price order
+	unsigned long long *sort_tmp; ///< radix scatter buffer for keys
+	KEY *sort_idx; ///< radix scatter buffer for bid indexes
 public:
 	curve(void);
 	~curve(void);
@@ -18,6 +18,7 @@
 #include "supervisory_control.h"
 
 double bid_offset = 0.0001;
+bool bid_buffering = false;
 
 EXPORT CLASS *init(CALLBACKS *fntable, MODULE *module, int argc, char *argv[])
 {
@@ -30,6 +31,7 @@ EXPORT CLASS *init(CALLBACKS *fntable, MODULE *module, int argc, char *argv[])
 	INIT_MMF(market);
 
 	gl_global_create("market::bid_offset",PT_double,&bid_offset,PT_UNITS,"$",PT_DESCRIPTION,"the bid offset value that prevents bids from being wrongly triggered",NULL);
+	gl_global_create("market::bid_buffering",PT_bool,&bid_buffering,PT_DESCRIPTION,"buffer bids per thread and merge them when the market clears",NULL);
 
 	new auction(module);
 	new controller(module);
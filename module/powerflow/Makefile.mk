@@ -55,8 +55,10 @@ module_powerflow_powerflow_la_SOURCES += module/powerflow/recloser.cpp module/po
 module_powerflow_powerflow_la_SOURCES += module/powerflow/regulator_configuration.cpp module/powerflow/regulator_configuration.h
 module_powerflow_powerflow_la_SOURCES += module/powerflow/regulator.cpp module/powerflow/regulator.h
 module_powerflow_powerflow_la_SOURCES += module/powerflow/restoration.cpp module/powerflow/restoration.h
+module_powerflow_powerflow_la_SOURCES += module/powerflow/scenario_set.cpp module/powerflow/scenario_set.h
 module_powerflow_powerflow_la_SOURCES += module/powerflow/sectionalizer.cpp module/powerflow/sectionalizer.h
 module_powerflow_powerflow_la_SOURCES += module/powerflow/series_reactor.cpp module/powerflow/series_reactor.h
+module_powerflow_powerflow_la_SOURCES += module/powerflow/solver_fbs.cpp module/powerflow/solver_fbs.h
 module_powerflow_powerflow_la_SOURCES += module/powerflow/solver_nr.cpp module/powerflow/solver_nr.h
 module_powerflow_powerflow_la_SOURCES += module/powerflow/solver_py.cpp module/powerflow/solver_py.h
 module_powerflow_powerflow_la_SOURCES += module/powerflow/substation.cpp module/powerflow/substation.h
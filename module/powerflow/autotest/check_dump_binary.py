@@ -0,0 +1,48 @@
+"""Check a binary voltdump/currdump file against the csv dump of the same data
+
+Syntax: python3 check_dump_binary.py CSVFILE DATFILE MAGIC
+"""
+import sys
+import struct
+
+csvfile, datfile, magic = sys.argv[1:4]
+
+# csv records, grouped by datetime (one header row per dump)
+csv = []
+with open(csvfile) as fh:
+    for line in fh:
+        if line.startswith("#") or line.endswith("_imag\n") or line.endswith("_angle\n"):
+            continue
+        row = line.strip().split(",")
+        if not csv or csv[-1][0] != row[1]:
+            csv.append((row[1],[]))
+        csv[-1][1].append((row[0],[float(x) for x in row[2:8]]))
+
+with open(datfile,"rb") as fh:
+    data = fh.read()
+assert data[0:8] == magic.encode(), f"{datfile} magic mismatch"
+version, mode, count = struct.unpack_from("3i",data,8)
+assert version == 1, f"{datfile} version {version} is not valid"
+pos = 20
+names = []
+for n in range(count):
+    end = data.index(b"\0",pos)
+    names.append(data[pos:end].decode())
+    pos = end + 1
+
+records = 0
+while pos < len(data):
+    timestamp, n = struct.unpack_from("qi",data,pos)
+    pos += 12
+    assert n == count, f"{datfile} record {records} has {n} entries instead of {count}"
+    datetime, rows = csv[records]
+    assert [x[0] for x in rows] == names, f"{datfile} names do not match {csvfile}"
+    for name, values in rows:
+        binary = struct.unpack_from("6d",data,pos)
+        pos += 48
+        for x, y in zip(values,binary):
+            assert abs(x-y) < 1e-5 + 1e-9*abs(y), f"{datfile} {name} at {datetime}: {binary} does not match {values}"
+    records += 1
+
+assert records == len(csv), f"{datfile} has {records} records but {csvfile} has {len(csv)}"
+assert records > 1, f"{datfile} only has {records} records"
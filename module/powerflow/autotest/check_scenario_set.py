@@ -0,0 +1,51 @@
+"""Check the scenario_set solutions against full solutions with the scenario loads added
+
+Syntax: python3 check_scenario_set.py RESULTS RECORDING TIMESTAMP NOMINAL TOLERANCE SCENARIO=TIMESTAMP ...
+
+RESULTS is the scenario_set output file and TIMESTAMP the run whose scenarios
+are checked.  RECORDING is a recorder of the voltages of the lowest voltage node
+while the scenario loads were actually added at the given timestamps, and
+NOMINAL its nominal voltage.  Each scenario must have converged, and its lowest
+per-unit voltage must match the full solution within TOLERANCE.
+"""
+import sys
+import re
+import cmath, math
+
+results, recording, timestamp, nominal, tolerance = sys.argv[1:6]
+nominal = float(nominal)
+tolerance = float(tolerance)
+checks = dict(x.split("=",1) for x in sys.argv[6:])
+
+def parse_complex(text):
+    match = re.fullmatch(r"([+-]?[0-9.]+(?:[eE][+-]?[0-9]+)?)([+-][0-9.]+(?:[eE][+-]?[0-9]+)?)([ijdr])(?: [A-Za-z]+)?",text.strip())
+    assert match, f"'{text}' is not a complex value"
+    x, y, notation = float(match[1]), float(match[2]), match[3]
+    if notation in "ij":
+        return complex(x,y)
+    return cmath.rect(x,math.radians(y) if notation == "d" else y)
+
+scenarios = {}
+with open(results) as fh:
+    header = fh.readline().strip().split(",")
+    for line in fh:
+        row = dict(zip(header,line.strip().split(",")))
+        if row["timestamp"] == timestamp:
+            scenarios[row["scenario"]] = row
+
+solutions = {}
+with open(recording) as fh:
+    for line in fh:
+        if line.startswith("#"):
+            continue
+        row = line.strip().split(",")
+        solutions[row[0]] = min(abs(parse_complex(x)) for x in row[1:4])
+
+for scenario, solved in checks.items():
+    assert scenario in scenarios, f"{results} has no result for {scenario} at {timestamp}"
+    row = scenarios[scenario]
+    assert row["converged"] == "TRUE" and int(row["iterations"]) > 0, f"{scenario} did not converge"
+    voltage = float(row["min_voltage[pu]"])
+    actual = solutions[solved] / nominal
+    print(f"{scenario}: scenario {voltage:.6f} pu, full solution {actual:.6f} pu at {row['min_voltage_node']}")
+    assert abs(voltage-actual) < tolerance, f"{scenario} is {voltage:.6f} pu but the full solution is {actual:.6f} pu"
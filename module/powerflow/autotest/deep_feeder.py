@@ -0,0 +1,17 @@
+"""Write a chain of line sections for the deep fault_check tests
+
+Usage: python3 deep_feeder.py SECTIONS SWITCH
+
+Node node_0 must be defined by the test.  Section n runs from node_{n-1} to
+node_n, and section SWITCH is a switch named sw_SWITCH.
+"""
+import sys
+
+sections = int(sys.argv[1])
+switch = int(sys.argv[2])
+for n in range(1,sections+1):
+    if n == switch:
+        print(f"object switch {{ name sw_{n}; phases ABCN; from node_{n-1}; to node_{n}; status CLOSED; }}")
+    else:
+        print(f"object overhead_line {{ name ol_{n}; phases ABCN; from node_{n-1}; to node_{n}; length 10 ft; configuration lc300; }}")
+    print(f"object node {{ name node_{n}; phases ABCN; nominal_voltage 7199.558; }}")
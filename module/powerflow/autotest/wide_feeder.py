@@ -0,0 +1,17 @@
+"""Write a wide two-level feeder for the FBS level sweep tests
+
+Usage: python3 wide_feeder.py LATERALS TAPS
+
+Node node_0 must be defined by the test.  Line lat_i runs from node_0 to
+node_i, and lines tap_i_j run from node_i to the loads load_i_j.
+"""
+import sys
+
+laterals = int(sys.argv[1])
+taps = int(sys.argv[2])
+for i in range(1,laterals+1):
+    print(f"object overhead_line {{ name lat_{i}; phases ABCN; from node_0; to node_{i}; length 5000 ft; configuration lc300; }}")
+    print(f"object node {{ name node_{i}; phases ABCN; nominal_voltage 7199.558; }}")
+    for j in range(1,taps+1):
+        print(f"object overhead_line {{ name tap_{i}_{j}; phases ABCN; from node_{i}; to load_{i}_{j}; length 100 ft; configuration lc300; }}")
+        print(f"object load {{ name load_{i}_{j}; phases ABCN; nominal_voltage 7199.558; constant_power_A 10000+3000j; constant_power_B 10000+3000j; constant_power_C 10000+3000j; }}")
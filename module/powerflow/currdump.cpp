@@ -54,6 +54,11 @@ currdump::currdump(MODULE *mod)
 			PT_int32, "version", PADDR(version),
 				PT_DEFAULT, "0",
 				PT_DESCRIPTION, "dump format version",
+			PT_enumeration, "format", PADDR(format),
+				PT_DEFAULT, "CSV",
+				PT_DESCRIPTION, "output file format",
+				PT_KEYWORD, "CSV", (enumeration)CDF_CSV,
+				PT_KEYWORD, "BINARY", (enumeration)CDF_BINARY,
 			NULL)<1) GL_THROW("unable to publish properties in %s",__FILE__);
 		
 	}
@@ -70,11 +75,18 @@ int currdump::create(void)
 	strcpy(filemode,"w");
 	maxcount = 1;
 	version = 0;
+	format = CDF_CSV;
+	link_list = NULL;
+	link_count = 0;
+	outfile = NULL;
 	return 1;
 }
 
 int currdump::init(OBJECT *parent)
 {
+	FINDLIST *links = NULL;
+	OBJECT *obj = NULL;
+
 	unlink(filename);
 	if ( interval < 0 )
 	{
@@ -112,6 +124,34 @@ int currdump::init(OBJECT *parent)
 	{
 		version = 2;
 	}
+
+	// resolve the link list once - the model's links don't change after load
+	if ( group[0] == 0 )
+	{
+		links = gl_find_objects(FL_NEW,FT_MODULE,SAME,"powerflow",FT_END);
+	}
+	else
+	{
+		links = gl_find_objects(FL_NEW,FT_MODULE,SAME,"powerflow",AND,FT_GROUPID,SAME,group.get_string(),FT_END);
+	}
+	if ( links != NULL )
+	{
+		link_list = (OBJECT**)gl_malloc((links->hit_count+1)*sizeof(OBJECT*));
+		if ( link_list == NULL )
+		{
+			gl_error("currdump unable to allocate the link list");
+			gl_free(links);
+			return 0;
+		}
+		while ( (obj=gl_find_next(links,obj)) != NULL )
+		{
+			if ( gl_object_isa(obj, "link", "powerflow") )
+			{
+				link_list[link_count++] = obj;
+			}
+		}
+		gl_free(links);
+	}
 	return 1;
 }
 
@@ -123,68 +163,71 @@ int currdump::isa(char *classname)
 void currdump::dump(TIMESTAMP t)
 {
 	char timestr[64];
-	FINDLIST *links = NULL;
 	OBJECT *obj = NULL;
-	FILE *outfile = NULL;
 	link_object *plink;
+	int n;
 
-	if ( group[0] == 0 )
-	{
-		links = gl_find_objects(FL_NEW,FT_MODULE,SAME,"powerflow",FT_END);
-	} 
-	else 
-	{
-		links = gl_find_objects(FL_NEW,FT_MODULE,SAME,"powerflow",AND,FT_GROUPID,SAME,group.get_string(),FT_END);
-	}
-
-	if ( links == NULL )
+	if ( link_list == NULL )
 	{
 		warning("no links were found to dump");
 		return;
 	}
 
-	if ( strcmp(filemode,"a") == 0 ) 
-	{
-		verbose("voltdump is appending data to %s",filename.get_string());
-	}
-
-	outfile = fopen(filename, filemode);
-	if ( outfile == NULL )
+	if ( ! open_file() )
 	{
-		gl_error("currdump unable to open %s for output", filename.get_string());
 		return;
 	}
 
-	int link_count = 0;
-	while ( (obj=gl_find_next(links, obj)) != NULL )
-	{
-		if(gl_object_isa(obj, "link", "powerflow")){
-			++link_count;
-		}
-	}
-	/* print column names */
 	gl_printtime(t, timestr, 64);
-	if ( version < 2 )
+	if ( format == CDF_BINARY )
 	{
-		fprintf(outfile,"# %s run at %s on %i links\nlink_name,", filename.get_string(), timestr, link_count);
+		/* binary record: timestamp, count, then 6 doubles per link */
+		int64 timestamp = (int64)t;
+		int32 count = link_count;
+		double values[6];
+		fwrite(&timestamp,sizeof(timestamp),1,outfile);
+		fwrite(&count,sizeof(count),1,outfile);
+		for ( n = 0 ; n < link_count ; n++ )
+		{
+			plink = OBJECTDATA(link_list[n],link_object);
+			for ( int k = 0 ; k < 3 ; k++ )
+			{
+				if ( mode == CDM_POLAR )
+				{
+					values[2*k] = plink->read_I_in[k].Mag();
+					values[2*k+1] = plink->read_I_in[k].Arg();
+				}
+				else
+				{
+					values[2*k] = plink->read_I_in[k].Re();
+					values[2*k+1] = plink->read_I_in[k].Im();
+				}
+			}
+			fwrite(values,sizeof(double),6,outfile);
+		}
 	}
 	else
 	{
-		fprintf(outfile,"link_name,datetime,");
-	}
-	if ( mode == CDM_RECT )
-	{
-		fprintf(outfile,"currA_real,currA_imag,currB_real,currB_imag,currC_real,currC_imag\n");
-	}
-	else if ( mode == CDM_POLAR )
-	{
-		fprintf(outfile,"currA_mag,currA_angle,currB_mag,currB_angle,currC_mag,currC_angle\n");
-	}
-	obj = 0;
-	while ( (obj=gl_find_next(links,obj)) != NULL )
-	{
-		if ( gl_object_isa(obj, "link", "powerflow") )
+		/* print column names */
+		if ( version < 2 )
 		{
+			fprintf(outfile,"# %s run at %s on %i links\nlink_name,", filename.get_string(), timestr, link_count);
+		}
+		else
+		{
+			fprintf(outfile,"link_name,datetime,");
+		}
+		if ( mode == CDM_RECT )
+		{
+			fprintf(outfile,"currA_real,currA_imag,currB_real,currB_imag,currC_real,currC_imag\n");
+		}
+		else if ( mode == CDM_POLAR )
+		{
+			fprintf(outfile,"currA_mag,currA_angle,currB_mag,currB_angle,currC_mag,currC_angle\n");
+		}
+		for ( n = 0 ; n < link_count ; n++ )
+		{
+			obj = link_list[n];
 			plink = OBJECTDATA(obj,link_object);
 			if ( obj->name == NULL ) 
 			{
@@ -208,7 +251,72 @@ void currdump::dump(TIMESTAMP t)
 			}
 		}
 	}
-	fclose(outfile);
+
+	/* append mode keeps the file open for the next dump */
+	if ( strcmp(filemode,"a") == 0 )
+	{
+		fflush(outfile);
+	}
+	else
+	{
+		fclose(outfile);
+		outfile = NULL;
+	}
+}
+
+bool currdump::open_file(void)
+{
+	if ( outfile != NULL )
+	{
+		return true;
+	}
+	if ( strcmp(filemode,"a") == 0 )
+	{
+		verbose("currdump is appending data to %s",filename.get_string());
+	}
+	outfile = fopen(filename, filemode);
+	if ( outfile == NULL )
+	{
+		gl_error("currdump unable to open %s for output", filename.get_string());
+		return false;
+	}
+	if ( format == CDF_BINARY )
+	{
+		write_binary_header();
+	}
+	return true;
+}
+
+void currdump::write_binary_header(void)
+{
+	/* binary header: magic, format version, mode, count, then the null-terminated link names */
+	char name[1024];
+	int32 header[3] = {1, (int32)mode, link_count};
+	fwrite("CURRDUMP",1,8,outfile);
+	fwrite(header,sizeof(int32),3,outfile);
+	for ( int n = 0 ; n < link_count ; n++ )
+	{
+		OBJECT *obj = link_list[n];
+		if ( obj->name == NULL )
+		{
+			snprintf(name,sizeof(name),"%s:%i", obj->oclass->name, obj->id);
+		}
+		else
+		{
+			snprintf(name,sizeof(name),"%s", obj->name);
+		}
+		fwrite(name,1,strlen(name)+1,outfile);
+	}
+}
+
+int currdump::finalize(void)
+{
+	if ( outfile != NULL )
+	{
+		fclose(outfile);
+		outfile = NULL;
+	}
+	return 1;
 }
 
 TIMESTAMP currdump::commit(TIMESTAMP t){
@@ -296,6 +404,15 @@ EXPORT TIMESTAMP commit_currdump(OBJECT *obj, TIMESTAMP t1, TIMESTAMP t2){
 	}
 }
 
+EXPORT int finalize_currdump(OBJECT *obj)
+{
+	try {
+		currdump *my = OBJECTDATA(obj,currdump);
+		return my->finalize();
+	}
+	I_CATCHALL(finalize,currdump);
+}
+
 EXPORT int isa_currdump(OBJECT *obj, char *classname)
 {
 	return OBJECTDATA(obj,currdump)->isa(classname);
@@ -13,6 +13,11 @@ typedef enum {
 	CDM_POLAR
 } CDMODE;
 
+typedef enum {
+	CDF_CSV,
+	CDF_BINARY
+} CDFORMAT;
+
 class currdump : public gld_object
 {
 public:
@@ -25,6 +30,13 @@ public:
 	int32 maxcount;
 	char8 filemode;
 	int32 version;
+	enumeration format;		///< output file format (csv or binary)
+private:
+	OBJECT **link_list;		///< links to dump, resolved at init
+	int link_count;
+	FILE *outfile;			///< output file, kept open between dumps in append mode
+	bool open_file(void);
+	void write_binary_header(void);
 public:
 	static CLASS *oclass;
 public:
@@ -34,6 +46,8 @@ public:
 	TIMESTAMP commit(TIMESTAMP t);
 	int isa(char *classname);
 
+	int finalize(void);
+
 	void dump(TIMESTAMP t);
 };
 
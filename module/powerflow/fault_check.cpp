@@ -74,6 +74,25 @@ int fault_check::create(void)
 
 	force_reassociation = false;	//By default, don't need to reassociate
 
+	search_stack = NULL;		//Search stack is allocated on the first topology search
+	search_stack_index = NULL;
+	search_queued = NULL;
+	search_stack_size = 0;
+
+	islands_valid = false;		//Island tracking is set up by the first full grid association
+	island_count = 0;
+	island_link_state = NULL;
+	island_entry = NULL;
+	island_entry_of = NULL;
+	island_size = NULL;
+	island_hint = NULL;
+	island_dirty = NULL;
+	island_sources = NULL;
+	island_source_state = NULL;
+	island_source_count = 0;
+	island_changes = NULL;
+	island_anchors = NULL;
+
 	return result;
 }
 
@@ -409,172 +428,124 @@ void fault_check::search_links(int node_int)
 	int branch_val = 0;
 	BRANCHDATA temp_branch;
 	unsigned char work_phases;
+	unsigned int stack_top;
 
-	//Loop through the connectivity and populate appropriately
-	for (index=0; index<NR_busdata[node_int].Link_Table_Size; index++)	//parse through our connected link
-	{
-		temp_branch = NR_branchdata[NR_busdata[node_int].Link_Table[index]];	//Get connecting link information
+	//Make sure the work stack is available
+	allocate_search_stack();
+
+	//Traverse with an explicit stack instead of recursing - keeps large radial systems from running out of call stack
+	//Each push newly supports at least one phase of a node, so the stack never exceeds 3 entries per bus
+	search_stack[0] = node_int;
+	stack_top = 1;
 
-		proceed_in = false;			//Flag that we need to go the next link in
+	while (stack_top > 0)
+	{
+		//Pull the next node off the stack
+		node_int = search_stack[--stack_top];
 
-		//Check for no phase or open condition
-		if (((temp_branch.phases & 0x07) != 0x00) && (*temp_branch.status == LS_CLOSED))
+		//Loop through the connectivity and populate appropriately
+		for (index=0; index<NR_busdata[node_int].Link_Table_Size; index++)	//parse through our connected link
 		{
-			for (indexb=0; indexb<3; indexb++)	//Handle phases
-			{
-				work_phases = 0x04 >> indexb;	//Pull off the phase reference
+			temp_branch = NR_branchdata[NR_busdata[node_int].Link_Table[index]];	//Get connecting link information
 
-				if ((temp_branch.phases & work_phases) == work_phases)	//We are of the proper phase
+			proceed_in = false;			//Flag that we need to go the next link in
+
+			//Check for no phase or open condition
+			if (((temp_branch.phases & 0x07) != 0x00) && (*temp_branch.status == LS_CLOSED))
+			{
+				for (indexb=0; indexb<3; indexb++)	//Handle phases
 				{
-					both_handled = false;	//Reset flag
+					work_phases = 0x04 >> indexb;	//Pull off the phase reference
 
-					//See which end we are, and if the other end has been handled
-					if (temp_branch.from == node_int)	//We're the from
+					if ((temp_branch.phases & work_phases) == work_phases)	//We are of the proper phase
 					{
-						from_val = true;	//Flag us as the from end (so we don't have to check it again later)
-					}
-					else	//Must be the to
-					{
-						from_val = false;	//Flag us as the to end (so we don't have to check it again later)
-					}
-
-					//See if both sides of this link are already set - if so, don't bother going back in
-					if ((Supported_Nodes[temp_branch.to][indexb]==1) && (Supported_Nodes[temp_branch.from][indexb]==1))
-						both_handled=true;
+						both_handled = false;	//Reset flag
 
-					//If not handled, proceed with logic-ness
-					if (both_handled==false)
-					{
-						//Figure out the indexing so we can tell what we are
-						if (from_val)	//From end
+						//See which end we are, and if the other end has been handled
+						if (temp_branch.from == node_int)	//We're the from
 						{
-							branch_val = temp_branch.to;
-
-							//See if our FROM end is properly supported (paranoia check)
-							if (Supported_Nodes[temp_branch.from][indexb] == 1)
-							{
-								proceed_in = true;		//Flag to progress when done
-							}
-							else
-							{
-								continue;		//Somehow is checking, but neither of our ends are set - skip us for now
-							}
+							from_val = true;	//Flag us as the from end (so we don't have to check it again later)
 						}
-						else	//To end
+						else	//Must be the to
 						{
-							branch_val = temp_branch.from;
+							from_val = false;	//Flag us as the to end (so we don't have to check it again later)
+						}
 
-							//See if our TO end is properly supported (paranoia check)
-							if (Supported_Nodes[temp_branch.to][indexb] == 1)
+						//See if both sides of this link are already set - if so, don't bother going back in
+						if ((Supported_Nodes[temp_branch.to][indexb]==1) && (Supported_Nodes[temp_branch.from][indexb]==1))
+							both_handled=true;
+
+						//If not handled, proceed with logic-ness
+						if (both_handled==false)
+						{
+							//Figure out the indexing so we can tell what we are
+							if (from_val)	//From end
 							{
-								proceed_in = true;		//Flag to progress when done
+								branch_val = temp_branch.to;
+
+								//See if our FROM end is properly supported (paranoia check)
+								if (Supported_Nodes[temp_branch.from][indexb] == 1)
+								{
+									proceed_in = true;		//Flag to progress when done
+								}
+								else
+								{
+									continue;		//Somehow is checking, but neither of our ends are set - skip us for now
+								}
 							}
-							else
+							else	//To end
 							{
-								continue;		//Somehow is checking, but neither of our ends are set - skip us for now
+								branch_val = temp_branch.from;
+
+								//See if our TO end is properly supported (paranoia check)
+								if (Supported_Nodes[temp_branch.to][indexb] == 1)
+								{
+									proceed_in = true;		//Flag to progress when done
+								}
+								else
+								{
+									continue;		//Somehow is checking, but neither of our ends are set - skip us for now
+								}
 							}
-						}
 
-						//Flag us as connected
-						Supported_Nodes[branch_val][indexb] = 1;
+							//Flag us as connected
+							Supported_Nodes[branch_val][indexb] = 1;
 
-					}//End both not handled (work to be done)
-				}//End are a proper phase
-			}//End phase testloop
+						}//End both not handled (work to be done)
+					}//End are a proper phase
+				}//End phase testloop
 
-			if (proceed_in)
-			{
-				//Recursion!!
-				search_links(branch_val);
-			}
-		}//End has phases test loop
-	}//End link table loop
+				if (proceed_in)
+				{
+					//Push the other end on to be handled next
+					search_stack[stack_top++] = branch_val;
+				}
+			}//End has phases test loop
+		}//End link table loop
+	}//End stack traversal
 }
 
-//Mesh searching function -- checks to see how something was removed
+//Mesh searching function -- propagates source support outward from node_int until nothing changes
 void fault_check::search_links_mesh(int node_int)
 {
-	unsigned int index, device_value, node_value;
+	unsigned int index, device_value, node_value, stack_top;
 	unsigned char temp_phases, temp_compare_phases, result_phases;
 
-	//Check our entry mode -- if grid association mode, do this as a recursion
-	if (grid_association_mode == false)	//Nope, do "normally"
-	{
-		//Loop through our connected nodes
-		for (index=0; index<NR_busdata[node_int].Link_Table_Size; index++)
-		{
-			//Pull link index -- just for readabiiity
-			device_value = NR_busdata[node_int].Link_Table[index];
-
-			//Get our opposite end reference
-			if (node_int == NR_branchdata[device_value].from)
-			{
-				//Extract our index
-				node_value = NR_branchdata[device_value].to;
-			}
-			else	//Must be the TO side, so check from
-			{
-				//Extract our index
-				node_value = NR_branchdata[device_value].from;
-			}
-
-			//Get initial phasing information - the ones that are available
-			if (*NR_branchdata[device_value].status == LS_CLOSED)
-			{
-				temp_phases = NR_branchdata[device_value].phases;
-			}
-			else
-			{
-				temp_phases = 0x00;
-			}
-
-			//See if either end has any valid phases
-			if ((valid_phases[node_int] != 0x00) || (valid_phases[node_value] != 0x00))
-			{
-				//Are we a switch
-				if ((NR_branchdata[device_value].lnk_type == 4) || (NR_branchdata[device_value].lnk_type == 5) || (NR_branchdata[device_value].lnk_type == 6))
-				{
-					if (*NR_branchdata[device_value].status == 1)
-					{
-						temp_phases |= NR_branchdata[device_value].origphases & 0x07;
-					}
-				}
-				else if (NR_branchdata[device_value].lnk_type == 3)	//Fuse
-				{
-					//See if it is "base closed"
-					if (*NR_branchdata[device_value].status == 1)
-					{
-						//In-service -- see which phases are active and create a mask
-						result_phases = (((~NR_branchdata[device_value].faultphases) & 0x07) | 0xF8);
+	//Make sure the work stack is available
+	allocate_search_stack();
 
-						//Mask out the original
-						temp_phases |= NR_branchdata[device_value].origphases & result_phases;
-					}
-					else	//Full open - just ignore it
-					{
-						temp_phases = 0x00;
-					}
-				}
-				else
-				{
-					//Make sure enabled - the copy possible phases
-					if (*NR_branchdata[device_value].status == LS_CLOSED)
-					{
-						temp_phases |= NR_branchdata[device_value].origphases & 0x07;
-					}
-					else
-					{
-						temp_phases = 0x00;
-					}
-				}
-			}
+	//Worklist of nodes whose valid phases changed - only those can change their neighbors, so each pass is linear
+	//in the touched part of the system (rather than a full brute-force sweep), and there is no recursion depth to worry about
+	search_stack[0] = node_int;
+	search_queued[node_int] = 1;
+	stack_top = 1;
 
-			//Populate the phase information
-			valid_phases[node_value] |= (valid_phases[node_int] & temp_phases);
-		}//End of node link table traversion
-	}//End not grid association mode
-	else	//Grid association mode
+	while (stack_top > 0)
 	{
+		//Pull the next node off the worklist
+		node_int = search_stack[--stack_top];
+		search_queued[node_int] = 0;
+
 		//Loop through our connected nodes
 		for (index=0; index<NR_busdata[node_int].Link_Table_Size; index++)
 		{
@@ -644,7 +615,7 @@ void fault_check::search_links_mesh(int node_int)
 				}
 			}
 
-			//Check our "contributions" against the other end - use this to determine recursion
+			//Check our "contributions" against the other end - use this to determine propagation
 			temp_compare_phases = (valid_phases[node_value] | (valid_phases[node_int] & temp_phases));
 
 			//See if it is the same
@@ -653,12 +624,16 @@ void fault_check::search_links_mesh(int node_int)
 				//Populate the phase information - store what we just did (no point doing twice)
 				valid_phases[node_value] = temp_compare_phases;
 
-				//Recurse in, do this node now
-				search_links_mesh(node_value);
+				//Queue this node up to propagate its new phases, if it isn't already waiting
+				if (search_queued[node_value] == 0)
+				{
+					search_queued[node_value] = 1;
+					search_stack[stack_top++] = node_value;
+				}
 			}
 			//Default else -- they match, so don't bother
 		}//End of node link table traversion
-	}//End grid association mode
+	}//End worklist traversal
 }
 
 void fault_check::support_check(int swing_node_int)
@@ -685,26 +660,19 @@ void fault_check::support_check(int swing_node_int)
 //Mesh-capable version of support check -- by default, it doesn't support restoration object
 void fault_check::support_check_mesh(void)
 {
-	unsigned int indexa, indexb;
+	unsigned int indexa;
 
 	//Reset the node status list
 	reset_support_check();
 
-	if (grid_association_mode == false)	//Not needing to do grid association, use normal, inefficient method
+	if (grid_association_mode == false)	//Not needing to do grid association, just propagate from the swing
 	{
 		//Swing node has support - if the phase exists (changed for complete faults)
 		valid_phases[0] = NR_busdata[0].phases & 0x07;
 
 		//Call the node link-erator (node support check) - call it on the swing, the details are handled inside
-		//Supports possibly meshed topology - brute force method
-		for (indexa=0; indexa<NR_bus_count; indexa++)
-		{
-			for (indexb=0; indexb<NR_bus_count; indexb++)
-			{
-				//Call the search link on individual nodes
-				search_links_mesh(indexb);
-			}
-		}
+		//Supports possibly meshed topology - propagates until no node picks up any more phases
+		search_links_mesh(0);
 	}
 	else	//Grid association mode, do slightly different
 	{
@@ -1271,7 +1239,7 @@ void fault_check::support_check_alterations(int baselink_int, bool rest_mode)
 	//Default else -- no output (none desired, or in restoration calls)
 }
 
-//Recursive function to traverse powerflow and alter phases as necessary
+//Function to traverse powerflow and alter phases as necessary
 //Checks against support found, not an assumed radial traversion (little slower, but more thorough)
 //Based on support_search_links below
 void fault_check::support_search_links_mesh(void)
@@ -1527,7 +1495,7 @@ void fault_check::special_object_alteration_handle(int branch_idx)
 	}//End "normal" reliability operations
 }
 
-//Recursive function to traverse powerflow and alter phases as necessary
+//Depth-first traversal of the powerflow to alter phases as necessary
 //Based on search_links code from above
 void fault_check::support_search_links(int node_int, int node_start, bool impact_mode)
 {
@@ -1536,10 +1504,34 @@ void fault_check::support_search_links(int node_int, int node_start, bool impact
 	int branch_val;
 	BRANCHDATA temp_branch;
 	unsigned char work_phases, phase_restrictions;
+	unsigned int stack_top;
+
+	//Make sure the work stack is available
+	allocate_search_stack();
 
-	//Loop through the connectivity and populate appropriately
-	for (index=0; index<NR_busdata[node_int].Link_Table_Size; index++)	//parse through our connected link
+	//Depth-first with an explicit stack of (node, link table position) frames - same order of alterations as
+	//descending into each node as it is reached, but without the call stack depth on large systems
+	//Each descent flags a new node in Alteration_Nodes, so the stack never exceeds the bus count
+	search_stack[0] = node_int;
+	search_stack_index[0] = 0;
+	stack_top = 1;
+
+	while (stack_top > 0)
 	{
+		//Pull the current frame
+		node_int = search_stack[stack_top-1];
+		index = search_stack_index[stack_top-1];
+
+		//See if this node's links are done - if so, back out to where we came from
+		if (index >= NR_busdata[node_int].Link_Table_Size)
+		{
+			stack_top--;
+			continue;
+		}
+
+		//Move this frame to the next link, for when we come back to it
+		search_stack_index[stack_top-1] = index + 1;
+
 		temp_branch = NR_branchdata[NR_busdata[node_int].Link_Table[index]];	//Get connecting link information
 
 		both_handled = false;	//Reset flag
@@ -1787,10 +1779,12 @@ void fault_check::support_search_links(int node_int, int node_start, bool impact
 			//Flag us as handled
 			Alteration_Nodes[branch_val] = 1;
 
-			//Recursion!!
-			support_search_links(branch_val,node_start,impact_mode);
+			//Descend into the other end next - we'll pick back up with our next link when it is done
+			search_stack[stack_top] = branch_val;
+			search_stack_index[stack_top] = 0;
+			stack_top++;
 		}//End both not handled (work to be done)
-	}//End link table loop
+	}//End frame traversal
 }
 
 //Function to reset "touched" alteration variable
@@ -1908,62 +1902,125 @@ void fault_check::allocate_alterations_values(bool reliability_mode_bool)
 	}//End allocations actually needed
 }
 
-//Function to progress downwards and flag momentary interruptions
-void fault_check::momentary_activation(int node_int)
+//Allocates the work arrays for the iterative topology searches
+void fault_check::allocate_search_stack(void)
 {
-	unsigned int index;
-	OBJECT *tmp_obj;
-	bool *momentary_flag;
-	PROPERTY *pval;
+	unsigned int index, stack_size;
+
+	//Only need to do this once - the bus count doesn't change after NR initializes
+	if (search_stack != NULL)
+		return;
+
+	//Each bus can show up once per phase in the radial search, plus the starting point
+	stack_size = 3*NR_bus_count + 1;
 
-	//See if we are a meter or triplex meter
-	tmp_obj = NR_busdata[node_int].obj;
+	search_stack = (int *)gl_malloc(stack_size*sizeof(int));
+	search_stack_index = (unsigned int *)gl_malloc(stack_size*sizeof(unsigned int));
+	search_queued = (char *)gl_malloc(NR_bus_count*sizeof(char));
 
 	//Make sure it worked
-	if (tmp_obj == NULL)
+	if ((search_stack == NULL) || (search_stack_index == NULL) || (search_queued == NULL))
 	{
-		GL_THROW("Failed to map node:%s during momentary interruption!",NR_busdata[node_int].name);
+		GL_THROW("fault_check: failed to allocate the topology search stack");
 		/*  TROUBLESHOOT
-		While mapping a node object for the momentary fault inducing process, the node failed to be found.
-		Please try again and ensure the node exists.  If the error persists, please submit your code and a bug
-		report via the trac website.
+		While attempting to allocate the work space used to traverse the system topology, an error was encountered.
+		Please try again.  If the error persists, please submit your code and a bug report via the ticketing system.
 		*/
 	}
 
-	//See if we're a triplex meter or meter
-	if ((gl_object_isa(tmp_obj,"triplex_meter","powerflow")) || (gl_object_isa(tmp_obj,"meter","powerflow")))
+	search_stack_size = stack_size;
+
+	//Nothing is queued yet
+	for (index=0; index<NR_bus_count; index++)
+	{
+		search_queued[index] = 0;
+	}
+}
+
+//Function to progress downwards and flag momentary interruptions
+void fault_check::momentary_activation(int node_int)
+{
+	unsigned int index, queue_head, queue_tail;
+	int node_ref;
+	OBJECT *tmp_obj;
+	bool *momentary_flag;
+	PROPERTY *pval;
+
+	//Make sure the work stack is available
+	allocate_search_stack();
+
+	//Walk everything downstream with a queue, rather than recursing - each node only gets visited once
+	search_stack[0] = node_int;
+	search_queued[node_int] = 1;
+	queue_head = 0;
+	queue_tail = 1;
+
+	while (queue_head < queue_tail)
 	{
-		//Find the momentary interruptions flag and set it!
-		pval = gl_get_property(tmp_obj,"customer_interrupted_secondary");
+		//Pull the next node
+		node_int = search_stack[queue_head++];
+
+		//See if we are a meter or triplex meter
+		tmp_obj = NR_busdata[node_int].obj;
 
 		//Make sure it worked
-		if (pval == NULL)
+		if (tmp_obj == NULL)
 		{
-			GL_THROW("Failed to map momentary outage flag on node:%s",tmp_obj->name);
+			GL_THROW("Failed to map node:%s during momentary interruption!",NR_busdata[node_int].name);
 			/*  TROUBLESHOOT
-			While attempting to map the momentary outage flag on a node, it failed to find said flag.
-			Please try again. If the error persists, please submit your code and a bug report via the
-			trac website.
+			While mapping a node object for the momentary fault inducing process, the node failed to be found.
+			Please try again and ensure the node exists.  If the error persists, please submit your code and a bug
+			report via the trac website.
 			*/
 		}
 
-		//Map it
-		momentary_flag = (bool*)GETADDR(tmp_obj,pval);
+		//See if we're a triplex meter or meter
+		if ((gl_object_isa(tmp_obj,"triplex_meter","powerflow")) || (gl_object_isa(tmp_obj,"meter","powerflow")))
+		{
+			//Find the momentary interruptions flag and set it!
+			pval = gl_get_property(tmp_obj,"customer_interrupted_secondary");
 
-		//Flag it
-		*momentary_flag = true;
-	}
+			//Make sure it worked
+			if (pval == NULL)
+			{
+				GL_THROW("Failed to map momentary outage flag on node:%s",tmp_obj->name);
+				/*  TROUBLESHOOT
+				While attempting to map the momentary outage flag on a node, it failed to find said flag.
+				Please try again. If the error persists, please submit your code and a bug report via the
+				trac website.
+				*/
+			}
 
-	//Loop through the link table
-	for (index=0; index<NR_busdata[node_int].Link_Table_Size; index++)
-	{
-		//See if we're the from end of this link - if so, proceed
-		if (NR_branchdata[NR_busdata[node_int].Link_Table[index]].from == node_int)
+			//Map it
+			momentary_flag = (bool*)GETADDR(tmp_obj,pval);
+
+			//Flag it
+			*momentary_flag = true;
+		}
+
+		//Loop through the link table
+		for (index=0; index<NR_busdata[node_int].Link_Table_Size; index++)
 		{
-			//Recurse our way in!
-			momentary_activation(NR_branchdata[NR_busdata[node_int].Link_Table[index]].to);
+			//See if we're the from end of this link - if so, proceed
+			if (NR_branchdata[NR_busdata[node_int].Link_Table[index]].from == node_int)
+			{
+				node_ref = NR_branchdata[NR_busdata[node_int].Link_Table[index]].to;
+
+				//Queue it up, if it hasn't been already
+				if (search_queued[node_ref] == 0)
+				{
+					search_queued[node_ref] = 1;
+					search_stack[queue_tail++] = node_ref;
+				}
+			}
+			//Defaulted else - must be the to end - we don't care
 		}
-		//Defaulted else - must be the to end - we don't care
+	}//End queue traversal
+
+	//Clear the visited flags for the next search - the queue holds everything we touched
+	for (index=0; index<queue_tail; index++)
+	{
+		search_queued[search_stack[index]] = 0;
 	}
 }
 
@@ -2008,7 +2065,19 @@ void fault_check::associate_grids(void)
 {
 	unsigned int indexval;
 	int grid_counter;
-	STATUS stat_return_val;
+
+	//Switching and other small changes are patched into the last association, rather than redoing the whole system
+	if ((islands_valid == true) && (force_reassociation == false))
+	{
+		if (update_associated_grids() == true)
+		{
+			return;
+		}
+		//Default else -- something it doesn't handle, so do the full association below
+	}
+
+	//Make sure the tracking values exist, so the entry points can be recorded
+	allocate_island_values();
 
 	//Call the reset/allocation routine
 	reset_associated_grid();
@@ -2032,6 +2101,9 @@ void fault_check::associate_grids(void)
 					//Call the associater routine
 					search_associated_grids(indexval,grid_counter);
 
+					//Note where this island was entered
+					island_entry[grid_counter] = indexval;
+
 					//Increment the counter, when we're done
 					grid_counter++;
 				}
@@ -2064,6 +2136,9 @@ void fault_check::associate_grids(void)
 					//Call the associater routine
 					search_associated_grids(indexval,grid_counter);
 
+					//Note where this island was entered
+					island_entry[grid_counter] = indexval;
+
 					//Increment the counter, when we're done
 					grid_counter++;
 				}
@@ -2096,6 +2171,9 @@ void fault_check::associate_grids(void)
 					//Call the associater routine
 					search_associated_grids(indexval,grid_counter);
 
+					//Note where this island was entered
+					island_entry[grid_counter] = indexval;
+
 					//Increment the counter, when we're done
 					grid_counter++;
 				}
@@ -2106,6 +2184,21 @@ void fault_check::associate_grids(void)
 		//Default else, keep going to look for one
 	}
 
+	//Resize the solver's island arrays, if needed
+	update_island_count(grid_counter);
+
+	//Keep this association as the starting point for incremental updates
+	snapshot_associated_grids(grid_counter);
+
+	//Deflag the "force a reassociation" flag
+	force_reassociation = false;
+}
+
+//Updates the multi-island solver arrays and tracker when the island count changes
+void fault_check::update_island_count(int grid_counter)
+{
+	STATUS stat_return_val;
+
 	//See if it is different from the "existing count"
 	if (NR_islands_detected != grid_counter)
 	{
@@ -2147,129 +2240,1149 @@ void fault_check::associate_grids(void)
 		NR_admit_change = true;
 	}
 	//Default else - the size is still fine (no need to update the value
-
-	//Deflag the "force a reassociation" flag
-	force_reassociation = false;
 }
 
 //Multiple grid checking items - the actual crawler
-//This is recursively called
+//Floods one island from node_int using the shared work stack
 void fault_check::search_associated_grids(unsigned int node_int, int grid_counter)
 {
-	unsigned int index;
+	unsigned int index, stack_top;
 	int node_ref;
 
-	//Loop through the connection table for this node
-	for (index=0; index<NR_busdata[node_int].Link_Table_Size; index++)
+	//Make sure the work stack is available
+	allocate_search_stack();
+
+	//Explicit stack, rather than recursion - each node is pushed when it is assigned an island, so at most once
+	search_stack[0] = node_int;
+	stack_top = 1;
+
+	while (stack_top > 0)
 	{
-		//See which end of the link we are
-		if (NR_branchdata[NR_busdata[node_int].Link_Table[index]].from == (int)node_int)	//From end
-		{
-			//Set the node-ref - must be other end
-			node_ref = NR_branchdata[NR_busdata[node_int].Link_Table[index]].to;
-		}
-		else	//Must be the to-end
-		{
-			//Set the node-ref, it must be us
-			node_ref = NR_branchdata[NR_busdata[node_int].Link_Table[index]].from;
-		}
+		//Pull the next node
+		node_int = search_stack[--stack_top];
 
-		//We're theoretically coming from a "powered node", so see if it has any phase alignment to proceed
-		//Only do "in service" items, so go on current phases, not original phases
-		if (((NR_busdata[node_int].phases & 0x07) & (NR_branchdata[NR_busdata[node_int].Link_Table[index]].phases & 0x07)) != 0x00)
+		//Loop through the connection table for this node
+		for (index=0; index<NR_busdata[node_int].Link_Table_Size; index++)
 		{
-			//See if the other side has been handled
-			if (NR_busdata[node_ref].island_number == -1)
+			//See which end of the link we are
+			if (NR_branchdata[NR_busdata[node_int].Link_Table[index]].from == (int)node_int)	//From end
 			{
-				//Set the appropriate side
-				NR_busdata[node_ref].island_number = grid_counter;
-
-				//Also flag us, as the link, to be associated with this island
-				NR_branchdata[NR_busdata[node_int].Link_Table[index]].island_number = grid_counter;
-
-				//Recurse in
-				search_associated_grids(node_ref,grid_counter);
+				//Set the node-ref - must be other end
+				node_ref = NR_branchdata[NR_busdata[node_int].Link_Table[index]].to;
 			}
-			else if (NR_busdata[node_ref].island_number != grid_counter)
+			else	//Must be the to-end
 			{
-				GL_THROW("fault_check: duplicate grid assignment on node %s!",NR_busdata[node_ref].name);
-				/*  TROUBLESHOOT
-				While mapping the associated grid/swing node for a system, a condition was encountered where
-				a node tried to belong to two different systems.  This should not have occurred.  Please submit
-				your code and a bug report via the ticketing system.
-				*/
+				//Set the node-ref, it must be us
+				node_ref = NR_branchdata[NR_busdata[node_int].Link_Table[index]].from;
 			}
-			else if (NR_branchdata[NR_busdata[node_int].Link_Table[index]].island_number != grid_counter)	//This line is unassigned
+
+			//We're theoretically coming from a "powered node", so see if it has any phase alignment to proceed
+			//Only do "in service" items, so go on current phases, not original phases
+			if (((NR_busdata[node_int].phases & 0x07) & (NR_branchdata[NR_busdata[node_int].Link_Table[index]].phases & 0x07)) != 0x00)
 			{
-				//See if it is fully unassigned
-				if (NR_branchdata[NR_busdata[node_int].Link_Table[index]].island_number == -1)
+				//See if the other side has been handled
+				if (NR_busdata[node_ref].island_number == -1)
 				{
-					//Just got missed by the iterations, so associate us (ends already handled, so no need to recurse)
+					//Set the appropriate side
+					NR_busdata[node_ref].island_number = grid_counter;
+
+					//Also flag us, as the link, to be associated with this island
 					NR_branchdata[NR_busdata[node_int].Link_Table[index]].island_number = grid_counter;
+
+					//Push it on to handle its connections
+					search_stack[stack_top++] = node_ref;
 				}
-				else
+				else if (NR_busdata[node_ref].island_number != grid_counter)
 				{
-					//Somehow is associated with a different grid, even though the from/to are the same!
-					GL_THROW("fault_check: invalid grid assignment on line %s!",NR_branchdata[NR_busdata[node_int].Link_Table[index]].name);
+					GL_THROW("fault_check: duplicate grid assignment on node %s!",NR_busdata[node_ref].name);
 					/*  TROUBLESHOOT
-					While mapping the associated grid/swing node for a line in the system, a condition was encountered where
-					the line belonged to a grid/island it shouldn't.  This should not have occurred.  Please submit
+					While mapping the associated grid/swing node for a system, a condition was encountered where
+					a node tried to belong to two different systems.  This should not have occurred.  Please submit
 					your code and a bug report via the ticketing system.
 					*/
 				}
+				else if (NR_branchdata[NR_busdata[node_int].Link_Table[index]].island_number != grid_counter)	//This line is unassigned
+				{
+					//See if it is fully unassigned
+					if (NR_branchdata[NR_busdata[node_int].Link_Table[index]].island_number == -1)
+					{
+						//Just got missed by the iterations, so associate us (ends already handled, so no need to recurse)
+						NR_branchdata[NR_busdata[node_int].Link_Table[index]].island_number = grid_counter;
+					}
+					else
+					{
+						//Somehow is associated with a different grid, even though the from/to are the same!
+						GL_THROW("fault_check: invalid grid assignment on line %s!",NR_branchdata[NR_busdata[node_int].Link_Table[index]].name);
+						/*  TROUBLESHOOT
+						While mapping the associated grid/swing node for a line in the system, a condition was encountered where
+						the line belonged to a grid/island it shouldn't.  This should not have occurred.  Please submit
+						your code and a bug report via the ticketing system.
+						*/
+					}
+				}
+				//Default else -- already handled as this grid
 			}
-			//Default else -- already handled as this grid
+			//Default else, not a match, so next
 		}
-		//Default else, not a match, so next
-	}
+	}//End stack traversal
 }
 
-//Function to remove a divergent island
-STATUS fault_check::disable_island(int island_number)
+//Allocates the values used to track the island association between full passes
+void fault_check::allocate_island_values(void)
 {
-	unsigned int index_value;
-	TIMESTAMP curr_time_val_TS;
-	double curr_time_val_DBL;
-	FILE *FPOutput;
-	DATETIME temp_time;
-	char deltaprint_buffer[64];
-	bool deltamodeflag;
+	//Only need to do this once - the bus and branch counts don't change after NR initializes
+	if (island_entry != NULL)
+		return;
+
+	island_link_state = (unsigned char *)gl_malloc(NR_branch_count*sizeof(unsigned char));
+	island_entry = (int *)gl_malloc(NR_bus_count*sizeof(int));
+	island_entry_of = (int *)gl_malloc(NR_bus_count*sizeof(int));
+	island_size = (int *)gl_malloc(NR_bus_count*sizeof(int));
+	island_hint = (int *)gl_malloc(NR_bus_count*sizeof(int));
+	island_dirty = (char *)gl_malloc(NR_bus_count*sizeof(char));
+	island_sources = (int *)gl_malloc(NR_bus_count*sizeof(int));
+	island_source_state = (unsigned char *)gl_malloc(NR_bus_count*sizeof(unsigned char));
+	island_changes = (int *)gl_malloc(NR_branch_count*sizeof(int));
+	island_anchors = (int *)gl_malloc(NR_bus_count*sizeof(int));
 
-	//Preliminary check - see if we're even in the right mode
-	if (grid_association_mode == false)
+	//Make sure it worked
+	if ((island_link_state == NULL) || (island_entry == NULL) || (island_entry_of == NULL) || (island_size == NULL) || (island_hint == NULL) ||
+		(island_dirty == NULL) || (island_sources == NULL) || (island_source_state == NULL) || (island_changes == NULL) || (island_anchors == NULL))
 	{
-		gl_error("fault_check: an island removal call was made, but grid_association is set to false!");
+		GL_THROW("fault_check: failed to allocate the island tracking arrays");
 		/*  TROUBLESHOOT
-		The powerflow is attempting to run in multi-islanded mode with individual island handling, but
-		fault_check is not set up properly.  Please set `grid_association true;` in the fault_check and
-		try again.
+		While attempting to allocate the arrays used to update the grid association as the system changes, an error was encountered.
+		Please try again.  If the error persists, please submit your code and a bug report via the ticketing system.
 		*/
+	}
 
-		return FAILED;
+	//The searches share the topology work stack
+	allocate_search_stack();
+}
+
+//Records a full association, so later calls only need to look at what changed since
+void fault_check::snapshot_associated_grids(int grid_counter)
+{
+	unsigned int indexval;
+	int island_val;
+
+	island_count = grid_counter;
+	islands_valid = true;
+
+	for (indexval=0; indexval<NR_bus_count; indexval++)
+	{
+		island_entry_of[indexval] = -1;
+		island_size[indexval] = 0;
+		island_dirty[indexval] = 0;
 	}
 
-	//Loop through the buses -- remove if it is in this island (keep SWING functions affected though)
-	for (index_value=0; index_value < NR_bus_count; index_value++)
+	//Count the islands and note their entry points
+	for (indexval=0; indexval<NR_bus_count; indexval++)
 	{
-		//See if we're in the island
-		if (NR_busdata[index_value].island_number == island_number)
+		island_val = NR_busdata[indexval].island_number;
+
+		if (island_val != -1)
 		{
-			//Just trim it off
-			NR_busdata[index_value].phases &= 0xF8;
+			island_size[island_val]++;
+		}
+	}
 
-			//De-associate us too
-			NR_busdata[index_value].island_number = -1;
+	for (island_val=0; island_val<grid_counter; island_val++)
+	{
+		island_entry_of[island_entry[island_val]] = island_val;
+		island_hint[island_val] = island_entry[island_val];
+	}
 
-			//Empty the valid phases property
-			valid_phases[index_value] = 0x00;
+	//Pull the nodes that can start an island - the type and source flag don't change, only the phases
+	island_source_count = 0;
+	for (indexval=0; indexval<NR_bus_count; indexval++)
+	{
+		if ((NR_busdata[indexval].type == 2) || (NR_busdata[indexval].type == 3) || ((*NR_busdata[indexval].busflag & NF_ISSOURCE) == NF_ISSOURCE))
+		{
+			island_source_state[island_source_count] = ((NR_busdata[indexval].phases & 0x07) != 0x00) ? 1 : 0;
+			island_sources[island_source_count++] = indexval;
 		}
-		//Default else -- next bus
 	}
 
-	//Do the same for branches, just so we don't get confused
-	for (index_value=0; index_value < NR_branch_count; index_value++)
+	//And what was conducting
+	for (indexval=0; indexval<NR_branch_count; indexval++)
 	{
-		//Check our association
+		island_link_state[indexval] = island_link_conducting(indexval) ? 1 : 0;
+
+		//A link only one end can cross leaves the association depending on which way the search went - don't build on it
+		if (island_link_one_way(indexval) == true)
+		{
+			islands_valid = false;
+		}
+	}
+}
+
+//See if only one end of a link has phases in common with it -- the full search only crosses a link from an end that does
+bool fault_check::island_link_one_way(int branch_idx)
+{
+	unsigned char link_phases;
+
+	link_phases = NR_branchdata[branch_idx].phases & 0x07;
+
+	return (((NR_busdata[NR_branchdata[branch_idx].from].phases & link_phases) != 0x00) != ((NR_busdata[NR_branchdata[branch_idx].to].phases & link_phases) != 0x00));
+}
+
+//A link joins its ends into one island if it has phases in common with either end
+bool fault_check::island_link_conducting(int branch_idx)
+{
+	unsigned char end_phases;
+
+	end_phases = (NR_busdata[NR_branchdata[branch_idx].from].phases | NR_busdata[NR_branchdata[branch_idx].to].phases) & 0x07;
+
+	return ((NR_branchdata[branch_idx].phases & end_phases & 0x07) != 0x00);
+}
+
+//See if a node has been cut off from everything
+bool fault_check::island_node_isolated(int node_int)
+{
+	unsigned int index;
+
+	for (index=0; index<NR_busdata[node_int].Link_Table_Size; index++)
+	{
+		if (island_link_conducting(NR_busdata[node_int].Link_Table[index]) == true)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//Island a node is in -- an isolated entry leads an island but isn't associated with it (like the full search)
+int fault_check::island_of(int node_int)
+{
+	if (NR_busdata[node_int].island_number != -1)
+	{
+		return NR_busdata[node_int].island_number;
+	}
+	else
+	{
+		return island_entry_of[node_int];
+	}
+}
+
+//See if a node can be the entry into an island -- a source of some form, with phases
+bool fault_check::island_source_capable(int node_int)
+{
+	if ((NR_busdata[node_int].phases & 0x07) == 0x00)
+		return false;
+
+	return ((NR_busdata[node_int].type == 2) || (NR_busdata[node_int].type == 3) || ((*NR_busdata[node_int].busflag & NF_ISSOURCE) == NF_ISSOURCE));
+}
+
+//Order the full association enters islands in - SWING, then SWING_PQ, then source-flagged nodes, each by position
+bool fault_check::island_better_entry(int node_a, int node_b)
+{
+	int rank_a, rank_b;
+
+	if (node_b < 0)
+		return true;
+
+	rank_a = (NR_busdata[node_a].type == 2) ? 0 : ((NR_busdata[node_a].type == 3) ? 1 : 2);
+	rank_b = (NR_busdata[node_b].type == 2) ? 0 : ((NR_busdata[node_b].type == 3) ? 1 : 2);
+
+	if (rank_a != rank_b)
+		return (rank_a < rank_b);
+	else
+		return (node_a < node_b);
+}
+
+//Patches the last association for the links and sources that changed since it was made
+//A link that closes joins the islands on its ends.  A link that opens searches from both of its ends at once, so it
+//only covers the smaller side when the island splits (or the part between the ends when it doesn't), and anything
+//left without a source is dropped.  Returns false if the change needs a full association.
+bool fault_check::update_associated_grids(void)
+{
+	unsigned int indexval, link_index, removed_count, added_count, anchor_count, count_a, count_b;
+	int node_a, node_b, branch_val, island_val, last_island, best_node, source_node, search_result, moved_count;
+	bool any_change, state_val;
+
+	removed_count = 0;
+	added_count = 0;
+
+	//Find the links whose state changed
+	for (indexval=0; indexval<NR_branch_count; indexval++)
+	{
+		//Which way the full search would have crossed this one matters, so leave it to the full association
+		if (island_link_one_way(indexval) == true)
+		{
+			return false;
+		}
+
+		state_val = island_link_conducting(indexval);
+
+		if (state_val != (island_link_state[indexval] == 1))
+		{
+			if (state_val == false)
+			{
+				island_changes[removed_count++] = indexval;
+			}
+			else
+			{
+				island_changes[NR_branch_count - 1 - added_count++] = indexval;
+			}
+		}
+	}
+
+	//See if any of the sources changed
+	any_change = ((removed_count + added_count) != 0);
+	for (indexval=0; indexval<(unsigned int)island_source_count; indexval++)
+	{
+		if (island_source_state[indexval] != (((NR_busdata[island_sources[indexval]].phases & 0x07) != 0x00) ? 1 : 0))
+		{
+			any_change = true;
+			break;
+		}
+	}
+
+	//Nothing to do
+	if (any_change == false)
+	{
+		return true;
+	}
+
+	for (island_val=0; island_val<island_count; island_val++)
+	{
+		island_dirty[island_val] = 0;
+	}
+
+	//Opened links first - they no longer belong to anything
+	for (indexval=0; indexval<removed_count; indexval++)
+	{
+		NR_branchdata[island_changes[indexval]].island_number = -1;
+	}
+
+	//Nodes that lost all of their links (e.g., de-energized sections) just leave their islands
+	anchor_count = 0;
+	for (indexval=0; indexval<removed_count; indexval++)
+	{
+		node_a = NR_branchdata[island_changes[indexval]].from;
+		node_b = NR_branchdata[island_changes[indexval]].to;
+
+		if ((NR_busdata[node_a].island_number != -1) && (island_node_isolated(node_a) == true))
+		{
+			if (island_remove_isolated(node_a,&anchor_count) == false)
+				return false;
+		}
+
+		if ((NR_busdata[node_b].island_number != -1) && (island_node_isolated(node_b) == true))
+		{
+			if (island_remove_isolated(node_b,&anchor_count) == false)
+				return false;
+		}
+	}
+
+	//Remaining openings -- see if the ends are still connected
+	for (indexval=0; indexval<removed_count; indexval++)
+	{
+		node_a = NR_branchdata[island_changes[indexval]].from;
+		node_b = NR_branchdata[island_changes[indexval]].to;
+		island_val = NR_busdata[node_a].island_number;
+
+		//One end already left -- the other may have been cut off from the rest of its island with it
+		if ((island_val == -1) || (NR_busdata[node_b].island_number == -1))
+		{
+			if ((island_val != -1) || (NR_busdata[node_b].island_number != -1))
+			{
+				if (anchor_count >= NR_bus_count)
+					return false;
+
+				island_anchors[anchor_count++] = (island_val != -1) ? node_a : node_b;
+			}
+
+			continue;
+		}
+
+		//Split apart by an earlier search -- each end still needs to be checked against the rest of its island
+		if (island_val != NR_busdata[node_b].island_number)
+		{
+			if ((anchor_count + 2) > NR_bus_count)
+				return false;
+
+			island_anchors[anchor_count++] = node_a;
+			island_anchors[anchor_count++] = node_b;
+			continue;
+		}
+
+		search_result = island_search(node_a,node_b,&count_a,&count_b);
+		island_search_clear(count_a,count_b);
+
+		if (search_result == 0)	//Still connected
+			continue;
+
+		if (search_result == 1)
+		{
+			if (island_split_off(1,count_a,island_val,node_b) == false)
+				return false;
+
+			node_a = node_b;	//Kept side
+		}
+		else
+		{
+			if (island_split_off(2,count_b,island_val,node_a) == false)
+				return false;
+		}
+
+		if (anchor_count >= NR_bus_count)
+			return false;
+
+		island_anchors[anchor_count++] = node_a;
+	}
+
+	//With more than one split in an island, the kept sides must also still reach each other
+	if (anchor_count > 1)
+	{
+		for (island_val=0; island_val<island_count; island_val++)
+		{
+			island_hint[island_val] = -1;
+		}
+
+		for (indexval=0; indexval<anchor_count; indexval++)
+		{
+			node_b = island_anchors[indexval];
+			island_val = NR_busdata[node_b].island_number;
+
+			if (island_val == -1)
+				continue;
+
+			node_a = island_hint[island_val];
+
+			//First one in this island
+			if ((node_a == -1) || (NR_busdata[node_a].island_number != island_val))
+			{
+				island_hint[island_val] = node_b;
+				continue;
+			}
+
+			search_result = island_search(node_a,node_b,&count_a,&count_b);
+			island_search_clear(count_a,count_b);
+
+			if (search_result == 1)
+			{
+				if (island_split_off(1,count_a,island_val,node_b) == false)
+					return false;
+
+				island_hint[island_val] = node_b;
+			}
+			else if (search_result == 2)
+			{
+				if (island_split_off(2,count_b,island_val,node_a) == false)
+					return false;
+			}
+			//Default else -- still connected
+		}
+
+		//Islands without a kept node can still be found from their entry
+		for (island_val=0; island_val<island_count; island_val++)
+		{
+			if ((island_hint[island_val] == -1) && (island_entry[island_val] != -1))
+			{
+				island_hint[island_val] = island_entry[island_val];
+			}
+		}
+	}
+
+	//Sources that lost their phases can't lead an island anymore
+	for (indexval=0; indexval<(unsigned int)island_source_count; indexval++)
+	{
+		source_node = island_sources[indexval];
+
+		if ((island_source_state[indexval] == 1) && ((NR_busdata[source_node].phases & 0x07) == 0x00))
+		{
+			island_val = island_entry_of[source_node];
+
+			if (island_val != -1)
+			{
+				island_entry[island_val] = -1;
+				island_entry_of[source_node] = -1;
+				island_dirty[island_val] = 1;
+
+				//Still a way into the rest of the island
+				if (NR_busdata[source_node].island_number == island_val)
+				{
+					island_hint[island_val] = source_node;
+				}
+			}
+		}
+	}
+
+	//Islands that lost their entry -- pick the next source in them, or drop the island
+	for (island_val=0; island_val<island_count; island_val++)
+	{
+		if ((island_dirty[island_val] == 0) || (island_entry[island_val] != -1))
+			continue;
+
+		best_node = -1;
+		for (indexval=0; indexval<(unsigned int)island_source_count; indexval++)
+		{
+			source_node = island_sources[indexval];
+
+			if ((NR_busdata[source_node].island_number == island_val) && (island_source_capable(source_node) == true) && (island_better_entry(source_node,best_node) == true))
+			{
+				best_node = source_node;
+			}
+		}
+
+		if (best_node != -1)
+		{
+			island_entry[island_val] = best_node;
+			island_entry_of[best_node] = island_val;
+		}
+		else if (island_size[island_val] > 0)	//Nothing left to drive it
+		{
+			node_a = island_hint[island_val];
+
+			if ((node_a == -1) || (NR_busdata[node_a].island_number != island_val))
+				return false;
+
+			island_size[island_val] -= island_relabel(node_a,island_val,-1);
+
+			//Everything should be gone now
+			if (island_size[island_val] != 0)
+				return false;
+		}
+	}
+
+	//Sources that came back -- join the island they are in, or start a new one
+	for (indexval=0; indexval<(unsigned int)island_source_count; indexval++)
+	{
+		source_node = island_sources[indexval];
+
+		if ((island_source_state[indexval] == 1) || ((NR_busdata[source_node].phases & 0x07) == 0x00))
+			continue;
+
+		island_val = island_of(source_node);
+
+		if (island_val != -1)
+		{
+			if (island_better_entry(source_node,island_entry[island_val]) == true)
+			{
+				if (island_entry[island_val] != -1)
+				{
+					island_entry_of[island_entry[island_val]] = -1;
+				}
+
+				island_entry[island_val] = source_node;
+				island_entry_of[source_node] = island_val;
+			}
+		}
+		else	//New island, entered here -- joined with anything it is linked to
+		{
+			if (island_count >= (int)NR_bus_count)
+				return false;
+
+			island_val = island_count++;
+			island_entry[island_val] = source_node;
+			island_entry_of[source_node] = island_val;
+			island_size[island_val] = 0;
+			island_hint[island_val] = source_node;
+			island_dirty[island_val] = 0;
+
+			for (link_index=0; link_index<NR_busdata[source_node].Link_Table_Size; link_index++)
+			{
+				branch_val = NR_busdata[source_node].Link_Table[link_index];
+
+				if (island_link_conducting(branch_val) == true)
+				{
+					node_b = (NR_branchdata[branch_val].from == source_node) ? NR_branchdata[branch_val].to : NR_branchdata[branch_val].from;
+
+					if (island_union(source_node,node_b) == false)
+						return false;
+				}
+			}
+		}
+	}
+
+	//Closed links join the islands on their ends
+	for (indexval=0; indexval<added_count; indexval++)
+	{
+		branch_val = island_changes[NR_branch_count - 1 - indexval];
+
+		if (island_union(NR_branchdata[branch_val].from,NR_branchdata[branch_val].to) == false)
+			return false;
+	}
+
+	//Close up any island numbers that are no longer used - the solver expects them to be contiguous
+	while ((island_count > 0) && (island_entry[island_count-1] == -1))
+	{
+		island_count--;
+	}
+
+	for (island_val=0; island_val<island_count; island_val++)
+	{
+		if (island_entry[island_val] != -1)
+			continue;
+
+		//Move the last island down into this spot
+		last_island = island_count - 1;
+		source_node = island_entry[last_island];
+
+		if (NR_busdata[source_node].island_number == last_island)
+		{
+			moved_count = island_relabel(source_node,last_island,island_val);
+		}
+		else	//Isolated entry, so there is nothing in it
+		{
+			moved_count = 0;
+		}
+
+		if (moved_count != island_size[last_island])
+			return false;
+
+		island_size[island_val] = moved_count;
+		island_size[last_island] = 0;
+		island_entry[island_val] = source_node;
+		island_entry_of[source_node] = island_val;
+		island_entry[last_island] = -1;
+		island_count--;
+
+		//Trim any other unused ones off the end
+		while ((island_count > 0) && (island_entry[island_count-1] == -1))
+		{
+			island_count--;
+		}
+	}
+
+	//SWING_PQ nodes only act as a swing when they are the way into their island
+	for (indexval=0; indexval<(unsigned int)island_source_count; indexval++)
+	{
+		source_node = island_sources[indexval];
+
+		if (NR_busdata[source_node].type == 3)
+		{
+			if (island_entry_of[source_node] != -1)
+			{
+				NR_busdata[source_node].swing_functions_enabled = true;
+				NR_busdata[source_node].swing_topology_entry = true;
+			}
+			else if (NR_busdata[source_node].island_number != -1)
+			{
+				NR_busdata[source_node].swing_functions_enabled = false;
+			}
+			//Default else -- not in anything, leave it be (same as the full association)
+		}
+
+		island_source_state[indexval] = ((NR_busdata[source_node].phases & 0x07) != 0x00) ? 1 : 0;
+	}
+
+	//Update the link states
+	for (indexval=0; indexval<removed_count; indexval++)
+	{
+		island_link_state[island_changes[indexval]] = 0;
+	}
+
+	for (indexval=0; indexval<added_count; indexval++)
+	{
+		island_link_state[island_changes[NR_branch_count - 1 - indexval]] = 1;
+	}
+
+	//Resize the solver's island arrays, if needed
+	update_island_count(island_count);
+
+	return true;
+}
+
+//Searches outward from both ends of an opened link, one node at a time from each side, until a side reaches something
+//the other side found (still connected - returns 0) or runs out of nodes (split - returns 1 or 2 for that side).  Side 1
+//is kept in search_stack[0..count_a), side 2 in search_stack[NR_bus_count..NR_bus_count+count_b), with search_queued
+//holding the side of each node found.  The caller clears the marks.
+int fault_check::island_search(int node_a, int node_b, unsigned int *count_a, unsigned int *count_b)
+{
+	unsigned int done_a, done_b;
+
+	search_stack[0] = node_a;
+	search_queued[node_a] = 1;
+	*count_a = 1;
+	done_a = 0;
+
+	search_stack[NR_bus_count] = node_b;
+	search_queued[node_b] = 2;
+	*count_b = 1;
+	done_b = 0;
+
+	while (true)
+	{
+		if (done_a == *count_a)
+			return 1;
+
+		if (island_search_step(1,&done_a,count_a) == true)
+			return 0;
+
+		if (done_b == *count_b)
+			return 2;
+
+		if (island_search_step(2,&done_b,count_b) == true)
+			return 0;
+	}
+}
+
+bool fault_check::island_search_step(char side, unsigned int *done, unsigned int *count)
+{
+	unsigned int index, offset;
+	int node_int, branch_val, node_ref;
+
+	offset = (side == 1) ? 0 : NR_bus_count;
+	node_int = search_stack[offset + (*done)++];
+
+	for (index=0; index<NR_busdata[node_int].Link_Table_Size; index++)
+	{
+		branch_val = NR_busdata[node_int].Link_Table[index];
+
+		if (island_link_conducting(branch_val) == false)
+			continue;
+
+		node_ref = (NR_branchdata[branch_val].from == node_int) ? NR_branchdata[branch_val].to : NR_branchdata[branch_val].from;
+
+		if (search_queued[node_ref] == 0)
+		{
+			search_queued[node_ref] = side;
+			search_stack[offset + (*count)++] = node_ref;
+		}
+		else if (search_queued[node_ref] != side)
+		{
+			return true;	//Met the other side
+		}
+	}
+
+	return false;
+}
+
+void fault_check::island_search_clear(unsigned int count_a, unsigned int count_b)
+{
+	unsigned int index;
+
+	for (index=0; index<count_a; index++)
+	{
+		search_queued[search_stack[index]] = 0;
+	}
+
+	for (index=0; index<count_b; index++)
+	{
+		search_queued[search_stack[NR_bus_count + index]] = 0;
+	}
+}
+
+//Moves the side of a search that ran out (a complete piece of the old island) into a new island if it has a source,
+//or out of any island if it doesn't.  The rest of the old island keeps its number.  The search marks must already be clear.
+bool fault_check::island_split_off(char side, unsigned int count, int island_number, int remain_node)
+{
+	unsigned int index, offset, link_index;
+	int node_int, best_node, new_island;
+
+	offset = (side == 1) ? 0 : NR_bus_count;
+
+	//Find the best source on this side, and make sure nothing else got mixed in
+	best_node = -1;
+	for (index=0; index<count; index++)
+	{
+		node_int = search_stack[offset + index];
+
+		//Joined to another island by a link that closed at the same time - let the full association sort it out
+		if ((NR_busdata[node_int].island_number != island_number) && (NR_busdata[node_int].island_number != -1))
+			return false;
+
+		if ((island_source_capable(node_int) == true) && (island_better_entry(node_int,best_node) == true))
+		{
+			best_node = node_int;
+		}
+	}
+
+	if (best_node != -1)
+	{
+		if (island_count >= (int)NR_bus_count)
+			return false;
+
+		new_island = island_count++;
+		island_dirty[new_island] = 0;
+
+		//If the old island's entry came along, it has to find a new one
+		if (island_entry_of[best_node] == island_number)
+		{
+			island_entry[island_number] = -1;
+		}
+
+		island_entry[new_island] = best_node;
+		island_entry_of[best_node] = new_island;
+		island_size[new_island] = 0;
+		island_hint[new_island] = best_node;
+	}
+	else
+	{
+		new_island = -1;
+	}
+
+	//Move the nodes over
+	for (index=0; index<count; index++)
+	{
+		node_int = search_stack[offset + index];
+
+		if (NR_busdata[node_int].island_number == island_number)
+		{
+			island_size[island_number]--;
+		}
+
+		NR_busdata[node_int].island_number = new_island;
+
+		if (new_island != -1)
+		{
+			island_size[new_island]++;
+		}
+
+		for (link_index=0; link_index<NR_busdata[node_int].Link_Table_Size; link_index++)
+		{
+			if (island_link_conducting(NR_busdata[node_int].Link_Table[link_index]) == true)
+			{
+				NR_branchdata[NR_busdata[node_int].Link_Table[link_index]].island_number = new_island;
+			}
+		}
+	}
+
+	//The old island keeps the other side
+	island_dirty[island_number] = 1;
+	island_hint[island_number] = remain_node;
+
+	return true;
+}
+
+//Removes a node that has lost all of its links from its island, along with any neighbors (through the links that just
+//opened) that were cut off the same way.  If that group sat between more than one remaining node, those nodes are added
+//as anchors so they can be checked against each other afterwards.
+bool fault_check::island_remove_isolated(int node_int, unsigned int *anchor_count)
+{
+	unsigned int index, group_count, boundary_count, link_index;
+	int branch_val, node_ref, island_number;
+	bool group_ok;
+
+	island_number = NR_busdata[node_int].island_number;
+
+	//Group of isolated nodes in search_stack[0..), boundary nodes in search_stack[NR_bus_count..)
+	search_stack[0] = node_int;
+	search_queued[node_int] = 3;
+	group_count = 1;
+	boundary_count = 0;
+	group_ok = true;
+
+	for (index=0; index<group_count; index++)
+	{
+		node_int = search_stack[index];
+
+		//An isolated source would lead its own (empty) island - leave that to the full association
+		if (island_source_capable(node_int) == true)
+		{
+			group_ok = false;
+			break;
+		}
+
+		for (link_index=0; link_index<NR_busdata[node_int].Link_Table_Size; link_index++)
+		{
+			branch_val = NR_busdata[node_int].Link_Table[link_index];
+
+			//Only links that used to join us to something
+			if (island_link_state[branch_val] == 0)
+				continue;
+
+			node_ref = (NR_branchdata[branch_val].from == node_int) ? NR_branchdata[branch_val].to : NR_branchdata[branch_val].from;
+
+			if ((search_queued[node_ref] != 0) || (NR_busdata[node_ref].island_number != island_number))
+				continue;
+
+			if (island_node_isolated(node_ref) == true)
+			{
+				search_queued[node_ref] = 3;
+				search_stack[group_count++] = node_ref;
+			}
+			else
+			{
+				search_queued[node_ref] = 4;
+				search_stack[NR_bus_count + boundary_count++] = node_ref;
+			}
+		}
+	}
+
+	//Clear the marks
+	island_search_clear(group_count,boundary_count);
+
+	if (group_ok == false)
+		return false;
+
+	//Drop the group
+	for (index=0; index<group_count; index++)
+	{
+		NR_busdata[search_stack[index]].island_number = -1;
+		island_size[island_number]--;
+	}
+
+	//A group hanging off of a single node can't have split anything
+	if (boundary_count > 1)
+	{
+		if ((*anchor_count + boundary_count) > NR_bus_count)
+			return false;
+
+		for (index=0; index<boundary_count; index++)
+		{
+			island_anchors[(*anchor_count)++] = search_stack[NR_bus_count + index];
+		}
+	}
+
+	island_dirty[island_number] = 1;
+
+	return true;
+}
+
+//Floods target_island out from node_int through everything that isn't already in it, merging any islands it runs into
+bool fault_check::island_merge(int node_int, int target_island)
+{
+	unsigned int index, stack_top;
+	int branch_val, node_ref, island_val;
+
+	//Take the starting node
+	island_val = island_of(node_int);
+	if (island_val != -1)
+	{
+		if (NR_busdata[node_int].island_number == island_val)
+			island_size[island_val]--;
+
+		island_dirty[island_val] = 2;
+	}
+	NR_busdata[node_int].island_number = target_island;
+	island_size[target_island]++;
+
+	search_stack[0] = node_int;
+	stack_top = 1;
+
+	while (stack_top > 0)
+	{
+		node_int = search_stack[--stack_top];
+
+		for (index=0; index<NR_busdata[node_int].Link_Table_Size; index++)
+		{
+			branch_val = NR_busdata[node_int].Link_Table[index];
+
+			if (island_link_conducting(branch_val) == false)
+				continue;
+
+			NR_branchdata[branch_val].island_number = target_island;
+
+			node_ref = (NR_branchdata[branch_val].from == node_int) ? NR_branchdata[branch_val].to : NR_branchdata[branch_val].from;
+
+			if (NR_busdata[node_ref].island_number == target_island)
+				continue;
+
+			island_val = island_of(node_ref);
+			if (island_val == target_island)	//Isolated entry of this island
+			{
+				NR_busdata[node_ref].island_number = target_island;
+				island_size[target_island]++;
+				continue;
+			}
+
+			if (island_val != -1)
+			{
+				if (NR_busdata[node_ref].island_number == island_val)
+					island_size[island_val]--;
+
+				island_dirty[island_val] = 2;
+			}
+
+			NR_busdata[node_ref].island_number = target_island;
+			island_size[target_island]++;
+			search_stack[stack_top++] = node_ref;
+		}
+	}
+
+	//Retire the islands that were merged in, keeping the better entry
+	for (island_val=0; island_val<island_count; island_val++)
+	{
+		if ((island_dirty[island_val] != 2) || (island_val == target_island))
+			continue;
+
+		island_dirty[island_val] = 0;
+
+		//Everything should have come along
+		if (island_size[island_val] != 0)
+			return false;
+
+		node_ref = island_entry[island_val];
+		if (node_ref != -1)
+		{
+			island_entry_of[node_ref] = -1;
+
+			if (island_better_entry(node_ref,island_entry[target_island]) == true)
+			{
+				if (island_entry[target_island] != -1)
+				{
+					island_entry_of[island_entry[target_island]] = -1;
+				}
+
+				island_entry[target_island] = node_ref;
+				island_entry_of[node_ref] = target_island;
+			}
+		}
+
+		island_entry[island_val] = -1;
+	}
+
+	return true;
+}
+
+//Joins the islands on either end of a link that started conducting
+bool fault_check::island_union(int node_a, int node_b)
+{
+	unsigned int index;
+	int island_a, island_b, target_island, start_node, kept_node, branch_val;
+
+	island_a = island_of(node_a);
+	island_b = island_of(node_b);
+
+	//Neither end is in anything yet - another link (or nothing) will pick them up
+	if ((island_a == -1) && (island_b == -1))
+		return true;
+
+	//Pick the island to keep - the one already there, or the bigger one
+	if (island_a == -1)
+		target_island = island_b;
+	else if (island_b == -1)
+		target_island = island_a;
+	else if (island_size[island_a] > island_size[island_b])
+		target_island = island_a;
+	else if (island_size[island_b] > island_size[island_a])
+		target_island = island_b;
+	else
+		target_island = (island_a < island_b) ? island_a : island_b;
+
+	if (target_island == island_a)
+	{
+		kept_node = node_a;
+		start_node = node_b;
+	}
+	else
+	{
+		kept_node = node_b;
+		start_node = node_a;
+	}
+
+	//An isolated entry that just picked up a link joins its own island
+	if (NR_busdata[kept_node].island_number == -1)
+	{
+		NR_busdata[kept_node].island_number = target_island;
+		island_size[target_island]++;
+	}
+
+	//Same island already (a loop closing) - just pick up the link
+	if (island_a == island_b)
+	{
+		if (NR_busdata[start_node].island_number == -1)
+		{
+			NR_busdata[start_node].island_number = target_island;
+			island_size[target_island]++;
+		}
+
+		for (index=0; index<NR_busdata[node_a].Link_Table_Size; index++)
+		{
+			branch_val = NR_busdata[node_a].Link_Table[index];
+
+			if (((NR_branchdata[branch_val].from == node_b) || (NR_branchdata[branch_val].to == node_b)) && (island_link_conducting(branch_val) == true))
+			{
+				NR_branchdata[branch_val].island_number = target_island;
+			}
+		}
+
+		return true;
+	}
+
+	return island_merge(start_node,target_island);
+}
+
+//Moves every node of old_island reachable from node_int to new_island (-1 to remove them from any island)
+//Returns the number of nodes moved
+int fault_check::island_relabel(int node_int, int old_island, int new_island)
+{
+	unsigned int index, stack_top;
+	int branch_val, node_ref, moved_count;
+
+	NR_busdata[node_int].island_number = new_island;
+	search_stack[0] = node_int;
+	stack_top = 1;
+	moved_count = 1;
+
+	while (stack_top > 0)
+	{
+		node_int = search_stack[--stack_top];
+
+		for (index=0; index<NR_busdata[node_int].Link_Table_Size; index++)
+		{
+			branch_val = NR_busdata[node_int].Link_Table[index];
+
+			if (island_link_conducting(branch_val) == false)
+				continue;
+
+			NR_branchdata[branch_val].island_number = new_island;
+
+			node_ref = (NR_branchdata[branch_val].from == node_int) ? NR_branchdata[branch_val].to : NR_branchdata[branch_val].from;
+
+			if (NR_busdata[node_ref].island_number == old_island)
+			{
+				NR_busdata[node_ref].island_number = new_island;
+				search_stack[stack_top++] = node_ref;
+				moved_count++;
+			}
+		}
+	}
+
+	return moved_count;
+}
+
+//Function to remove a divergent island
+STATUS fault_check::disable_island(int island_number)
+{
+	unsigned int index_value;
+	TIMESTAMP curr_time_val_TS;
+	double curr_time_val_DBL;
+	FILE *FPOutput;
+	DATETIME temp_time;
+	char deltaprint_buffer[64];
+	bool deltamodeflag;
+
+	//Preliminary check - see if we're even in the right mode
+	if (grid_association_mode == false)
+	{
+		gl_error("fault_check: an island removal call was made, but grid_association is set to false!");
+		/*  TROUBLESHOOT
+		The powerflow is attempting to run in multi-islanded mode with individual island handling, but
+		fault_check is not set up properly.  Please set `grid_association true;` in the fault_check and
+		try again.
+		*/
+
+		return FAILED;
+	}
+
+	//Loop through the buses -- remove if it is in this island (keep SWING functions affected though)
+	for (index_value=0; index_value < NR_bus_count; index_value++)
+	{
+		//See if we're in the island
+		if (NR_busdata[index_value].island_number == island_number)
+		{
+			//Just trim it off
+			NR_busdata[index_value].phases &= 0xF8;
+
+			//De-associate us too
+			NR_busdata[index_value].island_number = -1;
+
+			//Empty the valid phases property
+			valid_phases[index_value] = 0x00;
+		}
+		//Default else -- next bus
+	}
+
+	//Do the same for branches, just so we don't get confused
+	for (index_value=0; index_value < NR_branch_count; index_value++)
+	{
+		//Check our association
 		if (NR_branchdata[index_value].island_number == island_number)
 		{
 			//Trim the phases 
@@ -2281,6 +3394,12 @@ STATUS fault_check::disable_island(int island_number)
 		//Default else -- next branch
 	}
 
+	//Island membership changed, so the solver's load batches need regrouping
+	NR_powerflow.load_batch_valid = false;
+
+	//Tracked association no longer matches - the next one needs to be a full pass
+	islands_valid = false;
+
 	//If there's an output file, log it in there too (since this is through an "unconventional" channel)
 	if (output_filename[0] != '\0')	//See if there's an output
 	{
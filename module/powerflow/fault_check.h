@@ -27,6 +27,10 @@ public:
 	char *Alteration_Nodes;					//Similar to Supported_Nodes, but used to track alteration progression (namely, has the side been handled)
 	char *Alteration_Links;					//Similar to Supported_Nodes, but used to track alteration progression in links
 	unsigned char *valid_phases;			//Nodes with source support, specific to individual phases (hex mapped) -- used for mesh-based check
+	int *search_stack;						//Work stack for the iterative topology searches -- avoids deep recursion on large systems
+	unsigned int *search_stack_index;		//Link table position of each search_stack entry -- used by the depth-first alteration search
+	char *search_queued;					//Flags for nodes already on the search stack (or already visited)
+	unsigned int search_stack_size;			//Allocated size of search_stack
 
 	enumeration fcheck_state;		//Mode variable
 	char1024 output_filename;		//File name to output unconnected bus values
@@ -51,6 +55,7 @@ public:
 	void support_check_alterations(int baselink_int, bool rest_mode);	//Function to update powerflow for "no longer supported" devices
 	void reset_alterations_check(void);									//Function to re-init the alterations support matrix - mainly used to see if ends have been touched or not
 	void allocate_alterations_values(bool reliability_mode_bool);		//Function to allocate the various memory items associated with reliability
+	void allocate_search_stack(void);									//Function to allocate the work stack for the iterative topology searches
 	bool output_check_supported_mesh(void);								//Function to check and see if anything is unsupported and set overall flag (file outputs)
 
 	void support_search_links(int node_int, int node_start, bool impact_mode);	//Function to check connectivity and support of nodes and remove/restore components as necessary
@@ -61,6 +66,25 @@ public:
 	void reset_associated_grid(void);										//Function to reset/allocate "grid association" array
 	void associate_grids(void);												//Function to look for the various swing nodes in the system, then associate the grids
 	void search_associated_grids(unsigned int node_int, int grid_counter);	//Function to perform the "grid association" and populate the array
+	void update_island_count(int grid_counter);								//Function to resize the multi-island solver arrays when the island count changes
+
+	void allocate_island_values(void);										//Function to allocate the incremental island tracking arrays
+	void snapshot_associated_grids(int grid_counter);						//Function to record a full association as the base for incremental updates
+	bool update_associated_grids(void);										//Function to patch the last association for the links and sources that changed since
+	bool island_link_conducting(int branch_idx);							//Function to see if a link currently connects its ends for island purposes
+	bool island_link_one_way(int branch_idx);								//Function to see if only one end of a link has phases in common with it
+	bool island_node_isolated(int node_int);								//Function to see if a node has no conducting links
+	int island_of(int node_int);											//Function to get the island a node belongs to (or is the entry of, if isolated)
+	bool island_source_capable(int node_int);								//Function to see if a node can be the entry into an island
+	bool island_better_entry(int node_a, int node_b);						//Function to see if node_a takes precedence over node_b as an island entry
+	int island_search(int node_a, int node_b, unsigned int *count_a, unsigned int *count_b);	//Function to search from both ends of a removed link until they meet or one side runs out
+	bool island_search_step(char side, unsigned int *done, unsigned int *count);				//Function to expand one node of one side of island_search
+	void island_search_clear(unsigned int count_a, unsigned int count_b);						//Function to clear the island_search marks
+	bool island_split_off(char side, unsigned int count, int island_number, int remain_node);	//Function to move a side found by island_search into its own island (or none)
+	bool island_remove_isolated(int node_int, unsigned int *anchor_count);	//Function to drop a node (and any other now-isolated nodes next to it) from its island
+	bool island_merge(int node_int, int target_island);						//Function to flood target_island into everything reachable from node_int
+	bool island_union(int node_a, int node_b);								//Function to join the islands on either end of a newly conducting link
+	int island_relabel(int node_int, int old_island, int new_island);		//Function to move all of an island's nodes to another island number
 
 	STATUS disable_island(int island_number);				//Function to remove/disable an island if it diverged in powerflow
 	STATUS rescan_topology(int bus_that_called_reset);		//Function to do the grid association and rescan islands
@@ -71,6 +95,20 @@ private:
 	TIMESTAMP prev_time;	//Previous timestamp - mainly for intialization
 	FUNCTIONADDR restoration_fxn;	// Function address for restoration object reconfiguration call
 	bool force_reassociation;	//Flag to force the island reassociation -- used if an island was removed to renumber them
+
+	bool islands_valid;					//Flag that the island tracking values below describe the current association
+	int island_count;					//Number of islands in the tracked association
+	unsigned char *island_link_state;	//Conducting state of each link at the last association
+	int *island_entry;					//Entry (source) node of each island -- -1 for an island number that is no longer used
+	int *island_entry_of;				//Island each node is the entry of -- -1 if it isn't an entry
+	int *island_size;					//Number of nodes associated with each island
+	int *island_hint;					//A node known to still be in each island -- used to find the rest of a split island
+	char *island_dirty;					//Islands that lost nodes or their entry in this update -- 1 = split, 2 = merged away
+	int *island_sources;				//Nodes that can be an island entry (SWING, SWING_PQ, or source-flagged)
+	unsigned char *island_source_state;	//Whether each of island_sources had phases at the last association
+	int island_source_count;			//Number of island_sources
+	int *island_changes;				//Links whose conducting state changed -- removals from the front, additions from the back
+	int *island_anchors;				//Nodes left on the kept side of a split, which must still be connected to each other
 };
 
 EXPORT int powerflow_alterations(OBJECT *thisobj, int baselink,bool rest_mode);
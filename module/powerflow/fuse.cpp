@@ -845,6 +845,9 @@ void fuse::fuse_sync_function(void)
 		}
 
 		prev_full_status = pres_status;	//Update the status flags
+
+		//Update the status too - link skips this for switch-type objects, so otherwise every pass looks like a change
+		prev_status = status;
 	}//end SM_NR
 }
 
@@ -31,6 +31,7 @@ EXPORT CLASS *init(CALLBACKS *fntable, MODULE *module, int argc, char *argv[])
 		PT_KEYWORD,"FBS",SM_FBS,
 		PT_KEYWORD,"GS",SM_GS,
 		PT_KEYWORD,"NR",SM_NR,
+		PT_KEYWORD,"NR_LINEAR",SM_NR_LINEAR,
 		NULL);
 	gl_global_create("powerflow::NR_matrix_file",PT_char256,&MDFileName,NULL);
 	gl_global_create("powerflow::NR_matrix_output_interval",PT_enumeration,&NRMatDumpMethod,
@@ -51,6 +52,19 @@ EXPORT CLASS *init(CALLBACKS *fntable, MODULE *module, int argc, char *argv[])
 	gl_global_create("powerflow::default_maximum_voltage_error[pu]",PT_double,&default_maximum_voltage_error,NULL);
 	gl_global_create("powerflow::default_maximum_power_error[pu]",PT_double,&default_maximum_power_error,NULL);
 	gl_global_create("powerflow::NR_admit_change",PT_bool,&NR_admit_change,NULL);
+	gl_global_create("powerflow::NR_localized_admit_update",PT_bool,&NR_localized_admit_update,PT_DESCRIPTION,"Flag to enable in-place admittance updates of value-only branch changes (e.g., regulator taps) instead of a full admittance rebuild",NULL);
+	gl_global_create("powerflow::NR_voltage_predictor",PT_bool,&NR_voltage_predictor,PT_DESCRIPTION,"Flag to start each new timestep's Newton-Raphson solution from voltages extrapolated from the last two converged solutions",NULL);
+	gl_global_create("powerflow::NR_solve_count",PT_int64,&NR_solve_count,PT_ACCESS,PA_REFERENCE,PT_DESCRIPTION,"Number of static Newton-Raphson powerflow solutions performed",NULL);
+	gl_global_create("powerflow::NR_iteration_total",PT_int64,&NR_iteration_total,PT_ACCESS,PA_REFERENCE,PT_DESCRIPTION,"Total Newton-Raphson iterations over all static powerflow solutions",NULL);
+	gl_global_create("powerflow::NR_solve_history_size",PT_int32,&NR_solve_history_size,PT_DESCRIPTION,"Number of recent static Newton-Raphson solutions whose iteration count and predictor error are kept",NULL);
+	gl_global_create("powerflow::NR_solve_history_file",PT_char1024,&NR_solve_history_file,PT_DESCRIPTION,"File the Newton-Raphson solve history is written to at the end of the simulation",NULL);
+	gl_global_create("powerflow::NR_chord_newton",PT_bool,&NR_chord_newton,PT_DESCRIPTION,"Flag to reuse the LU factors of the Newton-Raphson Jacobian across iterations and timesteps until convergence degrades",NULL);
+	gl_global_create("powerflow::NR_chord_refactor_ratio",PT_double,&NR_chord_refactor_ratio,PT_DESCRIPTION,"Ratio of successive Newton-Raphson mismatches above which the chord mode refactors the Jacobian",NULL);
+	gl_global_create("powerflow::NR_factorization_count",PT_int64,&NR_factorization_count,PT_ACCESS,PA_REFERENCE,PT_DESCRIPTION,"Number of Newton-Raphson Jacobian LU factorizations performed",NULL);
+	gl_global_create("powerflow::NR_linear_update_count",PT_int64,&NR_linear_update_count,PT_ACCESS,PA_REFERENCE,PT_DESCRIPTION,"Number of NR_LINEAR powerflow solutions answered by the linear update from the retained Jacobian factors",NULL);
+	gl_global_create("powerflow::NR_linear_fallback_count",PT_int64,&NR_linear_fallback_count,PT_ACCESS,PA_REFERENCE,PT_DESCRIPTION,"Number of NR_LINEAR linear updates whose current mismatch exceeded the tolerance and fell back to a full Newton-Raphson solution",NULL);
+	gl_global_create("powerflow::FBS_sweep_iterations",PT_int32,&FBS_sweep_iterations,PT_DESCRIPTION,"Maximum number of level-scheduled forward-back sweeps the swing node runs on the feeder tree in each pass (0 sweeps through the objects only)",NULL);
+	gl_global_create("powerflow::FBS_sweep_count",PT_int64,&FBS_sweep_count,PT_ACCESS,PA_REFERENCE,PT_DESCRIPTION,"Number of level-scheduled forward-back sweeps performed",NULL);
 	gl_global_create("powerflow::enable_subsecond_models", PT_bool, &enable_subsecond_models,PT_DESCRIPTION,"Enable deltamode capabilities within the powerflow module",NULL);
 	gl_global_create("powerflow::all_powerflow_delta", PT_bool, &all_powerflow_delta,PT_DESCRIPTION,"Forces all powerflow objects that are capable to participate in deltamode",NULL);
 	gl_global_create("powerflow::deltamode_timestep", PT_double, &deltamode_timestep_publish,PT_UNITS,"ns",PT_DESCRIPTION,"Desired minimum timestep for deltamode-related simulations",NULL);
@@ -118,6 +132,7 @@ EXPORT CLASS *init(CALLBACKS *fntable, MODULE *module, int argc, char *argv[])
 	new substation(module);
 	new pqload(module);
 	new voltdump(module);
+	new scenario_set(module);
 	new series_reactor(module);
 	new restoration(module);
 	new frequency_gen(module);
@@ -562,6 +577,27 @@ EXPORT STATUS postupdate(MODULE *module, TIMESTAMP t0, unsigned int64 dt)
 	}
 }
 
+EXPORT bool on_init(void)
+{
+	//The linearized screening mode is the NR solver with a flag - everything else only needs to know it is NR
+	if (solver_method == SM_NR_LINEAR)
+	{
+		solver_method = SM_NR;
+		NR_linear_screening = true;
+	}
+
+	return true;
+}
+
+EXPORT void term(void)
+{
+	//Write out the solve history, if desired
+	if ((NR_solve_history_file[0] != '\0') && (NR_powerflow.solve_history != NULL))
+	{
+		NR_solve_history_dump(&NR_powerflow,NR_solve_history_file);
+	}
+}
+
 CDECL int do_kill()
 {
 	/* if global memory needs to be released, this is a good time to do it */
@@ -915,6 +915,26 @@ set link_object::get_flow(node **fn, node **tn) const
 	return reverse;
 }
 
+//Flags a value-only change of this link's admittance (e.g., tap change) -- the NR solver patches just this branch
+//Topology or phase changes must still set NR_admit_change, since they alter the matrix structure
+void link_object::NR_branch_admittance_change(void)
+{
+	//Lock SWING since we'll be modifying the global flags
+	LOCK_OBJECT(NR_swing_bus);
+
+	if (NR_localized_admit_update && (NR_branch_reference >= 0))
+	{
+		NR_branchdata[NR_branch_reference].admit_change = true;
+		NR_admit_branch_change = true;
+	}
+	else	//Localized updates disabled - fall back to a full rebuild
+	{
+		NR_admit_change = true;
+	}
+
+	UNLOCK_OBJECT(NR_swing_bus);
+}
+
 //Presync portion of NR code - functionalized for deltamode
 void link_object::NR_link_sync_fxn(void)
 {
@@ -949,8 +969,8 @@ void link_object::NR_link_sync_fxn(void)
 				*/
 			}
 
-			//Flag an admittance change, since we may have adjusted something
-			NR_admit_change = true;
+			//Flag an admittance change, since we may have adjusted something -- values only, so localize it
+			NR_branch_admittance_change();
 
 			//Force an update of the link
 			force_link_update = true;
@@ -2155,8 +2175,15 @@ void link_object::NR_link_sync_fxn(void)
 			}
 		}
 
-		//Force flag an update if we got here (may have already been set above)
-		NR_admit_change = true;
+		//Force flag an update if we got here (may have already been set above) - value-only updates can be localized
+		if (status != prev_status)
+		{
+			NR_admit_change = true;
+		}
+		else
+		{
+			NR_branch_admittance_change();
+		}
 		
 		if (SpecialLnk != SWITCH)
 		{
@@ -2255,6 +2282,11 @@ TIMESTAMP link_object::presync(TIMESTAMP t0)
 				//For all initial implementations, we're all part of the same big/happy island - island #0!
 				NR_branchdata[NR_branch_reference].island_number = 0;
 
+				//No localized admittance updates pending
+				NR_branchdata[NR_branch_reference].admit_change = false;
+				NR_branchdata[NR_branch_reference].offdiag_loc = 0;
+				NR_branchdata[NR_branch_reference].offdiag_pattern = 0;
+
 				//Start with admittance matrix
 				if (SpecialLnk!=NORMAL)	//Transformer, send more - may not need all 4, but put them there anyways
 				{
@@ -138,6 +138,7 @@ public:
 	int CurrentCalculation(int nodecall);
 
 	void NR_link_sync_fxn(void);
+	void NR_branch_admittance_change(void);	///< Flag a value-only admittance change for a localized NR update
 	void BOTH_link_postsync_fxn(void);
 	void perform_limit_checks(double *over_limit_value, bool *over_limits);
 	double inrush_tol_value;	///< Tolerance value (of vdiff on the line ends) before "inrush convergence" is accepted
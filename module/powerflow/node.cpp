@@ -2490,9 +2490,10 @@ void node::NR_node_sync_fxn(OBJECT *obj)
 	}//end not uninitialized
 }
 
-TIMESTAMP node::sync(TIMESTAMP t0)
+//Forward-back sweep load current injections - adds the currents of the node's loads at the
+//present voltages to current_inj.  Called by sync and by the level-scheduled sweep (solver_fbs)
+void node::FBS_current_injection(void)
 {
-	TIMESTAMP t1 = powerflow_object::sync(t0);
 	OBJECT *obj = THISOBJECTHDR;
 	complex delta_current[3];
 	complex power_current[3];
@@ -2500,234 +2501,243 @@ TIMESTAMP node::sync(TIMESTAMP t0)
 	complex delta_shunt_curr[3];
 	complex dy_curr_accum[3];
 	complex temp_current_val[3];
-	
-	//Final initialization issue - has to be here, or childed deltamode stuff fails
- 	//This catches any orphaned/islanded single nodes (that link wouldn't catch), so error checks work
- 	//and don't segfault things - needs to be duplicated to subclass objects that reference NR before node::sync is called
- 	if ((prev_NTime==0) && (solver_method == SM_NR))
- 	{
- 		//See if we've been initialized yet - links typically do this, but single buses get missed
- 		if (NR_node_reference == -1)
- 		{
- 			//Call the populate routine
- 			NR_populate();
- 		}
- 	}
 
-	//Generic time keeping variable - used for phase checks (GS does this explicitly below)
-	if (t0!=prev_NTime)
-	{
-		//Update time tracking variable
-		prev_NTime=t0;
-	}
+	if (phases&PHASE_S)
+	{	// Split phase
+		complex temp_inj[2];
+		complex adjusted_curr[3];
+		complex temp_curr_val[3];
 
-	switch (solver_method)
-	{
-	case SM_FBS:
+		if (house_present)
 		{
-		if (phases&PHASE_S)
-		{	// Split phase
-			complex temp_inj[2];
-			complex adjusted_curr[3];
-			complex temp_curr_val[3];
+			//Update phase adjustments
+			adjusted_curr[0].SetPolar(1.0,voltage[0].Arg());	//Pull phase of V1
+			adjusted_curr[1].SetPolar(1.0,voltage[1].Arg());	//Pull phase of V2
+			adjusted_curr[2].SetPolar(1.0,voltaged[0].Arg());	//Pull phase of V12
 
-			if (house_present)
-			{
-				//Update phase adjustments
-				adjusted_curr[0].SetPolar(1.0,voltage[0].Arg());	//Pull phase of V1
-				adjusted_curr[1].SetPolar(1.0,voltage[1].Arg());	//Pull phase of V2
-				adjusted_curr[2].SetPolar(1.0,voltaged[0].Arg());	//Pull phase of V12
-
-				//Update these current contributions
-				temp_curr_val[0] = nom_res_curr[0]/(~adjusted_curr[0]);		//Just denominator conjugated to keep math right (rest was conjugated in house)
-				temp_curr_val[1] = nom_res_curr[1]/(~adjusted_curr[1]);
-				temp_curr_val[2] = nom_res_curr[2]/(~adjusted_curr[2]);
-			}
-			else
-			{
-				temp_curr_val[0] = temp_curr_val[1] = temp_curr_val[2] = 0.0;	//No house present, just zero em
-			}
+			//Update these current contributions
+			temp_curr_val[0] = nom_res_curr[0]/(~adjusted_curr[0]);		//Just denominator conjugated to keep math right (rest was conjugated in house)
+			temp_curr_val[1] = nom_res_curr[1]/(~adjusted_curr[1]);
+			temp_curr_val[2] = nom_res_curr[2]/(~adjusted_curr[2]);
+		}
+		else
+		{
+			temp_curr_val[0] = temp_curr_val[1] = temp_curr_val[2] = 0.0;	//No house present, just zero em
+		}
 
 #ifdef SUPPORT_OUTAGES
-			if (voltage[0]!=0.0)
-			{
+		if (voltage[0]!=0.0)
+		{
 #endif
-			complex d1 = (voltage1.IsZero() || (power1.IsZero() && shunt1.IsZero())) ? (current1 + temp_curr_val[0]) : (current1 + ~(power1/voltage1) + voltage1*shunt1 + temp_curr_val[0]);
-			complex d2 = ((voltage1+voltage2).IsZero() || (power12.IsZero() && shunt12.IsZero())) ? (current12 + temp_curr_val[2]) : (current12 + ~(power12/(voltage1+voltage2)) + (voltage1+voltage2)*shunt12 + temp_curr_val[2]);
-			
-			current_inj[0] += d1;
-			temp_inj[0] = current_inj[0];
-			current_inj[0] += d2;
+		complex d1 = (voltage1.IsZero() || (power1.IsZero() && shunt1.IsZero())) ? (current1 + temp_curr_val[0]) : (current1 + ~(power1/voltage1) + voltage1*shunt1 + temp_curr_val[0]);
+		complex d2 = ((voltage1+voltage2).IsZero() || (power12.IsZero() && shunt12.IsZero())) ? (current12 + temp_curr_val[2]) : (current12 + ~(power12/(voltage1+voltage2)) + (voltage1+voltage2)*shunt12 + temp_curr_val[2]);
+		
+		current_inj[0] += d1;
+		temp_inj[0] = current_inj[0];
+		current_inj[0] += d2;
 
 #ifdef SUPPORT_OUTAGES
-			}
-			else
-			{
-				temp_inj[0] = 0.0;
-				//WRITELOCK_OBJECT(obj);
-				current_inj[0]=0.0;
-				//UNLOCK_OBJECT(obj);
-			}
+		}
+		else
+		{
+			temp_inj[0] = 0.0;
+			//WRITELOCK_OBJECT(obj);
+			current_inj[0]=0.0;
+			//UNLOCK_OBJECT(obj);
+		}
 
-			if (voltage[1]!=0)
-			{
+		if (voltage[1]!=0)
+		{
 #endif
-			d1 = (voltage2.IsZero() || (power2.IsZero() && shunt2.IsZero())) ? (-current2 - temp_curr_val[1]) : (-current2 - ~(power2/voltage2) - voltage2*shunt2 - temp_curr_val[1]);
-			d2 = ((voltage1+voltage2).IsZero() || (power12.IsZero() && shunt12.IsZero())) ? (-current12 - temp_curr_val[2]) : (-current12 - ~(power12/(voltage1+voltage2)) - (voltage1+voltage2)*shunt12 - temp_curr_val[2]);
+		d1 = (voltage2.IsZero() || (power2.IsZero() && shunt2.IsZero())) ? (-current2 - temp_curr_val[1]) : (-current2 - ~(power2/voltage2) - voltage2*shunt2 - temp_curr_val[1]);
+		d2 = ((voltage1+voltage2).IsZero() || (power12.IsZero() && shunt12.IsZero())) ? (-current12 - temp_curr_val[2]) : (-current12 - ~(power12/(voltage1+voltage2)) - (voltage1+voltage2)*shunt12 - temp_curr_val[2]);
 
-			current_inj[1] += d1;
-			temp_inj[1] = current_inj[1];
-			current_inj[1] += d2;
-			
+		current_inj[1] += d1;
+		temp_inj[1] = current_inj[1];
+		current_inj[1] += d2;
+		
 #ifdef SUPPORT_OUTAGES
-			}
-			else
-			{
-				temp_inj[0] = 0.0;
-				//WRITELOCK_OBJECT(obj);
-				current_inj[1] = 0.0;
-				//UNLOCK_OBJECT(obj);
-			}
+		}
+		else
+		{
+			temp_inj[0] = 0.0;
+			//WRITELOCK_OBJECT(obj);
+			current_inj[1] = 0.0;
+			//UNLOCK_OBJECT(obj);
+		}
 #endif
 
-			if (obj->parent!=NULL && gl_object_isa(obj->parent,"triplex_line","powerflow")) {
-				link_object *plink = OBJECTDATA(obj->parent,link_object);
-				complex d = plink->tn[0]*current_inj[0] + plink->tn[1]*current_inj[1];
-				current_inj[2] += d;
-			}
-			else {
-				complex d = ((voltage1.IsZero() || (power1.IsZero() && shunt1.IsZero())) ||
-								   (voltage2.IsZero() || (power2.IsZero() && shunt2.IsZero()))) 
-									? currentN : -(temp_inj[0] + temp_inj[1]);
-				current_inj[2] += d;
-			}
+		if (obj->parent!=NULL && gl_object_isa(obj->parent,"triplex_line","powerflow")) {
+			link_object *plink = OBJECTDATA(obj->parent,link_object);
+			complex d = plink->tn[0]*current_inj[0] + plink->tn[1]*current_inj[1];
+			current_inj[2] += d;
 		}
-		else if (has_phase(PHASE_D)) 
-		{   // 'Delta' connected load
-			
-			//Convert delta connected power to appropriate line current
-			delta_current[0]= (voltaged[0].IsZero()) ? 0 : ~(power[0]/voltaged[0]);
-			delta_current[1]= (voltaged[1].IsZero()) ? 0 : ~(power[1]/voltaged[1]);
-			delta_current[2]= (voltaged[2].IsZero()) ? 0 : ~(power[2]/voltaged[2]);
+		else {
+			complex d = ((voltage1.IsZero() || (power1.IsZero() && shunt1.IsZero())) ||
+							   (voltage2.IsZero() || (power2.IsZero() && shunt2.IsZero()))) 
+								? currentN : -(temp_inj[0] + temp_inj[1]);
+			current_inj[2] += d;
+		}
+	}
+	else if (has_phase(PHASE_D)) 
+	{   // 'Delta' connected load
+		
+		//Convert delta connected power to appropriate line current
+		delta_current[0]= (voltaged[0].IsZero()) ? 0 : ~(power[0]/voltaged[0]);
+		delta_current[1]= (voltaged[1].IsZero()) ? 0 : ~(power[1]/voltaged[1]);
+		delta_current[2]= (voltaged[2].IsZero()) ? 0 : ~(power[2]/voltaged[2]);
 
-			power_current[0]=delta_current[0]-delta_current[2];
-			power_current[1]=delta_current[1]-delta_current[0];
-			power_current[2]=delta_current[2]-delta_current[1];
+		power_current[0]=delta_current[0]-delta_current[2];
+		power_current[1]=delta_current[1]-delta_current[0];
+		power_current[2]=delta_current[2]-delta_current[1];
 
-			//Convert delta connected load to appropriate line current
-			delta_shunt[0] = voltaged[0]*shunt[0];
-			delta_shunt[1] = voltaged[1]*shunt[1];
-			delta_shunt[2] = voltaged[2]*shunt[2];
+		//Convert delta connected load to appropriate line current
+		delta_shunt[0] = voltaged[0]*shunt[0];
+		delta_shunt[1] = voltaged[1]*shunt[1];
+		delta_shunt[2] = voltaged[2]*shunt[2];
 
-			delta_shunt_curr[0] = delta_shunt[0]-delta_shunt[2];
-			delta_shunt_curr[1] = delta_shunt[1]-delta_shunt[0];
-			delta_shunt_curr[2] = delta_shunt[2]-delta_shunt[1];
+		delta_shunt_curr[0] = delta_shunt[0]-delta_shunt[2];
+		delta_shunt_curr[1] = delta_shunt[1]-delta_shunt[0];
+		delta_shunt_curr[2] = delta_shunt[2]-delta_shunt[1];
 
-			//Convert delta-current into a phase current - reuse temp variable
-			delta_current[0]=current[0]-current[2];
-			delta_current[1]=current[1]-current[0];
-			delta_current[2]=current[2]-current[1];
+		//Convert delta-current into a phase current - reuse temp variable
+		delta_current[0]=current[0]-current[2];
+		delta_current[1]=current[1]-current[0];
+		delta_current[2]=current[2]-current[1];
 
 #ifdef SUPPORT_OUTAGES
-			for (char kphase=0;kphase<3;kphase++)
+		for (char kphase=0;kphase<3;kphase++)
+		{
+			if (voltaged[kphase]==0.0)
 			{
-				if (voltaged[kphase]==0.0)
-				{
-					//WRITELOCK_OBJECT(obj);
-					current_inj[kphase] = 0.0;
-					//UNLOCK_OBJECT(obj);
-				}
-				else
-				{
-					//WRITELOCK_OBJECT(obj);
-					current_inj[kphase] += delta_current[kphase] + power_current[kphase] + delta_shunt_curr[kphase];
-					//UNLOCK_OBJECT(obj);
-				}
+				//WRITELOCK_OBJECT(obj);
+				current_inj[kphase] = 0.0;
+				//UNLOCK_OBJECT(obj);
 			}
+			else
+			{
+				//WRITELOCK_OBJECT(obj);
+				current_inj[kphase] += delta_current[kphase] + power_current[kphase] + delta_shunt_curr[kphase];
+				//UNLOCK_OBJECT(obj);
+			}
+		}
 #else
-			temp_current_val[0] = delta_current[0] + power_current[0] + delta_shunt_curr[0];
-			temp_current_val[1] = delta_current[1] + power_current[1] + delta_shunt_curr[1];
-			temp_current_val[2] = delta_current[2] + power_current[2] + delta_shunt_curr[2];
+		temp_current_val[0] = delta_current[0] + power_current[0] + delta_shunt_curr[0];
+		temp_current_val[1] = delta_current[1] + power_current[1] + delta_shunt_curr[1];
+		temp_current_val[2] = delta_current[2] + power_current[2] + delta_shunt_curr[2];
 
-			current_inj[0] += temp_current_val[0];
-			current_inj[1] += temp_current_val[1];
-			current_inj[2] += temp_current_val[2];
+		current_inj[0] += temp_current_val[0];
+		current_inj[1] += temp_current_val[1];
+		current_inj[2] += temp_current_val[2];
 #endif
-		}
-		else 
-		{	// 'WYE' connected load
+	}
+	else 
+	{	// 'WYE' connected load
 
 #ifdef SUPPORT_OUTAGES
-			for (char kphase=0;kphase<3;kphase++)
+		for (char kphase=0;kphase<3;kphase++)
+		{
+			if (voltage[kphase]==0.0)
 			{
-				if (voltage[kphase]==0.0)
-				{
-					//WRITELOCK_OBJECT(obj);
-					current_inj[kphase] = 0.0;
-					//UNLOCK_OBJECT(obj);
-				}
-				else
-				{
-					complex d = ((voltage[kphase]==0.0) || ((power[kphase] == 0) && shunt[kphase].IsZero())) ? current[kphase] : current[kphase] + ~(power[kphase]/voltage[kphase]) + voltage[kphase]*shunt[kphase];
-					//WRITELOCK_OBJECT(obj);
-					current_inj[kphase] += d;
-					//UNLOCK_OBJECT(obj);
-				}
+				//WRITELOCK_OBJECT(obj);
+				current_inj[kphase] = 0.0;
+				//UNLOCK_OBJECT(obj);
+			}
+			else
+			{
+				complex d = ((voltage[kphase]==0.0) || ((power[kphase] == 0) && shunt[kphase].IsZero())) ? current[kphase] : current[kphase] + ~(power[kphase]/voltage[kphase]) + voltage[kphase]*shunt[kphase];
+				//WRITELOCK_OBJECT(obj);
+				current_inj[kphase] += d;
+				//UNLOCK_OBJECT(obj);
 			}
+		}
 #else
 
-			temp_current_val[0] = (voltage[0].IsZero() || (power[0].IsZero() && shunt[0].IsZero())) ? current[0] : current[0] + ~(power[0]/voltage[0]) + voltage[0]*shunt[0];
-			temp_current_val[1] = (voltage[1].IsZero() || (power[1].IsZero() && shunt[1].IsZero())) ? current[1] : current[1] + ~(power[1]/voltage[1]) + voltage[1]*shunt[1];
-			temp_current_val[2] = (voltage[2].IsZero() || (power[2].IsZero() && shunt[2].IsZero())) ? current[2] : current[2] + ~(power[2]/voltage[2]) + voltage[2]*shunt[2];
+		temp_current_val[0] = (voltage[0].IsZero() || (power[0].IsZero() && shunt[0].IsZero())) ? current[0] : current[0] + ~(power[0]/voltage[0]) + voltage[0]*shunt[0];
+		temp_current_val[1] = (voltage[1].IsZero() || (power[1].IsZero() && shunt[1].IsZero())) ? current[1] : current[1] + ~(power[1]/voltage[1]) + voltage[1]*shunt[1];
+		temp_current_val[2] = (voltage[2].IsZero() || (power[2].IsZero() && shunt[2].IsZero())) ? current[2] : current[2] + ~(power[2]/voltage[2]) + voltage[2]*shunt[2];
 
-			current_inj[0] += temp_current_val[0];
-			current_inj[1] += temp_current_val[1];
-			current_inj[2] += temp_current_val[2];
+		current_inj[0] += temp_current_val[0];
+		current_inj[1] += temp_current_val[1];
+		current_inj[2] += temp_current_val[2];
 #endif
-		}
+	}
 
-		//Handle explicit delta-wye connections now -- no triplex
-		if (!(has_phase(PHASE_S)))
-		{
-			//Convert delta connected power to appropriate line current
-			delta_current[0]= (voltageAB.IsZero()) ? 0 : ~(power_dy[0]/voltageAB);
-			delta_current[1]= (voltageBC.IsZero()) ? 0 : ~(power_dy[1]/voltageBC);
-			delta_current[2]= (voltageCA.IsZero()) ? 0 : ~(power_dy[2]/voltageCA);
-
-			power_current[0]=delta_current[0]-delta_current[2];
-			power_current[1]=delta_current[1]-delta_current[0];
-			power_current[2]=delta_current[2]-delta_current[1];
-
-			//Convert delta connected load to appropriate line current
-			delta_shunt[0] = voltageAB*shunt_dy[0];
-			delta_shunt[1] = voltageBC*shunt_dy[1];
-			delta_shunt[2] = voltageCA*shunt_dy[2];
-
-			delta_shunt_curr[0] = delta_shunt[0]-delta_shunt[2];
-			delta_shunt_curr[1] = delta_shunt[1]-delta_shunt[0];
-			delta_shunt_curr[2] = delta_shunt[2]-delta_shunt[1];
-
-			//Convert delta-current into a phase current - reuse temp variable
-			delta_current[0]=current_dy[0]-current_dy[2];
-			delta_current[1]=current_dy[1]-current_dy[0];
-			delta_current[2]=current_dy[2]-current_dy[1];
-
-			//Accumulate
-			dy_curr_accum[0] = delta_current[0] + power_current[0] + delta_shunt_curr[0];
-			dy_curr_accum[1] = delta_current[1] + power_current[1] + delta_shunt_curr[1];
-			dy_curr_accum[2] = delta_current[2] + power_current[2] + delta_shunt_curr[2];
-
-			//Wye-connected portions
-			dy_curr_accum[0] += (voltageA.IsZero() || (power_dy[3].IsZero() && shunt_dy[3].IsZero())) ? current_dy[3] : current_dy[3] + ~(power_dy[3]/voltageA) + voltageA*shunt_dy[3];
-			dy_curr_accum[1] += (voltageB.IsZero() || (power_dy[4].IsZero() && shunt_dy[4].IsZero())) ? current_dy[4] : current_dy[4] + ~(power_dy[4]/voltageB) + voltageB*shunt_dy[4];
-			dy_curr_accum[2] += (voltageC.IsZero() || (power_dy[5].IsZero() && shunt_dy[5].IsZero())) ? current_dy[5] : current_dy[5] + ~(power_dy[5]/voltageC) + voltageC*shunt_dy[5];
-				
-			//Accumulate in to final portion
-			current_inj[0] += dy_curr_accum[0];
-			current_inj[1] += dy_curr_accum[1];
-			current_inj[2] += dy_curr_accum[2];
+	//Handle explicit delta-wye connections now -- no triplex
+	if (!(has_phase(PHASE_S)))
+	{
+		//Convert delta connected power to appropriate line current
+		delta_current[0]= (voltageAB.IsZero()) ? 0 : ~(power_dy[0]/voltageAB);
+		delta_current[1]= (voltageBC.IsZero()) ? 0 : ~(power_dy[1]/voltageBC);
+		delta_current[2]= (voltageCA.IsZero()) ? 0 : ~(power_dy[2]/voltageCA);
+
+		power_current[0]=delta_current[0]-delta_current[2];
+		power_current[1]=delta_current[1]-delta_current[0];
+		power_current[2]=delta_current[2]-delta_current[1];
+
+		//Convert delta connected load to appropriate line current
+		delta_shunt[0] = voltageAB*shunt_dy[0];
+		delta_shunt[1] = voltageBC*shunt_dy[1];
+		delta_shunt[2] = voltageCA*shunt_dy[2];
+
+		delta_shunt_curr[0] = delta_shunt[0]-delta_shunt[2];
+		delta_shunt_curr[1] = delta_shunt[1]-delta_shunt[0];
+		delta_shunt_curr[2] = delta_shunt[2]-delta_shunt[1];
+
+		//Convert delta-current into a phase current - reuse temp variable
+		delta_current[0]=current_dy[0]-current_dy[2];
+		delta_current[1]=current_dy[1]-current_dy[0];
+		delta_current[2]=current_dy[2]-current_dy[1];
+
+		//Accumulate
+		dy_curr_accum[0] = delta_current[0] + power_current[0] + delta_shunt_curr[0];
+		dy_curr_accum[1] = delta_current[1] + power_current[1] + delta_shunt_curr[1];
+		dy_curr_accum[2] = delta_current[2] + power_current[2] + delta_shunt_curr[2];
+
+		//Wye-connected portions
+		dy_curr_accum[0] += (voltageA.IsZero() || (power_dy[3].IsZero() && shunt_dy[3].IsZero())) ? current_dy[3] : current_dy[3] + ~(power_dy[3]/voltageA) + voltageA*shunt_dy[3];
+		dy_curr_accum[1] += (voltageB.IsZero() || (power_dy[4].IsZero() && shunt_dy[4].IsZero())) ? current_dy[4] : current_dy[4] + ~(power_dy[4]/voltageB) + voltageB*shunt_dy[4];
+		dy_curr_accum[2] += (voltageC.IsZero() || (power_dy[5].IsZero() && shunt_dy[5].IsZero())) ? current_dy[5] : current_dy[5] + ~(power_dy[5]/voltageC) + voltageC*shunt_dy[5];
+			
+		//Accumulate in to final portion
+		current_inj[0] += dy_curr_accum[0];
+		current_inj[1] += dy_curr_accum[1];
+		current_inj[2] += dy_curr_accum[2];
+
+	}//End delta/wye explicit
+}
+
+TIMESTAMP node::sync(TIMESTAMP t0)
+{
+	TIMESTAMP t1 = powerflow_object::sync(t0);
+	OBJECT *obj = THISOBJECTHDR;
+	
+	//Final initialization issue - has to be here, or childed deltamode stuff fails
+ 	//This catches any orphaned/islanded single nodes (that link wouldn't catch), so error checks work
+ 	//and don't segfault things - needs to be duplicated to subclass objects that reference NR before node::sync is called
+ 	if ((prev_NTime==0) && (solver_method == SM_NR))
+ 	{
+ 		//See if we've been initialized yet - links typically do this, but single buses get missed
+ 		if (NR_node_reference == -1)
+ 		{
+ 			//Call the populate routine
+ 			NR_populate();
+ 		}
+ 	}
+
+	//Generic time keeping variable - used for phase checks (GS does this explicitly below)
+	if (t0!=prev_NTime)
+	{
+		//Update time tracking variable
+		prev_NTime=t0;
+	}
 
-		}//End delta/wye explicit
+	switch (solver_method)
+	{
+	case SM_FBS:
+		{
+		//Compute the load current injections at the present voltages
+		FBS_current_injection();
 
 #ifdef SUPPORT_OUTAGES
 	if (is_open_any())
@@ -3282,6 +3292,12 @@ TIMESTAMP node::postsync(TIMESTAMP t0)
 	//kva_in = (voltageA*~current[0] + voltageB*~current[1] + voltageC*~current[2])/1000; /*...or not.  Note sure how this works for a node*/
 
 #endif
+	//Level-scheduled sweeps - the swing node leads the top-down pass, so every injection is in by now
+	if ((solver_method==SM_FBS) && (FBS_sweep_iterations>0) && (bustype==SWING))
+	{
+		solver_fbs_sweep(obj);
+	}
+
 	//Call NR-related and some "common" node postsync routines
 	BOTH_node_postsync_fxn(obj);
 
@@ -3774,6 +3790,10 @@ int node::NR_populate(void)
 	//For all initial implementations, we're all part of the same big/happy island - island #0!
 	NR_busdata[NR_node_reference].island_number = 0;
 
+	//No localized admittance updates pending
+	NR_busdata[NR_node_reference].admit_change = false;
+	NR_busdata[NR_node_reference].diag_fixed_loc = 0;
+
 	//Interim check to make sure it isn't a PV bus, since those aren't supported yet - this will get removed when that functionality is put in place
 	if (NR_busdata[NR_node_reference].type==1)
 	{
@@ -279,6 +279,7 @@ public:
 	TIMESTAMP NR_node_presync_fxn(TIMESTAMP t0_val);
 	void NR_node_sync_fxn(OBJECT *obj);
 	void BOTH_node_postsync_fxn(OBJECT *obj);
+	void FBS_current_injection(void);
 	OBJECT *NR_master_swing_search(const char *node_type_value,bool main_swing);
 
 	void init_freq_dynamics(void);
@@ -317,6 +318,7 @@ public:
 	friend class capacitor;		// Needs access to deltamode stuff
 	friend class fuse;			// needs access to current_inj
 	friend class frequency_gen;	// needs access to current_inj
+	friend int solver_fbs_sweep(OBJECT *swing);	// needs access to current_inj
 	friend class motor;	// needs access to curr_state
 
 	inline complex* get_current_injection(void) { return current_inj; };
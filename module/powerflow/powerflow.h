@@ -13,6 +13,7 @@
 #include "gridlabd.h"
 
 #include "solver_nr.h"
+#include "solver_fbs.h"
 
 #include "line_sensor.h"
 #include "switch_coordinator.h"
@@ -29,7 +30,7 @@ void print_matrix(complex mat[3][3]);
 //Deltamode use
 #define TSNVRDBL 9223372036854775808.0
 
-typedef enum {SM_FBS=0, SM_GS=1, SM_NR=2} SOLVERMETHOD;		/**< powerflow solver methodology */
+typedef enum {SM_FBS=0, SM_GS=1, SM_NR=2, SM_NR_LINEAR=3} SOLVERMETHOD;		/**< powerflow solver methodology - SM_NR_LINEAR becomes SM_NR with NR_linear_screening at module initialization */
 typedef enum {MM_SUPERLU=0, MM_EXTERN=1} MATRIXSOLVERMETHOD;	/**< NR matrix solver methodlogy */
 typedef enum {
 	MD_NONE=0,			///< No matrix dump desired
@@ -76,12 +77,28 @@ EXTERN int NR_curr_branch INIT(-1);					/**< Newton-Raphson current branch indic
 EXTERN int64 NR_iteration_limit INIT(500);			/**< Newton-Raphson iteration limit (per GridLAB-D iteration) */
 EXTERN bool NR_dyn_first_run INIT(true);			/**< Newton-Raphson first run indicator - used by deltamode functionality for initialization powerflow */
 EXTERN bool NR_admit_change INIT(true);				/**< Newton-Raphson admittance matrix change detector - used to prevent complete recalculation of admittance at every timestep */
+EXTERN bool NR_admit_branch_change INIT(false);		/**< Newton-Raphson branch admittance value change detector - flagged branches are patched in place instead of a full rebuild */
+EXTERN bool NR_localized_admit_update INIT(true);	/**< Newton-Raphson flag to enable localized admittance updates for value-only branch changes (e.g., regulator taps) */
+EXTERN bool NR_voltage_predictor INIT(false);		/**< Newton-Raphson flag to extrapolate the starting voltages of a new timestep from the last two converged solutions */
+EXTERN int64 NR_solve_count INIT(0);				/**< Newton-Raphson number of static powerflow solutions performed */
+EXTERN int64 NR_iteration_total INIT(0);			/**< Newton-Raphson total iterations over all static powerflow solutions */
+EXTERN int32 NR_solve_history_size INIT(0);		/**< Newton-Raphson number of recent static solutions kept in the solve history (0 = none) */
+EXTERN char1024 NR_solve_history_file INIT("");	/**< Newton-Raphson file the solve history is written to at the end of the simulation */
+EXTERN bool NR_chord_newton INIT(false);			/**< Newton-Raphson flag to reuse the LU factors of the Jacobian across iterations and timesteps until convergence degrades */
+EXTERN double NR_chord_refactor_ratio INIT(0.5);	/**< Newton-Raphson chord mode - ratio of successive mismatches above which the Jacobian is refactored */
+EXTERN int64 NR_factorization_count INIT(0);		/**< Newton-Raphson number of Jacobian LU factorizations performed */
+EXTERN bool NR_linear_screening INIT(false);		/**< Newton-Raphson linearized screening mode - answer new timesteps with one update from the retained Jacobian factors when the resulting current mismatch is within tolerance */
+EXTERN int64 NR_linear_update_count INIT(0);		/**< Newton-Raphson linearized screening mode - number of solutions accepted from the linear update */
+EXTERN int64 NR_linear_fallback_count INIT(0);		/**< Newton-Raphson linearized screening mode - number of linear updates whose current mismatch was rejected in favor of a full solution */
+EXTERN bool NR_retain_factors INIT(false);			/**< Newton-Raphson flag to keep the Jacobian LU factors after each solution - set by scenario_set objects */
 EXTERN int NR_superLU_procs INIT(1);				/**< Newton-Raphson related - superLU MT processor count to request - separate from thread_count */
 EXTERN TIMESTAMP NR_retval INIT(TS_NEVER);			/**< Newton-Raphson current return value - if t0 objects know we aren't going anywhere */
 EXTERN OBJECT *NR_swing_bus INIT(NULL);				/**< Newton-Raphson swing bus */
 EXTERN int NR_swing_bus_reference INIT(-1);			/**< Newton-Raphson swing bus index reference in NR_busdata */
 EXTERN int64 NR_delta_iteration_limit INIT(10);		/**< Newton-Raphson iteration limit (per deltamode timestep) */
 EXTERN bool FBS_swing_set INIT(false);				/**< Forward-Back Sweep swing assignment variable */
+EXTERN int32 FBS_sweep_iterations INIT(0);			/**< Forward-Back Sweep - level-scheduled sweeps the swing node may run per pass (0 sweeps through the objects only) */
+EXTERN int64 FBS_sweep_count INIT(0);				/**< Forward-Back Sweep - number of level-scheduled sweeps performed */
 EXTERN bool show_matrix_values INIT(false);			/**< flag to enable dumping matrix calculations as they occur */
 EXTERN double primary_voltage_ratio INIT(60.0);		/**< primary voltage ratio (@todo explain primary_voltage_ratio in powerflow (ticket #131) */
 EXTERN double nominal_frequency INIT(60.0);			/**< nomimal operating frequency */
@@ -192,6 +209,7 @@ void schedule_deltamode_start(TIMESTAMP tstart);	/* Anticipated time for a delta
 #include "ductbank.h"
 #include "impedance_dump.h"
 #include "load_tracker.h"
+#include "scenario_set.h"
 #include "voltdump.h"
 
 #include "pole.h"
@@ -829,10 +829,8 @@ TIMESTAMP regulator::presync(TIMESTAMP t0)
 		//accesses the NR memory space, this won't cause any issues.
 		if ((prev_tap[0] != tap[0]) || (prev_tap[1] != tap[1]) || (prev_tap[2] != tap[2]))	//Change has occurred
 		{
-			//Flag an update
-			LOCK_OBJECT(NR_swing_bus);	//Lock SWING since we'll be modifying this
-			NR_admit_change = true;
-			UNLOCK_OBJECT(NR_swing_bus);	//Unlock
+			//Flag an update - taps only change values, so only this branch needs to be updated
+			NR_branch_admittance_change();
 
 			//Update our previous tap positions
 			prev_tap[0] = tap[0];
@@ -0,0 +1,448 @@
+// module/powerflow/scenario_set.cpp
+// Copyright (C) 2024 Regents of the Leland Stanford Junior University
+//
+// Solves a set of load scenarios from the Newton-Raphson base solution of each
+// timestep.  Each scenario iterates on its full mismatch with chord steps that
+// share the Jacobian factors of the base solution, and the steps of all the
+// scenarios are taken together with multiple-right-hand-side triangular solves
+// (see solver_nr_scenarios).  The input file lists the extra constant power
+// load of each scenario:
+//
+//   scenario,node,phase,power
+//   pv_1,load4,A,-50000+0j
+//
+// Phases are A, B, or C, or 1 and 2 for triplex nodes.  Negative power is
+// generation.  The output file gets one row per scenario and run with the
+// iterations used, whether it converged, and the highest and lowest per-unit
+// voltages.
+
+#include "powerflow.h"
+
+CLASS* scenario_set::oclass = NULL;
+
+scenario_set::scenario_set(MODULE *mod)
+{
+	if (oclass==NULL)
+	{
+		// register the class definition
+		oclass = gl_register_class(mod,"scenario_set",sizeof(scenario_set),PC_BOTTOMUP|PC_AUTOLOCK);
+		if (oclass==NULL)
+			throw "unable to register class scenario_set";
+		else
+			oclass->trl = TRL_PROTOTYPE;
+
+		// publish the class properties
+		if (gl_publish_variable(oclass,
+			PT_char1024,"input_file",PADDR(input_file),
+				PT_REQUIRED,
+				PT_DESCRIPTION,"CSV file of scenario loads (scenario,node,phase,power)",
+			PT_char1024,"output_file",PADDR(output_file),
+				PT_REQUIRED,
+				PT_DESCRIPTION,"CSV file the scenario results are written to",
+			PT_double,"interval[s]",PADDR(interval),
+				PT_DEFAULT,"0 s",
+				PT_DESCRIPTION,"interval at which the scenarios are solved (0 solves every timestep)",
+			PT_int32,"scenario_count",PADDR(scenario_count),
+				PT_ACCESS,PA_REFERENCE,
+				PT_DESCRIPTION,"number of scenarios read from the input file",
+			PT_int32,"converged_count",PADDR(converged_count),
+				PT_ACCESS,PA_REFERENCE,
+				PT_DESCRIPTION,"number of scenarios that converged in the last run",
+			PT_int32,"runcount",PADDR(runcount),
+				PT_ACCESS,PA_REFERENCE,
+				PT_DESCRIPTION,"number of times the scenarios have been solved",
+			NULL)<1) GL_THROW("unable to publish properties in %s",__FILE__);
+	}
+}
+
+int scenario_set::create(void)
+{
+	interval = 0.0;
+	scenario_count = 0;
+	converged_count = 0;
+	runcount = 0;
+	injection_list = NULL;
+	injection_count = 0;
+	scenario_names = NULL;
+	scenario_power = NULL;
+	scenario_voltage = NULL;
+	scenario_iterations = NULL;
+	allocated_buses = 0;
+	outfile = NULL;
+	return 1;
+}
+
+int scenario_set::init(OBJECT *parent)
+{
+	if ( solver_method != SM_NR )
+	{
+		gl_error("scenario_set requires the NR solver_method");
+		/*  TROUBLESHOOT
+		The scenario_set object solves its scenarios with the factors of the Newton-Raphson Jacobian.
+		Set powerflow::solver_method to NR or NR_LINEAR and try again.
+		*/
+		return 0;
+	}
+	if ( interval < 0 )
+	{
+		gl_error("negative interval is not permitted");
+		return 0;
+	}
+	if ( ! read_input() )
+	{
+		return 0;
+	}
+
+	// keep the Jacobian factors of each base solution for the scenario solves
+	NR_retain_factors = true;
+
+	unlink(output_file);
+	return 1;
+}
+
+bool scenario_set::read_input(void)
+{
+	char line[1024], label[256], name[256], phase[8], power[256];
+	int linenum = 0, maxinjections = 0;
+	int n;
+	unsigned int s;
+	OBJECT *obj;
+	complex value;
+	char notation;
+
+	FILE *fp = fopen(input_file,"r");
+	if ( fp == NULL )
+	{
+		gl_error("scenario_set unable to open %s for input", input_file.get_string());
+		return false;
+	}
+	while ( fgets(line,sizeof(line),fp) != NULL )
+	{
+		linenum++;
+		if ( line[0] == '#' || line[0] == '\n' || line[0] == '\r' )
+		{
+			continue;
+		}
+		if ( sscanf(line,"%255[^,],%255[^,],%7[^,],%255[^,\r\n]",label,name,phase,power) != 4 )
+		{
+			gl_error("%s(%d): expected scenario,node,phase,power", input_file.get_string(), linenum);
+			fclose(fp);
+			return false;
+		}
+
+		// header row
+		if ( linenum == 1 && strcmp(label,"scenario") == 0 )
+		{
+			continue;
+		}
+
+		obj = gl_get_object(name);
+		if ( obj == NULL || ! gl_object_isa(obj,"node","powerflow") )
+		{
+			gl_error("%s(%d): '%s' is not a powerflow node", input_file.get_string(), linenum, name);
+			fclose(fp);
+			return false;
+		}
+
+		value = complex(0,0);
+		notation = 'j';
+		n = sscanf(power,"%lg%lg%c",&value.Re(),&value.Im(),&notation);
+		if ( n < 1 || (n == 3 && strchr("ij",notation) == NULL) )
+		{
+			gl_error("%s(%d): power '%s' must be a real or rectangular complex value", input_file.get_string(), linenum, power);
+			fclose(fp);
+			return false;
+		}
+
+		// scenarios are numbered in order of first appearance
+		for ( s = 0 ; s < (unsigned int)scenario_count ; s++ )
+		{
+			if ( strcmp(scenario_names[s],label) == 0 )
+			{
+				break;
+			}
+		}
+		if ( s == (unsigned int)scenario_count )
+		{
+			scenario_names = (char**)realloc(scenario_names,(scenario_count+1)*sizeof(char*));
+			scenario_names[scenario_count++] = strdup(label);
+		}
+
+		if ( (int)injection_count == maxinjections )
+		{
+			maxinjections = maxinjections ? maxinjections*2 : 64;
+			SCENARIOINJECTION *grown = new SCENARIOINJECTION[maxinjections];
+			for ( n = 0 ; n < (int)injection_count ; n++ )
+			{
+				grown[n] = injection_list[n];
+			}
+			delete [] injection_list;
+			injection_list = grown;
+		}
+		SCENARIOINJECTION *item = &injection_list[injection_count++];
+		item->scenario = s;
+		item->node = obj;
+		item->power = value;
+		switch ( phase[0] ) {
+		case 'A': case 'a': case '1': item->phase = 0; break;
+		case 'B': case 'b': case '2': item->phase = 1; break;
+		case 'C': case 'c': item->phase = 2; break;
+		default:
+			gl_error("%s(%d): phase '%s' must be A, B, C, 1, or 2", input_file.get_string(), linenum, phase);
+			fclose(fp);
+			return false;
+		}
+	}
+	fclose(fp);
+
+	if ( scenario_count == 0 )
+	{
+		warning("no scenarios were found in %s", input_file.get_string());
+	}
+	return true;
+}
+
+bool scenario_set::allocate_arrays(void)
+{
+	if ( allocated_buses == NR_bus_count )
+	{
+		return true;
+	}
+	gl_free(scenario_power);
+	gl_free(scenario_voltage);
+	gl_free(scenario_iterations);
+	scenario_power = (complex*)gl_malloc(scenario_count*NR_bus_count*3*sizeof(complex));
+	scenario_voltage = (complex*)gl_malloc(scenario_count*NR_bus_count*3*sizeof(complex));
+	scenario_iterations = (int64*)gl_malloc(scenario_count*sizeof(int64));
+	if ( scenario_power == NULL || scenario_voltage == NULL || scenario_iterations == NULL )
+	{
+		gl_error("scenario_set unable to allocate the scenario arrays");
+		allocated_buses = 0;
+		return false;
+	}
+	allocated_buses = NR_bus_count;
+	return true;
+}
+
+void scenario_set::solve(TIMESTAMP t)
+{
+	char timestr[64];
+	unsigned int s, b, n;
+	int k, p, bus_ref;
+	node *pnode;
+	double vpu, vmax, vmin;
+	int nmax, nmin;
+
+	if ( scenario_count == 0 || NR_busdata == NULL || ! allocate_arrays() )
+	{
+		return;
+	}
+
+	// scatter the injections - bus references are only known once the solver has been populated
+	for ( n = 0 ; n < (unsigned int)scenario_count*NR_bus_count*3 ; n++ )
+	{
+		scenario_power[n] = complex(0,0);
+	}
+	for ( n = 0 ; n < injection_count ; n++ )
+	{
+		pnode = OBJECTDATA(injection_list[n].node,node);
+		bus_ref = pnode->NR_node_reference;
+		if ( bus_ref == -99 )
+		{
+			bus_ref = OBJECTDATA(pnode->SubNodeParent,node)->NR_node_reference;
+		}
+		if ( bus_ref < 0 || bus_ref >= (int)NR_bus_count )
+		{
+			continue;
+		}
+		scenario_power[(injection_list[n].scenario*NR_bus_count+bus_ref)*3+injection_list[n].phase] += injection_list[n].power;
+	}
+
+	converged_count = solver_nr_scenarios(NR_bus_count,NR_busdata,NR_branchdata,&NR_powerflow,scenario_count,scenario_power,scenario_voltage,scenario_iterations);
+	if ( converged_count < 0 )
+	{
+		warning("no Jacobian factorization is available, scenarios were not solved");
+		/*  TROUBLESHOOT
+		The scenarios are solved with the LU factors of the last Newton-Raphson solution, which are only kept
+		by the superLU solver.  Make sure the powerflow has solved and powerflow::lu_solver is not set.
+		*/
+		converged_count = 0;
+		return;
+	}
+
+	if ( outfile == NULL )
+	{
+		outfile = fopen(output_file,"w");
+		if ( outfile == NULL )
+		{
+			gl_error("scenario_set unable to open %s for output", output_file.get_string());
+			return;
+		}
+		fprintf(outfile,"timestamp,scenario,iterations,converged,max_voltage[pu],max_voltage_node,min_voltage[pu],min_voltage_node\n");
+	}
+
+	gl_printtime(t, timestr, 64);
+	for ( s = 0 ; s < (unsigned int)scenario_count ; s++ )
+	{
+		vmax = 0.0;
+		vmin = 0.0;
+		nmax = nmin = -1;
+		for ( b = 0 ; b < NR_bus_count ; b++ )
+		{
+			if ( NR_busdata[b].island_number < 0 || NR_busdata[b].volt_base <= 0 )
+			{
+				continue;
+			}
+			for ( p = 0 ; p < 3 ; p++ )
+			{
+				// triplex carries phases 1 and 2, others their present A/B/C phases
+				if ( (NR_busdata[b].phases & 0x80) == 0x80 ? (p == 2) : ((NR_busdata[b].phases & (0x04>>p)) == 0) )
+				{
+					continue;
+				}
+				vpu = scenario_voltage[(s*NR_bus_count+b)*3+p].Mag() / NR_busdata[b].volt_base;
+				if ( vpu == 0 )
+				{
+					continue;
+				}
+				if ( nmax < 0 || vpu > vmax )
+				{
+					vmax = vpu;
+					nmax = b;
+				}
+				if ( nmin < 0 || vpu < vmin )
+				{
+					vmin = vpu;
+					nmin = b;
+				}
+			}
+		}
+		k = (int)scenario_iterations[s];
+		fprintf(outfile,"%s,%s,%d,%s,%.6f,%s,%.6f,%s\n", timestr, scenario_names[s], k, k > 0 ? "TRUE" : "FALSE",
+			vmax, nmax < 0 ? "" : NR_busdata[nmax].name,
+			vmin, nmin < 0 ? "" : NR_busdata[nmin].name);
+	}
+	fflush(outfile);
+}
+
+int scenario_set::isa(CLASSNAME classname)
+{
+	return strcmp(classname,"scenario_set")==0;
+}
+
+int scenario_set::finalize(void)
+{
+	if ( outfile != NULL )
+	{
+		fclose(outfile);
+		outfile = NULL;
+	}
+	for ( int s = 0 ; scenario_names != NULL && s < scenario_count ; s++ )
+	{
+		free(scenario_names[s]);
+	}
+	free(scenario_names);
+	scenario_names = NULL;
+	delete [] injection_list;
+	injection_list = NULL;
+	injection_count = 0;
+	gl_free(scenario_power);
+	gl_free(scenario_voltage);
+	gl_free(scenario_iterations);
+	scenario_power = NULL;
+	scenario_voltage = NULL;
+	scenario_iterations = NULL;
+	allocated_buses = 0;
+	return 1;
+}
+
+TIMESTAMP scenario_set::sync(TIMESTAMP t)
+{
+	//Keep the clock stepping to the next run so the scenarios are solved even on static models
+	if ( interval > 0 )
+	{
+		unsigned long long dt = (unsigned long long)interval;
+		return ((t/dt)+1)*dt;
+	}
+	return TS_NEVER;
+}
+
+TIMESTAMP scenario_set::commit(TIMESTAMP t)
+{
+	if ( interval > 0 )
+	{
+		unsigned long long dt = (unsigned long long)interval;
+		if ( t % dt == 0 )
+		{
+			solve(t);
+			++runcount;
+		}
+		return TS_NEVER;
+	}
+	solve(t);
+	++runcount;
+	return TS_NEVER;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// IMPLEMENTATION OF CORE LINKAGE: scenario_set
+//////////////////////////////////////////////////////////////////////////
+
+EXPORT int create_scenario_set(OBJECT **obj, OBJECT *parent)
+{
+	try
+	{
+		*obj = gl_create_object(scenario_set::oclass);
+		if (*obj!=NULL)
+		{
+			scenario_set *my = OBJECTDATA(*obj,scenario_set);
+			gl_set_parent(*obj,parent);
+			return my->create();
+		}
+		else
+			return 0;
+	}
+	CREATE_CATCHALL(scenario_set);
+}
+
+EXPORT int init_scenario_set(OBJECT *obj)
+{
+	try {
+		scenario_set *my = OBJECTDATA(obj,scenario_set);
+		return my->init(obj->parent);
+	}
+	INIT_CATCHALL(scenario_set);
+}
+
+EXPORT TIMESTAMP sync_scenario_set(OBJECT *obj, TIMESTAMP t1, PASSCONFIG pass)
+{
+	try
+	{
+		scenario_set *my = OBJECTDATA(obj,scenario_set);
+		obj->clock = t1;
+		return my->sync(t1);
+	}
+	SYNC_CATCHALL(scenario_set);
+}
+
+EXPORT TIMESTAMP commit_scenario_set(OBJECT *obj, TIMESTAMP t1, TIMESTAMP t2){
+	try {
+		scenario_set *my = OBJECTDATA(obj,scenario_set);
+		return my->commit(t1);
+	}
+	I_CATCHALL(commit,scenario_set);
+}
+
+EXPORT int finalize_scenario_set(OBJECT *obj)
+{
+	try {
+		scenario_set *my = OBJECTDATA(obj,scenario_set);
+		return my->finalize();
+	}
+	I_CATCHALL(finalize,scenario_set);
+}
+
+EXPORT int isa_scenario_set(OBJECT *obj, CLASSNAME classname)
+{
+	return OBJECTDATA(obj,scenario_set)->isa(classname);
+}
@@ -0,0 +1,51 @@
+// module/powerflow/scenario_set.h
+// Copyright (C) 2024 Regents of the Leland Stanford Junior University
+
+#ifndef _SCENARIO_SET_H
+#define _SCENARIO_SET_H
+
+#ifndef _POWERFLOW_H
+#error "this header must be included by powerflow.h"
+#endif
+
+typedef struct s_scenario_injection {
+	unsigned int scenario;	///< index of the scenario
+	OBJECT *node;			///< node the extra load is connected to
+	int phase;				///< voltage index of the phase (A/B/C, or 1/2 for triplex)
+	complex power;			///< extra constant power load
+} SCENARIOINJECTION;
+
+class scenario_set : public gld_object
+{
+public:
+	char1024 input_file;
+	char1024 output_file;
+	double interval;
+	int32 scenario_count;
+	int32 converged_count;
+	int32 runcount;
+private:
+	SCENARIOINJECTION *injection_list;	///< injections read from input_file
+	unsigned int injection_count;
+	char **scenario_names;				///< scenario labels, in order of first appearance
+	complex *scenario_power;			///< scenario x bus x phase extra loads passed to the solver
+	complex *scenario_voltage;			///< scenario x bus x phase voltages returned by the solver
+	int64 *scenario_iterations;
+	unsigned int allocated_buses;
+	FILE *outfile;						///< output file, kept open between runs
+	bool read_input(void);
+	bool allocate_arrays(void);
+	void solve(TIMESTAMP t);
+public:
+	static CLASS *oclass;
+public:
+	scenario_set(MODULE *mod);
+	int create(void);
+	int init(OBJECT *parent);
+	TIMESTAMP sync(TIMESTAMP t);
+	TIMESTAMP commit(TIMESTAMP t);
+	int isa(CLASSNAME classname);
+	int finalize(void);
+};
+
+#endif // _SCENARIO_SET_H
@@ -0,0 +1,501 @@
+/* $Id
+ * Level-scheduled forward-back sweep solver
+ *
+ * The object-based FBS solution takes one pass of the exec loop per sweep: node sync
+ * computes the load currents, link sync (bottom-up) accumulates them toward the swing
+ * node and link postsync (top-down) updates the voltages, with the objects locked as
+ * they go.  When powerflow::FBS_sweep_iterations is set, the swing node calls
+ * solver_fbs_sweep at the start of the top-down pass.  The feeder tree is extracted
+ * once into branch arrays ordered by depth level, and the sweeps are repeated on those
+ * arrays until the voltages settle.  The object passes that follow then only have to
+ * confirm the solution, so a timestep takes two or three passes instead of one pass per
+ * sweep.
+ *
+ * The branches of a level are independent once their from-nodes are known, so each level
+ * is split into tasks run on the core thread pool.  The breadth-first order keeps the
+ * branches leaving a node together, and a task always takes whole groups of them, so only
+ * one task adds currents into any from-node during the backward sweep.  Levels with too
+ * few branches to split are swept by the calling thread.
+ */
+
+#include "powerflow.h"
+
+//Branch of the radial feeder - a link, or a child node attached to its parent node
+typedef struct s_fbs_branch {
+	link_object *link;	///< link of the branch (NULL for a child node)
+	node *from;			///< upstream node
+	node *to;			///< downstream node
+} FBSBRANCH;
+
+//Items handled by the tasks of one pool run
+typedef struct s_fbs_work {
+	unsigned int *start;	///< first item of each task (one more entry than tasks)
+	bool *changed;			///< voltage change flag of each task (forward sweep)
+} FBSWORK;
+
+typedef enum {
+	FBS_UNBUILT=0,		///< tree not extracted yet
+	FBS_READY=1,		///< tree extracted, sweeps can run
+	FBS_DISABLED=2,		///< system can't be swept (not radial)
+} FBSSTATUS;
+
+static FBSSTATUS fbs_status = FBS_UNBUILT;
+static node **fbs_node = NULL;				///< every node of the system
+static unsigned int fbs_node_count = 0;
+static FBSBRANCH *fbs_branch = NULL;		///< branches in level order, breadth-first from the swing node
+static unsigned int fbs_branch_count = 0;
+static unsigned int *fbs_level_start = NULL;	///< first branch of each level (fbs_level_count+1 entries)
+static unsigned int fbs_level_count = 0;
+static unsigned int *fbs_level_task = NULL;		///< first task of each level (fbs_level_count+1 entries)
+static unsigned int *fbs_task_start = NULL;		///< first branch of each task, whole from-node groups
+static bool *fbs_task_changed = NULL;			///< voltage change flag of each task
+static unsigned int *fbs_node_task_start = NULL;	///< first node of each current injection task
+static unsigned int fbs_node_task_count = 0;
+static TPBATCH *fbs_batch = NULL;
+
+//Fewest branches (or nodes) worth handing to a pool task
+#define FBS_TASK_ITEMS 256
+
+//Split each level into up to one task per pool worker, without splitting the branches of a from-node
+static void fbs_split_tasks(void)
+{
+	unsigned int pool_size = gl_threadpool_size();
+	unsigned int level, first, last, count, n_tasks, task, next;
+
+	if (pool_size < 1)
+		pool_size = 1;
+
+	fbs_level_task = (unsigned int*)gl_malloc((fbs_level_count+1)*sizeof(unsigned int));
+	fbs_task_start = (unsigned int*)gl_malloc((fbs_branch_count+fbs_level_count+1)*sizeof(unsigned int));
+	fbs_task_changed = (bool*)gl_malloc((fbs_branch_count+1)*sizeof(bool));
+	fbs_node_task_start = (unsigned int*)gl_malloc((pool_size+1)*sizeof(unsigned int));
+
+	if ((fbs_level_task==NULL) || (fbs_task_start==NULL) || (fbs_task_changed==NULL) || (fbs_node_task_start==NULL))
+	{
+		GL_THROW("FBS sweep: failed to allocate memory for the feeder tree");
+		//Defined above
+	}
+
+	//Each level's tasks are stored as a run of start branches, closed by the next level's first task
+	count = 0;
+	for (level=0; level<fbs_level_count; level++)
+	{
+		first = fbs_level_start[level];
+		last = fbs_level_start[level+1];
+		n_tasks = (last - first) / FBS_TASK_ITEMS;
+		if (n_tasks > pool_size)
+			n_tasks = pool_size;
+		if (n_tasks < 1)
+			n_tasks = 1;
+
+		fbs_level_task[level] = count;
+		fbs_task_start[count++] = first;
+		for (task=1; task<n_tasks; task++)
+		{
+			//Move the even split forward to the start of the next from-node's branches
+			next = first + (unsigned int)(((unsigned long long)(last - first) * task) / n_tasks);
+			if (next <= fbs_task_start[count-1])
+				next = fbs_task_start[count-1] + 1;
+			while ((next < last) && (fbs_branch[next].from == fbs_branch[next-1].from))
+				next++;
+			if (next >= last)
+				break;
+			fbs_task_start[count++] = next;
+		}
+	}
+	fbs_level_task[fbs_level_count] = count;
+	fbs_task_start[count] = fbs_branch_count;
+
+	//Nodes are independent for the current injections
+	n_tasks = fbs_node_count / FBS_TASK_ITEMS;
+	if (n_tasks > pool_size)
+		n_tasks = pool_size;
+	if (n_tasks < 1)
+		n_tasks = 1;
+	for (task=0; task<=n_tasks; task++)
+		fbs_node_task_start[task] = (unsigned int)(((unsigned long long)fbs_node_count * task) / n_tasks);
+	fbs_node_task_count = n_tasks;
+
+	fbs_batch = gl_threadpool_batch("powerflow FBS sweep");
+}
+
+//Extract the radial tree below the swing node - links whose to-node they parent and child nodes
+static bool fbs_build(OBJECT *swing)
+{
+	FINDLIST *list = gl_find_objects(FL_NEW,FT_MODULE,SAME,"powerflow",FT_END);
+	OBJECT *obj = NULL;
+	unsigned int max_id = 0, temp_count = 0, visited = 0, head, tail, index, jindex;
+	unsigned int *node_index = NULL, *node_level = NULL, *child_start = NULL, *child_list = NULL, *queue = NULL;
+	FBSBRANCH *temp_branch = NULL;
+	unsigned int *temp_from = NULL, *temp_to = NULL;
+	bool radial = true;
+
+	if (list==NULL)
+		return false;
+
+	//Count the nodes and branches
+	fbs_node_count = 0;
+	while ((obj=gl_find_next(list,obj))!=NULL)
+	{
+		if (gl_object_isa(obj,"node","powerflow"))
+		{
+			fbs_node_count++;
+			if (obj->id > max_id)
+				max_id = obj->id;
+			if ((obj->parent!=NULL) && gl_object_isa(obj->parent,"node","powerflow"))
+				temp_count++;
+		}
+		else if (gl_object_isa(obj,"link","powerflow"))
+			temp_count++;
+	}
+
+	fbs_node = (node**)gl_malloc(fbs_node_count*sizeof(node*));
+	fbs_branch = (FBSBRANCH*)gl_malloc((temp_count+1)*sizeof(FBSBRANCH));
+	fbs_level_start = (unsigned int*)gl_malloc((temp_count+2)*sizeof(unsigned int));
+	node_index = (unsigned int*)gl_malloc((max_id+1)*sizeof(unsigned int));
+	node_level = (unsigned int*)gl_malloc(fbs_node_count*sizeof(unsigned int));
+	child_start = (unsigned int*)gl_malloc((fbs_node_count+1)*sizeof(unsigned int));
+	child_list = (unsigned int*)gl_malloc((temp_count+1)*sizeof(unsigned int));
+	queue = (unsigned int*)gl_malloc(fbs_node_count*sizeof(unsigned int));
+	temp_branch = (FBSBRANCH*)gl_malloc((temp_count+1)*sizeof(FBSBRANCH));
+	temp_from = (unsigned int*)gl_malloc((temp_count+1)*sizeof(unsigned int));
+	temp_to = (unsigned int*)gl_malloc((temp_count+1)*sizeof(unsigned int));
+
+	if ((fbs_node==NULL) || (fbs_branch==NULL) || (fbs_level_start==NULL) || (node_index==NULL) || (node_level==NULL) || (child_start==NULL) || (child_list==NULL) || (queue==NULL) || (temp_branch==NULL) || (temp_from==NULL) || (temp_to==NULL))
+	{
+		GL_THROW("FBS sweep: failed to allocate memory for the feeder tree");
+		/*  TROUBLESHOOT
+		While extracting the feeder tree for the level-scheduled forward-back sweep, the memory
+		allocation failed.  Please try again.  If the error persists, set powerflow::FBS_sweep_iterations
+		to 0 and submit your code and a bug report via the issue tracker.
+		*/
+	}
+
+	//Index the nodes
+	fbs_node_count = 0;
+	obj = NULL;
+	while ((obj=gl_find_next(list,obj))!=NULL)
+	{
+		if (gl_object_isa(obj,"node","powerflow"))
+		{
+			node_index[obj->id] = fbs_node_count;
+			fbs_node[fbs_node_count++] = OBJECTDATA(obj,node);
+		}
+	}
+
+	//Collect the branches - each to-node must be parented by its own link (radial)
+	temp_count = 0;
+	obj = NULL;
+	while ((obj=gl_find_next(list,obj))!=NULL)
+	{
+		if (gl_object_isa(obj,"node","powerflow"))
+		{
+			if ((obj->parent!=NULL) && gl_object_isa(obj->parent,"node","powerflow"))
+			{
+				temp_branch[temp_count].link = NULL;
+				temp_branch[temp_count].from = OBJECTDATA(obj->parent,node);
+				temp_branch[temp_count].to = OBJECTDATA(obj,node);
+				temp_from[temp_count] = node_index[obj->parent->id];
+				temp_to[temp_count] = node_index[obj->id];
+				temp_count++;
+			}
+		}
+		else if (gl_object_isa(obj,"link","powerflow"))
+		{
+			link_object *plink = OBJECTDATA(obj,link_object);
+
+			if ((plink->from==NULL) || (plink->to==NULL) || (plink->to->parent!=obj) || !gl_object_isa(plink->from,"node","powerflow") || !gl_object_isa(plink->to,"node","powerflow"))
+			{
+				radial = false;
+				break;
+			}
+
+			temp_branch[temp_count].link = plink;
+			temp_branch[temp_count].from = OBJECTDATA(plink->from,node);
+			temp_branch[temp_count].to = OBJECTDATA(plink->to,node);
+			temp_from[temp_count] = node_index[plink->from->id];
+			temp_to[temp_count] = node_index[plink->to->id];
+			temp_count++;
+		}
+	}
+
+	if (radial)
+	{
+		//Branches leaving each node (compressed rows)
+		for (index=0; index<=fbs_node_count; index++)
+			child_start[index] = 0;
+		for (index=0; index<temp_count; index++)
+			child_start[temp_from[index]+1]++;
+		for (index=0; index<fbs_node_count; index++)
+			child_start[index+1] += child_start[index];
+		for (index=0; index<fbs_node_count; index++)
+			queue[index] = child_start[index];
+		for (index=0; index<temp_count; index++)
+			child_list[queue[temp_from[index]]++] = index;
+
+		//Breadth-first from the swing node - the branches come out in level order
+		for (index=0; index<fbs_node_count; index++)
+			node_level[index] = (unsigned int)-1;
+
+		index = node_index[swing->id];
+		node_level[index] = 0;
+		queue[0] = index;
+		head = 0;
+		tail = 1;
+		fbs_branch_count = 0;
+		fbs_level_count = 0;
+		while ((head < tail) && radial)
+		{
+			index = queue[head++];
+			for (jindex=child_start[index]; jindex<child_start[index+1]; jindex++)
+			{
+				unsigned int to_index = temp_to[child_list[jindex]];
+
+				//A node reached twice is a loop
+				if (node_level[to_index] != (unsigned int)-1)
+				{
+					radial = false;
+					break;
+				}
+				node_level[to_index] = node_level[index] + 1;
+				queue[tail++] = to_index;
+
+				//Start a new level when the depth increases
+				if (node_level[to_index] > fbs_level_count)
+					fbs_level_start[fbs_level_count++] = fbs_branch_count;
+
+				fbs_branch[fbs_branch_count++] = temp_branch[child_list[jindex]];
+			}
+		}
+		fbs_level_start[fbs_level_count] = fbs_branch_count;
+		visited = tail;
+	}
+
+	gl_free(node_index);
+	gl_free(node_level);
+	gl_free(child_start);
+	gl_free(child_list);
+	gl_free(queue);
+	gl_free(temp_branch);
+	gl_free(temp_from);
+	gl_free(temp_to);
+
+	//Every node must hang off the swing node
+	if (!radial || (visited != fbs_node_count))
+	{
+		gl_warning("FBS sweep: the system is not a single radial feeder, FBS_sweep_iterations is ignored");
+		/*  TROUBLESHOOT
+		The level-scheduled forward-back sweep needs every node to be reached from the swing node through
+		exactly one link.  Loops, islands, or links that do not parent their to-node prevent it, so the
+		object-based forward-back sweep is used alone.  Remove the loops or islands, or set
+		powerflow::FBS_sweep_iterations to 0 to suppress this warning.
+		*/
+		return false;
+	}
+
+	fbs_split_tasks();
+
+	gl_verbose("FBS sweep: %u nodes, %u branches in %u levels, %u tasks", fbs_node_count, fbs_branch_count, fbs_level_count, fbs_level_task[fbs_level_count]);
+	return true;
+}
+
+//Forward sweep of one branch - returns true when the to-node voltage moved more than its error limit
+static bool fbs_forward(FBSBRANCH *pBranch)
+{
+	node *f = pBranch->from;
+	node *t = pBranch->to;
+	complex prev_voltage[3];
+	double sync_V;
+	int kindex;
+
+	prev_voltage[0] = t->voltage[0];
+	prev_voltage[1] = t->voltage[1];
+	prev_voltage[2] = t->voltage[2];
+
+	if (pBranch->link == NULL)
+	{
+		//Child nodes take their parent's voltage
+		t->voltage[0] = f->voltage[0];
+		t->voltage[1] = f->voltage[1];
+		t->voltage[2] = f->voltage[2];
+	}
+	else if (pBranch->link->is_closed())	//Same in-service test as the backward sweep
+	{
+		complex (*A_mat)[3] = pBranch->link->A_mat;
+		complex (*B_mat)[3] = pBranch->link->B_mat;
+		complex *t_inj = t->get_current_injection();
+		complex tc[] = {t_inj[0], t_inj[1], t_inj[2]};
+
+		for (kindex=0; kindex<3; kindex++)
+		{
+			t->voltage[kindex] =
+				A_mat[kindex][0] * f->voltage[0] +
+				A_mat[kindex][1] * f->voltage[1] +
+				A_mat[kindex][2] * f->voltage[2] -
+				B_mat[kindex][0] * tc[0] -
+				B_mat[kindex][1] * tc[1] -
+				B_mat[kindex][2] * tc[2];
+		}
+	}
+
+	//Same test as node postsync
+	sync_V = (prev_voltage[0]-t->voltage[0]).Mag() + (prev_voltage[1]-t->voltage[1]).Mag() + (prev_voltage[2]-t->voltage[2]).Mag();
+	return (sync_V > t->maximum_voltage_error);
+}
+
+//Load currents of one node at its present voltages
+static void fbs_inject(node *pNode)
+{
+	if (pNode->has_phase(PHASE_S))
+	{
+		pNode->voltaged[0] = pNode->voltage[0] + pNode->voltage[1];	//V12
+		pNode->voltaged[1] = pNode->voltage[1] - pNode->voltage[2];	//V2N
+		pNode->voltaged[2] = pNode->voltage[0] - pNode->voltage[2];	//V1N
+	}
+	else
+	{
+		pNode->voltaged[0] = pNode->voltage[0] - pNode->voltage[1];	//AB
+		pNode->voltaged[1] = pNode->voltage[1] - pNode->voltage[2];	//BC
+		pNode->voltaged[2] = pNode->voltage[2] - pNode->voltage[0];	//CA
+	}
+
+	complex *inj = pNode->get_current_injection();
+	inj[0] = inj[1] = inj[2] = complex(0,0);
+	pNode->FBS_current_injection();
+}
+
+//Backward sweep of one branch - adds the to-node current into the from-node
+static void fbs_backward(FBSBRANCH *pBranch)
+{
+	node *f = pBranch->from;
+	node *t = pBranch->to;
+	complex *f_inj = f->get_current_injection();
+	complex *t_inj = t->get_current_injection();
+	int kindex;
+
+	if (pBranch->link == NULL)
+	{
+		f_inj[0] += t_inj[0];
+		f_inj[1] += t_inj[1];
+		f_inj[2] += t_inj[2];
+	}
+	else if (pBranch->link->is_closed())
+	{
+		complex (*c_mat)[3] = pBranch->link->c_mat;
+		complex (*d_mat)[3] = pBranch->link->d_mat;
+		complex *current_in = pBranch->link->current_in;
+
+		for (kindex=0; kindex<3; kindex++)
+		{
+			current_in[kindex] =
+				c_mat[kindex][0] * t->voltage[0] +
+				c_mat[kindex][1] * t->voltage[1] +
+				c_mat[kindex][2] * t->voltage[2] +
+				d_mat[kindex][0] * t_inj[0] +
+				d_mat[kindex][1] * t_inj[1] +
+				d_mat[kindex][2] * t_inj[2];
+		}
+
+		f_inj[0] += current_in[0];
+		f_inj[1] += current_in[1];
+		f_inj[2] += current_in[2];
+	}
+}
+
+//Pool tasks - each takes the items from its start entry up to the next one
+static void fbs_forward_task(void *data, unsigned int task)
+{
+	FBSWORK *work = (FBSWORK*)data;
+	unsigned int index;
+	bool changed = false;
+
+	for (index=work->start[task]; index<work->start[task+1]; index++)
+	{
+		if (fbs_forward(&fbs_branch[index]))
+			changed = true;
+	}
+	work->changed[task] = changed;
+}
+
+static void fbs_inject_task(void *data, unsigned int task)
+{
+	FBSWORK *work = (FBSWORK*)data;
+	unsigned int index;
+
+	for (index=work->start[task]; index<work->start[task+1]; index++)
+		fbs_inject(fbs_node[index]);
+}
+
+static void fbs_backward_task(void *data, unsigned int task)
+{
+	FBSWORK *work = (FBSWORK*)data;
+	unsigned int index;
+
+	for (index=work->start[task]; index<work->start[task+1]; index++)
+		fbs_backward(&fbs_branch[index]);
+}
+
+//Run the tasks of one level (or of the node list) - on the pool when there is more than one
+static void fbs_run(TPTASKCALL call, FBSWORK *work, unsigned int n_tasks)
+{
+	unsigned int task;
+
+	if (n_tasks > 1)
+		gl_threadpool_run(fbs_batch,call,work,n_tasks);
+	else
+	{
+		for (task=0; task<n_tasks; task++)
+			call(work,task);
+	}
+}
+
+int solver_fbs_sweep(OBJECT *swing)
+{
+	unsigned int level, task, sweeps, n_tasks;
+	FBSWORK work;
+	bool voltage_changed;
+
+	if (fbs_status == FBS_UNBUILT)
+		fbs_status = fbs_build(swing) ? FBS_READY : FBS_DISABLED;
+	if (fbs_status != FBS_READY)
+		return -1;
+
+	for (sweeps=0; sweeps<(unsigned int)FBS_sweep_iterations; sweeps++)
+	{
+		//Forward sweep - update the voltages level by level from the present injections
+		voltage_changed = false;
+		for (level=0; level<fbs_level_count; level++)
+		{
+			n_tasks = fbs_level_task[level+1] - fbs_level_task[level];
+			work.start = &fbs_task_start[fbs_level_task[level]];
+			work.changed = &fbs_task_changed[fbs_level_task[level]];
+			fbs_run(fbs_forward_task,&work,n_tasks);
+
+			for (task=0; task<n_tasks; task++)
+			{
+				if (work.changed[task])
+					voltage_changed = true;
+			}
+		}
+
+		//The injections are consistent with these voltages - let the object passes confirm them
+		if (!voltage_changed)
+			break;
+
+		//Load currents at the new voltages
+		work.start = fbs_node_task_start;
+		work.changed = NULL;
+		fbs_run(fbs_inject_task,&work,fbs_node_task_count);
+
+		//Backward sweep - accumulate the currents toward the swing node, deepest level first
+		for (level=fbs_level_count; level>0; level--)
+		{
+			work.start = &fbs_task_start[fbs_level_task[level-1]];
+			fbs_run(fbs_backward_task,&work,fbs_level_task[level]-fbs_level_task[level-1]);
+		}
+
+		FBS_sweep_count++;
+	}
+
+	return (int)sweeps;
+}
@@ -0,0 +1,16 @@
+/* $Id
+ * Level-scheduled forward-back sweep solver
+ */
+
+#ifndef _SOLVER_FBS
+#define _SOLVER_FBS
+
+#include "gridlabd.h"
+
+/** Run the level-scheduled forward-back sweeps of a radial FBS system
+	@param swing the swing node at the root of the feeder
+	@return the number of inner sweeps performed, or -1 if the system cannot be swept (not radial)
+ **/
+int solver_fbs_sweep(OBJECT *swing);
+
+#endif
@@ -67,6 +67,14 @@ typedef struct {
 	int *perm_r;
 	SuperMatrix A_LU;
 	SuperMatrix B_LU;
+	SuperMatrix L_LU;			//Retained factors for NR_chord_newton
+	SuperMatrix U_LU;
+	bool factors_valid;			//L_LU/U_LU (and perm_c/perm_r) hold a usable factorization
+	bool refactor_needed;		//Convergence degraded - factor on the next iteration
+	unsigned int factor_m;		//Size and non-zero count of the factored matrix
+	unsigned int factor_nnz;
+	double last_mismatch;		//Mismatch of the previous iteration, for the convergence rate check
+	bool linear_check;			//A linear update was applied - its current mismatch is checked on the next iteration
 } SUPERLU_NR_vars;
 
 //Initialize the sparse notation
@@ -318,6023 +326,7420 @@ void sparse_tonr(SPARSE* sm, NR_SOLVER_VARS *matrices_LUin)
 	}
 }
 
-/** Newton-Raphson solver
-	Solves a power flow problem using the Newton-Raphson method
-	
-	@return n=0 on failure to complete a single iteration, 
-	n>0 to indicate success after n interations, or 
-	n<0 to indicate failure after n iterations
- **/
-int64 solver_nr(unsigned int bus_count, 
-				BUSDATA *bus, 
-				unsigned int branch_count, 
-				BRANCHDATA *branch, 
-				NR_SOLVER_STRUCT *powerflow_values, 
-				NRSOLVERMODE powerflow_type , 
-				NR_MESHFAULT_IMPEDANCE *mesh_imped_vals, 
-				bool *bad_computations)
+//Non-zero pattern of a branch's off-diagonal admittance terms - determines the entries it places in Y_offdiag_PQ
+unsigned long long branch_offdiag_pattern(BRANCHDATA *branch_val)
 {
-	// Begin solver timer
-	clock_t t_start = clock();
+	unsigned long long pattern = 0;
+	int index;
 
-	//Internal iteration counter - just NR limits
-	int64 Iteration = 0;
+	for (index=0; index<9; index++)
+	{
+		if (branch_val->Yfrom[index].Re() != 0)
+			pattern |= (1ULL << (4*index));
+		if (branch_val->Yfrom[index].Im() != 0)
+			pattern |= (1ULL << (4*index+1));
+		if (branch_val->Yto[index].Re() != 0)
+			pattern |= (1ULL << (4*index+2));
+		if (branch_val->Yto[index].Im() != 0)
+			pattern |= (1ULL << (4*index+3));
+	}
 
-	try
+	return pattern;
+}
+
+//Non-zero pattern of a bus's off-diagonal self-admittance terms - determines the entries it places in Y_diag_fixed
+unsigned int bus_diag_fixed_pattern(Bus_admit *diag_val)
+{
+	unsigned int pattern = 0;
+	int jindex, kindex;
+
+	for (jindex=0; jindex<3; jindex++)
 	{
-		if ( solver_python_init() == 0 )
+		for (kindex=0; kindex<3; kindex++)
 		{
-			Iteration = solver_python_solve(bus_count,bus,branch_count,branch,powerflow_values,powerflow_type,mesh_imped_vals,bad_computations,Iteration);
-			if ( Iteration == 0 )
-			{		
-					return Iteration;
+			if (jindex != kindex)
+			{
+				if ((diag_val->Y[jindex][kindex]).Re() != 0)
+					pattern |= (1 << (2*(jindex*3+kindex)));
+				if ((diag_val->Y[jindex][kindex]).Im() != 0)
+					pattern |= (1 << (2*(jindex*3+kindex)+1));
 			}
-			// else <0 proceed with NR solver
 		}
 	}
-	catch (const char *msg)
-	{
-		gl_warning("solver_py: model failed -- %s",msg);
-	}
-	catch (...)
-	{
-		gl_warning("solver_py: model failed -- unknown exception");
-	}
 
-	//Index for "islanding operations", when needed
-	int island_index_val;
+	return pattern;
+}
 
-	//Temporary island looping value
-	int island_loop_index;
+//Voltage predictor - extrapolates the starting voltages of the PQ buses from the last two converged static solutions
+//Only buses still holding the last converged voltage are adjusted (anything set externally is left alone)
+static void NR_predict_voltages(unsigned int bus_count, BUSDATA *bus, NR_SOLVER_STRUCT *powerflow_values)
+{
+	unsigned int indexer, jindexer;
+	double step_ratio;
+	complex *V_last, *V_prev;
+	bool unchanged;
 
-	int64 return_value_for_solver_NR;
+	//Make sure we have two solutions for this system, and this is a new timestep
+	if ((powerflow_values->V_history == NULL) || (powerflow_values->V_history_buses != bus_count))
+		return;
 
-	// begin timed block
-	{
-		SolverTimer timer("newton-raphson");
+	if ((powerflow_values->V_history_time[1] <= 0) || (powerflow_values->V_history_time[0] <= powerflow_values->V_history_time[1]) || (gl_globalclock <= powerflow_values->V_history_time[0]))
+		return;
 
-		//File pointer for debug outputs
-		FILE *FPoutVal;
+	//Scale the last change by the relative step size - capped at one step, so long gaps don't extrapolate wildly
+	step_ratio = (double)(gl_globalclock - powerflow_values->V_history_time[0])/(double)(powerflow_values->V_history_time[0] - powerflow_values->V_history_time[1]);
 
-		int func_result_val;
+	if (step_ratio > 1.0)
+		step_ratio = 1.0;
 
-		//Temporary function variable
-		FUNCTIONADDR temp_fxn_val;
+	for (indexer=0; indexer<bus_count; indexer++)
+	{
+		//Only PQ buses - SWING and PV voltages are set, not solved
+		if (bus[indexer].type != 0)
+			continue;
 
-		//Generic status variable
-		STATUS call_return_status;
+		V_last = &powerflow_values->V_history[indexer*3];
+		V_prev = &powerflow_values->V_history[(bus_count+indexer)*3];
 
-		//Phase collapser variable
-		unsigned char phase_worka, phase_workb, phase_workc, phase_workd, phase_worke;
+		//See if something else changed the voltage since the last solution - also skip anything
+		//de-energized or re-energized between the two solutions (a zeroed phase isn't a trend)
+		unchanged = true;
+		for (jindexer=0; jindexer<3; jindexer++)
+		{
+			if ((bus[indexer].V[jindexer].Re() != V_last[jindexer].Re()) || (bus[indexer].V[jindexer].Im() != V_last[jindexer].Im()))
+			{
+				unchanged = false;
+				break;
+			}
 
-		//Temporary calculation variables
-		double tempIcalcReal, tempIcalcImag;
-		double tempPbus; //tempPbus store the temporary value of active power load at each bus
-		double tempQbus; //tempQbus store the temporary value of reactive power load at each bus
+			if (((V_last[jindexer].Re() == 0.0) && (V_last[jindexer].Im() == 0.0)) != ((V_prev[jindexer].Re() == 0.0) && (V_prev[jindexer].Im() == 0.0)))
+			{
+				unchanged = false;
+				break;
+			}
+		}
 
-		//Miscellaneous index variable
-		unsigned int indexer, tempa, tempb, jindexer, kindexer;
-		int jindex, kindex;
-		int temp_index, temp_index_b;
-		unsigned int temp_index_c;
+		if (unchanged == true)
+		{
+			for (jindexer=0; jindexer<3; jindexer++)
+			{
+				bus[indexer].V[jindexer] = V_last[jindexer] + (V_last[jindexer] - V_prev[jindexer]) * step_ratio;
+				powerflow_values->V_predicted[powerflow_values->V_predicted_count*3+jindexer] = bus[indexer].V[jindexer];
+			}
 
-		//Working matrix for admittance collapsing/determinations
-		complex tempY[3][3];
+			//Keep it, so the solve history can see how close the prediction was
+			powerflow_values->V_predicted_bus[powerflow_values->V_predicted_count++] = indexer;
+		}
+	}
+}
 
-		//Working matrix for mesh fault impedance storage, prior to "reconstruction"
-		double temp_z_store[6][6];
+//Records a static solution - its iteration count and predictor error go into the solve history, and
+//the converged voltages are stored for the voltage predictor
+static void NR_record_voltages(unsigned int bus_count, BUSDATA *bus, NR_SOLVER_STRUCT *powerflow_values, int64 iterations, bool converged)
+{
+	unsigned int indexer, jindexer, bus_index;
+	double error_val, max_error;
+	NR_SOLVE_RECORD *record;
 
-		//Miscellaneous flag variables
-		bool Full_Mat_A, Full_Mat_B, proceed_flag;
+	//Add it to the solve history, if one is being kept
+	if (NR_solve_history_size > 0)
+	{
+		//Allocate (or reallocate if the size changed) - history starts over
+		if ((powerflow_values->solve_history == NULL) || (powerflow_values->solve_history_size != (unsigned int)NR_solve_history_size))
+		{
+			if (powerflow_values->solve_history != NULL)
+			{
+				gl_free(powerflow_values->solve_history);
+			}
 
-		//Deltamode intermediate variables
-		complex temp_complex_0, temp_complex_1, temp_complex_2, temp_complex_3, temp_complex_4;
-		complex aval, avalsq;
+			powerflow_values->solve_history = (NR_SOLVE_RECORD *)gl_malloc(NR_solve_history_size*sizeof(NR_SOLVE_RECORD));
 
-		//Temporary size variable
-		int temp_size, temp_size_b, temp_size_c;
+			if (powerflow_values->solve_history == NULL)
+			{
+				GL_THROW("NR: Failed to allocate the solve history");
+				/*  TROUBLESHOOT
+				While attempting to allocate the memory to keep the iteration counts of recent powerflow solutions
+				(NR_solve_history_size), an error was encountered.  Please try again with a smaller size.  If the
+				error persists, please submit your code and a bug report via the issues tracker.
+				*/
+			}
 
-		//Temporary admittance variables
-		complex Temp_Ad_A[3][3];
-		complex Temp_Ad_B[3][3];
+			powerflow_values->solve_history_size = NR_solve_history_size;
+			powerflow_values->solve_history_next = 0;
+			powerflow_values->solve_history_count = 0;
+		}
 
-		//DV checking array
-		complex DVConvCheck[3];
-		double CurrConvVal;
+		//Largest difference between where the predictor started and where the solution ended up
+		max_error = 0.0;
+		if ((converged == true) && (powerflow_values->V_predicted_count > 0))
+		{
+			for (indexer=0; indexer<powerflow_values->V_predicted_count; indexer++)
+			{
+				bus_index = powerflow_values->V_predicted_bus[indexer];
 
-		//Miscellaneous working variable
-		double work_vals_double_0, work_vals_double_1,work_vals_double_2,work_vals_double_3,work_vals_double_4;
-		size_t work_vals_char_0;
-		bool something_has_been_output;
+				//No base to put it in per-unit
+				if (bus[bus_index].volt_base <= 0.0)
+					continue;
 
-		//SuperLU variables
-		SuperMatrix L_LU,U_LU;
-		NCformat *Astore;
-		DNformat *Bstore;
-		int nnz, info;
-		unsigned int m,n;
-		double *sol_LU;
+				for (jindexer=0; jindexer<3; jindexer++)
+				{
+					error_val = (bus[bus_index].V[jindexer] - powerflow_values->V_predicted[indexer*3+jindexer]).Mag()/bus[bus_index].volt_base;
 
-		//Spare notation variable - for output
-		SP_E *temp_element;
-		int row, col;
-		double value;
+					if (error_val > max_error)
+						max_error = error_val;
+				}
+			}
+		}
 
-		//Multi-island passes
-		bool still_iterating_islands;
-		bool proceed_to_next_island;
+		//Overwrite the oldest entry
+		record = &powerflow_values->solve_history[powerflow_values->solve_history_next];
+		record->solve_time = gl_globalclock;
+		record->iterations = iterations;
+		record->converged = converged;
+		record->predicted_buses = powerflow_values->V_predicted_count;
+		record->predictor_error = max_error;
 
-		//Multi-island pointer to current superLU variables
-		SUPERLU_NR_vars *curr_island_superLU_vars;
-	
-#ifndef MT
-		superlu_options_t options;	//Additional variables for sequential superLU
-		SuperLUStat_t stat;
-#endif
+		powerflow_values->solve_history_next = (powerflow_values->solve_history_next + 1) % powerflow_values->solve_history_size;
 
-		//Set the global - we're working now, so no more adjustments to island arrays until we're done (except removals)
-		NR_solver_working = true;
+		if (powerflow_values->solve_history_count < powerflow_values->solve_history_size)
+			powerflow_values->solve_history_count++;
+	}
 
-		//General "short circuit check" - if there are no islands, just leave
-		if (NR_islands_detected <= 0)
-		{
-			//Make sure the bad computations flag is set
-			*bad_computations = false;
+	//Later solutions of this timestep start from where this one ended
+	powerflow_values->V_predicted_count = 0;
 
-			return 0;	//Not really a valid return, but with the false above, should still continue
-		}
+	//Only converged voltages are worth extrapolating from
+	if ((NR_voltage_predictor == false) || (converged == false))
+		return;
 
-		//Initialize the tracker variable inside each island, just in case
-		for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
+	//Allocate (or reallocate if the system size changed) - history starts over
+	if ((powerflow_values->V_history == NULL) || (powerflow_values->V_history_buses != bus_count))
+	{
+		if (powerflow_values->V_history != NULL)
 		{
-			powerflow_values->island_matrix_values[island_loop_index].index_count = 0;
+			gl_free(powerflow_values->V_history);
+			gl_free(powerflow_values->V_predicted);
+			gl_free(powerflow_values->V_predicted_bus);
 		}
 
-		//Ensure bad computations flag is set first
-		*bad_computations = false;
-
-		//Determine special circumstances of SWING bus -- do we want it to truly participate right
-		if (powerflow_type != PF_NORMAL)
-		{
-			if (powerflow_type == PF_DYNCALC)	//Parse the list -- anything that is a swing and a generator, deflag it out of principle (and to make it work right)
-			{
-				//Set the master swing flag - do for all islands
-				for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
-				{
-					powerflow_values->island_matrix_values[island_loop_index].swing_is_a_swing = false;
-				}
+		powerflow_values->V_history = (complex *)gl_malloc(2*bus_count*3*sizeof(complex));
+		powerflow_values->V_predicted = (complex *)gl_malloc(bus_count*3*sizeof(complex));
+		powerflow_values->V_predicted_bus = (unsigned int *)gl_malloc(bus_count*sizeof(unsigned int));
 
-				//Check the buses
-				for (indexer=0; indexer<bus_count; indexer++)
-				{
-					//See if we're a swing-flagged bus
-					if ((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == true))
-					{
-						//See if we're "generator ready"
-						if ((*bus[indexer].dynamics_enabled==true) && (bus[indexer].DynCurrent != NULL))
-						{
-							//Deflag us back to "PQ" status
-							bus[indexer].swing_functions_enabled = false;
-						}
-					}
-					//Default else -- normal bus
-				}//End bus traversion loop
-			}//Handle running dynamics differently
-			else	//Must be PF_DYNINIT
-			{
-				//Loop through the islands
-				for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
-				{
-					//Flag us as true, initially
-					powerflow_values->island_matrix_values[island_loop_index].swing_is_a_swing = true;
-				}
-			}
-		}//End not normal
-		else	//Must be normal
+		if ((powerflow_values->V_history == NULL) || (powerflow_values->V_predicted == NULL) || (powerflow_values->V_predicted_bus == NULL))
 		{
-			//Loop through all islands
-			for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
-			{
-				powerflow_values->island_matrix_values[island_loop_index].swing_is_a_swing = true;	//Flag as a swing, even though this shouldn't do anything
-			}
+			GL_THROW("NR: Failed to allocate voltage predictor history");
+			/*  TROUBLESHOOT
+			While attempting to allocate the memory to store previous voltage solutions for the NR_voltage_predictor,
+			an error was encountered.  Please try again.  If the error persists, please submit your code and a bug
+			report via the issues tracker.
+			*/
 		}
 
-		//Populate aval, if necessary
-		if (powerflow_type == PF_DYNINIT)
-		{
-			//Conversion variables - 1@120-deg
-			aval = complex(-0.5,(sqrt(3.0)/2.0));
-			avalsq = aval*aval;	//squared value is used a couple places too
-		}
-		else	//Zero it, just in case something uses it (what would???)
+		powerflow_values->V_history_buses = bus_count;
+		powerflow_values->V_history_time[0] = 0;
+		powerflow_values->V_history_time[1] = 0;
+	}
+
+	//New timestep - the last solution becomes the previous one
+	if (gl_globalclock != powerflow_values->V_history_time[0])
+	{
+		for (indexer=0; indexer<(bus_count*3); indexer++)
 		{
-			aval = 0.0;
-			avalsq = 0.0;
+			powerflow_values->V_history[bus_count*3+indexer] = powerflow_values->V_history[indexer];
 		}
 
-		if (matrix_solver_method==MM_EXTERN)
-		{
-			for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
-			{
-				//Call the initialization routine
-				powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars = ((void *(*)(void *))(LUSolverFcns.ext_init))(powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars);
+		powerflow_values->V_history_time[1] = powerflow_values->V_history_time[0];
+		powerflow_values->V_history_time[0] = gl_globalclock;
+	}
+	//Default else - same timestep, just keep the latest
 
-				//Make sure it worked (allocation check)
-				if (powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars==NULL)
-				{
-					GL_THROW("External LU matrix solver failed to allocate memory properly!");
-					/*  TROUBLESHOOT
-					While attempting to allocate memory for the external LU solver, an error occurred.
-					Please try again.  If the error persists, ensure your external LU solver is behaving correctly
-					and coordinate with their development team as necessary.
-					*/
-				}
-			}//End Island loop
-		}
-		else if (matrix_solver_method == MM_SUPERLU)	//SuperLU multi-island-related item
+	for (indexer=0; indexer<bus_count; indexer++)
+	{
+		for (jindexer=0; jindexer<3; jindexer++)
 		{
-			//Loop through and see if we need to allocate things
-			for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
-			{
-				//See if the superLU variables are populated
-				if (powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars == NULL)
-				{
-					//Allocate one up
-					curr_island_superLU_vars = (SUPERLU_NR_vars *)gl_malloc(sizeof(SUPERLU_NR_vars));
+			powerflow_values->V_history[indexer*3+jindexer] = bus[indexer].V[jindexer];
+		}
+	}
+}
 
-					//Make sure it worked
-					if (curr_island_superLU_vars == NULL)
-					{
-						GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
-						//Defined elsewhere
-					}
+//Writes the solve history (oldest first) to a CSV file
+void NR_solve_history_dump(NR_SOLVER_STRUCT *powerflow_values, char *filename)
+{
+	unsigned int indexer, entry_index;
+	FILE *FPOutput;
+	NR_SOLVE_RECORD *record;
+	char time_buffer[64];
 
-					//Initialize it, for giggles/paranoia
-					curr_island_superLU_vars->A_LU.Store = NULL;
+	FPOutput = fopen(filename,"wt");
 
-					//Do the same for the underlying properties, just because
-					curr_island_superLU_vars->A_LU.Stype = SLU_NC;
-					curr_island_superLU_vars->A_LU.Dtype = SLU_D;
-					curr_island_superLU_vars->A_LU.Mtype = SLU_GE;
-					curr_island_superLU_vars->A_LU.nrow = 0;
-					curr_island_superLU_vars->A_LU.ncol = 0;
+	if (FPOutput == NULL)
+	{
+		gl_warning("NR: unable to open %s to write the solve history",filename);
+		/*  TROUBLESHOOT
+		The file specified in NR_solve_history_file could not be opened for writing.  Make sure the path is valid and
+		writable, and try again.
+		*/
+		return;
+	}
 
-					//Repeat for B_LU
-					curr_island_superLU_vars->B_LU.Store = NULL;
+	fprintf(FPOutput,"timestamp,iterations,converged,predicted_buses,predictor_error[pu]\n");
 
-					//Do the same for the underlying properties, just because
-					curr_island_superLU_vars->B_LU.Stype = SLU_NC;
-					curr_island_superLU_vars->B_LU.Dtype = SLU_D;
-					curr_island_superLU_vars->B_LU.Mtype = SLU_GE;
-					curr_island_superLU_vars->B_LU.nrow = 0;
-					curr_island_superLU_vars->B_LU.ncol = 0;
+	//Oldest entry is the next one to be overwritten, once the buffer has wrapped
+	for (indexer=0; indexer<powerflow_values->solve_history_count; indexer++)
+	{
+		entry_index = (powerflow_values->solve_history_next + powerflow_values->solve_history_size - powerflow_values->solve_history_count + indexer) % powerflow_values->solve_history_size;
+		record = &powerflow_values->solve_history[entry_index];
 
-					//Other arrays
-					curr_island_superLU_vars->perm_c = NULL;
-					curr_island_superLU_vars->perm_r = NULL;
+		gl_printtime(record->solve_time,time_buffer,64);
 
-					//Assign it in
-					powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars = (void *)curr_island_superLU_vars;
-				}
-			}
+		fprintf(FPOutput,"%s,%lld,%s,%u,%.6g\n",time_buffer,(long long)record->iterations,(record->converged ? "TRUE" : "FALSE"),record->predicted_buses,record->predictor_error);
+	}
 
-			//Renull the random pointer, just in case
-			curr_island_superLU_vars = NULL;
+	fclose(FPOutput);
+}
+
+//Releases the LU factors retained for NR_chord_newton
+static void NR_chord_release(SUPERLU_NR_vars *superLU_vars)
+{
+	if (superLU_vars->factors_valid == true)
+	{
+#ifdef MT
+		Destroy_SuperNode_SCP(&superLU_vars->L_LU);
+		Destroy_CompCol_NCP(&superLU_vars->U_LU);
+#else
+		Destroy_SuperNode_Matrix(&superLU_vars->L_LU);
+		Destroy_CompCol_Matrix(&superLU_vars->U_LU);
+#endif
+		superLU_vars->factors_valid = false;
+	}
+}
+
+static void NR_build_load_lanes(unsigned int bus_count, BUSDATA *bus, NR_SOLVER_STRUCT *powerflow_values);
+
+//Load batch of a bus - island*NR_LOAD_BATCH_TYPES plus 0 for delta, 1 for triplex, 2 for wye, 3 for wye with "different" children (-1 if not in an island)
+static inline int NR_load_batch_index(BUSDATA *bus_entry)
+{
+	if ((bus_entry->island_number < 0) || (bus_entry->island_number >= NR_islands_detected))
+	{
+		return -1;
+	}
+
+	if ((bus_entry->phases & 0x08) == 0x08)	//Delta connected node
+	{
+		return (NR_LOAD_BATCH_TYPES*bus_entry->island_number);
+	}
+	else if ((bus_entry->phases & 0x80) == 0x80)	//Split phase
+	{
+		return (NR_LOAD_BATCH_TYPES*bus_entry->island_number + 1);
+	}
+	else if ((bus_entry->phases & 0x10) == 0x10)	//Wye-connected with "different" children
+	{
+		return (NR_LOAD_BATCH_TYPES*bus_entry->island_number + 3);
+	}
+	else	//Wye-connected
+	{
+		return (NR_LOAD_BATCH_TYPES*bus_entry->island_number + 2);
+	}
+}
+
+//Groups the buses of each island into connection-type batches (delta, triplex, wye, wye with "different" children) for compute_load_values
+//Counting sort - load_batch_offset[island*NR_LOAD_BATCH_TYPES+type] is the start of each batch, the entry after the last island is the end
+static void NR_build_load_batches(unsigned int bus_count, BUSDATA *bus, NR_SOLVER_STRUCT *powerflow_values)
+{
+	unsigned int indexer, batch_entries;
+	int batch_index;
+
+	//Make sure there is room for everything
+	if ((powerflow_values->load_batch_list == NULL) || (powerflow_values->load_batch_buses < bus_count))
+	{
+		if (powerflow_values->load_batch_list != NULL)
+		{
+			gl_free(powerflow_values->load_batch_list);
 		}
 
-		if (NR_admit_change)	//If an admittance update was detected, fix it
+		powerflow_values->load_batch_list = (unsigned int *)gl_malloc(bus_count*sizeof(unsigned int));
+
+		if (powerflow_values->load_batch_list == NULL)
 		{
-			//Build the diagonal elements of the bus admittance matrix - this should only happen once no matter what
-			if (powerflow_values->BA_diag == NULL)
-			{
-				powerflow_values->BA_diag = (Bus_admit *)gl_malloc(bus_count *sizeof(Bus_admit));   //BA_diag store the location and value of diagonal elements of Bus Admittance matrix
+			GL_THROW("NR: Failed to allocate load batch arrays");
+			/*  TROUBLESHOOT
+			While attempting to allocate the arrays that group buses by connection type for the load calculations,
+			an error was encountered.  Please try again.  If the error persists, please submit your code and a bug
+			report via the issues tracker.
+			*/
+		}
 
-				//Make sure it worked
-				if (powerflow_values->BA_diag == NULL)
-				{
-					GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
-					/*  TROUBLESHOOT
-					During the allocation stage of the NR algorithm, one of the matrices failed to be allocated.
-					Please try again and if this bug persists, submit your code and a bug report using the trac
-					website.
-					*/
-				}
-			}
-			
-			//Loop the islands and reset the bus count, just in case
-			for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
-			{
-				powerflow_values->island_matrix_values[island_loop_index].bus_count = 0;
-			}
+		powerflow_values->load_batch_buses = bus_count;
+	}
 
-			for (indexer=0; indexer<bus_count; indexer++) // Construct the diagonal elements of Bus admittance matrix.
+	batch_entries = NR_LOAD_BATCH_TYPES*NR_islands_detected + 1;
+
+	if ((powerflow_values->load_batch_offset == NULL) || (powerflow_values->load_batch_islands < NR_islands_detected))
+	{
+		if (powerflow_values->load_batch_offset != NULL)
+		{
+			gl_free(powerflow_values->load_batch_offset);
+		}
+
+		if (powerflow_values->load_lane_offset != NULL)
+		{
+			gl_free(powerflow_values->load_lane_offset);
+		}
+
+		powerflow_values->load_batch_offset = (unsigned int *)gl_malloc(batch_entries*sizeof(unsigned int));
+		powerflow_values->load_lane_offset = (unsigned int *)gl_malloc((NR_islands_detected+1)*sizeof(unsigned int));
+
+		if ((powerflow_values->load_batch_offset == NULL) || (powerflow_values->load_lane_offset == NULL))
+		{
+			GL_THROW("NR: Failed to allocate load batch arrays");
+			//Defined above
+		}
+
+		powerflow_values->load_batch_islands = NR_islands_detected;
+	}
+
+	//Count the batch sizes - shifted up one, so the running sum gives the starts
+	for (indexer=0; indexer<batch_entries; indexer++)
+	{
+		powerflow_values->load_batch_offset[indexer] = 0;
+	}
+
+	for (indexer=0; indexer<bus_count; indexer++)
+	{
+		batch_index = NR_load_batch_index(&bus[indexer]);
+
+		if (batch_index >= 0)
+		{
+			powerflow_values->load_batch_offset[batch_index+1]++;
+		}
+	}
+
+	for (indexer=1; indexer<batch_entries; indexer++)
+	{
+		powerflow_values->load_batch_offset[indexer] += powerflow_values->load_batch_offset[indexer-1];
+	}
+
+	//Place the buses - this advances each start to the next batch's start, so shift them back after
+	for (indexer=0; indexer<bus_count; indexer++)
+	{
+		batch_index = NR_load_batch_index(&bus[indexer]);
+
+		if (batch_index >= 0)
+		{
+			powerflow_values->load_batch_list[powerflow_values->load_batch_offset[batch_index]++] = indexer;
+		}
+	}
+
+	for (indexer=(batch_entries-1); indexer>0; indexer--)
+	{
+		powerflow_values->load_batch_offset[indexer] = powerflow_values->load_batch_offset[indexer-1];
+	}
+
+	powerflow_values->load_batch_offset[0] = 0;
+
+	//Lay out the per-phase lanes of the wye batches
+	NR_build_load_lanes(bus_count,bus,powerflow_values);
+
+	powerflow_values->load_batch_valid = true;
+}
+
+//Network current of one row of a bus - the admittance matrix row times the present voltages (equations (7) and (8))
+//Shared by the current-injection mismatch of solver_nr and solver_nr_scenarios
+//volt_index receives the voltage phase of the row
+static void NR_bus_row_current(BUSDATA *bus, BRANCHDATA *branch, NR_SOLVER_STRUCT *powerflow_values, unsigned int indexer, int jindex, double *Icalc_real, double *Icalc_imag, int *volt_index)
+{
+	double tempIcalcReal, tempIcalcImag;
+	double work_vals_double_0, work_vals_double_1, work_vals_double_2, work_vals_double_3;
+	unsigned int jindexer, kindexer;
+	int kindex, temp_index, temp_index_b;
+	size_t work_vals_char_0;
+	unsigned char phase_worka;
+	bool proceed_flag;
+
+	tempIcalcReal = tempIcalcImag = 0;
+	temp_index_b = jindex;
+
+	if ((bus[indexer].phases & 0x80) == 0x80)	//Split phase - triplex bus
+	{
+		//Get diagonal contributions - only (& always) 2
+		//Column 1
+		tempIcalcReal += (powerflow_values->BA_diag[indexer].Y[jindex][0]).Re() * (bus[indexer].V[0]).Re() - (powerflow_values->BA_diag[indexer].Y[jindex][0]).Im() * (bus[indexer].V[0]).Im();// equation (7), the diag elements of bus admittance matrix 
+		tempIcalcImag += (powerflow_values->BA_diag[indexer].Y[jindex][0]).Re() * (bus[indexer].V[0]).Im() + (powerflow_values->BA_diag[indexer].Y[jindex][0]).Im() * (bus[indexer].V[0]).Re();// equation (8), the diag elements of bus admittance matrix 
+
+		//Column 2
+		tempIcalcReal += (powerflow_values->BA_diag[indexer].Y[jindex][1]).Re() * (bus[indexer].V[1]).Re() - (powerflow_values->BA_diag[indexer].Y[jindex][1]).Im() * (bus[indexer].V[1]).Im();// equation (7), the diag elements of bus admittance matrix 
+		tempIcalcImag += (powerflow_values->BA_diag[indexer].Y[jindex][1]).Re() * (bus[indexer].V[1]).Im() + (powerflow_values->BA_diag[indexer].Y[jindex][1]).Im() * (bus[indexer].V[1]).Re();// equation (8), the diag elements of bus admittance matrix 
+
+		//Now off diagonals
+		for (kindexer=0; kindexer<(bus[indexer].Link_Table_Size); kindexer++)
+		{
+			//Apply proper index to jindexer (easier to implement this way)
+			jindexer=bus[indexer].Link_Table[kindexer];
+
+			if (branch[jindexer].from == (int)indexer)	//We're the from bus
 			{
-				//Increment the island bus counter
-				if (bus[indexer].island_number != -1)
+				if ((bus[indexer].phases & 0x20) == 0x20)	//SPCT from bus - needs different signage
 				{
-					powerflow_values->island_matrix_values[bus[indexer].island_number].bus_count++;
-				}
+					work_vals_char_0 = jindex*3;
 
-				//Determine the size we need
-				if ((bus[indexer].phases & 0x80) == 0x80)	//Split phase
-					powerflow_values->BA_diag[indexer].size = 2;
-				else										//Other cases, figure out how big they are
+					//This situation can only be a normal line (triplex will never be the from for another type)
+					//Again only, & always 2 columns (just do them explicitly)
+					//Column 1
+					tempIcalcReal += ((branch[jindexer].Yfrom[work_vals_char_0])).Re() * (bus[branch[jindexer].to].V[0]).Re() - ((branch[jindexer].Yfrom[work_vals_char_0])).Im() * (bus[branch[jindexer].to].V[0]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+					tempIcalcImag += ((branch[jindexer].Yfrom[work_vals_char_0])).Re() * (bus[branch[jindexer].to].V[0]).Im() + ((branch[jindexer].Yfrom[work_vals_char_0])).Im() * (bus[branch[jindexer].to].V[0]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+
+					//Column2
+					tempIcalcReal += ((branch[jindexer].Yfrom[jindex*3+1])).Re() * (bus[branch[jindexer].to].V[1]).Re() - ((branch[jindexer].Yfrom[jindex*3+1])).Im() * (bus[branch[jindexer].to].V[1]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+					tempIcalcImag += ((branch[jindexer].Yfrom[jindex*3+1])).Re() * (bus[branch[jindexer].to].V[1]).Im() + ((branch[jindexer].Yfrom[jindex*3+1])).Im() * (bus[branch[jindexer].to].V[1]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+
+				}//End SPCT To bus - from diagonal contributions
+				else		//Normal line connection to normal triplex
 				{
-					phase_worka = 0;
-					for (jindex=0; jindex<3; jindex++)		//Accumulate number of phases
-					{
-						phase_worka += ((bus[indexer].phases & (0x01 << jindex)) >> jindex);
-					}
-					powerflow_values->BA_diag[indexer].size = phase_worka;
-				}
+					work_vals_char_0 = jindex*3;
+					//This situation can only be a normal line (triplex will never be the from for another type)
+					//Again only, & always 2 columns (just do them explicitly)
+					//Column 1
+					tempIcalcReal += (-(branch[jindexer].Yfrom[work_vals_char_0])).Re() * (bus[branch[jindexer].to].V[0]).Re() - (-(branch[jindexer].Yfrom[work_vals_char_0])).Im() * (bus[branch[jindexer].to].V[0]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+					tempIcalcImag += (-(branch[jindexer].Yfrom[work_vals_char_0])).Re() * (bus[branch[jindexer].to].V[0]).Im() + (-(branch[jindexer].Yfrom[work_vals_char_0])).Im() * (bus[branch[jindexer].to].V[0]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
 
-				//Ensure the admittance matrix is zeroed
-				for (jindex=0; jindex<3; jindex++)
+					//Column2
+					tempIcalcReal += (-(branch[jindexer].Yfrom[jindex*3+1])).Re() * (bus[branch[jindexer].to].V[1]).Re() - (-(branch[jindexer].Yfrom[jindex*3+1])).Im() * (bus[branch[jindexer].to].V[1]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+					tempIcalcImag += (-(branch[jindexer].Yfrom[jindex*3+1])).Re() * (bus[branch[jindexer].to].V[1]).Im() + (-(branch[jindexer].Yfrom[jindex*3+1])).Im() * (bus[branch[jindexer].to].V[1]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+
+				}//end normal triplex from
+			}//end from bus
+			else if (branch[jindexer].to == (int)indexer)	//We're the to bus
+			{
+				if (branch[jindexer].v_ratio != 1.0)	//Transformer
 				{
-					for (kindex=0; kindex<3; kindex++)
+					//Only a single contributor on the from side - figure out how to get to it
+					if ((branch[jindexer].phases & 0x01) == 0x01)	//C
 					{
-						powerflow_values->BA_diag[indexer].Y[jindex][kindex] = 0;
-						tempY[jindex][kindex] = 0;
+						temp_index=2;
 					}
-				}
-
-				//If we're in any deltamode, store out self-admittance as well, if it exists
-				if ((powerflow_type!=PF_NORMAL) && (bus[indexer].full_Y != NULL))
-				{
-					//Not triplex
-					if ((bus[indexer].phases & 0x80) != 0x80)
+					else if ((branch[jindexer].phases & 0x02) == 0x02)	//B
 					{
-						//Figure out what our casing looks like - populate based on this (in case some were children)
-						switch(bus[indexer].phases & 0x07) {
-							case 0x00:	//No phases
-							{
-								break;	//Just get us out
-							}
-							case 0x01:	//Phase C
-							{
-								tempY[0][0] = bus[indexer].full_Y[8];
-								break;
-							}
-							case 0x02:	//Phase B
-							{
-								tempY[0][0] = bus[indexer].full_Y[4];
-								break;
-							}
-							case 0x03:	//Phase BC
-							{
-								tempY[0][0] = bus[indexer].full_Y[4];
-								tempY[0][1] = bus[indexer].full_Y[5];
-								tempY[1][0] = bus[indexer].full_Y[7];
-								tempY[1][1] = bus[indexer].full_Y[8];
-								break;
-							}
-							case 0x04:	//Phase A
-							{
-								tempY[0][0] = bus[indexer].full_Y[0];
-								break;
-							}
-							case 0x05:	//Phase AC
-							{
-								tempY[0][0] = bus[indexer].full_Y[0];
-								tempY[0][1] = bus[indexer].full_Y[2];
-								tempY[1][0] = bus[indexer].full_Y[6];
-								tempY[1][1] = bus[indexer].full_Y[8];
-								break;
-							}
-							case 0x06:	//Phase AB
-							{
-								tempY[0][0] = bus[indexer].full_Y[0];
-								tempY[0][1] = bus[indexer].full_Y[1];
-								tempY[1][0] = bus[indexer].full_Y[3];
-								tempY[1][1] = bus[indexer].full_Y[4];
-								break;
-							}
-							case 0x07:	//Phase ABC
-							{
-								//Loop and add all in
-								for (jindex=0; jindex<3; jindex++)
-								{
-									for (kindex=0; kindex<3; kindex++)
-									{
-										tempY[jindex][kindex] = bus[indexer].full_Y[jindex*3+kindex];	//Adds in any self-admittance terms (generators)
-									}
-								}
-								break;
-							}
-							default:
-							{
-								GL_THROW("NR: Improper Norton equivalent admittance found");
-								/*  TROUBLESHOOT
-								While mapping Norton equivalent impedances into the system, an unexpected
-								phase condition was encountered with the admittance.  Please try again.  If the error
-								persists, please submit a bug report via the issue tracker.
-								*/
-							}
-						}//End case
+						temp_index=1;
 					}
-					else  //Must be Triplex - add the "12" combination for the shunt
+					else if ((branch[jindexer].phases & 0x04) == 0x04)	//A
 					{
-						//See if we're the stupid "backwards notation" bus or not
-						if ((bus[indexer].phases & 0x20) == 0x20)	//Special case
-						{
-							//Need to be negated, due to crazy conventions
-							tempY[0][0] = -bus[indexer].full_Y[0];
-							tempY[0][1] = -bus[indexer].full_Y[0];
-							tempY[1][0] = bus[indexer].full_Y[0];
-							tempY[1][1] = bus[indexer].full_Y[0];
-						}
-						else	//Standard triplex
-						{
-							tempY[0][0] = bus[indexer].full_Y[0];
-							tempY[0][1] = bus[indexer].full_Y[0];
-							tempY[1][0] = -bus[indexer].full_Y[0];
-							tempY[1][1] = -bus[indexer].full_Y[0];
-						}
+						temp_index=0;
+					}
+					else	//How'd we get here!?!
+					{
+						GL_THROW("NR: A split-phase transformer appears to have an invalid phase");
 					}
-				}
 
-				//Now go through all of the branches to get the self admittance information (hinges on size)
-				for (kindexer=0; kindexer<(bus[indexer].Link_Table_Size);kindexer++)
-				{ 
-					//Assign jindexer as intermediate variable (easier for me this way)
-					jindexer = bus[indexer].Link_Table[kindexer];
+					work_vals_char_0 = jindex*3+temp_index;
 
-					if ((branch[jindexer].from == (int)indexer) || (branch[jindexer].to == (int)indexer))	//Bus is the from or to side of things - not sure how it would be in link table otherwise, but meh
-					{
-						if ((bus[indexer].phases & 0x07) == 0x07)		//Full three phase
-						{
-							for (jindex=0; jindex<3; jindex++)	//Add in all three phase values
-							{
-								//See if this phase is valid
-								phase_workb = 0x04 >> jindex;
+					//Perform the update, it only happens for one column (nature of the transformer)
+					tempIcalcReal += (-(branch[jindexer].Yto[work_vals_char_0])).Re() * (bus[branch[jindexer].from].V[temp_index]).Re() - (-(branch[jindexer].Yto[work_vals_char_0])).Im() * (bus[branch[jindexer].from].V[temp_index]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+					tempIcalcImag += (-(branch[jindexer].Yto[work_vals_char_0])).Re() * (bus[branch[jindexer].from].V[temp_index]).Im() + (-(branch[jindexer].Yto[work_vals_char_0])).Im() * (bus[branch[jindexer].from].V[temp_index]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
 
-								if ((phase_workb & branch[jindexer].phases) == phase_workb)
-								{
-									for (kindex=0; kindex<3; kindex++)
-									{
-										//Check phase
-										phase_workd = 0x04 >> kindex;
+				}//end transformer
+				else									//Must be a normal line then
+				{
+					if ((bus[indexer].phases & 0x20) == 0x20)	//SPCT from bus - needs different signage
+					{
+						work_vals_char_0 = jindex*3;
+						//This case should never really exist, but if someone reverses a secondary or is doing meshed secondaries, it might
+						//Again only, & always 2 columns (just do them explicitly)
+						//Column 1
+						tempIcalcReal += ((branch[jindexer].Yto[work_vals_char_0])).Re() * (bus[branch[jindexer].from].V[0]).Re() - ((branch[jindexer].Yto[work_vals_char_0])).Im() * (bus[branch[jindexer].from].V[0]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+						tempIcalcImag += ((branch[jindexer].Yto[work_vals_char_0])).Re() * (bus[branch[jindexer].from].V[0]).Im() + ((branch[jindexer].Yto[work_vals_char_0])).Im() * (bus[branch[jindexer].from].V[0]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+
+						//Column2
+						tempIcalcReal += ((branch[jindexer].Yto[work_vals_char_0+1])).Re() * (bus[branch[jindexer].from].V[1]).Re() - ((branch[jindexer].Yto[work_vals_char_0+1])).Im() * (bus[branch[jindexer].from].V[1]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+						tempIcalcImag += ((branch[jindexer].Yto[work_vals_char_0+1])).Re() * (bus[branch[jindexer].from].V[1]).Im() + ((branch[jindexer].Yto[work_vals_char_0+1])).Im() * (bus[branch[jindexer].from].V[1]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+					}//End SPCT To bus - from diagonal contributions
+					else		//Normal line connection to normal triplex
+					{
+						work_vals_char_0 = jindex*3;
+						//Again only, & always 2 columns (just do them explicitly)
+						//Column 1
+						tempIcalcReal += (-(branch[jindexer].Yto[work_vals_char_0])).Re() * (bus[branch[jindexer].from].V[0]).Re() - (-(branch[jindexer].Yto[work_vals_char_0])).Im() * (bus[branch[jindexer].from].V[0]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+						tempIcalcImag += (-(branch[jindexer].Yto[work_vals_char_0])).Re() * (bus[branch[jindexer].from].V[0]).Im() + (-(branch[jindexer].Yto[work_vals_char_0])).Im() * (bus[branch[jindexer].from].V[0]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+
+						//Column2
+						tempIcalcReal += (-(branch[jindexer].Yto[work_vals_char_0+1])).Re() * (bus[branch[jindexer].from].V[1]).Re() - (-(branch[jindexer].Yto[work_vals_char_0+1])).Im() * (bus[branch[jindexer].from].V[1]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+						tempIcalcImag += (-(branch[jindexer].Yto[work_vals_char_0+1])).Re() * (bus[branch[jindexer].from].V[1]).Im() + (-(branch[jindexer].Yto[work_vals_char_0+1])).Im() * (bus[branch[jindexer].from].V[1]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+					}//End normal triplex connection
+				}//end normal line
+			}//end to bus
+			else	//We're nothing
+				;
+
+		}//End branch traversion
+	}//End split-phase present
+	else	//Three phase or some variant thereof
+	{
+		for ( kindex = 0 ; kindex < powerflow_values->BA_diag[indexer].size ; kindex++ )		//cols - Still only for specified phases
+		{
+			//Determine our indices, based on phase information
+			temp_index = -1;
+			switch(bus[indexer].phases & 0x07) {
+				case 0x01:	//C
+					{
+						temp_index=2;
+						break;
+					}//end 0x01
+				case 0x02:	//B
+					{
+						temp_index=1;
+						break;
+					}//end 0x02
+				case 0x03:	//BC
+					{
+						if (kindex==0)	//B
+							temp_index=1;
+						else	//C
+							temp_index=2;
+						break;
+					}//end 0x03
+				case 0x04:	//A
+					{
+						temp_index=0;
+						break;
+					}//end 0x04
+				case 0x05:	//AC
+					{
+						if (kindex==0)	//A
+							temp_index=0;
+						else			//C
+							temp_index=2;
+						break;
+					}//end 0x05
+				case 0x06:	//AB
+					{
+						if (kindex==0)	//A
+							temp_index=0;
+						else			//B
+							temp_index=1;
+						break;
+					}//end 0x06
+				case 0x07:	//ABC
+					{
+						temp_index = kindex;	//Will loop all 3
+						break;
+					}//end 0x07
+			}//End switch/case
 
-										if ((phase_workd & branch[jindexer].phases) == phase_workd)
-										{
-											if (branch[jindexer].from == (int)indexer)	//We're the from version
-											{
-												tempY[jindex][kindex] += branch[jindexer].YSfrom[jindex*3+kindex];
-											}
-											else									//Must be the to version
-											{
-												tempY[jindex][kindex] += branch[jindexer].YSto[jindex*3+kindex];
-											}
-										}//End valid column phase
-									}
-								}//End valid row phase
-							}
-						}
-						else if ((bus[indexer].phases & 0x80) == 0x80)	//Split phase - add in 2x2 element to upper left 2x2
-						{
-							if (branch[jindexer].from == (int)indexer)	//From branch
-							{
-								//End of SPCT transformer requires slightly different Diagonal components (so when it's the To bus of SPCT and from for other triplex
-								if ((bus[indexer].phases & 0x20) == 0x20)	//Special case
-								{
-									//Other triplexes need to be negated to match sign conventions
-									tempY[0][0] -= branch[jindexer].YSfrom[0];
-									tempY[0][1] -= branch[jindexer].YSfrom[1];
-									tempY[1][0] -= branch[jindexer].YSfrom[3];
-									tempY[1][1] -= branch[jindexer].YSfrom[4];
-								}
-								else										//Just a normal to bus
-								{
-									tempY[0][0] += branch[jindexer].YSfrom[0];
-									tempY[0][1] += branch[jindexer].YSfrom[1];
-									tempY[1][0] += branch[jindexer].YSfrom[3];
-									tempY[1][1] += branch[jindexer].YSfrom[4];
-								}
-							}
-							else									//To branch
-							{
-								//Replicate the above for SPCT test, in case people put lines in backwards
-								//End of SPCT transformer requires slightly different Diagonal components (so when it's the To bus of SPCT and from for other triplex
-								if (((bus[indexer].phases & 0x20) == 0x20) && (branch[jindexer].lnk_type == 1))	//Special case, but make sure we're not the transformer
-								{
-									tempY[0][0] -= branch[jindexer].YSto[0];
-									tempY[0][1] -= branch[jindexer].YSto[1];
-									tempY[1][0] -= branch[jindexer].YSto[3];
-									tempY[1][1] -= branch[jindexer].YSto[4];
-								}
-								else	//Normal bus - no funky SPCT nonsense
-								{
-									tempY[0][0] += branch[jindexer].YSto[0];
-									tempY[0][1] += branch[jindexer].YSto[1];
-									tempY[1][0] += branch[jindexer].YSto[3];
-									tempY[1][1] += branch[jindexer].YSto[4];
-								}
-							}
-						}
-						else	//We must be a single or two-phase line - always populate the upper left portion of matrix (easier for later)
+			if ((int)temp_index==-1)	//Error check
+			{
+				GL_THROW("NR: A voltage index failed to be found.");
+				/*  TROUBLESHOOT
+				While attempting to compute the calculated power current, a voltage index failed to be
+				resolved.  Please submit your code and a bug report via the trac website.
+				*/
+			}
+
+			//Normal diagonal contributions
+			tempIcalcReal += (powerflow_values->BA_diag[indexer].Y[jindex][kindex]).Re() * (bus[indexer].V[temp_index]).Re() - (powerflow_values->BA_diag[indexer].Y[jindex][kindex]).Im() * (bus[indexer].V[temp_index]).Im();// equation (7), the diag elements of bus admittance matrix 
+			tempIcalcImag += (powerflow_values->BA_diag[indexer].Y[jindex][kindex]).Re() * (bus[indexer].V[temp_index]).Im() + (powerflow_values->BA_diag[indexer].Y[jindex][kindex]).Im() * (bus[indexer].V[temp_index]).Re();// equation (8), the diag elements of bus admittance matrix 
+
+			//In-rush load contributions (if any) - only along explicit diagonal
+			if ((bus[indexer].full_Y_load != NULL) && (jindex==kindex))
+			{
+				tempIcalcReal += (bus[indexer].full_Y_load[temp_index]).Re() * (bus[indexer].V[temp_index]).Re() - (bus[indexer].full_Y_load[temp_index]).Im() * (bus[indexer].V[temp_index]).Im();// equation (7), the diag elements of bus admittance matrix 
+				tempIcalcImag += (bus[indexer].full_Y_load[temp_index]).Re() * (bus[indexer].V[temp_index]).Im() + (bus[indexer].full_Y_load[temp_index]).Im() * (bus[indexer].V[temp_index]).Re();// equation (8), the diag elements of bus admittance matrix 
+			}
+
+			//Off diagonal contributions
+			//Need another variable to handle the rows
+			temp_index_b = -1;
+			switch(bus[indexer].phases & 0x07) {
+				case 0x01:	//C
+					{
+						temp_index_b=2;
+						break;
+					}//end 0x01
+				case 0x02:	//B
+					{
+						temp_index_b=1;
+						break;
+					}//end 0x02
+				case 0x03:	//BC
+					{
+						if (jindex==0)	//B
+							temp_index_b=1;
+						else	//C
+							temp_index_b=2;
+						break;
+					}//end 0x03
+				case 0x04:	//A
+					{
+						temp_index_b=0;
+						break;
+					}//end 0x04
+				case 0x05:	//AC
+					{
+						if (jindex==0)	//A
+							temp_index_b=0;
+						else			//C
+							temp_index_b=2;
+						break;
+					}//end 0x05
+				case 0x06:	//AB
+					{
+						if (jindex==0)	//A
+							temp_index_b=0;
+						else			//B
+							temp_index_b=1;
+						break;
+					}//end 0x06
+				case 0x07:	//ABC
+					{
+						temp_index_b = jindex;	//Will loop all 3
+						break;
+					}//end 0x07
+			}//End switch/case
+
+			if ((int)temp_index_b==-1)	//Error check
+			{
+				GL_THROW("NR: A voltage index failed to be found.");
+			}
+
+			for (kindexer=0; kindexer<(bus[indexer].Link_Table_Size); kindexer++)	//Parse through the branch list
+			{
+				//Apply proper index to jindexer (easier to implement this way)
+				jindexer=bus[indexer].Link_Table[kindexer];
+
+				if (branch[jindexer].from == (int)indexer) 
+				{
+					//See if we're a triplex transformer (will only occur on the from side)
+					if ((branch[jindexer].phases & 0x80) == 0x80)	//Triplexy
+					{
+						proceed_flag = false;
+						phase_worka = branch[jindexer].phases & 0x07;
+
+						if (kindex==0)	//All of this will only occur the first column iteration
 						{
-							switch(bus[indexer].phases & 0x07) {
-								case 0x00:	//No phases (we've been faulted out
-									{
-										break;	//Just get us outta here
-									}
-								case 0x01:	//Only C
+							switch (bus[indexer].phases & 0x07)	{
+								case 0x01:	//C
 									{
-										if ((branch[jindexer].phases & 0x01) == 0x01)	//Phase C valid on branch
-										{
-											if (branch[jindexer].from == (int)indexer)	//From branch
-											{
-												tempY[0][0] += branch[jindexer].YSfrom[8];
-											}
-											else									//To branch
-											{
-												tempY[0][0] += branch[jindexer].YSto[8];
-											}
-										}//End valid phase C
+										if (phase_worka==0x01)
+											proceed_flag=true;
 										break;
-									}
-								case 0x02:	//Only B
+									}//end 0x01
+								case 0x02:	//B
 									{
-										if ((branch[jindexer].phases & 0x02) == 0x02)	//Phase B valid on branch
-										{
-											if (branch[jindexer].from == (int)indexer)	//From branch
-											{
-												tempY[0][0] += branch[jindexer].YSfrom[4];
-											}
-											else									//To branch
-											{
-												tempY[0][0] += branch[jindexer].YSto[4];
-											}
-										}//End valid phase B
+										if (phase_worka==0x02)
+											proceed_flag=true;
 										break;
-									}
-								case 0x03:	//B & C
+									}//end 0x02
+								case 0x03:	//BC
 									{
-										phase_worka = (branch[jindexer].phases & 0x03);	//Extract branch phases
-
-										if (phase_worka == 0x03)	//Full B & C
-										{
-											if (branch[jindexer].from == (int)indexer)	//From branch
-											{
-												tempY[0][0] += branch[jindexer].YSfrom[4];
-												tempY[0][1] += branch[jindexer].YSfrom[5];
-												tempY[1][0] += branch[jindexer].YSfrom[7];
-												tempY[1][1] += branch[jindexer].YSfrom[8];
-											}
-											else									//To branch
-											{
-												tempY[0][0] += branch[jindexer].YSto[4];
-												tempY[0][1] += branch[jindexer].YSto[5];
-												tempY[1][0] += branch[jindexer].YSto[7];
-												tempY[1][1] += branch[jindexer].YSto[8];
-											}
-										}//End valid B & C
-										else if (phase_worka == 0x01)	//Only C branch
-										{
-											if (branch[jindexer].from == (int)indexer)	//From branch
-											{
-												tempY[1][1] += branch[jindexer].YSfrom[8];
-											}
-											else									//To branch
-											{
-												tempY[1][1] += branch[jindexer].YSto[8];
-											}
-										}//end valid C
-										else if (phase_worka == 0x02)	//Only B branch
-										{
-											if (branch[jindexer].from == (int)indexer)	//From branch
-											{
-												tempY[0][0] += branch[jindexer].YSfrom[4];
-											}
-											else									//To branch
-											{
-												tempY[0][0] += branch[jindexer].YSto[4];
-											}
-										}//end valid B
-										else	//Must be nothing then - all phases must be faulted, or something
+										if ((jindex==0) && (phase_worka==0x02))	//First row and is a B
+											proceed_flag=true;
+										else if ((jindex==1) && (phase_worka==0x01))	//Second row and is a C
+											proceed_flag=true;
+										else
 											;
 										break;
-									}
-								case 0x04:	//Only A
+									}//end 0x03
+								case 0x04:	//A
 									{
-										if ((branch[jindexer].phases & 0x04) == 0x04)	//Phase A is valid
-										{
-											if (branch[jindexer].from == (int)indexer)	//From branch
-											{
-												tempY[0][0] += branch[jindexer].YSfrom[0];
-											}
-											else									//To branch
-											{
-												tempY[0][0] += branch[jindexer].YSto[0];
-											}
-										}//end valid phase A
+										if (phase_worka==0x04)
+											proceed_flag=true;
 										break;
-									}
-								case 0x05:	//A & C
+									}//end 0x04
+								case 0x05:	//AC
 									{
-										phase_worka = branch[jindexer].phases & 0x05;	//Extract phases
-
-										if (phase_worka == 0x05)	//Both A & C valid
-										{
-											if (branch[jindexer].from == (int)indexer)	//From branch
-											{
-												tempY[0][0] += branch[jindexer].YSfrom[0];
-												tempY[0][1] += branch[jindexer].YSfrom[2];
-												tempY[1][0] += branch[jindexer].YSfrom[6];
-												tempY[1][1] += branch[jindexer].YSfrom[8];
-											}
-											else									//To branch
-											{
-												tempY[0][0] += branch[jindexer].YSto[0];
-												tempY[0][1] += branch[jindexer].YSto[2];
-												tempY[1][0] += branch[jindexer].YSto[6];
-												tempY[1][1] += branch[jindexer].YSto[8];
-											}
-										}//End A & C valid
-										else if (phase_worka == 0x04)	//Only A valid
-										{
-											if (branch[jindexer].from == (int)indexer)	//From branch
-											{
-												tempY[0][0] += branch[jindexer].YSfrom[0];
-											}
-											else									//To branch
-											{
-												tempY[0][0] += branch[jindexer].YSto[0];
-											}
-										}//end only A valid
-										else if (phase_worka == 0x01)	//Only C valid
-										{
-											if (branch[jindexer].from == (int)indexer)	//From branch
-											{
-												tempY[1][1] += branch[jindexer].YSfrom[8];
-											}
-											else									//To branch
-											{
-												tempY[1][1] += branch[jindexer].YSto[8];
-											}
-										}//end only C valid
-										else	//No connection - must be faulted
+										if ((jindex==0) && (phase_worka==0x04))	//First row and is a A
+											proceed_flag=true;
+										else if ((jindex==1) && (phase_worka==0x01))	//Second row and is a C
+											proceed_flag=true;
+										else
 											;
 										break;
-									}
-								case 0x06:	//A & B
+									}//end 0x05
+								case 0x06:	//AB - shares with ABC
+								case 0x07:	//ABC 
 									{
-										phase_worka = branch[jindexer].phases & 0x06;	//Extract phases
+										if ((jindex==0) && (phase_worka==0x04))	//A & first row
+											proceed_flag=true;
+										else if ((jindex==1) && (phase_worka==0x02))	//B & second row
+											proceed_flag=true;
+										else if ((jindex==2) && (phase_worka==0x01))	//C & third row
+											proceed_flag=true;
+										else;
+										break;
+									}//end 0x07
+							}//end switch
+						}//End if kindex==0
 
-										if (phase_worka == 0x06)	//Valid A & B phase
-										{
-											if (branch[jindexer].from == (int)indexer)	//From branch
-											{
-												tempY[0][0] += branch[jindexer].YSfrom[0];
-												tempY[0][1] += branch[jindexer].YSfrom[1];
-												tempY[1][0] += branch[jindexer].YSfrom[3];
-												tempY[1][1] += branch[jindexer].YSfrom[4];
-											}
-											else									//To branch
-											{
-												tempY[0][0] += branch[jindexer].YSto[0];
-												tempY[0][1] += branch[jindexer].YSto[1];
-												tempY[1][0] += branch[jindexer].YSto[3];
-												tempY[1][1] += branch[jindexer].YSto[4];
-											}
-										}//End valid A & B
-										else if (phase_worka == 0x04)	//Only valid A
-										{
-											if (branch[jindexer].from == (int)indexer)	//From branch
-											{
-												tempY[0][0] += branch[jindexer].YSfrom[0];
-											}
-											else									//To branch
-											{
-												tempY[0][0] += branch[jindexer].YSto[0];
-											}
-										}//end valid A
-										else if (phase_worka == 0x02)	//Only valid B
-										{
-											if (branch[jindexer].from == (int)indexer)	//From branch
-											{
-												tempY[1][1] += branch[jindexer].YSfrom[4];
-											}
-											else									//To branch
-											{
-												tempY[1][1] += branch[jindexer].YSto[4];
-											}
-										}//end valid B
-										else	//Default - must be already handled
-											;
-										break;
-									}
-								default:	//How'd we get here?
-									{
-										GL_THROW("Unknown phase connection in NR self admittance diagonal");
-										/*  TROUBLESHOOT
-										An unknown phase condition was encountered in the NR solver when constructing
-										the self admittance diagonal.  Please report this bug and submit your code to 
-										the trac system.
-										*/
-									break;
-									}
-							}	//switch end
-						}	//1 or 2 phase end
-					}	//phase accumulation end
-					else		//It's nothing (no connnection)
-						;
-				}//branch traversion end
-
-				//Store the self admittance into BA_diag.  Also update the indices for possible use later
-				//Only do this if we're actually populated
-				island_index_val = bus[indexer].island_number;
+						if (proceed_flag)
+						{
+							work_vals_char_0 = temp_index_b*3;
+							//Do columns individually
+							//1
+							tempIcalcReal += (-(branch[jindexer].Yfrom[work_vals_char_0])).Re() * (bus[branch[jindexer].to].V[0]).Re() - (-(branch[jindexer].Yfrom[work_vals_char_0])).Im() * (bus[branch[jindexer].to].V[0]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+							tempIcalcImag += (-(branch[jindexer].Yfrom[work_vals_char_0])).Re() * (bus[branch[jindexer].to].V[0]).Im() + (-(branch[jindexer].Yfrom[work_vals_char_0])).Im() * (bus[branch[jindexer].to].V[0]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
 
-				if (island_index_val != -1)
-				{
-					powerflow_values->BA_diag[indexer].col_ind = powerflow_values->BA_diag[indexer].row_ind = powerflow_values->island_matrix_values[island_index_val].index_count;	// Store the row and column starting information (square matrices)
-					bus[indexer].Matrix_Loc = powerflow_values->island_matrix_values[island_index_val].index_count;								//Store our location so we know where we go
-					powerflow_values->island_matrix_values[island_index_val].index_count += powerflow_values->BA_diag[indexer].size;				// Update the index for this matrix's size, so next one is in appropriate place
-				}
+							//2
+							tempIcalcReal += (-(branch[jindexer].Yfrom[work_vals_char_0+1])).Re() * (bus[branch[jindexer].to].V[1]).Re() - (-(branch[jindexer].Yfrom[work_vals_char_0+1])).Im() * (bus[branch[jindexer].to].V[1]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+							tempIcalcImag += (-(branch[jindexer].Yfrom[work_vals_char_0+1])).Re() * (bus[branch[jindexer].to].V[1]).Im() + (-(branch[jindexer].Yfrom[work_vals_char_0+1])).Im() * (bus[branch[jindexer].to].V[1]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
 
-				//Store the admittance values into the BA_diag matrix structure
-				for ( jindex = 0 ; jindex < powerflow_values->BA_diag[indexer].size ; jindex++ )
-				{
-					for ( kindex = 0; kindex < powerflow_values->BA_diag[indexer].size ; kindex++ )			//Store values - assume square matrix - don't bother parsing what doesn't exist.
+						}
+					}//end SPCT transformer
+					else	///Must be a standard line
 					{
-						powerflow_values->BA_diag[indexer].Y[jindex][kindex] = tempY[jindex][kindex];// Store the self admittance terms.
-					}
+						work_vals_char_0 = temp_index_b*3+temp_index;
+						work_vals_double_0 = (-branch[jindexer].Yfrom[work_vals_char_0]).Re();
+						work_vals_double_1 = (-branch[jindexer].Yfrom[work_vals_char_0]).Im();
+						work_vals_double_2 = (bus[branch[jindexer].to].V[temp_index]).Re();
+						work_vals_double_3 = (bus[branch[jindexer].to].V[temp_index]).Im();
+
+						tempIcalcReal += work_vals_double_0 * work_vals_double_2 - work_vals_double_1 * work_vals_double_3;// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+						tempIcalcImag += work_vals_double_0 * work_vals_double_3 + work_vals_double_1 * work_vals_double_2;// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+
+					}//end standard line
+				}	
+				if  (branch[jindexer].to == (int)indexer)
+				{
+					work_vals_char_0 = temp_index_b*3+temp_index;
+					work_vals_double_0 = (-branch[jindexer].Yto[work_vals_char_0]).Re();
+					work_vals_double_1 = (-branch[jindexer].Yto[work_vals_char_0]).Im();
+					work_vals_double_2 = (bus[branch[jindexer].from].V[temp_index]).Re();
+					work_vals_double_3 = (bus[branch[jindexer].from].V[temp_index]).Im();
+
+					tempIcalcReal += work_vals_double_0 * work_vals_double_2 - work_vals_double_1 * work_vals_double_3;// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+					tempIcalcImag += work_vals_double_0 * work_vals_double_3 + work_vals_double_1 * work_vals_double_2;// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
 				}
+				else;
+			}
+		}//end intermediate current for each phase column
+	}//End three phase
 
-				//Copy values into node-specific link (if needed)
-				if (bus[indexer].full_Y_all != NULL)
-				{
-					for ( jindex = 0 ; jindex < powerflow_values->BA_diag[indexer].size ; jindex++ )
-					{
-						for ( kindex = 0 ; kindex < powerflow_values->BA_diag[indexer].size ; kindex++ )			//Store values - assume square matrix - don't bother parsing what doesn't exist.
-						{
-							bus[indexer].full_Y_all[jindex*3+kindex] = tempY[jindex][kindex];// Store the self admittance terms.
-						}
-					}
-				}//End self-admittance update
-			}//End diagonal construction
-
-			//Loop through the islands and set the initial items
-			for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
-			{
-				//Store the size of the diagonal, since it represents how many variables we are solving (useful later)
-				powerflow_values->island_matrix_values[island_loop_index].total_variables = powerflow_values->island_matrix_values[island_loop_index].index_count;
+	*Icalc_real = tempIcalcReal;
+	*Icalc_imag = tempIcalcImag;
+	*volt_index = temp_index_b;
+}
 
-				//Check to see if we've exceeded our max.  If so, reallocate!
-				if (powerflow_values->island_matrix_values[island_loop_index].total_variables > powerflow_values->island_matrix_values[island_loop_index].max_total_variables)
-					powerflow_values->island_matrix_values[island_loop_index].NR_realloc_needed = true;
+/** Newton-Raphson solver
+	Solves a power flow problem using the Newton-Raphson method
+	
+	@return n=0 on failure to complete a single iteration, 
+	n>0 to indicate success after n interations, or 
+	n<0 to indicate failure after n iterations
+ **/
+int64 solver_nr(unsigned int bus_count, 
+				BUSDATA *bus, 
+				unsigned int branch_count, 
+				BRANCHDATA *branch, 
+				NR_SOLVER_STRUCT *powerflow_values, 
+				NRSOLVERMODE powerflow_type , 
+				NR_MESHFAULT_IMPEDANCE *mesh_imped_vals, 
+				bool *bad_computations)
+{
+	// Begin solver timer
+	clock_t t_start = clock();
 
-				/// Build the off_diagonal_PQ bus elements of 6n*6n Y_NR matrix.Equation (12). All the value in this part will not be updated at each iteration.
-				//Constructed using sparse methodology, non-zero elements are the only thing considered (and non-PV)
-				//No longer necessarily 6n*6n any more either,
-				powerflow_values->island_matrix_values[island_loop_index].size_offdiag_PQ = 0;
-			}//End loop traversion
+	//Internal iteration counter - just NR limits
+	int64 Iteration = 0;
 
-			for (jindexer=0; jindexer<branch_count;jindexer++)	//Parse all of the branches
-			{
-				tempa  = branch[jindexer].from;
-				tempb  = branch[jindexer].to;
+	try
+	{
+		if ( solver_python_init() == 0 )
+		{
+			Iteration = solver_python_solve(bus_count,bus,branch_count,branch,powerflow_values,powerflow_type,mesh_imped_vals,bad_computations,Iteration);
+			if ( Iteration == 0 )
+			{		
+					return Iteration;
+			}
+			// else <0 proceed with NR solver
+		}
+	}
+	catch (const char *msg)
+	{
+		gl_warning("solver_py: model failed -- %s",msg);
+	}
+	catch (...)
+	{
+		gl_warning("solver_py: model failed -- unknown exception");
+	}
 
-				//Pull the island index off the from bus -- for islands, both ends SHOULD be in the same index
-				island_index_val = bus[tempa].island_number;
+	//Index for "islanding operations", when needed
+	int island_index_val;
 
-				//Check and see if we should just skip this branch -- if it's an unassociated node, probably don't need this branch
-				//Explicitly check both ends
-				if ((bus[tempa].island_number == -1) || (bus[tempb].island_number == -1))
-				{
-					//Random error check - see if the branch somehow is oddly associated
-					if (branch[jindexer].island_number != -1)
-					{
-						GL_THROW("NR line:%d - %s has an island association, but the ends do not",branch[jindexer].obj->id,(branch[jindexer].name ? branch[jindexer].name : "Unnamed"));
-						/*  TROUBLESHOOT
-						When parsing the line list, a line connected to an isolated node is still somehow associated with a proper island.
-						This should not occur.  Please submit your GLM file and a description to the 
-						issue tracker.
-						*/
-					}
-					//Default else - unassociated, so just let it go
+	//Temporary island looping value
+	int island_loop_index;
 
-					//Basically not part of any system, just skip it
-					continue;
-				}
-				else	//from/to are valid
-				{
-					//Paranoia check - make sure this line isn't somehow unassociated - ignore switching-type lines, since they are skipped when open
-					if ((branch[jindexer].island_number == -1) && (branch[jindexer].lnk_type < 3))
-					{
-						GL_THROW("NR line:%d - %s does not have a proper island association",branch[jindexer].obj->id,(branch[jindexer].name ? branch[jindexer].name : "Unnamed"));
-						/*  TROUBLESHOOT
-						When parsing the line list, a line connected to two valid nodes is still somehow unassociated.
-						This should not occur.  Please submit your GLM file and a description to the 
-						issue tracker.
-						*/
-					}
-				}
+	int64 return_value_for_solver_NR;
 
-				//Preliminary check to make sure we weren't missed in the initialization
-				if (((int)bus[tempa].Matrix_Loc == -1) || ((int)bus[tempb].Matrix_Loc == -1))
-				{
-					GL_THROW("An element in NR line:%d - %s was not properly localized",branch[jindexer].obj->id,(branch[jindexer].name ? branch[jindexer].name : "Unnamed"));
-					/*  TROUBLESHOOT
-					When parsing the bus list, the Newton-Raphson solver found a bus that did not
-					appear to have a location within the overall admittance/Jacobian matrix.  Please
-					submit this as a bug with your code on the Trac site.
-					*/
-				}
+	// begin timed block
+	{
+		SolverTimer timer("newton-raphson");
 
-				if (((branch[jindexer].phases & 0x80) == 0x80) && (branch[jindexer].v_ratio==1.0))	//Triplex, but not SPCT
-				{
-					for (jindex=0; jindex<2; jindex++)			//rows
-					{
-						for (kindex=0; kindex<2; kindex++)		//columns
-						{
-							if (((branch[jindexer].Yfrom[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))
-								powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
+		//File pointer for debug outputs
+		FILE *FPoutVal;
 
-							if (((branch[jindexer].Yto[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))  
-								powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
+		int func_result_val;
 
-							if (((branch[jindexer].Yfrom[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1)) 
-								powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
+		//Temporary function variable
+		FUNCTIONADDR temp_fxn_val;
 
-							if (((branch[jindexer].Yto[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1)) 
-								powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
-						}//end columns of split phase
-					}//end rows of split phase
-				}//end traversion of split-phase
-				else											//Three phase or some variety
-				{
-					//Make sure we aren't SPCT, otherwise things get jacked
-					if ((branch[jindexer].phases & 0x80) != 0x80)	//SPCT, but v_ratio not = 1
-					{
-						for (jindex=0; jindex<3; jindex++)			//rows
-						{
-							//See if this phase is valid
-							phase_workb = 0x04 >> jindex;
+		//Generic status variable
+		STATUS call_return_status;
 
-							if ((phase_workb & branch[jindexer].phases) == phase_workb)	//Row check
-							{
-								for (kindex=0; kindex<3; kindex++)		//columns
-								{
-									//Check this phase as well
-									phase_workd = 0x04 >> kindex;
+		//Phase collapser variable
+		unsigned char phase_worka, phase_workb, phase_workc, phase_workd, phase_worke;
 
-									if ((phase_workd & branch[jindexer].phases) == phase_workd)	//Column validity check
-									{
-										if (((branch[jindexer].Yfrom[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))
-											powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
+		//Temporary calculation variables
+		double tempIcalcReal, tempIcalcImag;
+		double tempPbus; //tempPbus store the temporary value of active power load at each bus
+		double tempQbus; //tempQbus store the temporary value of reactive power load at each bus
 
-										if (((branch[jindexer].Yto[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))  
-											powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
+		//Miscellaneous index variable
+		unsigned int indexer, tempa, tempb, jindexer, kindexer;
+		int jindex, kindex;
+		int temp_index, temp_index_b;
+		unsigned int temp_index_c;
 
-										if (((branch[jindexer].Yfrom[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1)) 
-											powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
+		//Working matrix for admittance collapsing/determinations
+		complex tempY[3][3];
 
-										if (((branch[jindexer].Yto[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1)) 
-											powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
-									}//end column validity check
-								}//end columns of 3 phase
-							}//End row validity check
-						}//end rows of 3 phase
-					}//end not SPCT
-					else	//SPCT implementation
-					{
-						for (jindex=0; jindex<3; jindex++)			//rows
-						{
-							//See if this phase is valid
-							phase_workb = 0x04 >> jindex;
+		//Localized admittance update variables
+		bool admit_localized, diag_pattern_changed;
+		unsigned int diag_pattern_prev;
 
-							if ((phase_workb & branch[jindexer].phases) == phase_workb)	//Row check
-							{
-								for (kindex=0; kindex<3; kindex++)		//Row valid, traverse all columns for SPCT Yfrom
-								{
-									if (((branch[jindexer].Yfrom[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))
-										powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
+		//Working matrix for mesh fault impedance storage, prior to "reconstruction"
+		double temp_z_store[6][6];
 
-									if (((branch[jindexer].Yfrom[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1)) 
-										powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
-								}//end columns traverse
+		//Miscellaneous flag variables
+		bool Full_Mat_A, Full_Mat_B;
 
-								//If row is valid, now traverse the rows of that column for Yto
-								for (kindex=0; kindex<3; kindex++)
-								{
-									if (((branch[jindexer].Yto[kindex*3+jindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))  
-										powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
-
-									if (((branch[jindexer].Yto[kindex*3+jindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1)) 
-										powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
-								}//end rows traverse
-							}//End row validity check
-						}//end rows of 3 phase
-					}//End SPCT
-				}//end three phase
-			}//end line traversion
-
-			//Loop through the islands again
-			for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
-			{
-				//Allocate the space - double the number found (each element goes in two places)
-				if (powerflow_values->island_matrix_values[island_loop_index].Y_offdiag_PQ == NULL)
-				{
-					powerflow_values->island_matrix_values[island_loop_index].Y_offdiag_PQ = (Y_NR *)gl_malloc((powerflow_values->island_matrix_values[island_loop_index].size_offdiag_PQ*2) *sizeof(Y_NR));   //powerflow_values->island_matrix_values[x].Y_offdiag_PQ store the row,column and value of off_diagonal elements of Bus Admittance matrix in which all the buses are not PV buses. 
+		//Deltamode intermediate variables
+		complex temp_complex_0, temp_complex_1, temp_complex_2, temp_complex_3, temp_complex_4;
+		complex aval, avalsq;
 
-					//Make sure it worked
-					if (powerflow_values->island_matrix_values[island_loop_index].Y_offdiag_PQ == NULL)
-						GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
+		//Temporary size variable
+		int temp_size, temp_size_b, temp_size_c;
 
-					//Save our size
-					powerflow_values->island_matrix_values[island_loop_index].max_size_offdiag_PQ = powerflow_values->island_matrix_values[island_loop_index].size_offdiag_PQ;	//Don't care about the 2x, since we'll be comparing it against itself
-				}
-				else if (powerflow_values->island_matrix_values[island_loop_index].size_offdiag_PQ > powerflow_values->island_matrix_values[island_loop_index].max_size_offdiag_PQ)	//Something changed and we are bigger!!
-				{
-					//Destroy us!
-					gl_free(powerflow_values->island_matrix_values[island_loop_index].Y_offdiag_PQ);
+		//Temporary admittance variables
+		complex Temp_Ad_A[3][3];
+		complex Temp_Ad_B[3][3];
 
-					//Rebuild us, we have the technology
-					powerflow_values->island_matrix_values[island_loop_index].Y_offdiag_PQ = (Y_NR *)gl_malloc((powerflow_values->island_matrix_values[island_loop_index].size_offdiag_PQ*2) *sizeof(Y_NR));
+		//DV checking array
+		complex DVConvCheck[3];
+		double CurrConvVal;
 
-					//Make sure it worked
-					if (powerflow_values->island_matrix_values[island_loop_index].Y_offdiag_PQ == NULL)
-						GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
+		//Miscellaneous working variable
+		double work_vals_double_0, work_vals_double_1,work_vals_double_2,work_vals_double_3,work_vals_double_4;
+		bool something_has_been_output;
 
-					//Store the new size
-					powerflow_values->island_matrix_values[island_loop_index].max_size_offdiag_PQ = powerflow_values->island_matrix_values[island_loop_index].size_offdiag_PQ;
+		//SuperLU variables
+		SuperMatrix L_LU,U_LU;
+		NCformat *Astore;
+		DNformat *Bstore;
+		int nnz, info;
+		unsigned int m,n;
+		double *sol_LU;
 
-					//Flag for a reallocation
-					powerflow_values->island_matrix_values[island_loop_index].NR_realloc_needed = true;
-				}
+		//Spare notation variable - for output
+		SP_E *temp_element;
+		int row, col;
+		double value;
 
-				//Zero the indexer term used in the next section
-				powerflow_values->island_matrix_values[island_loop_index].indexer = 0;
-			}//End island loop
+		//Multi-island passes
+		bool still_iterating_islands;
+		bool proceed_to_next_island;
 
-			for (jindexer=0; jindexer<branch_count;jindexer++)	//Parse through all of the branches
-			{
-				//Extract both ends
-				tempa  = branch[jindexer].from;
-				tempb  = branch[jindexer].to;
+		//Multi-island pointer to current superLU variables
+		SUPERLU_NR_vars *curr_island_superLU_vars;
 
-				//Pull the island index off the from bus -- for islands, both ends SHOULD be in the same index
-				island_index_val = bus[tempa].island_number;
+		//Chord Newton variables
+		bool chord_active, chord_admit_changed, chord_reused, chord_factors_held;
 
-				//Make sure it isn't invalid -- if it is, just skip this, since that means these lines do nothing anyways
-				//Explicit check on "oddities" for island association was earlier
-				if (branch[jindexer].island_number == -1)
-				{
-					continue;
-				}
+		//Linearized screening variables
+		bool linear_active, linear_update, linear_verified;
+		double linear_mismatch_tol;
+	
+#ifndef MT
+		superlu_options_t options;	//Additional variables for sequential superLU
+		SuperLUStat_t stat;
+#else
+		Gstat_t chord_stat;	//Statistics for triangular solves with retained factors
+#endif
 
-				phase_worka = 0;
-				phase_workb = 0;
-				for (jindex=0; jindex<3; jindex++)		//Accumulate number of phases
-				{
-					phase_worka += ((bus[tempa].phases & (0x01 << jindex)) >> jindex);
-					phase_workb += ((bus[tempb].phases & (0x01 << jindex)) >> jindex);
-				}
+		//Set the global - we're working now, so no more adjustments to island arrays until we're done (except removals)
+		NR_solver_working = true;
 
-				if ((phase_worka==3) && (phase_workb==3))	//Both ends are full three phase, normal operations
-				{
-					for (jindex=0; jindex<3; jindex++)		//Loop through rows of admittance matrices				
-					{
-						//See if this row is valid for this branch
-						phase_workd = 0x04 >> jindex;
+		//General "short circuit check" - if there are no islands, just leave
+		if (NR_islands_detected <= 0)
+		{
+			//Make sure the bad computations flag is set
+			*bad_computations = false;
 
-						if ((branch[jindexer].phases & phase_workd) == phase_workd)	//Validity check
-						{
-							for (kindex=0; kindex<3; kindex++)	//Loop through columns of admittance matrices
-							{
-								//Extract column information
-								phase_worke = 0x04 >> kindex;
+			return 0;	//Not really a valid return, but with the false above, should still continue
+		}
 
-								if ((branch[jindexer].phases & phase_worke) == phase_worke)	//Valid column too!
-								{
-									//Indices counted out from Self admittance above.  needs doubling due to complex separation
-									if (((branch[jindexer].Yfrom[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From imags
-									{
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Im());
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex + 3;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 3;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (branch[jindexer].Yfrom[jindex*3+kindex]).Im();
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-									}
+		//Start a new timestep from extrapolated voltages, if desired - not on topology changes (the history doesn't apply)
+		powerflow_values->V_predicted_count = 0;
+		if ((NR_voltage_predictor == true) && (powerflow_type == PF_NORMAL) && (NR_admit_change == false))
+		{
+			NR_predict_voltages(bus_count,bus,powerflow_values);
+		}
 
-									if (((branch[jindexer].Yto[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To imags
-									{
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[jindex*3+kindex]).Im());
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex + 3;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex + 3;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (branch[jindexer].Yto[jindex*3+kindex]).Im();
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-									}
+		//Initialize the tracker variable inside each island, just in case
+		for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
+		{
+			powerflow_values->island_matrix_values[island_loop_index].index_count = 0;
+		}
 
-									if (((branch[jindexer].Yfrom[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From reals
-									{
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex + 3;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 3;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
-									}
+		//Ensure bad computations flag is set first
+		*bad_computations = false;
 
-									if (((branch[jindexer].Yto[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To reals
-									{
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex + 3;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[jindex*3+kindex]).Re());
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex + 3;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[jindex*3+kindex]).Re());
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
-									}
-								}//End valid column
-							}//column end
-						}//End valid row
-					}//row end
-				}//if all 3 end
-				else if (((bus[tempa].phases & 0x80) == 0x80) || ((bus[tempb].phases & 0x80) == 0x80))	//Someone's a triplex
+		//Determine special circumstances of SWING bus -- do we want it to truly participate right
+		if (powerflow_type != PF_NORMAL)
+		{
+			if (powerflow_type == PF_DYNCALC)	//Parse the list -- anything that is a swing and a generator, deflag it out of principle (and to make it work right)
+			{
+				//Set the master swing flag - do for all islands
+				for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
 				{
-					if (((bus[tempa].phases & 0x80) == 0x80) && ((bus[tempb].phases & 0x80) == 0x80))	//Both are triplex, easy case
+					powerflow_values->island_matrix_values[island_loop_index].swing_is_a_swing = false;
+				}
+
+				//Check the buses
+				for (indexer=0; indexer<bus_count; indexer++)
+				{
+					//See if we're a swing-flagged bus
+					if ((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == true))
 					{
-						for (jindex=0; jindex<2; jindex++)		//Loop through rows of admittance matrices (only 2x2)
+						//See if we're "generator ready"
+						if ((*bus[indexer].dynamics_enabled==true) && (bus[indexer].DynCurrent != NULL))
 						{
-							for (kindex=0; kindex<2; kindex++)	//Loop through columns of admittance matrices (only 2x2)
-							{
-								//Make sure one end of us isn't a SPCT transformer To node (they are different)
-								if (((bus[tempa].phases & 0x20) & (bus[tempb].phases & 0x20)) == 0x20)	//Both ends are SPCT tos
-								{
-									GL_THROW("NR: SPCT to SPCT via triplex connections are unsupported at this time.");
-									/*  TROUBLESHOOT
-									The Newton-Raphson solve does not currently support running a triplex line between the low-voltage
-									side of two different split-phase center tapped transformers.  This functionality may be added if needed
-									in the future.
-									*/
-								}//end both ends SPCT to
-								else if ((bus[tempa].phases & 0x20) == 0x20)	//From end is a SPCT to
-								{
-									//Indices counted out from Self admittance above.  needs doubling due to complex separation
+							//Deflag us back to "PQ" status
+							bus[indexer].swing_functions_enabled = false;
+						}
+					}
+					//Default else -- normal bus
+				}//End bus traversion loop
+			}//Handle running dynamics differently
+			else	//Must be PF_DYNINIT
+			{
+				//Loop through the islands
+				for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
+				{
+					//Flag us as true, initially
+					powerflow_values->island_matrix_values[island_loop_index].swing_is_a_swing = true;
+				}
+			}
+		}//End not normal
+		else	//Must be normal
+		{
+			//Loop through all islands
+			for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
+			{
+				powerflow_values->island_matrix_values[island_loop_index].swing_is_a_swing = true;	//Flag as a swing, even though this shouldn't do anything
+			}
+		}
 
-									if (((branch[jindexer].Yfrom[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From imags
-									{
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = ((branch[jindexer].Yfrom[jindex*3+kindex]).Im());
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-										
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex + 2;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(branch[jindexer].Yfrom[jindex*3+kindex]).Im();
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-									}
+		//Populate aval, if necessary
+		if (powerflow_type == PF_DYNINIT)
+		{
+			//Conversion variables - 1@120-deg
+			aval = complex(-0.5,(sqrt(3.0)/2.0));
+			avalsq = aval*aval;	//squared value is used a couple places too
+		}
+		else	//Zero it, just in case something uses it (what would???)
+		{
+			aval = 0.0;
+			avalsq = 0.0;
+		}
 
-									if (((branch[jindexer].Yto[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To imags
-									{
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[jindex*3+kindex]).Im());
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-										
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex + 2;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex + 2;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (branch[jindexer].Yto[jindex*3+kindex]).Im();
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-									}
+		if (matrix_solver_method==MM_EXTERN)
+		{
+			for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
+			{
+				//Call the initialization routine
+				powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars = ((void *(*)(void *))(LUSolverFcns.ext_init))(powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars);
 
-									if (((branch[jindexer].Yfrom[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From reals
-									{
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex + 2;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = ((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-										
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = ((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
-									}
+				//Make sure it worked (allocation check)
+				if (powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars==NULL)
+				{
+					GL_THROW("External LU matrix solver failed to allocate memory properly!");
+					/*  TROUBLESHOOT
+					While attempting to allocate memory for the external LU solver, an error occurred.
+					Please try again.  If the error persists, ensure your external LU solver is behaving correctly
+					and coordinate with their development team as necessary.
+					*/
+				}
+			}//End Island loop
+		}
+		else if (matrix_solver_method == MM_SUPERLU)	//SuperLU multi-island-related item
+		{
+			//Loop through and see if we need to allocate things
+			for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
+			{
+				//See if the superLU variables are populated
+				if (powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars == NULL)
+				{
+					//Allocate one up
+					curr_island_superLU_vars = (SUPERLU_NR_vars *)gl_malloc(sizeof(SUPERLU_NR_vars));
 
-									if (((branch[jindexer].Yto[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1 && bus[tempb].type != 1))	//To reals
-									{
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex + 2;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[jindex*3+kindex]).Re());
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-										
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex + 2;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[jindex*3+kindex]).Re());
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
-									}
-								}//end From end SPCT to
-								else if ((bus[tempb].phases & 0x20) == 0x20)	//To end is a SPCT to
-								{
-									//Indices counted out from Self admittance above.  needs doubling due to complex separation
+					//Make sure it worked
+					if (curr_island_superLU_vars == NULL)
+					{
+						GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
+						//Defined elsewhere
+					}
 
-									//Make sure we aren't the transformer
-									if (branch[jindexer].lnk_type == 1)	//We're not, we're a line - proceed
-									{
+					//Initialize it, for giggles/paranoia
+					curr_island_superLU_vars->A_LU.Store = NULL;
 
-										//Indices counted out from Self admittance above.  needs doubling due to complex separation
-										if (((branch[jindexer].Yfrom[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From imags
-										{
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Im());
-											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+					//Do the same for the underlying properties, just because
+					curr_island_superLU_vars->A_LU.Stype = SLU_NC;
+					curr_island_superLU_vars->A_LU.Dtype = SLU_D;
+					curr_island_superLU_vars->A_LU.Mtype = SLU_GE;
+					curr_island_superLU_vars->A_LU.nrow = 0;
+					curr_island_superLU_vars->A_LU.ncol = 0;
 
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex + 2;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (branch[jindexer].Yfrom[jindex*3+kindex]).Im();
-											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-										}
-
-										if (((branch[jindexer].Yto[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To imags
-										{
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = ((branch[jindexer].Yto[jindex*3+kindex]).Im());
-											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+					//Repeat for B_LU
+					curr_island_superLU_vars->B_LU.Store = NULL;
 
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex + 2;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex + 2;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(branch[jindexer].Yto[jindex*3+kindex]).Im();
-											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-										}
+					//Do the same for the underlying properties, just because
+					curr_island_superLU_vars->B_LU.Stype = SLU_NC;
+					curr_island_superLU_vars->B_LU.Dtype = SLU_D;
+					curr_island_superLU_vars->B_LU.Mtype = SLU_GE;
+					curr_island_superLU_vars->B_LU.nrow = 0;
+					curr_island_superLU_vars->B_LU.ncol = 0;
 
-										if (((branch[jindexer].Yfrom[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From reals
-										{
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex + 2;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
-											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+					//Other arrays
+					curr_island_superLU_vars->perm_c = NULL;
+					curr_island_superLU_vars->perm_r = NULL;
 
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
-											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-										}
+					//Chord Newton retained factors - nothing yet
+					curr_island_superLU_vars->factors_valid = false;
+					curr_island_superLU_vars->refactor_needed = false;
+					curr_island_superLU_vars->factor_m = 0;
+					curr_island_superLU_vars->factor_nnz = 0;
+					curr_island_superLU_vars->last_mismatch = 0.0;
+					curr_island_superLU_vars->linear_check = false;
 
-										if (((branch[jindexer].Yto[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1 && bus[tempb].type != 1))	//To reals
-										{
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex + 2;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = ((branch[jindexer].Yto[jindex*3+kindex]).Re());
-											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+					//Assign it in
+					powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars = (void *)curr_island_superLU_vars;
+				}
+			}
 
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex + 2;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = ((branch[jindexer].Yto[jindex*3+kindex]).Re());
-											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-										}
-									}//End SPCT TO bus and we're a line
-									else	//Transformer to - don't do things weird
-									{
-										if (((branch[jindexer].Yfrom[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From imags
-										{
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Im());
-											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+			//Renull the random pointer, just in case
+			curr_island_superLU_vars = NULL;
+		}
 
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex + 2;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (branch[jindexer].Yfrom[jindex*3+kindex]).Im();
-											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-										}
+		//See if only the admittance values of individual branches changed (e.g., regulator taps) - if so, just patch those
+		admit_localized = false;
+		diag_pattern_changed = false;
+		diag_pattern_prev = 0;
 
-										if (((branch[jindexer].Yto[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To imags
-										{
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = ((branch[jindexer].Yto[jindex*3+kindex]).Im());
-											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+		if ((NR_admit_change == false) && (NR_admit_branch_change == true))
+		{
+			//Need a prior full build to have something to patch
+			admit_localized = (powerflow_values->BA_diag != NULL);
 
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex + 2;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex + 2;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(branch[jindexer].Yto[jindex*3+kindex]).Im();
-											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-										}
+			for (jindexer=0; ((jindexer<branch_count) && (admit_localized == true)); jindexer++)
+			{
+				if (branch[jindexer].admit_change == true)
+				{
+					//Unassociated branches don't contribute anything - just deflag them
+					if (branch[jindexer].island_number == -1)
+					{
+						branch[jindexer].admit_change = false;
+						continue;
+					}
 
-										if (((branch[jindexer].Yfrom[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From reals
-										{
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex + 2;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
-											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+					//If the non-zero pattern changed, the entry locations are no longer valid - do the full rebuild
+					if (branch_offdiag_pattern(&branch[jindexer]) != branch[jindexer].offdiag_pattern)
+					{
+						admit_localized = false;
+					}
+					else	//Flag both ends for a self-admittance update
+					{
+						bus[branch[jindexer].from].admit_change = true;
+						bus[branch[jindexer].to].admit_change = true;
+					}
+				}
+			}
 
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
-											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-										}
+			//Fall back to the full rebuild
+			if (admit_localized == false)
+			{
+				for (indexer=0; indexer<bus_count; indexer++)
+				{
+					bus[indexer].admit_change = false;
+				}
 
-										if (((branch[jindexer].Yto[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1 && bus[tempb].type != 1))	//To reals
-										{
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex + 2;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = ((branch[jindexer].Yto[jindex*3+kindex]).Re());
-											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+				NR_admit_change = true;
+			}
+		}
 
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex + 2;
-											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = ((branch[jindexer].Yto[jindex*3+kindex]).Re());
-											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-										}
-									}//End SPCT TO and we're the transformer
-								}//end To end SPCT to
-								else											//Plain old ugly line
-								{
-									//Indices counted out from Self admittance above.  needs doubling due to complex separation
+		//Branch changes are handled either way now
+		NR_admit_branch_change = false;
 
-									if (((branch[jindexer].Yfrom[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From imags
-									{
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Im());
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-										
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex + 2;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (branch[jindexer].Yfrom[jindex*3+kindex]).Im();
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-									}
+		//Any admittance change makes retained chord factors stale
+		chord_admit_changed = (NR_admit_change || admit_localized);
 
-									if (((branch[jindexer].Yto[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To imags
-									{
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[jindex*3+kindex]).Im());
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-										
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex + 2;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex + 2;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (branch[jindexer].Yto[jindex*3+kindex]).Im();
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-									}
+		if (NR_admit_change || admit_localized)	//If an admittance update was detected, fix it
+		{
+			//Build the diagonal elements of the bus admittance matrix - this should only happen once no matter what
+			if (powerflow_values->BA_diag == NULL)
+			{
+				powerflow_values->BA_diag = (Bus_admit *)gl_malloc(bus_count *sizeof(Bus_admit));   //BA_diag store the location and value of diagonal elements of Bus Admittance matrix
 
-									if (((branch[jindexer].Yfrom[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From reals
-									{
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex + 2;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-										
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
-									}
+				//Make sure it worked
+				if (powerflow_values->BA_diag == NULL)
+				{
+					GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
+					/*  TROUBLESHOOT
+					During the allocation stage of the NR algorithm, one of the matrices failed to be allocated.
+					Please try again and if this bug persists, submit your code and a bug report using the trac
+					website.
+					*/
+				}
+			}
+			
+			//Loop the islands and reset the bus count, just in case - localized updates keep the existing structure
+			if (admit_localized == false)
+			{
+				for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
+				{
+					powerflow_values->island_matrix_values[island_loop_index].bus_count = 0;
+				}
+			}
 
-									if (((branch[jindexer].Yto[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1 && bus[tempb].type != 1))	//To reals
-									{
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex + 2;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[jindex*3+kindex]).Re());
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-										
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex + 2;
-										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[jindex*3+kindex]).Re());
-										powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
-									}
-								}//end Normal triplex branch
-							}//column end
-						}//row end
-					}//end both triplexy
-					else if ((bus[tempa].phases & 0x80) == 0x80)	//From is the triplex - this implies transformer with or something, we don't support this
-					{
-						GL_THROW("NR does not support triplex to 3-phase connections.");
-						/*  TROUBLESHOOT
-						The Newton-Raphson solver does not have any implementation elements
-						to support the connection of a split-phase or triplex node to a three-phase
-						node.  The opposite (3-phase to triplex) is available as the split-phase-center-
-						tapped transformer model.  See if that will work for your implementation.
-						*/
-					}//end from triplexy
-					else	//Only option left is the to must be the triplex - implies SPCT xformer - so only one phase on the three-phase side (we just need to figure out where)
+			for (indexer=0; indexer<bus_count; indexer++) // Construct the diagonal elements of Bus admittance matrix.
+			{
+				if (admit_localized == true)
+				{
+					//Only the ends of changed branches need their self-admittance recomputed
+					if (bus[indexer].admit_change == false)
 					{
-						//Extract the line phase
-						phase_workc = (branch[jindexer].phases & 0x07);
+						continue;
+					}
 
-						//Reset temp_index and size, just in case
-						temp_index = -1;
-						temp_size = -1;
+					//Store the fixed diagonal pattern, to see if it can be patched in place
+					diag_pattern_prev = bus_diag_fixed_pattern(&(powerflow_values->BA_diag[indexer]));
+				}
+				else if (bus[indexer].island_number != -1)	//Increment the island bus counter
+				{
+					powerflow_values->island_matrix_values[bus[indexer].island_number].bus_count++;
+				}
 
-						//Figure out what the offset on the from side is (how many phases and which one we are)
-						switch(bus[tempa].phases & 0x07)
-						{
-							case 0x01:	//C
-								{
-									temp_size = 1;	//Single phase matrix
+				//Determine the size we need
+				if ((bus[indexer].phases & 0x80) == 0x80)	//Split phase
+					powerflow_values->BA_diag[indexer].size = 2;
+				else										//Other cases, figure out how big they are
+				{
+					phase_worka = 0;
+					for (jindex=0; jindex<3; jindex++)		//Accumulate number of phases
+					{
+						phase_worka += ((bus[indexer].phases & (0x01 << jindex)) >> jindex);
+					}
+					powerflow_values->BA_diag[indexer].size = phase_worka;
+				}
 
-									if (phase_workc==0x01)	//Line is phase C
-									{
-										//Only C in the node, so no offset
-										temp_index = 0;
-									}
-									else if (phase_workc==0x02)	//Line is phase B
-									{
-										GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
-										/*  TROUBLESHOOT
-										A split-phase, center-tapped transformer in the Newton-Raphson solver is somehow attached
-										to a node that is missing the required phase of the transformer.  This should have been caught.
-										Please submit your code and a bug report using the trac website.
-										*/
-									}
-									else					//Has to be phase A
-										GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
-
-									break;
-								}
-							case 0x02:	//B
-								{
-									temp_size = 1;	//Single phase matrix
-
-									if (phase_workc==0x01)	//Line is phase C
-										GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
-									else if (phase_workc==0x02)	//Line is phase B
-									{
-										//Only B in the node, so no offset
-										temp_index = 0;
-									}
-									else					//Has to be phase A
-										GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
-
-									break;
-								}
-							case 0x03:	//BC
-								{
-									temp_size = 2;	//Two phase matrix
-
-									if (phase_workc==0x01)	//Line is phase C
-									{
-										//BC in the node, so offset by 1
-										temp_index = 1;
-									}
-									else if (phase_workc==0x02)	//Line is phase B
-									{
-										//BC in the node, so offset by 0
-										temp_index = 0;
-									}
-									else					//Has to be phase A
-										GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
-
-									break;
-								}
-							case 0x04:	//A
-								{
-									temp_size = 1;	//Single phase matrix
-
-									if (phase_workc==0x01)	//Line is phase C
-										GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
-									else if (phase_workc==0x02)	//Line is phase B
-										GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
-									else					//Has to be phase A
-									{
-										//Only A in the node, so no offset
-										temp_index = 0;
-									}
-
-									break;
-								}
-							case 0x05:	//AC
-								{
-									temp_size = 2;	//Two phase matrix
-
-									if (phase_workc==0x01)	//Line is phase C
-									{
-										//AC in the node, so offset by 1
-										temp_index = 1;
-									}
-									else if (phase_workc==0x02)	//Line is phase B
-										GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
-									else					//Has to be phase A
-									{
-										//AC in the node, so offset by 0
-										temp_index = 0;
-									}
-
-									break;
-								}
-							case 0x06:	//AB
-								{
-									temp_size = 2;	//Two phase matrix
-
-									if (phase_workc==0x01)	//Line is phase C
-										GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
-									else if (phase_workc==0x02)	//Line is phase B
-									{
-										//BC in the node, so offset by 1
-										temp_index = 1;
-									}
-									else					//Has to be phase A
-									{
-										//AB in the node, so offset by 0
-										temp_index = 0;
-									}
-
-									break;
-								}
-							case 0x07:	//ABC
-								{
-									temp_size = 3;	//Three phase matrix
-
-									if (phase_workc==0x01)	//Line is phase C
-									{
-										//ABC in the node, so offset by 2
-										temp_index = 2;
-									}
-									else if (phase_workc==0x02)	//Line is phase B
-									{
-										//ABC in the node, so offset by 1
-										temp_index = 1;
-									}
-									else					//Has to be phase A
-									{
-										//ABC in the node, so offset by 0
-										temp_index = 0;
-									}
-
-									break;
-								}
-							default:
-								GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
-								break;
-						}//end switch
-						if (((int)temp_index==-1) || ((int)temp_size==-1))	//Should never get here
-							GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
-
-						//Determine first index
-						if (phase_workc==0x01)	//Line is phase C
-						{
-							jindex=2;
-						}//end line C if
-						else if (phase_workc==0x02)	//Line is phase B
-						{
-							jindex=1;
-						}//end line B if
-						else						//Line has to be phase A
-						{
-							jindex=0;
-						}//End line A if
-
-
-						//Indices counted out from Self admittance above.  needs doubling due to complex separation
-						for (kindex=0; kindex<2; kindex++)	//Loop through columns of admittance matrices (only 2x2)
-						{
+				//Ensure the admittance matrix is zeroed
+				for (jindex=0; jindex<3; jindex++)
+				{
+					for (kindex=0; kindex<3; kindex++)
+					{
+						powerflow_values->BA_diag[indexer].Y[jindex][kindex] = 0;
+						tempY[jindex][kindex] = 0;
+					}
+				}
 
-							if (((branch[jindexer].Yfrom[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From imags
+				//If we're in any deltamode, store out self-admittance as well, if it exists
+				if ((powerflow_type!=PF_NORMAL) && (bus[indexer].full_Y != NULL))
+				{
+					//Not triplex
+					if ((bus[indexer].phases & 0x80) != 0x80)
+					{
+						//Figure out what our casing looks like - populate based on this (in case some were children)
+						switch(bus[indexer].phases & 0x07) {
+							case 0x00:	//No phases
 							{
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index;
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Im());
-								powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-								
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + temp_size;
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (branch[jindexer].Yfrom[jindex*3+kindex]).Im();
-								powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+								break;	//Just get us out
 							}
-
-							if (((branch[jindexer].Yto[kindex*3+jindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To imags
+							case 0x01:	//Phase C
 							{
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + kindex;
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index;
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[kindex*3+jindex]).Im());
-								powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-								
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + temp_size;
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (branch[jindexer].Yto[kindex*3+jindex]).Im();
-								powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+								tempY[0][0] = bus[indexer].full_Y[8];
+								break;
 							}
-
-							if (((branch[jindexer].Yfrom[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From reals
+							case 0x02:	//Phase B
 							{
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + temp_size;
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
-								powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-								
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index;
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
-								powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
+								tempY[0][0] = bus[indexer].full_Y[4];
+								break;
 							}
-
-							if (((branch[jindexer].Yto[kindex*3+jindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To reals
+							case 0x03:	//Phase BC
 							{
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index;
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[kindex*3+jindex]).Re());
-								powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-								
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + kindex;
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + temp_size;
-								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[kindex*3+jindex]).Re());
-								powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
+								tempY[0][0] = bus[indexer].full_Y[4];
+								tempY[0][1] = bus[indexer].full_Y[5];
+								tempY[1][0] = bus[indexer].full_Y[7];
+								tempY[1][1] = bus[indexer].full_Y[8];
+								break;
 							}
-						}//secondary index end
-
-					}//end to triplexy
-				}//end triplex in here
-				else					//Some combination of not-3 phase
-				{
-					//Clear working variables, just in case
-					temp_index = temp_index_b = -1;
-					temp_size = temp_size_b = temp_size_c = -1;
-					Full_Mat_A = Full_Mat_B = false;
-
-					//Intermediate store the admittance matrices so they can be directly indexed later
-					switch(branch[jindexer].phases & 0x07) {
-						case 0x00:	//No phases (open switch or reliability excluded item)
+							case 0x04:	//Phase A
 							{
-								temp_size_c = -99;	//Arbitrary flag
+								tempY[0][0] = bus[indexer].full_Y[0];
 								break;
 							}
-						case 0x01:	//C only
+							case 0x05:	//Phase AC
 							{
-								Temp_Ad_A[0][0] = branch[jindexer].Yfrom[8];
-								Temp_Ad_B[0][0] = branch[jindexer].Yto[8];
-								temp_size_c = 1;
+								tempY[0][0] = bus[indexer].full_Y[0];
+								tempY[0][1] = bus[indexer].full_Y[2];
+								tempY[1][0] = bus[indexer].full_Y[6];
+								tempY[1][1] = bus[indexer].full_Y[8];
 								break;
 							}
-						case 0x02:	//B only
+							case 0x06:	//Phase AB
 							{
-								Temp_Ad_A[0][0] = branch[jindexer].Yfrom[4];
-								Temp_Ad_B[0][0] = branch[jindexer].Yto[4];
-								temp_size_c = 1;
+								tempY[0][0] = bus[indexer].full_Y[0];
+								tempY[0][1] = bus[indexer].full_Y[1];
+								tempY[1][0] = bus[indexer].full_Y[3];
+								tempY[1][1] = bus[indexer].full_Y[4];
 								break;
 							}
-						case 0x03:	//BC only
+							case 0x07:	//Phase ABC
 							{
-								Temp_Ad_A[0][0] = branch[jindexer].Yfrom[4];
-								Temp_Ad_A[0][1] = branch[jindexer].Yfrom[5];
-								Temp_Ad_A[1][0] = branch[jindexer].Yfrom[7];
-								Temp_Ad_A[1][1] = branch[jindexer].Yfrom[8];
-								
-								Temp_Ad_B[0][0] = branch[jindexer].Yto[4];
-								Temp_Ad_B[0][1] = branch[jindexer].Yto[5];
-								Temp_Ad_B[1][0] = branch[jindexer].Yto[7];
-								Temp_Ad_B[1][1] = branch[jindexer].Yto[8];
-
-								temp_size_c = 2;
-								break;
-							}
-						case 0x04:	//A only
-							{
-								Temp_Ad_A[0][0] = branch[jindexer].Yfrom[0];
-								Temp_Ad_B[0][0] = branch[jindexer].Yto[0];
-								temp_size_c = 1;
-								break;
-							}
-						case 0x05:	//AC only
-							{
-								Temp_Ad_A[0][0] = branch[jindexer].Yfrom[0];
-								Temp_Ad_A[0][1] = branch[jindexer].Yfrom[2];
-								Temp_Ad_A[1][0] = branch[jindexer].Yfrom[6];
-								Temp_Ad_A[1][1] = branch[jindexer].Yfrom[8];
-								
-								Temp_Ad_B[0][0] = branch[jindexer].Yto[0];
-								Temp_Ad_B[0][1] = branch[jindexer].Yto[2];
-								Temp_Ad_B[1][0] = branch[jindexer].Yto[6];
-								Temp_Ad_B[1][1] = branch[jindexer].Yto[8];
-
-								temp_size_c = 2;
-								break;
-							}
-						case 0x06:	//AB only
-							{
-								Temp_Ad_A[0][0] = branch[jindexer].Yfrom[0];
-								Temp_Ad_A[0][1] = branch[jindexer].Yfrom[1];
-								Temp_Ad_A[1][0] = branch[jindexer].Yfrom[3];
-								Temp_Ad_A[1][1] = branch[jindexer].Yfrom[4];
-								
-								Temp_Ad_B[0][0] = branch[jindexer].Yto[0];
-								Temp_Ad_B[0][1] = branch[jindexer].Yto[1];
-								Temp_Ad_B[1][0] = branch[jindexer].Yto[3];
-								Temp_Ad_B[1][1] = branch[jindexer].Yto[4];
-
-								temp_size_c = 2;
+								//Loop and add all in
+								for (jindex=0; jindex<3; jindex++)
+								{
+									for (kindex=0; kindex<3; kindex++)
+									{
+										tempY[jindex][kindex] = bus[indexer].full_Y[jindex*3+kindex];	//Adds in any self-admittance terms (generators)
+									}
+								}
 								break;
 							}
-						default:
+							default:
 							{
-								break;
+								GL_THROW("NR: Improper Norton equivalent admittance found");
+								/*  TROUBLESHOOT
+								While mapping Norton equivalent impedances into the system, an unexpected
+								phase condition was encountered with the admittance.  Please try again.  If the error
+								persists, please submit a bug report via the issue tracker.
+								*/
 							}
-					}//end line switch/case
-
-					if ( temp_size_c == -99 )
-					{
-						continue;	//Next iteration of branch loop
+						}//End case
 					}
-
-					if ( temp_size_c == -1 )	//Make sure it is right
+					else  //Must be Triplex - add the "12" combination for the shunt
 					{
-						GL_THROW("NR: A line's phase was flagged as not full three-phase, but wasn't: (%s) %u %u %u %u", 
-										 branch[jindexer].name, branch[jindexer].phases, branch[jindexer].origphases, phase_worka, phase_workb);
-						/*  TROUBLESHOOT
-						A line inside the powerflow model was flagged as not being full three-phase or
-						triplex in any form.  It failed the other cases though, so it must have been.
-						Please submit your code and a bug report to the trac website.
-						*/
+						//See if we're the stupid "backwards notation" bus or not
+						if ((bus[indexer].phases & 0x20) == 0x20)	//Special case
+						{
+							//Need to be negated, due to crazy conventions
+							tempY[0][0] = -bus[indexer].full_Y[0];
+							tempY[0][1] = -bus[indexer].full_Y[0];
+							tempY[1][0] = bus[indexer].full_Y[0];
+							tempY[1][1] = bus[indexer].full_Y[0];
+						}
+						else	//Standard triplex
+						{
+							tempY[0][0] = bus[indexer].full_Y[0];
+							tempY[0][1] = bus[indexer].full_Y[0];
+							tempY[1][0] = -bus[indexer].full_Y[0];
+							tempY[1][1] = -bus[indexer].full_Y[0];
+						}
 					}
+				}
 
-					//Check the from side and get all appropriate offsets
-					switch(bus[tempa].phases & 0x07) {
-						case 0x01:	//C
-							{
-								if ((branch[jindexer].phases & 0x07) == 0x01)	//C
-								{
-									temp_size = 1;		//Single size
-									temp_index = 0;		//No offset (only 1 big)
-								}
-								else
-								{
-									GL_THROW("NR: One of the lines has invalid phase parameters");
-									/*  TROUBLESHOOT
-									One of the lines in the powerflow model has an invalid phase in
-									reference to its to and from ends.  This should have been caught
-									earlier, so submit your code and a bug report using the trac website.
-									*/
-								}
-								break;
-							}//end 0x01
-						case 0x02:	//B
-							{
-								if ((branch[jindexer].phases & 0x07) == 0x02)	//B
-								{
-									temp_size = 1;		//Single size
-									temp_index = 0;		//No offset (only 1 big)
-								}
-								else
-								{
-									GL_THROW("NR: One of the lines has invalid phase parameters");
-								}
-								break;
-							}//end 0x02
-						case 0x03:	//BC
-							{
-								temp_size = 2;	//Size of this matrix's admittance
-								if ((branch[jindexer].phases & 0x07) == 0x01)	//C
-								{
-									temp_index = 1;		//offset
-								}
-								else if ((branch[jindexer].phases & 0x07) == 0x02)	//B
-								{
-									temp_index = 0;		//offset
-								}
-								else if ((branch[jindexer].phases & 0x07) == 0x03)	//BC
-								{
-									temp_index = 0;
-								}
-								else
-								{
-									GL_THROW("NR: One of the lines has invalid phase parameters");
-								}
-								break;
-							}//end 0x03
-						case 0x04:	//A
+				//Now go through all of the branches to get the self admittance information (hinges on size)
+				for (kindexer=0; kindexer<(bus[indexer].Link_Table_Size);kindexer++)
+				{ 
+					//Assign jindexer as intermediate variable (easier for me this way)
+					jindexer = bus[indexer].Link_Table[kindexer];
+
+					if ((branch[jindexer].from == (int)indexer) || (branch[jindexer].to == (int)indexer))	//Bus is the from or to side of things - not sure how it would be in link table otherwise, but meh
+					{
+						if ((bus[indexer].phases & 0x07) == 0x07)		//Full three phase
+						{
+							for (jindex=0; jindex<3; jindex++)	//Add in all three phase values
 							{
-								if ((branch[jindexer].phases & 0x07) == 0x04)	//A
-								{
-									temp_size = 1;		//Single size
-									temp_index = 0;		//No offset (only 1 big)
-								}
-								else
+								//See if this phase is valid
+								phase_workb = 0x04 >> jindex;
+
+								if ((phase_workb & branch[jindexer].phases) == phase_workb)
 								{
-									GL_THROW("NR: One of the lines has invalid phase parameters");
-								}
-								break;
-							}//end 0x04
-						case 0x05:	//AC
+									for (kindex=0; kindex<3; kindex++)
+									{
+										//Check phase
+										phase_workd = 0x04 >> kindex;
+
+										if ((phase_workd & branch[jindexer].phases) == phase_workd)
+										{
+											if (branch[jindexer].from == (int)indexer)	//We're the from version
+											{
+												tempY[jindex][kindex] += branch[jindexer].YSfrom[jindex*3+kindex];
+											}
+											else									//Must be the to version
+											{
+												tempY[jindex][kindex] += branch[jindexer].YSto[jindex*3+kindex];
+											}
+										}//End valid column phase
+									}
+								}//End valid row phase
+							}
+						}
+						else if ((bus[indexer].phases & 0x80) == 0x80)	//Split phase - add in 2x2 element to upper left 2x2
+						{
+							if (branch[jindexer].from == (int)indexer)	//From branch
 							{
-								temp_size = 2;	//Size of this matrix's admittance
-								if ((branch[jindexer].phases & 0x07) == 0x01)	//C
-								{
-									temp_index = 1;		//offset
-								}
-								else if ((branch[jindexer].phases & 0x07) == 0x04)	//A
-								{
-									temp_index = 0;		//offset
-								}
-								else if ((branch[jindexer].phases & 0x07) == 0x05)	//AC
+								//End of SPCT transformer requires slightly different Diagonal components (so when it's the To bus of SPCT and from for other triplex
+								if ((bus[indexer].phases & 0x20) == 0x20)	//Special case
 								{
-									temp_index = 0;
+									//Other triplexes need to be negated to match sign conventions
+									tempY[0][0] -= branch[jindexer].YSfrom[0];
+									tempY[0][1] -= branch[jindexer].YSfrom[1];
+									tempY[1][0] -= branch[jindexer].YSfrom[3];
+									tempY[1][1] -= branch[jindexer].YSfrom[4];
 								}
-								else
+								else										//Just a normal to bus
 								{
-									GL_THROW("NR: One of the lines has invalid phase parameters");
+									tempY[0][0] += branch[jindexer].YSfrom[0];
+									tempY[0][1] += branch[jindexer].YSfrom[1];
+									tempY[1][0] += branch[jindexer].YSfrom[3];
+									tempY[1][1] += branch[jindexer].YSfrom[4];
 								}
-								break;
-							}//end 0x05
-						case 0x06:	//AB
+							}
+							else									//To branch
 							{
-								temp_size = 2;	//Size of this matrix's admittance
-								if ((branch[jindexer].phases & 0x07) == 0x02)	//B
-								{
-									temp_index = 1;		//offset
-								}
-								else if ((branch[jindexer].phases & 0x07) == 0x04)	//A
-								{
-									temp_index = 0;		//offset
-								}
-								else if ((branch[jindexer].phases & 0x07) == 0x06)	//AB
+								//Replicate the above for SPCT test, in case people put lines in backwards
+								//End of SPCT transformer requires slightly different Diagonal components (so when it's the To bus of SPCT and from for other triplex
+								if (((bus[indexer].phases & 0x20) == 0x20) && (branch[jindexer].lnk_type == 1))	//Special case, but make sure we're not the transformer
 								{
-									temp_index = 0;
+									tempY[0][0] -= branch[jindexer].YSto[0];
+									tempY[0][1] -= branch[jindexer].YSto[1];
+									tempY[1][0] -= branch[jindexer].YSto[3];
+									tempY[1][1] -= branch[jindexer].YSto[4];
 								}
-								else
+								else	//Normal bus - no funky SPCT nonsense
 								{
-									GL_THROW("NR: One of the lines has invalid phase parameters");
+									tempY[0][0] += branch[jindexer].YSto[0];
+									tempY[0][1] += branch[jindexer].YSto[1];
+									tempY[1][0] += branch[jindexer].YSto[3];
+									tempY[1][1] += branch[jindexer].YSto[4];
 								}
-								break;
-							}//end 0x06
-						case 0x07:	//ABC
+							}
+						}
+						else	//We must be a single or two-phase line - always populate the upper left portion of matrix (easier for later)
+						{
+							switch(bus[indexer].phases & 0x07) {
+								case 0x00:	//No phases (we've been faulted out
+									{
+										break;	//Just get us outta here
+									}
+								case 0x01:	//Only C
+									{
+										if ((branch[jindexer].phases & 0x01) == 0x01)	//Phase C valid on branch
+										{
+											if (branch[jindexer].from == (int)indexer)	//From branch
+											{
+												tempY[0][0] += branch[jindexer].YSfrom[8];
+											}
+											else									//To branch
+											{
+												tempY[0][0] += branch[jindexer].YSto[8];
+											}
+										}//End valid phase C
+										break;
+									}
+								case 0x02:	//Only B
+									{
+										if ((branch[jindexer].phases & 0x02) == 0x02)	//Phase B valid on branch
+										{
+											if (branch[jindexer].from == (int)indexer)	//From branch
+											{
+												tempY[0][0] += branch[jindexer].YSfrom[4];
+											}
+											else									//To branch
+											{
+												tempY[0][0] += branch[jindexer].YSto[4];
+											}
+										}//End valid phase B
+										break;
+									}
+								case 0x03:	//B & C
+									{
+										phase_worka = (branch[jindexer].phases & 0x03);	//Extract branch phases
+
+										if (phase_worka == 0x03)	//Full B & C
+										{
+											if (branch[jindexer].from == (int)indexer)	//From branch
+											{
+												tempY[0][0] += branch[jindexer].YSfrom[4];
+												tempY[0][1] += branch[jindexer].YSfrom[5];
+												tempY[1][0] += branch[jindexer].YSfrom[7];
+												tempY[1][1] += branch[jindexer].YSfrom[8];
+											}
+											else									//To branch
+											{
+												tempY[0][0] += branch[jindexer].YSto[4];
+												tempY[0][1] += branch[jindexer].YSto[5];
+												tempY[1][0] += branch[jindexer].YSto[7];
+												tempY[1][1] += branch[jindexer].YSto[8];
+											}
+										}//End valid B & C
+										else if (phase_worka == 0x01)	//Only C branch
+										{
+											if (branch[jindexer].from == (int)indexer)	//From branch
+											{
+												tempY[1][1] += branch[jindexer].YSfrom[8];
+											}
+											else									//To branch
+											{
+												tempY[1][1] += branch[jindexer].YSto[8];
+											}
+										}//end valid C
+										else if (phase_worka == 0x02)	//Only B branch
+										{
+											if (branch[jindexer].from == (int)indexer)	//From branch
+											{
+												tempY[0][0] += branch[jindexer].YSfrom[4];
+											}
+											else									//To branch
+											{
+												tempY[0][0] += branch[jindexer].YSto[4];
+											}
+										}//end valid B
+										else	//Must be nothing then - all phases must be faulted, or something
+											;
+										break;
+									}
+								case 0x04:	//Only A
+									{
+										if ((branch[jindexer].phases & 0x04) == 0x04)	//Phase A is valid
+										{
+											if (branch[jindexer].from == (int)indexer)	//From branch
+											{
+												tempY[0][0] += branch[jindexer].YSfrom[0];
+											}
+											else									//To branch
+											{
+												tempY[0][0] += branch[jindexer].YSto[0];
+											}
+										}//end valid phase A
+										break;
+									}
+								case 0x05:	//A & C
+									{
+										phase_worka = branch[jindexer].phases & 0x05;	//Extract phases
+
+										if (phase_worka == 0x05)	//Both A & C valid
+										{
+											if (branch[jindexer].from == (int)indexer)	//From branch
+											{
+												tempY[0][0] += branch[jindexer].YSfrom[0];
+												tempY[0][1] += branch[jindexer].YSfrom[2];
+												tempY[1][0] += branch[jindexer].YSfrom[6];
+												tempY[1][1] += branch[jindexer].YSfrom[8];
+											}
+											else									//To branch
+											{
+												tempY[0][0] += branch[jindexer].YSto[0];
+												tempY[0][1] += branch[jindexer].YSto[2];
+												tempY[1][0] += branch[jindexer].YSto[6];
+												tempY[1][1] += branch[jindexer].YSto[8];
+											}
+										}//End A & C valid
+										else if (phase_worka == 0x04)	//Only A valid
+										{
+											if (branch[jindexer].from == (int)indexer)	//From branch
+											{
+												tempY[0][0] += branch[jindexer].YSfrom[0];
+											}
+											else									//To branch
+											{
+												tempY[0][0] += branch[jindexer].YSto[0];
+											}
+										}//end only A valid
+										else if (phase_worka == 0x01)	//Only C valid
+										{
+											if (branch[jindexer].from == (int)indexer)	//From branch
+											{
+												tempY[1][1] += branch[jindexer].YSfrom[8];
+											}
+											else									//To branch
+											{
+												tempY[1][1] += branch[jindexer].YSto[8];
+											}
+										}//end only C valid
+										else	//No connection - must be faulted
+											;
+										break;
+									}
+								case 0x06:	//A & B
+									{
+										phase_worka = branch[jindexer].phases & 0x06;	//Extract phases
+
+										if (phase_worka == 0x06)	//Valid A & B phase
+										{
+											if (branch[jindexer].from == (int)indexer)	//From branch
+											{
+												tempY[0][0] += branch[jindexer].YSfrom[0];
+												tempY[0][1] += branch[jindexer].YSfrom[1];
+												tempY[1][0] += branch[jindexer].YSfrom[3];
+												tempY[1][1] += branch[jindexer].YSfrom[4];
+											}
+											else									//To branch
+											{
+												tempY[0][0] += branch[jindexer].YSto[0];
+												tempY[0][1] += branch[jindexer].YSto[1];
+												tempY[1][0] += branch[jindexer].YSto[3];
+												tempY[1][1] += branch[jindexer].YSto[4];
+											}
+										}//End valid A & B
+										else if (phase_worka == 0x04)	//Only valid A
+										{
+											if (branch[jindexer].from == (int)indexer)	//From branch
+											{
+												tempY[0][0] += branch[jindexer].YSfrom[0];
+											}
+											else									//To branch
+											{
+												tempY[0][0] += branch[jindexer].YSto[0];
+											}
+										}//end valid A
+										else if (phase_worka == 0x02)	//Only valid B
+										{
+											if (branch[jindexer].from == (int)indexer)	//From branch
+											{
+												tempY[1][1] += branch[jindexer].YSfrom[4];
+											}
+											else									//To branch
+											{
+												tempY[1][1] += branch[jindexer].YSto[4];
+											}
+										}//end valid B
+										else	//Default - must be already handled
+											;
+										break;
+									}
+								default:	//How'd we get here?
+									{
+										GL_THROW("Unknown phase connection in NR self admittance diagonal");
+										/*  TROUBLESHOOT
+										An unknown phase condition was encountered in the NR solver when constructing
+										the self admittance diagonal.  Please report this bug and submit your code to 
+										the trac system.
+										*/
+									break;
+									}
+							}	//switch end
+						}	//1 or 2 phase end
+					}	//phase accumulation end
+					else		//It's nothing (no connnection)
+						;
+				}//branch traversion end
+
+				//Store the self admittance into BA_diag.  Also update the indices for possible use later
+				//Only do this if we're actually populated
+				island_index_val = bus[indexer].island_number;
+
+				if ((island_index_val != -1) && (admit_localized == false))
+				{
+					powerflow_values->BA_diag[indexer].col_ind = powerflow_values->BA_diag[indexer].row_ind = powerflow_values->island_matrix_values[island_index_val].index_count;	// Store the row and column starting information (square matrices)
+					bus[indexer].Matrix_Loc = powerflow_values->island_matrix_values[island_index_val].index_count;								//Store our location so we know where we go
+					powerflow_values->island_matrix_values[island_index_val].index_count += powerflow_values->BA_diag[indexer].size;				// Update the index for this matrix's size, so next one is in appropriate place
+				}
+
+				//Store the admittance values into the BA_diag matrix structure
+				for ( jindex = 0 ; jindex < powerflow_values->BA_diag[indexer].size ; jindex++ )
+				{
+					for ( kindex = 0; kindex < powerflow_values->BA_diag[indexer].size ; kindex++ )			//Store values - assume square matrix - don't bother parsing what doesn't exist.
+					{
+						powerflow_values->BA_diag[indexer].Y[jindex][kindex] = tempY[jindex][kindex];// Store the self admittance terms.
+					}
+				}
+
+				//Copy values into node-specific link (if needed)
+				if (bus[indexer].full_Y_all != NULL)
+				{
+					for ( jindex = 0 ; jindex < powerflow_values->BA_diag[indexer].size ; jindex++ )
+					{
+						for ( kindex = 0 ; kindex < powerflow_values->BA_diag[indexer].size ; kindex++ )			//Store values - assume square matrix - don't bother parsing what doesn't exist.
+						{
+							bus[indexer].full_Y_all[jindex*3+kindex] = tempY[jindex][kindex];// Store the self admittance terms.
+						}
+					}
+				}//End self-admittance update
+
+				//If the fixed diagonal pattern moved, Y_diag_fixed needs to be rebuilt
+				if ((admit_localized == true) && (bus_diag_fixed_pattern(&(powerflow_values->BA_diag[indexer])) != diag_pattern_prev))
+				{
+					diag_pattern_changed = true;
+				}
+			}//End diagonal construction
+
+			//Size and allocate the off-diagonal portion - localized updates reuse the existing entries
+			if (admit_localized == false)
+			{
+				//Loop through the islands and set the initial items
+				for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
+				{
+					//Store the size of the diagonal, since it represents how many variables we are solving (useful later)
+					powerflow_values->island_matrix_values[island_loop_index].total_variables = powerflow_values->island_matrix_values[island_loop_index].index_count;
+
+					//Check to see if we've exceeded our max.  If so, reallocate!
+					if (powerflow_values->island_matrix_values[island_loop_index].total_variables > powerflow_values->island_matrix_values[island_loop_index].max_total_variables)
+						powerflow_values->island_matrix_values[island_loop_index].NR_realloc_needed = true;
+
+					/// Build the off_diagonal_PQ bus elements of 6n*6n Y_NR matrix.Equation (12). All the value in this part will not be updated at each iteration.
+					//Constructed using sparse methodology, non-zero elements are the only thing considered (and non-PV)
+					//No longer necessarily 6n*6n any more either,
+					powerflow_values->island_matrix_values[island_loop_index].size_offdiag_PQ = 0;
+				}//End loop traversion
+
+				for (jindexer=0; jindexer<branch_count;jindexer++)	//Parse all of the branches
+				{
+					tempa  = branch[jindexer].from;
+					tempb  = branch[jindexer].to;
+
+					//Pull the island index off the from bus -- for islands, both ends SHOULD be in the same index
+					island_index_val = bus[tempa].island_number;
+
+					//Check and see if we should just skip this branch -- if it's an unassociated node, probably don't need this branch
+					//Explicitly check both ends
+					if ((bus[tempa].island_number == -1) || (bus[tempb].island_number == -1))
+					{
+						//Random error check - see if the branch somehow is oddly associated
+						if (branch[jindexer].island_number != -1)
+						{
+							GL_THROW("NR line:%d - %s has an island association, but the ends do not",branch[jindexer].obj->id,(branch[jindexer].name ? branch[jindexer].name : "Unnamed"));
+							/*  TROUBLESHOOT
+							When parsing the line list, a line connected to an isolated node is still somehow associated with a proper island.
+							This should not occur.  Please submit your GLM file and a description to the 
+							issue tracker.
+							*/
+						}
+						//Default else - unassociated, so just let it go
+
+						//Basically not part of any system, just skip it
+						continue;
+					}
+					else	//from/to are valid
+					{
+						//Paranoia check - make sure this line isn't somehow unassociated - ignore switching-type lines, since they are skipped when open
+						if ((branch[jindexer].island_number == -1) && (branch[jindexer].lnk_type < 3))
+						{
+							GL_THROW("NR line:%d - %s does not have a proper island association",branch[jindexer].obj->id,(branch[jindexer].name ? branch[jindexer].name : "Unnamed"));
+							/*  TROUBLESHOOT
+							When parsing the line list, a line connected to two valid nodes is still somehow unassociated.
+							This should not occur.  Please submit your GLM file and a description to the 
+							issue tracker.
+							*/
+						}
+					}
+
+					//Preliminary check to make sure we weren't missed in the initialization
+					if (((int)bus[tempa].Matrix_Loc == -1) || ((int)bus[tempb].Matrix_Loc == -1))
+					{
+						GL_THROW("An element in NR line:%d - %s was not properly localized",branch[jindexer].obj->id,(branch[jindexer].name ? branch[jindexer].name : "Unnamed"));
+						/*  TROUBLESHOOT
+						When parsing the bus list, the Newton-Raphson solver found a bus that did not
+						appear to have a location within the overall admittance/Jacobian matrix.  Please
+						submit this as a bug with your code on the Trac site.
+						*/
+					}
+
+					if (((branch[jindexer].phases & 0x80) == 0x80) && (branch[jindexer].v_ratio==1.0))	//Triplex, but not SPCT
+					{
+						for (jindex=0; jindex<2; jindex++)			//rows
+						{
+							for (kindex=0; kindex<2; kindex++)		//columns
+							{
+								if (((branch[jindexer].Yfrom[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))
+									powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
+
+								if (((branch[jindexer].Yto[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))  
+									powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
+
+								if (((branch[jindexer].Yfrom[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1)) 
+									powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
+
+								if (((branch[jindexer].Yto[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1)) 
+									powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
+							}//end columns of split phase
+						}//end rows of split phase
+					}//end traversion of split-phase
+					else											//Three phase or some variety
+					{
+						//Make sure we aren't SPCT, otherwise things get jacked
+						if ((branch[jindexer].phases & 0x80) != 0x80)	//SPCT, but v_ratio not = 1
+						{
+							for (jindex=0; jindex<3; jindex++)			//rows
+							{
+								//See if this phase is valid
+								phase_workb = 0x04 >> jindex;
+
+								if ((phase_workb & branch[jindexer].phases) == phase_workb)	//Row check
+								{
+									for (kindex=0; kindex<3; kindex++)		//columns
+									{
+										//Check this phase as well
+										phase_workd = 0x04 >> kindex;
+
+										if ((phase_workd & branch[jindexer].phases) == phase_workd)	//Column validity check
+										{
+											if (((branch[jindexer].Yfrom[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))
+												powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
+
+											if (((branch[jindexer].Yto[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))  
+												powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
+
+											if (((branch[jindexer].Yfrom[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1)) 
+												powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
+
+											if (((branch[jindexer].Yto[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1)) 
+												powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
+										}//end column validity check
+									}//end columns of 3 phase
+								}//End row validity check
+							}//end rows of 3 phase
+						}//end not SPCT
+						else	//SPCT implementation
+						{
+							for (jindex=0; jindex<3; jindex++)			//rows
+							{
+								//See if this phase is valid
+								phase_workb = 0x04 >> jindex;
+
+								if ((phase_workb & branch[jindexer].phases) == phase_workb)	//Row check
+								{
+									for (kindex=0; kindex<3; kindex++)		//Row valid, traverse all columns for SPCT Yfrom
+									{
+										if (((branch[jindexer].Yfrom[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))
+											powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
+
+										if (((branch[jindexer].Yfrom[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1)) 
+											powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
+									}//end columns traverse
+
+									//If row is valid, now traverse the rows of that column for Yto
+									for (kindex=0; kindex<3; kindex++)
+									{
+										if (((branch[jindexer].Yto[kindex*3+jindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))  
+											powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
+
+										if (((branch[jindexer].Yto[kindex*3+jindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1)) 
+											powerflow_values->island_matrix_values[island_index_val].size_offdiag_PQ += 1; 
+									}//end rows traverse
+								}//End row validity check
+							}//end rows of 3 phase
+						}//End SPCT
+					}//end three phase
+				}//end line traversion
+
+				//Loop through the islands again
+				for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
+				{
+					//Allocate the space - double the number found (each element goes in two places)
+					if (powerflow_values->island_matrix_values[island_loop_index].Y_offdiag_PQ == NULL)
+					{
+						powerflow_values->island_matrix_values[island_loop_index].Y_offdiag_PQ = (Y_NR *)gl_malloc((powerflow_values->island_matrix_values[island_loop_index].size_offdiag_PQ*2) *sizeof(Y_NR));   //powerflow_values->island_matrix_values[x].Y_offdiag_PQ store the row,column and value of off_diagonal elements of Bus Admittance matrix in which all the buses are not PV buses. 
+
+						//Make sure it worked
+						if (powerflow_values->island_matrix_values[island_loop_index].Y_offdiag_PQ == NULL)
+							GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
+
+						//Save our size
+						powerflow_values->island_matrix_values[island_loop_index].max_size_offdiag_PQ = powerflow_values->island_matrix_values[island_loop_index].size_offdiag_PQ;	//Don't care about the 2x, since we'll be comparing it against itself
+					}
+					else if (powerflow_values->island_matrix_values[island_loop_index].size_offdiag_PQ > powerflow_values->island_matrix_values[island_loop_index].max_size_offdiag_PQ)	//Something changed and we are bigger!!
+					{
+						//Destroy us!
+						gl_free(powerflow_values->island_matrix_values[island_loop_index].Y_offdiag_PQ);
+
+						//Rebuild us, we have the technology
+						powerflow_values->island_matrix_values[island_loop_index].Y_offdiag_PQ = (Y_NR *)gl_malloc((powerflow_values->island_matrix_values[island_loop_index].size_offdiag_PQ*2) *sizeof(Y_NR));
+
+						//Make sure it worked
+						if (powerflow_values->island_matrix_values[island_loop_index].Y_offdiag_PQ == NULL)
+							GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
+
+						//Store the new size
+						powerflow_values->island_matrix_values[island_loop_index].max_size_offdiag_PQ = powerflow_values->island_matrix_values[island_loop_index].size_offdiag_PQ;
+
+						//Flag for a reallocation
+						powerflow_values->island_matrix_values[island_loop_index].NR_realloc_needed = true;
+					}
+
+					//Zero the indexer term used in the next section
+					powerflow_values->island_matrix_values[island_loop_index].indexer = 0;
+				}//End island loop
+			}//End off-diagonal sizing
+
+			for (jindexer=0; jindexer<branch_count;jindexer++)	//Parse through all of the branches
+			{
+				//Extract both ends
+				tempa  = branch[jindexer].from;
+				tempb  = branch[jindexer].to;
+
+				//Pull the island index off the from bus -- for islands, both ends SHOULD be in the same index
+				island_index_val = bus[tempa].island_number;
+
+				//Make sure it isn't invalid -- if it is, just skip this, since that means these lines do nothing anyways
+				//Explicit check on "oddities" for island association was earlier
+				if (branch[jindexer].island_number == -1)
+				{
+					continue;
+				}
+
+				if (admit_localized == true)
+				{
+					//Only changed branches - written back over their previous entries (same pattern, so same count)
+					if (branch[jindexer].admit_change == false)
+					{
+						continue;
+					}
+
+					powerflow_values->island_matrix_values[island_index_val].indexer = branch[jindexer].offdiag_loc;
+				}
+				else	//Full build - store where this branch's entries start, for later localized updates
+				{
+					branch[jindexer].offdiag_loc = powerflow_values->island_matrix_values[island_index_val].indexer;
+					branch[jindexer].offdiag_pattern = branch_offdiag_pattern(&branch[jindexer]);
+				}
+
+				//Deflag any localized change - handled now
+				branch[jindexer].admit_change = false;
+
+				phase_worka = 0;
+				phase_workb = 0;
+				for (jindex=0; jindex<3; jindex++)		//Accumulate number of phases
+				{
+					phase_worka += ((bus[tempa].phases & (0x01 << jindex)) >> jindex);
+					phase_workb += ((bus[tempb].phases & (0x01 << jindex)) >> jindex);
+				}
+
+				if ((phase_worka==3) && (phase_workb==3))	//Both ends are full three phase, normal operations
+				{
+					for (jindex=0; jindex<3; jindex++)		//Loop through rows of admittance matrices				
+					{
+						//See if this row is valid for this branch
+						phase_workd = 0x04 >> jindex;
+
+						if ((branch[jindexer].phases & phase_workd) == phase_workd)	//Validity check
+						{
+							for (kindex=0; kindex<3; kindex++)	//Loop through columns of admittance matrices
+							{
+								//Extract column information
+								phase_worke = 0x04 >> kindex;
+
+								if ((branch[jindexer].phases & phase_worke) == phase_worke)	//Valid column too!
+								{
+									//Indices counted out from Self admittance above.  needs doubling due to complex separation
+									if (((branch[jindexer].Yfrom[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From imags
+									{
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Im());
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex + 3;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 3;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (branch[jindexer].Yfrom[jindex*3+kindex]).Im();
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+									}
+
+									if (((branch[jindexer].Yto[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To imags
+									{
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[jindex*3+kindex]).Im());
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex + 3;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex + 3;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (branch[jindexer].Yto[jindex*3+kindex]).Im();
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+									}
+
+									if (((branch[jindexer].Yfrom[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From reals
+									{
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex + 3;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 3;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
+									}
+
+									if (((branch[jindexer].Yto[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To reals
+									{
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex + 3;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[jindex*3+kindex]).Re());
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex + 3;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[jindex*3+kindex]).Re());
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
+									}
+								}//End valid column
+							}//column end
+						}//End valid row
+					}//row end
+				}//if all 3 end
+				else if (((bus[tempa].phases & 0x80) == 0x80) || ((bus[tempb].phases & 0x80) == 0x80))	//Someone's a triplex
+				{
+					if (((bus[tempa].phases & 0x80) == 0x80) && ((bus[tempb].phases & 0x80) == 0x80))	//Both are triplex, easy case
+					{
+						for (jindex=0; jindex<2; jindex++)		//Loop through rows of admittance matrices (only 2x2)
+						{
+							for (kindex=0; kindex<2; kindex++)	//Loop through columns of admittance matrices (only 2x2)
+							{
+								//Make sure one end of us isn't a SPCT transformer To node (they are different)
+								if (((bus[tempa].phases & 0x20) & (bus[tempb].phases & 0x20)) == 0x20)	//Both ends are SPCT tos
+								{
+									GL_THROW("NR: SPCT to SPCT via triplex connections are unsupported at this time.");
+									/*  TROUBLESHOOT
+									The Newton-Raphson solve does not currently support running a triplex line between the low-voltage
+									side of two different split-phase center tapped transformers.  This functionality may be added if needed
+									in the future.
+									*/
+								}//end both ends SPCT to
+								else if ((bus[tempa].phases & 0x20) == 0x20)	//From end is a SPCT to
+								{
+									//Indices counted out from Self admittance above.  needs doubling due to complex separation
+
+									if (((branch[jindexer].Yfrom[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From imags
+									{
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = ((branch[jindexer].Yfrom[jindex*3+kindex]).Im());
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+										
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex + 2;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(branch[jindexer].Yfrom[jindex*3+kindex]).Im();
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+									}
+
+									if (((branch[jindexer].Yto[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To imags
+									{
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[jindex*3+kindex]).Im());
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+										
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex + 2;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex + 2;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (branch[jindexer].Yto[jindex*3+kindex]).Im();
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+									}
+
+									if (((branch[jindexer].Yfrom[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From reals
+									{
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex + 2;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = ((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+										
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = ((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
+									}
+
+									if (((branch[jindexer].Yto[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1 && bus[tempb].type != 1))	//To reals
+									{
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex + 2;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[jindex*3+kindex]).Re());
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+										
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex + 2;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[jindex*3+kindex]).Re());
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
+									}
+								}//end From end SPCT to
+								else if ((bus[tempb].phases & 0x20) == 0x20)	//To end is a SPCT to
+								{
+									//Indices counted out from Self admittance above.  needs doubling due to complex separation
+
+									//Make sure we aren't the transformer
+									if (branch[jindexer].lnk_type == 1)	//We're not, we're a line - proceed
+									{
+
+										//Indices counted out from Self admittance above.  needs doubling due to complex separation
+										if (((branch[jindexer].Yfrom[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From imags
+										{
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Im());
+											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex + 2;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (branch[jindexer].Yfrom[jindex*3+kindex]).Im();
+											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+										}
+
+										if (((branch[jindexer].Yto[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To imags
+										{
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = ((branch[jindexer].Yto[jindex*3+kindex]).Im());
+											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex + 2;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex + 2;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(branch[jindexer].Yto[jindex*3+kindex]).Im();
+											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+										}
+
+										if (((branch[jindexer].Yfrom[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From reals
+										{
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex + 2;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
+											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
+											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+										}
+
+										if (((branch[jindexer].Yto[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1 && bus[tempb].type != 1))	//To reals
+										{
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex + 2;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = ((branch[jindexer].Yto[jindex*3+kindex]).Re());
+											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex + 2;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = ((branch[jindexer].Yto[jindex*3+kindex]).Re());
+											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+										}
+									}//End SPCT TO bus and we're a line
+									else	//Transformer to - don't do things weird
+									{
+										if (((branch[jindexer].Yfrom[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From imags
+										{
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Im());
+											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex + 2;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (branch[jindexer].Yfrom[jindex*3+kindex]).Im();
+											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+										}
+
+										if (((branch[jindexer].Yto[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To imags
+										{
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = ((branch[jindexer].Yto[jindex*3+kindex]).Im());
+											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex + 2;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex + 2;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(branch[jindexer].Yto[jindex*3+kindex]).Im();
+											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+										}
+
+										if (((branch[jindexer].Yfrom[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From reals
+										{
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex + 2;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
+											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
+											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+										}
+
+										if (((branch[jindexer].Yto[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1 && bus[tempb].type != 1))	//To reals
+										{
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex + 2;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = ((branch[jindexer].Yto[jindex*3+kindex]).Re());
+											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex + 2;
+											powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = ((branch[jindexer].Yto[jindex*3+kindex]).Re());
+											powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+										}
+									}//End SPCT TO and we're the transformer
+								}//end To end SPCT to
+								else											//Plain old ugly line
+								{
+									//Indices counted out from Self admittance above.  needs doubling due to complex separation
+
+									if (((branch[jindexer].Yfrom[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From imags
+									{
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Im());
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+										
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex + 2;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (branch[jindexer].Yfrom[jindex*3+kindex]).Im();
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+									}
+
+									if (((branch[jindexer].Yto[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To imags
+									{
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[jindex*3+kindex]).Im());
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+										
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex + 2;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex + 2;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (branch[jindexer].Yto[jindex*3+kindex]).Im();
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+									}
+
+									if (((branch[jindexer].Yfrom[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From reals
+									{
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex + 2;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+										
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + jindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
+									}
+
+									if (((branch[jindexer].Yto[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1 && bus[tempb].type != 1))	//To reals
+									{
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex + 2;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[jindex*3+kindex]).Re());
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+										
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + jindex;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + kindex + 2;
+										powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[jindex*3+kindex]).Re());
+										powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
+									}
+								}//end Normal triplex branch
+							}//column end
+						}//row end
+					}//end both triplexy
+					else if ((bus[tempa].phases & 0x80) == 0x80)	//From is the triplex - this implies transformer with or something, we don't support this
+					{
+						GL_THROW("NR does not support triplex to 3-phase connections.");
+						/*  TROUBLESHOOT
+						The Newton-Raphson solver does not have any implementation elements
+						to support the connection of a split-phase or triplex node to a three-phase
+						node.  The opposite (3-phase to triplex) is available as the split-phase-center-
+						tapped transformer model.  See if that will work for your implementation.
+						*/
+					}//end from triplexy
+					else	//Only option left is the to must be the triplex - implies SPCT xformer - so only one phase on the three-phase side (we just need to figure out where)
+					{
+						//Extract the line phase
+						phase_workc = (branch[jindexer].phases & 0x07);
+
+						//Reset temp_index and size, just in case
+						temp_index = -1;
+						temp_size = -1;
+
+						//Figure out what the offset on the from side is (how many phases and which one we are)
+						switch(bus[tempa].phases & 0x07)
+						{
+							case 0x01:	//C
+								{
+									temp_size = 1;	//Single phase matrix
+
+									if (phase_workc==0x01)	//Line is phase C
+									{
+										//Only C in the node, so no offset
+										temp_index = 0;
+									}
+									else if (phase_workc==0x02)	//Line is phase B
+									{
+										GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
+										/*  TROUBLESHOOT
+										A split-phase, center-tapped transformer in the Newton-Raphson solver is somehow attached
+										to a node that is missing the required phase of the transformer.  This should have been caught.
+										Please submit your code and a bug report using the trac website.
+										*/
+									}
+									else					//Has to be phase A
+										GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
+
+									break;
+								}
+							case 0x02:	//B
+								{
+									temp_size = 1;	//Single phase matrix
+
+									if (phase_workc==0x01)	//Line is phase C
+										GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
+									else if (phase_workc==0x02)	//Line is phase B
+									{
+										//Only B in the node, so no offset
+										temp_index = 0;
+									}
+									else					//Has to be phase A
+										GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
+
+									break;
+								}
+							case 0x03:	//BC
+								{
+									temp_size = 2;	//Two phase matrix
+
+									if (phase_workc==0x01)	//Line is phase C
+									{
+										//BC in the node, so offset by 1
+										temp_index = 1;
+									}
+									else if (phase_workc==0x02)	//Line is phase B
+									{
+										//BC in the node, so offset by 0
+										temp_index = 0;
+									}
+									else					//Has to be phase A
+										GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
+
+									break;
+								}
+							case 0x04:	//A
+								{
+									temp_size = 1;	//Single phase matrix
+
+									if (phase_workc==0x01)	//Line is phase C
+										GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
+									else if (phase_workc==0x02)	//Line is phase B
+										GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
+									else					//Has to be phase A
+									{
+										//Only A in the node, so no offset
+										temp_index = 0;
+									}
+
+									break;
+								}
+							case 0x05:	//AC
+								{
+									temp_size = 2;	//Two phase matrix
+
+									if (phase_workc==0x01)	//Line is phase C
+									{
+										//AC in the node, so offset by 1
+										temp_index = 1;
+									}
+									else if (phase_workc==0x02)	//Line is phase B
+										GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
+									else					//Has to be phase A
+									{
+										//AC in the node, so offset by 0
+										temp_index = 0;
+									}
+
+									break;
+								}
+							case 0x06:	//AB
+								{
+									temp_size = 2;	//Two phase matrix
+
+									if (phase_workc==0x01)	//Line is phase C
+										GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
+									else if (phase_workc==0x02)	//Line is phase B
+									{
+										//BC in the node, so offset by 1
+										temp_index = 1;
+									}
+									else					//Has to be phase A
+									{
+										//AB in the node, so offset by 0
+										temp_index = 0;
+									}
+
+									break;
+								}
+							case 0x07:	//ABC
+								{
+									temp_size = 3;	//Three phase matrix
+
+									if (phase_workc==0x01)	//Line is phase C
+									{
+										//ABC in the node, so offset by 2
+										temp_index = 2;
+									}
+									else if (phase_workc==0x02)	//Line is phase B
+									{
+										//ABC in the node, so offset by 1
+										temp_index = 1;
+									}
+									else					//Has to be phase A
+									{
+										//ABC in the node, so offset by 0
+										temp_index = 0;
+									}
+
+									break;
+								}
+							default:
+								GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
+								break;
+						}//end switch
+						if (((int)temp_index==-1) || ((int)temp_size==-1))	//Should never get here
+							GL_THROW("NR: A center-tapped transformer has an invalid phase matching");
+
+						//Determine first index
+						if (phase_workc==0x01)	//Line is phase C
+						{
+							jindex=2;
+						}//end line C if
+						else if (phase_workc==0x02)	//Line is phase B
+						{
+							jindex=1;
+						}//end line B if
+						else						//Line has to be phase A
+						{
+							jindex=0;
+						}//End line A if
+
+
+						//Indices counted out from Self admittance above.  needs doubling due to complex separation
+						for (kindex=0; kindex<2; kindex++)	//Loop through columns of admittance matrices (only 2x2)
+						{
+
+							if (((branch[jindexer].Yfrom[jindex*3+kindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From imags
+							{
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index;
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Im());
+								powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+								
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + temp_size;
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (branch[jindexer].Yfrom[jindex*3+kindex]).Im();
+								powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+							}
+
+							if (((branch[jindexer].Yto[kindex*3+jindex]).Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To imags
+							{
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + kindex;
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index;
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[kindex*3+jindex]).Im());
+								powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+								
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + temp_size;
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (branch[jindexer].Yto[kindex*3+jindex]).Im();
+								powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+							}
+
+							if (((branch[jindexer].Yfrom[jindex*3+kindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From reals
+							{
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + temp_size;
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex;
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
+								powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+								
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index;
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yfrom[jindex*3+kindex]).Re());
+								powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
+							}
+
+							if (((branch[jindexer].Yto[kindex*3+jindex]).Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To reals
+							{
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + kindex + 2;
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index;
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[kindex*3+jindex]).Re());
+								powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+								
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + kindex;
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + temp_size;
+								powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -((branch[jindexer].Yto[kindex*3+jindex]).Re());
+								powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
+							}
+						}//secondary index end
+
+					}//end to triplexy
+				}//end triplex in here
+				else					//Some combination of not-3 phase
+				{
+					//Clear working variables, just in case
+					temp_index = temp_index_b = -1;
+					temp_size = temp_size_b = temp_size_c = -1;
+					Full_Mat_A = Full_Mat_B = false;
+
+					//Intermediate store the admittance matrices so they can be directly indexed later
+					switch(branch[jindexer].phases & 0x07) {
+						case 0x00:	//No phases (open switch or reliability excluded item)
+							{
+								temp_size_c = -99;	//Arbitrary flag
+								break;
+							}
+						case 0x01:	//C only
+							{
+								Temp_Ad_A[0][0] = branch[jindexer].Yfrom[8];
+								Temp_Ad_B[0][0] = branch[jindexer].Yto[8];
+								temp_size_c = 1;
+								break;
+							}
+						case 0x02:	//B only
+							{
+								Temp_Ad_A[0][0] = branch[jindexer].Yfrom[4];
+								Temp_Ad_B[0][0] = branch[jindexer].Yto[4];
+								temp_size_c = 1;
+								break;
+							}
+						case 0x03:	//BC only
+							{
+								Temp_Ad_A[0][0] = branch[jindexer].Yfrom[4];
+								Temp_Ad_A[0][1] = branch[jindexer].Yfrom[5];
+								Temp_Ad_A[1][0] = branch[jindexer].Yfrom[7];
+								Temp_Ad_A[1][1] = branch[jindexer].Yfrom[8];
+								
+								Temp_Ad_B[0][0] = branch[jindexer].Yto[4];
+								Temp_Ad_B[0][1] = branch[jindexer].Yto[5];
+								Temp_Ad_B[1][0] = branch[jindexer].Yto[7];
+								Temp_Ad_B[1][1] = branch[jindexer].Yto[8];
+
+								temp_size_c = 2;
+								break;
+							}
+						case 0x04:	//A only
+							{
+								Temp_Ad_A[0][0] = branch[jindexer].Yfrom[0];
+								Temp_Ad_B[0][0] = branch[jindexer].Yto[0];
+								temp_size_c = 1;
+								break;
+							}
+						case 0x05:	//AC only
+							{
+								Temp_Ad_A[0][0] = branch[jindexer].Yfrom[0];
+								Temp_Ad_A[0][1] = branch[jindexer].Yfrom[2];
+								Temp_Ad_A[1][0] = branch[jindexer].Yfrom[6];
+								Temp_Ad_A[1][1] = branch[jindexer].Yfrom[8];
+								
+								Temp_Ad_B[0][0] = branch[jindexer].Yto[0];
+								Temp_Ad_B[0][1] = branch[jindexer].Yto[2];
+								Temp_Ad_B[1][0] = branch[jindexer].Yto[6];
+								Temp_Ad_B[1][1] = branch[jindexer].Yto[8];
+
+								temp_size_c = 2;
+								break;
+							}
+						case 0x06:	//AB only
+							{
+								Temp_Ad_A[0][0] = branch[jindexer].Yfrom[0];
+								Temp_Ad_A[0][1] = branch[jindexer].Yfrom[1];
+								Temp_Ad_A[1][0] = branch[jindexer].Yfrom[3];
+								Temp_Ad_A[1][1] = branch[jindexer].Yfrom[4];
+								
+								Temp_Ad_B[0][0] = branch[jindexer].Yto[0];
+								Temp_Ad_B[0][1] = branch[jindexer].Yto[1];
+								Temp_Ad_B[1][0] = branch[jindexer].Yto[3];
+								Temp_Ad_B[1][1] = branch[jindexer].Yto[4];
+
+								temp_size_c = 2;
+								break;
+							}
+						default:
+							{
+								break;
+							}
+					}//end line switch/case
+
+					if ( temp_size_c == -99 )
+					{
+						continue;	//Next iteration of branch loop
+					}
+
+					if ( temp_size_c == -1 )	//Make sure it is right
+					{
+						GL_THROW("NR: A line's phase was flagged as not full three-phase, but wasn't: (%s) %u %u %u %u", 
+										 branch[jindexer].name, branch[jindexer].phases, branch[jindexer].origphases, phase_worka, phase_workb);
+						/*  TROUBLESHOOT
+						A line inside the powerflow model was flagged as not being full three-phase or
+						triplex in any form.  It failed the other cases though, so it must have been.
+						Please submit your code and a bug report to the trac website.
+						*/
+					}
+
+					//Check the from side and get all appropriate offsets
+					switch(bus[tempa].phases & 0x07) {
+						case 0x01:	//C
+							{
+								if ((branch[jindexer].phases & 0x07) == 0x01)	//C
+								{
+									temp_size = 1;		//Single size
+									temp_index = 0;		//No offset (only 1 big)
+								}
+								else
+								{
+									GL_THROW("NR: One of the lines has invalid phase parameters");
+									/*  TROUBLESHOOT
+									One of the lines in the powerflow model has an invalid phase in
+									reference to its to and from ends.  This should have been caught
+									earlier, so submit your code and a bug report using the trac website.
+									*/
+								}
+								break;
+							}//end 0x01
+						case 0x02:	//B
+							{
+								if ((branch[jindexer].phases & 0x07) == 0x02)	//B
+								{
+									temp_size = 1;		//Single size
+									temp_index = 0;		//No offset (only 1 big)
+								}
+								else
+								{
+									GL_THROW("NR: One of the lines has invalid phase parameters");
+								}
+								break;
+							}//end 0x02
+						case 0x03:	//BC
+							{
+								temp_size = 2;	//Size of this matrix's admittance
+								if ((branch[jindexer].phases & 0x07) == 0x01)	//C
+								{
+									temp_index = 1;		//offset
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x02)	//B
+								{
+									temp_index = 0;		//offset
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x03)	//BC
+								{
+									temp_index = 0;
+								}
+								else
+								{
+									GL_THROW("NR: One of the lines has invalid phase parameters");
+								}
+								break;
+							}//end 0x03
+						case 0x04:	//A
+							{
+								if ((branch[jindexer].phases & 0x07) == 0x04)	//A
+								{
+									temp_size = 1;		//Single size
+									temp_index = 0;		//No offset (only 1 big)
+								}
+								else
+								{
+									GL_THROW("NR: One of the lines has invalid phase parameters");
+								}
+								break;
+							}//end 0x04
+						case 0x05:	//AC
+							{
+								temp_size = 2;	//Size of this matrix's admittance
+								if ((branch[jindexer].phases & 0x07) == 0x01)	//C
+								{
+									temp_index = 1;		//offset
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x04)	//A
+								{
+									temp_index = 0;		//offset
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x05)	//AC
+								{
+									temp_index = 0;
+								}
+								else
+								{
+									GL_THROW("NR: One of the lines has invalid phase parameters");
+								}
+								break;
+							}//end 0x05
+						case 0x06:	//AB
+							{
+								temp_size = 2;	//Size of this matrix's admittance
+								if ((branch[jindexer].phases & 0x07) == 0x02)	//B
+								{
+									temp_index = 1;		//offset
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x04)	//A
+								{
+									temp_index = 0;		//offset
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x06)	//AB
+								{
+									temp_index = 0;
+								}
+								else
+								{
+									GL_THROW("NR: One of the lines has invalid phase parameters");
+								}
+								break;
+							}//end 0x06
+						case 0x07:	//ABC
+							{
+								temp_size = 3;	//Size of this matrix's admittance
+								if ((branch[jindexer].phases & 0x07) == 0x01)	//C
+								{
+									temp_index = 2;		//offset
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x02)	//B
+								{
+									temp_index = 1;		//offset
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x03)	//BC
+								{
+									temp_index = 1;
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x04)	//A
+								{
+									temp_index = 0;		//offset
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x05)	//AC
+								{
+									temp_index = 0;
+									Full_Mat_A = true;		//Flag so we know C needs to be gapped
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x06)	//AB
+								{
+									temp_index = 0;
+								}
+								else
+								{
+									GL_THROW("NR: One of the lines has invalid phase parameters");
+								}
+								break;
+							}//end 0x07
+						default:
+							{
+								break;
+							}
+					}//End switch/case for from
+
+					//Check the to side and get all appropriate offsets
+					switch(bus[tempb].phases & 0x07) {
+						case 0x01:	//C
+							{
+								if ((branch[jindexer].phases & 0x07) == 0x01)	//C
+								{
+									temp_size_b = 1;		//Single size
+									temp_index_b = 0;		//No offset (only 1 big)
+								}
+								else
+								{
+									GL_THROW("NR: One of the lines has invalid phase parameters");
+									/*  TROUBLESHOOT
+									One of the lines in the powerflow model has an invalid phase in
+									reference to its to and from ends.  This should have been caught
+									earlier, so submit your code and a bug report using the trac website.
+									*/
+								}
+								break;
+							}//end 0x01
+						case 0x02:	//B
+							{
+								if ((branch[jindexer].phases & 0x07) == 0x02)	//B
+								{
+									temp_size_b = 1;		//Single size
+									temp_index_b = 0;		//No offset (only 1 big)
+								}
+								else
+								{
+									GL_THROW("NR: One of the lines has invalid phase parameters");
+								}
+								break;
+							}//end 0x02
+						case 0x03:	//BC
+							{
+								temp_size_b = 2;	//Size of this matrix's admittance
+								if ((branch[jindexer].phases & 0x07) == 0x01)	//C
+								{
+									temp_index_b = 1;		//offset
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x02)	//B
+								{
+									temp_index_b = 0;		//offset
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x03)	//BC
+								{
+									temp_index_b = 0;
+								}
+								else
+								{
+									GL_THROW("NR: One of the lines has invalid phase parameters");
+								}
+								break;
+							}//end 0x03
+						case 0x04:	//A
 							{
-								temp_size = 3;	//Size of this matrix's admittance
+								if ((branch[jindexer].phases & 0x07) == 0x04)	//A
+								{
+									temp_size_b = 1;		//Single size
+									temp_index_b = 0;		//No offset (only 1 big)
+								}
+								else
+								{
+									GL_THROW("NR: One of the lines has invalid phase parameters");
+								}
+								break;
+							}//end 0x04
+						case 0x05:	//AC
+							{
+								temp_size_b = 2;	//Size of this matrix's admittance
 								if ((branch[jindexer].phases & 0x07) == 0x01)	//C
 								{
-									temp_index = 2;		//offset
+									temp_index_b = 1;		//offset
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x04)	//A
+								{
+									temp_index_b = 0;		//offset
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x05)	//AC
+								{
+									temp_index_b = 0;
+								}
+								else
+								{
+									GL_THROW("NR: One of the lines has invalid phase parameters");
+								}
+								break;
+							}//end 0x05
+						case 0x06:	//AB
+							{
+								temp_size_b = 2;	//Size of this matrix's admittance
+								if ((branch[jindexer].phases & 0x07) == 0x02)	//B
+								{
+									temp_index_b = 1;		//offset
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x04)	//A
+								{
+									temp_index_b = 0;		//offset
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x06)	//AB
+								{
+									temp_index_b = 0;
+								}
+								else
+								{
+									GL_THROW("NR: One of the lines has invalid phase parameters");
+								}
+								break;
+							}//end 0x06
+						case 0x07:	//ABC
+							{
+								temp_size_b = 3;	//Size of this matrix's admittance
+								if ((branch[jindexer].phases & 0x07) == 0x01)	//C
+								{
+									temp_index_b = 2;		//offset
 								}
 								else if ((branch[jindexer].phases & 0x07) == 0x02)	//B
 								{
-									temp_index = 1;		//offset
+									temp_index_b = 1;		//offset
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x03)	//BC
+								{
+									temp_index_b = 1;
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x04)	//A
+								{
+									temp_index_b = 0;		//offset
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x05)	//AC
+								{
+									temp_index_b = 0;
+									Full_Mat_B = true;		//Flag so we know C needs to be gapped
+								}
+								else if ((branch[jindexer].phases & 0x07) == 0x06)	//AB
+								{
+									temp_index_b = 0;
+								}
+								else
+								{
+									GL_THROW("NR: One of the lines has invalid phase parameters");
+								}
+								break;
+							}//end 0x07
+						default:
+							{
+								break;
+							}
+					}//End switch/case for to
+
+					//Make sure everything was set before proceeding
+					if ( (temp_index==-1) || (temp_index_b==-1) || (temp_size==-1) || (temp_size_b==-1) || (temp_size_c==-1))
+					{
+						GL_THROW("NR: Failure to construct single/double phase line indices");
+						/*  TROUBLESHOOT
+						A single or double phase line (e.g., just A or AB) has failed to properly initialize all of the indices
+						necessary to form the admittance matrix.  Please submit a bug report, with your code, to the trac site.
+						*/
+					}
+
+					if (Full_Mat_A)	//From side is a full ABC and we have AC
+					{
+						for ( jindex = 0 ; jindex < temp_size_c ; jindex++ )		//Loop through rows of admittance matrices				
+						{
+							for ( kindex = 0 ; kindex < temp_size_c ; kindex++ )	//Loop through columns of admittance matrices
+							{
+								//Indices counted out from Self admittance above.  needs doubling due to complex separation
+								if ((Temp_Ad_A[jindex][kindex].Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From imags
+								{
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex*2;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_A[jindex][kindex].Im());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+									
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex*2 + temp_size;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex + temp_size_b;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (Temp_Ad_A[jindex][kindex].Im());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+								}
+
+								if ((Temp_Ad_B[jindex][kindex].Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To imags
+								{
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex*2;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_B[jindex][kindex].Im());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+									
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex + temp_size_b;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex*2 + temp_size;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = Temp_Ad_B[jindex][kindex].Im();
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+								}
+
+								if ((Temp_Ad_A[jindex][kindex].Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From reals
+								{
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex*2 + temp_size;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_A[jindex][kindex].Re());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+									
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex*2;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex + temp_size_b;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_A[jindex][kindex].Re());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
+								}
+
+								if ((Temp_Ad_B[jindex][kindex].Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To reals
+								{
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex + temp_size_b;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex*2;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_B[jindex][kindex].Re());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+									
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex*2 + temp_size;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_B[jindex][kindex].Re());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
+								}
+							}//column end
+						}//row end
+					}//end full ABC for from AC
+
+					if (Full_Mat_B)	//To side is a full ABC and we have AC
+					{
+						for (jindex=0; jindex<temp_size_c; jindex++)		//Loop through rows of admittance matrices				
+						{
+							for (kindex=0; kindex<temp_size_c; kindex++)	//Loop through columns of admittance matrices
+							{
+								//Indices counted out from Self admittance above.  needs doubling due to complex separation
+								if ((Temp_Ad_A[jindex][kindex].Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From imags
+								{
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex*2;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_A[jindex][kindex].Im());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+									
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex + temp_size;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex*2 + temp_size_b;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (Temp_Ad_A[jindex][kindex].Im());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+								}
+
+								if ((Temp_Ad_B[jindex][kindex].Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To imags
+								{
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex*2;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_B[jindex][kindex].Im());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+									
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex*2 + temp_size_b;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex + temp_size;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = Temp_Ad_B[jindex][kindex].Im();
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+								}
+
+								if ((Temp_Ad_A[jindex][kindex].Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From reals
+								{
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex + temp_size;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex*2;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_A[jindex][kindex].Re());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+									
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex*2 + temp_size_b;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_A[jindex][kindex].Re());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
+								}
+
+								if ((Temp_Ad_B[jindex][kindex].Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To reals
+								{
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex*2 + temp_size_b;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_B[jindex][kindex].Re());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+									
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex*2;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex + temp_size;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_B[jindex][kindex].Re());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
+								}
+							}//column end
+						}//row end
+					}//end full ABC for to AC
+
+					if ((!Full_Mat_A) && (!Full_Mat_B))	//Neither is a full ABC, or we aren't doing AC, so we don't care
+					{
+						for (jindex=0; jindex<temp_size_c; jindex++)		//Loop through rows of admittance matrices				
+						{
+							for (kindex=0; kindex<temp_size_c; kindex++)	//Loop through columns of admittance matrices
+							{
+								//Indices counted out from Self admittance above.  needs doubling due to complex separation
+								if ((Temp_Ad_A[jindex][kindex].Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From imags
+								{
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_A[jindex][kindex].Im());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+									
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex + temp_size;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex + temp_size_b;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (Temp_Ad_A[jindex][kindex].Im());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+								}
+
+								if ((Temp_Ad_B[jindex][kindex].Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To imags
+								{
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_B[jindex][kindex].Im());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+									
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex + temp_size_b;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex + temp_size;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = Temp_Ad_B[jindex][kindex].Im();
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
 								}
-								else if ((branch[jindexer].phases & 0x07) == 0x03)	//BC
+
+								if ((Temp_Ad_A[jindex][kindex].Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From reals
 								{
-									temp_index = 1;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex + temp_size;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_A[jindex][kindex].Re());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+									
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex + temp_size_b;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_A[jindex][kindex].Re());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
 								}
-								else if ((branch[jindexer].phases & 0x07) == 0x04)	//A
+
+								if ((Temp_Ad_B[jindex][kindex].Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To reals
 								{
-									temp_index = 0;		//offset
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex + temp_size_b;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_B[jindex][kindex].Re());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+									
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex + temp_size;
+									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_B[jindex][kindex].Re());
+									powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
 								}
-								else if ((branch[jindexer].phases & 0x07) == 0x05)	//AC
+							}//column end
+						}//row end
+					}//end not full ABC with AC on either side case
+				}//end all others else
+			}//end branch for
+
+			//Localized updates write back over the existing fixed diagonal entries, unless their pattern changed
+			admit_localized = ((admit_localized == true) && (diag_pattern_changed == false));
+
+			if (admit_localized == false)
+			{
+				//Loop through the islands
+				for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
+				{
+					//Build the fixed part of the diagonal PQ bus elements of 6n*6n Y_NR matrix. This part will not be updated at each iteration. 
+					powerflow_values->island_matrix_values[island_loop_index].size_diag_fixed = 0;
+				}
+
+				for (jindexer=0; jindexer<bus_count;jindexer++) 
+				{
+					if (bus[jindexer].island_number != -1)
+					{
+						//Pull the index
+						island_loop_index = bus[jindexer].island_number;
+
+						//Loop through and get sizes
+						for (jindex=0; jindex<3; jindex++)
+						{
+							for (kindex=0; kindex<3; kindex++)
+							{		 
+								if ((powerflow_values->BA_diag[jindexer].Y[jindex][kindex]).Re() != 0 && bus[jindexer].type != 1 && jindex!=kindex)  
+									powerflow_values->island_matrix_values[island_loop_index].size_diag_fixed += 1; 
+								if ((powerflow_values->BA_diag[jindexer].Y[jindex][kindex]).Im() != 0 && bus[jindexer].type != 1 && jindex!=kindex) 
+									powerflow_values->island_matrix_values[island_loop_index].size_diag_fixed += 1; 
+							}
+						}
+					}
+					//Default else -- nota  valid island anyways
+				}
+
+				//Loop through the islands again
+				for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
+				{
+					if (powerflow_values->island_matrix_values[island_loop_index].Y_diag_fixed == NULL)
+					{
+						powerflow_values->island_matrix_values[island_loop_index].Y_diag_fixed = (Y_NR *)gl_malloc((powerflow_values->island_matrix_values[island_loop_index].size_diag_fixed*2) *sizeof(Y_NR));   //powerflow_values->island_matrix_values[island_loop_index].Y_diag_fixed store the row,column and value of the fixed part of the diagonal PQ bus elements of 6n*6n Y_NR matrix.
+
+						//Make sure it worked
+						if (powerflow_values->island_matrix_values[island_loop_index].Y_diag_fixed == NULL)
+							GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
+
+						//Update the max size
+						powerflow_values->island_matrix_values[island_loop_index].max_size_diag_fixed = powerflow_values->island_matrix_values[island_loop_index].size_diag_fixed;
+					}
+					else if (powerflow_values->island_matrix_values[island_loop_index].size_diag_fixed > powerflow_values->island_matrix_values[island_loop_index].max_size_diag_fixed)		//Something changed and we are bigger!!
+					{
+						//Destroy us!
+						gl_free(powerflow_values->island_matrix_values[island_loop_index].Y_diag_fixed);
+
+						//Rebuild us, we have the technology
+						powerflow_values->island_matrix_values[island_loop_index].Y_diag_fixed = (Y_NR *)gl_malloc((powerflow_values->island_matrix_values[island_loop_index].size_diag_fixed*2) *sizeof(Y_NR));
+
+						//Make sure it worked
+						if (powerflow_values->island_matrix_values[island_loop_index].Y_diag_fixed == NULL)
+							GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
+
+						//Store the new size
+						powerflow_values->island_matrix_values[island_loop_index].max_size_diag_fixed = powerflow_values->island_matrix_values[island_loop_index].size_diag_fixed;
+
+						//Flag for a reallocation
+						powerflow_values->island_matrix_values[island_loop_index].NR_realloc_needed = true;
+					}
+
+					//Zero the accumulator for the next section, while we're in here
+					powerflow_values->island_matrix_values[island_loop_index].indexer = 0;
+				}//End island loop routine
+			}//End fixed diagonal sizing
+
+			for (jindexer=0; jindexer<bus_count;jindexer++)	//Parse through bus list
+			{ 
+				//Extract our island reference
+				island_index_val = bus[jindexer].island_number;
+
+				//If we're unallocated, just skip us
+				if (island_index_val == -1)
+				{
+					continue;
+				}
+				//Default else -- proceed
+
+				if (admit_localized == true)
+				{
+					//Only updated buses - written back over their previous entries
+					if (bus[jindexer].admit_change == false)
+					{
+						continue;
+					}
+
+					powerflow_values->island_matrix_values[island_index_val].indexer = bus[jindexer].diag_fixed_loc;
+				}
+				else	//Full build - store where this bus's entries start, for later localized updates
+				{
+					bus[jindexer].diag_fixed_loc = powerflow_values->island_matrix_values[island_index_val].indexer;
+				}
+
+				//Deflag any localized change - handled now
+				bus[jindexer].admit_change = false;
+
+				for ( jindex = 0 ; jindex < powerflow_values->BA_diag[jindexer].size ; jindex++ )
+				{
+					for ( kindex = 0 ; kindex < powerflow_values->BA_diag[jindexer].size ; kindex++ )
+					{					
+						if ((powerflow_values->BA_diag[jindexer].Y[jindex][kindex]).Im() != 0 && bus[jindexer].type != 1 && jindex!=kindex)
+						{
+							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*powerflow_values->BA_diag[jindexer].row_ind + jindex;
+							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*powerflow_values->BA_diag[jindexer].col_ind + kindex;
+							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (powerflow_values->BA_diag[jindexer].Y[jindex][kindex]).Im();
+							powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+
+							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*powerflow_values->BA_diag[jindexer].row_ind + jindex +powerflow_values->BA_diag[jindexer].size;
+							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*powerflow_values->BA_diag[jindexer].col_ind + kindex +powerflow_values->BA_diag[jindexer].size;
+							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(powerflow_values->BA_diag[jindexer].Y[jindex][kindex]).Im();
+							powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+						}
+
+						if ((powerflow_values->BA_diag[jindexer].Y[jindex][kindex]).Re() != 0 && bus[jindexer].type != 1 && jindex!=kindex)
+						{
+							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*powerflow_values->BA_diag[jindexer].row_ind + jindex;
+							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*powerflow_values->BA_diag[jindexer].col_ind + kindex +powerflow_values->BA_diag[jindexer].size;
+							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (powerflow_values->BA_diag[jindexer].Y[jindex][kindex]).Re();
+							powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+							
+							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*powerflow_values->BA_diag[jindexer].row_ind + jindex +powerflow_values->BA_diag[jindexer].size;
+							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*powerflow_values->BA_diag[jindexer].col_ind + kindex;
+							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (powerflow_values->BA_diag[jindexer].Y[jindex][kindex]).Re();
+							powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+						}
+					}
+				}
+			}//End bus parse for fixed diagonal
+		}//End admittance update
+
+		//Loop through each island to reset these flags
+		for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
+		{
+			//Reset saturation checks
+			powerflow_values->island_matrix_values[island_loop_index].SaturationMismatchPresent = false;
+
+			//Reset the iteration counters
+			powerflow_values->island_matrix_values[island_loop_index].iteration_count = 0;
+		}
+
+		//Reset the global flag for iterations on islands -- will be set at the end
+		still_iterating_islands = true;
+
+		//Also reset island index
+		island_loop_index = 0;
+
+		//Group the buses by island and connection type for the load calculations - only when the islands may have changed
+		//(fault_check flags NR_admit_change whenever it reassigns islands or phases)
+		if ((NR_admit_change == true) || (powerflow_values->load_batch_valid == false))
+		{
+			NR_build_load_batches(bus_count,bus,powerflow_values);
+		}
+
+		//While it - loop through until we solve the issue
+		while (still_iterating_islands == true)
+		{
+			//Map the superLU variables each time -- just easier to do it always
+			if (matrix_solver_method==MM_SUPERLU)
+			{
+				//Put the void pointer into a local context
+				curr_island_superLU_vars = (SUPERLU_NR_vars *)powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars;
+			}
+
+			//Call the load subfunction
+			compute_load_values(bus_count,bus,powerflow_values,false,island_loop_index);
+		
+			// Calculate the mismatch of three phase current injection at each bus (deltaI), 
+			//and store the deltaI in terms of real and reactive value in array powerflow_values->island_matrix_values[island_loop_index].deltaI_NR    
+			if (powerflow_values->island_matrix_values[island_loop_index].deltaI_NR==NULL)
+			{
+				powerflow_values->island_matrix_values[island_loop_index].deltaI_NR = (double *)gl_malloc((2*powerflow_values->island_matrix_values[island_loop_index].total_variables) *sizeof(double));   // left_hand side of equation (11)
+
+				//Make sure it worked
+				if (powerflow_values->island_matrix_values[island_loop_index].deltaI_NR == NULL)
+					GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
+
+				//Update the max size
+				powerflow_values->island_matrix_values[island_loop_index].max_total_variables = powerflow_values->island_matrix_values[island_loop_index].total_variables;
+			}
+			else if (powerflow_values->island_matrix_values[island_loop_index].NR_realloc_needed)		//Bigger sized (this was checked above)
+			{
+				//Decimate the existing value
+				gl_free(powerflow_values->island_matrix_values[island_loop_index].deltaI_NR);
+
+				//Reallocate it...bigger...faster...stronger!
+				powerflow_values->island_matrix_values[island_loop_index].deltaI_NR = (double *)gl_malloc((2*powerflow_values->island_matrix_values[island_loop_index].total_variables) *sizeof(double));
+
+				//Make sure it worked
+				if (powerflow_values->island_matrix_values[island_loop_index].deltaI_NR == NULL)
+					GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
+
+				//Store the updated value
+				powerflow_values->island_matrix_values[island_loop_index].max_total_variables = powerflow_values->island_matrix_values[island_loop_index].total_variables;
+			}
+
+			//If we're in PF_DYNINIT mode, initialize the balancing convergence
+			if (powerflow_type == PF_DYNINIT)
+			{
+				powerflow_values->island_matrix_values[island_loop_index].swing_converged = true;	//init it to yes, fail by exception, not default
+			}
+
+			//Compute the calculated loads (not specified) at each bus
+			for (indexer=0; indexer<bus_count; indexer++) //for specific bus k
+			{
+				//Make sure the bus we're looking at is relevant to this island - otherwise, we can skip it
+				if (bus[indexer].island_number == island_loop_index)
+				{
+					//Update for generator symmetry - only in static dynamic mode and when SWING is a SWING
+					if ((powerflow_type == PF_DYNINIT) && (powerflow_values->island_matrix_values[island_loop_index].swing_is_a_swing==true))
+					{
+						//Secondary check - see if it is even needed - basically built around 3-phase right now
+						//Initializes the Norton equivalent item -- normal generators shoudln't need this
+						if ((*bus[indexer].dynamics_enabled==true) && (bus[indexer].full_Y != NULL) && (bus[indexer].DynCurrent != NULL))
+						{
+							//See if we're three phase or triplex
+							if ((bus[indexer].phases & 0x07) == 0x07)
+							{
+								//Form denominator term of Ii, since it won't change
+								temp_complex_1 = (~bus[indexer].V[0]) + (~bus[indexer].V[1])*avalsq + (~bus[indexer].V[2])*aval;
+								
+								//Form up numerator portion that doesn't change (Q and admittance)
+								//Do in parts, just for readability
+								//Row 1 of admittance mult
+								temp_complex_0 = ~bus[indexer].V[0]*(bus[indexer].full_Y[0]*bus[indexer].V[0] + bus[indexer].full_Y[1]*bus[indexer].V[1] + bus[indexer].full_Y[2]*bus[indexer].V[2]);
+
+								//Row 2 of admittance
+								temp_complex_0 += ~bus[indexer].V[1]*(bus[indexer].full_Y[3]*bus[indexer].V[0] + bus[indexer].full_Y[4]*bus[indexer].V[1] + bus[indexer].full_Y[5]*bus[indexer].V[2]);
+
+								//Row 3 of admittance
+								temp_complex_0 += ~bus[indexer].V[2]*(bus[indexer].full_Y[6]*bus[indexer].V[0] + bus[indexer].full_Y[7]*bus[indexer].V[1] + bus[indexer].full_Y[8]*bus[indexer].V[2]);
+
+								//Make the conjugate - used for individual phase accumulation later
+								temp_complex_3 = ~temp_complex_0;
+
+								//If we are a SWING, zero our PT portion and QT for accumulation
+								if (((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == true)) && (powerflow_values->island_matrix_values[island_loop_index].iteration_count>0))
 								{
-									temp_index = 0;
-									Full_Mat_A = true;		//Flag so we know C needs to be gapped
+									*bus[indexer].PGenTotal = complex(0.0,0.0);
 								}
-								else if ((branch[jindexer].phases & 0x07) == 0x06)	//AB
+							}
+							else if ((bus[indexer].phases & 0x80) == 0x80)	//Triplex
+							{
+								//Get the "delta voltage" for use here
+								temp_complex_4 = bus[indexer].V[0] + bus[indexer].V[1];
+
+								//Form denominator term of Ii, since it won't change
+								temp_complex_1 = ~temp_complex_4;
+								
+								//Form up numerator portion that doesn't change (Q and admittance)
+								//Should just be a single entry, for "reasons/asssumptions"
+								temp_complex_0 = ~temp_complex_4*(bus[indexer].full_Y[0]*temp_complex_4);
+
+								//Make the conjugate - used for individual phase accumulation later
+								temp_complex_3 = ~temp_complex_0;
+
+								//If we are a SWING, zero our PT portion and QT for accumulation
+								if (((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == true)) && (powerflow_values->island_matrix_values[island_loop_index].iteration_count>0))
 								{
-									temp_index = 0;
+									*bus[indexer].PGenTotal = -temp_complex_3;	//Gets piecemeal removed from three-phase, just all at once here!
 								}
-								else
+							}
+							else if ((bus[indexer].phases & 0x07) == 0x00)	//No phases
+							{
+								temp_complex_1 = complex(0.0,0.0);
+								temp_complex_0 = complex(0.0,0.0);
+								temp_complex_3 = complex(0.0,0.0);
+
+								//If we are a SWING, zero our PT portion and QT for accumulation
+								if (((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == true)) && (powerflow_values->island_matrix_values[island_loop_index].iteration_count>0))
 								{
-									GL_THROW("NR: One of the lines has invalid phase parameters");
+									*bus[indexer].PGenTotal = complex(0.0,0.0);
 								}
-								break;
-							}//end 0x07
-						default:
+							}
+							//Default else - some other permutation, but not really supported (single-phase swing, or partial swing
+							
+							//numerator done, except PT portion (add in below - SWING bus is different
+						}
+						else	//Not enabled or not "full-Y-ed" - set to zero
+						{
+							temp_complex_0 = 0.0;
+							temp_complex_1 = 0.0;	//Basically a flag to ignore it
+						}
+					}//End PF_DYNINIT and SWING is still the same
+
+					for ( jindex = 0 ; jindex < powerflow_values->BA_diag[indexer].size ; jindex++ ) // rows - for specific phase that exists
+					{
+						tempIcalcReal = tempIcalcImag = 0;   
+
+						if ((bus[indexer].phases & 0x80) == 0x80)	//Split phase - triplex bus
+						{
+							//Two states of triplex bus - To node of SPCT transformer needs to be different
+							//First different - Delta-I and diagonal contributions
+							if ((bus[indexer].phases & 0x20) == 0x20)	//We're the To bus
 							{
-								break;
+								//Pre-negated due to the nature of how it's calculated (V1 compared to I1)
+								tempPbus =  bus[indexer].PL[jindex];	//Copy load amounts in
+								tempQbus =  bus[indexer].QL[jindex];	
 							}
-					}//End switch/case for from
+							else	//We're just a normal triplex bus
+							{
+								//This one isn't negated (normal operations)
+								tempPbus =  -bus[indexer].PL[jindex];	//Copy load amounts in
+								tempQbus =  -bus[indexer].QL[jindex];	
+							}//end normal triplex bus
 
-					//Check the to side and get all appropriate offsets
-					switch(bus[tempb].phases & 0x07) {
-						case 0x01:	//C
+							//Network current of this row - admittance matrix row times the present voltages
+							NR_bus_row_current(bus,branch,powerflow_values,indexer,jindex,&tempIcalcReal,&tempIcalcImag,&temp_index_b);
+
+							//Determine how we are posting this update
+							if ((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == true))	//SWING bus is different (when it really is a SWING bus)
 							{
-								if ((branch[jindexer].phases & 0x07) == 0x01)	//C
-								{
-									temp_size_b = 1;		//Single size
-									temp_index_b = 0;		//No offset (only 1 big)
-								}
-								else
+								if ((powerflow_type == PF_DYNINIT) && (bus[indexer].DynCurrent != NULL))	//We're a generator-type bus
 								{
-									GL_THROW("NR: One of the lines has invalid phase parameters");
-									/*  TROUBLESHOOT
-									One of the lines in the powerflow model has an invalid phase in
-									reference to its to and from ends.  This should have been caught
-									earlier, so submit your code and a bug report using the trac website.
-									*/
-								}
-								break;
-							}//end 0x01
-						case 0x02:	//B
+									//See if we're a Norton-equivalent-based generator
+									if (bus[indexer].full_Y != NULL)
+									{
+										//Compute our "power generated" value for this phase - conjugated in formation
+										temp_complex_2 = bus[indexer].V[jindex] * complex(tempIcalcReal,-tempIcalcImag);
+
+										if (powerflow_values->island_matrix_values[island_loop_index].iteration_count>0)	//Only update SWING on subsequent passes
+										{
+											//Now add it into the "generation total" for the SWING
+											//Accumulate our power from the bus injections
+											(*bus[indexer].PGenTotal) += temp_complex_2; // both PT and QT = Ssource-Sysource = v conj(I) - v conj(ysource v) - overall gen handled above
+										}
+
+										//Compute the delta_I, just like below - but don't post it (still zero in calcs)
+										work_vals_double_0 = (bus[indexer].V[jindex]).Mag()*(bus[indexer].V[jindex]).Mag();
+
+										if (work_vals_double_0!=0)	//Only normal one (not square), but a zero is still a zero even after that
+										{
+											work_vals_double_1 = (bus[indexer].V[jindex]).Re();
+											work_vals_double_2 = (bus[indexer].V[jindex]).Im();
+											work_vals_double_3 = (tempPbus * work_vals_double_1 + tempQbus * work_vals_double_2)/ (work_vals_double_0) - tempIcalcReal; // equation(7), Real part of deltaI, left hand side of equation (11)
+											work_vals_double_4 = (tempPbus * work_vals_double_2 - tempQbus * work_vals_double_1)/ (work_vals_double_0) - tempIcalcImag; // Imaginary part of deltaI, left hand side of equation (11)
+
+											//Form a magnitude value - put in work_vals_double_0, since we're done with it
+											work_vals_double_0 = sqrt((work_vals_double_3*work_vals_double_3+work_vals_double_4*work_vals_double_4));
+										}
+										else	//Would give us a NAN, so it must be out of service or something (case from below - really shouldn't apply to SWING)
+										{
+											work_vals_double_0 = 0.0;	//Assumes "converged"
+										}
+										
+										if (work_vals_double_0 > bus[indexer].max_volt_error)	//Failure check (defaults to voltage convergence for now)
+										{
+											powerflow_values->island_matrix_values[island_loop_index].swing_converged=false;
+										}
+									}//End Norton-equivalent SWING
+									else	//Other generator types
+									{
+										//Compute the delta_I, just like below - but don't post it (still zero in calcs)
+										work_vals_double_0 = (bus[indexer].V[jindex]).Mag()*(bus[indexer].V[jindex]).Mag();
+
+										if (work_vals_double_0!=0)	//Only normal one (not square), but a zero is still a zero even after that
+										{
+											work_vals_double_1 = (bus[indexer].V[jindex]).Re();
+											work_vals_double_2 = (bus[indexer].V[jindex]).Im();
+											work_vals_double_3 = (tempPbus * work_vals_double_1 + tempQbus * work_vals_double_2)/ (work_vals_double_0) - tempIcalcReal; // equation(7), Real part of deltaI, left hand side of equation (11)
+											work_vals_double_4 = (tempPbus * work_vals_double_2 - tempQbus * work_vals_double_1)/ (work_vals_double_0) - tempIcalcImag; // Imaginary part of deltaI, left hand side of equation (11)
+
+											//Form a magnitude value - put in work_vals_double_0, since we're done with it
+											work_vals_double_0 = sqrt((work_vals_double_3*work_vals_double_3+work_vals_double_4*work_vals_double_4));
+										}
+										else	//Would give us a NAN, so it must be out of service or something (case from below - really shouldn't apply to SWING)
+										{
+											work_vals_double_0 = 0.0;	//Assumes "converged"
+										}
+
+										if (work_vals_double_0 > bus[indexer].max_volt_error)	//Failure check (defaults to voltage convergence for now)
+										{
+											powerflow_values->island_matrix_values[island_loop_index].swing_converged=false;
+										}
+
+										//Put this into DynCurrent for storage
+										/*** NOTE - This is untested and it's not clear if it is even needed (triplex swing bus?) ******/
+										bus[indexer].DynCurrent[jindex] = complex(tempIcalcReal,tempIcalcImag);
+									}//End other generator types
+								}//End PF_DYNINIT SWING traversion
+
+								//Effectively Zero out the components, regardless of normal run or not
+								//Should already be zerod, but do it again for paranoia sake
+								powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + jindex] = 0.0;
+								powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] = 0.0;
+
+								//Saturation skipped for "swing is a swing" case, since it doesn't affect the admittance (no need to offset)
+							}//End SWING bus cases
+							else	//PQ bus or SWING masquerading as a PQ
 							{
-								if ((branch[jindexer].phases & 0x07) == 0x02)	//B
+								work_vals_double_0 = (bus[indexer].V[jindex]).Mag()*(bus[indexer].V[jindex]).Mag();
+
+								if (work_vals_double_0!=0)	//Only normal one (not square), but a zero is still a zero even after that
 								{
-									temp_size_b = 1;		//Single size
-									temp_index_b = 0;		//No offset (only 1 big)
+									work_vals_double_1 = (bus[indexer].V[jindex]).Re();
+									work_vals_double_2 = (bus[indexer].V[jindex]).Im();
+
+									powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+ powerflow_values->BA_diag[indexer].size + jindex] = (tempPbus * work_vals_double_1 + tempQbus * work_vals_double_2)/ (work_vals_double_0) - tempIcalcReal ; // equation(7), Real part of deltaI, left hand side of equation (11)
+									powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] = (tempPbus * work_vals_double_2 - tempQbus * work_vals_double_1)/ (work_vals_double_0) - tempIcalcImag; // Imaginary part of deltaI, left hand side of equation (11)
 								}
 								else
 								{
-									GL_THROW("NR: One of the lines has invalid phase parameters");
+									powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + jindex] = 0.0;
+									powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] = 0.0;
 								}
-								break;
-							}//end 0x02
-						case 0x03:	//BC
+							}//End normal bus handling
+						}//End split-phase present
+						else	//Three phase or some variant thereof
+						{
+							tempPbus =  - bus[indexer].PL[jindex];	//Copy load amounts in
+							tempQbus =  - bus[indexer].QL[jindex];	
+
+							//Network current of this row - admittance matrix row times the present voltages
+							NR_bus_row_current(bus,branch,powerflow_values,indexer,jindex,&tempIcalcReal,&tempIcalcImag,&temp_index_b);
+
+							//Determine how we are posting this update
+							if ((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == true))	//SWING bus is different (when it really is a SWING bus)
 							{
-								temp_size_b = 2;	//Size of this matrix's admittance
-								if ((branch[jindexer].phases & 0x07) == 0x01)	//C
-								{
-									temp_index_b = 1;		//offset
-								}
-								else if ((branch[jindexer].phases & 0x07) == 0x02)	//B
-								{
-									temp_index_b = 0;		//offset
-								}
-								else if ((branch[jindexer].phases & 0x07) == 0x03)	//BC
-								{
-									temp_index_b = 0;
-								}
-								else
+								if ((powerflow_type == PF_DYNINIT) && (bus[indexer].DynCurrent != NULL))
 								{
-									GL_THROW("NR: One of the lines has invalid phase parameters");
-								}
-								break;
-							}//end 0x03
-						case 0x04:	//A
-							{
-								if ((branch[jindexer].phases & 0x07) == 0x04)	//A
+									//See if we're a Norton-equivalent-based generator
+									if (bus[indexer].full_Y != NULL)
+									{
+										//Compute our "power generated" value for this phase - conjugated in formation
+										temp_complex_2 = bus[indexer].V[jindex] * complex(tempIcalcReal,-tempIcalcImag);
+
+										if (powerflow_values->island_matrix_values[island_loop_index].iteration_count>0)	//Only update SWING on subsequent passes
+										{
+											//Now add it into the "generation total" for the SWING
+											//Accumulate our power from the bus injections
+											(*bus[indexer].PGenTotal) += temp_complex_2 - temp_complex_3/3.0; // both PT and QT = Ssource-Sysource = v conj(I) - v conj(ysource v)
+										}
+
+										//Compute the delta_I, just like below - but don't post it (still zero in calcs)
+										work_vals_double_0 = (bus[indexer].V[temp_index_b]).Mag()*(bus[indexer].V[temp_index_b]).Mag();
+
+										if (work_vals_double_0!=0)	//Only normal one (not square), but a zero is still a zero even after that
+										{
+											work_vals_double_1 = (bus[indexer].V[temp_index_b]).Re();
+											work_vals_double_2 = (bus[indexer].V[temp_index_b]).Im();
+											work_vals_double_3 = (tempPbus * work_vals_double_1 + tempQbus * work_vals_double_2)/ (work_vals_double_0) - tempIcalcReal; // equation(7), Real part of deltaI, left hand side of equation (11)
+											work_vals_double_4 = (tempPbus * work_vals_double_2 - tempQbus * work_vals_double_1)/ (work_vals_double_0) - tempIcalcImag; // Imaginary part of deltaI, left hand side of equation (11)
+
+											//Form a magnitude value - put in work_vals_double_0, since we're done with it
+											work_vals_double_0 = sqrt((work_vals_double_3*work_vals_double_3+work_vals_double_4*work_vals_double_4));
+										}
+										else	//Would give us a NAN, so it must be out of service or something (case from below - really shouldn't apply to SWING)
+										{
+											work_vals_double_0 = 0.0;	//Assumes "converged"
+										}
+										
+										if (work_vals_double_0 > bus[indexer].max_volt_error)	//Failure check (defaults to voltage convergence for now)
+										{
+											powerflow_values->island_matrix_values[island_loop_index].swing_converged=false;
+										}
+									}//End Norton-equivalent SWING
+									else	//Other generator types
+									{
+										//Compute the delta_I, just like below - but don't post it (still zero in calcs)
+										work_vals_double_0 = (bus[indexer].V[temp_index_b]).Mag()*(bus[indexer].V[temp_index_b]).Mag();
+
+										if (work_vals_double_0!=0)	//Only normal one (not square), but a zero is still a zero even after that
+										{
+											work_vals_double_1 = (bus[indexer].V[temp_index_b]).Re();
+											work_vals_double_2 = (bus[indexer].V[temp_index_b]).Im();
+											work_vals_double_3 = (tempPbus * work_vals_double_1 + tempQbus * work_vals_double_2)/ (work_vals_double_0) - tempIcalcReal; // equation(7), Real part of deltaI, left hand side of equation (11)
+											work_vals_double_4 = (tempPbus * work_vals_double_2 - tempQbus * work_vals_double_1)/ (work_vals_double_0) - tempIcalcImag; // Imaginary part of deltaI, left hand side of equation (11)
+
+											//Form a magnitude value - put in work_vals_double_0, since we're done with it
+											work_vals_double_0 = sqrt((work_vals_double_3*work_vals_double_3+work_vals_double_4*work_vals_double_4));
+										}
+										else	//Would give us a NAN, so it must be out of service or something (case from below - really shouldn't apply to SWING)
+										{
+											work_vals_double_0 = 0.0;	//Assumes "converged"
+										}
+
+										if (work_vals_double_0 > bus[indexer].max_volt_error)	//Failure check (defaults to voltage convergence for now)
+										{
+											powerflow_values->island_matrix_values[island_loop_index].swing_converged=false;
+										}
+
+										//Put this into DynCurrent for storage
+										bus[indexer].DynCurrent[jindex] = complex(tempIcalcReal,tempIcalcImag);
+									}//End other generator types
+								}//End PF_DYNINIT SWING traversion
+
+								//Effectively Zero out the components, regardless of normal run or not
+								//Should already be zerod, but do it again for paranoia sake
+								if (NR_busdata[indexer].BusHistTerm != NULL)	//See if we're "delta-capable"
 								{
-									temp_size_b = 1;		//Single size
-									temp_index_b = 0;		//No offset (only 1 big)
+									powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + jindex] = NR_busdata[indexer].BusHistTerm[jindex].Re();
+									powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] = NR_busdata[indexer].BusHistTerm[jindex].Im();
 								}
 								else
 								{
-									GL_THROW("NR: One of the lines has invalid phase parameters");
+									powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + jindex] = 0.0;
+									powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] = 0.0;
 								}
-								break;
-							}//end 0x04
-						case 0x05:	//AC
+
+								//Saturation skipped for "swing is a swing" case, since it doesn't affect the admittance (no need to offset)
+							}//End SWING bus cases
+							else	//PQ bus or SWING masquerading as a PQ
 							{
-								temp_size_b = 2;	//Size of this matrix's admittance
-								if ((branch[jindexer].phases & 0x07) == 0x01)	//C
-								{
-									temp_index_b = 1;		//offset
-								}
-								else if ((branch[jindexer].phases & 0x07) == 0x04)	//A
-								{
-									temp_index_b = 0;		//offset
-								}
-								else if ((branch[jindexer].phases & 0x07) == 0x05)	//AC
+								work_vals_double_0 = (bus[indexer].V[temp_index_b]).Mag()*(bus[indexer].V[temp_index_b]).Mag();
+
+								if (work_vals_double_0!=0)	//Only normal one (not square), but a zero is still a zero even after that
 								{
-									temp_index_b = 0;
+									work_vals_double_1 = (bus[indexer].V[temp_index_b]).Re();
+									work_vals_double_2 = (bus[indexer].V[temp_index_b]).Im();
+
+									//See if deltamode needs to include extra term
+									if (NR_busdata[indexer].BusHistTerm != NULL)
+									{
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+ powerflow_values->BA_diag[indexer].size + jindex] = (tempPbus * work_vals_double_1 + tempQbus * work_vals_double_2)/ (work_vals_double_0) + NR_busdata[indexer].BusHistTerm[jindex].Re() - tempIcalcReal ; // equation(7), Real part of deltaI, left hand side of equation (11)
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] = (tempPbus * work_vals_double_2 - tempQbus * work_vals_double_1)/ (work_vals_double_0) + NR_busdata[indexer].BusHistTerm[jindex].Im() - tempIcalcImag; // Imaginary part of deltaI, left hand side of equation (11)
+									}
+									else	//Nope
+									{
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+ powerflow_values->BA_diag[indexer].size + jindex] = (tempPbus * work_vals_double_1 + tempQbus * work_vals_double_2)/ (work_vals_double_0) - tempIcalcReal ; // equation(7), Real part of deltaI, left hand side of equation (11)
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] = (tempPbus * work_vals_double_2 - tempQbus * work_vals_double_1)/ (work_vals_double_0) - tempIcalcImag; // Imaginary part of deltaI, left hand side of equation (11)
+									}
+
+									//Accumulate in any saturation current values as well, while we're here
+									if (NR_busdata[indexer].BusSatTerm != NULL)
+									{
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+ powerflow_values->BA_diag[indexer].size + jindex] -= NR_busdata[indexer].BusSatTerm[jindex].Re();
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] -= NR_busdata[indexer].BusSatTerm[jindex].Im();
+									}
 								}
 								else
 								{
-									GL_THROW("NR: One of the lines has invalid phase parameters");
+									if (NR_busdata[indexer].BusHistTerm != NULL)	//See if extra deltamode term needs to be included
+									{
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + jindex] = NR_busdata[indexer].BusHistTerm[jindex].Re();
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] = NR_busdata[indexer].BusHistTerm[jindex].Im();
+									}
+									else
+									{
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + jindex] = 0.0;
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] = 0.0;
+									}
+
+									//Accumulate in any saturation current values as well, while we're here
+									if (NR_busdata[indexer].BusSatTerm != NULL)
+									{
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+ powerflow_values->BA_diag[indexer].size + jindex] -= NR_busdata[indexer].BusSatTerm[jindex].Re();
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] -= NR_busdata[indexer].BusSatTerm[jindex].Im();
+									}
 								}
-								break;
-							}//end 0x05
-						case 0x06:	//AB
+							}//End normal bus handling
+						}//End three-phase or variant thereof
+					}//End delta_I for each phase row
+
+					//Call the overall current injection update for compatible objects (mostly deltamode Norton-equivalent generators)
+					//See if this particular bus has any "current injection update" requirements - semi-silly to do this for SWING-enabled buses, but makes the code more consistent
+					if ((bus[indexer].ExtraCurrentInjFunc != NULL) && ((bus[indexer].type == 0) || ((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == false))))
+					{
+						//Call the function
+						call_return_status = ((STATUS (*)(OBJECT *,int64))(*bus[indexer].ExtraCurrentInjFunc))(bus[indexer].ExtraCurrentInjFuncObject,powerflow_values->island_matrix_values[island_loop_index].iteration_count);
+
+						//Make sure it worked
+						if (call_return_status == FAILED)
+						{
+							GL_THROW("External current injection update failed for device %s",bus[indexer].ExtraCurrentInjFuncObject->name ? bus[indexer].ExtraCurrentInjFuncObject->name : "Unnamed");
+							/*  TROUBLESHOOT
+							While attempting to perform the external current injection update function call, something failed.  Please try again.
+							If the error persists, please submit your code and a bug report via the ticketing system.
+							*/
+						}
+						//Default else - it worked
+					}
+
+					//Add in generator current amounts, if relevant
+					if (powerflow_type != PF_NORMAL)
+					{
+						//Secondary check - see if it is even needed - basically built around 3-phase right now (checks)
+						if ((*bus[indexer].dynamics_enabled==true) && (bus[indexer].DynCurrent != NULL))
+						{
+							//See if we're a Norton-equivalent generator
+							if (bus[indexer].full_Y != NULL)
 							{
-								temp_size_b = 2;	//Size of this matrix's admittance
-								if ((branch[jindexer].phases & 0x07) == 0x02)	//B
+								if ((bus[indexer].phases & 0x07) == 0x07)	//Make sure is three-phase
 								{
-									temp_index_b = 1;		//offset
-								}
-								else if ((branch[jindexer].phases & 0x07) == 0x04)	//A
+									//Only update in particular mode - SWING bus values should still be treated as such
+									if ((powerflow_values->island_matrix_values[island_loop_index].swing_is_a_swing == true) && (powerflow_type == PF_DYNINIT) && (bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == true))	//Really only true for PF_DYNINIT anyways
+									{
+										//Power should be all updated, now update current values
+										temp_complex_0 += complex((*bus[indexer].PGenTotal).Re(),-(*bus[indexer].PGenTotal).Im()); // total generated power injected conjugated
+
+										//Compute Ii
+										if (temp_complex_1.Mag() > 0.0)	//Non zero
+										{
+											temp_complex_2 = temp_complex_0/temp_complex_1;	//Forms Ii
+
+											//Now convert Ii to the individual phase amounts
+											bus[indexer].DynCurrent[0] = temp_complex_2;
+											bus[indexer].DynCurrent[1] = temp_complex_2*avalsq;
+											bus[indexer].DynCurrent[2] = temp_complex_2*aval;
+										}
+										else	//Must make zero
+										{
+											bus[indexer].DynCurrent[0] = complex(0.0,0.0);
+											bus[indexer].DynCurrent[1] = complex(0.0,0.0);
+											bus[indexer].DynCurrent[2] = complex(0.0,0.0);
+										}
+									}//End SWING is still swing, otherwise should just accumulate what it had
+
+									//Don't get added in as part of "normal swing" routine
+									if ((bus[indexer].type == 0) || ((bus[indexer].type>1) && (bus[indexer].swing_functions_enabled == false)))
+									{
+										//Add these into the system - added because "generation"
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[0].Re();		//Phase A
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] += bus[indexer].DynCurrent[1].Re();	//Phase B
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 2] += bus[indexer].DynCurrent[2].Re();	//Phase C
+
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[0].Im();		//Phase A
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] += bus[indexer].DynCurrent[1].Im();	//Phase B
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 2] += bus[indexer].DynCurrent[2].Im();	//Phase C
+									}
+									//Defaulted else - leave as they were
+								}//End three-phase
+								else if ((bus[indexer].phases & 0x80) == 0x80)	//Triplex
 								{
-									temp_index_b = 0;		//offset
+									//Duplicate of the three-phase code, just tweaked for triplex implementaiton
+
+									//Only update in particular mode - SWING bus values should still be treated as such
+									if ((powerflow_values->island_matrix_values[island_loop_index].swing_is_a_swing == true) && (powerflow_type == PF_DYNINIT) && (bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == true))	//Really only true for PF_DYNINIT anyways
+									{
+										//Power should be all updated, now update current values
+										temp_complex_0 += complex((*bus[indexer].PGenTotal).Re(),-(*bus[indexer].PGenTotal).Im()); // total generated power injected conjugated
+
+										//Compute Ii
+										if (temp_complex_1.Mag() > 0.0)	//Non zero
+										{
+											temp_complex_2 = temp_complex_0/temp_complex_1;	//Forms Ii
+
+											//Just store Ii - no need to convert what is a single-phase representation!
+											bus[indexer].DynCurrent[0] = temp_complex_2;
+										}
+										else	//Must make zero
+										{
+											bus[indexer].DynCurrent[0] = complex(0.0,0.0);
+										}
+									}//End SWING is still swing, otherwise should just accumulate what it had
+
+									//Don't get added in as part of "normal swing" routine
+									if ((bus[indexer].type == 0) || ((bus[indexer].type>1) && (bus[indexer].swing_functions_enabled == false)))
+									{
+										//See what kind of triplex we are
+										if ((bus[indexer].phases & 0x20) == 0x20)	//SPCT "exception"
+										{
+											//Add these into the system - added because "generation" - assumption is it is a flow between 1 and 2
+											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] -= bus[indexer].DynCurrent[0].Re();		//Phase 1
+											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] += bus[indexer].DynCurrent[0].Re();	//Phase 2
+
+											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] -= bus[indexer].DynCurrent[0].Im();		//Phase 1
+											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] += bus[indexer].DynCurrent[0].Im();	//Phase 2
+										}
+										else	//Standard triplex
+										{
+											//Add these into the system - added because "generation" - assumption is it is a flow between 1 and 2
+											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[0].Re();		//Phase 1
+											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] -= bus[indexer].DynCurrent[0].Re();	//Phase 2
+
+											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[0].Im();		//Phase 1
+											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] -= bus[indexer].DynCurrent[0].Im();	//Phase 2
+										}
+									}
+									//Defaulted else - leave as they were
 								}
-								else if ((branch[jindexer].phases & 0x07) == 0x06)	//AB
+								else if ((bus[indexer].phases & 0x07) != 0x00)	//Some type of phasing
 								{
-									temp_index_b = 0;
+									//SWING update functionality is not in here, just "normal"
+									//Don't get added in as part of "normal swing" routine
+									if (bus[indexer].type == 0)	//"SWING not a SWING" was here, but given the exception to being a SWING, it isn't needed here
+									{
+										//Figure out "where/what" to add
+										//Case it out by phases
+										switch (bus[indexer].phases & 0x07)	{
+											case 0x01:	//C
+												{
+													//Add these into the system - added because "generation"
+													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[2].Re();		//Phase C
+													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[2].Im();		//Phase C
+													break;
+												}//end 0x01
+											case 0x02:	//B
+												{
+													//Add these into the system - added because "generation"
+													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[1].Re();		//Phase B
+													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[1].Im();		//Phase B
+													break;
+												}
+											case 0x03:	//BC
+												{
+													//Add these into the system - added because "generation"
+													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[1].Re();		//Phase C
+													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] += bus[indexer].DynCurrent[2].Re();	//Phase C
+
+													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[1].Im();		//Phase B
+													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] += bus[indexer].DynCurrent[2].Im();	//Phase C
+													break;
+												}
+											case 0x04:	//A
+												{
+													//Add these into the system - added because "generation"
+													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[0].Re();		//Phase A
+													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[0].Im();		//Phase A
+													break;
+												}
+											case 0x05:	//AC
+												{
+													//Add these into the system - added because "generation"
+													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[0].Re();		//Phase A
+													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] += bus[indexer].DynCurrent[2].Re();	//Phase C
+
+													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[0].Im();		//Phase A
+													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] += bus[indexer].DynCurrent[2].Im();	//Phase C
+													break;
+												}
+											case 0x06:	//AB
+												{
+													//Add these into the system - added because "generation"
+													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[0].Re();		//Phase A
+													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] += bus[indexer].DynCurrent[1].Re();	//Phase B
+
+													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[0].Im();		//Phase A
+													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] += bus[indexer].DynCurrent[1].Im();	//Phase B
+
+													break;
+												}
+											default:	//Don't need an ABC or anything - how would we get here!?!
+												{
+													//Error for good measure
+													GL_THROW("NR: A Norton-equivalent generator had an odd phase combination");
+													/*  TROUBLESHOOT
+													A Norton-equivalent generator attempted to interface via an unknow phase configuration.  Please try again.  If the error
+													persists, please submit your code and a bug report via the ticking/issues system.
+													*/
+												}
+										}//End switch/case
+									}
+									//Defaulted else - leave as they were - some other bustype
 								}
-								else
+								else	//Not any of the above
 								{
-									GL_THROW("NR: One of the lines has invalid phase parameters");
+									//See if we ever were (reliability call)
+									if ((bus[indexer].origphases & 0x80) == 0x80)
+									{
+										//Zero the only one that should be being used
+										bus[indexer].DynCurrent[0] = complex(0.0,0.0);
+									}
+									else if ((bus[indexer].origphases & 0x07) != 0x00)	//Non-zero original phases, s just zero all
+									{
+										//Just zero it
+										bus[indexer].DynCurrent[0] = complex(0.0,0.0);
+										bus[indexer].DynCurrent[1] = complex(0.0,0.0);
+										bus[indexer].DynCurrent[2] = complex(0.0,0.0);
+									}
+									else	//Never was, just fail out
+									{
+										//Not sure how we ever reach this error check now - leaving for posterity
+										GL_THROW("NR_solver: bus:%s has tried updating deltamode dynamics, but is not three-phase, single-phase, or triplex!",bus[indexer].name);
+										/*  TROUBLESHOOT
+										The NR_solver routine tried update a three-phase current value for a bus that is not
+										a supported phase configuration.  At this time, the deltamode system only supports three-phase,
+										single-phase, and triplex-conected buses for Norton-equivalent generator attachment.
+										*/
+									}
 								}
-								break;
-							}//end 0x06
-						case 0x07:	//ABC
+							}//End Norton-equivalent call
+							else	//Must be another generator
 							{
-								temp_size_b = 3;	//Size of this matrix's admittance
-								if ((branch[jindexer].phases & 0x07) == 0x01)	//C
-								{
-									temp_index_b = 2;		//offset
-								}
-								else if ((branch[jindexer].phases & 0x07) == 0x02)	//B
-								{
-									temp_index_b = 1;		//offset
-								}
-								else if ((branch[jindexer].phases & 0x07) == 0x03)	//BC
-								{
-									temp_index_b = 1;
-								}
-								else if ((branch[jindexer].phases & 0x07) == 0x04)	//A
-								{
-									temp_index_b = 0;		//offset
-								}
-								else if ((branch[jindexer].phases & 0x07) == 0x05)	//AC
-								{
-									temp_index_b = 0;
-									Full_Mat_B = true;		//Flag so we know C needs to be gapped
-								}
-								else if ((branch[jindexer].phases & 0x07) == 0x06)	//AB
-								{
-									temp_index_b = 0;
-								}
-								else
+								//Replicate the injection from above -- assume three-phase right now
+								//Don't get added in as part of "normal swing" routine
+								if ((bus[indexer].type == 0) || ((bus[indexer].type>1) && (bus[indexer].swing_functions_enabled == false)))
 								{
-									GL_THROW("NR: One of the lines has invalid phase parameters");
+									//Check for three-phase
+									if ((bus[indexer].phases & 0x07) == 0x07)
+									{
+										//Add these into the system - added because "generation"
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[0].Re();		//Phase A
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] += bus[indexer].DynCurrent[1].Re();	//Phase B
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 2] += bus[indexer].DynCurrent[2].Re();	//Phase C
+
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[0].Im();		//Phase A
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] += bus[indexer].DynCurrent[1].Im();	//Phase B
+										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 2] += bus[indexer].DynCurrent[2].Im();	//Phase C
+									}
+									else if ((bus[indexer].phases & 0x80) == 0x80)
+									{
+										//Add these into the system - added because "generation"
+										//Assume is a 1-2 connection (1 flowing into 2)
+
+										//See what kind of triplex we are
+										if ((bus[indexer].phases & 0x20) == 0x20) //SPCT "special"
+										{
+											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] -= bus[indexer].DynCurrent[0].Re();		//Phase 1
+											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] += bus[indexer].DynCurrent[0].Re();	//Phase 2
+
+											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] -= bus[indexer].DynCurrent[0].Im();		//Phase 1
+											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] += bus[indexer].DynCurrent[0].Im();	//Phase 2
+										}
+										else	//"Standard"
+										{
+											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[0].Re();		//Phase 1
+											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] -= bus[indexer].DynCurrent[0].Re();	//Phase 2
+
+											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[0].Im();		//Phase 1
+											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] -= bus[indexer].DynCurrent[0].Im();	//Phase 2
+										}
+									}
+									else if ((bus[indexer].phases & 0x07) != 0x00)	//It has something on it
+										{
+										//SWING update functionality is not in here, just "normal"
+										//Don't get added in as part of "normal swing" routine
+										if (bus[indexer].type == 0)	//"SWING not a SWING" was here, but given the exception to being a SWING, it isn't needed here
+										{
+											//Figure out "where/what" to add
+											//Case it out by phases
+											switch (bus[indexer].phases & 0x07)	{
+												case 0x01:	//C
+													{
+														//Add these into the system - added because "generation"
+														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[2].Re();		//Phase C
+														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[2].Im();		//Phase C
+														break;
+													}//end 0x01
+												case 0x02:	//B
+													{
+														//Add these into the system - added because "generation"
+														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[1].Re();		//Phase B
+														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[1].Im();		//Phase B
+														break;
+													}
+												case 0x03:	//BC
+													{
+														//Add these into the system - added because "generation"
+														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[1].Re();		//Phase C
+														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] += bus[indexer].DynCurrent[2].Re();	//Phase C
+
+														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[1].Im();		//Phase B
+														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] += bus[indexer].DynCurrent[2].Im();	//Phase C
+														break;
+													}
+												case 0x04:	//A
+													{
+														//Add these into the system - added because "generation"
+														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[0].Re();		//Phase A
+														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[0].Im();		//Phase A
+														break;
+													}
+												case 0x05:	//AC
+													{
+														//Add these into the system - added because "generation"
+														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[0].Re();		//Phase A
+														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] += bus[indexer].DynCurrent[2].Re();	//Phase C
+
+														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[0].Im();		//Phase A
+														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] += bus[indexer].DynCurrent[2].Im();	//Phase C
+														break;
+													}
+												case 0x06:	//AB
+													{
+														//Add these into the system - added because "generation"
+														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[0].Re();		//Phase A
+														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] += bus[indexer].DynCurrent[1].Re();	//Phase B
+
+														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[0].Im();		//Phase A
+														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] += bus[indexer].DynCurrent[1].Im();	//Phase B
+
+														break;
+													}
+												default:	//Don't need an ABC or anything - how would we get here!?!
+													{
+														//Error for good measure
+														GL_THROW("NR: A Norton-equivalent generator had an odd phase combination");
+														//Defined above
+													}
+											}//End switch/case
+										}
+										//Defaulted else - leave as they were - some other bustype
+
+									}
+									//Default else - should probably just be zero anyways
 								}
-								break;
-							}//end 0x07
-						default:
+								//Defaulted else - leave as they were - if it is still a swing, this is all moot anyways
+							}//End other generator delta call
+						}//End extra current adds
+					}//End dynamic (generator postings)
+				}//End part of this island check
+				//Default else -- not in this island, so skip us!
+			}//End delta_I for each bus
+
+			//Linearized screening - check the current mismatch left by the linear update against the Jacobian it came from
+			//A bus phase passes when its mismatch is below the current its self-admittance would draw across maximum_voltage_error
+			linear_verified = false;
+
+			if ((matrix_solver_method==MM_SUPERLU) && (curr_island_superLU_vars->linear_check == true))
+			{
+				curr_island_superLU_vars->linear_check = false;
+
+				//Only the iteration right after the update (a failed solve can leave the flag behind)
+				linear_verified = (powerflow_values->island_matrix_values[island_loop_index].iteration_count > 0);
+
+				for (indexer=0; ((indexer<bus_count) && (linear_verified == true)); indexer++)
+				{
+					//Same buses the voltage update applies to
+					if ((bus[indexer].island_number == island_loop_index) && ((bus[indexer].type == 0) || ((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == false))))
+					{
+						for (jindex=0; jindex<powerflow_values->BA_diag[indexer].size; jindex++)
+						{
+							linear_mismatch_tol = bus[indexer].max_volt_error * powerflow_values->BA_diag[indexer].Y[jindex][jindex].Mag();
+
+							if (complex(powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size+jindex],powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+jindex]).Mag() > linear_mismatch_tol)
 							{
+								linear_verified = false;
 								break;
 							}
-					}//End switch/case for to
-
-					//Make sure everything was set before proceeding
-					if ( (temp_index==-1) || (temp_index_b==-1) || (temp_size==-1) || (temp_size_b==-1) || (temp_size_c==-1))
-					{
-						GL_THROW("NR: Failure to construct single/double phase line indices");
-						/*  TROUBLESHOOT
-						A single or double phase line (e.g., just A or AB) has failed to properly initialize all of the indices
-						necessary to form the admittance matrix.  Please submit a bug report, with your code, to the trac site.
-						*/
+						}
 					}
+				}
+
+				//Too far off - factor the Jacobian again and finish with a full solution
+				if ((linear_verified == false) && (powerflow_values->island_matrix_values[island_loop_index].iteration_count > 0))
+				{
+					curr_island_superLU_vars->refactor_needed = true;
+					NR_linear_fallback_count++;
+				}
+			}
+
+			//Call the load subfunction - flag for Jacobian update
+			compute_load_values(bus_count,bus,powerflow_values,true,island_loop_index);
+
+			//Build the dynamic diagonal elements of 6n*6n Y matrix. All the elements in this part will be updated at each iteration.
+
+			//Reset it
+			powerflow_values->island_matrix_values[island_loop_index].size_diag_update = 0;
+
+			//Adjust it
+			for (jindexer=0; jindexer<bus_count;jindexer++) 
+			{
+				//Check our relevance to this matrix
+				if (bus[jindexer].island_number == island_loop_index)
+				{
+					if  (bus[jindexer].type != 1)	//PV bus ignored (for now?)
+						powerflow_values->island_matrix_values[island_loop_index].size_diag_update += powerflow_values->BA_diag[jindexer].size; 
+					//Defaulted else - PV bus ignored
+				}
+				//Default else -- different island, skip for now
+			}
+			
+			if (powerflow_values->island_matrix_values[island_loop_index].Y_diag_update == NULL)
+			{
+				powerflow_values->island_matrix_values[island_loop_index].Y_diag_update = (Y_NR *)gl_malloc((4*powerflow_values->island_matrix_values[island_loop_index].size_diag_update) *sizeof(Y_NR));   //powerflow_values->island_matrix_values[island_loop_index].Y_diag_update store the row,column and value of the dynamic part of the diagonal PQ bus elements of 6n*6n Y_NR matrix.
+
+				//Make sure it worked
+				if (powerflow_values->island_matrix_values[island_loop_index].Y_diag_update == NULL)
+					GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
+
+				//Update maximum size
+				powerflow_values->island_matrix_values[island_loop_index].max_size_diag_update = powerflow_values->island_matrix_values[island_loop_index].size_diag_update;
+			}
+			else if (powerflow_values->island_matrix_values[island_loop_index].size_diag_update > powerflow_values->island_matrix_values[island_loop_index].max_size_diag_update)	//We've exceeded our limits
+			{
+				//Disappear the old one
+				gl_free(powerflow_values->island_matrix_values[island_loop_index].Y_diag_update);
+
+				//Make a new one in its image
+				powerflow_values->island_matrix_values[island_loop_index].Y_diag_update = (Y_NR *)gl_malloc((4*powerflow_values->island_matrix_values[island_loop_index].size_diag_update) *sizeof(Y_NR));
 
-					if (Full_Mat_A)	//From side is a full ABC and we have AC
-					{
-						for ( jindex = 0 ; jindex < temp_size_c ; jindex++ )		//Loop through rows of admittance matrices				
-						{
-							for ( kindex = 0 ; kindex < temp_size_c ; kindex++ )	//Loop through columns of admittance matrices
-							{
-								//Indices counted out from Self admittance above.  needs doubling due to complex separation
-								if ((Temp_Ad_A[jindex][kindex].Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From imags
-								{
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex*2;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_A[jindex][kindex].Im());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-									
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex*2 + temp_size;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex + temp_size_b;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (Temp_Ad_A[jindex][kindex].Im());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-								}
+				//Make sure it worked
+				if (powerflow_values->island_matrix_values[island_loop_index].Y_diag_update == NULL)
+					GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
 
-								if ((Temp_Ad_B[jindex][kindex].Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To imags
-								{
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex*2;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_B[jindex][kindex].Im());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-									
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex + temp_size_b;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex*2 + temp_size;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = Temp_Ad_B[jindex][kindex].Im();
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-								}
+				//Update the size
+				powerflow_values->island_matrix_values[island_loop_index].max_size_diag_update = powerflow_values->island_matrix_values[island_loop_index].size_diag_update;
 
-								if ((Temp_Ad_A[jindex][kindex].Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From reals
-								{
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex*2 + temp_size;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_A[jindex][kindex].Re());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-									
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex*2;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex + temp_size_b;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_A[jindex][kindex].Re());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
-								}
+				//Flag for a realloc
+				powerflow_values->island_matrix_values[island_loop_index].NR_realloc_needed = true;
+			}
 
-								if ((Temp_Ad_B[jindex][kindex].Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To reals
-								{
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex + temp_size_b;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex*2;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_B[jindex][kindex].Re());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-									
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex*2 + temp_size;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_B[jindex][kindex].Re());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
-								}
-							}//column end
-						}//row end
-					}//end full ABC for from AC
+			indexer = 0;	//Rest positional counter
 
-					if (Full_Mat_B)	//To side is a full ABC and we have AC
+			for ( jindexer = 0 ; jindexer < bus_count ; jindexer++ )	//Parse through bus list
+			{
+				//See if we're part of the currently progressing island -- if not, skip us
+				if (bus[jindexer].island_number == island_loop_index)
+				{
+					if ((bus[jindexer].type > 1) && (bus[jindexer].swing_functions_enabled == true))	//Swing bus - and we aren't ignoring it
 					{
-						for (jindex=0; jindex<temp_size_c; jindex++)		//Loop through rows of admittance matrices				
+						for ( jindex = 0 ; jindex < powerflow_values->BA_diag[jindexer].size ; jindex++ )
 						{
-							for (kindex=0; kindex<temp_size_c; kindex++)	//Loop through columns of admittance matrices
-							{
-								//Indices counted out from Self admittance above.  needs doubling due to complex separation
-								if ((Temp_Ad_A[jindex][kindex].Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From imags
-								{
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex*2;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_A[jindex][kindex].Im());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-									
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex + temp_size;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex*2 + temp_size_b;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (Temp_Ad_A[jindex][kindex].Im());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-								}
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind = 2*bus[jindexer].Matrix_Loc + jindex;
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].col_ind = powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind;
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].Y_value = 1e10; // swing bus gets large admittance
+							indexer += 1;
 
-								if ((Temp_Ad_B[jindex][kindex].Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To imags
-								{
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex*2;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_B[jindex][kindex].Im());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-									
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex*2 + temp_size_b;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex + temp_size;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = Temp_Ad_B[jindex][kindex].Im();
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-								}
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind = 2*bus[jindexer].Matrix_Loc + jindex;
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].col_ind = powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind + powerflow_values->BA_diag[jindexer].size;
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].Y_value = (powerflow_values->BA_diag[jindexer].Y[jindex][jindex]).Re();	//Normal admittance portion
+							indexer += 1;
 
-								if ((Temp_Ad_A[jindex][kindex].Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From reals
-								{
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex + temp_size;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex*2;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_A[jindex][kindex].Re());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-									
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex*2 + temp_size_b;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_A[jindex][kindex].Re());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
-								}
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind = 2*bus[jindexer].Matrix_Loc + jindex + powerflow_values->BA_diag[jindexer].size;
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].col_ind = powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind - powerflow_values->BA_diag[jindexer].size;
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].Y_value = (powerflow_values->BA_diag[jindexer].Y[jindex][jindex]).Re();	//Normal admittance portion
+							indexer += 1;
 
-								if ((Temp_Ad_B[jindex][kindex].Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To reals
-								{
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex*2 + temp_size_b;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_B[jindex][kindex].Re());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-									
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex*2;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex + temp_size;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_B[jindex][kindex].Re());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
-								}
-							}//column end
-						}//row end
-					}//end full ABC for to AC
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind = 2*bus[jindexer].Matrix_Loc + jindex + powerflow_values->BA_diag[jindexer].size;
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].col_ind = powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind;
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].Y_value = 1e10; // swing bus gets large admittance
+							indexer += 1;
+						}//End swing bus traversion
+					}//End swing bus
 
-					if ((!Full_Mat_A) && (!Full_Mat_B))	//Neither is a full ABC, or we aren't doing AC, so we don't care
+					if ((bus[jindexer].type == 0) || ((bus[jindexer].type > 1) && bus[jindexer].swing_functions_enabled == false))	//Only do on PQ (or SWING masquerading as PQ)
 					{
-						for (jindex=0; jindex<temp_size_c; jindex++)		//Loop through rows of admittance matrices				
+						for ( jindex = 0 ; jindex < powerflow_values->BA_diag[jindexer].size ; jindex++ )
 						{
-							for (kindex=0; kindex<temp_size_c; kindex++)	//Loop through columns of admittance matrices
-							{
-								//Indices counted out from Self admittance above.  needs doubling due to complex separation
-								if ((Temp_Ad_A[jindex][kindex].Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From imags
-								{
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_A[jindex][kindex].Im());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-									
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex + temp_size;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex + temp_size_b;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (Temp_Ad_A[jindex][kindex].Im());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-								}
-
-								if ((Temp_Ad_B[jindex][kindex].Im() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To imags
-								{
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_B[jindex][kindex].Im());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-									
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex + temp_size_b;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex + temp_size;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = Temp_Ad_B[jindex][kindex].Im();
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-								}
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind = 2*bus[jindexer].Matrix_Loc + jindex;
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].col_ind = powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind;
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].Y_value = (powerflow_values->BA_diag[jindexer].Y[jindex][jindex]).Im() + bus[jindexer].Jacob_A[jindex]; // Equation(14)
+							indexer += 1;
+							
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind = 2*bus[jindexer].Matrix_Loc + jindex;
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].col_ind = powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind + powerflow_values->BA_diag[jindexer].size;
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].Y_value = (powerflow_values->BA_diag[jindexer].Y[jindex][jindex]).Re() + bus[jindexer].Jacob_B[jindex]; // Equation(15)
+							indexer += 1;
+							
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind = 2*bus[jindexer].Matrix_Loc + jindex + powerflow_values->BA_diag[jindexer].size;
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].col_ind = 2*bus[jindexer].Matrix_Loc + jindex;
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].Y_value = (powerflow_values->BA_diag[jindexer].Y[jindex][jindex]).Re() + bus[jindexer].Jacob_C[jindex]; // Equation(16)
+							indexer += 1;
+							
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind = 2*bus[jindexer].Matrix_Loc + jindex + powerflow_values->BA_diag[jindexer].size;
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].col_ind = powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind;
+							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].Y_value = -(powerflow_values->BA_diag[jindexer].Y[jindex][jindex]).Im() + bus[jindexer].Jacob_D[jindex]; // Equation(17)
+							indexer += 1;
+						}//end PQ phase traversion
+					}//End PQ bus
+				}//End island relevance check
+			}//End bus parse list
 
-								if ((Temp_Ad_A[jindex][kindex].Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//From reals
-								{
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex + temp_size;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_A[jindex][kindex].Re());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-									
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempa].Matrix_Loc + temp_index + jindex;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + kindex + temp_size_b;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_A[jindex][kindex].Re());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
-								}
+			// Build the Amatrix, Amatrix includes all the elements of Y_offdiag_PQ, Y_diag_fixed and Y_diag_update.
+			powerflow_values->island_matrix_values[island_loop_index].size_Amatrix = powerflow_values->island_matrix_values[island_loop_index].size_offdiag_PQ*2 + powerflow_values->island_matrix_values[island_loop_index].size_diag_fixed*2 + 4*powerflow_values->island_matrix_values[island_loop_index].size_diag_update;
 
-								if ((Temp_Ad_B[jindex][kindex].Re() != 0) && (bus[tempa].type != 1) && (bus[tempb].type != 1))	//To reals
-								{
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex + temp_size_b;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_B[jindex][kindex].Re());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-									
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*bus[tempb].Matrix_Loc + temp_index_b + jindex;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*bus[tempa].Matrix_Loc + temp_index + kindex + temp_size;
-									powerflow_values->island_matrix_values[island_index_val].Y_offdiag_PQ[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(Temp_Ad_B[jindex][kindex].Re());
-									powerflow_values->island_matrix_values[island_index_val].indexer += 1;	
-								}
-							}//column end
-						}//row end
-					}//end not full ABC with AC on either side case
-				}//end all others else
-			}//end branch for
+			//Test to make sure it isn't an empty matrix - reliability induced 3-phase fault
+			if (powerflow_values->island_matrix_values[island_loop_index].size_Amatrix==0)
+			{
+				//Figure out which message to send
+				if (NR_islands_detected > 1)
+				{
+					gl_warning("Empty powerflow connectivity matrix for island %d, your system is empty!",(island_loop_index+1));
+					/*  TROUBLESHOOT
+					Newton-Raphson has an empty admittance matrix that it is trying to solve.  Either the whole system
+					faulted, or something is not properly defined.  Please try again.  If the problem persists, please
+					submit your code and a bug report via the trac website.
+					*/
+				}
+				else	//Single island
+				{
+					gl_warning("Empty powerflow connectivity matrix, your system is empty!");
+					/*  TROUBLESHOOT
+					Newton-Raphson has an empty admittance matrix that it is trying to solve.  Either the whole system
+					faulted, or something is not properly defined.  Please try again.  If the problem persists, please
+					submit your code and a bug report via the trac website.
+					*/
+				}
 
-			//Loop through the islands
-			for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
-			{
-				//Build the fixed part of the diagonal PQ bus elements of 6n*6n Y_NR matrix. This part will not be updated at each iteration. 
-				powerflow_values->island_matrix_values[island_loop_index].size_diag_fixed = 0;
-			}
+				//Set our return code, like success
+				powerflow_values->island_matrix_values[island_loop_index].return_code = 0;
 
-			for (jindexer=0; jindexer<bus_count;jindexer++) 
-			{
-				if (bus[jindexer].island_number != -1)
+				//Figure out next steps - routine copied from the end of the iteration loop
+
+				//See if we need to continue
+				if (island_loop_index >= (NR_islands_detected - 1))	//We're the last one
+				{
+					//Set the flag to be done
+					still_iterating_islands = false;
+				}
+				else	//Not last -- increment the counter and onwards
 				{
-					//Pull the index
-					island_loop_index = bus[jindexer].island_number;
+					//Increment the counter
+					island_loop_index++;
 
-					//Loop through and get sizes
-					for (jindex=0; jindex<3; jindex++)
-					{
-						for (kindex=0; kindex<3; kindex++)
-						{		 
-							if ((powerflow_values->BA_diag[jindexer].Y[jindex][kindex]).Re() != 0 && bus[jindexer].type != 1 && jindex!=kindex)  
-								powerflow_values->island_matrix_values[island_loop_index].size_diag_fixed += 1; 
-							if ((powerflow_values->BA_diag[jindexer].Y[jindex][kindex]).Im() != 0 && bus[jindexer].type != 1 && jindex!=kindex) 
-								powerflow_values->island_matrix_values[island_loop_index].size_diag_fixed += 1; 
-						}
-					}
+					//Force the flag, just to be paranoid
+					still_iterating_islands = true;
 				}
-				//Default else -- nota  valid island anyways
+
+				//Continue the while (or attempt to do so)
+				continue;
 			}
 
-			//Loop through the islands again
-			for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
+			if (powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix == NULL)
 			{
-				if (powerflow_values->island_matrix_values[island_loop_index].Y_diag_fixed == NULL)
-				{
-					powerflow_values->island_matrix_values[island_loop_index].Y_diag_fixed = (Y_NR *)gl_malloc((powerflow_values->island_matrix_values[island_loop_index].size_diag_fixed*2) *sizeof(Y_NR));   //powerflow_values->island_matrix_values[island_loop_index].Y_diag_fixed store the row,column and value of the fixed part of the diagonal PQ bus elements of 6n*6n Y_NR matrix.
+				powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix = (SPARSE*) gl_malloc(sizeof(SPARSE));
 
-					//Make sure it worked
-					if (powerflow_values->island_matrix_values[island_loop_index].Y_diag_fixed == NULL)
-						GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
+				//Make sure it worked
+				if (powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix == NULL)
+					GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
 
-					//Update the max size
-					powerflow_values->island_matrix_values[island_loop_index].max_size_diag_fixed = powerflow_values->island_matrix_values[island_loop_index].size_diag_fixed;
-				}
-				else if (powerflow_values->island_matrix_values[island_loop_index].size_diag_fixed > powerflow_values->island_matrix_values[island_loop_index].max_size_diag_fixed)		//Something changed and we are bigger!!
-				{
-					//Destroy us!
-					gl_free(powerflow_values->island_matrix_values[island_loop_index].Y_diag_fixed);
+				//Initiliaze it
+				sparse_init(powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix, powerflow_values->island_matrix_values[island_loop_index].size_Amatrix, 6*powerflow_values->island_matrix_values[island_loop_index].bus_count);
+			}
+			else if (powerflow_values->island_matrix_values[island_loop_index].NR_realloc_needed)	//If one of the above changed, we changed too
+			{
+				//Destroy the old version
+				sparse_clear(powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix);
 
-					//Rebuild us, we have the technology
-					powerflow_values->island_matrix_values[island_loop_index].Y_diag_fixed = (Y_NR *)gl_malloc((powerflow_values->island_matrix_values[island_loop_index].size_diag_fixed*2) *sizeof(Y_NR));
+				//Create a new 
+				sparse_init(powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix, powerflow_values->island_matrix_values[island_loop_index].size_Amatrix, 6*powerflow_values->island_matrix_values[island_loop_index].bus_count);
+			}
+			else
+			{
+				//Just clear it out
+				sparse_reset(powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix, 6*powerflow_values->island_matrix_values[island_loop_index].bus_count);
+			}
 
-					//Make sure it worked
-					if (powerflow_values->island_matrix_values[island_loop_index].Y_diag_fixed == NULL)
-						GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
+			//integrate off diagonal components
+			for (indexer=0; indexer<powerflow_values->island_matrix_values[island_loop_index].size_offdiag_PQ*2; indexer++)
+			{
+				row = powerflow_values->island_matrix_values[island_loop_index].Y_offdiag_PQ[indexer].row_ind;
+				col = powerflow_values->island_matrix_values[island_loop_index].Y_offdiag_PQ[indexer].col_ind;
+				value = powerflow_values->island_matrix_values[island_loop_index].Y_offdiag_PQ[indexer].Y_value;
+				sparse_add(powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix, row, col, value, bus, bus_count, powerflow_values, island_loop_index);
+			}
 
-					//Store the new size
-					powerflow_values->island_matrix_values[island_loop_index].max_size_diag_fixed = powerflow_values->island_matrix_values[island_loop_index].size_diag_fixed;
+			//Integrate fixed portions of diagonal components
+			for (indexer=0; indexer< (powerflow_values->island_matrix_values[island_loop_index].size_diag_fixed*2); indexer++)
+			{
+				row = powerflow_values->island_matrix_values[island_loop_index].Y_diag_fixed[indexer].row_ind;
+				col = powerflow_values->island_matrix_values[island_loop_index].Y_diag_fixed[indexer].col_ind;
+				value = powerflow_values->island_matrix_values[island_loop_index].Y_diag_fixed[indexer].Y_value;
+				sparse_add(powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix, row, col, value, bus, bus_count, powerflow_values, island_loop_index);
+			}
 
-					//Flag for a reallocation
-					powerflow_values->island_matrix_values[island_loop_index].NR_realloc_needed = true;
-				}
+			//Integrate the variable portions of the diagonal components
+			for (indexer=0; indexer< (4*powerflow_values->island_matrix_values[island_loop_index].size_diag_update); indexer++)
+			{
+				row = powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind;
+				col = powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].col_ind;
+				value = powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].Y_value;
+				sparse_add(powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix, row, col, value, bus, bus_count, powerflow_values, island_loop_index);
+			}
 
-				//Zero the accumulator for the next section, while we're in here
-				powerflow_values->island_matrix_values[island_loop_index].indexer = 0;
-			}//End island loop routine
+			//See if we want to dump out the matrix values
+			if (NRMatDumpMethod != MD_NONE)
+			{
+				//Code to export the sparse matrix values - useful for debugging issues
 
-			for (jindexer=0; jindexer<bus_count;jindexer++)	//Parse through bus list
-			{ 
-				//Extract our island reference
-				island_index_val = bus[jindexer].island_number;
+				//Reset the flag
+				something_has_been_output = false;
 
-				//If we're unallocated, just skip us
-				if (island_index_val == -1)
+				//Check our frequency
+				if ((NRMatDumpMethod == MD_ALL) || ((NRMatDumpMethod != MD_ALL) && (powerflow_values->island_matrix_values[island_loop_index].iteration_count == 0)))
 				{
-					continue;
-				}
-				//Default else -- proceed
+					//Open the text file - append now
+					FPoutVal=fopen(MDFileName,"at");
 
-				for ( jindex = 0 ; jindex < powerflow_values->BA_diag[jindexer].size ; jindex++ )
-				{
-					for ( kindex = 0 ; kindex < powerflow_values->BA_diag[jindexer].size ; kindex++ )
-					{					
-						if ((powerflow_values->BA_diag[jindexer].Y[jindex][kindex]).Im() != 0 && bus[jindexer].type != 1 && jindex!=kindex)
+					//See if we wanted references - Only do this once per call, regardless (keeps file size down)
+					if ((NRMatReferences == true) && (powerflow_values->island_matrix_values[island_loop_index].iteration_count == 0))
+					{
+						//Print the index information
+						if (NR_islands_detected > 1)
 						{
-							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*powerflow_values->BA_diag[jindexer].row_ind + jindex;
-							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*powerflow_values->BA_diag[jindexer].col_ind + kindex;
-							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (powerflow_values->BA_diag[jindexer].Y[jindex][kindex]).Im();
-							powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-
-							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*powerflow_values->BA_diag[jindexer].row_ind + jindex +powerflow_values->BA_diag[jindexer].size;
-							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*powerflow_values->BA_diag[jindexer].col_ind + kindex +powerflow_values->BA_diag[jindexer].size;
-							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = -(powerflow_values->BA_diag[jindexer].Y[jindex][kindex]).Im();
-							powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+							fprintf(FPoutVal,"Matrix Index information for this call in island:%d - start,stop,name\n",(island_loop_index+1));
+						}
+						else
+						{
+							fprintf(FPoutVal,"Matrix Index information for this call - start,stop,name\n");
 						}
 
-						if ((powerflow_values->BA_diag[jindexer].Y[jindex][kindex]).Re() != 0 && bus[jindexer].type != 1 && jindex!=kindex)
+						for (indexer=0; indexer<bus_count; indexer++)
 						{
-							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*powerflow_values->BA_diag[jindexer].row_ind + jindex;
-							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*powerflow_values->BA_diag[jindexer].col_ind + kindex +powerflow_values->BA_diag[jindexer].size;
-							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (powerflow_values->BA_diag[jindexer].Y[jindex][kindex]).Re();
-							powerflow_values->island_matrix_values[island_index_val].indexer += 1;
-							
-							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].row_ind = 2*powerflow_values->BA_diag[jindexer].row_ind + jindex +powerflow_values->BA_diag[jindexer].size;
-							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].col_ind = 2*powerflow_values->BA_diag[jindexer].col_ind + kindex;
-							powerflow_values->island_matrix_values[island_index_val].Y_diag_fixed[powerflow_values->island_matrix_values[island_index_val].indexer].Y_value = (powerflow_values->BA_diag[jindexer].Y[jindex][kindex]).Re();
-							powerflow_values->island_matrix_values[island_index_val].indexer += 1;
+							//Island check
+							if (bus[indexer].island_number == island_loop_index)
+							{
+								//Extract the start/stop indices
+								jindexer = 2*bus[indexer].Matrix_Loc;
+								kindexer = jindexer + 2*powerflow_values->BA_diag[indexer].size - 1;
+
+								//Print them out
+								fprintf(FPoutVal,"%d,%d,%s\n",jindexer,kindexer,bus[indexer].name);
+
+								//Set the flag
+								something_has_been_output = true;
+							}//End island check
 						}
+
+						//Add in a blank line so it looks pretty
+						fprintf(FPoutVal,"\n");
+					}//End print the references
+
+					//Print the simulation time and iteration number - see how we're running
+					if (deltatimestep_running == -1)	//QSTS
+					{
+						fprintf(FPoutVal,"Timestamp: %lld - Iteration %lld\n",gl_globalclock,powerflow_values->island_matrix_values[island_loop_index].iteration_count);
+					}
+					else
+					{
+						fprintf(FPoutVal,"Timestamp: %f (deltamode) - Iteration %lld\n",gl_globaldeltaclock,powerflow_values->island_matrix_values[island_loop_index].iteration_count);
 					}
-				}
-			}//End bus parse for fixed diagonal
-		}//End admittance update
 
-		//Loop through each island to reset these flags
-		for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
-		{
-			//Reset saturation checks
-			powerflow_values->island_matrix_values[island_loop_index].SaturationMismatchPresent = false;
+					//See if anything wrote out, or we're "all"
+					if ((something_has_been_output == true) || (NRMatDumpMethod == MD_ALL))
+					{
+						//Print size - for parsing ease
+						fprintf(FPoutVal,"Matrix Information - non-zero element count = %d\n",powerflow_values->island_matrix_values[island_loop_index].size_Amatrix);
+						
+						//Print the values - printed as "row index, column index, value"
+						//This particular output is after they have been column sorted for the algorithm
+						//Header
+						fprintf(FPoutVal,"Matrix Information - row, column, value\n");
 
-			//Reset the iteration counters
-			powerflow_values->island_matrix_values[island_loop_index].iteration_count = 0;
-		}
+						//Null temp variable
+						temp_element = NULL;
 
-		//Reset the global flag for iterations on islands -- will be set at the end
-		still_iterating_islands = true;
+						//Loop through the columns, extracting starting point each time
+						for (jindexer=0; jindexer<powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix->ncols; jindexer++)
+						{
+							//Extract the column starting point
+							temp_element = powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix->cols[jindexer];
 
-		//Also reset island index
-		island_loop_index = 0;
+							//Check for nulling
+							if (temp_element != NULL)
+							{
+								//Print this value
+								fprintf(FPoutVal,"%d,%d,%f\n",temp_element->row_ind,jindexer,temp_element->value);
 
-		//While it - loop through until we solve the issue
-		while (still_iterating_islands == true)
-		{
-			//Map the superLU variables each time -- just easier to do it always
-			if (matrix_solver_method==MM_SUPERLU)
-			{
-				//Put the void pointer into a local context
-				curr_island_superLU_vars = (SUPERLU_NR_vars *)powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars;
-			}
+								//Loop
+								while (temp_element->next != NULL)
+								{
+									//Get next element
+									temp_element = temp_element->next;
 
-			//Call the load subfunction
-			compute_load_values(bus_count,bus,powerflow_values,false,island_loop_index);
-		
-			// Calculate the mismatch of three phase current injection at each bus (deltaI), 
-			//and store the deltaI in terms of real and reactive value in array powerflow_values->island_matrix_values[island_loop_index].deltaI_NR    
-			if (powerflow_values->island_matrix_values[island_loop_index].deltaI_NR==NULL)
-			{
-				powerflow_values->island_matrix_values[island_loop_index].deltaI_NR = (double *)gl_malloc((2*powerflow_values->island_matrix_values[island_loop_index].total_variables) *sizeof(double));   // left_hand side of equation (11)
+									//Repeat the print
+									fprintf(FPoutVal,"%d,%d,%f\n",temp_element->row_ind,jindexer,temp_element->value);
+								}
+							}
+							//If it is null, go next.  Implies we have an invalid matrix size, but that may be what we're looking for
+						}//End sparse matrix traversion for dump
 
-				//Make sure it worked
-				if (powerflow_values->island_matrix_values[island_loop_index].deltaI_NR == NULL)
-					GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
+						//Print an extra line, so it looks nice for ALL/PERCALL
+						fprintf(FPoutVal,"\n");
 
-				//Update the max size
-				powerflow_values->island_matrix_values[island_loop_index].max_total_variables = powerflow_values->island_matrix_values[island_loop_index].total_variables;
-			}
-			else if (powerflow_values->island_matrix_values[island_loop_index].NR_realloc_needed)		//Bigger sized (this was checked above)
-			{
-				//Decimate the existing value
-				gl_free(powerflow_values->island_matrix_values[island_loop_index].deltaI_NR);
+						//Output the RHS information, if desired
+						if (NRMatRHSDump == true)
+						{
+							//Get the output size - double size, due to complex separation
+							m = 2*powerflow_values->island_matrix_values[island_loop_index].total_variables;
+
+							//Print the size - should be the matrix size, but put here for ease of use
+							fprintf(FPoutVal,"Matrix RHS Information - %d elements\n",m);
+
+							//Print a header - row information isn't really needed, but include, just for ease of viewing
+							fprintf(FPoutVal,"RHS Information - row, value\n");
+
+							//Loop through and output the RHS values
+							for (jindexer=0; jindexer<m; jindexer++)
+							{
+								fprintf(FPoutVal,"%d,%f\n",jindexer,powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[jindexer]);
+							}//End output RHS
 
-				//Reallocate it...bigger...faster...stronger!
-				powerflow_values->island_matrix_values[island_loop_index].deltaI_NR = (double *)gl_malloc((2*powerflow_values->island_matrix_values[island_loop_index].total_variables) *sizeof(double));
+							//Print an extra line, just for spacing for ALL/PERCALL
+							fprintf(FPoutVal,"\n");
+						}//end RHS dump, if desired
+					}
+					else //Nothing written - indicate as much
+					{
+						//Print the emptiness
+						fprintf(FPoutVal,"Empty island (possibly powerflow-removed)\n\n");
+					}
 
-				//Make sure it worked
-				if (powerflow_values->island_matrix_values[island_loop_index].deltaI_NR == NULL)
-					GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
+					//Close the file, we're done with it
+					fclose(FPoutVal);
 
-				//Store the updated value
-				powerflow_values->island_matrix_values[island_loop_index].max_total_variables = powerflow_values->island_matrix_values[island_loop_index].total_variables;
-			}
+					//See if we were a "ONCE" - if so, deflag us
+					if (NRMatDumpMethod == MD_ONCE)
+					{
+						//See if we're a multi-island -- if so, only do this on the last one
+						if (NR_islands_detected > 1)
+						{
+							//See if we're the last one
+							if (island_loop_index >= (NR_islands_detected - 1))
+							{
+								NRMatDumpMethod = MD_NONE;	//Flag to do no more
+							}
+							//Default else -- we're not the last one, so stay as MD_ONCE
+						}
+						else
+						{
+							NRMatDumpMethod = MD_NONE;	//Flag to do no more
+						}
+					}
+				}//End Actual output
+			}//End matrix dump desired
 
-			//If we're in PF_DYNINIT mode, initialize the balancing convergence
-			if (powerflow_type == PF_DYNINIT)
-			{
-				powerflow_values->island_matrix_values[island_loop_index].swing_converged = true;	//init it to yes, fail by exception, not default
-			}
+			///* Initialize parameters. */
+			m = 2*powerflow_values->island_matrix_values[island_loop_index].total_variables;
+			n = 2*powerflow_values->island_matrix_values[island_loop_index].total_variables;
+			nnz = powerflow_values->island_matrix_values[island_loop_index].size_Amatrix;
 
-			//Compute the calculated loads (not specified) at each bus
-			for (indexer=0; indexer<bus_count; indexer++) //for specific bus k
+			if (powerflow_values->island_matrix_values[island_loop_index].matrices_LU.a_LU == NULL)	//First run
 			{
-				//Make sure the bus we're looking at is relevant to this island - otherwise, we can skip it
-				if (bus[indexer].island_number == island_loop_index)
+				/* Set aside space for the arrays. */
+				powerflow_values->island_matrix_values[island_loop_index].matrices_LU.a_LU = (double *) gl_malloc(nnz *sizeof(double));
+				if (powerflow_values->island_matrix_values[island_loop_index].matrices_LU.a_LU==NULL)
 				{
-					//Update for generator symmetry - only in static dynamic mode and when SWING is a SWING
-					if ((powerflow_type == PF_DYNINIT) && (powerflow_values->island_matrix_values[island_loop_index].swing_is_a_swing==true))
-					{
-						//Secondary check - see if it is even needed - basically built around 3-phase right now
-						//Initializes the Norton equivalent item -- normal generators shoudln't need this
-						if ((*bus[indexer].dynamics_enabled==true) && (bus[indexer].full_Y != NULL) && (bus[indexer].DynCurrent != NULL))
-						{
-							//See if we're three phase or triplex
-							if ((bus[indexer].phases & 0x07) == 0x07)
-							{
-								//Form denominator term of Ii, since it won't change
-								temp_complex_1 = (~bus[indexer].V[0]) + (~bus[indexer].V[1])*avalsq + (~bus[indexer].V[2])*aval;
-								
-								//Form up numerator portion that doesn't change (Q and admittance)
-								//Do in parts, just for readability
-								//Row 1 of admittance mult
-								temp_complex_0 = ~bus[indexer].V[0]*(bus[indexer].full_Y[0]*bus[indexer].V[0] + bus[indexer].full_Y[1]*bus[indexer].V[1] + bus[indexer].full_Y[2]*bus[indexer].V[2]);
+					GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
+					/*  TROUBLESHOOT
+					While attempting to allocate the memory for one of the SuperLU working matrices,
+					an error was encountered and it was not allocated.  Please try again.  If it fails
+					again, please submit your code and a bug report using the trac website.
+					*/
+				}
+				
+				powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rows_LU = (int *) gl_malloc(nnz *sizeof(int));
+				if (powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rows_LU == NULL)
+					GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
 
-								//Row 2 of admittance
-								temp_complex_0 += ~bus[indexer].V[1]*(bus[indexer].full_Y[3]*bus[indexer].V[0] + bus[indexer].full_Y[4]*bus[indexer].V[1] + bus[indexer].full_Y[5]*bus[indexer].V[2]);
+				powerflow_values->island_matrix_values[island_loop_index].matrices_LU.cols_LU = (int *) gl_malloc((n+1) *sizeof(int));
+				if (powerflow_values->island_matrix_values[island_loop_index].matrices_LU.cols_LU == NULL)
+					GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
 
-								//Row 3 of admittance
-								temp_complex_0 += ~bus[indexer].V[2]*(bus[indexer].full_Y[6]*bus[indexer].V[0] + bus[indexer].full_Y[7]*bus[indexer].V[1] + bus[indexer].full_Y[8]*bus[indexer].V[2]);
+				/* Create the right-hand side matrix B. */
+				powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rhs_LU = (double *) gl_malloc(m *sizeof(double));
+				if (powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rhs_LU == NULL)
+					GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
 
-								//Make the conjugate - used for individual phase accumulation later
-								temp_complex_3 = ~temp_complex_0;
+				if (matrix_solver_method==MM_SUPERLU)
+				{
+					///* Set up the arrays for the permutations. */
+					curr_island_superLU_vars->perm_r = (int *) gl_malloc(m *sizeof(int));
+					if (curr_island_superLU_vars->perm_r == NULL)
+						GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
 
-								//If we are a SWING, zero our PT portion and QT for accumulation
-								if (((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == true)) && (powerflow_values->island_matrix_values[island_loop_index].iteration_count>0))
-								{
-									*bus[indexer].PGenTotal = complex(0.0,0.0);
-								}
-							}
-							else if ((bus[indexer].phases & 0x80) == 0x80)	//Triplex
-							{
-								//Get the "delta voltage" for use here
-								temp_complex_4 = bus[indexer].V[0] + bus[indexer].V[1];
+					curr_island_superLU_vars->perm_c = (int *) gl_malloc(n *sizeof(int));
+					if (curr_island_superLU_vars->perm_c == NULL)
+						GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
 
-								//Form denominator term of Ii, since it won't change
-								temp_complex_1 = ~temp_complex_4;
-								
-								//Form up numerator portion that doesn't change (Q and admittance)
-								//Should just be a single entry, for "reasons/asssumptions"
-								temp_complex_0 = ~temp_complex_4*(bus[indexer].full_Y[0]*temp_complex_4);
+					//Set up storage pointers - single element, but need to be malloced for some reason
+					curr_island_superLU_vars->A_LU.Store = (void *)gl_malloc(sizeof(NCformat));
+					if (curr_island_superLU_vars->A_LU.Store == NULL)
+						GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
 
-								//Make the conjugate - used for individual phase accumulation later
-								temp_complex_3 = ~temp_complex_0;
+					curr_island_superLU_vars->B_LU.Store = (void *)gl_malloc(sizeof(DNformat));
+					if (curr_island_superLU_vars->B_LU.Store == NULL)
+						GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
 
-								//If we are a SWING, zero our PT portion and QT for accumulation
-								if (((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == true)) && (powerflow_values->island_matrix_values[island_loop_index].iteration_count>0))
-								{
-									*bus[indexer].PGenTotal = -temp_complex_3;	//Gets piecemeal removed from three-phase, just all at once here!
-								}
-							}
-							else if ((bus[indexer].phases & 0x07) == 0x00)	//No phases
-							{
-								temp_complex_1 = complex(0.0,0.0);
-								temp_complex_0 = complex(0.0,0.0);
-								temp_complex_3 = complex(0.0,0.0);
+					//Populate these structures - A_LU matrix
+					curr_island_superLU_vars->A_LU.Stype = SLU_NC;
+					curr_island_superLU_vars->A_LU.Dtype = SLU_D;
+					curr_island_superLU_vars->A_LU.Mtype = SLU_GE;
+					curr_island_superLU_vars->A_LU.nrow = n;
+					curr_island_superLU_vars->A_LU.ncol = m;
 
-								//If we are a SWING, zero our PT portion and QT for accumulation
-								if (((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == true)) && (powerflow_values->island_matrix_values[island_loop_index].iteration_count>0))
-								{
-									*bus[indexer].PGenTotal = complex(0.0,0.0);
-								}
-							}
-							//Default else - some other permutation, but not really supported (single-phase swing, or partial swing
-							
-							//numerator done, except PT portion (add in below - SWING bus is different
-						}
-						else	//Not enabled or not "full-Y-ed" - set to zero
-						{
-							temp_complex_0 = 0.0;
-							temp_complex_1 = 0.0;	//Basically a flag to ignore it
-						}
-					}//End PF_DYNINIT and SWING is still the same
+					//Populate these structures - B_LU matrix
+					curr_island_superLU_vars->B_LU.Stype = SLU_DN;
+					curr_island_superLU_vars->B_LU.Dtype = SLU_D;
+					curr_island_superLU_vars->B_LU.Mtype = SLU_GE;
+					curr_island_superLU_vars->B_LU.nrow = m;
+					curr_island_superLU_vars->B_LU.ncol = 1;
+				}
+				else if (matrix_solver_method == MM_EXTERN)	//External routine
+				{
+					//Run allocation routine
+					((void (*)(void *,unsigned int, unsigned int, bool))(LUSolverFcns.ext_alloc))(powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars,n,n,NR_admit_change);
+				}
+				else
+				{
+					GL_THROW("Invalid matrix solution method specified for NR solver!");
+					//Defined elsewhere
+				}
 
-					for ( jindex = 0 ; jindex < powerflow_values->BA_diag[indexer].size ; jindex++ ) // rows - for specific phase that exists
-					{
-						tempIcalcReal = tempIcalcImag = 0;   
+				//Update tracking variable
+				powerflow_values->island_matrix_values[island_loop_index].prev_m = m;
+			}
+			else if (powerflow_values->island_matrix_values[island_loop_index].NR_realloc_needed)	//Something changed, we'll just destroy everything and start over
+			{
+				//Get rid of all of them first
+				gl_free(powerflow_values->island_matrix_values[island_loop_index].matrices_LU.a_LU);
+				gl_free(powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rows_LU);
+				gl_free(powerflow_values->island_matrix_values[island_loop_index].matrices_LU.cols_LU);
+				gl_free(powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rhs_LU);
 
-						if ((bus[indexer].phases & 0x80) == 0x80)	//Split phase - triplex bus
-						{
-							//Two states of triplex bus - To node of SPCT transformer needs to be different
-							//First different - Delta-I and diagonal contributions
-							if ((bus[indexer].phases & 0x20) == 0x20)	//We're the To bus
-							{
-								//Pre-negated due to the nature of how it's calculated (V1 compared to I1)
-								tempPbus =  bus[indexer].PL[jindex];	//Copy load amounts in
-								tempQbus =  bus[indexer].QL[jindex];	
-							}
-							else	//We're just a normal triplex bus
-							{
-								//This one isn't negated (normal operations)
-								tempPbus =  -bus[indexer].PL[jindex];	//Copy load amounts in
-								tempQbus =  -bus[indexer].QL[jindex];	
-							}//end normal triplex bus
+				if (matrix_solver_method==MM_SUPERLU)
+				{
+					//Retained factors go with the permutations
+					NR_chord_release(curr_island_superLU_vars);
+
+					//Free up superLU matrices
+					gl_free(curr_island_superLU_vars->perm_r);
+					gl_free(curr_island_superLU_vars->perm_c);
+				}
+				//Default else - don't care - destructions are presumed to be handled inside external LU's alloc function
+
+				/* Set aside space for the arrays. - Copied from above */
+				powerflow_values->island_matrix_values[island_loop_index].matrices_LU.a_LU = (double *) gl_malloc(nnz *sizeof(double));
+				if (powerflow_values->island_matrix_values[island_loop_index].matrices_LU.a_LU==NULL)
+					GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
+				
+				powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rows_LU = (int *) gl_malloc(nnz *sizeof(int));
+				if (powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rows_LU == NULL)
+					GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
 
-							//Get diagonal contributions - only (& always) 2
-							//Column 1
-							tempIcalcReal += (powerflow_values->BA_diag[indexer].Y[jindex][0]).Re() * (bus[indexer].V[0]).Re() - (powerflow_values->BA_diag[indexer].Y[jindex][0]).Im() * (bus[indexer].V[0]).Im();// equation (7), the diag elements of bus admittance matrix 
-							tempIcalcImag += (powerflow_values->BA_diag[indexer].Y[jindex][0]).Re() * (bus[indexer].V[0]).Im() + (powerflow_values->BA_diag[indexer].Y[jindex][0]).Im() * (bus[indexer].V[0]).Re();// equation (8), the diag elements of bus admittance matrix 
+				powerflow_values->island_matrix_values[island_loop_index].matrices_LU.cols_LU = (int *) gl_malloc((n+1) *sizeof(int));
+				if (powerflow_values->island_matrix_values[island_loop_index].matrices_LU.cols_LU == NULL)
+					GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
 
-							//Column 2
-							tempIcalcReal += (powerflow_values->BA_diag[indexer].Y[jindex][1]).Re() * (bus[indexer].V[1]).Re() - (powerflow_values->BA_diag[indexer].Y[jindex][1]).Im() * (bus[indexer].V[1]).Im();// equation (7), the diag elements of bus admittance matrix 
-							tempIcalcImag += (powerflow_values->BA_diag[indexer].Y[jindex][1]).Re() * (bus[indexer].V[1]).Im() + (powerflow_values->BA_diag[indexer].Y[jindex][1]).Im() * (bus[indexer].V[1]).Re();// equation (8), the diag elements of bus admittance matrix 
+				/* Create the right-hand side matrix B. */
+				powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rhs_LU = (double *) gl_malloc(m *sizeof(double));
+				if (powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rhs_LU == NULL)
+					GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
 
-							//Now off diagonals
-							for (kindexer=0; kindexer<(bus[indexer].Link_Table_Size); kindexer++)
-							{
-								//Apply proper index to jindexer (easier to implement this way)
-								jindexer=bus[indexer].Link_Table[kindexer];
+				if (matrix_solver_method==MM_SUPERLU)
+				{
+					///* Set up the arrays for the permutations. */
+					curr_island_superLU_vars->perm_r = (int *) gl_malloc(m *sizeof(int));
+					if (curr_island_superLU_vars->perm_r == NULL)
+						GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
 
-								if (branch[jindexer].from == (int)indexer)	//We're the from bus
-								{
-									if ((bus[indexer].phases & 0x20) == 0x20)	//SPCT from bus - needs different signage
-									{
-										work_vals_char_0 = jindex*3;
+					curr_island_superLU_vars->perm_c = (int *) gl_malloc(n *sizeof(int));
+					if (curr_island_superLU_vars->perm_c == NULL)
+						GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
 
-										//This situation can only be a normal line (triplex will never be the from for another type)
-										//Again only, & always 2 columns (just do them explicitly)
-										//Column 1
-										tempIcalcReal += ((branch[jindexer].Yfrom[work_vals_char_0])).Re() * (bus[branch[jindexer].to].V[0]).Re() - ((branch[jindexer].Yfrom[work_vals_char_0])).Im() * (bus[branch[jindexer].to].V[0]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-										tempIcalcImag += ((branch[jindexer].Yfrom[work_vals_char_0])).Re() * (bus[branch[jindexer].to].V[0]).Im() + ((branch[jindexer].Yfrom[work_vals_char_0])).Im() * (bus[branch[jindexer].to].V[0]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+					//Update structures - A_LU matrix
+					curr_island_superLU_vars->A_LU.Stype = SLU_NC;
+					curr_island_superLU_vars->A_LU.Dtype = SLU_D;
+					curr_island_superLU_vars->A_LU.Mtype = SLU_GE;
+					curr_island_superLU_vars->A_LU.nrow = n;
+					curr_island_superLU_vars->A_LU.ncol = m;
 
-										//Column2
-										tempIcalcReal += ((branch[jindexer].Yfrom[jindex*3+1])).Re() * (bus[branch[jindexer].to].V[1]).Re() - ((branch[jindexer].Yfrom[jindex*3+1])).Im() * (bus[branch[jindexer].to].V[1]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-										tempIcalcImag += ((branch[jindexer].Yfrom[jindex*3+1])).Re() * (bus[branch[jindexer].to].V[1]).Im() + ((branch[jindexer].Yfrom[jindex*3+1])).Im() * (bus[branch[jindexer].to].V[1]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+					//Update structures - B_LU matrix
+					curr_island_superLU_vars->B_LU.Stype = SLU_DN;
+					curr_island_superLU_vars->B_LU.Dtype = SLU_D;
+					curr_island_superLU_vars->B_LU.Mtype = SLU_GE;
+					curr_island_superLU_vars->B_LU.nrow = m;
+					curr_island_superLU_vars->B_LU.ncol = 1;
+				}
+				else if (matrix_solver_method == MM_EXTERN)	//External routine
+				{
+					//Run allocation routine
+					((void (*)(void *,unsigned int, unsigned int, bool))(LUSolverFcns.ext_alloc))(powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars,n,n,NR_admit_change);
+				}
+				else
+				{
+					GL_THROW("Invalid matrix solution method specified for NR solver!");
+					//Defined elsewhere
+				}
 
-									}//End SPCT To bus - from diagonal contributions
-									else		//Normal line connection to normal triplex
-									{
-										work_vals_char_0 = jindex*3;
-										//This situation can only be a normal line (triplex will never be the from for another type)
-										//Again only, & always 2 columns (just do them explicitly)
-										//Column 1
-										tempIcalcReal += (-(branch[jindexer].Yfrom[work_vals_char_0])).Re() * (bus[branch[jindexer].to].V[0]).Re() - (-(branch[jindexer].Yfrom[work_vals_char_0])).Im() * (bus[branch[jindexer].to].V[0]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-										tempIcalcImag += (-(branch[jindexer].Yfrom[work_vals_char_0])).Re() * (bus[branch[jindexer].to].V[0]).Im() + (-(branch[jindexer].Yfrom[work_vals_char_0])).Im() * (bus[branch[jindexer].to].V[0]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-
-										//Column2
-										tempIcalcReal += (-(branch[jindexer].Yfrom[jindex*3+1])).Re() * (bus[branch[jindexer].to].V[1]).Re() - (-(branch[jindexer].Yfrom[jindex*3+1])).Im() * (bus[branch[jindexer].to].V[1]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-										tempIcalcImag += (-(branch[jindexer].Yfrom[jindex*3+1])).Re() * (bus[branch[jindexer].to].V[1]).Im() + (-(branch[jindexer].Yfrom[jindex*3+1])).Im() * (bus[branch[jindexer].to].V[1]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-
-									}//end normal triplex from
-								}//end from bus
-								else if (branch[jindexer].to == (int)indexer)	//We're the to bus
-								{
-									if (branch[jindexer].v_ratio != 1.0)	//Transformer
-									{
-										//Only a single contributor on the from side - figure out how to get to it
-										if ((branch[jindexer].phases & 0x01) == 0x01)	//C
-										{
-											temp_index=2;
-										}
-										else if ((branch[jindexer].phases & 0x02) == 0x02)	//B
-										{
-											temp_index=1;
-										}
-										else if ((branch[jindexer].phases & 0x04) == 0x04)	//A
-										{
-											temp_index=0;
-										}
-										else	//How'd we get here!?!
-										{
-											GL_THROW("NR: A split-phase transformer appears to have an invalid phase");
-										}
+				//Update tracking variable
+				powerflow_values->island_matrix_values[island_loop_index].prev_m = m;
+			}
+			else if (powerflow_values->island_matrix_values[island_loop_index].prev_m != m)	//Non-reallocing size change occurred
+			{
+				if (matrix_solver_method==MM_SUPERLU)
+				{
+					//Update relevant portions
+					curr_island_superLU_vars->A_LU.nrow = n;
+					curr_island_superLU_vars->A_LU.ncol = m;
 
-										work_vals_char_0 = jindex*3+temp_index;
+					curr_island_superLU_vars->B_LU.nrow = m;
+				}
+				else if (matrix_solver_method == MM_EXTERN)	//External routine - call full reallocation, just in case
+				{
+					//Run allocation routine
+					((void (*)(void *,unsigned int, unsigned int, bool))(LUSolverFcns.ext_alloc))(powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars,n,n,NR_admit_change);
+				}
+				else
+				{
+					GL_THROW("Invalid matrix solution method specified for NR solver!");
+					//Defined elsewhere
+				}
 
-										//Perform the update, it only happens for one column (nature of the transformer)
-										tempIcalcReal += (-(branch[jindexer].Yto[work_vals_char_0])).Re() * (bus[branch[jindexer].from].V[temp_index]).Re() - (-(branch[jindexer].Yto[work_vals_char_0])).Im() * (bus[branch[jindexer].from].V[temp_index]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-										tempIcalcImag += (-(branch[jindexer].Yto[work_vals_char_0])).Re() * (bus[branch[jindexer].from].V[temp_index]).Im() + (-(branch[jindexer].Yto[work_vals_char_0])).Im() * (bus[branch[jindexer].from].V[temp_index]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+				//Update tracking variable
+				powerflow_values->island_matrix_values[island_loop_index].prev_m = m;
+			}
 
-									}//end transformer
-									else									//Must be a normal line then
-									{
-										if ((bus[indexer].phases & 0x20) == 0x20)	//SPCT from bus - needs different signage
-										{
-											work_vals_char_0 = jindex*3;
-											//This case should never really exist, but if someone reverses a secondary or is doing meshed secondaries, it might
-											//Again only, & always 2 columns (just do them explicitly)
-											//Column 1
-											tempIcalcReal += ((branch[jindexer].Yto[work_vals_char_0])).Re() * (bus[branch[jindexer].from].V[0]).Re() - ((branch[jindexer].Yto[work_vals_char_0])).Im() * (bus[branch[jindexer].from].V[0]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-											tempIcalcImag += ((branch[jindexer].Yto[work_vals_char_0])).Re() * (bus[branch[jindexer].from].V[0]).Im() + ((branch[jindexer].Yto[work_vals_char_0])).Im() * (bus[branch[jindexer].from].V[0]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-
-											//Column2
-											tempIcalcReal += ((branch[jindexer].Yto[work_vals_char_0+1])).Re() * (bus[branch[jindexer].from].V[1]).Re() - ((branch[jindexer].Yto[work_vals_char_0+1])).Im() * (bus[branch[jindexer].from].V[1]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-											tempIcalcImag += ((branch[jindexer].Yto[work_vals_char_0+1])).Re() * (bus[branch[jindexer].from].V[1]).Im() + ((branch[jindexer].Yto[work_vals_char_0+1])).Im() * (bus[branch[jindexer].from].V[1]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-										}//End SPCT To bus - from diagonal contributions
-										else		//Normal line connection to normal triplex
-										{
-											work_vals_char_0 = jindex*3;
-											//Again only, & always 2 columns (just do them explicitly)
-											//Column 1
-											tempIcalcReal += (-(branch[jindexer].Yto[work_vals_char_0])).Re() * (bus[branch[jindexer].from].V[0]).Re() - (-(branch[jindexer].Yto[work_vals_char_0])).Im() * (bus[branch[jindexer].from].V[0]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-											tempIcalcImag += (-(branch[jindexer].Yto[work_vals_char_0])).Re() * (bus[branch[jindexer].from].V[0]).Im() + (-(branch[jindexer].Yto[work_vals_char_0])).Im() * (bus[branch[jindexer].from].V[0]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-
-											//Column2
-											tempIcalcReal += (-(branch[jindexer].Yto[work_vals_char_0+1])).Re() * (bus[branch[jindexer].from].V[1]).Re() - (-(branch[jindexer].Yto[work_vals_char_0+1])).Im() * (bus[branch[jindexer].from].V[1]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-											tempIcalcImag += (-(branch[jindexer].Yto[work_vals_char_0+1])).Re() * (bus[branch[jindexer].from].V[1]).Im() + (-(branch[jindexer].Yto[work_vals_char_0+1])).Im() * (bus[branch[jindexer].from].V[1]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-										}//End normal triplex connection
-									}//end normal line
-								}//end to bus
-								else	//We're nothing
-									;
-
-							}//End branch traversion
+	#ifndef MT
+			if (matrix_solver_method==MM_SUPERLU)
+			{
+				/* superLU sequential options*/
+				set_default_options ( &options );
+			}
+			//Default else - not superLU
+	#endif
+			
+			sparse_tonr(powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix, &powerflow_values->island_matrix_values[island_loop_index].matrices_LU);
+			powerflow_values->island_matrix_values[island_loop_index].matrices_LU.cols_LU[n] = nnz ;// number of non-zeros;
 
-							//Determine how we are posting this update
-							if ((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == true))	//SWING bus is different (when it really is a SWING bus)
-							{
-								if ((powerflow_type == PF_DYNINIT) && (bus[indexer].DynCurrent != NULL))	//We're a generator-type bus
-								{
-									//See if we're a Norton-equivalent-based generator
-									if (bus[indexer].full_Y != NULL)
-									{
-										//Compute our "power generated" value for this phase - conjugated in formation
-										temp_complex_2 = bus[indexer].V[jindex] * complex(tempIcalcReal,-tempIcalcImag);
+			//Determine how to populate the rhs vector
+			if (mesh_imped_vals == NULL)	//Normal powerflow, copy in the values
+			{
+				for (temp_index_c=0;temp_index_c<m;temp_index_c++)
+				{ 
+					powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rhs_LU[temp_index_c] = powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[temp_index_c];
+				}
+			}
+			//Default else -- it is NULL - zero it and "populate it" below
 
-										if (powerflow_values->island_matrix_values[island_loop_index].iteration_count>0)	//Only update SWING on subsequent passes
-										{
-											//Now add it into the "generation total" for the SWING
-											//Accumulate our power from the bus injections
-											(*bus[indexer].PGenTotal) += temp_complex_2; // both PT and QT = Ssource-Sysource = v conj(I) - v conj(ysource v) - overall gen handled above
-										}
+			//Chord Newton only applies to normal static solutions - the linearized screening mode and scenario solves retain the factors the same way
+			chord_active = (((NR_chord_newton == true) || (NR_linear_screening == true) || (NR_retain_factors == true)) && (matrix_solver_method == MM_SUPERLU) && (powerflow_type == PF_NORMAL) && (mesh_imped_vals == NULL));
+			chord_reused = false;
+			chord_factors_held = false;
 
-										//Compute the delta_I, just like below - but don't post it (still zero in calcs)
-										work_vals_double_0 = (bus[indexer].V[jindex]).Mag()*(bus[indexer].V[jindex]).Mag();
+			//Linearized screening - the first iteration of an unchanged system is a candidate for the linear update,
+			//and a verified linear update gets one more solve from the same factors to take up the remaining mismatch
+			linear_active = (((NR_linear_screening == true) && (chord_active == true) && (chord_admit_changed == false) && (deltatimestep_running < 0) && (powerflow_values->island_matrix_values[island_loop_index].iteration_count == 0)) || (linear_verified == true));
+			linear_update = false;
 
-										if (work_vals_double_0!=0)	//Only normal one (not square), but a zero is still a zero even after that
-										{
-											work_vals_double_1 = (bus[indexer].V[jindex]).Re();
-											work_vals_double_2 = (bus[indexer].V[jindex]).Im();
-											work_vals_double_3 = (tempPbus * work_vals_double_1 + tempQbus * work_vals_double_2)/ (work_vals_double_0) - tempIcalcReal; // equation(7), Real part of deltaI, left hand side of equation (11)
-											work_vals_double_4 = (tempPbus * work_vals_double_2 - tempQbus * work_vals_double_1)/ (work_vals_double_0) - tempIcalcImag; // Imaginary part of deltaI, left hand side of equation (11)
+			if (matrix_solver_method==MM_SUPERLU)
+			{
+				////* Create Matrix A in the format expected by Super LU.*/
+				//Populate the matrix values (temporary value)
+				Astore = (NCformat*)curr_island_superLU_vars->A_LU.Store;
+				Astore->nnz = nnz;
+				Astore->nzval = powerflow_values->island_matrix_values[island_loop_index].matrices_LU.a_LU;
+				Astore->rowind = powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rows_LU;
+				Astore->colptr = powerflow_values->island_matrix_values[island_loop_index].matrices_LU.cols_LU;
+				
+				// Create right-hand side matrix B in format expected by Super LU
+				//Populate the matrix (temporary values)
+				Bstore = (DNformat*)curr_island_superLU_vars->B_LU.Store;
+				Bstore->lda = m;
+				Bstore->nzval = powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rhs_LU;
 
-											//Form a magnitude value - put in work_vals_double_0, since we're done with it
-											work_vals_double_0 = sqrt((work_vals_double_3*work_vals_double_3+work_vals_double_4*work_vals_double_4));
-										}
-										else	//Would give us a NAN, so it must be out of service or something (case from below - really shouldn't apply to SWING)
-										{
-											work_vals_double_0 = 0.0;	//Assumes "converged"
-										}
-										
-										if (work_vals_double_0 > bus[indexer].max_volt_error)	//Failure check (defaults to voltage convergence for now)
-										{
-											powerflow_values->island_matrix_values[island_loop_index].swing_converged=false;
-										}
-									}//End Norton-equivalent SWING
-									else	//Other generator types
-									{
-										//Compute the delta_I, just like below - but don't post it (still zero in calcs)
-										work_vals_double_0 = (bus[indexer].V[jindex]).Mag()*(bus[indexer].V[jindex]).Mag();
+				//See how to call the function - if normal mode or not
+				//**************************** How will this work with islanding stuff !?!?!?!? ****************************
+				if (mesh_imped_vals != NULL)
+				{
+					//Start with "failure" option on the structure
+					mesh_imped_vals->return_code = 0;
 
-										if (work_vals_double_0!=0)	//Only normal one (not square), but a zero is still a zero even after that
-										{
-											work_vals_double_1 = (bus[indexer].V[jindex]).Re();
-											work_vals_double_2 = (bus[indexer].V[jindex]).Im();
-											work_vals_double_3 = (tempPbus * work_vals_double_1 + tempQbus * work_vals_double_2)/ (work_vals_double_0) - tempIcalcReal; // equation(7), Real part of deltaI, left hand side of equation (11)
-											work_vals_double_4 = (tempPbus * work_vals_double_2 - tempQbus * work_vals_double_1)/ (work_vals_double_0) - tempIcalcImag; // Imaginary part of deltaI, left hand side of equation (11)
+					//Determine the base index (error check)
+					if (mesh_imped_vals->NodeRefNum > 0)
+					{
+						tempa = 2*bus[mesh_imped_vals->NodeRefNum].Matrix_Loc;	//These are already separated into real/imag, so the base is 2x
+					}
+					else	//Error
+					{
+						gl_error("solver_nr: Node reference for mesh fault calculation was invalid -- it may be a child");
+						/*  TROUBLESHOOT
+						While attempting to compute the equivalent impedance at a mesh faulted node, an invalid node reference
+						was found.  This is likely an internal error to the code -- submit your code and a bug report via the
+						tracking website.
+						*/
 
-											//Form a magnitude value - put in work_vals_double_0, since we're done with it
-											work_vals_double_0 = sqrt((work_vals_double_3*work_vals_double_3+work_vals_double_4*work_vals_double_4));
-										}
-										else	//Would give us a NAN, so it must be out of service or something (case from below - really shouldn't apply to SWING)
-										{
-											work_vals_double_0 = 0.0;	//Assumes "converged"
-										}
+						//Set the flags
+						mesh_imped_vals->return_code = 0;
+						*bad_computations = true;
 
-										if (work_vals_double_0 > bus[indexer].max_volt_error)	//Failure check (defaults to voltage convergence for now)
-										{
-											powerflow_values->island_matrix_values[island_loop_index].swing_converged=false;
-										}
+						//Deflag the island locker, though not really needed
+						NR_solver_working = false;
 
-										//Put this into DynCurrent for storage
-										/*** NOTE - This is untested and it's not clear if it is even needed (triplex swing bus?) ******/
-										bus[indexer].DynCurrent[jindex] = complex(tempIcalcReal,tempIcalcImag);
-									}//End other generator types
-								}//End PF_DYNINIT SWING traversion
+						//Return a 0 to flag
+						return 0;
+					}
 
-								//Effectively Zero out the components, regardless of normal run or not
-								//Should already be zerod, but do it again for paranoia sake
-								powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + jindex] = 0.0;
-								powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] = 0.0;
+					//Determine our phasing size - what entries to pull - double for the complex notation
+					temp_size = 2*powerflow_values->BA_diag[mesh_imped_vals->NodeRefNum].size;
 
-								//Saturation skipped for "swing is a swing" case, since it doesn't affect the admittance (no need to offset)
-							}//End SWING bus cases
-							else	//PQ bus or SWING masquerading as a PQ
-							{
-								work_vals_double_0 = (bus[indexer].V[jindex]).Mag()*(bus[indexer].V[jindex]).Mag();
+					//Check for error - size of zero
+					if (temp_size == 0)
+					{
+						gl_error("solver_nr: Mesh fault impedance extract failed - invalid node");
+						/*  TROUBLESHOOT
+						While attempting to extract the mesh fault impedance value, a node with either
+						invalid phasing or no phases (already removed) was somehow flagged.  Please check
+						your file and try again.  If the error persists, please submit your code
+						and a bug report via the ticketing system.
+						*/
 
-								if (work_vals_double_0!=0)	//Only normal one (not square), but a zero is still a zero even after that
-								{
-									work_vals_double_1 = (bus[indexer].V[jindex]).Re();
-									work_vals_double_2 = (bus[indexer].V[jindex]).Im();
+						//Flags
+						*bad_computations = true;
+						mesh_imped_vals->return_code = 0;
 
-									powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+ powerflow_values->BA_diag[indexer].size + jindex] = (tempPbus * work_vals_double_1 + tempQbus * work_vals_double_2)/ (work_vals_double_0) - tempIcalcReal ; // equation(7), Real part of deltaI, left hand side of equation (11)
-									powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] = (tempPbus * work_vals_double_2 - tempQbus * work_vals_double_1)/ (work_vals_double_0) - tempIcalcImag; // Imaginary part of deltaI, left hand side of equation (11)
-								}
-								else
-								{
-									powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + jindex] = 0.0;
-									powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] = 0.0;
-								}
-							}//End normal bus handling
-						}//End split-phase present
-						else	//Three phase or some variant thereof
-						{
-							tempPbus =  - bus[indexer].PL[jindex];	//Copy load amounts in
-							tempQbus =  - bus[indexer].QL[jindex];	
+						//Deflag the island locker, though not really needed
+						NR_solver_working = false;
 
-							for ( kindex = 0 ; kindex < powerflow_values->BA_diag[indexer].size ; kindex++ )		//cols - Still only for specified phases
-							{
-								//Determine our indices, based on phase information
-								temp_index = -1;
-								switch(bus[indexer].phases & 0x07) {
-									case 0x01:	//C
-										{
-											temp_index=2;
-											break;
-										}//end 0x01
-									case 0x02:	//B
-										{
-											temp_index=1;
-											break;
-										}//end 0x02
-									case 0x03:	//BC
-										{
-											if (kindex==0)	//B
-												temp_index=1;
-											else	//C
-												temp_index=2;
-											break;
-										}//end 0x03
-									case 0x04:	//A
-										{
-											temp_index=0;
-											break;
-										}//end 0x04
-									case 0x05:	//AC
-										{
-											if (kindex==0)	//A
-												temp_index=0;
-											else			//C
-												temp_index=2;
-											break;
-										}//end 0x05
-									case 0x06:	//AB
-										{
-											if (kindex==0)	//A
-												temp_index=0;
-											else			//B
-												temp_index=1;
-											break;
-										}//end 0x06
-									case 0x07:	//ABC
-										{
-											temp_index = kindex;	//Will loop all 3
-											break;
-										}//end 0x07
-								}//End switch/case
+						//Exit
+						return 0;
+					}
+					//Default else -- okay
 
-								if ((int)temp_index==-1)	//Error check
-								{
-									GL_THROW("NR: A voltage index failed to be found.");
-									/*  TROUBLESHOOT
-									While attempting to compute the calculated power current, a voltage index failed to be
-									resolved.  Please submit your code and a bug report via the trac website.
-									*/
-								}
+					//Clear out the output matrix first -- assumes it is 3x3, regardless
+					for (jindex=0; jindex<9; jindex++)
+					{
+						mesh_imped_vals->z_matrix[jindex] = complex(0.0,0.0);
+					}
 
-								//Normal diagonal contributions
-								tempIcalcReal += (powerflow_values->BA_diag[indexer].Y[jindex][kindex]).Re() * (bus[indexer].V[temp_index]).Re() - (powerflow_values->BA_diag[indexer].Y[jindex][kindex]).Im() * (bus[indexer].V[temp_index]).Im();// equation (7), the diag elements of bus admittance matrix 
-								tempIcalcImag += (powerflow_values->BA_diag[indexer].Y[jindex][kindex]).Re() * (bus[indexer].V[temp_index]).Im() + (powerflow_values->BA_diag[indexer].Y[jindex][kindex]).Im() * (bus[indexer].V[temp_index]).Re();// equation (8), the diag elements of bus admittance matrix 
+					//Zero the double matrix - the big storage (6x6 - re & im split)
+					for (jindex=0; jindex<6; jindex++)
+					{
+						for (kindex=0; kindex<6; kindex++)
+						{
+							temp_z_store[jindex][kindex] = 0.0;
+						}
+					}
 
-								//In-rush load contributions (if any) - only along explicit diagonal
-								if ((bus[indexer].full_Y_load != NULL) && (jindex==kindex))
-								{
-									tempIcalcReal += (bus[indexer].full_Y_load[temp_index]).Re() * (bus[indexer].V[temp_index]).Re() - (bus[indexer].full_Y_load[temp_index]).Im() * (bus[indexer].V[temp_index]).Im();// equation (7), the diag elements of bus admittance matrix 
-									tempIcalcImag += (bus[indexer].full_Y_load[temp_index]).Re() * (bus[indexer].V[temp_index]).Im() + (bus[indexer].full_Y_load[temp_index]).Im() * (bus[indexer].V[temp_index]).Re();// equation (8), the diag elements of bus admittance matrix 
-								}
+					//These solutions overwrite the permutations, so any retained chord factors are no longer usable
+					NR_chord_release(curr_island_superLU_vars);
 
-								//Off diagonal contributions
-								//Need another variable to handle the rows
-								temp_index_b = -1;
-								switch(bus[indexer].phases & 0x07) {
-									case 0x01:	//C
-										{
-											temp_index_b=2;
-											break;
-										}//end 0x01
-									case 0x02:	//B
-										{
-											temp_index_b=1;
-											break;
-										}//end 0x02
-									case 0x03:	//BC
-										{
-											if (jindex==0)	//B
-												temp_index_b=1;
-											else	//C
-												temp_index_b=2;
-											break;
-										}//end 0x03
-									case 0x04:	//A
-										{
-											temp_index_b=0;
-											break;
-										}//end 0x04
-									case 0x05:	//AC
-										{
-											if (jindex==0)	//A
-												temp_index_b=0;
-											else			//C
-												temp_index_b=2;
-											break;
-										}//end 0x05
-									case 0x06:	//AB
-										{
-											if (jindex==0)	//A
-												temp_index_b=0;
-											else			//B
-												temp_index_b=1;
-											break;
-										}//end 0x06
-									case 0x07:	//ABC
-										{
-											temp_index_b = jindex;	//Will loop all 3
-											break;
-										}//end 0x07
-								}//End switch/case
+					//Overall loop - for number of phases
+					for (kindex=0; kindex<temp_size; kindex++)
+					{
 
-								if ((int)temp_index_b==-1)	//Error check
-								{
-									GL_THROW("NR: A voltage index failed to be found.");
-								}
+						//Start by zeroing the "solution" vector
+						for (temp_index_c=0;temp_index_c<m;temp_index_c++)
+						{ 
+							powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rhs_LU[temp_index_c] = 0.0;
+						}
 
-								for (kindexer=0; kindexer<(bus[indexer].Link_Table_Size); kindexer++)	//Parse through the branch list
-								{
-									//Apply proper index to jindexer (easier to implement this way)
-									jindexer=bus[indexer].Link_Table[kindexer];
+						//"Identity"-ize the real part of the current index
+						powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rhs_LU[tempa + kindex] = 1.0;
 
-									if (branch[jindexer].from == (int)indexer) 
-									{
-										//See if we're a triplex transformer (will only occur on the from side)
-										if ((branch[jindexer].phases & 0x80) == 0x80)	//Triplexy
-										{
-											proceed_flag = false;
-											phase_worka = branch[jindexer].phases & 0x07;
+						//Do a solution to get this entry (copied from below - includes "destructors"
+	#ifdef MT
+						//superLU_MT commands
 
-											if (kindex==0)	//All of this will only occur the first column iteration
-											{
-												switch (bus[indexer].phases & 0x07)	{
-													case 0x01:	//C
-														{
-															if (phase_worka==0x01)
-																proceed_flag=true;
-															break;
-														}//end 0x01
-													case 0x02:	//B
-														{
-															if (phase_worka==0x02)
-																proceed_flag=true;
-															break;
-														}//end 0x02
-													case 0x03:	//BC
-														{
-															if ((jindex==0) && (phase_worka==0x02))	//First row and is a B
-																proceed_flag=true;
-															else if ((jindex==1) && (phase_worka==0x01))	//Second row and is a C
-																proceed_flag=true;
-															else
-																;
-															break;
-														}//end 0x03
-													case 0x04:	//A
-														{
-															if (phase_worka==0x04)
-																proceed_flag=true;
-															break;
-														}//end 0x04
-													case 0x05:	//AC
-														{
-															if ((jindex==0) && (phase_worka==0x04))	//First row and is a A
-																proceed_flag=true;
-															else if ((jindex==1) && (phase_worka==0x01))	//Second row and is a C
-																proceed_flag=true;
-															else
-																;
-															break;
-														}//end 0x05
-													case 0x06:	//AB - shares with ABC
-													case 0x07:	//ABC 
-														{
-															if ((jindex==0) && (phase_worka==0x04))	//A & first row
-																proceed_flag=true;
-															else if ((jindex==1) && (phase_worka==0x02))	//B & second row
-																proceed_flag=true;
-															else if ((jindex==2) && (phase_worka==0x01))	//C & third row
-																proceed_flag=true;
-															else;
-															break;
-														}//end 0x07
-												}//end switch
-											}//End if kindex==0
-
-											if (proceed_flag)
-											{
-												work_vals_char_0 = temp_index_b*3;
-												//Do columns individually
-												//1
-												tempIcalcReal += (-(branch[jindexer].Yfrom[work_vals_char_0])).Re() * (bus[branch[jindexer].to].V[0]).Re() - (-(branch[jindexer].Yfrom[work_vals_char_0])).Im() * (bus[branch[jindexer].to].V[0]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-												tempIcalcImag += (-(branch[jindexer].Yfrom[work_vals_char_0])).Re() * (bus[branch[jindexer].to].V[0]).Im() + (-(branch[jindexer].Yfrom[work_vals_char_0])).Im() * (bus[branch[jindexer].to].V[0]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+						//Populate perm_c
+						get_perm_c(1, &curr_island_superLU_vars->A_LU, curr_island_superLU_vars->perm_c);
 
-												//2
-												tempIcalcReal += (-(branch[jindexer].Yfrom[work_vals_char_0+1])).Re() * (bus[branch[jindexer].to].V[1]).Re() - (-(branch[jindexer].Yfrom[work_vals_char_0+1])).Im() * (bus[branch[jindexer].to].V[1]).Im();// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-												tempIcalcImag += (-(branch[jindexer].Yfrom[work_vals_char_0+1])).Re() * (bus[branch[jindexer].to].V[1]).Im() + (-(branch[jindexer].Yfrom[work_vals_char_0+1])).Im() * (bus[branch[jindexer].to].V[1]).Re();// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+						//Solve the system 
+						pdgssv(NR_superLU_procs, &curr_island_superLU_vars->A_LU, curr_island_superLU_vars->perm_c, curr_island_superLU_vars->perm_r, &L_LU, &U_LU, &curr_island_superLU_vars->B_LU, &info);
 
-											}
-										}//end SPCT transformer
-										else	///Must be a standard line
-										{
-											work_vals_char_0 = temp_index_b*3+temp_index;
-											work_vals_double_0 = (-branch[jindexer].Yfrom[work_vals_char_0]).Re();
-											work_vals_double_1 = (-branch[jindexer].Yfrom[work_vals_char_0]).Im();
-											work_vals_double_2 = (bus[branch[jindexer].to].V[temp_index]).Re();
-											work_vals_double_3 = (bus[branch[jindexer].to].V[temp_index]).Im();
-
-											tempIcalcReal += work_vals_double_0 * work_vals_double_2 - work_vals_double_1 * work_vals_double_3;// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-											tempIcalcImag += work_vals_double_0 * work_vals_double_3 + work_vals_double_1 * work_vals_double_2;// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-
-										}//end standard line
-									}	
-									if  (branch[jindexer].to == (int)indexer)
-									{
-										work_vals_char_0 = temp_index_b*3+temp_index;
-										work_vals_double_0 = (-branch[jindexer].Yto[work_vals_char_0]).Re();
-										work_vals_double_1 = (-branch[jindexer].Yto[work_vals_char_0]).Im();
-										work_vals_double_2 = (bus[branch[jindexer].from].V[temp_index]).Re();
-										work_vals_double_3 = (bus[branch[jindexer].from].V[temp_index]).Im();
-
-										tempIcalcReal += work_vals_double_0 * work_vals_double_2 - work_vals_double_1 * work_vals_double_3;// equation (7), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-										tempIcalcImag += work_vals_double_0 * work_vals_double_3 + work_vals_double_1 * work_vals_double_2;// equation (8), the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
-									}
-									else;
-								}
-							}//end intermediate current for each phase column
+						/* De-allocate storage - superLU matrix types must be destroyed at every iteration, otherwise they balloon fast (65 MB norma becomes 1.5 GB) */
+						//superLU_MT commands
+						Destroy_SuperNode_SCP(&L_LU);
+						Destroy_CompCol_NCP(&U_LU);
+	#else
+						//sequential superLU
 
-							//Determine how we are posting this update
-							if ((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == true))	//SWING bus is different (when it really is a SWING bus)
-							{
-								if ((powerflow_type == PF_DYNINIT) && (bus[indexer].DynCurrent != NULL))
-								{
-									//See if we're a Norton-equivalent-based generator
-									if (bus[indexer].full_Y != NULL)
-									{
-										//Compute our "power generated" value for this phase - conjugated in formation
-										temp_complex_2 = bus[indexer].V[jindex] * complex(tempIcalcReal,-tempIcalcImag);
+						StatInit ( &stat );
 
-										if (powerflow_values->island_matrix_values[island_loop_index].iteration_count>0)	//Only update SWING on subsequent passes
-										{
-											//Now add it into the "generation total" for the SWING
-											//Accumulate our power from the bus injections
-											(*bus[indexer].PGenTotal) += temp_complex_2 - temp_complex_3/3.0; // both PT and QT = Ssource-Sysource = v conj(I) - v conj(ysource v)
-										}
+						// solve the system
+						dgssv(&options, &curr_island_superLU_vars->A_LU, curr_island_superLU_vars->perm_c, curr_island_superLU_vars->perm_r, &L_LU, &U_LU, &curr_island_superLU_vars->B_LU, &stat, &info);
 
-										//Compute the delta_I, just like below - but don't post it (still zero in calcs)
-										work_vals_double_0 = (bus[indexer].V[temp_index_b]).Mag()*(bus[indexer].V[temp_index_b]).Mag();
+						/* De-allocate storage - superLU matrix types must be destroyed at every iteration, otherwise they balloon fast (65 MB norma becomes 1.5 GB) */
+						//sequential superLU commands
+						Destroy_SuperNode_Matrix( &L_LU );
+						Destroy_CompCol_Matrix( &U_LU );
+						StatFree ( &stat );
+	#endif
+						//Crude superLU checks - see if it is mission accomplished or not
+						if (info != 0)	//Failed inversion, for various reasons
+						{
+							gl_error("solver_nr: superLU failed mesh fault matrix inversion with code %d",info);
+							/*  TROUBLESHOOT
+							superLU failed to invert the equivalent impedance matrix for the mesh fault calculation
+							method.  Please try again and make sure your system is valid.  If the error persists, please
+							submit your code and a bug report via the ticketing system.
+							*/
 
-										if (work_vals_double_0!=0)	//Only normal one (not square), but a zero is still a zero even after that
-										{
-											work_vals_double_1 = (bus[indexer].V[temp_index_b]).Re();
-											work_vals_double_2 = (bus[indexer].V[temp_index_b]).Im();
-											work_vals_double_3 = (tempPbus * work_vals_double_1 + tempQbus * work_vals_double_2)/ (work_vals_double_0) - tempIcalcReal; // equation(7), Real part of deltaI, left hand side of equation (11)
-											work_vals_double_4 = (tempPbus * work_vals_double_2 - tempQbus * work_vals_double_1)/ (work_vals_double_0) - tempIcalcImag; // Imaginary part of deltaI, left hand side of equation (11)
+							//Flag as bad
+							*bad_computations = true;
+							mesh_imped_vals->return_code = 0;
 
-											//Form a magnitude value - put in work_vals_double_0, since we're done with it
-											work_vals_double_0 = sqrt((work_vals_double_3*work_vals_double_3+work_vals_double_4*work_vals_double_4));
-										}
-										else	//Would give us a NAN, so it must be out of service or something (case from below - really shouldn't apply to SWING)
-										{
-											work_vals_double_0 = 0.0;	//Assumes "converged"
-										}
-										
-										if (work_vals_double_0 > bus[indexer].max_volt_error)	//Failure check (defaults to voltage convergence for now)
-										{
-											powerflow_values->island_matrix_values[island_loop_index].swing_converged=false;
-										}
-									}//End Norton-equivalent SWING
-									else	//Other generator types
-									{
-										//Compute the delta_I, just like below - but don't post it (still zero in calcs)
-										work_vals_double_0 = (bus[indexer].V[temp_index_b]).Mag()*(bus[indexer].V[temp_index_b]).Mag();
+							//Deflag the island locker, though not really needed
+							NR_solver_working = false;
 
-										if (work_vals_double_0!=0)	//Only normal one (not square), but a zero is still a zero even after that
-										{
-											work_vals_double_1 = (bus[indexer].V[temp_index_b]).Re();
-											work_vals_double_2 = (bus[indexer].V[temp_index_b]).Im();
-											work_vals_double_3 = (tempPbus * work_vals_double_1 + tempQbus * work_vals_double_2)/ (work_vals_double_0) - tempIcalcReal; // equation(7), Real part of deltaI, left hand side of equation (11)
-											work_vals_double_4 = (tempPbus * work_vals_double_2 - tempQbus * work_vals_double_1)/ (work_vals_double_0) - tempIcalcImag; // Imaginary part of deltaI, left hand side of equation (11)
+							//Exit
+							return 0;
+						}
+						//Default else, must have converged!
 
-											//Form a magnitude value - put in work_vals_double_0, since we're done with it
-											work_vals_double_0 = sqrt((work_vals_double_3*work_vals_double_3+work_vals_double_4*work_vals_double_4));
-										}
-										else	//Would give us a NAN, so it must be out of service or something (case from below - really shouldn't apply to SWING)
-										{
-											work_vals_double_0 = 0.0;	//Assumes "converged"
-										}
+						//Map up the solution vector
+						sol_LU = (double*) ((DNformat*) curr_island_superLU_vars->B_LU.Store)->nzval;
 
-										if (work_vals_double_0 > bus[indexer].max_volt_error)	//Failure check (defaults to voltage convergence for now)
-										{
-											powerflow_values->island_matrix_values[island_loop_index].swing_converged=false;
-										}
+						//Extract out this column into the temporary matrix
+						for (jindex=0; jindex<temp_size; jindex++)
+						{
+							temp_z_store[jindex][kindex] = sol_LU[tempa+jindex];
+						}
+					}//End "phase loop" - impedance components are ready
 
-										//Put this into DynCurrent for storage
-										bus[indexer].DynCurrent[jindex] = complex(tempIcalcReal,tempIcalcImag);
-									}//End other generator types
-								}//End PF_DYNINIT SWING traversion
+					//Extract the values - do with a massive case/switch, just because
+					switch(bus[mesh_imped_vals->NodeRefNum].phases & 0x07) {
+						case 0x01:	//C
+							{
+								mesh_imped_vals->z_matrix[8] = complex(temp_z_store[1][0],temp_z_store[1][1]);
+								break;
+							}
+						case 0x02:	//B
+							{
+								mesh_imped_vals->z_matrix[4] = complex(temp_z_store[1][0],temp_z_store[1][1]);
+								break;
+							}
+						case 0x03:	//BC
+							{
+								//BB and BC portion
+								mesh_imped_vals->z_matrix[4] = complex(temp_z_store[2][0],temp_z_store[2][2]);
+								mesh_imped_vals->z_matrix[5] = complex(temp_z_store[2][1],temp_z_store[2][3]);
 
-								//Effectively Zero out the components, regardless of normal run or not
-								//Should already be zerod, but do it again for paranoia sake
-								if (NR_busdata[indexer].BusHistTerm != NULL)	//See if we're "delta-capable"
-								{
-									powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + jindex] = NR_busdata[indexer].BusHistTerm[jindex].Re();
-									powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] = NR_busdata[indexer].BusHistTerm[jindex].Im();
-								}
-								else
-								{
-									powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + jindex] = 0.0;
-									powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] = 0.0;
-								}
+								//CB and CC portion
+								mesh_imped_vals->z_matrix[7] = complex(temp_z_store[3][0],temp_z_store[3][2]);
+								mesh_imped_vals->z_matrix[8] = complex(temp_z_store[3][1],temp_z_store[3][3]);
+								break;
+							}
+						case 0x04:	//A
+							{
+								mesh_imped_vals->z_matrix[0] = complex(temp_z_store[1][0],temp_z_store[1][1]);
+								break;
+							}
+						case 0x05:	//AC
+							{
+								//AA and AC portion
+								mesh_imped_vals->z_matrix[0] = complex(temp_z_store[2][0],temp_z_store[2][2]);
+								mesh_imped_vals->z_matrix[2] = complex(temp_z_store[2][1],temp_z_store[2][3]);
+
+								//CA and CC portion
+								mesh_imped_vals->z_matrix[6] = complex(temp_z_store[3][0],temp_z_store[3][2]);
+								mesh_imped_vals->z_matrix[8] = complex(temp_z_store[3][1],temp_z_store[3][3]);
+								break;
+							}
+						case 0x06:	//AB
+							{
+								//AA and AB portion
+								mesh_imped_vals->z_matrix[0] = complex(temp_z_store[2][0],temp_z_store[2][2]);
+								mesh_imped_vals->z_matrix[1] = complex(temp_z_store[2][1],temp_z_store[2][3]);
+
+								//BA and BB portion
+								mesh_imped_vals->z_matrix[3] = complex(temp_z_store[3][0],temp_z_store[3][2]);
+								mesh_imped_vals->z_matrix[4] = complex(temp_z_store[3][1],temp_z_store[3][3]);
+								break;
+							}
+						case 0x07:	//ABC
+							{
+								//A row
+								mesh_imped_vals->z_matrix[0] = complex(temp_z_store[3][0],temp_z_store[3][3]);
+								mesh_imped_vals->z_matrix[1] = complex(temp_z_store[3][1],temp_z_store[3][4]);
+								mesh_imped_vals->z_matrix[2] = complex(temp_z_store[3][2],temp_z_store[3][5]);
+
+								//B row
+								mesh_imped_vals->z_matrix[3] = complex(temp_z_store[4][0],temp_z_store[4][3]);
+								mesh_imped_vals->z_matrix[4] = complex(temp_z_store[4][1],temp_z_store[4][4]);
+								mesh_imped_vals->z_matrix[5] = complex(temp_z_store[4][2],temp_z_store[4][5]);
 
-								//Saturation skipped for "swing is a swing" case, since it doesn't affect the admittance (no need to offset)
-							}//End SWING bus cases
-							else	//PQ bus or SWING masquerading as a PQ
+								//C row
+								mesh_imped_vals->z_matrix[6] = complex(temp_z_store[5][0],temp_z_store[5][3]);
+								mesh_imped_vals->z_matrix[7] = complex(temp_z_store[5][1],temp_z_store[5][4]);
+								mesh_imped_vals->z_matrix[8] = complex(temp_z_store[5][2],temp_z_store[5][5]);
+								break;
+							}
+						default:	//Not sure how we got here
 							{
-								work_vals_double_0 = (bus[indexer].V[temp_index_b]).Mag()*(bus[indexer].V[temp_index_b]).Mag();
+								gl_error("solver_nr: Mesh fault impedance extract failed - invalid node");
+								//Defined above, same message
 
-								if (work_vals_double_0!=0)	//Only normal one (not square), but a zero is still a zero even after that
-								{
-									work_vals_double_1 = (bus[indexer].V[temp_index_b]).Re();
-									work_vals_double_2 = (bus[indexer].V[temp_index_b]).Im();
+								//Flags
+								*bad_computations = true;
+								mesh_imped_vals->return_code = 0;
 
-									//See if deltamode needs to include extra term
-									if (NR_busdata[indexer].BusHistTerm != NULL)
-									{
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+ powerflow_values->BA_diag[indexer].size + jindex] = (tempPbus * work_vals_double_1 + tempQbus * work_vals_double_2)/ (work_vals_double_0) + NR_busdata[indexer].BusHistTerm[jindex].Re() - tempIcalcReal ; // equation(7), Real part of deltaI, left hand side of equation (11)
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] = (tempPbus * work_vals_double_2 - tempQbus * work_vals_double_1)/ (work_vals_double_0) + NR_busdata[indexer].BusHistTerm[jindex].Im() - tempIcalcImag; // Imaginary part of deltaI, left hand side of equation (11)
-									}
-									else	//Nope
-									{
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+ powerflow_values->BA_diag[indexer].size + jindex] = (tempPbus * work_vals_double_1 + tempQbus * work_vals_double_2)/ (work_vals_double_0) - tempIcalcReal ; // equation(7), Real part of deltaI, left hand side of equation (11)
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] = (tempPbus * work_vals_double_2 - tempQbus * work_vals_double_1)/ (work_vals_double_0) - tempIcalcImag; // Imaginary part of deltaI, left hand side of equation (11)
-									}
+								//Deflag the island locker, though not really needed
+								NR_solver_working = false;
 
-									//Accumulate in any saturation current values as well, while we're here
-									if (NR_busdata[indexer].BusSatTerm != NULL)
-									{
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+ powerflow_values->BA_diag[indexer].size + jindex] -= NR_busdata[indexer].BusSatTerm[jindex].Re();
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] -= NR_busdata[indexer].BusSatTerm[jindex].Im();
-									}
-								}
-								else
-								{
-									if (NR_busdata[indexer].BusHistTerm != NULL)	//See if extra deltamode term needs to be included
-									{
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + jindex] = NR_busdata[indexer].BusHistTerm[jindex].Re();
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] = NR_busdata[indexer].BusHistTerm[jindex].Im();
-									}
-									else
-									{
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + jindex] = 0.0;
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] = 0.0;
-									}
+								//Exit
+								return 0;
+							}
+					}//end phase switch/case
 
-									//Accumulate in any saturation current values as well, while we're here
-									if (NR_busdata[indexer].BusSatTerm != NULL)
-									{
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+ powerflow_values->BA_diag[indexer].size + jindex] -= NR_busdata[indexer].BusSatTerm[jindex].Re();
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + jindex] -= NR_busdata[indexer].BusSatTerm[jindex].Im();
-									}
-								}
-							}//End normal bus handling
-						}//End three-phase or variant thereof
-					}//End delta_I for each phase row
+					//Flag as success
+					*bad_computations = false;
+					mesh_imped_vals->return_code = 1;
 
-					//Call the overall current injection update for compatible objects (mostly deltamode Norton-equivalent generators)
-					//See if this particular bus has any "current injection update" requirements - semi-silly to do this for SWING-enabled buses, but makes the code more consistent
-					if ((bus[indexer].ExtraCurrentInjFunc != NULL) && ((bus[indexer].type == 0) || ((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == false))))
+					//Exit
+					return 1;	//Non-zero, so success (manual checks outside though)
+				}//End "just mesh impedance calculations"
+				else	//Nulled, "normal" powerflow
+				{
+					//Chord Newton - reuse the retained factors if the system is unchanged and convergence hasn't degraded
+					//An admittance change forces a new factorization on the first iteration of the solution
+					//Without chord Newton, the factors are only reused for the linearized screening update
+					if ((chord_active == true) && (curr_island_superLU_vars->factors_valid == true) && (curr_island_superLU_vars->refactor_needed == false) && (curr_island_superLU_vars->factor_m == m) && (curr_island_superLU_vars->factor_nnz == (unsigned int)nnz) && (((NR_chord_newton == true) && ((chord_admit_changed == false) || (powerflow_values->island_matrix_values[island_loop_index].iteration_count > 0))) || (linear_active == true)))
 					{
-						//Call the function
-						call_return_status = ((STATUS (*)(OBJECT *,int64))(*bus[indexer].ExtraCurrentInjFunc))(bus[indexer].ExtraCurrentInjFuncObject,powerflow_values->island_matrix_values[island_loop_index].iteration_count);
-
-						//Make sure it worked
-						if (call_return_status == FAILED)
-						{
-							GL_THROW("External current injection update failed for device %s",bus[indexer].ExtraCurrentInjFuncObject->name ? bus[indexer].ExtraCurrentInjFuncObject->name : "Unnamed");
-							/*  TROUBLESHOOT
-							While attempting to perform the external current injection update function call, something failed.  Please try again.
-							If the error persists, please submit your code and a bug report via the ticketing system.
-							*/
-						}
-						//Default else - it worked
+						chord_reused = true;
+						chord_factors_held = true;
+						linear_update = linear_active;
+					}
+					else
+					{
+						//Any new factorization overwrites the permutations of the retained one
+						NR_chord_release(curr_island_superLU_vars);
 					}
 
-					//Add in generator current amounts, if relevant
-					if (powerflow_type != PF_NORMAL)
+	#ifdef MT
+					//superLU_MT commands
+
+					if (chord_reused == true)
 					{
-						//Secondary check - see if it is even needed - basically built around 3-phase right now (checks)
-						if ((*bus[indexer].dynamics_enabled==true) && (bus[indexer].DynCurrent != NULL))
-						{
-							//See if we're a Norton-equivalent generator
-							if (bus[indexer].full_Y != NULL)
-							{
-								if ((bus[indexer].phases & 0x07) == 0x07)	//Make sure is three-phase
-								{
-									//Only update in particular mode - SWING bus values should still be treated as such
-									if ((powerflow_values->island_matrix_values[island_loop_index].swing_is_a_swing == true) && (powerflow_type == PF_DYNINIT) && (bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == true))	//Really only true for PF_DYNINIT anyways
-									{
-										//Power should be all updated, now update current values
-										temp_complex_0 += complex((*bus[indexer].PGenTotal).Re(),-(*bus[indexer].PGenTotal).Im()); // total generated power injected conjugated
+						//Just the triangular solves
+						StatAlloc(n, NR_superLU_procs, sp_ienv(1), sp_ienv(2), &chord_stat);
+						StatInit(n, NR_superLU_procs, &chord_stat);
 
-										//Compute Ii
-										if (temp_complex_1.Mag() > 0.0)	//Non zero
-										{
-											temp_complex_2 = temp_complex_0/temp_complex_1;	//Forms Ii
+						dgstrs(NOTRANS, &curr_island_superLU_vars->L_LU, &curr_island_superLU_vars->U_LU, curr_island_superLU_vars->perm_r, curr_island_superLU_vars->perm_c, &curr_island_superLU_vars->B_LU, &chord_stat, &powerflow_values->island_matrix_values[island_loop_index].solver_info);
 
-											//Now convert Ii to the individual phase amounts
-											bus[indexer].DynCurrent[0] = temp_complex_2;
-											bus[indexer].DynCurrent[1] = temp_complex_2*avalsq;
-											bus[indexer].DynCurrent[2] = temp_complex_2*aval;
-										}
-										else	//Must make zero
-										{
-											bus[indexer].DynCurrent[0] = complex(0.0,0.0);
-											bus[indexer].DynCurrent[1] = complex(0.0,0.0);
-											bus[indexer].DynCurrent[2] = complex(0.0,0.0);
-										}
-									}//End SWING is still swing, otherwise should just accumulate what it had
+						StatFree(&chord_stat);
+					}
+					else
+					{
+						//Populate perm_c
+						get_perm_c(1, &curr_island_superLU_vars->A_LU, curr_island_superLU_vars->perm_c);
 
-									//Don't get added in as part of "normal swing" routine
-									if ((bus[indexer].type == 0) || ((bus[indexer].type>1) && (bus[indexer].swing_functions_enabled == false)))
-									{
-										//Add these into the system - added because "generation"
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[0].Re();		//Phase A
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] += bus[indexer].DynCurrent[1].Re();	//Phase B
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 2] += bus[indexer].DynCurrent[2].Re();	//Phase C
+						//Solve the system
+						pdgssv(NR_superLU_procs, &curr_island_superLU_vars->A_LU, curr_island_superLU_vars->perm_c, curr_island_superLU_vars->perm_r, &L_LU, &U_LU, &curr_island_superLU_vars->B_LU, &powerflow_values->island_matrix_values[island_loop_index].solver_info);
+					}
+	#else
+					//sequential superLU
 
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[0].Im();		//Phase A
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] += bus[indexer].DynCurrent[1].Im();	//Phase B
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 2] += bus[indexer].DynCurrent[2].Im();	//Phase C
-									}
-									//Defaulted else - leave as they were
-								}//End three-phase
-								else if ((bus[indexer].phases & 0x80) == 0x80)	//Triplex
-								{
-									//Duplicate of the three-phase code, just tweaked for triplex implementaiton
+					StatInit ( &stat );
 
-									//Only update in particular mode - SWING bus values should still be treated as such
-									if ((powerflow_values->island_matrix_values[island_loop_index].swing_is_a_swing == true) && (powerflow_type == PF_DYNINIT) && (bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == true))	//Really only true for PF_DYNINIT anyways
-									{
-										//Power should be all updated, now update current values
-										temp_complex_0 += complex((*bus[indexer].PGenTotal).Re(),-(*bus[indexer].PGenTotal).Im()); // total generated power injected conjugated
+					if (chord_reused == true)
+					{
+						//Just the triangular solves
+						dgstrs(NOTRANS, &curr_island_superLU_vars->L_LU, &curr_island_superLU_vars->U_LU, curr_island_superLU_vars->perm_c, curr_island_superLU_vars->perm_r, &curr_island_superLU_vars->B_LU, &stat, &powerflow_values->island_matrix_values[island_loop_index].solver_info);
+					}
+					else
+					{
+						// solve the system
+						dgssv(&options, &curr_island_superLU_vars->A_LU, curr_island_superLU_vars->perm_c, curr_island_superLU_vars->perm_r, &L_LU, &U_LU, &curr_island_superLU_vars->B_LU, &stat, &powerflow_values->island_matrix_values[island_loop_index].solver_info);
+					}
+	#endif
 
-										//Compute Ii
-										if (temp_complex_1.Mag() > 0.0)	//Non zero
-										{
-											temp_complex_2 = temp_complex_0/temp_complex_1;	//Forms Ii
+					if (chord_reused == false)
+					{
+						if (powerflow_type == PF_NORMAL)
+						{
+							NR_factorization_count++;
+						}
 
-											//Just store Ii - no need to convert what is a single-phase representation!
-											bus[indexer].DynCurrent[0] = temp_complex_2;
-										}
-										else	//Must make zero
-										{
-											bus[indexer].DynCurrent[0] = complex(0.0,0.0);
-										}
-									}//End SWING is still swing, otherwise should just accumulate what it had
+						//Keep the new factors for later iterations and timesteps
+						if ((chord_active == true) && (powerflow_values->island_matrix_values[island_loop_index].solver_info == 0))
+						{
+							curr_island_superLU_vars->L_LU = L_LU;
+							curr_island_superLU_vars->U_LU = U_LU;
+							curr_island_superLU_vars->factors_valid = true;
+							curr_island_superLU_vars->refactor_needed = false;
+							curr_island_superLU_vars->factor_m = m;
+							curr_island_superLU_vars->factor_nnz = nnz;
+
+							chord_factors_held = true;
+						}
+					}
 
-									//Don't get added in as part of "normal swing" routine
-									if ((bus[indexer].type == 0) || ((bus[indexer].type>1) && (bus[indexer].swing_functions_enabled == false)))
-									{
-										//See what kind of triplex we are
-										if ((bus[indexer].phases & 0x20) == 0x20)	//SPCT "exception"
-										{
-											//Add these into the system - added because "generation" - assumption is it is a flow between 1 and 2
-											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] -= bus[indexer].DynCurrent[0].Re();		//Phase 1
-											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] += bus[indexer].DynCurrent[0].Re();	//Phase 2
+					sol_LU = (double*) ((DNformat*) curr_island_superLU_vars->B_LU.Store)->nzval;
+				}
+			}
+			else if (matrix_solver_method==MM_EXTERN)
+			{
+				//General error check right now -- mesh fault current may not work properly
+				if (mesh_imped_vals != NULL)
+				{
+					gl_error("solver_nr: Mesh impedance attempted from unsupported LU solver");
+					/* TROUBLESHOOT
+					The mesh fault current impedance "pull" was selected, but for the external LU
+					solver.  This is unsupported at this time.  To use the mesh fault current capabilities,
+					please use the superLU solver.
+					*/
 
-											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] -= bus[indexer].DynCurrent[0].Im();		//Phase 1
-											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] += bus[indexer].DynCurrent[0].Im();	//Phase 2
-										}
-										else	//Standard triplex
-										{
-											//Add these into the system - added because "generation" - assumption is it is a flow between 1 and 2
-											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[0].Re();		//Phase 1
-											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] -= bus[indexer].DynCurrent[0].Re();	//Phase 2
+					//Set return code
+					mesh_imped_vals->return_code = 2;
 
-											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[0].Im();		//Phase 1
-											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] -= bus[indexer].DynCurrent[0].Im();	//Phase 2
-										}
-									}
-									//Defaulted else - leave as they were
-								}
-								else if ((bus[indexer].phases & 0x07) != 0x00)	//Some type of phasing
-								{
-									//SWING update functionality is not in here, just "normal"
-									//Don't get added in as part of "normal swing" routine
-									if (bus[indexer].type == 0)	//"SWING not a SWING" was here, but given the exception to being a SWING, it isn't needed here
-									{
-										//Figure out "where/what" to add
-										//Case it out by phases
-										switch (bus[indexer].phases & 0x07)	{
-											case 0x01:	//C
-												{
-													//Add these into the system - added because "generation"
-													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[2].Re();		//Phase C
-													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[2].Im();		//Phase C
-													break;
-												}//end 0x01
-											case 0x02:	//B
-												{
-													//Add these into the system - added because "generation"
-													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[1].Re();		//Phase B
-													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[1].Im();		//Phase B
-													break;
-												}
-											case 0x03:	//BC
-												{
-													//Add these into the system - added because "generation"
-													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[1].Re();		//Phase C
-													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] += bus[indexer].DynCurrent[2].Re();	//Phase C
+					//Perform the clean up - external LU destructor routing
+					((void (*)(void *, bool))(LUSolverFcns.ext_destroy))(powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars,powerflow_values->island_matrix_values[island_loop_index].new_iteration_required);
+
+					//Flag bad computations, just because
+					*bad_computations = true;
 
-													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[1].Im();		//Phase B
-													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] += bus[indexer].DynCurrent[2].Im();	//Phase C
-													break;
-												}
-											case 0x04:	//A
-												{
-													//Add these into the system - added because "generation"
-													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[0].Re();		//Phase A
-													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[0].Im();		//Phase A
-													break;
-												}
-											case 0x05:	//AC
-												{
-													//Add these into the system - added because "generation"
-													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[0].Re();		//Phase A
-													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] += bus[indexer].DynCurrent[2].Re();	//Phase C
+					//Deflag us, even though that may be moot here
+					NR_solver_working = false;
 
-													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[0].Im();		//Phase A
-													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] += bus[indexer].DynCurrent[2].Im();	//Phase C
-													break;
-												}
-											case 0x06:	//AB
-												{
-													//Add these into the system - added because "generation"
-													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[0].Re();		//Phase A
-													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] += bus[indexer].DynCurrent[1].Re();	//Phase B
+					//Exit
+					return 0;
+				}
+				//Default else -- not mesh fault mode, so go like normal
 
-													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[0].Im();		//Phase A
-													powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] += bus[indexer].DynCurrent[1].Im();	//Phase B
+				//Call the solver
+				powerflow_values->island_matrix_values[island_loop_index].solver_info = ((int (*)(void *,NR_SOLVER_VARS *, unsigned int, unsigned int))(LUSolverFcns.ext_solve))(powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars,&powerflow_values->island_matrix_values[island_loop_index].matrices_LU,n,1);
 
-													break;
-												}
-											default:	//Don't need an ABC or anything - how would we get here!?!
-												{
-													//Error for good measure
-													GL_THROW("NR: A Norton-equivalent generator had an odd phase combination");
-													/*  TROUBLESHOOT
-													A Norton-equivalent generator attempted to interface via an unknow phase configuration.  Please try again.  If the error
-													persists, please submit your code and a bug report via the ticking/issues system.
-													*/
-												}
-										}//End switch/case
-									}
-									//Defaulted else - leave as they were - some other bustype
-								}
-								else	//Not any of the above
-								{
-									//See if we ever were (reliability call)
-									if ((bus[indexer].origphases & 0x80) == 0x80)
-									{
-										//Zero the only one that should be being used
-										bus[indexer].DynCurrent[0] = complex(0.0,0.0);
-									}
-									else if ((bus[indexer].origphases & 0x07) != 0x00)	//Non-zero original phases, s just zero all
-									{
-										//Just zero it
-										bus[indexer].DynCurrent[0] = complex(0.0,0.0);
-										bus[indexer].DynCurrent[1] = complex(0.0,0.0);
-										bus[indexer].DynCurrent[2] = complex(0.0,0.0);
-									}
-									else	//Never was, just fail out
-									{
-										//Not sure how we ever reach this error check now - leaving for posterity
-										GL_THROW("NR_solver: bus:%s has tried updating deltamode dynamics, but is not three-phase, single-phase, or triplex!",bus[indexer].name);
-										/*  TROUBLESHOOT
-										The NR_solver routine tried update a three-phase current value for a bus that is not
-										a supported phase configuration.  At this time, the deltamode system only supports three-phase,
-										single-phase, and triplex-conected buses for Norton-equivalent generator attachment.
-										*/
-									}
-								}
-							}//End Norton-equivalent call
-							else	//Must be another generator
-							{
-								//Replicate the injection from above -- assume three-phase right now
-								//Don't get added in as part of "normal swing" routine
-								if ((bus[indexer].type == 0) || ((bus[indexer].type>1) && (bus[indexer].swing_functions_enabled == false)))
-								{
-									//Check for three-phase
-									if ((bus[indexer].phases & 0x07) == 0x07)
-									{
-										//Add these into the system - added because "generation"
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[0].Re();		//Phase A
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] += bus[indexer].DynCurrent[1].Re();	//Phase B
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 2] += bus[indexer].DynCurrent[2].Re();	//Phase C
+				//Point the solution to the proper place
+				sol_LU = powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rhs_LU;
+			}
+			else
+			{
+				GL_THROW("Invalid matrix solution method specified for NR solver!");
+				/*  TROUBLESHOOT
+				An invalid matrix solution method was selected for the Newton-Raphson solver method.
+				Valid options are the superLU solver or an external solver.  Please select one of these methods.
+				*/
+			}
 
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[0].Im();		//Phase A
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] += bus[indexer].DynCurrent[1].Im();	//Phase B
-										powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 2] += bus[indexer].DynCurrent[2].Im();	//Phase C
-									}
-									else if ((bus[indexer].phases & 0x80) == 0x80)
-									{
-										//Add these into the system - added because "generation"
-										//Assume is a 1-2 connection (1 flowing into 2)
+			//Update bus voltages - check convergence while we're here
+			powerflow_values->island_matrix_values[island_loop_index].max_mismatch_converge = 0;
 
-										//See what kind of triplex we are
-										if ((bus[indexer].phases & 0x20) == 0x20) //SPCT "special"
-										{
-											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] -= bus[indexer].DynCurrent[0].Re();		//Phase 1
-											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] += bus[indexer].DynCurrent[0].Re();	//Phase 2
+			temp_index = -1;
+			temp_index_b = -1;
+			powerflow_values->island_matrix_values[island_loop_index].new_iteration_required = false;	//Reset iteration requester flag - defaults to not needing another
 
-											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] -= bus[indexer].DynCurrent[0].Im();		//Phase 1
-											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] += bus[indexer].DynCurrent[0].Im();	//Phase 2
-										}
-										else	//"Standard"
-										{
-											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[0].Re();		//Phase 1
-											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] -= bus[indexer].DynCurrent[0].Re();	//Phase 2
+			for (indexer=0; indexer<bus_count; indexer++)
+			{
+				//See if we're part of the relevant island
+				if (bus[indexer].island_number == island_loop_index)
+				{
+					//Avoid swing bus updates on normal runs
+					if ((bus[indexer].type == 0) || ((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == false)))
+					{
+						//Figure out the offset we need to be for each phase
+						if ((bus[indexer].phases & 0x80) == 0x80)	//Split phase
+						{
+							//Pull the two updates (assume split-phase is always 2)
+							DVConvCheck[0]=complex(sol_LU[2*bus[indexer].Matrix_Loc],sol_LU[(2*bus[indexer].Matrix_Loc+2)]);
+							DVConvCheck[1]=complex(sol_LU[(2*bus[indexer].Matrix_Loc+1)],sol_LU[(2*bus[indexer].Matrix_Loc+3)]);
+							bus[indexer].V[0] += DVConvCheck[0];
+							bus[indexer].V[1] += DVConvCheck[1];	//Negative due to convention
+							
+							//Pull off the magnitude (no sense calculating it twice)
+							CurrConvVal=DVConvCheck[0].Mag();
+							if (CurrConvVal > powerflow_values->island_matrix_values[island_loop_index].max_mismatch_converge)	//Update our convergence check if it is bigger
+								powerflow_values->island_matrix_values[island_loop_index].max_mismatch_converge=CurrConvVal;
 
-											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[0].Im();		//Phase 1
-											powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] -= bus[indexer].DynCurrent[0].Im();	//Phase 2
+							if (CurrConvVal > bus[indexer].max_volt_error)	//Check for convergence
+								powerflow_values->island_matrix_values[island_loop_index].new_iteration_required=true;								//Flag that a new iteration must occur
+
+							CurrConvVal=DVConvCheck[1].Mag();
+							if (CurrConvVal > powerflow_values->island_matrix_values[island_loop_index].max_mismatch_converge)	//Update our convergence check if it is bigger
+								powerflow_values->island_matrix_values[island_loop_index].max_mismatch_converge=CurrConvVal;
+
+							if (CurrConvVal > bus[indexer].max_volt_error)	//Check for convergence
+								powerflow_values->island_matrix_values[island_loop_index].new_iteration_required=true;								//Flag that a new iteration must occur
+						}//end split phase update
+						else										//Not split phase
+						{
+							for ( jindex = 0 ; jindex < powerflow_values->BA_diag[indexer].size ; jindex++ )	//parse through the phases
+							{
+								switch(bus[indexer].phases & 0x07) {
+									case 0x01:	//C
+										{
+											temp_index=0;
+											temp_index_b=2;
+											break;
 										}
-									}
-									else if ((bus[indexer].phases & 0x07) != 0x00)	//It has something on it
+									case 0x02:	//B
 										{
-										//SWING update functionality is not in here, just "normal"
-										//Don't get added in as part of "normal swing" routine
-										if (bus[indexer].type == 0)	//"SWING not a SWING" was here, but given the exception to being a SWING, it isn't needed here
+											temp_index=0;
+											temp_index_b=1;
+											break;
+										}
+									case 0x03:	//BC
 										{
-											//Figure out "where/what" to add
-											//Case it out by phases
-											switch (bus[indexer].phases & 0x07)	{
-												case 0x01:	//C
-													{
-														//Add these into the system - added because "generation"
-														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[2].Re();		//Phase C
-														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[2].Im();		//Phase C
-														break;
-													}//end 0x01
-												case 0x02:	//B
-													{
-														//Add these into the system - added because "generation"
-														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[1].Re();		//Phase B
-														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[1].Im();		//Phase B
-														break;
-													}
-												case 0x03:	//BC
-													{
-														//Add these into the system - added because "generation"
-														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[1].Re();		//Phase C
-														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] += bus[indexer].DynCurrent[2].Re();	//Phase C
-
-														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[1].Im();		//Phase B
-														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] += bus[indexer].DynCurrent[2].Im();	//Phase C
-														break;
-													}
-												case 0x04:	//A
-													{
-														//Add these into the system - added because "generation"
-														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[0].Re();		//Phase A
-														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[0].Im();		//Phase A
-														break;
-													}
-												case 0x05:	//AC
-													{
-														//Add these into the system - added because "generation"
-														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[0].Re();		//Phase A
-														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] += bus[indexer].DynCurrent[2].Re();	//Phase C
-
-														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[0].Im();		//Phase A
-														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] += bus[indexer].DynCurrent[2].Im();	//Phase C
-														break;
-													}
-												case 0x06:	//AB
-													{
-														//Add these into the system - added because "generation"
-														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size] += bus[indexer].DynCurrent[0].Re();		//Phase A
-														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size + 1] += bus[indexer].DynCurrent[1].Re();	//Phase B
-
-														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc] += bus[indexer].DynCurrent[0].Im();		//Phase A
-														powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[2*bus[indexer].Matrix_Loc + 1] += bus[indexer].DynCurrent[1].Im();	//Phase B
+											if (jindex==0)	//B
+											{
+												temp_index=0;
+												temp_index_b=1;
+											}
+											else			//C
+											{
+												temp_index=1;
+												temp_index_b=2;
+											}
 
-														break;
-													}
-												default:	//Don't need an ABC or anything - how would we get here!?!
-													{
-														//Error for good measure
-														GL_THROW("NR: A Norton-equivalent generator had an odd phase combination");
-														//Defined above
-													}
-											}//End switch/case
+											break;
+										}
+									case 0x04:	//A
+										{
+											temp_index=0;
+											temp_index_b=0;
+											break;
 										}
-										//Defaulted else - leave as they were - some other bustype
+									case 0x05:	//AC
+										{
+											if (jindex==0)	//A
+											{
+												temp_index=0;
+												temp_index_b=0;
+											}
+											else			//C
+											{
+												temp_index=1;
+												temp_index_b=2;
+											}
+											break;
+										}
+									case 0x06:	//AB
+									case 0x07:	//ABC
+										{
+											temp_index = jindex;
+											temp_index_b = jindex;
+											break;
+										}
+								}//end phase switch/case
 
-									}
-									//Default else - should probably just be zero anyways
+								if (((int)temp_index==-1) || ((int)temp_index_b==-1))
+								{
+									GL_THROW("NR: An error occurred indexing voltage updates");
+									/*  TROUBLESHOOT
+									While attempting to create the voltage update indices for the
+									Newton-Raphson solver, an error was encountered.  Please submit
+									your code and a bug report using the trac website.
+									*/
 								}
-								//Defaulted else - leave as they were - if it is still a swing, this is all moot anyways
-							}//End other generator delta call
-						}//End extra current adds
-					}//End dynamic (generator postings)
-				}//End part of this island check
-				//Default else -- not in this island, so skip us!
-			}//End delta_I for each bus
-
-			//Call the load subfunction - flag for Jacobian update
-			compute_load_values(bus_count,bus,powerflow_values,true,island_loop_index);
 
-			//Build the dynamic diagonal elements of 6n*6n Y matrix. All the elements in this part will be updated at each iteration.
+								DVConvCheck[jindex]=complex(sol_LU[(2*bus[indexer].Matrix_Loc+temp_index)],sol_LU[(2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size+temp_index)]);
+								bus[indexer].V[temp_index_b] += DVConvCheck[jindex];
+								
+								//Pull off the magnitude (no sense calculating it twice)
+								CurrConvVal=DVConvCheck[jindex].Mag();
 
-			//Reset it
-			powerflow_values->island_matrix_values[island_loop_index].size_diag_update = 0;
+								if (CurrConvVal > bus[indexer].max_volt_error)	//Check for convergence
+									powerflow_values->island_matrix_values[island_loop_index].new_iteration_required=true;								//Flag that a new iteration must occur
 
-			//Adjust it
-			for (jindexer=0; jindexer<bus_count;jindexer++) 
-			{
-				//Check our relevance to this matrix
-				if (bus[jindexer].island_number == island_loop_index)
-				{
-					if  (bus[jindexer].type != 1)	//PV bus ignored (for now?)
-						powerflow_values->island_matrix_values[island_loop_index].size_diag_update += powerflow_values->BA_diag[jindexer].size; 
-					//Defaulted else - PV bus ignored
-				}
-				//Default else -- different island, skip for now
-			}
-			
-			if (powerflow_values->island_matrix_values[island_loop_index].Y_diag_update == NULL)
-			{
-				powerflow_values->island_matrix_values[island_loop_index].Y_diag_update = (Y_NR *)gl_malloc((4*powerflow_values->island_matrix_values[island_loop_index].size_diag_update) *sizeof(Y_NR));   //powerflow_values->island_matrix_values[island_loop_index].Y_diag_update store the row,column and value of the dynamic part of the diagonal PQ bus elements of 6n*6n Y_NR matrix.
+								if (CurrConvVal > powerflow_values->island_matrix_values[island_loop_index].max_mismatch_converge)	//See if the current differential is the largest found so far or not
+									powerflow_values->island_matrix_values[island_loop_index].max_mismatch_converge = CurrConvVal;	//It is, store it
 
-				//Make sure it worked
-				if (powerflow_values->island_matrix_values[island_loop_index].Y_diag_update == NULL)
-					GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
+							}//End For loop for phase traversion
+						}//End not split phase update
+					}//end if not swing
+					//Default else -- this must be the swing and in a valid interval
+				}//End "in the island"
+				//Default else - not in the island, skip it
+			}//End bus traversion
 
-				//Update maximum size
-				powerflow_values->island_matrix_values[island_loop_index].max_size_diag_update = powerflow_values->island_matrix_values[island_loop_index].size_diag_update;
-			}
-			else if (powerflow_values->island_matrix_values[island_loop_index].size_diag_update > powerflow_values->island_matrix_values[island_loop_index].max_size_diag_update)	//We've exceeded our limits
+			//Perform saturation current update/convergence check
+			//******************** FIGURE OUT HOW TO DO THIS BETTER - This is very inefficient!***********************//
+			if ((enable_inrush_calculations == true) && (deltatimestep_running > 0))	//Don't even both with this if inrush not on
 			{
-				//Disappear the old one
-				gl_free(powerflow_values->island_matrix_values[island_loop_index].Y_diag_update);
-
-				//Make a new one in its image
-				powerflow_values->island_matrix_values[island_loop_index].Y_diag_update = (Y_NR *)gl_malloc((4*powerflow_values->island_matrix_values[island_loop_index].size_diag_update) *sizeof(Y_NR));
-
-				//Make sure it worked
-				if (powerflow_values->island_matrix_values[island_loop_index].Y_diag_update == NULL)
-					GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
-
-				//Update the size
-				powerflow_values->island_matrix_values[island_loop_index].max_size_diag_update = powerflow_values->island_matrix_values[island_loop_index].size_diag_update;
-
-				//Flag for a realloc
-				powerflow_values->island_matrix_values[island_loop_index].NR_realloc_needed = true;
-			}
-
-			indexer = 0;	//Rest positional counter
+				//Start out assuming the convergence is true (reiter is false)
+				powerflow_values->island_matrix_values[island_loop_index].SaturationMismatchPresent = false;
 
-			for ( jindexer = 0 ; jindexer < bus_count ; jindexer++ )	//Parse through bus list
-			{
-				//See if we're part of the currently progressing island -- if not, skip us
-				if (bus[jindexer].island_number == island_loop_index)
+				//Loop through all branches -- inefficient, but meh
+				for (indexer=0; indexer<branch_count; indexer++)
 				{
-					if ((bus[jindexer].type > 1) && (bus[jindexer].swing_functions_enabled == true))	//Swing bus - and we aren't ignoring it
-					{
-						for ( jindex = 0 ; jindex < powerflow_values->BA_diag[jindexer].size ; jindex++ )
-						{
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind = 2*bus[jindexer].Matrix_Loc + jindex;
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].col_ind = powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind;
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].Y_value = 1e10; // swing bus gets large admittance
-							indexer += 1;
-
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind = 2*bus[jindexer].Matrix_Loc + jindex;
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].col_ind = powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind + powerflow_values->BA_diag[jindexer].size;
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].Y_value = (powerflow_values->BA_diag[jindexer].Y[jindex][jindex]).Re();	//Normal admittance portion
-							indexer += 1;
-
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind = 2*bus[jindexer].Matrix_Loc + jindex + powerflow_values->BA_diag[jindexer].size;
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].col_ind = powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind - powerflow_values->BA_diag[jindexer].size;
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].Y_value = (powerflow_values->BA_diag[jindexer].Y[jindex][jindex]).Re();	//Normal admittance portion
-							indexer += 1;
-
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind = 2*bus[jindexer].Matrix_Loc + jindex + powerflow_values->BA_diag[jindexer].size;
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].col_ind = powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind;
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].Y_value = 1e10; // swing bus gets large admittance
-							indexer += 1;
-						}//End swing bus traversion
-					}//End swing bus
-
-					if ((bus[jindexer].type == 0) || ((bus[jindexer].type > 1) && bus[jindexer].swing_functions_enabled == false))	//Only do on PQ (or SWING masquerading as PQ)
+					//See if this branch is associated with this island
+					if (branch[indexer].island_number == island_loop_index)
 					{
-						for ( jindex = 0 ; jindex < powerflow_values->BA_diag[jindexer].size ; jindex++ )
+						//See if the function exists
+						if (branch[indexer].ExtraDeltaModeFunc != NULL)
 						{
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind = 2*bus[jindexer].Matrix_Loc + jindex;
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].col_ind = powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind;
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].Y_value = (powerflow_values->BA_diag[jindexer].Y[jindex][jindex]).Im() + bus[jindexer].Jacob_A[jindex]; // Equation(14)
-							indexer += 1;
-							
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind = 2*bus[jindexer].Matrix_Loc + jindex;
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].col_ind = powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind + powerflow_values->BA_diag[jindexer].size;
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].Y_value = (powerflow_values->BA_diag[jindexer].Y[jindex][jindex]).Re() + bus[jindexer].Jacob_B[jindex]; // Equation(15)
-							indexer += 1;
-							
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind = 2*bus[jindexer].Matrix_Loc + jindex + powerflow_values->BA_diag[jindexer].size;
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].col_ind = 2*bus[jindexer].Matrix_Loc + jindex;
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].Y_value = (powerflow_values->BA_diag[jindexer].Y[jindex][jindex]).Re() + bus[jindexer].Jacob_C[jindex]; // Equation(16)
-							indexer += 1;
-							
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind = 2*bus[jindexer].Matrix_Loc + jindex + powerflow_values->BA_diag[jindexer].size;
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].col_ind = powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind;
-							powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].Y_value = -(powerflow_values->BA_diag[jindexer].Y[jindex][jindex]).Im() + bus[jindexer].Jacob_D[jindex]; // Equation(17)
-							indexer += 1;
-						}//end PQ phase traversion
-					}//End PQ bus
-				}//End island relevance check
-			}//End bus parse list
+							//Call the function
+							func_result_val = ((int (*)(OBJECT *,bool *))(*branch[indexer].ExtraDeltaModeFunc))(branch[indexer].obj,&(powerflow_values->island_matrix_values[island_loop_index].SaturationMismatchPresent));
 
-			// Build the Amatrix, Amatrix includes all the elements of Y_offdiag_PQ, Y_diag_fixed and Y_diag_update.
-			powerflow_values->island_matrix_values[island_loop_index].size_Amatrix = powerflow_values->island_matrix_values[island_loop_index].size_offdiag_PQ*2 + powerflow_values->island_matrix_values[island_loop_index].size_diag_fixed*2 + 4*powerflow_values->island_matrix_values[island_loop_index].size_diag_update;
+							//Make sure it worked
+							if (func_result_val != 1)
+							{
+								GL_THROW("Extra delta update failed for device %s",branch[indexer].name ? branch[indexer].name : "Unnamed");
+								/*  TROUBLESHOOT
+								While attempting to perform the extra deltamode update, something failed.  Please try again.
+								If the error persists, please submit your code and a bug report via the ticketing system.
+								*/
+							}
+							//Default else -- it worked, keep going
+						}
+						//Default else - is NULL
+					}
+					//Default else -- not part of this island, so don't mess with it
+				}//End inefficient branch traversion
+			}//End in-rush and deltamode running
 
-			//Test to make sure it isn't an empty matrix - reliability induced 3-phase fault
-			if (powerflow_values->island_matrix_values[island_loop_index].size_Amatrix==0)
+			//Additional checks for special modes - only needs to happen in first dynamics powerflow
+			if (powerflow_type == PF_DYNINIT)
 			{
-				//Figure out which message to send
-				if (NR_islands_detected > 1)
-				{
-					gl_warning("Empty powerflow connectivity matrix for island %d, your system is empty!",(island_loop_index+1));
-					/*  TROUBLESHOOT
-					Newton-Raphson has an empty admittance matrix that it is trying to solve.  Either the whole system
-					faulted, or something is not properly defined.  Please try again.  If the problem persists, please
-					submit your code and a bug report via the trac website.
-					*/
-				}
-				else	//Single island
+				//See what "mode" we're in
+				if (powerflow_values->island_matrix_values[island_loop_index].new_iteration_required == false)	//Overall powerflow has converged
 				{
-					gl_warning("Empty powerflow connectivity matrix, your system is empty!");
-					/*  TROUBLESHOOT
-					Newton-Raphson has an empty admittance matrix that it is trying to solve.  Either the whole system
-					faulted, or something is not properly defined.  Please try again.  If the problem persists, please
-					submit your code and a bug report via the trac website.
-					*/
-				}
-
-				//Set our return code, like success
-				powerflow_values->island_matrix_values[island_loop_index].return_code = 0;
+					if (powerflow_values->island_matrix_values[island_loop_index].swing_converged == false)	//See if deltaI_sym is being met
+					{
+						//See which message to print
+						if (NR_islands_detected > 1)
+						{
+							//Give a verbose message, just cause
+							gl_verbose("NR_Solver: swing bus failed balancing criteria on island %d - making it a PQ for future dynamics",(island_loop_index+1));
+						}
+						else	//Single system
+						{
+							//Give a verbose message, just cause
+							gl_verbose("NR_Solver: swing bus failed balancing criteria - making it a PQ for future dynamics");
+						}
 
-				//Figure out next steps - routine copied from the end of the iteration loop
+						//See if we're still swing_is_a_swing mode
+						if (powerflow_values->island_matrix_values[island_loop_index].swing_is_a_swing == true)
+						{
+							//Deflag us
+							powerflow_values->island_matrix_values[island_loop_index].swing_is_a_swing = false;
 
-				//See if we need to continue
-				if (island_loop_index >= (NR_islands_detected - 1))	//We're the last one
-				{
-					//Set the flag to be done
-					still_iterating_islands = false;
-				}
-				else	//Not last -- increment the counter and onwards
-				{
-					//Increment the counter
-					island_loop_index++;
+							//Loop through and deflag appropriate swing buses
+							for (indexer=0; indexer<bus_count; indexer++)
+							{
+								//See if we're in the "island of interest"
+								if (bus[indexer].island_number == island_loop_index)
+								{
+									//See if we're a swing-flagged bus
+									if ((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == true))
+									{
+										//See if we're "generator ready"
+										if ((*bus[indexer].dynamics_enabled==true) && (bus[indexer].DynCurrent != NULL))
+										{
+											//Deflag us back to "PQ" status
+											bus[indexer].swing_functions_enabled = false;
 
-					//Force the flag, just to be paranoid
-					still_iterating_islands = true;
+											//Force a reiteration
+											powerflow_values->island_matrix_values[island_loop_index].new_iteration_required=true;
+										}
+									}
+									//Default else -- normal bus
+								}//End Island check
+								//Default else -- not in the current relevant island
+							}//End bus traversion loop
+						}
+						//Default else - if we're out of symmetry bounds, but already hit close, good enough
+					}
+					//Defaulted else - we're converged on all fronts, huzzah!
 				}
+				//Default else - still need to iterate
+			}//End special convergence criterion
 
-				//Continue the while (or attempt to do so)
-				continue;
+			//Check Saturation mismatch 
+			if (powerflow_values->island_matrix_values[island_loop_index].SaturationMismatchPresent == true)
+			{
+				//Force a reiter
+				powerflow_values->island_matrix_values[island_loop_index].new_iteration_required = true;
 			}
+			//Default else -- either no saturation, or it has converged - leave it be
 
-			if (powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix == NULL)
+			//Turn off reallocation flag no matter what
+			powerflow_values->island_matrix_values[island_loop_index].NR_realloc_needed = false;
+
+			if (matrix_solver_method==MM_SUPERLU)
 			{
-				powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix = (SPARSE*) gl_malloc(sizeof(SPARSE));
+				//Chord Newton - if the retained factors didn't reduce the mismatch enough, refactor on the next iteration
+				if (chord_active == true)
+				{
+					if ((chord_reused == true) && (powerflow_values->island_matrix_values[island_loop_index].iteration_count > 0) && (powerflow_values->island_matrix_values[island_loop_index].max_mismatch_converge > (NR_chord_refactor_ratio * curr_island_superLU_vars->last_mismatch)))
+					{
+						curr_island_superLU_vars->refactor_needed = true;
+					}
 
-				//Make sure it worked
-				if (powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix == NULL)
-					GL_THROW("NR: Failed to allocate memory for one of the necessary matrices");
+					curr_island_superLU_vars->last_mismatch = powerflow_values->island_matrix_values[island_loop_index].max_mismatch_converge;
+				}
 
-				//Initiliaze it
-				sparse_init(powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix, powerflow_values->island_matrix_values[island_loop_index].size_Amatrix, 6*powerflow_values->island_matrix_values[island_loop_index].bus_count);
-			}
-			else if (powerflow_values->island_matrix_values[island_loop_index].NR_realloc_needed)	//If one of the above changed, we changed too
-			{
-				//Destroy the old version
-				sparse_clear(powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix);
+				//Linearized screening - a linear update is only accepted on the actual current mismatch it leaves,
+				//which is evaluated at the start of the next iteration (see the check after the deltaI calculation)
+				if ((linear_update == true) && (powerflow_values->island_matrix_values[island_loop_index].solver_info == 0))
+				{
+					if (linear_verified == true)	//Mismatch was already within tolerance - this final correction is the solution
+					{
+						powerflow_values->island_matrix_values[island_loop_index].new_iteration_required = false;
+						NR_linear_update_count++;
+					}
+					else if (powerflow_values->island_matrix_values[island_loop_index].new_iteration_required == true)
+					{
+						curr_island_superLU_vars->linear_check = true;
+					}
+					else	//Update was within the voltage tolerance outright, same as a normal convergence
+					{
+						NR_linear_update_count++;
+					}
+				}
 
-				//Create a new 
-				sparse_init(powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix, powerflow_values->island_matrix_values[island_loop_index].size_Amatrix, 6*powerflow_values->island_matrix_values[island_loop_index].bus_count);
+				/* De-allocate storage - superLU matrix types must be destroyed at every iteration, otherwise they balloon fast (65 MB norma becomes 1.5 GB) */
+				//Retained chord factors are kept (and freed when replaced)
+				if (chord_factors_held == false)
+				{
+	#ifdef MT
+					//superLU_MT commands
+					Destroy_SuperNode_SCP(&L_LU);
+					Destroy_CompCol_NCP(&U_LU);
+	#else
+					//sequential superLU commands
+					Destroy_SuperNode_Matrix( &L_LU );
+					Destroy_CompCol_Matrix( &U_LU );
+	#endif
+				}
+	#ifndef MT
+				StatFree ( &stat );
+	#endif
 			}
-			else
+			else if (matrix_solver_method==MM_EXTERN)
 			{
-				//Just clear it out
-				sparse_reset(powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix, 6*powerflow_values->island_matrix_values[island_loop_index].bus_count);
+				//Call destruction routine
+				((void (*)(void *, bool))(LUSolverFcns.ext_destroy))(powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars,powerflow_values->island_matrix_values[island_loop_index].new_iteration_required);
 			}
-
-			//integrate off diagonal components
-			for (indexer=0; indexer<powerflow_values->island_matrix_values[island_loop_index].size_offdiag_PQ*2; indexer++)
+			else	//Not sure how we get here
 			{
-				row = powerflow_values->island_matrix_values[island_loop_index].Y_offdiag_PQ[indexer].row_ind;
-				col = powerflow_values->island_matrix_values[island_loop_index].Y_offdiag_PQ[indexer].col_ind;
-				value = powerflow_values->island_matrix_values[island_loop_index].Y_offdiag_PQ[indexer].Y_value;
-				sparse_add(powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix, row, col, value, bus, bus_count, powerflow_values, island_loop_index);
+				GL_THROW("Invalid matrix solution method specified for NR solver!");
+				//Defined above
 			}
 
-			//Integrate fixed portions of diagonal components
-			for (indexer=0; indexer< (powerflow_values->island_matrix_values[island_loop_index].size_diag_fixed*2); indexer++)
+			//Final check -- see if the info result wasn't zero -- if so, deflag us no matter what here
+			if (powerflow_values->island_matrix_values[island_loop_index].solver_info != 0)
 			{
-				row = powerflow_values->island_matrix_values[island_loop_index].Y_diag_fixed[indexer].row_ind;
-				col = powerflow_values->island_matrix_values[island_loop_index].Y_diag_fixed[indexer].col_ind;
-				value = powerflow_values->island_matrix_values[island_loop_index].Y_diag_fixed[indexer].Y_value;
-				sparse_add(powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix, row, col, value, bus, bus_count, powerflow_values, island_loop_index);
+				powerflow_values->island_matrix_values[island_loop_index].new_iteration_required = false;
 			}
 
-			//Integrate the variable portions of the diagonal components
-			for (indexer=0; indexer< (4*powerflow_values->island_matrix_values[island_loop_index].size_diag_update); indexer++)
-			{
-				row = powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].row_ind;
-				col = powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].col_ind;
-				value = powerflow_values->island_matrix_values[island_loop_index].Y_diag_update[indexer].Y_value;
-				sparse_add(powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix, row, col, value, bus, bus_count, powerflow_values, island_loop_index);
-			}
+			//Set the flag to not continue -- all should be handled below, this is just logic paranoia
+			proceed_to_next_island = false;
 
-			//See if we want to dump out the matrix values
-			if (NRMatDumpMethod != MD_NONE)
+			//Determine how we got here and what the next steps are
+			if (powerflow_values->island_matrix_values[island_loop_index].new_iteration_required == true)	//We think we need a new one
 			{
-				//Code to export the sparse matrix values - useful for debugging issues
-
-				//Reset the flag
-				something_has_been_output = false;
-
-				//Check our frequency
-				if ((NRMatDumpMethod == MD_ALL) || ((NRMatDumpMethod != MD_ALL) && (powerflow_values->island_matrix_values[island_loop_index].iteration_count == 0)))
+				//Make sure we still can iterate - if we hit the iteration limit, we can't
+				if (powerflow_values->island_matrix_values[island_loop_index].iteration_count>=NR_iteration_limit)
 				{
-					//Open the text file - append now
-					FPoutVal=fopen(MDFileName,"at");
-
-					//See if we wanted references - Only do this once per call, regardless (keeps file size down)
-					if ((NRMatReferences == true) && (powerflow_values->island_matrix_values[island_loop_index].iteration_count == 0))
-					{
-						//Print the index information
-						if (NR_islands_detected > 1)
-						{
-							fprintf(FPoutVal,"Matrix Index information for this call in island:%d - start,stop,name\n",(island_loop_index+1));
-						}
-						else
-						{
-							fprintf(FPoutVal,"Matrix Index information for this call - start,stop,name\n");
-						}
-
-						for (indexer=0; indexer<bus_count; indexer++)
-						{
-							//Island check
-							if (bus[indexer].island_number == island_loop_index)
-							{
-								//Extract the start/stop indices
-								jindexer = 2*bus[indexer].Matrix_Loc;
-								kindexer = jindexer + 2*powerflow_values->BA_diag[indexer].size - 1;
-
-								//Print them out
-								fprintf(FPoutVal,"%d,%d,%s\n",jindexer,kindexer,bus[indexer].name);
-
-								//Set the flag
-								something_has_been_output = true;
-							}//End island check
-						}
-
-						//Add in a blank line so it looks pretty
-						fprintf(FPoutVal,"\n");
-					}//End print the references
-
-					//Print the simulation time and iteration number - see how we're running
-					if (deltatimestep_running == -1)	//QSTS
+					powerflow_values->island_matrix_values[island_loop_index].return_code = -(powerflow_values->island_matrix_values[island_loop_index].iteration_count);
+		
+					if (NR_islands_detected > 1)
 					{
-						fprintf(FPoutVal,"Timestamp: %lld - Iteration %lld\n",gl_globalclock,powerflow_values->island_matrix_values[island_loop_index].iteration_count);
+						gl_verbose("Max solver mismatch of failed solution %f on island %d\n",powerflow_values->island_matrix_values[island_loop_index].max_mismatch_converge,(island_loop_index+1));
 					}
 					else
 					{
-						fprintf(FPoutVal,"Timestamp: %f (deltamode) - Iteration %lld\n",gl_globaldeltaclock,powerflow_values->island_matrix_values[island_loop_index].iteration_count);
+						gl_verbose("Max solver mismatch of failed solution %f\n",powerflow_values->island_matrix_values[island_loop_index].max_mismatch_converge);
 					}
 
-					//See if anything wrote out, or we're "all"
-					if ((something_has_been_output == true) || (NRMatDumpMethod == MD_ALL))
-					{
-						//Print size - for parsing ease
-						fprintf(FPoutVal,"Matrix Information - non-zero element count = %d\n",powerflow_values->island_matrix_values[island_loop_index].size_Amatrix);
-						
-						//Print the values - printed as "row index, column index, value"
-						//This particular output is after they have been column sorted for the algorithm
-						//Header
-						fprintf(FPoutVal,"Matrix Information - row, column, value\n");
-
-						//Null temp variable
-						temp_element = NULL;
-
-						//Loop through the columns, extracting starting point each time
-						for (jindexer=0; jindexer<powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix->ncols; jindexer++)
-						{
-							//Extract the column starting point
-							temp_element = powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix->cols[jindexer];
-
-							//Check for nulling
-							if (temp_element != NULL)
-							{
-								//Print this value
-								fprintf(FPoutVal,"%d,%d,%f\n",temp_element->row_ind,jindexer,temp_element->value);
-
-								//Loop
-								while (temp_element->next != NULL)
-								{
-									//Get next element
-									temp_element = temp_element->next;
-
-									//Repeat the print
-									fprintf(FPoutVal,"%d,%d,%f\n",temp_element->row_ind,jindexer,temp_element->value);
-								}
-							}
-							//If it is null, go next.  Implies we have an invalid matrix size, but that may be what we're looking for
-						}//End sparse matrix traversion for dump
-
-						//Print an extra line, so it looks nice for ALL/PERCALL
-						fprintf(FPoutVal,"\n");
-
-						//Output the RHS information, if desired
-						if (NRMatRHSDump == true)
-						{
-							//Get the output size - double size, due to complex separation
-							m = 2*powerflow_values->island_matrix_values[island_loop_index].total_variables;
-
-							//Print the size - should be the matrix size, but put here for ease of use
-							fprintf(FPoutVal,"Matrix RHS Information - %d elements\n",m);
-
-							//Print a header - row information isn't really needed, but include, just for ease of viewing
-							fprintf(FPoutVal,"RHS Information - row, value\n");
+					//We got here, we're done with this island
+					proceed_to_next_island = true;
+				}
+				else	//Normal iteration procedure - update the counter
+				{
+					powerflow_values->island_matrix_values[island_loop_index].iteration_count++;
 
-							//Loop through and output the RHS values
-							for (jindexer=0; jindexer<m; jindexer++)
-							{
-								fprintf(FPoutVal,"%d,%f\n",jindexer,powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[jindexer]);
-							}//End output RHS
+					//Set the overall progression flag
+					proceed_to_next_island = false;
+				}
+			}
+			else	//Should be done
+			{
+				//All paths lead to the next island/completion
+				proceed_to_next_island = true;
 
-							//Print an extra line, just for spacing for ALL/PERCALL
-							fprintf(FPoutVal,"\n");
-						}//end RHS dump, if desired
+				//Report how we think we're done
+				if (powerflow_values->island_matrix_values[island_loop_index].solver_info == 0)	//It was a convergence exit
+				{
+					//See if we're multi-islanded or not
+					if (NR_islands_detected > 1)
+					{
+						gl_verbose("Power flow calculation for island %d converges at Iteration %d \n",(island_loop_index+1),(powerflow_values->island_matrix_values[island_loop_index].iteration_count+1));
 					}
-					else //Nothing written - indicate as much
+					else	//Singular
+					{
+						gl_verbose("Power flow calculation converges at Iteration %d \n",(powerflow_values->island_matrix_values[island_loop_index].iteration_count+1));
+					}
+
+					//Store the value as the return code
+					powerflow_values->island_matrix_values[island_loop_index].return_code = powerflow_values->island_matrix_values[island_loop_index].iteration_count;
+				}
+				else
+				{
+					//Write out the "failure"
+
+					//See which version to write
+					if (NR_islands_detected > 1)
 					{
-						//Print the emptiness
-						fprintf(FPoutVal,"Empty island (possibly powerflow-removed)\n\n");
+						//For superLU - 2 = singular matrix it appears - positive values = process errors (singular, etc), negative values = input argument/syntax error
+						if (matrix_solver_method==MM_SUPERLU)
+						{
+							gl_verbose("superLU failed out of island %d with return value %d",(island_loop_index+1),powerflow_values->island_matrix_values[island_loop_index].solver_info);
+						}
+						else if (matrix_solver_method==MM_EXTERN)
+						{
+							gl_verbose("External LU solver failed out of island %d with return value %d",(island_loop_index+1),powerflow_values->island_matrix_values[island_loop_index].solver_info);
+						}
+						//Defaulted else - shouldn't exist (or make it this far), but if it does, we're failing anyways
 					}
-
-					//Close the file, we're done with it
-					fclose(FPoutVal);
-
-					//See if we were a "ONCE" - if so, deflag us
-					if (NRMatDumpMethod == MD_ONCE)
+					else	//Singular
 					{
-						//See if we're a multi-island -- if so, only do this on the last one
-						if (NR_islands_detected > 1)
+						//For superLU - 2 = singular matrix it appears - positive values = process errors (singular, etc), negative values = input argument/syntax error
+						if (matrix_solver_method==MM_SUPERLU)
 						{
-							//See if we're the last one
-							if (island_loop_index >= (NR_islands_detected - 1))
-							{
-								NRMatDumpMethod = MD_NONE;	//Flag to do no more
-							}
-							//Default else -- we're not the last one, so stay as MD_ONCE
+							gl_verbose("superLU failed out with return value %d",powerflow_values->island_matrix_values[island_loop_index].solver_info);
 						}
-						else
+						else if (matrix_solver_method==MM_EXTERN)
 						{
-							NRMatDumpMethod = MD_NONE;	//Flag to do no more
+							gl_verbose("External LU solver failed out with return value %d",powerflow_values->island_matrix_values[island_loop_index].solver_info);
 						}
+						//Defaulted else - shouldn't exist (or make it this far), but if it does, we're failing anyways
 					}
-				}//End Actual output
-			}//End matrix dump desired
 
-			///* Initialize parameters. */
-			m = 2*powerflow_values->island_matrix_values[island_loop_index].total_variables;
-			n = 2*powerflow_values->island_matrix_values[island_loop_index].total_variables;
-			nnz = powerflow_values->island_matrix_values[island_loop_index].size_Amatrix;
+					//Store the return value as the failure
+					powerflow_values->island_matrix_values[island_loop_index].return_code = 0;
+				}
+			}
 
-			if (powerflow_values->island_matrix_values[island_loop_index].matrices_LU.a_LU == NULL)	//First run
+			//Overall progression flag
+			if (proceed_to_next_island == true)
 			{
-				/* Set aside space for the arrays. */
-				powerflow_values->island_matrix_values[island_loop_index].matrices_LU.a_LU = (double *) gl_malloc(nnz *sizeof(double));
-				if (powerflow_values->island_matrix_values[island_loop_index].matrices_LU.a_LU==NULL)
+				//See if we need to continue
+				if (island_loop_index >= (NR_islands_detected - 1))	//We're the last one
 				{
-					GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
-					/*  TROUBLESHOOT
-					While attempting to allocate the memory for one of the SuperLU working matrices,
-					an error was encountered and it was not allocated.  Please try again.  If it fails
-					again, please submit your code and a bug report using the trac website.
-					*/
+					//Set the flag to be done
+					still_iterating_islands = false;
 				}
-				
-				powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rows_LU = (int *) gl_malloc(nnz *sizeof(int));
-				if (powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rows_LU == NULL)
-					GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
+				else	//Not last -- increment the counter and onwards
+				{
+					//Increment the counter
+					island_loop_index++;
 
-				powerflow_values->island_matrix_values[island_loop_index].matrices_LU.cols_LU = (int *) gl_malloc((n+1) *sizeof(int));
-				if (powerflow_values->island_matrix_values[island_loop_index].matrices_LU.cols_LU == NULL)
-					GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
+					//Force the flag, just to be paranoid
+					still_iterating_islands = true;
+				}
+			}
+		}//End iteration still needed while - indexed on island_loop_index
 
-				/* Create the right-hand side matrix B. */
-				powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rhs_LU = (double *) gl_malloc(m *sizeof(double));
-				if (powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rhs_LU == NULL)
-					GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
+		//Figure out the exit return values -- make them "worst case", so if all failed, return "bad_computations"
+		//If at least one passes, just return the max iteration count
+		*bad_computations = true;
+		return_value_for_solver_NR = 0;
 
-				if (matrix_solver_method==MM_SUPERLU)
+		//Loop through the islands and figure this out
+		for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
+		{
+			if (powerflow_values->island_matrix_values[island_loop_index].return_code >= 0)	//Success or really bad failure
+			{
+				//See which one it is
+				if (powerflow_values->island_matrix_values[island_loop_index].new_iteration_required == false)	//We converged to get here!
 				{
-					///* Set up the arrays for the permutations. */
-					curr_island_superLU_vars->perm_r = (int *) gl_malloc(m *sizeof(int));
-					if (curr_island_superLU_vars->perm_r == NULL)
-						GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
+					*bad_computations = false;	//Deflag us
 
-					curr_island_superLU_vars->perm_c = (int *) gl_malloc(n *sizeof(int));
-					if (curr_island_superLU_vars->perm_c == NULL)
-						GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
+					//See if we're the biggest iteration limit so far - assuming no one is reiterating
+					if (return_value_for_solver_NR >= 0)
+					{
+						if (powerflow_values->island_matrix_values[island_loop_index].iteration_count > return_value_for_solver_NR)
+						{
+							return_value_for_solver_NR = powerflow_values->island_matrix_values[island_loop_index].iteration_count;
+						}
+					}
+					//Default else -- someone is already negative, so just accept it
+				}
+				else if (NR_island_fail_method == true)	//Really bad failure, but let's see if we're in "special handling mode"
+				{
+					*bad_computations = false;	//Deflag us, so it keeps going
 
-					//Set up storage pointers - single element, but need to be malloced for some reason
-					curr_island_superLU_vars->A_LU.Store = (void *)gl_malloc(sizeof(NCformat));
-					if (curr_island_superLU_vars->A_LU.Store == NULL)
-						GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
+					//Set the return value to the iteration limit (negative)
+					//No checks necessary -- this will just rail, regardless
+					return_value_for_solver_NR = -NR_iteration_limit;
 
-					curr_island_superLU_vars->B_LU.Store = (void *)gl_malloc(sizeof(DNformat));
-					if (curr_island_superLU_vars->B_LU.Store == NULL)
-						GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
+					if (fault_check_object == NULL)	//Make sure multi-island support is supported!
+					{
+						GL_THROW("NR: Multi-island handing without fault_check is not permitted");
+						/*  TROUBLESHOOT
+						The NR_island_failure_handled flag requires a fault_check object to be present.  Please add one to your GLM
+						to continue.
+						*/
+					}
+					else
+					{
+						//Call the "removal" routine - map it 
+						temp_fxn_val = (FUNCTIONADDR)(gl_get_function(fault_check_object,"island_removal_function"));
+						
+						//Make sure it was found
+						if (temp_fxn_val == NULL)
+						{
+							GL_THROW("NR: Unable to map island removal function");
+							/*  TROUBLESHOOT
+							While attempting to map the island removal function, an error was encountered.  Please
+							try again.  If the error persists, please submit your code and a report via the issues
+							system.
+							*/
+						}
 
-					//Populate these structures - A_LU matrix
-					curr_island_superLU_vars->A_LU.Stype = SLU_NC;
-					curr_island_superLU_vars->A_LU.Dtype = SLU_D;
-					curr_island_superLU_vars->A_LU.Mtype = SLU_GE;
-					curr_island_superLU_vars->A_LU.nrow = n;
-					curr_island_superLU_vars->A_LU.ncol = m;
+						//Call the function
+						call_return_status = ((STATUS (*)(OBJECT *,int))(temp_fxn_val))(fault_check_object,island_loop_index);
 
-					//Populate these structures - B_LU matrix
-					curr_island_superLU_vars->B_LU.Stype = SLU_DN;
-					curr_island_superLU_vars->B_LU.Dtype = SLU_D;
-					curr_island_superLU_vars->B_LU.Mtype = SLU_GE;
-					curr_island_superLU_vars->B_LU.nrow = m;
-					curr_island_superLU_vars->B_LU.ncol = 1;
-				}
-				else if (matrix_solver_method == MM_EXTERN)	//External routine
-				{
-					//Run allocation routine
-					((void (*)(void *,unsigned int, unsigned int, bool))(LUSolverFcns.ext_alloc))(powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars,n,n,NR_admit_change);
-				}
-				else
-				{
-					GL_THROW("Invalid matrix solution method specified for NR solver!");
-					//Defined elsewhere
+						//Make sure it worked
+						if (call_return_status != SUCCESS)
+						{
+							GL_THROW("NR: Failed to remove island %d from the powerflow",(island_loop_index+1));
+							/*  TROUBLESHOOT
+							While attempting to remove an island from the powerflow, an error occurred.  Please try again.
+							If the error persists, please submit your code and a report via the issues system.
+							*/
+						}
+						//If we succeeded, good to go!
+					}//End fault_check present
 				}
-
-				//Update tracking variable
-				powerflow_values->island_matrix_values[island_loop_index].prev_m = m;
+				//Default else -- a bad failure we just want to ignore
 			}
-			else if (powerflow_values->island_matrix_values[island_loop_index].NR_realloc_needed)	//Something changed, we'll just destroy everything and start over
+			else	//must be negative -- Not quite a full failure, just "something didn't converge"
 			{
-				//Get rid of all of them first
-				gl_free(powerflow_values->island_matrix_values[island_loop_index].matrices_LU.a_LU);
-				gl_free(powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rows_LU);
-				gl_free(powerflow_values->island_matrix_values[island_loop_index].matrices_LU.cols_LU);
-				gl_free(powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rhs_LU);
+				*bad_computations = false;	//Deflag us
 
-				if (matrix_solver_method==MM_SUPERLU)
+				//See which mode we're in
+				if (NR_island_fail_method == true)	//See if we're in "special island mode" or not
 				{
-					//Free up superLU matrices
-					gl_free(curr_island_superLU_vars->perm_r);
-					gl_free(curr_island_superLU_vars->perm_c);
-				}
-				//Default else - don't care - destructions are presumed to be handled inside external LU's alloc function
+					//Set the return value to the iteration limit (negative)
+					//No checks necessary -- this will just rail, regardless
+					return_value_for_solver_NR = -NR_iteration_limit;
 
-				/* Set aside space for the arrays. - Copied from above */
-				powerflow_values->island_matrix_values[island_loop_index].matrices_LU.a_LU = (double *) gl_malloc(nnz *sizeof(double));
-				if (powerflow_values->island_matrix_values[island_loop_index].matrices_LU.a_LU==NULL)
-					GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
-				
-				powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rows_LU = (int *) gl_malloc(nnz *sizeof(int));
-				if (powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rows_LU == NULL)
-					GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
+					if (fault_check_object == NULL)	//Make sure multi-island support is supported!
+					{
+						GL_THROW("NR: Multi-island handing without fault_check is not permitted");
+						//Defined above
+					}
+					else
+					{
+						//Call the "removal" routine - map it 
+						temp_fxn_val = (FUNCTIONADDR)(gl_get_function(fault_check_object,"island_removal_function"));
+						
+						//Make sure it was found
+						if (temp_fxn_val == NULL)
+						{
+							GL_THROW("NR: Unable to map island removal function");
+							//Defined above
+						}
+
+						//Call the function
+						call_return_status = ((STATUS (*)(OBJECT *,int))(temp_fxn_val))(fault_check_object,island_loop_index);
+
+						//Make sure it worked
+						if (call_return_status != SUCCESS)
+						{
+							GL_THROW("NR: Failed to remove island %d from the powerflow",(island_loop_index+1));
+							//Defined above
+						}
+						//If we succeeded, good to go!
+					}//End fault_check present
+				}
+				else	//Nope, just handle like "normal"
+				{
+					//See if we're the first negative one - if so, populate us (should just be NR limit)
+					if (powerflow_values->island_matrix_values[island_loop_index].return_code < return_value_for_solver_NR)
+					{
+						return_value_for_solver_NR = powerflow_values->island_matrix_values[island_loop_index].return_code;
+					}
+				}
+			}
+			//Default else - it was a failure, just keep going
+		}
+		Iteration = return_value_for_solver_NR+1;
 
-				powerflow_values->island_matrix_values[island_loop_index].matrices_LU.cols_LU = (int *) gl_malloc((n+1) *sizeof(int));
-				if (powerflow_values->island_matrix_values[island_loop_index].matrices_LU.cols_LU == NULL)
-					GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
+		//Deflag the "island locker"
+		NR_solver_working = false;
+	
+	}//End timed block
 
-				/* Create the right-hand side matrix B. */
-				powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rhs_LU = (double *) gl_malloc(m *sizeof(double));
-				if (powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rhs_LU == NULL)
-					GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
+	//Check bad computations
+	if (*bad_computations == true)
+	{
+		//Do the solver dump
+		solver_dump(bus_count,bus,branch_count,branch,solver_dump_enable);
+		
+		//Return 0 - just arbitrary here
+		return 0;
+	}
+	else
+	{
+		//Track the static solution iteration counts, and keep converged voltages for the predictor
+		if (powerflow_type == PF_NORMAL)
+		{
+			NR_solve_count++;
 
-				if (matrix_solver_method==MM_SUPERLU)
-				{
-					///* Set up the arrays for the permutations. */
-					curr_island_superLU_vars->perm_r = (int *) gl_malloc(m *sizeof(int));
-					if (curr_island_superLU_vars->perm_r == NULL)
-						GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
+			if (return_value_for_solver_NR >= 0)
+			{
+				NR_iteration_total += return_value_for_solver_NR + 1;
+			}
+			else
+			{
+				NR_iteration_total += NR_iteration_limit;
+			}
 
-					curr_island_superLU_vars->perm_c = (int *) gl_malloc(n *sizeof(int));
-					if (curr_island_superLU_vars->perm_c == NULL)
-						GL_THROW("NR: One of the SuperLU solver matrices failed to allocate");
+			if ((NR_voltage_predictor == true) || (NR_solve_history_size > 0))
+			{
+				NR_record_voltages(bus_count,bus,powerflow_values,((return_value_for_solver_NR >= 0) ? (return_value_for_solver_NR + 1) : NR_iteration_limit),(return_value_for_solver_NR >= 0));
+			}
+		}
 
-					//Update structures - A_LU matrix
-					curr_island_superLU_vars->A_LU.Stype = SLU_NC;
-					curr_island_superLU_vars->A_LU.Dtype = SLU_D;
-					curr_island_superLU_vars->A_LU.Mtype = SLU_GE;
-					curr_island_superLU_vars->A_LU.nrow = n;
-					curr_island_superLU_vars->A_LU.ncol = m;
+		//Add the learning code (may need to be adjusted for multi-island)
+		try 
+		{
+			solver_python_learn(bus_count,bus,branch_count,branch,powerflow_values,powerflow_type,mesh_imped_vals,bad_computations,Iteration);
+		}
+		catch (const char *msg)
+		{
+			gl_error("solver_py: solver post failed -- %s",msg);
+		}
+		catch (...)
+		{
+			gl_error("solver_py: solver post failed -- unknown exception");
+		}
 
-					//Update structures - B_LU matrix
-					curr_island_superLU_vars->B_LU.Stype = SLU_DN;
-					curr_island_superLU_vars->B_LU.Dtype = SLU_D;
-					curr_island_superLU_vars->B_LU.Mtype = SLU_GE;
-					curr_island_superLU_vars->B_LU.nrow = m;
-					curr_island_superLU_vars->B_LU.ncol = 1;
-				}
-				else if (matrix_solver_method == MM_EXTERN)	//External routine
+		if ( nr_profile != NULL ) 
+		{	
+			double t = clock() - t_start;	
+			char buffer[64];
+			if ( gl_printtime(gl_globalclock,buffer,sizeof(buffer)-1) > 0 )
+			{
+				if ( solver_profile_csv )
 				{
-					//Run allocation routine
-					((void (*)(void *,unsigned int, unsigned int, bool))(LUSolverFcns.ext_alloc))(powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars,n,n,NR_admit_change);
+					fprintf(nr_profile, "%s,%.1f,%.1lld,%d,%d,%d\n", buffer, t, Iteration,bus_count,branch_count,bad_computations ? 0 : 1);
 				}
 				else
 				{
-					GL_THROW("Invalid matrix solution method specified for NR solver!");
-					//Defined elsewhere
+					fprintf(nr_profile, "%s %18.1f %9lld %9d %12d %s\n", buffer, t, Iteration,bus_count,branch_count,bad_computations ? "no" : "yes");
 				}
+			}
+		}
+				
+		//Return the maximum iteration count
+		return return_value_for_solver_NR;
+	}
+}
 
-				//Update tracking variable
-				powerflow_values->island_matrix_values[island_loop_index].prev_m = m;
+//Unit nominal voltage phasors for the constant current adjustments of compute_load_values
+//Line-to-line (AB, BC, CA) and line-to-neutral (A, B, C) - scaled by the bus voltage base instead of SetPolar-ing each time
+static const complex NR_unit_phasor_LL[3] = {complex(cos(PI/6.0),sin(PI/6.0)), complex(cos(-1.0*PI/2.0),sin(-1.0*PI/2.0)), complex(cos(5.0*PI/6.0),sin(5.0*PI/6.0))};
+static const complex NR_unit_phasor_LN[3] = {complex(cos(0.0),sin(0.0)), complex(cos(-2.0*PI/3.0),sin(-2.0*PI/3.0)), complex(cos(2.0*PI/3.0),sin(2.0*PI/3.0))};
+
+//Maps the jindex-th present phase of a bus into its load/Jacobian entry (temp_index) and voltage phase (temp_index_b)
+static inline void NR_load_phase_index(unsigned char phases, int jindex, int *temp_index, int *temp_index_b)
+{
+	switch(phases & 0x07) {
+		case 0x01:	//C
+			{
+				*temp_index=0;
+				*temp_index_b=2;
+				break;
 			}
-			else if (powerflow_values->island_matrix_values[island_loop_index].prev_m != m)	//Non-reallocing size change occurred
+		case 0x02:	//B
 			{
-				if (matrix_solver_method==MM_SUPERLU)
-				{
-					//Update relevant portions
-					curr_island_superLU_vars->A_LU.nrow = n;
-					curr_island_superLU_vars->A_LU.ncol = m;
-
-					curr_island_superLU_vars->B_LU.nrow = m;
-				}
-				else if (matrix_solver_method == MM_EXTERN)	//External routine - call full reallocation, just in case
+				*temp_index=0;
+				*temp_index_b=1;
+				break;
+			}
+		case 0x03:	//BC
+			{
+				if (jindex==0)	//B
 				{
-					//Run allocation routine
-					((void (*)(void *,unsigned int, unsigned int, bool))(LUSolverFcns.ext_alloc))(powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars,n,n,NR_admit_change);
+					*temp_index=0;
+					*temp_index_b=1;
 				}
-				else
+				else			//C
 				{
-					GL_THROW("Invalid matrix solution method specified for NR solver!");
-					//Defined elsewhere
+					*temp_index=1;
+					*temp_index_b=2;
 				}
-
-				//Update tracking variable
-				powerflow_values->island_matrix_values[island_loop_index].prev_m = m;
+				break;
 			}
-
-	#ifndef MT
-			if (matrix_solver_method==MM_SUPERLU)
+		case 0x04:	//A
 			{
-				/* superLU sequential options*/
-				set_default_options ( &options );
+				*temp_index=0;
+				*temp_index_b=0;
+				break;
 			}
-			//Default else - not superLU
-	#endif
-			
-			sparse_tonr(powerflow_values->island_matrix_values[island_loop_index].Y_Amatrix, &powerflow_values->island_matrix_values[island_loop_index].matrices_LU);
-			powerflow_values->island_matrix_values[island_loop_index].matrices_LU.cols_LU[n] = nnz ;// number of non-zeros;
-
-			//Determine how to populate the rhs vector
-			if (mesh_imped_vals == NULL)	//Normal powerflow, copy in the values
+		case 0x05:	//AC
 			{
-				for (temp_index_c=0;temp_index_c<m;temp_index_c++)
-				{ 
-					powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rhs_LU[temp_index_c] = powerflow_values->island_matrix_values[island_loop_index].deltaI_NR[temp_index_c];
+				if (jindex==0)	//A
+				{
+					*temp_index=0;
+					*temp_index_b=0;
+				}
+				else			//C
+				{
+					*temp_index=1;
+					*temp_index_b=2;
 				}
+				break;
 			}
-			//Default else -- it is NULL - zero it and "populate it" below
-
-			if (matrix_solver_method==MM_SUPERLU)
+		case 0x06:	//AB
+		case 0x07:	//ABC
 			{
-				////* Create Matrix A in the format expected by Super LU.*/
-				//Populate the matrix values (temporary value)
-				Astore = (NCformat*)curr_island_superLU_vars->A_LU.Store;
-				Astore->nnz = nnz;
-				Astore->nzval = powerflow_values->island_matrix_values[island_loop_index].matrices_LU.a_LU;
-				Astore->rowind = powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rows_LU;
-				Astore->colptr = powerflow_values->island_matrix_values[island_loop_index].matrices_LU.cols_LU;
-				
-				// Create right-hand side matrix B in format expected by Super LU
-				//Populate the matrix (temporary values)
-				Bstore = (DNformat*)curr_island_superLU_vars->B_LU.Store;
-				Bstore->lda = m;
-				Bstore->nzval = powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rhs_LU;
-
-				//See how to call the function - if normal mode or not
-				//**************************** How will this work with islanding stuff !?!?!?!? ****************************
-				if (mesh_imped_vals != NULL)
-				{
-					//Start with "failure" option on the structure
-					mesh_imped_vals->return_code = 0;
-
-					//Determine the base index (error check)
-					if (mesh_imped_vals->NodeRefNum > 0)
-					{
-						tempa = 2*bus[mesh_imped_vals->NodeRefNum].Matrix_Loc;	//These are already separated into real/imag, so the base is 2x
-					}
-					else	//Error
-					{
-						gl_error("solver_nr: Node reference for mesh fault calculation was invalid -- it may be a child");
-						/*  TROUBLESHOOT
-						While attempting to compute the equivalent impedance at a mesh faulted node, an invalid node reference
-						was found.  This is likely an internal error to the code -- submit your code and a bug report via the
-						tracking website.
-						*/
-
-						//Set the flags
-						mesh_imped_vals->return_code = 0;
-						*bad_computations = true;
-
-						//Deflag the island locker, though not really needed
-						NR_solver_working = false;
-
-						//Return a 0 to flag
-						return 0;
-					}
-
-					//Determine our phasing size - what entries to pull - double for the complex notation
-					temp_size = 2*powerflow_values->BA_diag[mesh_imped_vals->NodeRefNum].size;
-
-					//Check for error - size of zero
-					if (temp_size == 0)
-					{
-						gl_error("solver_nr: Mesh fault impedance extract failed - invalid node");
-						/*  TROUBLESHOOT
-						While attempting to extract the mesh fault impedance value, a node with either
-						invalid phasing or no phases (already removed) was somehow flagged.  Please check
-						your file and try again.  If the error persists, please submit your code
-						and a bug report via the ticketing system.
-						*/
-
-						//Flags
-						*bad_computations = true;
-						mesh_imped_vals->return_code = 0;
-
-						//Deflag the island locker, though not really needed
-						NR_solver_working = false;
-
-						//Exit
-						return 0;
-					}
-					//Default else -- okay
-
-					//Clear out the output matrix first -- assumes it is 3x3, regardless
-					for (jindex=0; jindex<9; jindex++)
-					{
-						mesh_imped_vals->z_matrix[jindex] = complex(0.0,0.0);
-					}
-
-					//Zero the double matrix - the big storage (6x6 - re & im split)
-					for (jindex=0; jindex<6; jindex++)
-					{
-						for (kindex=0; kindex<6; kindex++)
-						{
-							temp_z_store[jindex][kindex] = 0.0;
-						}
-					}
-
-					//Overall loop - for number of phases
-					for (kindex=0; kindex<temp_size; kindex++)
-					{
+				*temp_index=jindex;
+				*temp_index_b=jindex;
+				break;
+			}
+		default:
+			break;
+	}//end case
+}
 
-						//Start by zeroing the "solution" vector
-						for (temp_index_c=0;temp_index_c<m;temp_index_c++)
-						{ 
-							powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rhs_LU[temp_index_c] = 0.0;
-						}
+//Lays out one lane per phase of the wye batches (island order), and sizes the structure-of-arrays scratch
+//that compute_load_wye_lanes and compute_load_triplex_lanes gather into
+static void NR_build_load_lanes(unsigned int bus_count, BUSDATA *bus, NR_SOLVER_STRUCT *powerflow_values)
+{
+	unsigned int indexer, batch_index, lane_count, triplex_count, lane_stride;
+	int island_index, jindex, temp_index, temp_index_b;
 
-						//"Identity"-ize the real part of the current index
-						powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rhs_LU[tempa + kindex] = 1.0;
+	//Count the lanes first
+	lane_count = 0;
+	triplex_count = 0;
 
-						//Do a solution to get this entry (copied from below - includes "destructors"
-	#ifdef MT
-						//superLU_MT commands
+	for (island_index=0; island_index<NR_islands_detected; island_index++)
+	{
+		triplex_count += powerflow_values->load_batch_offset[NR_LOAD_BATCH_TYPES*island_index + 2] - powerflow_values->load_batch_offset[NR_LOAD_BATCH_TYPES*island_index + 1];
 
-						//Populate perm_c
-						get_perm_c(1, &curr_island_superLU_vars->A_LU, curr_island_superLU_vars->perm_c);
+		for (batch_index=powerflow_values->load_batch_offset[NR_LOAD_BATCH_TYPES*island_index + 2]; batch_index<powerflow_values->load_batch_offset[NR_LOAD_BATCH_TYPES*island_index + 3]; batch_index++)
+		{
+			lane_count += powerflow_values->BA_diag[powerflow_values->load_batch_list[batch_index]].size;
+		}
+	}
 
-						//Solve the system 
-						pdgssv(NR_superLU_procs, &curr_island_superLU_vars->A_LU, curr_island_superLU_vars->perm_c, curr_island_superLU_vars->perm_r, &L_LU, &U_LU, &curr_island_superLU_vars->B_LU, &info);
+	if ((powerflow_values->load_lane_bus == NULL) || (powerflow_values->load_lane_count < lane_count))
+	{
+		if (powerflow_values->load_lane_bus != NULL)
+		{
+			gl_free(powerflow_values->load_lane_bus);
+			gl_free(powerflow_values->load_lane_slot);
+			gl_free(powerflow_values->load_lane_phase);
+		}
 
-						/* De-allocate storage - superLU matrix types must be destroyed at every iteration, otherwise they balloon fast (65 MB norma becomes 1.5 GB) */
-						//superLU_MT commands
-						Destroy_SuperNode_SCP(&L_LU);
-						Destroy_CompCol_NCP(&U_LU);
-	#else
-						//sequential superLU
+		//Always allocate something, so an island of only delta/triplex buses still has valid arrays
+		powerflow_values->load_lane_count = (lane_count > 0) ? lane_count : 1;
 
-						StatInit ( &stat );
+		powerflow_values->load_lane_bus = (unsigned int *)gl_malloc(powerflow_values->load_lane_count*sizeof(unsigned int));
+		powerflow_values->load_lane_slot = (unsigned char *)gl_malloc(powerflow_values->load_lane_count*sizeof(unsigned char));
+		powerflow_values->load_lane_phase = (unsigned char *)gl_malloc(powerflow_values->load_lane_count*sizeof(unsigned char));
 
-						// solve the system
-						dgssv(&options, &curr_island_superLU_vars->A_LU, curr_island_superLU_vars->perm_c, curr_island_superLU_vars->perm_r, &L_LU, &U_LU, &curr_island_superLU_vars->B_LU, &stat, &info);
+		if ((powerflow_values->load_lane_bus == NULL) || (powerflow_values->load_lane_slot == NULL) || (powerflow_values->load_lane_phase == NULL))
+		{
+			GL_THROW("NR: Failed to allocate load batch arrays");
+			//Defined above
+		}
+	}
 
-						/* De-allocate storage - superLU matrix types must be destroyed at every iteration, otherwise they balloon fast (65 MB norma becomes 1.5 GB) */
-						//sequential superLU commands
-						Destroy_SuperNode_Matrix( &L_LU );
-						Destroy_CompCol_Matrix( &U_LU );
-						StatFree ( &stat );
-	#endif
-						//Crude superLU checks - see if it is mission accomplished or not
-						if (info != 0)	//Failed inversion, for various reasons
-						{
-							gl_error("solver_nr: superLU failed mesh fault matrix inversion with code %d",info);
-							/*  TROUBLESHOOT
-							superLU failed to invert the equivalent impedance matrix for the mesh fault calculation
-							method.  Please try again and make sure your system is valid.  If the error persists, please
-							submit your code and a bug report via the ticketing system.
-							*/
+	lane_stride = (lane_count > triplex_count) ? lane_count : triplex_count;
 
-							//Flag as bad
-							*bad_computations = true;
-							mesh_imped_vals->return_code = 0;
+	if ((powerflow_values->load_lane_data == NULL) || (powerflow_values->load_lane_stride < lane_stride))
+	{
+		if (powerflow_values->load_lane_data != NULL)
+		{
+			gl_free(powerflow_values->load_lane_data);
+		}
 
-							//Deflag the island locker, though not really needed
-							NR_solver_working = false;
+		powerflow_values->load_lane_stride = (lane_stride > 0) ? lane_stride : 1;
 
-							//Exit
-							return 0;
-						}
-						//Default else, must have converged!
+		powerflow_values->load_lane_data = (double *)gl_malloc(NR_LOAD_LANE_FIELDS*powerflow_values->load_lane_stride*sizeof(double));
 
-						//Map up the solution vector
-						sol_LU = (double*) ((DNformat*) curr_island_superLU_vars->B_LU.Store)->nzval;
+		if (powerflow_values->load_lane_data == NULL)
+		{
+			GL_THROW("NR: Failed to allocate load batch arrays");
+			//Defined above
+		}
+	}
 
-						//Extract out this column into the temporary matrix
-						for (jindex=0; jindex<temp_size; jindex++)
-						{
-							temp_z_store[jindex][kindex] = sol_LU[tempa+jindex];
-						}
-					}//End "phase loop" - impedance components are ready
+	//Now map them - the phase mapping only changes with the phases, so any bad mapping gets caught here
+	lane_count = 0;
 
-					//Extract the values - do with a massive case/switch, just because
-					switch(bus[mesh_imped_vals->NodeRefNum].phases & 0x07) {
-						case 0x01:	//C
-							{
-								mesh_imped_vals->z_matrix[8] = complex(temp_z_store[1][0],temp_z_store[1][1]);
-								break;
-							}
-						case 0x02:	//B
-							{
-								mesh_imped_vals->z_matrix[4] = complex(temp_z_store[1][0],temp_z_store[1][1]);
-								break;
-							}
-						case 0x03:	//BC
-							{
-								//BB and BC portion
-								mesh_imped_vals->z_matrix[4] = complex(temp_z_store[2][0],temp_z_store[2][2]);
-								mesh_imped_vals->z_matrix[5] = complex(temp_z_store[2][1],temp_z_store[2][3]);
+	for (island_index=0; island_index<NR_islands_detected; island_index++)
+	{
+		powerflow_values->load_lane_offset[island_index] = lane_count;
 
-								//CB and CC portion
-								mesh_imped_vals->z_matrix[7] = complex(temp_z_store[3][0],temp_z_store[3][2]);
-								mesh_imped_vals->z_matrix[8] = complex(temp_z_store[3][1],temp_z_store[3][3]);
-								break;
-							}
-						case 0x04:	//A
-							{
-								mesh_imped_vals->z_matrix[0] = complex(temp_z_store[1][0],temp_z_store[1][1]);
-								break;
-							}
-						case 0x05:	//AC
-							{
-								//AA and AC portion
-								mesh_imped_vals->z_matrix[0] = complex(temp_z_store[2][0],temp_z_store[2][2]);
-								mesh_imped_vals->z_matrix[2] = complex(temp_z_store[2][1],temp_z_store[2][3]);
+		for (batch_index=powerflow_values->load_batch_offset[NR_LOAD_BATCH_TYPES*island_index + 2]; batch_index<powerflow_values->load_batch_offset[NR_LOAD_BATCH_TYPES*island_index + 3]; batch_index++)
+		{
+			indexer = powerflow_values->load_batch_list[batch_index];
 
-								//CA and CC portion
-								mesh_imped_vals->z_matrix[6] = complex(temp_z_store[3][0],temp_z_store[3][2]);
-								mesh_imped_vals->z_matrix[8] = complex(temp_z_store[3][1],temp_z_store[3][3]);
-								break;
-							}
-						case 0x06:	//AB
-							{
-								//AA and AB portion
-								mesh_imped_vals->z_matrix[0] = complex(temp_z_store[2][0],temp_z_store[2][2]);
-								mesh_imped_vals->z_matrix[1] = complex(temp_z_store[2][1],temp_z_store[2][3]);
+			for (jindex=0; jindex<powerflow_values->BA_diag[indexer].size; jindex++)
+			{
+				temp_index = -1;
+				temp_index_b = -1;
 
-								//BA and BB portion
-								mesh_imped_vals->z_matrix[3] = complex(temp_z_store[3][0],temp_z_store[3][2]);
-								mesh_imped_vals->z_matrix[4] = complex(temp_z_store[3][1],temp_z_store[3][3]);
-								break;
-							}
-						case 0x07:	//ABC
-							{
-								//A row
-								mesh_imped_vals->z_matrix[0] = complex(temp_z_store[3][0],temp_z_store[3][3]);
-								mesh_imped_vals->z_matrix[1] = complex(temp_z_store[3][1],temp_z_store[3][4]);
-								mesh_imped_vals->z_matrix[2] = complex(temp_z_store[3][2],temp_z_store[3][5]);
+				NR_load_phase_index(bus[indexer].phases,jindex,&temp_index,&temp_index_b);
 
-								//B row
-								mesh_imped_vals->z_matrix[3] = complex(temp_z_store[4][0],temp_z_store[4][3]);
-								mesh_imped_vals->z_matrix[4] = complex(temp_z_store[4][1],temp_z_store[4][4]);
-								mesh_imped_vals->z_matrix[5] = complex(temp_z_store[4][2],temp_z_store[4][5]);
+				if ((temp_index==-1) || (temp_index_b==-1))
+				{
+					GL_THROW("NR: A scheduled power update element failed.");
+					/*  TROUBLESHOOT
+					While attempting to calculate the scheduled portions of the
+					attached loads, an update failed to process correctly.
+					Submit you code and a bug report using the trac website.
+					*/
+				}
 
-								//C row
-								mesh_imped_vals->z_matrix[6] = complex(temp_z_store[5][0],temp_z_store[5][3]);
-								mesh_imped_vals->z_matrix[7] = complex(temp_z_store[5][1],temp_z_store[5][4]);
-								mesh_imped_vals->z_matrix[8] = complex(temp_z_store[5][2],temp_z_store[5][5]);
-								break;
-							}
-						default:	//Not sure how we got here
-							{
-								gl_error("solver_nr: Mesh fault impedance extract failed - invalid node");
-								//Defined above, same message
+				powerflow_values->load_lane_bus[lane_count] = indexer;
+				powerflow_values->load_lane_slot[lane_count] = (unsigned char)temp_index;
+				powerflow_values->load_lane_phase[lane_count] = (unsigned char)temp_index_b;
+				lane_count++;
+			}
+		}
+	}
 
-								//Flags
-								*bad_computations = true;
-								mesh_imped_vals->return_code = 0;
+	powerflow_values->load_lane_offset[NR_islands_detected] = lane_count;
+}
 
-								//Deflag the island locker, though not really needed
-								NR_solver_working = false;
+//Load kernel - delta-connected bus (with any wye-connected "different" children)
+static void compute_load_delta(BUSDATA *bus, unsigned int indexer, char diag_size, bool jacobian_pass)
+{
+	double adjust_nominal_voltage_val, tempPbus, tempQbus, adjust_temp_voltage_mag[6], volt_mag, volt_re_sq, volt_im_sq, volt_mag_cube;
+	complex adjust_temp_nominal_voltage[6], adjusted_constant_current[6], delta_current[3], voltageDel[3], undeltacurr[3];
+	int jindex, temp_index, temp_index_b;
 
-								//Exit
-								return 0;
-							}
-					}//end phase switch/case
+	//Populate the values for constant current -- adjusted to maintain PF (used to be deltamode-only)
+	//Create nominal magnitudes
+	adjust_nominal_voltage_val = bus[indexer].volt_base * sqrt(3.0);
 
-					//Flag as success
-					*bad_computations = false;
-					mesh_imped_vals->return_code = 1;
+	//Create the nominal voltage vectors
+	adjust_temp_nominal_voltage[0] = NR_unit_phasor_LL[0] * adjust_nominal_voltage_val;
+	adjust_temp_nominal_voltage[1] = NR_unit_phasor_LL[1] * adjust_nominal_voltage_val;
+	adjust_temp_nominal_voltage[2] = NR_unit_phasor_LL[2] * adjust_nominal_voltage_val;
 
-					//Exit
-					return 1;	//Non-zero, so success (manual checks outside though)
-				}//End "just mesh impedance calculations"
-				else	//Nulled, "normal" powerflow
-				{
-	#ifdef MT
-					//superLU_MT commands
+	//Compute delta voltages
+	voltageDel[0] = bus[indexer].V[0] - bus[indexer].V[1];
+	voltageDel[1] = bus[indexer].V[1] - bus[indexer].V[2];
+	voltageDel[2] = bus[indexer].V[2] - bus[indexer].V[0];
 
-					//Populate perm_c
-					get_perm_c(1, &curr_island_superLU_vars->A_LU, curr_island_superLU_vars->perm_c);
+	//Get magnitudes of all
+	adjust_temp_voltage_mag[0] = voltageDel[0].Mag();
+	adjust_temp_voltage_mag[1] = voltageDel[1].Mag();
+	adjust_temp_voltage_mag[2] = voltageDel[2].Mag();
 
-					//Solve the system
-					pdgssv(NR_superLU_procs, &curr_island_superLU_vars->A_LU, curr_island_superLU_vars->perm_c, curr_island_superLU_vars->perm_r, &L_LU, &U_LU, &curr_island_superLU_vars->B_LU, &powerflow_values->island_matrix_values[island_loop_index].solver_info);
-	#else
-					//sequential superLU
+	//Start adjustments - AB
+	if ((bus[indexer].I[0] != 0.0) && (adjust_temp_voltage_mag[0] != 0.0))
+	{
+		//calculate new value
+		adjusted_constant_current[0] = ~(adjust_temp_nominal_voltage[0] * ~bus[indexer].I[0] * adjust_temp_voltage_mag[0] / (voltageDel[0] * adjust_nominal_voltage_val));
+	}
+	else
+	{
+		adjusted_constant_current[0] = complex(0.0,0.0);
+	}
 
-					StatInit ( &stat );
+	//Start adjustments - BC
+	if ((bus[indexer].I[1] != 0.0) && (adjust_temp_voltage_mag[1] != 0.0))
+	{
+		//calculate new value
+		adjusted_constant_current[1] = ~(adjust_temp_nominal_voltage[1] * ~bus[indexer].I[1] * adjust_temp_voltage_mag[1] / (voltageDel[1] * adjust_nominal_voltage_val));
+	}
+	else
+	{
+		adjusted_constant_current[1] = complex(0.0,0.0);
+	}
 
-					// solve the system
-					dgssv(&options, &curr_island_superLU_vars->A_LU, curr_island_superLU_vars->perm_c, curr_island_superLU_vars->perm_r, &L_LU, &U_LU, &curr_island_superLU_vars->B_LU, &stat, &powerflow_values->island_matrix_values[island_loop_index].solver_info);
-	#endif
+	//Start adjustments - CA
+	if ((bus[indexer].I[2] != 0.0) && (adjust_temp_voltage_mag[2] != 0.0))
+	{
+		//calculate new value
+		adjusted_constant_current[2] = ~(adjust_temp_nominal_voltage[2] * ~bus[indexer].I[2] * adjust_temp_voltage_mag[2] / (voltageDel[2] * adjust_nominal_voltage_val));
+	}
+	else
+	{
+		adjusted_constant_current[2] = complex(0.0,0.0);
+	}
 
-					sol_LU = (double*) ((DNformat*) curr_island_superLU_vars->B_LU.Store)->nzval;
-				}
-			}
-			else if (matrix_solver_method==MM_EXTERN)
-			{
-				//General error check right now -- mesh fault current may not work properly
-				if (mesh_imped_vals != NULL)
-				{
-					gl_error("solver_nr: Mesh impedance attempted from unsupported LU solver");
-					/* TROUBLESHOOT
-					The mesh fault current impedance "pull" was selected, but for the external LU
-					solver.  This is unsupported at this time.  To use the mesh fault current capabilities,
-					please use the superLU solver.
-					*/
+	//See if we have any "different children"
+	if ((bus[indexer].phases & 0x10) == 0x10)
+	{
+		//Create nominal magnitudes
+		adjust_nominal_voltage_val = bus[indexer].volt_base;
 
-					//Set return code
-					mesh_imped_vals->return_code = 2;
+		//Create the nominal voltage vectors
+		adjust_temp_nominal_voltage[3] = NR_unit_phasor_LN[0] * bus[indexer].volt_base;
+		adjust_temp_nominal_voltage[4] = NR_unit_phasor_LN[1] * bus[indexer].volt_base;
+		adjust_temp_nominal_voltage[5] = NR_unit_phasor_LN[2] * bus[indexer].volt_base;
 
-					//Perform the clean up - external LU destructor routing
-					((void (*)(void *, bool))(LUSolverFcns.ext_destroy))(powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars,powerflow_values->island_matrix_values[island_loop_index].new_iteration_required);
+		//Get magnitudes of all
+		adjust_temp_voltage_mag[3] = bus[indexer].V[0].Mag();
+		adjust_temp_voltage_mag[4] = bus[indexer].V[1].Mag();
+		adjust_temp_voltage_mag[5] = bus[indexer].V[2].Mag();
 
-					//Flag bad computations, just because
-					*bad_computations = true;
+		//Start adjustments - A
+		if ((bus[indexer].extra_var[6] != 0.0) && (adjust_temp_voltage_mag[3] != 0.0))
+		{
+			//calculate new value
+			adjusted_constant_current[3] = ~(adjust_temp_nominal_voltage[3] * ~bus[indexer].extra_var[6] * adjust_temp_voltage_mag[3] / (bus[indexer].V[0] * adjust_nominal_voltage_val));
+		}
+		else
+		{
+			adjusted_constant_current[3] = complex(0.0,0.0);
+		}
 
-					//Deflag us, even though that may be moot here
-					NR_solver_working = false;
+		//Start adjustments - B
+		if ((bus[indexer].extra_var[7] != 0.0) && (adjust_temp_voltage_mag[4] != 0.0))
+		{
+			//calculate new value
+			adjusted_constant_current[4] = ~(adjust_temp_nominal_voltage[4] * ~bus[indexer].extra_var[7] * adjust_temp_voltage_mag[4] / (bus[indexer].V[1] * adjust_nominal_voltage_val));
+		}
+		else
+		{
+			adjusted_constant_current[4] = complex(0.0,0.0);
+		}
 
-					//Exit
-					return 0;
-				}
-				//Default else -- not mesh fault mode, so go like normal
+		//Start adjustments - C
+		if ((bus[indexer].extra_var[8] != 0.0) && (adjust_temp_voltage_mag[5] != 0.0))
+		{
+			//calculate new value
+			adjusted_constant_current[5] = ~(adjust_temp_nominal_voltage[5] * ~bus[indexer].extra_var[8] * adjust_temp_voltage_mag[5] / (bus[indexer].V[2] * adjust_nominal_voltage_val));
+		}
+		else
+		{
+			adjusted_constant_current[5] = complex(0.0,0.0);
+		}
+	}
+	else	//Nope
+	{
+		//Set to zero, just cause
+		adjusted_constant_current[3] = complex(0.0,0.0);
+		adjusted_constant_current[4] = complex(0.0,0.0);
+		adjusted_constant_current[5] = complex(0.0,0.0);
+	}
 
-				//Call the solver
-				powerflow_values->island_matrix_values[island_loop_index].solver_info = ((int (*)(void *,NR_SOLVER_VARS *, unsigned int, unsigned int))(LUSolverFcns.ext_solve))(powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars,&powerflow_values->island_matrix_values[island_loop_index].matrices_LU,n,1);
+	//Delta components - populate according to what is there
+	if ((bus[indexer].phases & 0x06) == 0x06)	//Check for AB
+	{
+		//Voltage calculations
+		voltageDel[0] = bus[indexer].V[0] - bus[indexer].V[1];
 
-				//Point the solution to the proper place
-				sol_LU = powerflow_values->island_matrix_values[island_loop_index].matrices_LU.rhs_LU;
-			}
-			else
-			{
-				GL_THROW("Invalid matrix solution method specified for NR solver!");
-				/*  TROUBLESHOOT
-				An invalid matrix solution method was selected for the Newton-Raphson solver method.
-				Valid options are the superLU solver or an external solver.  Please select one of these methods.
-				*/
-			}
+		//Power - convert to a current (uses less iterations this way)
+		delta_current[0] = (voltageDel[0] == 0) ? 0 : ~(bus[indexer].S[0]/voltageDel[0]);
 
-			//Update bus voltages - check convergence while we're here
-			powerflow_values->island_matrix_values[island_loop_index].max_mismatch_converge = 0;
+		//Convert delta connected load to appropriate Wye
+		delta_current[0] += voltageDel[0] * (bus[indexer].Y[0]);
+	}
+	else
+	{
+		//Zero values - they shouldn't be used anyhow
+		voltageDel[0] = complex(0.0,0.0);
+		delta_current[0] = complex(0.0,0.0);
+	}
 
-			temp_index = -1;
-			temp_index_b = -1;
-			powerflow_values->island_matrix_values[island_loop_index].new_iteration_required = false;	//Reset iteration requester flag - defaults to not needing another
+	if ((bus[indexer].phases & 0x03) == 0x03)	//Check for BC
+	{
+		//Voltage calculations
+		voltageDel[1] = bus[indexer].V[1] - bus[indexer].V[2];
 
-			for (indexer=0; indexer<bus_count; indexer++)
-			{
-				//See if we're part of the relevant island
-				if (bus[indexer].island_number == island_loop_index)
-				{
-					//Avoid swing bus updates on normal runs
-					if ((bus[indexer].type == 0) || ((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == false)))
-					{
-						//Figure out the offset we need to be for each phase
-						if ((bus[indexer].phases & 0x80) == 0x80)	//Split phase
-						{
-							//Pull the two updates (assume split-phase is always 2)
-							DVConvCheck[0]=complex(sol_LU[2*bus[indexer].Matrix_Loc],sol_LU[(2*bus[indexer].Matrix_Loc+2)]);
-							DVConvCheck[1]=complex(sol_LU[(2*bus[indexer].Matrix_Loc+1)],sol_LU[(2*bus[indexer].Matrix_Loc+3)]);
-							bus[indexer].V[0] += DVConvCheck[0];
-							bus[indexer].V[1] += DVConvCheck[1];	//Negative due to convention
-							
-							//Pull off the magnitude (no sense calculating it twice)
-							CurrConvVal=DVConvCheck[0].Mag();
-							if (CurrConvVal > powerflow_values->island_matrix_values[island_loop_index].max_mismatch_converge)	//Update our convergence check if it is bigger
-								powerflow_values->island_matrix_values[island_loop_index].max_mismatch_converge=CurrConvVal;
+		//Power - convert to a current (uses less iterations this way)
+		delta_current[1] = (voltageDel[1] == 0) ? 0 : ~(bus[indexer].S[1]/voltageDel[1]);
 
-							if (CurrConvVal > bus[indexer].max_volt_error)	//Check for convergence
-								powerflow_values->island_matrix_values[island_loop_index].new_iteration_required=true;								//Flag that a new iteration must occur
+		//Convert delta connected load to appropriate Wye
+		delta_current[1] += voltageDel[1] * (bus[indexer].Y[1]);
+	}
+	else
+	{
+		//Zero unused
+		voltageDel[1] = complex(0.0,0.0);
+		delta_current[1] = complex(0.0,0.0);
+	}
 
-							CurrConvVal=DVConvCheck[1].Mag();
-							if (CurrConvVal > powerflow_values->island_matrix_values[island_loop_index].max_mismatch_converge)	//Update our convergence check if it is bigger
-								powerflow_values->island_matrix_values[island_loop_index].max_mismatch_converge=CurrConvVal;
+	if ((bus[indexer].phases & 0x05) == 0x05)	//Check for CA
+	{
+		//Voltage calculations
+		voltageDel[2] = bus[indexer].V[2] - bus[indexer].V[0];
 
-							if (CurrConvVal > bus[indexer].max_volt_error)	//Check for convergence
-								powerflow_values->island_matrix_values[island_loop_index].new_iteration_required=true;								//Flag that a new iteration must occur
-						}//end split phase update
-						else										//Not split phase
-						{
-							for ( jindex = 0 ; jindex < powerflow_values->BA_diag[indexer].size ; jindex++ )	//parse through the phases
-							{
-								switch(bus[indexer].phases & 0x07) {
-									case 0x01:	//C
-										{
-											temp_index=0;
-											temp_index_b=2;
-											break;
-										}
-									case 0x02:	//B
-										{
-											temp_index=0;
-											temp_index_b=1;
-											break;
-										}
-									case 0x03:	//BC
-										{
-											if (jindex==0)	//B
-											{
-												temp_index=0;
-												temp_index_b=1;
-											}
-											else			//C
-											{
-												temp_index=1;
-												temp_index_b=2;
-											}
+		//Power - convert to a current (uses less iterations this way)
+		delta_current[2] = (voltageDel[2] == 0) ? 0 : ~(bus[indexer].S[2]/voltageDel[2]);
 
-											break;
-										}
-									case 0x04:	//A
-										{
-											temp_index=0;
-											temp_index_b=0;
-											break;
-										}
-									case 0x05:	//AC
-										{
-											if (jindex==0)	//A
-											{
-												temp_index=0;
-												temp_index_b=0;
-											}
-											else			//C
-											{
-												temp_index=1;
-												temp_index_b=2;
-											}
-											break;
-										}
-									case 0x06:	//AB
-									case 0x07:	//ABC
-										{
-											temp_index = jindex;
-											temp_index_b = jindex;
-											break;
-										}
-								}//end phase switch/case
+		//Convert delta connected load to appropriate Wye
+		delta_current[2] += voltageDel[2] * (bus[indexer].Y[2]);
+	}
+	else
+	{
+		//Zero unused
+		voltageDel[2] = complex(0.0,0.0);
+		delta_current[2] = complex(0.0,0.0);
+	}
 
-								if (((int)temp_index==-1) || ((int)temp_index_b==-1))
-								{
-									GL_THROW("NR: An error occurred indexing voltage updates");
-									/*  TROUBLESHOOT
-									While attempting to create the voltage update indices for the
-									Newton-Raphson solver, an error was encountered.  Please submit
-									your code and a bug report using the trac website.
-									*/
-								}
+	//Convert delta-current into a phase current, where appropriate - reuse temp variable
+	//Everything will be accumulated into the "current" field for ease (including differents)
+	if ((bus[indexer].phases & 0x04) == 0x04)	//Has a phase A
+	{
+		undeltacurr[0]=(adjusted_constant_current[0]+delta_current[0])-(adjusted_constant_current[2]+delta_current[2]);
 
-								DVConvCheck[jindex]=complex(sol_LU[(2*bus[indexer].Matrix_Loc+temp_index)],sol_LU[(2*bus[indexer].Matrix_Loc+powerflow_values->BA_diag[indexer].size+temp_index)]);
-								bus[indexer].V[temp_index_b] += DVConvCheck[jindex];
-								
-								//Pull off the magnitude (no sense calculating it twice)
-								CurrConvVal=DVConvCheck[jindex].Mag();
-								if (CurrConvVal > bus[indexer].max_volt_error)	//Check for convergence
-									powerflow_values->island_matrix_values[island_loop_index].new_iteration_required=true;								//Flag that a new iteration must occur
+		//Check for "different" children and apply them, as well
+		if ((bus[indexer].phases & 0x10) == 0x10)	//We do, so they must be Wye-connected
+		{
+			//Power values
+			undeltacurr[0] += (bus[indexer].V[0] == 0) ? 0 : ~(bus[indexer].extra_var[0]/bus[indexer].V[0]);
 
-								if (CurrConvVal > powerflow_values->island_matrix_values[island_loop_index].max_mismatch_converge)	//See if the current differential is the largest found so far or not
-									powerflow_values->island_matrix_values[island_loop_index].max_mismatch_converge = CurrConvVal;	//It is, store it
+			//Shunt values
+			undeltacurr[0] += bus[indexer].extra_var[3]*bus[indexer].V[0];
 
-							}//End For loop for phase traversion
-						}//End not split phase update
-					}//end if not swing
-					//Default else -- this must be the swing and in a valid interval
-				}//End "in the island"
-				//Default else - not in the island, skip it
-			}//End bus traversion
+			//Current values
+			undeltacurr[0] += adjusted_constant_current[3];
+		}
+	}
+	else
+	{
+		//Zero it, just in case
+		undeltacurr[0] = complex(0.0,0.0);
+	}
 
-			//Perform saturation current update/convergence check
-			//******************** FIGURE OUT HOW TO DO THIS BETTER - This is very inefficient!***********************//
-			if ((enable_inrush_calculations == true) && (deltatimestep_running > 0))	//Don't even both with this if inrush not on
-			{
-				//Start out assuming the convergence is true (reiter is false)
-				powerflow_values->island_matrix_values[island_loop_index].SaturationMismatchPresent = false;
+	if ((bus[indexer].phases & 0x02) == 0x02)	//Has a phase B
+	{
+		undeltacurr[1]=(adjusted_constant_current[1]+delta_current[1])-(adjusted_constant_current[0]+delta_current[0]);
 
-				//Loop through all branches -- inefficient, but meh
-				for (indexer=0; indexer<branch_count; indexer++)
-				{
-					//See if this branch is associated with this island
-					if (branch[indexer].island_number == island_loop_index)
-					{
-						//See if the function exists
-						if (branch[indexer].ExtraDeltaModeFunc != NULL)
-						{
-							//Call the function
-							func_result_val = ((int (*)(OBJECT *,bool *))(*branch[indexer].ExtraDeltaModeFunc))(branch[indexer].obj,&(powerflow_values->island_matrix_values[island_loop_index].SaturationMismatchPresent));
+		//Check for "different" children and apply them, as well
+		if ((bus[indexer].phases & 0x10) == 0x10)	//We do, so they must be Wye-connected
+		{
+			//Power values
+			undeltacurr[1] += (bus[indexer].V[1] == 0) ? 0 : ~(bus[indexer].extra_var[1]/bus[indexer].V[1]);
 
-							//Make sure it worked
-							if (func_result_val != 1)
-							{
-								GL_THROW("Extra delta update failed for device %s",branch[indexer].name ? branch[indexer].name : "Unnamed");
-								/*  TROUBLESHOOT
-								While attempting to perform the extra deltamode update, something failed.  Please try again.
-								If the error persists, please submit your code and a bug report via the ticketing system.
-								*/
-							}
-							//Default else -- it worked, keep going
-						}
-						//Default else - is NULL
-					}
-					//Default else -- not part of this island, so don't mess with it
-				}//End inefficient branch traversion
-			}//End in-rush and deltamode running
+			//Shunt values
+			undeltacurr[1] += bus[indexer].extra_var[4]*bus[indexer].V[1];
 
-			//Additional checks for special modes - only needs to happen in first dynamics powerflow
-			if (powerflow_type == PF_DYNINIT)
-			{
-				//See what "mode" we're in
-				if (powerflow_values->island_matrix_values[island_loop_index].new_iteration_required == false)	//Overall powerflow has converged
-				{
-					if (powerflow_values->island_matrix_values[island_loop_index].swing_converged == false)	//See if deltaI_sym is being met
-					{
-						//See which message to print
-						if (NR_islands_detected > 1)
-						{
-							//Give a verbose message, just cause
-							gl_verbose("NR_Solver: swing bus failed balancing criteria on island %d - making it a PQ for future dynamics",(island_loop_index+1));
-						}
-						else	//Single system
-						{
-							//Give a verbose message, just cause
-							gl_verbose("NR_Solver: swing bus failed balancing criteria - making it a PQ for future dynamics");
-						}
+			//Current values
+			undeltacurr[1] += adjusted_constant_current[4];
+		}
+	}
+	else
+	{
+		//Zero it, just in case
+		undeltacurr[1] = complex(0.0,0.0);
+	}
 
-						//See if we're still swing_is_a_swing mode
-						if (powerflow_values->island_matrix_values[island_loop_index].swing_is_a_swing == true)
-						{
-							//Deflag us
-							powerflow_values->island_matrix_values[island_loop_index].swing_is_a_swing = false;
+	if ((bus[indexer].phases & 0x01) == 0x01)	//Has a phase C
+	{
+		undeltacurr[2]=(adjusted_constant_current[2]+delta_current[2])-(adjusted_constant_current[1]+delta_current[1]);
 
-							//Loop through and deflag appropriate swing buses
-							for (indexer=0; indexer<bus_count; indexer++)
-							{
-								//See if we're in the "island of interest"
-								if (bus[indexer].island_number == island_loop_index)
-								{
-									//See if we're a swing-flagged bus
-									if ((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == true))
-									{
-										//See if we're "generator ready"
-										if ((*bus[indexer].dynamics_enabled==true) && (bus[indexer].DynCurrent != NULL))
-										{
-											//Deflag us back to "PQ" status
-											bus[indexer].swing_functions_enabled = false;
+		//Check for "different" children and apply them, as well
+		if ((bus[indexer].phases & 0x10) == 0x10)		//We do, so they must be Wye-connected
+		{
+			//Power values
+			undeltacurr[2] += (bus[indexer].V[2] == 0) ? 0 : ~(bus[indexer].extra_var[2]/bus[indexer].V[2]);
 
-											//Force a reiteration
-											powerflow_values->island_matrix_values[island_loop_index].new_iteration_required=true;
-										}
-									}
-									//Default else -- normal bus
-								}//End Island check
-								//Default else -- not in the current relevant island
-							}//End bus traversion loop
-						}
-						//Default else - if we're out of symmetry bounds, but already hit close, good enough
-					}
-					//Defaulted else - we're converged on all fronts, huzzah!
-				}
-				//Default else - still need to iterate
-			}//End special convergence criterion
+			//Shunt values
+			undeltacurr[2] += bus[indexer].extra_var[5]*bus[indexer].V[2];
 
-			//Check Saturation mismatch 
-			if (powerflow_values->island_matrix_values[island_loop_index].SaturationMismatchPresent == true)
-			{
-				//Force a reiter
-				powerflow_values->island_matrix_values[island_loop_index].new_iteration_required = true;
-			}
-			//Default else -- either no saturation, or it has converged - leave it be
+			//Current values
+			undeltacurr[2] += adjusted_constant_current[5];
+		}
+	}
+	else
+	{
+		//Zero it, just in case
+		undeltacurr[2] = complex(0.0,0.0);
+	}
 
-			//Turn off reallocation flag no matter what
-			powerflow_values->island_matrix_values[island_loop_index].NR_realloc_needed = false;
+	//Provide updates to relevant phases
+	//only compute and store phases that exist (make top heavy)
+	temp_index = -1;
+	temp_index_b = -1;
 
-			if (matrix_solver_method==MM_SUPERLU)
-			{
-				/* De-allocate storage - superLU matrix types must be destroyed at every iteration, otherwise they balloon fast (65 MB norma becomes 1.5 GB) */
-	#ifdef MT
-				//superLU_MT commands
-				Destroy_SuperNode_SCP(&L_LU);
-				Destroy_CompCol_NCP(&U_LU);
-	#else
-				//sequential superLU commands
-				Destroy_SuperNode_Matrix( &L_LU );
-				Destroy_CompCol_Matrix( &U_LU );
-				StatFree ( &stat );
-	#endif
-			}
-			else if (matrix_solver_method==MM_EXTERN)
-			{
-				//Call destruction routine
-				((void (*)(void *, bool))(LUSolverFcns.ext_destroy))(powerflow_values->island_matrix_values[island_loop_index].LU_solver_vars,powerflow_values->island_matrix_values[island_loop_index].new_iteration_required);
-			}
-			else	//Not sure how we get here
-			{
-				GL_THROW("Invalid matrix solution method specified for NR solver!");
-				//Defined above
-			}
+	for ( jindex = 0 ; jindex < diag_size ; jindex++ )
+	{
+		NR_load_phase_index(bus[indexer].phases,jindex,&temp_index,&temp_index_b);
 
-			//Final check -- see if the info result wasn't zero -- if so, deflag us no matter what here
-			if (powerflow_values->island_matrix_values[island_loop_index].solver_info != 0)
+		if (jacobian_pass == false)	//current-injection updates
+		{
+			if (((int)temp_index==-1) || ((int)temp_index_b==-1))
 			{
-				powerflow_values->island_matrix_values[island_loop_index].new_iteration_required = false;
+				GL_THROW("NR: A scheduled power update element failed.");
+				//Defined below
 			}
 
-			//Set the flag to not continue -- all should be handled below, this is just logic paranoia
-			proceed_to_next_island = false;
+			//Real power calculations
+			tempPbus = (undeltacurr[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Re() + (undeltacurr[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Im();	// Real power portion of Constant current component multiply the magnitude of bus voltage
+			bus[indexer].PL[temp_index] = tempPbus;	//Real power portion - all is current based
 
-			//Determine how we got here and what the next steps are
-			if (powerflow_values->island_matrix_values[island_loop_index].new_iteration_required == true)	//We think we need a new one
-			{
-				//Make sure we still can iterate - if we hit the iteration limit, we can't
-				if (powerflow_values->island_matrix_values[island_loop_index].iteration_count>=NR_iteration_limit)
-				{
-					powerflow_values->island_matrix_values[island_loop_index].return_code = -(powerflow_values->island_matrix_values[island_loop_index].iteration_count);
-		
-					if (NR_islands_detected > 1)
-					{
-						gl_verbose("Max solver mismatch of failed solution %f on island %d\n",powerflow_values->island_matrix_values[island_loop_index].max_mismatch_converge,(island_loop_index+1));
-					}
-					else
-					{
-						gl_verbose("Max solver mismatch of failed solution %f\n",powerflow_values->island_matrix_values[island_loop_index].max_mismatch_converge);
-					}
+			//Reactive load calculations
+			tempQbus = (undeltacurr[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Im() - (undeltacurr[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Re();	// Reactive power portion of Constant current component multiply the magnitude of bus voltage
+			bus[indexer].QL[temp_index] = tempQbus;	//Reactive power portion - all is current based
+		}
+		else	//Jacobian-type update
+		{
+			if (((int)temp_index==-1) || ((int)temp_index_b==-1))
+			{
+				GL_THROW("NR: A Jacobian update element failed.");
+				//Defined below
+			}
 
-					//We got here, we're done with this island
-					proceed_to_next_island = true;
-				}
-				else	//Normal iteration procedure - update the counter
-				{
-					powerflow_values->island_matrix_values[island_loop_index].iteration_count++;
+			volt_mag = (bus[indexer].V[temp_index_b]).Mag();
 
-					//Set the overall progression flag
-					proceed_to_next_island = false;
-				}
+			if (volt_mag!=0)
+			{
+				//Voltage powers shared by all four terms
+				volt_re_sq = pow((bus[indexer].V[temp_index_b]).Re(),2);
+				volt_im_sq = pow((bus[indexer].V[temp_index_b]).Im(),2);
+				volt_mag_cube = pow(volt_mag,3);
+
+				bus[indexer].Jacob_A[temp_index] = ((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Re() + (undeltacurr[temp_index_b]).Im() *volt_im_sq)/volt_mag_cube;// second part of equation(37) - no power term needed
+				bus[indexer].Jacob_B[temp_index] = -((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Im() + (undeltacurr[temp_index_b]).Re() *volt_re_sq)/volt_mag_cube;// second part of equation(38) - no power term needed
+				bus[indexer].Jacob_C[temp_index] =((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Im() - (undeltacurr[temp_index_b]).Re() *volt_im_sq)/volt_mag_cube;// second part of equation(39) - no power term needed
+				bus[indexer].Jacob_D[temp_index] = ((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Re() - (undeltacurr[temp_index_b]).Im() *volt_re_sq)/volt_mag_cube;// second part of equation(40) - no power term needed
 			}
-			else	//Should be done
+			else	//Zero voltage = only impedance is valid (others get divided by VMag, so are IND) - not entirely sure how this gets in here anyhow
 			{
-				//All paths lead to the next island/completion
-				proceed_to_next_island = true;
+				bus[indexer].Jacob_A[temp_index] = -1e-4;	//Small offset to avoid singularities (if impedance is zero too)
+				bus[indexer].Jacob_B[temp_index] = -1e-4;
+				bus[indexer].Jacob_C[temp_index] = -1e-4;
+				bus[indexer].Jacob_D[temp_index] = -1e-4;
+			}
+		}//End specific bus update method
+	}//End phase traversion
+}
 
-				//Report how we think we're done
-				if (powerflow_values->island_matrix_values[island_loop_index].solver_info == 0)	//It was a convergence exit
-				{
-					//See if we're multi-islanded or not
-					if (NR_islands_detected > 1)
-					{
-						gl_verbose("Power flow calculation for island %d converges at Iteration %d \n",(island_loop_index+1),(powerflow_values->island_matrix_values[island_loop_index].iteration_count+1));
-					}
-					else	//Singular
-					{
-						gl_verbose("Power flow calculation converges at Iteration %d \n",(powerflow_values->island_matrix_values[island_loop_index].iteration_count+1));
-					}
+//Load kernel - the triplex batch buses from batch_start to batch_end
+//Gathers each bus into the structure-of-arrays scratch, runs the arithmetic as one branch-free pass
+//(zero-voltage and absent-current cases are masked selects), then scatters the results back
+static void compute_load_triplex_lanes(BUSDATA *bus, NR_SOLVER_STRUCT *powerflow_values, unsigned int batch_start, unsigned int batch_end, bool jacobian_pass)
+{
+	unsigned int indexer, lane_index, lane_total, stride;
+	double *lane_data;
+	double *V0_re, *V0_im, *V1_re, *V1_im, *S_re[3], *S_im[3], *Y_re[3], *Y_im[3], *I_re[3], *I_im[3], *R_re[3], *R_im[3], *H_re[3], *H_im[3], *out[8];
+	double Vd_re, Vd_im, den, tc_re[3], tc_im[3], c_re[2], c_im[2], volt_mag, volt_re_sq, volt_im_sq, volt_mag_cube, v_re, v_im, v_reim;
+	double V_lane_re[3], V_lane_im[3];
+	complex temp_store[3];
+	bool has_value;
+	int jindex;
+
+	lane_total = batch_end - batch_start;
+	stride = powerflow_values->load_lane_stride;
+	lane_data = powerflow_values->load_lane_data;
+
+	//Map the fields - voltages, then power, admittance, current, pre-rotated current and house current per leg (1, 2, 12), then the outputs
+	V0_re = lane_data;
+	V0_im = lane_data + stride;
+	V1_re = lane_data + 2*stride;
+	V1_im = lane_data + 3*stride;
+
+	for (jindex=0; jindex<3; jindex++)
+	{
+		S_re[jindex] = lane_data + (4 + 2*jindex)*stride;
+		S_im[jindex] = lane_data + (5 + 2*jindex)*stride;
+		Y_re[jindex] = lane_data + (10 + 2*jindex)*stride;
+		Y_im[jindex] = lane_data + (11 + 2*jindex)*stride;
+		I_re[jindex] = lane_data + (16 + 2*jindex)*stride;
+		I_im[jindex] = lane_data + (17 + 2*jindex)*stride;
+		R_re[jindex] = lane_data + (22 + 2*jindex)*stride;
+		R_im[jindex] = lane_data + (23 + 2*jindex)*stride;
+		H_re[jindex] = lane_data + (28 + 2*jindex)*stride;
+		H_im[jindex] = lane_data + (29 + 2*jindex)*stride;
+	}
 
-					//Store the value as the return code
-					powerflow_values->island_matrix_values[island_loop_index].return_code = powerflow_values->island_matrix_values[island_loop_index].iteration_count;
-				}
-				else
-				{
-					//Write out the "failure"
+	for (jindex=0; jindex<8; jindex++)
+	{
+		out[jindex] = lane_data + (34 + jindex)*stride;
+	}
 
-					//See which version to write
-					if (NR_islands_detected > 1)
-					{
-						//For superLU - 2 = singular matrix it appears - positive values = process errors (singular, etc), negative values = input argument/syntax error
-						if (matrix_solver_method==MM_SUPERLU)
-						{
-							gl_verbose("superLU failed out of island %d with return value %d",(island_loop_index+1),powerflow_values->island_matrix_values[island_loop_index].solver_info);
-						}
-						else if (matrix_solver_method==MM_EXTERN)
-						{
-							gl_verbose("External LU solver failed out of island %d with return value %d",(island_loop_index+1),powerflow_values->island_matrix_values[island_loop_index].solver_info);
-						}
-						//Defaulted else - shouldn't exist (or make it this far), but if it does, we're failing anyways
-					}
-					else	//Singular
-					{
-						//For superLU - 2 = singular matrix it appears - positive values = process errors (singular, etc), negative values = input argument/syntax error
-						if (matrix_solver_method==MM_SUPERLU)
-						{
-							gl_verbose("superLU failed out with return value %d",powerflow_values->island_matrix_values[island_loop_index].solver_info);
-						}
-						else if (matrix_solver_method==MM_EXTERN)
-						{
-							gl_verbose("External LU solver failed out with return value %d",powerflow_values->island_matrix_values[island_loop_index].solver_info);
-						}
-						//Defaulted else - shouldn't exist (or make it this far), but if it does, we're failing anyways
-					}
+	//Gather
+	for (lane_index=0; lane_index<lane_total; lane_index++)
+	{
+		indexer = powerflow_values->load_batch_list[batch_start + lane_index];
 
-					//Store the return value as the failure
-					powerflow_values->island_matrix_values[island_loop_index].return_code = 0;
-				}
-			}
+		V0_re[lane_index] = bus[indexer].V[0].Re();
+		V0_im[lane_index] = bus[indexer].V[0].Im();
+		V1_re[lane_index] = bus[indexer].V[1].Re();
+		V1_im[lane_index] = bus[indexer].V[1].Im();
 
-			//Overall progression flag
-			if (proceed_to_next_island == true)
-			{
-				//See if we need to continue
-				if (island_loop_index >= (NR_islands_detected - 1))	//We're the last one
-				{
-					//Set the flag to be done
-					still_iterating_islands = false;
-				}
-				else	//Not last -- increment the counter and onwards
-				{
-					//Increment the counter
-					island_loop_index++;
+		for (jindex=0; jindex<3; jindex++)
+		{
+			S_re[jindex][lane_index] = bus[indexer].S[jindex].Re();
+			S_im[jindex][lane_index] = bus[indexer].S[jindex].Im();
+			Y_re[jindex][lane_index] = bus[indexer].Y[jindex].Re();
+			Y_im[jindex][lane_index] = bus[indexer].Y[jindex].Im();
+			R_re[jindex][lane_index] = bus[indexer].prerot_I[jindex].Re();
+			R_im[jindex][lane_index] = bus[indexer].prerot_I[jindex].Im();
+		}
 
-					//Force the flag, just to be paranoid
-					still_iterating_islands = true;
-				}
-			}
-		}//End iteration still needed while - indexed on island_loop_index
+		//current12 is not part of the standard current array
+		I_re[0][lane_index] = bus[indexer].I[0].Re();
+		I_im[0][lane_index] = bus[indexer].I[0].Im();
+		I_re[1][lane_index] = bus[indexer].I[1].Re();
+		I_im[1][lane_index] = bus[indexer].I[1].Im();
+		I_re[2][lane_index] = bus[indexer].extra_var->Re();
+		I_im[2][lane_index] = bus[indexer].extra_var->Im();
 
-		//Figure out the exit return values -- make them "worst case", so if all failed, return "bad_computations"
-		//If at least one passes, just return the max iteration count
-		*bad_computations = true;
-		return_value_for_solver_NR = 0;
+		//House-connected nodes - rotate the house currents to the present voltage angles (zero everywhere else)
+		if ((bus[indexer].phases & 0x40) == 0x40)
+		{
+			temp_store[0].SetPolar(1.0,bus[indexer].V[0].Arg());	//Pull phase of V1
+			temp_store[1].SetPolar(1.0,bus[indexer].V[1].Arg());	//Pull phase of V2
+			temp_store[2].SetPolar(1.0,(bus[indexer].V[0] + bus[indexer].V[1]).Arg());	//Pull phase of V12
 
-		//Loop through the islands and figure this out
-		for (island_loop_index=0; island_loop_index<NR_islands_detected; island_loop_index++)
+			for (jindex=0; jindex<3; jindex++)
+			{
+				//Just denominator conjugated to keep math right (rest was conjugated in house)
+				temp_store[jindex] = bus[indexer].house_var[jindex]/(~temp_store[jindex]);
+				H_re[jindex][lane_index] = temp_store[jindex].Re();
+				H_im[jindex][lane_index] = temp_store[jindex].Im();
+			}
+		}
+		else
 		{
-			if (powerflow_values->island_matrix_values[island_loop_index].return_code >= 0)	//Success or really bad failure
+			for (jindex=0; jindex<3; jindex++)
 			{
-				//See which one it is
-				if (powerflow_values->island_matrix_values[island_loop_index].new_iteration_required == false)	//We converged to get here!
-				{
-					*bad_computations = false;	//Deflag us
+				H_re[jindex][lane_index] = 0.0;
+				H_im[jindex][lane_index] = 0.0;
+			}
+		}
+	}
 
-					//See if we're the biggest iteration limit so far - assuming no one is reiterating
-					if (return_value_for_solver_NR >= 0)
-					{
-						if (powerflow_values->island_matrix_values[island_loop_index].iteration_count > return_value_for_solver_NR)
-						{
-							return_value_for_solver_NR = powerflow_values->island_matrix_values[island_loop_index].iteration_count;
-						}
-					}
-					//Default else -- someone is already negative, so just accept it
-				}
-				else if (NR_island_fail_method == true)	//Really bad failure, but let's see if we're in "special handling mode"
-				{
-					*bad_computations = false;	//Deflag us, so it keeps going
+	//Compute - same operation order as the complex class, so the results match the per-bus form exactly
+	for (lane_index=0; lane_index<lane_total; lane_index++)
+	{
+		//Leg voltages - V12 is V1 + V2
+		V_lane_re[0] = V0_re[lane_index];
+		V_lane_im[0] = V0_im[lane_index];
+		V_lane_re[1] = V1_re[lane_index];
+		V_lane_im[1] = V1_im[lane_index];
+		Vd_re = V0_re[lane_index] + V1_re[lane_index];
+		Vd_im = V0_im[lane_index] + V1_im[lane_index];
+		V_lane_re[2] = Vd_re;
+		V_lane_im[2] = Vd_im;
+
+		for (jindex=0; jindex<3; jindex++)
+		{
+			//Currents, plus unrotated currents (rotational correction happened elsewhere for triplex)
+			has_value = ((R_re[jindex][lane_index]*R_re[jindex][lane_index] + R_im[jindex][lane_index]*R_im[jindex][lane_index]) != 0.0);
+			tc_re[jindex] = has_value ? (I_re[jindex][lane_index] + R_re[jindex][lane_index]) : I_re[jindex][lane_index];
+			tc_im[jindex] = has_value ? (I_im[jindex][lane_index] + R_im[jindex][lane_index]) : I_im[jindex][lane_index];
+
+			//Power contributions - ~(S/V), zero at zero voltage
+			v_re = V_lane_re[jindex];
+			v_im = V_lane_im[jindex];
+			den = v_re*v_re + v_im*v_im;
+			has_value = (den != 0.0);
+			tc_re[jindex] += has_value ? ((S_re[jindex][lane_index]*v_re + S_im[jindex][lane_index]*v_im)/den) : 0.0;
+			tc_im[jindex] += has_value ? -((S_im[jindex][lane_index]*v_re - S_re[jindex][lane_index]*v_im)/den) : 0.0;
+
+			//Admittance/impedance contributions
+			tc_re[jindex] += Y_re[jindex][lane_index]*v_re - Y_im[jindex][lane_index]*v_im;
+			tc_im[jindex] += Y_re[jindex][lane_index]*v_im + Y_im[jindex][lane_index]*v_re;
+
+			//House currents
+			tc_re[jindex] += H_re[jindex][lane_index];
+			tc_im[jindex] += H_im[jindex][lane_index];
+		}
 
-					//Set the return value to the iteration limit (negative)
-					//No checks necessary -- this will just rail, regardless
-					return_value_for_solver_NR = -NR_iteration_limit;
+		//Line currents
+		c_re[0] = tc_re[0] + tc_re[2];
+		c_im[0] = tc_im[0] + tc_im[2];
+		c_re[1] = -tc_re[1] - tc_re[2];
+		c_im[1] = -tc_im[1] - tc_im[2];
 
-					if (fault_check_object == NULL)	//Make sure multi-island support is supported!
-					{
-						GL_THROW("NR: Multi-island handing without fault_check is not permitted");
-						/*  TROUBLESHOOT
-						The NR_island_failure_handled flag requires a fault_check object to be present.  Please add one to your GLM
-						to continue.
-						*/
-					}
-					else
-					{
-						//Call the "removal" routine - map it 
-						temp_fxn_val = (FUNCTIONADDR)(gl_get_function(fault_check_object,"island_removal_function"));
-						
-						//Make sure it was found
-						if (temp_fxn_val == NULL)
-						{
-							GL_THROW("NR: Unable to map island removal function");
-							/*  TROUBLESHOOT
-							While attempting to map the island removal function, an error was encountered.  Please
-							try again.  If the error persists, please submit your code and a report via the issues
-							system.
-							*/
-						}
+		if (jacobian_pass == false)	//Current injection update - convert to power, to be consistent with others
+		{
+			for (jindex=0; jindex<2; jindex++)
+			{
+				out[2*jindex][lane_index] = V_lane_re[jindex]*c_re[jindex] - V_lane_im[jindex]*(-c_im[jindex]);
+				out[2*jindex+1][lane_index] = V_lane_re[jindex]*(-c_im[jindex]) + V_lane_im[jindex]*c_re[jindex];
+			}
+		}
+		else	//Jacobian update - line currents need to be negated (due to the convention from earlier)
+		{
+			for (jindex=0; jindex<2; jindex++)
+			{
+				v_re = V_lane_re[jindex];
+				v_im = V_lane_im[jindex];
+				volt_mag = sqrt(v_re*v_re + v_im*v_im);
+				volt_re_sq = pow(v_re,2);
+				volt_im_sq = pow(v_im,2);
+				volt_mag_cube = pow(volt_mag,3);
+				v_reim = v_re*v_im;
+				c_re[jindex] = -c_re[jindex];
+				c_im[jindex] = -c_im[jindex];
+
+				//Zero voltage - very small to avoid singularity issues
+				has_value = (volt_mag != 0);
+				out[4*jindex][lane_index] = has_value ? ((v_reim*c_re[jindex] + c_im[jindex]*volt_im_sq)/volt_mag_cube) : -1e-4;	// second part of equation(37)
+				out[4*jindex+1][lane_index] = has_value ? (-(v_reim*c_im[jindex] + c_re[jindex]*volt_re_sq)/volt_mag_cube) : -1e-4;	// second part of equation(38)
+				out[4*jindex+2][lane_index] = has_value ? ((v_reim*c_im[jindex] - c_re[jindex]*volt_im_sq)/volt_mag_cube) : -1e-4;	// second part of equation(39)
+				out[4*jindex+3][lane_index] = has_value ? ((v_reim*c_re[jindex] - c_im[jindex]*volt_re_sq)/volt_mag_cube) : -1e-4;	// second part of equation(40)
+			}
+		}
+	}
 
-						//Call the function
-						call_return_status = ((STATUS (*)(OBJECT *,int))(temp_fxn_val))(fault_check_object,island_loop_index);
+	//Scatter
+	for (lane_index=0; lane_index<lane_total; lane_index++)
+	{
+		indexer = powerflow_values->load_batch_list[batch_start + lane_index];
 
-						//Make sure it worked
-						if (call_return_status != SUCCESS)
-						{
-							GL_THROW("NR: Failed to remove island %d from the powerflow",(island_loop_index+1));
-							/*  TROUBLESHOOT
-							While attempting to remove an island from the powerflow, an error occurred.  Please try again.
-							If the error persists, please submit your code and a report via the issues system.
-							*/
-						}
-						//If we succeeded, good to go!
-					}//End fault_check present
-				}
-				//Default else -- a bad failure we just want to ignore
-			}
-			else	//must be negative -- Not quite a full failure, just "something didn't converge"
+		if (jacobian_pass == false)
+		{
+			bus[indexer].PL[0] = out[0][lane_index];
+			bus[indexer].QL[0] = out[1][lane_index];
+			bus[indexer].PL[1] = out[2][lane_index];
+			bus[indexer].QL[1] = out[3][lane_index];
+		}
+		else
+		{
+			for (jindex=0; jindex<2; jindex++)
 			{
-				*bad_computations = false;	//Deflag us
+				bus[indexer].Jacob_A[jindex] = out[4*jindex][lane_index];
+				bus[indexer].Jacob_B[jindex] = out[4*jindex+1][lane_index];
+				bus[indexer].Jacob_C[jindex] = out[4*jindex+2][lane_index];
+				bus[indexer].Jacob_D[jindex] = out[4*jindex+3][lane_index];
+			}
 
-				//See which mode we're in
-				if (NR_island_fail_method == true)	//See if we're in "special island mode" or not
-				{
-					//Set the return value to the iteration limit (negative)
-					//No checks necessary -- this will just rail, regardless
-					return_value_for_solver_NR = -NR_iteration_limit;
+			//Zero the last elements, just to be safe (shouldn't be an issue, but who knows)
+			bus[indexer].Jacob_A[2] = 0.0;
+			bus[indexer].Jacob_B[2] = 0.0;
+			bus[indexer].Jacob_C[2] = 0.0;
+			bus[indexer].Jacob_D[2] = 0.0;
+		}
+	}
+}
 
-					if (fault_check_object == NULL)	//Make sure multi-island support is supported!
-					{
-						GL_THROW("NR: Multi-island handing without fault_check is not permitted");
-						//Defined above
-					}
-					else
-					{
-						//Call the "removal" routine - map it 
-						temp_fxn_val = (FUNCTIONADDR)(gl_get_function(fault_check_object,"island_removal_function"));
-						
-						//Make sure it was found
-						if (temp_fxn_val == NULL)
-						{
-							GL_THROW("NR: Unable to map island removal function");
-							//Defined above
-						}
+//Load kernel - the wye lanes (one per bus phase) from lane_start to lane_end, laid out by NR_build_load_lanes
+//Gathers each lane into the structure-of-arrays scratch, runs the arithmetic as one branch-free pass
+//(zero-voltage and absent-current cases are masked selects), then scatters the results back
+static void compute_load_wye_lanes(BUSDATA *bus, NR_SOLVER_STRUCT *powerflow_values, unsigned int lane_start, unsigned int lane_end, bool jacobian_pass)
+{
+	unsigned int indexer, lane_index, lane_total, stride;
+	int phase_index;
+	double *lane_data;
+	double *V_re, *V_im, *S_re, *S_im, *Y_re, *Y_im, *I_re, *I_im, *R_re, *R_im, *N_re, *N_im, *base, *out[4];
+	double v_re, v_im, volt_mag, t_re, t_im, d_re, d_im, den, adj_re, adj_im, volt_re_sq, volt_im_sq, volt_mag_cube, volt_mag_quad, two_reim, v_reim;
+	bool has_value;
+
+	lane_total = lane_end - lane_start;
+	stride = powerflow_values->load_lane_stride;
+	lane_data = powerflow_values->load_lane_data;
+
+	//Map the fields - voltage, power, admittance, current, pre-rotated current, nominal voltage and base, then the outputs
+	V_re = lane_data;
+	V_im = lane_data + stride;
+	S_re = lane_data + 2*stride;
+	S_im = lane_data + 3*stride;
+	Y_re = lane_data + 4*stride;
+	Y_im = lane_data + 5*stride;
+	I_re = lane_data + 6*stride;
+	I_im = lane_data + 7*stride;
+	R_re = lane_data + 8*stride;
+	R_im = lane_data + 9*stride;
+	N_re = lane_data + 10*stride;
+	N_im = lane_data + 11*stride;
+	base = lane_data + 12*stride;
+	out[0] = lane_data + 13*stride;
+	out[1] = lane_data + 14*stride;
+	out[2] = lane_data + 15*stride;
+	out[3] = lane_data + 16*stride;
+
+	//Gather
+	for (lane_index=0; lane_index<lane_total; lane_index++)
+	{
+		indexer = powerflow_values->load_lane_bus[lane_start + lane_index];
+		phase_index = powerflow_values->load_lane_phase[lane_start + lane_index];
+
+		V_re[lane_index] = bus[indexer].V[phase_index].Re();
+		V_im[lane_index] = bus[indexer].V[phase_index].Im();
+		S_re[lane_index] = bus[indexer].S[phase_index].Re();
+		S_im[lane_index] = bus[indexer].S[phase_index].Im();
+		Y_re[lane_index] = bus[indexer].Y[phase_index].Re();
+		Y_im[lane_index] = bus[indexer].Y[phase_index].Im();
+		I_re[lane_index] = bus[indexer].I[phase_index].Re();
+		I_im[lane_index] = bus[indexer].I[phase_index].Im();
+		R_re[lane_index] = bus[indexer].prerot_I[phase_index].Re();
+		R_im[lane_index] = bus[indexer].prerot_I[phase_index].Im();
+		base[lane_index] = bus[indexer].volt_base;
+		N_re[lane_index] = (NR_unit_phasor_LN[phase_index] * bus[indexer].volt_base).Re();
+		N_im[lane_index] = (NR_unit_phasor_LN[phase_index] * bus[indexer].volt_base).Im();
+	}
 
-						//Call the function
-						call_return_status = ((STATUS (*)(OBJECT *,int))(temp_fxn_val))(fault_check_object,island_loop_index);
+	//Compute - same operation order as the complex class, so the results match the per-bus form exactly
+	for (lane_index=0; lane_index<lane_total; lane_index++)
+	{
+		v_re = V_re[lane_index];
+		v_im = V_im[lane_index];
+		volt_mag = sqrt(v_re*v_re + v_im*v_im);
+
+		//Constant current, adjusted to maintain PF - ~(nominal * ~I * |V| / (V * base))
+		t_re = N_re[lane_index]*I_re[lane_index] - N_im[lane_index]*(-I_im[lane_index]);
+		t_im = N_re[lane_index]*(-I_im[lane_index]) + N_im[lane_index]*I_re[lane_index];
+		t_re *= volt_mag;
+		t_im *= volt_mag;
+		d_re = v_re*base[lane_index];
+		d_im = v_im*base[lane_index];
+		den = d_re*d_re + d_im*d_im;
+
+		has_value = ((I_re[lane_index]*I_re[lane_index] + I_im[lane_index]*I_im[lane_index]) != 0.0) & (volt_mag != 0.0);
+		adj_re = has_value ? ((t_re*d_re + t_im*d_im)/den) : 0.0;
+		adj_im = has_value ? -((t_im*d_re - t_re*d_im)/den) : 0.0;
+
+		//Pre-rotated current
+		has_value = ((R_re[lane_index]*R_re[lane_index] + R_im[lane_index]*R_im[lane_index]) != 0.0);
+		adj_re = has_value ? (adj_re + R_re[lane_index]) : adj_re;
+		adj_im = has_value ? (adj_im + R_im[lane_index]) : adj_im;
+
+		if (jacobian_pass == false)	//Current injection pass
+		{
+			// Constant power, plus constant current and constant impedance with the bus voltage
+			out[0][lane_index] = S_re[lane_index] + (adj_re*v_re + adj_im*v_im) + (Y_re[lane_index]*v_re*v_re + Y_re[lane_index]*v_im*v_im);
+			out[1][lane_index] = S_im[lane_index] + (adj_re*v_im - adj_im*v_re) + (-Y_im[lane_index]*v_im*v_im - Y_im[lane_index]*v_re*v_re);
+		}
+		else	//Jacobian update pass
+		{
+			volt_re_sq = pow(v_re,2);
+			volt_im_sq = pow(v_im,2);
+			volt_mag_cube = pow(volt_mag,3);
+			volt_mag_quad = pow(volt_mag,4);
+			two_reim = 2*v_re*v_im;
+			v_reim = v_re*v_im;
+
+			//Zero voltage = only impedance is valid, with a small offset to avoid singularity issues
+			has_value = (volt_mag != 0);
+			out[0][lane_index] = has_value ? ((S_im[lane_index] * (volt_re_sq - volt_im_sq) - two_reim*S_re[lane_index])/volt_mag_quad + ((v_reim*adj_re + adj_im*volt_im_sq)/volt_mag_cube + Y_im[lane_index])) : (Y_im[lane_index] - 1e-4);	// equation(37)
+			out[1][lane_index] = has_value ? ((S_re[lane_index] * (volt_re_sq - volt_im_sq) + two_reim*S_im[lane_index])/volt_mag_quad + (-(v_reim*adj_im + adj_re*volt_re_sq)/volt_mag_cube - Y_re[lane_index])) : (-Y_re[lane_index] - 1e-4);	// equation(38)
+			out[2][lane_index] = has_value ? ((S_re[lane_index] * (volt_im_sq - volt_re_sq) - two_reim*S_im[lane_index])/volt_mag_quad + ((v_reim*adj_im - adj_re*volt_im_sq)/volt_mag_cube - Y_re[lane_index])) : (-Y_re[lane_index] - 1e-4);	// equation(39)
+			out[3][lane_index] = has_value ? ((S_im[lane_index] * (volt_re_sq - volt_im_sq) - two_reim*S_re[lane_index])/volt_mag_quad + ((v_reim*adj_re - adj_im*volt_re_sq)/volt_mag_cube - Y_im[lane_index])) : (-Y_im[lane_index] - 1e-4);	// equation(40)
+		}
+	}
 
-						//Make sure it worked
-						if (call_return_status != SUCCESS)
-						{
-							GL_THROW("NR: Failed to remove island %d from the powerflow",(island_loop_index+1));
-							//Defined above
-						}
-						//If we succeeded, good to go!
-					}//End fault_check present
-				}
-				else	//Nope, just handle like "normal"
-				{
-					//See if we're the first negative one - if so, populate us (should just be NR limit)
-					if (powerflow_values->island_matrix_values[island_loop_index].return_code < return_value_for_solver_NR)
-					{
-						return_value_for_solver_NR = powerflow_values->island_matrix_values[island_loop_index].return_code;
-					}
-				}
-			}
-			//Default else - it was a failure, just keep going
+	//Scatter
+	for (lane_index=0; lane_index<lane_total; lane_index++)
+	{
+		indexer = powerflow_values->load_lane_bus[lane_start + lane_index];
+		phase_index = powerflow_values->load_lane_slot[lane_start + lane_index];
+
+		if (jacobian_pass == false)
+		{
+			bus[indexer].PL[phase_index] = out[0][lane_index];
+			bus[indexer].QL[phase_index] = out[1][lane_index];
 		}
-		Iteration = return_value_for_solver_NR+1;
+		else
+		{
+			bus[indexer].Jacob_A[phase_index] = out[0][lane_index];
+			bus[indexer].Jacob_B[phase_index] = out[1][lane_index];
+			bus[indexer].Jacob_C[phase_index] = out[2][lane_index];
+			bus[indexer].Jacob_D[phase_index] = out[3][lane_index];
+		}
+	}
+}
+
+//Load kernel - wye-connected bus with delta-connected "different" children
+static void compute_load_wye(BUSDATA *bus, unsigned int indexer, char diag_size, bool jacobian_pass)
+{
+	double adjust_nominal_voltage_val, tempPbus, tempQbus, adjust_temp_voltage_mag[6], volt_mag, volt_re_sq, volt_im_sq, volt_mag_cube, volt_mag_quad;
+	complex adjust_temp_nominal_voltage[6], adjusted_constant_current[6], delta_current[3], voltageDel[3], undeltacurr[3];
+	int jindex, temp_index, temp_index_b;
+
+	//Populate the values for constant current -- adjusted to maintain PF (used to be deltamode-only)
+	//Create nominal magnitudes
+	adjust_nominal_voltage_val = bus[indexer].volt_base;
 
-		//Deflag the "island locker"
-		NR_solver_working = false;
-	
-	}//End timed block
+	//Create the nominal voltage vectors
+	adjust_temp_nominal_voltage[3] = NR_unit_phasor_LN[0] * bus[indexer].volt_base;
+	adjust_temp_nominal_voltage[4] = NR_unit_phasor_LN[1] * bus[indexer].volt_base;
+	adjust_temp_nominal_voltage[5] = NR_unit_phasor_LN[2] * bus[indexer].volt_base;
 
-	//Check bad computations
-	if (*bad_computations == true)
+	//Get magnitudes of all
+	adjust_temp_voltage_mag[3] = bus[indexer].V[0].Mag();
+	adjust_temp_voltage_mag[4] = bus[indexer].V[1].Mag();
+	adjust_temp_voltage_mag[5] = bus[indexer].V[2].Mag();
+
+	//Start adjustments - A
+	if ((bus[indexer].I[0] != 0.0) && (adjust_temp_voltage_mag[3] != 0.0))
 	{
-		//Do the solver dump
-		solver_dump(bus_count,bus,branch_count,branch,solver_dump_enable);
-		
-		//Return 0 - just arbitrary here
-		return 0;
+		//calculate new value
+		adjusted_constant_current[0] = ~(adjust_temp_nominal_voltage[3] * ~bus[indexer].I[0] * adjust_temp_voltage_mag[3] / (bus[indexer].V[0] * adjust_nominal_voltage_val));
 	}
 	else
 	{
-		//Add the learning code (may need to be adjusted for multi-island)
-		try 
+		adjusted_constant_current[0] = complex(0.0,0.0);
+	}
+
+	//Start adjustments - B
+	if ((bus[indexer].I[1] != 0.0) && (adjust_temp_voltage_mag[4] != 0.0))
+	{
+		//calculate new value
+		adjusted_constant_current[1] = ~(adjust_temp_nominal_voltage[4] * ~bus[indexer].I[1] * adjust_temp_voltage_mag[4] / (bus[indexer].V[1] * adjust_nominal_voltage_val));
+	}
+	else
+	{
+		adjusted_constant_current[1] = complex(0.0,0.0);
+	}
+
+	//Start adjustments - C
+	if ((bus[indexer].I[2] != 0.0) && (adjust_temp_voltage_mag[5] != 0.0))
+	{
+		//calculate new value
+		adjusted_constant_current[2] = ~(adjust_temp_nominal_voltage[5] * ~bus[indexer].I[2] * adjust_temp_voltage_mag[5] / (bus[indexer].V[2] * adjust_nominal_voltage_val));
+	}
+	else
+	{
+		adjusted_constant_current[2] = complex(0.0,0.0);
+	}
+
+	if (bus[indexer].prerot_I[0] != 0.0)
+		adjusted_constant_current[0] += bus[indexer].prerot_I[0];
+
+	if (bus[indexer].prerot_I[1] != 0.0)
+		adjusted_constant_current[1] += bus[indexer].prerot_I[1];
+
+	if (bus[indexer].prerot_I[2] != 0.0)
+		adjusted_constant_current[2] += bus[indexer].prerot_I[2];
+
+	//See if we have any "different children"
+	if ((bus[indexer].phases & 0x10) == 0x10)
+	{
+		//Create nominal magnitudes
+		adjust_nominal_voltage_val = bus[indexer].volt_base * sqrt(3.0);
+
+		//Create the nominal voltage vectors
+		adjust_temp_nominal_voltage[0] = NR_unit_phasor_LL[0] * adjust_nominal_voltage_val;
+		adjust_temp_nominal_voltage[1] = NR_unit_phasor_LL[1] * adjust_nominal_voltage_val;
+		adjust_temp_nominal_voltage[2] = NR_unit_phasor_LL[2] * adjust_nominal_voltage_val;
+
+		//Compute delta voltages
+		voltageDel[0] = bus[indexer].V[0] - bus[indexer].V[1];
+		voltageDel[1] = bus[indexer].V[1] - bus[indexer].V[2];
+		voltageDel[2] = bus[indexer].V[2] - bus[indexer].V[0];
+
+		//Get magnitudes of all
+		adjust_temp_voltage_mag[0] = voltageDel[0].Mag();
+		adjust_temp_voltage_mag[1] = voltageDel[1].Mag();
+		adjust_temp_voltage_mag[2] = voltageDel[2].Mag();
+
+		//Start adjustments - AB
+		if ((bus[indexer].extra_var[6] != 0.0) && (adjust_temp_voltage_mag[0] != 0.0))
 		{
-			solver_python_learn(bus_count,bus,branch_count,branch,powerflow_values,powerflow_type,mesh_imped_vals,bad_computations,Iteration);
+			//calculate new value
+			adjusted_constant_current[3] = ~(adjust_temp_nominal_voltage[0] * ~bus[indexer].extra_var[6] * adjust_temp_voltage_mag[0] / (voltageDel[0] * adjust_nominal_voltage_val));
 		}
-		catch (const char *msg)
+		else
 		{
-			gl_error("solver_py: solver post failed -- %s",msg);
+			adjusted_constant_current[3] = complex(0.0,0.0);
 		}
-		catch (...)
+
+		//Start adjustments - BC
+		if ((bus[indexer].extra_var[7] != 0.0) && (adjust_temp_voltage_mag[1] != 0.0))
 		{
-			gl_error("solver_py: solver post failed -- unknown exception");
+			//calculate new value
+			adjusted_constant_current[4] = ~(adjust_temp_nominal_voltage[1] * ~bus[indexer].extra_var[7] * adjust_temp_voltage_mag[1] / (voltageDel[1] * adjust_nominal_voltage_val));
+		}
+		else
+		{
+			adjusted_constant_current[4] = complex(0.0,0.0);
 		}
 
-		if ( nr_profile != NULL ) 
-		{	
-			double t = clock() - t_start;	
-			char buffer[64];
-			if ( gl_printtime(gl_globalclock,buffer,sizeof(buffer)-1) > 0 )
-			{
-				if ( solver_profile_csv )
-				{
-					fprintf(nr_profile, "%s,%.1f,%.1lld,%d,%d,%d\n", buffer, t, Iteration,bus_count,branch_count,bad_computations ? 0 : 1);
-				}
-				else
-				{
-					fprintf(nr_profile, "%s %18.1f %9lld %9d %12d %s\n", buffer, t, Iteration,bus_count,branch_count,bad_computations ? "no" : "yes");
-				}
-			}
+		//Start adjustments - CA
+		if ((bus[indexer].extra_var[8] != 0.0) && (adjust_temp_voltage_mag[2] != 0.0))
+		{
+			//calculate new value
+			adjusted_constant_current[5] = ~(adjust_temp_nominal_voltage[2] * ~bus[indexer].extra_var[8] * adjust_temp_voltage_mag[2] / (voltageDel[2] * adjust_nominal_voltage_val));
+		}
+		else
+		{
+			adjusted_constant_current[5] = complex(0.0,0.0);
 		}
-				
-		//Return the maximum iteration count
-		return return_value_for_solver_NR;
 	}
-}
+	else	//Nope
+	{
+		//Set to zero, just cause
+		adjusted_constant_current[3] = complex(0.0,0.0);
+		adjusted_constant_current[4] = complex(0.0,0.0);
+		adjusted_constant_current[5] = complex(0.0,0.0);
+	}
 
-//Performs the load calculation portions of the current injection or Jacobian update
-//jacobian_pass should be set to true for the a,b,c, and d updates
-// For first approach, working on system load at each bus for current injection
-// For the second approach, calculate the elements of a,b,c,d in equations(14),(15),(16),(17).
-void compute_load_values(unsigned int bus_count, BUSDATA *bus, NR_SOLVER_STRUCT *powerflow_values, bool jacobian_pass, int island_number)
-{
-	unsigned int indexer;
-	double adjust_nominal_voltage_val, adjust_nominal_voltaged_val;
-	double tempPbus, tempQbus;
-	double adjust_temp_voltage_mag[6];
-	complex adjust_temp_nominal_voltage[6], adjusted_constant_current[6];
-	complex delta_current[3], voltageDel[3], undeltacurr[3];
-	complex temp_current[3], temp_store[3];
-	int jindex, temp_index, temp_index_b;
-	STATUS temp_status;
+	//For Wye-connected, only compute and store phases that exist (make top heavy)
+	temp_index = -1;
+	temp_index_b = -1;
 
-	//Loop through the buses
-	for (indexer=0; indexer<bus_count; indexer++)
+	if ((bus[indexer].phases & 0x10) == 0x10)	//"Different" child load - in this case it must be delta - also must be three phase (just because that's how I forced it to be implemented)
+	{											//Calculate all the deltas to wyes in advance (otherwise they'll get repeated)
+		//Make sure phase combinations exist
+		if ((bus[indexer].phases & 0x06) == 0x06)	//Has A-B
+		{
+			//Delta voltages
+			voltageDel[0] = bus[indexer].V[0] - bus[indexer].V[1];
+
+			//Power - put into a current value (iterates less this way)
+			delta_current[0] = (voltageDel[0] == 0) ? 0 : ~(bus[indexer].extra_var[0]/voltageDel[0]);
+
+			//Convert delta connected load to appropriate Wye
+			delta_current[0] += voltageDel[0] * (bus[indexer].extra_var[3]);
+		}
+		else
+		{
+			//Zero it, for good measure
+			voltageDel[0] = complex(0.0,0.0);
+			delta_current[0] = complex(0.0,0.0);
+		}
+
+		//Check for BC
+		if ((bus[indexer].phases & 0x03) == 0x03)	//Has B-C
+		{
+			//Delta voltages
+			voltageDel[1] = bus[indexer].V[1] - bus[indexer].V[2];
+
+			//Power - put into a current value (iterates less this way)
+			delta_current[1] = (voltageDel[1] == 0) ? 0 : ~(bus[indexer].extra_var[1]/voltageDel[1]);
+
+			//Convert delta connected load to appropriate Wye
+			delta_current[1] += voltageDel[1] * (bus[indexer].extra_var[4]);
+		}
+		else
+		{
+			//Zero it, for good measure
+			voltageDel[1] = complex(0.0,0.0);
+			delta_current[1] = complex(0.0,0.0);
+		}
+
+		//Check for CA
+		if ((bus[indexer].phases & 0x05) == 0x05)	//Has C-A
+		{
+			//Delta voltages
+			voltageDel[2] = bus[indexer].V[2] - bus[indexer].V[0];
+
+			//Power - put into a current value (iterates less this way)
+			delta_current[2] = (voltageDel[2] == 0) ? 0 : ~(bus[indexer].extra_var[2]/voltageDel[2]);
+
+			//Convert delta connected load to appropriate Wye
+			delta_current[2] += voltageDel[2] * (bus[indexer].extra_var[5]);
+		}
+		else
+		{
+			//Zero it, for good measure
+			voltageDel[2] = complex(0.0,0.0);
+			delta_current[2] = complex(0.0,0.0);
+		}
+
+		//Convert delta-current into a phase current - reuse temp variable
+		undeltacurr[0]=(adjusted_constant_current[3]+delta_current[0])-(adjusted_constant_current[5]+delta_current[2]);
+		undeltacurr[1]=(adjusted_constant_current[4]+delta_current[1])-(adjusted_constant_current[3]+delta_current[0]);
+		undeltacurr[2]=(adjusted_constant_current[5]+delta_current[2])-(adjusted_constant_current[4]+delta_current[1]);
+	}
+	else	//zero the variable so we don't have excessive ifs
+	{
+		undeltacurr[0] = undeltacurr[1] = undeltacurr[2] = complex(0.0,0.0);	//Zero it
+	}
+
+	for ( jindex = 0 ; jindex < diag_size ; jindex++ )
 	{
-		//See if we're relevant to the island of interest
-		if (bus[indexer].island_number == island_number)
+		NR_load_phase_index(bus[indexer].phases,jindex,&temp_index,&temp_index_b);
+
+		if (jacobian_pass == false)	//Current injection pass
 		{
-			//See if we have a load update function to call
-			if (bus[indexer].LoadUpdateFxn != NULL)
+			if (((int)temp_index==-1) || ((int)temp_index_b==-1))
 			{
-				//Call the function
-				temp_status = ((STATUS (*)(OBJECT *))(*bus[indexer].LoadUpdateFxn))(bus[indexer].obj);
+				GL_THROW("NR: A scheduled power update element failed.");
+				/*  TROUBLESHOOT
+				While attempting to calculate the scheduled portions of the
+				attached loads, an update failed to process correctly.
+				Submit you code and a bug report using the trac website.
+				*/
+			}
 
-				//Make sure it worked
-				if (temp_status == FAILED)
-				{
-					GL_THROW("NR: Load update failed for device %s",bus[indexer].obj->name ? bus[indexer].obj->name : "Unnamed");
-					/*  TROUBLESHOOT
-					While attempting to perform the load update function call, something failed.  Please try again.
-					If the error persists, please submit your code and a bug report via the ticketing system.
-					*/
-				}
-				//Default else - it worked
+			//Perform the power calculation
+			tempPbus = (bus[indexer].S[temp_index_b]).Re();									// Real power portion of constant power portion
+			tempPbus += (adjusted_constant_current[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Re() + (adjusted_constant_current[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Im();	// Real power portion of Constant current component multiply the magnitude of bus voltage
+			tempPbus += (undeltacurr[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Re() + (undeltacurr[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Im();	// Real power portion of Constant current from "different" children
+			tempPbus += (bus[indexer].Y[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Re() + (bus[indexer].Y[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Im();	// Real power portion of Constant impedance component multiply the square of the magnitude of bus voltage
+			bus[indexer].PL[temp_index] = tempPbus;	//Real power portion
+
+
+			tempQbus = (bus[indexer].S[temp_index_b]).Im();									// Reactive power portion of constant power portion
+			tempQbus += (adjusted_constant_current[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Im() - (adjusted_constant_current[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Re();	// Reactive power portion of Constant current component multiply the magnitude of bus voltage
+			tempQbus += (undeltacurr[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Im() - (undeltacurr[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Re();	// Reactive power portion of Constant current from "different" children
+			tempQbus += -(bus[indexer].Y[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Im() - (bus[indexer].Y[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Re();	// Reactive power portion of Constant impedance component multiply the square of the magnitude of bus voltage
+			bus[indexer].QL[temp_index] = tempQbus;	//Reactive power portion
+		}
+		else	//Jacobian update pass
+		{
+			if (((int)temp_index==-1) || ((int)temp_index_b==-1))
+			{
+				GL_THROW("NR: A Jacobian update element failed.");
+				/*  TROUBLESHOOT
+				While attempting to calculate the "dynamic" portions of the
+				Jacobian matrix that encompass attached loads, an update failed to process correctly.
+				Submit you code and a bug report using the trac website.
+				*/
 			}
 
-			if ((bus[indexer].phases & 0x08) == 0x08)	//Delta connected node
+			volt_mag = (bus[indexer].V[temp_index_b]).Mag();
+
+			if (volt_mag!=0)
 			{
-				//Populate the values for constant current -- adjusted to maintain PF (used to be deltamode-only)
-				//Create nominal magnitudes
-				adjust_nominal_voltage_val = bus[indexer].volt_base * sqrt(3.0);
-
-				//Create the nominal voltage vectors
-				adjust_temp_nominal_voltage[0].SetPolar(adjust_nominal_voltage_val,PI/6.0);
-				adjust_temp_nominal_voltage[1].SetPolar(adjust_nominal_voltage_val,-1.0*PI/2.0);
-				adjust_temp_nominal_voltage[2].SetPolar(adjust_nominal_voltage_val,5.0*PI/6.0);
-
-				//Compute delta voltages
-				voltageDel[0] = bus[indexer].V[0] - bus[indexer].V[1];
-				voltageDel[1] = bus[indexer].V[1] - bus[indexer].V[2];
-				voltageDel[2] = bus[indexer].V[2] - bus[indexer].V[0];
-
-				//Get magnitudes of all
-				adjust_temp_voltage_mag[0] = voltageDel[0].Mag();
-				adjust_temp_voltage_mag[1] = voltageDel[1].Mag();
-				adjust_temp_voltage_mag[2] = voltageDel[2].Mag();
-
-				//Start adjustments - AB
-				if ((bus[indexer].I[0] != 0.0) && (adjust_temp_voltage_mag[0] != 0.0))
-				{
-					//calculate new value
-					adjusted_constant_current[0] = ~(adjust_temp_nominal_voltage[0] * ~bus[indexer].I[0] * adjust_temp_voltage_mag[0] / (voltageDel[0] * adjust_nominal_voltage_val));
-				}
-				else
-				{
-					adjusted_constant_current[0] = complex(0.0,0.0);
-				}
+				//Voltage powers shared by all four terms
+				volt_re_sq = pow((bus[indexer].V[temp_index_b]).Re(),2);
+				volt_im_sq = pow((bus[indexer].V[temp_index_b]).Im(),2);
+				volt_mag_cube = pow(volt_mag,3);
+				volt_mag_quad = pow(volt_mag,4);
 
-				//Start adjustments - BC
-				if ((bus[indexer].I[1] != 0.0) && (adjust_temp_voltage_mag[1] != 0.0))
-				{
-					//calculate new value
-					adjusted_constant_current[1] = ~(adjust_temp_nominal_voltage[1] * ~bus[indexer].I[1] * adjust_temp_voltage_mag[1] / (voltageDel[1] * adjust_nominal_voltage_val));
-				}
-				else
-				{
-					adjusted_constant_current[1] = complex(0.0,0.0);
-				}
+				bus[indexer].Jacob_A[temp_index] = ((bus[indexer].S[temp_index_b]).Im() * (volt_re_sq - volt_im_sq) - 2*(bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(bus[indexer].S[temp_index_b]).Re())/volt_mag_quad;// first part of equation(37)
+				bus[indexer].Jacob_A[temp_index] += ((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(adjusted_constant_current[temp_index_b]).Re() + (adjusted_constant_current[temp_index_b]).Im() *volt_im_sq)/volt_mag_cube + (bus[indexer].Y[temp_index_b]).Im();// second part of equation(37)
+				bus[indexer].Jacob_A[temp_index] += ((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Re() + (undeltacurr[temp_index_b]).Im() *volt_im_sq)/volt_mag_cube;// current part of equation (37) - Handles "different" children
 
-				//Start adjustments - CA
-				if ((bus[indexer].I[2] != 0.0) && (adjust_temp_voltage_mag[2] != 0.0))
-				{
-					//calculate new value
-					adjusted_constant_current[2] = ~(adjust_temp_nominal_voltage[2] * ~bus[indexer].I[2] * adjust_temp_voltage_mag[2] / (voltageDel[2] * adjust_nominal_voltage_val));
-				}
-				else
-				{
-					adjusted_constant_current[2] = complex(0.0,0.0);
-				}
+				bus[indexer].Jacob_B[temp_index] = ((bus[indexer].S[temp_index_b]).Re() * (volt_re_sq - volt_im_sq) + 2*(bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(bus[indexer].S[temp_index_b]).Im())/volt_mag_quad;// first part of equation(38)
+				bus[indexer].Jacob_B[temp_index] += -((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(adjusted_constant_current[temp_index_b]).Im() + (adjusted_constant_current[temp_index_b]).Re() *volt_re_sq)/volt_mag_cube - (bus[indexer].Y[temp_index_b]).Re();// second part of equation(38)
+				bus[indexer].Jacob_B[temp_index] += -((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Im() + (undeltacurr[temp_index_b]).Re() *volt_re_sq)/volt_mag_cube;// current part of equation(38) - Handles "different" children
 
-				//See if we have any "different children"
-				if ((bus[indexer].phases & 0x10) == 0x10)
-				{
-					//Create nominal magnitudes
-					adjust_nominal_voltage_val = bus[indexer].volt_base;
+				bus[indexer].Jacob_C[temp_index] = ((bus[indexer].S[temp_index_b]).Re() * (volt_im_sq - volt_re_sq) - 2*(bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(bus[indexer].S[temp_index_b]).Im())/volt_mag_quad;// first part of equation(39)
+				bus[indexer].Jacob_C[temp_index] +=((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(adjusted_constant_current[temp_index_b]).Im() - (adjusted_constant_current[temp_index_b]).Re() *volt_im_sq)/volt_mag_cube - (bus[indexer].Y[temp_index_b]).Re();// second part of equation(39)
+				bus[indexer].Jacob_C[temp_index] +=((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Im() - (undeltacurr[temp_index_b]).Re() *volt_im_sq)/volt_mag_cube;// Current part of equation(39) - Handles "different" children
 
-					//Create the nominal voltage vectors
-					adjust_temp_nominal_voltage[3].SetPolar(bus[indexer].volt_base,0.0);
-					adjust_temp_nominal_voltage[4].SetPolar(bus[indexer].volt_base,-2.0*PI/3.0);
-					adjust_temp_nominal_voltage[5].SetPolar(bus[indexer].volt_base,2.0*PI/3.0);
+				bus[indexer].Jacob_D[temp_index] = ((bus[indexer].S[temp_index_b]).Im() * (volt_re_sq - volt_im_sq) - 2*(bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(bus[indexer].S[temp_index_b]).Re())/volt_mag_quad;// first part of equation(40)
+				bus[indexer].Jacob_D[temp_index] += ((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(adjusted_constant_current[temp_index_b]).Re() - (adjusted_constant_current[temp_index_b]).Im() *volt_re_sq)/volt_mag_cube - (bus[indexer].Y[temp_index_b]).Im();// second part of equation(40)
+				bus[indexer].Jacob_D[temp_index] += ((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Re() - (undeltacurr[temp_index_b]).Im() *volt_re_sq)/volt_mag_cube;// Current part of equation(40) - Handles "different" children
 
-					//Get magnitudes of all
-					adjust_temp_voltage_mag[3] = bus[indexer].V[0].Mag();
-					adjust_temp_voltage_mag[4] = bus[indexer].V[1].Mag();
-					adjust_temp_voltage_mag[5] = bus[indexer].V[2].Mag();
+			}
+			else
+			{
+				bus[indexer].Jacob_A[temp_index]= (bus[indexer].Y[temp_index_b]).Im() - 1e-4;	//Small offset to avoid singularity issues
+				bus[indexer].Jacob_B[temp_index]= -(bus[indexer].Y[temp_index_b]).Re() - 1e-4;
+				bus[indexer].Jacob_C[temp_index]= -(bus[indexer].Y[temp_index_b]).Re() - 1e-4;
+				bus[indexer].Jacob_D[temp_index]= -(bus[indexer].Y[temp_index_b]).Im() - 1e-4;
+			}
+		}//End of pass-specific bus updates
+	}//End phase traversion - Wye
+}
 
-					//Start adjustments - A
-					if ((bus[indexer].extra_var[6] != 0.0) && (adjust_temp_voltage_mag[3] != 0.0))
-					{
-						//calculate new value
-						adjusted_constant_current[3] = ~(adjust_temp_nominal_voltage[3] * ~bus[indexer].extra_var[6] * adjust_temp_voltage_mag[3] / (bus[indexer].V[0] * adjust_nominal_voltage_val));
-					}
-					else
-					{
-						adjusted_constant_current[3] = complex(0.0,0.0);
-					}
+//Load kernel - explicit delta/wye load values (S_dy, Y_dy, I_dy) of a non-triplex bus - accumulates onto the above
+static void compute_load_explicit_dy(BUSDATA *bus, unsigned int indexer, char diag_size, bool jacobian_pass)
+{
+	double adjust_nominal_voltage_val, adjust_nominal_voltaged_val, tempPbus, tempQbus, adjust_temp_voltage_mag[6], volt_mag, volt_re_sq, volt_im_sq, volt_mag_cube;
+	complex adjust_temp_nominal_voltage[6], adjusted_constant_current[6], delta_current[3], voltageDel[3], undeltacurr[3], temp_store[3];
+	int jindex, temp_index, temp_index_b;
 
-					//Start adjustments - B
-					if ((bus[indexer].extra_var[7] != 0.0) && (adjust_temp_voltage_mag[4] != 0.0))
-					{
-						//calculate new value
-						adjusted_constant_current[4] = ~(adjust_temp_nominal_voltage[4] * ~bus[indexer].extra_var[7] * adjust_temp_voltage_mag[4] / (bus[indexer].V[1] * adjust_nominal_voltage_val));
-					}
-					else
-					{
-						adjusted_constant_current[4] = complex(0.0,0.0);
-					}
+	//Delta components - populate according to what is there
+	if ((bus[indexer].phases & 0x06) == 0x06)	//Check for AB
+	{
+		//Voltage calculations
+		voltageDel[0] = bus[indexer].V[0] - bus[indexer].V[1];
 
-					//Start adjustments - C
-					if ((bus[indexer].extra_var[8] != 0.0) && (adjust_temp_voltage_mag[5] != 0.0))
-					{
-						//calculate new value
-						adjusted_constant_current[5] = ~(adjust_temp_nominal_voltage[5] * ~bus[indexer].extra_var[8] * adjust_temp_voltage_mag[5] / (bus[indexer].V[2] * adjust_nominal_voltage_val));
-					}
-					else
-					{
-						adjusted_constant_current[5] = complex(0.0,0.0);
-					}
-				}
-				else	//Nope
-				{
-					//Set to zero, just cause
-					adjusted_constant_current[3] = complex(0.0,0.0);
-					adjusted_constant_current[4] = complex(0.0,0.0);
-					adjusted_constant_current[5] = complex(0.0,0.0);
-				}
+		//Power - convert to a current (uses less iterations this way)
+		delta_current[0] = (voltageDel[0] == 0) ? 0 : ~(bus[indexer].S_dy[0]/voltageDel[0]);
 
-				//Delta components - populate according to what is there
-				if ((bus[indexer].phases & 0x06) == 0x06)	//Check for AB
-				{
-					//Voltage calculations
-					voltageDel[0] = bus[indexer].V[0] - bus[indexer].V[1];
+		//Convert delta connected load to appropriate Wye
+		delta_current[0] += voltageDel[0] * (bus[indexer].Y_dy[0]);
 
-					//Power - convert to a current (uses less iterations this way)
-					delta_current[0] = (voltageDel[0] == 0) ? 0 : ~(bus[indexer].S[0]/voltageDel[0]);
+	}
+	else
+	{
+		//Zero values - they shouldn't be used anyhow
+		voltageDel[0] = complex(0.0,0.0);
+		delta_current[0] = complex(0.0,0.0);
+	}
 
-					//Convert delta connected load to appropriate Wye
-					delta_current[0] += voltageDel[0] * (bus[indexer].Y[0]);
-				}
-				else
-				{
-					//Zero values - they shouldn't be used anyhow
-					voltageDel[0] = complex(0.0,0.0);
-					delta_current[0] = complex(0.0,0.0);
-				}
+	if ((bus[indexer].phases & 0x03) == 0x03)	//Check for BC
+	{
+		//Voltage calculations
+		voltageDel[1] = bus[indexer].V[1] - bus[indexer].V[2];
 
-				if ((bus[indexer].phases & 0x03) == 0x03)	//Check for BC
-				{
-					//Voltage calculations
-					voltageDel[1] = bus[indexer].V[1] - bus[indexer].V[2];
+		//Power - convert to a current (uses less iterations this way)
+		delta_current[1] = (voltageDel[1] == 0) ? 0 : ~(bus[indexer].S_dy[1]/voltageDel[1]);
 
-					//Power - convert to a current (uses less iterations this way)
-					delta_current[1] = (voltageDel[1] == 0) ? 0 : ~(bus[indexer].S[1]/voltageDel[1]);
+		//Convert delta connected load to appropriate Wye
+		delta_current[1] += voltageDel[1] * (bus[indexer].Y_dy[1]);
 
-					//Convert delta connected load to appropriate Wye
-					delta_current[1] += voltageDel[1] * (bus[indexer].Y[1]);
-				}
-				else
-				{
-					//Zero unused
-					voltageDel[1] = complex(0.0,0.0);
-					delta_current[1] = complex(0.0,0.0);
-				}
+	}
+	else
+	{
+		//Zero unused
+		voltageDel[1] = complex(0.0,0.0);
+		delta_current[1] = complex(0.0,0.0);
+	}
 
-				if ((bus[indexer].phases & 0x05) == 0x05)	//Check for CA
-				{
-					//Voltage calculations
-					voltageDel[2] = bus[indexer].V[2] - bus[indexer].V[0];
+	if ((bus[indexer].phases & 0x05) == 0x05)	//Check for CA
+	{
+		//Voltage calculations
+		voltageDel[2] = bus[indexer].V[2] - bus[indexer].V[0];
 
-					//Power - convert to a current (uses less iterations this way)
-					delta_current[2] = (voltageDel[2] == 0) ? 0 : ~(bus[indexer].S[2]/voltageDel[2]);
+		//Power - convert to a current (uses less iterations this way)
+		delta_current[2] = (voltageDel[2] == 0) ? 0 : ~(bus[indexer].S_dy[2]/voltageDel[2]);
 
-					//Convert delta connected load to appropriate Wye
-					delta_current[2] += voltageDel[2] * (bus[indexer].Y[2]);
-				}
-				else
-				{
-					//Zero unused
-					voltageDel[2] = complex(0.0,0.0);
-					delta_current[2] = complex(0.0,0.0);
-				}
+		//Convert delta connected load to appropriate Wye
+		delta_current[2] += voltageDel[2] * (bus[indexer].Y_dy[2]);
 
-				//Convert delta-current into a phase current, where appropriate - reuse temp variable
-				//Everything will be accumulated into the "current" field for ease (including differents)
-				if ((bus[indexer].phases & 0x04) == 0x04)	//Has a phase A
-				{
-					undeltacurr[0]=(adjusted_constant_current[0]+delta_current[0])-(adjusted_constant_current[2]+delta_current[2]);
+	}
+	else
+	{
+		//Zero unused
+		voltageDel[2] = complex(0.0,0.0);
+		delta_current[2] = complex(0.0,0.0);
+	}
+
+	//Populate the values for constant current -- adjusted to maintain PF (used to be deltamode-only)
+	//Create line-line nominal magnitude
+	adjust_nominal_voltage_val = bus[indexer].volt_base;
+	adjust_nominal_voltaged_val = bus[indexer].volt_base * sqrt(3.0);
+
+	//Create the nominal voltage vectors
+	adjust_temp_nominal_voltage[0] = NR_unit_phasor_LL[0] * adjust_nominal_voltaged_val;
+	adjust_temp_nominal_voltage[1] = NR_unit_phasor_LL[1] * adjust_nominal_voltaged_val;
+	adjust_temp_nominal_voltage[2] = NR_unit_phasor_LL[2] * adjust_nominal_voltaged_val;
+	adjust_temp_nominal_voltage[3] = NR_unit_phasor_LN[0] * adjust_nominal_voltage_val;
+	adjust_temp_nominal_voltage[4] = NR_unit_phasor_LN[1] * adjust_nominal_voltage_val;
+	adjust_temp_nominal_voltage[5] = NR_unit_phasor_LN[2] * adjust_nominal_voltage_val;
+
+	//Compute delta voltages
+	voltageDel[0] = bus[indexer].V[0] - bus[indexer].V[1];
+	voltageDel[1] = bus[indexer].V[1] - bus[indexer].V[2];
+	voltageDel[2] = bus[indexer].V[2] - bus[indexer].V[0];
+
+	//Get magnitudes of all
+	adjust_temp_voltage_mag[0] = voltageDel[0].Mag();
+	adjust_temp_voltage_mag[1] = voltageDel[1].Mag();
+	adjust_temp_voltage_mag[2] = voltageDel[2].Mag();
+	adjust_temp_voltage_mag[3] = bus[indexer].V[0].Mag();
+	adjust_temp_voltage_mag[4] = bus[indexer].V[1].Mag();
+	adjust_temp_voltage_mag[5] = bus[indexer].V[2].Mag();
+
+	//Start adjustments - A
+	if ((bus[indexer].I_dy[3] != 0.0) && (adjust_temp_voltage_mag[3] != 0.0))
+	{
+		//calculate new value
+		adjusted_constant_current[3] = ~(adjust_temp_nominal_voltage[3] * ~bus[indexer].I_dy[3] * adjust_temp_voltage_mag[3] / (bus[indexer].V[0] * adjust_nominal_voltage_val));
+	}
+	else
+	{
+		adjusted_constant_current[3] = complex(0.0,0.0);
+	}
+
+	//Start adjustments - B
+	if ((bus[indexer].I_dy[4] != 0.0) && (adjust_temp_voltage_mag[4] != 0.0))
+	{
+		//calculate new value
+		adjusted_constant_current[4] = ~(adjust_temp_nominal_voltage[4] * ~bus[indexer].I_dy[4] * adjust_temp_voltage_mag[4] / (bus[indexer].V[1] * adjust_nominal_voltage_val));
+	}
+	else
+	{
+		adjusted_constant_current[4] = complex(0.0,0.0);
+	}
+
+	//Start adjustments - C
+	if ((bus[indexer].I_dy[5] != 0.0) && (adjust_temp_voltage_mag[5] != 0.0))
+	{
+		//calculate new value
+		adjusted_constant_current[5] = ~(adjust_temp_nominal_voltage[5] * ~bus[indexer].I_dy[5] * adjust_temp_voltage_mag[5] / (bus[indexer].V[2] * adjust_nominal_voltage_val));
+	}
+	else
+	{
+		adjusted_constant_current[5] = complex(0.0,0.0);
+	}
+
+	//Start adjustments - AB
+	if ((bus[indexer].I_dy[0] != 0.0) && (adjust_temp_voltage_mag[0] != 0.0))
+	{
+		//calculate new value
+		adjusted_constant_current[0] = ~(adjust_temp_nominal_voltage[0] * ~bus[indexer].I_dy[0] * adjust_temp_voltage_mag[0] / (voltageDel[0] * adjust_nominal_voltaged_val));
+	}
+	else
+	{
+		adjusted_constant_current[0] = complex(0.0,0.0);
+	}
+
+	//Start adjustments - BC
+	if ((bus[indexer].I_dy[1] != 0.0) && (adjust_temp_voltage_mag[1] != 0.0))
+	{
+		//calculate new value
+		adjusted_constant_current[1] = ~(adjust_temp_nominal_voltage[1] * ~bus[indexer].I_dy[1] * adjust_temp_voltage_mag[1] / (voltageDel[1] * adjust_nominal_voltaged_val));
+	}
+	else
+	{
+		adjusted_constant_current[1] = complex(0.0,0.0);
+	}
+
+	//Start adjustments - CA
+	if ((bus[indexer].I_dy[2] != 0.0) && (adjust_temp_voltage_mag[2] != 0.0))
+	{
+		//calculate new value
+		adjusted_constant_current[2] = ~(adjust_temp_nominal_voltage[2] * ~bus[indexer].I_dy[2] * adjust_temp_voltage_mag[2] / (voltageDel[2] * adjust_nominal_voltaged_val));
+	}
+	else
+	{
+		adjusted_constant_current[2] = complex(0.0,0.0);
+	}
+
+	//Convert delta-current into a phase current, where appropriate - reuse temp variable
+	//Everything will be accumulated into the "current" field for ease (including differents)
+	//Also handle wye currents in here (was a differently connected child code before)
+	if ((bus[indexer].phases & 0x04) == 0x04)	//Has a phase A
+	{
+		undeltacurr[0]=(adjusted_constant_current[0]+delta_current[0])-(adjusted_constant_current[2]+delta_current[2]);
+
+		//Apply explicit wye-connected loads
+
+		//Power values
+		undeltacurr[0] += (bus[indexer].V[0] == 0) ? 0 : ~(bus[indexer].S_dy[3]/bus[indexer].V[0]);
+
+		//Shunt values
+		undeltacurr[0] += bus[indexer].Y_dy[3]*bus[indexer].V[0];
+
+		//Current values
+		undeltacurr[0] += adjusted_constant_current[3];
+
+		//Add any three-phase/non-triplex house contributions, if they exist
+		if ((bus[indexer].phases & 0x40) == 0x40)
+		{
+			//Update phase adjustments - use the temp array (not really needed)
+			temp_store[0].SetPolar(1.0,bus[indexer].V[0].Arg());
+
+			//Update these current contributions
+			undeltacurr[0] += bus[indexer].house_var[0]/(~temp_store[0]);		//Just denominator conjugated to keep math right (rest was conjugated in house)
+		}//End house-attached non-triplex
+	}
+	else
+	{
+		//Zero it, just in case
+		undeltacurr[0] = complex(0.0,0.0);
+	}
+
+	if ((bus[indexer].phases & 0x02) == 0x02)	//Has a phase B
+	{
+		undeltacurr[1]=(adjusted_constant_current[1]+delta_current[1])-(adjusted_constant_current[0]+delta_current[0]);
+
+		//Apply explicit wye-connected loads
+
+		//Power values
+		undeltacurr[1] += (bus[indexer].V[1] == 0) ? 0 : ~(bus[indexer].S_dy[4]/bus[indexer].V[1]);
+
+		//Shunt values
+		undeltacurr[1] += bus[indexer].Y_dy[4]*bus[indexer].V[1];
 
-					//Check for "different" children and apply them, as well
-					if ((bus[indexer].phases & 0x10) == 0x10)	//We do, so they must be Wye-connected
-					{
-						//Power values
-						undeltacurr[0] += (bus[indexer].V[0] == 0) ? 0 : ~(bus[indexer].extra_var[0]/bus[indexer].V[0]);
+		//Current values
+		undeltacurr[1] += adjusted_constant_current[4];
 
-						//Shunt values
-						undeltacurr[0] += bus[indexer].extra_var[3]*bus[indexer].V[0];
+		//Add any three-phase/non-triplex house contributions, if they exist
+		if ((bus[indexer].phases & 0x40) == 0x40)
+		{
+			//Update phase adjustments - use the temp array (not really needed)
+			temp_store[1].SetPolar(1.0,bus[indexer].V[1].Arg());
 
-						//Current values
-						undeltacurr[0] += adjusted_constant_current[3];
-					}
-				}
-				else
-				{
-					//Zero it, just in case
-					undeltacurr[0] = complex(0.0,0.0);
-				}
+			//Update these current contributions
+			undeltacurr[1] += bus[indexer].house_var[1]/(~temp_store[1]);		//Just denominator conjugated to keep math right (rest was conjugated in house)
+		}//End house-attached non-triplex
+	}
+	else
+	{
+		//Zero it, just in case
+		undeltacurr[1] = complex(0.0,0.0);
+	}
 
-				if ((bus[indexer].phases & 0x02) == 0x02)	//Has a phase B
-				{
-					undeltacurr[1]=(adjusted_constant_current[1]+delta_current[1])-(adjusted_constant_current[0]+delta_current[0]);
+	if ((bus[indexer].phases & 0x01) == 0x01)	//Has a phase C
+	{
+		undeltacurr[2]=(adjusted_constant_current[2]+delta_current[2])-(adjusted_constant_current[1]+delta_current[1]);
 
-					//Check for "different" children and apply them, as well
-					if ((bus[indexer].phases & 0x10) == 0x10)	//We do, so they must be Wye-connected
-					{
-						//Power values
-						undeltacurr[1] += (bus[indexer].V[1] == 0) ? 0 : ~(bus[indexer].extra_var[1]/bus[indexer].V[1]);
+		//Apply explicit wye-connected loads
 
-						//Shunt values
-						undeltacurr[1] += bus[indexer].extra_var[4]*bus[indexer].V[1];
+		//Power values
+		undeltacurr[2] += (bus[indexer].V[2] == 0) ? 0 : ~(bus[indexer].S_dy[5]/bus[indexer].V[2]);
 
-						//Current values
-						undeltacurr[1] += adjusted_constant_current[4];
-					}
-				}
-				else
-				{
-					//Zero it, just in case
-					undeltacurr[1] = complex(0.0,0.0);
-				}
+		//Shunt values
+		undeltacurr[2] += bus[indexer].Y_dy[5]*bus[indexer].V[2];
 
-				if ((bus[indexer].phases & 0x01) == 0x01)	//Has a phase C
-				{
-					undeltacurr[2]=(adjusted_constant_current[2]+delta_current[2])-(adjusted_constant_current[1]+delta_current[1]);
+		//Current values
+		undeltacurr[2] += adjusted_constant_current[5];
 
-					//Check for "different" children and apply them, as well
-					if ((bus[indexer].phases & 0x10) == 0x10)		//We do, so they must be Wye-connected
-					{
-						//Power values
-						undeltacurr[2] += (bus[indexer].V[2] == 0) ? 0 : ~(bus[indexer].extra_var[2]/bus[indexer].V[2]);
+		//Add any three-phase/non-triplex house contributions, if they exist
+		if ((bus[indexer].phases & 0x40) == 0x40)
+		{
+			//Update phase adjustments - use the temp array (not really needed)
+			temp_store[2].SetPolar(1.0,bus[indexer].V[2].Arg());
 
-						//Shunt values
-						undeltacurr[2] += bus[indexer].extra_var[5]*bus[indexer].V[2];
+			//Update these current contributions
+			undeltacurr[2] += bus[indexer].house_var[2]/(~temp_store[2]);		//Just denominator conjugated to keep math right (rest was conjugated in house)
+		}//End house-attached non-triplex
+	}
+	else
+	{
+		//Zero it, just in case
+		undeltacurr[2] = complex(0.0,0.0);
+	}
 
-						//Current values
-						undeltacurr[2] += adjusted_constant_current[5];
-					}
-				}
-				else
-				{
-					//Zero it, just in case
-					undeltacurr[2] = complex(0.0,0.0);
-				}
+	//Provide updates to relevant phases
+	//only compute and store phases that exist (make top heavy)
+	temp_index = -1;
+	temp_index_b = -1;
 
-				//Provide updates to relevant phases
-				//only compute and store phases that exist (make top heavy)
-				temp_index = -1;
-				temp_index_b = -1;
+	for ( jindex = 0 ; jindex < diag_size ; jindex++ )
+	{
+		NR_load_phase_index(bus[indexer].phases,jindex,&temp_index,&temp_index_b);
 
-				for ( jindex = 0 ; jindex < powerflow_values->BA_diag[indexer].size ; jindex++ )
-				{
-					switch(bus[indexer].phases & 0x07) {
-						case 0x01:	//C
-							{
-								temp_index=0;
-								temp_index_b=2;
-								break;
-							}
-						case 0x02:	//B
-							{
-								temp_index=0;
-								temp_index_b=1;
-								break;
-							}
-						case 0x03:	//BC
-							{
-								if (jindex==0)	//B
-								{
-									temp_index=0;
-									temp_index_b=1;
-								}
-								else			//C
-								{
-									temp_index=1;
-									temp_index_b=2;
-								}
-								break;
-							}
-						case 0x04:	//A
-							{
-								temp_index=0;
-								temp_index_b=0;
-								break;
-							}
-						case 0x05:	//AC
-							{
-								if (jindex==0)	//A
-								{
-									temp_index=0;
-									temp_index_b=0;
-								}
-								else			//C
-								{
-									temp_index=1;
-									temp_index_b=2;
-								}
-								break;
-							}
-						case 0x06:	//AB
-						case 0x07:	//ABC
-							{
-								temp_index=jindex;
-								temp_index_b=jindex;
-								break;
-							}
-						default:
-							break;
-					}//end case
+		if (jacobian_pass == false)	//Current injection update
+		{
+			if (((int)temp_index==-1) || ((int)temp_index_b==-1))
+			{
+				GL_THROW("NR: A scheduled power update element failed.");
+				//Defined below
+			}
 
-					if (jacobian_pass == false)	//current-injection updates
-					{
-						if (((int)temp_index==-1) || ((int)temp_index_b==-1))
-						{
-							GL_THROW("NR: A scheduled power update element failed.");
-							//Defined below
-						}
+			//Real power calculations
+			tempPbus = (undeltacurr[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Re() + (undeltacurr[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Im();	// Real power portion of Constant current component multiply the magnitude of bus voltage
+			bus[indexer].PL[temp_index] += tempPbus;	//Real power portion - all is current based -- accumulate in case mixed and matched with old above
 
-						//Real power calculations
-						tempPbus = (undeltacurr[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Re() + (undeltacurr[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Im();	// Real power portion of Constant current component multiply the magnitude of bus voltage
-						bus[indexer].PL[temp_index] = tempPbus;	//Real power portion - all is current based
+			//Reactive load calculations
+			tempQbus = (undeltacurr[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Im() - (undeltacurr[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Re();	// Reactive power portion of Constant current component multiply the magnitude of bus voltage
+			bus[indexer].QL[temp_index] += tempQbus;	//Reactive power portion - all is current based -- accumulate in case mixed and matched with old above
+		}
+		else	//Jacobian update
+		{
+			if (((int)temp_index==-1) || ((int)temp_index_b==-1))
+			{
+				GL_THROW("NR: A Jacobian update element failed.");
+				//Defined below
+			}
 
-						//Reactive load calculations
-						tempQbus = (undeltacurr[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Im() - (undeltacurr[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Re();	// Reactive power portion of Constant current component multiply the magnitude of bus voltage
-						bus[indexer].QL[temp_index] = tempQbus;	//Reactive power portion - all is current based
-					}
-					else	//Jacobian-type update
-					{
-						if (((int)temp_index==-1) || ((int)temp_index_b==-1))
-						{
-							GL_THROW("NR: A Jacobian update element failed.");
-							//Defined below
-						}
+			volt_mag = (bus[indexer].V[temp_index_b]).Mag();
 
-						if ((bus[indexer].V[temp_index_b]).Mag()!=0)
-						{
-							bus[indexer].Jacob_A[temp_index] = ((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Re() + (undeltacurr[temp_index_b]).Im() *pow((bus[indexer].V[temp_index_b]).Im(),2))/pow((bus[indexer].V[temp_index_b]).Mag(),3);// second part of equation(37) - no power term needed
-							bus[indexer].Jacob_B[temp_index] = -((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Im() + (undeltacurr[temp_index_b]).Re() *pow((bus[indexer].V[temp_index_b]).Re(),2))/pow((bus[indexer].V[temp_index_b]).Mag(),3);// second part of equation(38) - no power term needed
-							bus[indexer].Jacob_C[temp_index] =((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Im() - (undeltacurr[temp_index_b]).Re() *pow((bus[indexer].V[temp_index_b]).Im(),2))/pow((bus[indexer].V[temp_index_b]).Mag(),3);// second part of equation(39) - no power term needed
-							bus[indexer].Jacob_D[temp_index] = ((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Re() - (undeltacurr[temp_index_b]).Im() *pow((bus[indexer].V[temp_index_b]).Re(),2))/pow((bus[indexer].V[temp_index_b]).Mag(),3);// second part of equation(40) - no power term needed
-						}
-						else	//Zero voltage = only impedance is valid (others get divided by VMag, so are IND) - not entirely sure how this gets in here anyhow
-						{
-							bus[indexer].Jacob_A[temp_index] = -1e-4;	//Small offset to avoid singularities (if impedance is zero too)
-							bus[indexer].Jacob_B[temp_index] = -1e-4;
-							bus[indexer].Jacob_C[temp_index] = -1e-4;
-							bus[indexer].Jacob_D[temp_index] = -1e-4;
-						}
-					}//End specific bus update method
-				}//End phase traversion
-			}//end delta-connected load
-			else if	((bus[indexer].phases & 0x80) == 0x80)	//Split phase computations
+			if (volt_mag!=0)
 			{
-				//Convert it all back to current (easiest to handle)
-				//Get V12 first
-				voltageDel[0] = bus[indexer].V[0] + bus[indexer].V[1];
-
-				//Start with the currents (just put them in)
-				temp_current[0] = bus[indexer].I[0];
-				temp_current[1] = bus[indexer].I[1];
-				temp_current[2] = *bus[indexer].extra_var; //current12 is not part of the standard current array
-
-				//Add in unrotated, if necessary
-				//Same note as above.  With exception to house currents, rotational correction happened elsewhere (due to triplex being how it is)
-				if (bus[indexer].prerot_I[0] != 0.0)
-					temp_current[0] += bus[indexer].prerot_I[0];
-
-				if (bus[indexer].prerot_I[1] != 0.0)
-					temp_current[1] += bus[indexer].prerot_I[1];
-
-				if (bus[indexer].prerot_I[2] != 0.0)
-					temp_current[2] += bus[indexer].prerot_I[2];
-
-				//Now add in power contributions
-				temp_current[0] += bus[indexer].V[0] == 0.0 ? 0.0 : ~(bus[indexer].S[0]/bus[indexer].V[0]);
-				temp_current[1] += bus[indexer].V[1] == 0.0 ? 0.0 : ~(bus[indexer].S[1]/bus[indexer].V[1]);
-				temp_current[2] += voltageDel[0] == 0.0 ? 0.0 : ~(bus[indexer].S[2]/voltageDel[0]);
-
-				//Last, but not least, admittance/impedance contributions
-				temp_current[0] += bus[indexer].Y[0]*bus[indexer].V[0];
-				temp_current[1] += bus[indexer].Y[1]*bus[indexer].V[1];
-				temp_current[2] += bus[indexer].Y[2]*voltageDel[0];
-
-				//See if we are a house-connected node, if so, adjust and add in those values as well
-				if ((bus[indexer].phases & 0x40) == 0x40)
-				{
-					//Update phase adjustments
-					temp_store[0].SetPolar(1.0,bus[indexer].V[0].Arg());	//Pull phase of V1
-					temp_store[1].SetPolar(1.0,bus[indexer].V[1].Arg());	//Pull phase of V2
-					temp_store[2].SetPolar(1.0,voltageDel[0].Arg());		//Pull phase of V12
-
-					//Update these current contributions (use delta current variable, it isn't used in here anyways)
-					delta_current[0] = bus[indexer].house_var[0]/(~temp_store[0]);		//Just denominator conjugated to keep math right (rest was conjugated in house)
-					delta_current[1] = bus[indexer].house_var[1]/(~temp_store[1]);
-					delta_current[2] = bus[indexer].house_var[2]/(~temp_store[2]);
-
-					//Now add it into the current contributions
-					temp_current[0] += delta_current[0];
-					temp_current[1] += delta_current[1];
-					temp_current[2] += delta_current[2];
-				}//End house-attached splitphase
-
-				if (jacobian_pass == false)	//Current injection update
-				{
-					//Convert 'em to line currents, then make power (to be consistent with others)
-					temp_store[0] = bus[indexer].V[0]*~(temp_current[0] + temp_current[2]);
-					temp_store[1] = bus[indexer].V[1]*~(-temp_current[1] - temp_current[2]);
+				//Voltage powers shared by all four terms
+				volt_re_sq = pow((bus[indexer].V[temp_index_b]).Re(),2);
+				volt_im_sq = pow((bus[indexer].V[temp_index_b]).Im(),2);
+				volt_mag_cube = pow(volt_mag,3);
+
+				//Apply as an accumulation, in case any "normal" connections are present too
+				bus[indexer].Jacob_A[temp_index] += ((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Re() + (undeltacurr[temp_index_b]).Im() *volt_im_sq)/volt_mag_cube; // + (undeltaimped[temp_index_b]).Im();// second part of equation(37) - no power term needed
+				bus[indexer].Jacob_B[temp_index] += -((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Im() + (undeltacurr[temp_index_b]).Re() *volt_re_sq)/volt_mag_cube; // - (undeltaimped[temp_index_b]).Re();// second part of equation(38) - no power term needed
+				bus[indexer].Jacob_C[temp_index] +=((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Im() - (undeltacurr[temp_index_b]).Re() *volt_im_sq)/volt_mag_cube; // - (undeltaimped[temp_index_b]).Re();// second part of equation(39) - no power term needed
+				bus[indexer].Jacob_D[temp_index] += ((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Re() - (undeltacurr[temp_index_b]).Im() *volt_re_sq)/volt_mag_cube; // - (undeltaimped[temp_index_b]).Im();// second part of equation(40) - no power term needed
+			}
+			else	//Zero voltage = only impedance is valid (others get divided by VMag, so are IND) - not entirely sure how this gets in here anyhow
+			{
+				bus[indexer].Jacob_A[temp_index] += -1e-4; //(undeltaimped[temp_index_b]).Im() - 1e-4;	//Small offset to avoid singularities (if impedance is zero too)
+				bus[indexer].Jacob_B[temp_index] += -1e-4; //-(undeltaimped[temp_index_b]).Re() - 1e-4;
+				bus[indexer].Jacob_C[temp_index] += -1e-4; //-(undeltaimped[temp_index_b]).Re() - 1e-4;
+				bus[indexer].Jacob_D[temp_index] += -1e-4; //-(undeltaimped[temp_index_b]).Im() - 1e-4;
+			}
+		}//End pass differentiation
+	}//End phase traversion
+}
 
-					//Update the stored values
-					bus[indexer].PL[0] = temp_store[0].Re();
-					bus[indexer].QL[0] = temp_store[0].Im();
+//Load kernel - in-rush load admittance contributions to the Jacobian
+static void compute_load_inrush_jacobian(BUSDATA *bus, unsigned int indexer, char diag_size)
+{
+	int jindex, temp_index, temp_index_b;
 
-					bus[indexer].PL[1] = temp_store[1].Re();
-					bus[indexer].QL[1] = temp_store[1].Im();
-				}
-				else	//Jacobian update
-				{
-					//Convert 'em to line currents - they need to be negated (due to the convention from earlier)
-					temp_store[0] = -(temp_current[0] + temp_current[2]);
-					temp_store[1] = -(-temp_current[1] - temp_current[2]);
+	//Delta load components  get added to the Jacobian values too -- mostly because this is the most convenient place to do it
+	//See if we're even needed first
+	if (bus[indexer].full_Y_load != NULL)
+	{
+		//Provide updates to relevant phases
+		//only compute and store phases that exist (make top heavy)
+		temp_index = -1;
+		temp_index_b = -1;
 
-					for (jindex=0; jindex<2; jindex++)
-					{
-						if ((bus[indexer].V[jindex]).Mag()!=0)	//Only current
-						{
-							bus[indexer].Jacob_A[jindex] = ((bus[indexer].V[jindex]).Re()*(bus[indexer].V[jindex]).Im()*(temp_store[jindex]).Re() + (temp_store[jindex]).Im() *pow((bus[indexer].V[jindex]).Im(),2))/pow((bus[indexer].V[jindex]).Mag(),3);// second part of equation(37)
-							bus[indexer].Jacob_B[jindex] = -((bus[indexer].V[jindex]).Re()*(bus[indexer].V[jindex]).Im()*(temp_store[jindex]).Im() + (temp_store[jindex]).Re() *pow((bus[indexer].V[jindex]).Re(),2))/pow((bus[indexer].V[jindex]).Mag(),3);// second part of equation(38)
-							bus[indexer].Jacob_C[jindex] =((bus[indexer].V[jindex]).Re()*(bus[indexer].V[jindex]).Im()*(temp_store[jindex]).Im() - (temp_store[jindex]).Re() *pow((bus[indexer].V[jindex]).Im(),2))/pow((bus[indexer].V[jindex]).Mag(),3);// second part of equation(39)
-							bus[indexer].Jacob_D[jindex] = ((bus[indexer].V[jindex]).Re()*(bus[indexer].V[jindex]).Im()*(temp_store[jindex]).Re() - (temp_store[jindex]).Im() *pow((bus[indexer].V[jindex]).Re(),2))/pow((bus[indexer].V[jindex]).Mag(),3);// second part of equation(40)
-						}
-						else
-						{
-							bus[indexer].Jacob_A[jindex]=  -1e-4;	//Put very small to avoid singularity issues
-							bus[indexer].Jacob_B[jindex]=  -1e-4;
-							bus[indexer].Jacob_C[jindex]=  -1e-4;
-							bus[indexer].Jacob_D[jindex]=  -1e-4;
-						}
-					}
+		for ( jindex = 0 ; jindex < diag_size ; jindex++ )
+		{
+			NR_load_phase_index(bus[indexer].phases,jindex,&temp_index,&temp_index_b);
 
-					//Zero the last elements, just to be safe (shouldn't be an issue, but who knows)
-					bus[indexer].Jacob_A[2] = 0.0;
-					bus[indexer].Jacob_B[2] = 0.0;
-					bus[indexer].Jacob_C[2] = 0.0;
-					bus[indexer].Jacob_D[2] = 0.0;
-				}//End specific update type
-			}//end split-phase connected
-			else	//Wye-connected system/load
+			if (((int)temp_index==-1) || ((int)temp_index_b==-1))
 			{
-				//Populate the values for constant current -- adjusted to maintain PF (used to be deltamode-only)
-				//Create nominal magnitudes
-				adjust_nominal_voltage_val = bus[indexer].volt_base;
-
-				//Create the nominal voltage vectors
-				adjust_temp_nominal_voltage[3].SetPolar(bus[indexer].volt_base,0.0);
-				adjust_temp_nominal_voltage[4].SetPolar(bus[indexer].volt_base,-2.0*PI/3.0);
-				adjust_temp_nominal_voltage[5].SetPolar(bus[indexer].volt_base,2.0*PI/3.0);
-
-				//Get magnitudes of all
-				adjust_temp_voltage_mag[3] = bus[indexer].V[0].Mag();
-				adjust_temp_voltage_mag[4] = bus[indexer].V[1].Mag();
-				adjust_temp_voltage_mag[5] = bus[indexer].V[2].Mag();
-
-				//Start adjustments - A
-				if ((bus[indexer].I[0] != 0.0) && (adjust_temp_voltage_mag[3] != 0.0))
-				{
-					//calculate new value
-					adjusted_constant_current[0] = ~(adjust_temp_nominal_voltage[3] * ~bus[indexer].I[0] * adjust_temp_voltage_mag[3] / (bus[indexer].V[0] * adjust_nominal_voltage_val));
-				}
-				else
-				{
-					adjusted_constant_current[0] = complex(0.0,0.0);
-				}
+				GL_THROW("NR: A Jacobian update element failed.");
+				//Defined below
+			}
 
-				//Start adjustments - B
-				if ((bus[indexer].I[1] != 0.0) && (adjust_temp_voltage_mag[4] != 0.0))
-				{
-					//calculate new value
-					adjusted_constant_current[1] = ~(adjust_temp_nominal_voltage[4] * ~bus[indexer].I[1] * adjust_temp_voltage_mag[4] / (bus[indexer].V[1] * adjust_nominal_voltage_val));
-				}
-				else
-				{
-					adjusted_constant_current[1] = complex(0.0,0.0);
-				}
+			//Accumulate the values
+			bus[indexer].Jacob_A[temp_index] += bus[indexer].full_Y_load[temp_index_b].Im();
+			bus[indexer].Jacob_B[temp_index] += bus[indexer].full_Y_load[temp_index_b].Re();
+			bus[indexer].Jacob_C[temp_index] += bus[indexer].full_Y_load[temp_index_b].Re();
+			bus[indexer].Jacob_D[temp_index] -= bus[indexer].full_Y_load[temp_index_b].Im();
+		}//End phase traversion
+	}//End deltamode-enabled in-rush loads updates
+}
 
-				//Start adjustments - C
-				if ((bus[indexer].I[2] != 0.0) && (adjust_temp_voltage_mag[5] != 0.0))
-				{
-					//calculate new value
-					adjusted_constant_current[2] = ~(adjust_temp_nominal_voltage[5] * ~bus[indexer].I[2] * adjust_temp_voltage_mag[5] / (bus[indexer].V[2] * adjust_nominal_voltage_val));
-				}
-				else
-				{
-					adjusted_constant_current[2] = complex(0.0,0.0);
-				}
+//Runs the load kernels of one connection-type batch of an island on the present load values - the load update functions are not called
+//Shared by compute_load_values and solver_nr_scenarios
+static void NR_load_batch_kernels(BUSDATA *bus, NR_SOLVER_STRUCT *powerflow_values, bool jacobian_pass, int island_number, int batch_type)
+{
+	unsigned int indexer, batch_index, batch_start, batch_end;
+
+	batch_start = powerflow_values->load_batch_offset[NR_LOAD_BATCH_TYPES*island_number + batch_type];
+	batch_end = powerflow_values->load_batch_offset[NR_LOAD_BATCH_TYPES*island_number + batch_type + 1];
 
-				if (bus[indexer].prerot_I[0] != 0.0)
-					adjusted_constant_current[0] += bus[indexer].prerot_I[0];
+	if (batch_type == 1)	//Split phase computations - whole batch at once
+	{
+		compute_load_triplex_lanes(bus,powerflow_values,batch_start,batch_end,jacobian_pass);
+	}
+	else if (batch_type == 2)	//Wye-connected system/load - whole batch at once, one lane per phase
+	{
+		compute_load_wye_lanes(bus,powerflow_values,powerflow_values->load_lane_offset[island_number],powerflow_values->load_lane_offset[island_number+1],jacobian_pass);
+	}
+	else	//Delta-connected, or wye with "different" children - the cross-phase coupling keeps these per bus
+	{
+		for (batch_index=batch_start; batch_index<batch_end; batch_index++)
+		{
+			indexer = powerflow_values->load_batch_list[batch_index];
 
-				if (bus[indexer].prerot_I[1] != 0.0)
-					adjusted_constant_current[1] += bus[indexer].prerot_I[1];
+			if (batch_type == 0)	//Delta connected node
+			{
+				compute_load_delta(bus,indexer,powerflow_values->BA_diag[indexer].size,jacobian_pass);
+			}
+			else
+			{
+				compute_load_wye(bus,indexer,powerflow_values->BA_diag[indexer].size,jacobian_pass);
+			}
+		}
+	}
 
-				if (bus[indexer].prerot_I[2] != 0.0)
-					adjusted_constant_current[2] += bus[indexer].prerot_I[2];
+	//Accumulate the delta/wye explicit loads (no triplex) and in-rush load admittances (Jacobian only) onto the above
+	for (batch_index=batch_start; batch_index<batch_end; batch_index++)
+	{
+		indexer = powerflow_values->load_batch_list[batch_index];
 
-				//See if we have any "different children"
-				if ((bus[indexer].phases & 0x10) == 0x10)
-				{
-					//Create nominal magnitudes
-					adjust_nominal_voltage_val = bus[indexer].volt_base * sqrt(3.0);
-
-					//Create the nominal voltage vectors
-					adjust_temp_nominal_voltage[0].SetPolar(adjust_nominal_voltage_val,PI/6.0);
-					adjust_temp_nominal_voltage[1].SetPolar(adjust_nominal_voltage_val,-1.0*PI/2.0);
-					adjust_temp_nominal_voltage[2].SetPolar(adjust_nominal_voltage_val,5.0*PI/6.0);
-
-					//Compute delta voltages
-					voltageDel[0] = bus[indexer].V[0] - bus[indexer].V[1];
-					voltageDel[1] = bus[indexer].V[1] - bus[indexer].V[2];
-					voltageDel[2] = bus[indexer].V[2] - bus[indexer].V[0];
-
-					//Get magnitudes of all
-					adjust_temp_voltage_mag[0] = voltageDel[0].Mag();
-					adjust_temp_voltage_mag[1] = voltageDel[1].Mag();
-					adjust_temp_voltage_mag[2] = voltageDel[2].Mag();
-
-					//Start adjustments - AB
-					if ((bus[indexer].extra_var[6] != 0.0) && (adjust_temp_voltage_mag[0] != 0.0))
-					{
-						//calculate new value
-						adjusted_constant_current[3] = ~(adjust_temp_nominal_voltage[0] * ~bus[indexer].extra_var[6] * adjust_temp_voltage_mag[0] / (voltageDel[0] * adjust_nominal_voltage_val));
-					}
-					else
-					{
-						adjusted_constant_current[3] = complex(0.0,0.0);
-					}
+		if (batch_type != 1)
+		{
+			compute_load_explicit_dy(bus,indexer,powerflow_values->BA_diag[indexer].size,jacobian_pass);
+		}
 
-					//Start adjustments - BC
-					if ((bus[indexer].extra_var[7] != 0.0) && (adjust_temp_voltage_mag[1] != 0.0))
-					{
-						//calculate new value
-						adjusted_constant_current[4] = ~(adjust_temp_nominal_voltage[1] * ~bus[indexer].extra_var[7] * adjust_temp_voltage_mag[1] / (voltageDel[1] * adjust_nominal_voltage_val));
-					}
-					else
-					{
-						adjusted_constant_current[4] = complex(0.0,0.0);
-					}
+		if (jacobian_pass == true)
+		{
+			compute_load_inrush_jacobian(bus,indexer,powerflow_values->BA_diag[indexer].size);
+		}
+	}//End batch traversion
+}
 
-					//Start adjustments - CA
-					if ((bus[indexer].extra_var[8] != 0.0) && (adjust_temp_voltage_mag[2] != 0.0))
-					{
-						//calculate new value
-						adjusted_constant_current[5] = ~(adjust_temp_nominal_voltage[2] * ~bus[indexer].extra_var[8] * adjust_temp_voltage_mag[2] / (voltageDel[2] * adjust_nominal_voltage_val));
-					}
-					else
-					{
-						adjusted_constant_current[5] = complex(0.0,0.0);
-					}
-				}
-				else	//Nope
-				{
-					//Set to zero, just cause
-					adjusted_constant_current[3] = complex(0.0,0.0);
-					adjusted_constant_current[4] = complex(0.0,0.0);
-					adjusted_constant_current[5] = complex(0.0,0.0);
-				}
+//Current-injection mismatch of one PQ row at the present voltages and load values (equation (7)), laid out like deltaI_NR
+//Rows with no voltage are left out, like in solver_nr
+static void NR_bus_row_mismatch(BUSDATA *bus, BRANCHDATA *branch, NR_SOLVER_STRUCT *powerflow_values, unsigned int indexer, int jindex, double *mismatch_real, double *mismatch_imag)
+{
+	double Icalc_real, Icalc_imag, tempPbus, tempQbus, volt_mag_sq, volt_real, volt_imag;
+	int volt_index;
 
-				//For Wye-connected, only compute and store phases that exist (make top heavy)
-				temp_index = -1;
-				temp_index_b = -1;
+	NR_bus_row_current(bus,branch,powerflow_values,indexer,jindex,&Icalc_real,&Icalc_imag,&volt_index);
 
-				if ((bus[indexer].phases & 0x10) == 0x10)	//"Different" child load - in this case it must be delta - also must be three phase (just because that's how I forced it to be implemented)
-				{											//Calculate all the deltas to wyes in advance (otherwise they'll get repeated)
-					//Make sure phase combinations exist
-					if ((bus[indexer].phases & 0x06) == 0x06)	//Has A-B
-					{
-						//Delta voltages
-						voltageDel[0] = bus[indexer].V[0] - bus[indexer].V[1];
+	if ((bus[indexer].phases & 0x80) == 0x80)	//Triplex rows use their own voltage
+	{
+		volt_index = jindex;
 
-						//Power - put into a current value (iterates less this way)
-						delta_current[0] = (voltageDel[0] == 0) ? 0 : ~(bus[indexer].extra_var[0]/voltageDel[0]);
+		if ((bus[indexer].phases & 0x20) == 0x20)	//To bus of an SPCT is pre-negated
+		{
+			tempPbus = bus[indexer].PL[jindex];
+			tempQbus = bus[indexer].QL[jindex];
+		}
+		else
+		{
+			tempPbus = -bus[indexer].PL[jindex];
+			tempQbus = -bus[indexer].QL[jindex];
+		}
+	}
+	else
+	{
+		tempPbus = -bus[indexer].PL[jindex];
+		tempQbus = -bus[indexer].QL[jindex];
+	}
 
-						//Convert delta connected load to appropriate Wye
-						delta_current[0] += voltageDel[0] * (bus[indexer].extra_var[3]);
-					}
-					else
-					{
-						//Zero it, for good measure
-						voltageDel[0] = complex(0.0,0.0);
-						delta_current[0] = complex(0.0,0.0);
-					}
+	volt_mag_sq = (bus[indexer].V[volt_index]).Mag()*(bus[indexer].V[volt_index]).Mag();
 
-					//Check for BC
-					if ((bus[indexer].phases & 0x03) == 0x03)	//Has B-C
-					{
-						//Delta voltages
-						voltageDel[1] = bus[indexer].V[1] - bus[indexer].V[2];
+	if (volt_mag_sq != 0)
+	{
+		volt_real = (bus[indexer].V[volt_index]).Re();
+		volt_imag = (bus[indexer].V[volt_index]).Im();
 
-						//Power - put into a current value (iterates less this way)
-						delta_current[1] = (voltageDel[1] == 0) ? 0 : ~(bus[indexer].extra_var[1]/voltageDel[1]);
+		*mismatch_real = (tempPbus * volt_real + tempQbus * volt_imag)/volt_mag_sq - Icalc_real;
+		*mismatch_imag = (tempPbus * volt_imag - tempQbus * volt_real)/volt_mag_sq - Icalc_imag;
+	}
+	else
+	{
+		*mismatch_real = 0.0;
+		*mismatch_imag = 0.0;
+	}
+}
 
-						//Convert delta connected load to appropriate Wye
-						delta_current[1] += voltageDel[1] * (bus[indexer].extra_var[4]);
-					}
-					else
-					{
-						//Zero it, for good measure
-						voltageDel[1] = complex(0.0,0.0);
-						delta_current[1] = complex(0.0,0.0);
-					}
+//Solves a batch of load scenarios from the converged base solution, sharing its retained Jacobian factors
+//scenario_power holds the extra constant power load of each scenario, scenario_count x bus_count x 3 (A/B/C, or 1/2 for triplex)
+//On delta-connected buses the extra power is connected line-to-line (A is AB, B is BC, C is CA), like the bus's own constant power loads
+//scenario_voltage receives the voltages in the same layout, scenario_iterations the iterations of each scenario (negative if it never converged)
+//Each iteration evaluates the full current-injection mismatch of every unconverged scenario at its own voltages - the network
+//plus all the loads with the scenario's extra power added - and takes a chord step with the base factors.  All the chord steps
+//of an iteration share one multiple-right-hand-side triangular solve.  A scenario converges when its largest voltage change is within
+//maximum_voltage_error.  Generator, saturation, and deltamode injections are held at their base solution values.
+//The bus data and voltages of the base solution are only read - the scenarios run on private copies
+//Returns the number of converged scenarios, or -1 if no factorization is available
+int solver_nr_scenarios(unsigned int bus_count, BUSDATA *bus, BRANCHDATA *branch, NR_SOLVER_STRUCT *powerflow_values, unsigned int scenario_count, complex *scenario_power, complex *scenario_voltage, int64 *scenario_iterations)
+{
+	SUPERLU_NR_vars *superLU_vars;
+	SuperMatrix B_scenario;
+	NR_SOLVER_STRUCT scenario_values;
+	BUSDATA *scenario_bus;
+	complex *scenario_S;
+	double *rhs_scenario, *base_mismatch, *column;
+	double mismatch_real, mismatch_imag;
+	unsigned int *active_list;
+	unsigned int active_count, next_count, max_m, m, indexer, kindex, scen_offset;
+	int island_index, jindex, row_size, solver_info, batch_type;
+	int temp_index = 0, temp_index_b = 0;
+	int64 iteration;
+	complex V_delta;
+	bool scenario_converged;
+	int converged_count;
+#ifdef MT
+	Gstat_t scenario_stat;
+#else
+	SuperLUStat_t scenario_stat;
+#endif
 
-					//Check for CA
-					if ((bus[indexer].phases & 0x05) == 0x05)	//Has C-A
-					{
-						//Delta voltages
-						voltageDel[2] = bus[indexer].V[2] - bus[indexer].V[0];
+	if ((matrix_solver_method != MM_SUPERLU) || (NR_islands_detected <= 0) || (scenario_count == 0))
+	{
+		return -1;
+	}
 
-						//Power - put into a current value (iterates less this way)
-						delta_current[2] = (voltageDel[2] == 0) ? 0 : ~(bus[indexer].extra_var[2]/voltageDel[2]);
+	//Make sure every island has usable factors before doing anything
+	max_m = 0;
+	for (island_index=0; island_index<NR_islands_detected; island_index++)
+	{
+		superLU_vars = (SUPERLU_NR_vars *)powerflow_values->island_matrix_values[island_index].LU_solver_vars;
+		m = 2*powerflow_values->island_matrix_values[island_index].total_variables;
 
-						//Convert delta connected load to appropriate Wye
-						delta_current[2] += voltageDel[2] * (bus[indexer].extra_var[5]);
-					}
-					else
-					{
-						//Zero it, for good measure
-						voltageDel[2] = complex(0.0,0.0);
-						delta_current[2] = complex(0.0,0.0);
-					}
+		if ((superLU_vars == NULL) || (superLU_vars->factors_valid == false) || (superLU_vars->factor_m != m))
+		{
+			return -1;
+		}
 
-					//Convert delta-current into a phase current - reuse temp variable
-					undeltacurr[0]=(adjusted_constant_current[3]+delta_current[0])-(adjusted_constant_current[5]+delta_current[2]);
-					undeltacurr[1]=(adjusted_constant_current[4]+delta_current[1])-(adjusted_constant_current[3]+delta_current[0]);
-					undeltacurr[2]=(adjusted_constant_current[5]+delta_current[2])-(adjusted_constant_current[4]+delta_current[1]);
-				}
-				else	//zero the variable so we don't have excessive ifs
-				{
-					undeltacurr[0] = undeltacurr[1] = undeltacurr[2] = complex(0.0,0.0);	//Zero it
-				}
+		if (m > max_m)
+		{
+			max_m = m;
+		}
+	}
 
-				for ( jindex = 0 ; jindex < powerflow_values->BA_diag[indexer].size ; jindex++ )
-				{
-					switch(bus[indexer].phases & 0x07) {
-						case 0x01:	//C
-							{
-								temp_index=0;
-								temp_index_b=2;
-								break;
-							}
-						case 0x02:	//B
-							{
-								temp_index=0;
-								temp_index_b=1;
-								break;
-							}
-						case 0x03:	//BC
-							{
-								if (jindex==0)	//B
-								{
-									temp_index=0;
-									temp_index_b=1;
-								}
-								else			//C
-								{
-									temp_index=1;
-									temp_index_b=2;
-								}
-								break;
-							}
-						case 0x04:	//A
-							{
-								temp_index=0;
-								temp_index_b=0;
-								break;
-							}
-						case 0x05:	//AC
-							{
-								if (jindex==0)	//A
-								{
-									temp_index=0;
-									temp_index_b=0;
-								}
-								else			//C
-								{
-									temp_index=1;
-									temp_index_b=2;
-								}
-								break;
-							}
-						case 0x06:	//AB
-						case 0x07:	//ABC
-							{
-								temp_index=jindex;
-								temp_index_b=jindex;
-								break;
-							}
-						default:
-							break;
-					}//end case
+	//Batches should be there from the base solution already - but just in case
+	if ((powerflow_values->load_batch_valid == false) || (powerflow_values->load_batch_islands < NR_islands_detected))
+	{
+		NR_build_load_batches(bus_count,bus,powerflow_values);
+	}
 
-					if (jacobian_pass == false)	//Current injection pass
-					{
-						if (((int)temp_index==-1) || ((int)temp_index_b==-1))
-						{
-							GL_THROW("NR: A scheduled power update element failed.");
-							/*  TROUBLESHOOT
-							While attempting to calculate the scheduled portions of the
-							attached loads, an update failed to process correctly.
-							Submit you code and a bug report using the trac website.
-							*/
-						}
+	//The load kernels write the bus load totals and their lane scratch, so they run on copies - the voltage and
+	//power pointers of the copies are moved to the scenario values
+	scenario_values = *powerflow_values;
+	scenario_values.load_lane_data = (double *)gl_malloc(NR_LOAD_LANE_FIELDS*powerflow_values->load_lane_stride*sizeof(double));
+	scenario_bus = (BUSDATA *)gl_malloc(bus_count*sizeof(BUSDATA));
+	scenario_S = (complex *)gl_malloc(bus_count*3*sizeof(complex));
+	rhs_scenario = (double *)gl_malloc(max_m*scenario_count*sizeof(double));
+	base_mismatch = (double *)gl_malloc(max_m*sizeof(double));
+	active_list = (unsigned int *)gl_malloc(scenario_count*sizeof(unsigned int));
+
+	if ((scenario_values.load_lane_data == NULL) || (scenario_bus == NULL) || (scenario_S == NULL) || (rhs_scenario == NULL) || (base_mismatch == NULL) || (active_list == NULL))
+	{
+		GL_THROW("NR: Failed to allocate scenario solution arrays");
+		/*  TROUBLESHOOT
+		While attempting to allocate the work arrays for a batched scenario solution, an error occurred.
+		Please try again with fewer scenarios.  If the error persists, please submit your code and a bug report via the ticketing system.
+		*/
+	}
 
-						//Perform the power calculation
-						tempPbus = (bus[indexer].S[temp_index_b]).Re();									// Real power portion of constant power portion
-						tempPbus += (adjusted_constant_current[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Re() + (adjusted_constant_current[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Im();	// Real power portion of Constant current component multiply the magnitude of bus voltage
-						tempPbus += (undeltacurr[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Re() + (undeltacurr[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Im();	// Real power portion of Constant current from "different" children
-						tempPbus += (bus[indexer].Y[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Re() + (bus[indexer].Y[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Im();	// Real power portion of Constant impedance component multiply the square of the magnitude of bus voltage
-						bus[indexer].PL[temp_index] = tempPbus;	//Real power portion
+	memcpy(scenario_bus,bus,bus_count*sizeof(BUSDATA));
 
+	//Every scenario starts from the base solution
+	for (kindex=0; kindex<scenario_count; kindex++)
+	{
+		for (indexer=0; indexer<bus_count; indexer++)
+		{
+			for (jindex=0; jindex<3; jindex++)
+			{
+				scenario_voltage[(kindex*bus_count+indexer)*3+jindex] = bus[indexer].V[jindex];
+			}
+		}
 
-						tempQbus = (bus[indexer].S[temp_index_b]).Im();									// Reactive power portion of constant power portion
-						tempQbus += (adjusted_constant_current[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Im() - (adjusted_constant_current[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Re();	// Reactive power portion of Constant current component multiply the magnitude of bus voltage
-						tempQbus += (undeltacurr[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Im() - (undeltacurr[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Re();	// Reactive power portion of Constant current from "different" children
-						tempQbus += -(bus[indexer].Y[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Im() - (bus[indexer].Y[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Re();	// Reactive power portion of Constant impedance component multiply the square of the magnitude of bus voltage
-						bus[indexer].QL[temp_index] = tempQbus;	//Reactive power portion
-					}
-					else	//Jacobian update pass
-					{
-						if (((int)temp_index==-1) || ((int)temp_index_b==-1))
-						{
-							GL_THROW("NR: A Jacobian update element failed.");
-							/*  TROUBLESHOOT
-							While attempting to calculate the "dynamic" portions of the
-							Jacobian matrix that encompass attached loads, an update failed to process correctly.
-							Submit you code and a bug report using the trac website.
-							*/
-						}
+		scenario_iterations[kindex] = 0;
+	}
 
-						if ((bus[indexer].V[temp_index_b]).Mag()!=0)
-						{
-							bus[indexer].Jacob_A[temp_index] = ((bus[indexer].S[temp_index_b]).Im() * (pow((bus[indexer].V[temp_index_b]).Re(),2) - pow((bus[indexer].V[temp_index_b]).Im(),2)) - 2*(bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(bus[indexer].S[temp_index_b]).Re())/pow((bus[indexer].V[temp_index_b]).Mag(),4);// first part of equation(37)
-							bus[indexer].Jacob_A[temp_index] += ((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(adjusted_constant_current[temp_index_b]).Re() + (adjusted_constant_current[temp_index_b]).Im() *pow((bus[indexer].V[temp_index_b]).Im(),2))/pow((bus[indexer].V[temp_index_b]).Mag(),3) + (bus[indexer].Y[temp_index_b]).Im();// second part of equation(37)
-							bus[indexer].Jacob_A[temp_index] += ((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Re() + (undeltacurr[temp_index_b]).Im() *pow((bus[indexer].V[temp_index_b]).Im(),2))/pow((bus[indexer].V[temp_index_b]).Mag(),3);// current part of equation (37) - Handles "different" children
+	//Islands are independent systems with their own factors
+	for (island_index=0; island_index<NR_islands_detected; island_index++)
+	{
+		superLU_vars = (SUPERLU_NR_vars *)powerflow_values->island_matrix_values[island_index].LU_solver_vars;
+		m = 2*powerflow_values->island_matrix_values[island_index].total_variables;
 
-							bus[indexer].Jacob_B[temp_index] = ((bus[indexer].S[temp_index_b]).Re() * (pow((bus[indexer].V[temp_index_b]).Re(),2) - pow((bus[indexer].V[temp_index_b]).Im(),2)) + 2*(bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(bus[indexer].S[temp_index_b]).Im())/pow((bus[indexer].V[temp_index_b]).Mag(),4);// first part of equation(38)
-							bus[indexer].Jacob_B[temp_index] += -((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(adjusted_constant_current[temp_index_b]).Im() + (adjusted_constant_current[temp_index_b]).Re() *pow((bus[indexer].V[temp_index_b]).Re(),2))/pow((bus[indexer].V[temp_index_b]).Mag(),3) - (bus[indexer].Y[temp_index_b]).Re();// second part of equation(38)
-							bus[indexer].Jacob_B[temp_index] += -((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Im() + (undeltacurr[temp_index_b]).Re() *pow((bus[indexer].V[temp_index_b]).Re(),2))/pow((bus[indexer].V[temp_index_b]).Mag(),3);// current part of equation(38) - Handles "different" children
+		//Mismatch left in the base solution - this is what the held injections make up, so it is taken back out of every scenario
+		//A scenario with no extra power then has no mismatch at all
+		for (batch_type=0; batch_type<NR_LOAD_BATCH_TYPES; batch_type++)
+		{
+			NR_load_batch_kernels(scenario_bus,&scenario_values,false,island_index,batch_type);
+		}
 
-							bus[indexer].Jacob_C[temp_index] = ((bus[indexer].S[temp_index_b]).Re() * (pow((bus[indexer].V[temp_index_b]).Im(),2) - pow((bus[indexer].V[temp_index_b]).Re(),2)) - 2*(bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(bus[indexer].S[temp_index_b]).Im())/pow((bus[indexer].V[temp_index_b]).Mag(),4);// first part of equation(39)
-							bus[indexer].Jacob_C[temp_index] +=((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(adjusted_constant_current[temp_index_b]).Im() - (adjusted_constant_current[temp_index_b]).Re() *pow((bus[indexer].V[temp_index_b]).Im(),2))/pow((bus[indexer].V[temp_index_b]).Mag(),3) - (bus[indexer].Y[temp_index_b]).Re();// second part of equation(39)
-							bus[indexer].Jacob_C[temp_index] +=((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Im() - (undeltacurr[temp_index_b]).Re() *pow((bus[indexer].V[temp_index_b]).Im(),2))/pow((bus[indexer].V[temp_index_b]).Mag(),3);// Current part of equation(39) - Handles "different" children
+		memset(base_mismatch,0,m*sizeof(double));
 
-							bus[indexer].Jacob_D[temp_index] = ((bus[indexer].S[temp_index_b]).Im() * (pow((bus[indexer].V[temp_index_b]).Re(),2) - pow((bus[indexer].V[temp_index_b]).Im(),2)) - 2*(bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(bus[indexer].S[temp_index_b]).Re())/pow((bus[indexer].V[temp_index_b]).Mag(),4);// first part of equation(40)
-							bus[indexer].Jacob_D[temp_index] += ((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(adjusted_constant_current[temp_index_b]).Re() - (adjusted_constant_current[temp_index_b]).Im() *pow((bus[indexer].V[temp_index_b]).Re(),2))/pow((bus[indexer].V[temp_index_b]).Mag(),3) - (bus[indexer].Y[temp_index_b]).Im();// second part of equation(40)
-							bus[indexer].Jacob_D[temp_index] += ((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Re() - (undeltacurr[temp_index_b]).Im() *pow((bus[indexer].V[temp_index_b]).Re(),2))/pow((bus[indexer].V[temp_index_b]).Mag(),3);// Current part of equation(40) - Handles "different" children
+		for (indexer=0; indexer<bus_count; indexer++)
+		{
+			//Same buses the solver updates - no swing buses
+			if ((bus[indexer].island_number != island_index) || !((bus[indexer].type == 0) || ((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == false))))
+			{
+				continue;
+			}
 
-						}
-						else
-						{
-							bus[indexer].Jacob_A[temp_index]= (bus[indexer].Y[temp_index_b]).Im() - 1e-4;	//Small offset to avoid singularity issues
-							bus[indexer].Jacob_B[temp_index]= -(bus[indexer].Y[temp_index_b]).Re() - 1e-4;
-							bus[indexer].Jacob_C[temp_index]= -(bus[indexer].Y[temp_index_b]).Re() - 1e-4;
-							bus[indexer].Jacob_D[temp_index]= -(bus[indexer].Y[temp_index_b]).Im() - 1e-4;
-						}
-					}//End of pass-specific bus updates
-				}//End phase traversion - Wye
-			}//End wye-connected load
+			row_size = powerflow_values->BA_diag[indexer].size;
 
-			//Perform delta/wye explicit load updates -- no triplex
-			if ((bus[indexer].phases & 0x80) != 0x80)	//Not triplex
+			for (jindex=0; jindex<row_size; jindex++)
 			{
-				//Delta components - populate according to what is there
-				if ((bus[indexer].phases & 0x06) == 0x06)	//Check for AB
-				{
-					//Voltage calculations
-					voltageDel[0] = bus[indexer].V[0] - bus[indexer].V[1];
+				NR_bus_row_mismatch(scenario_bus,branch,powerflow_values,indexer,jindex,&mismatch_real,&mismatch_imag);
 
-					//Power - convert to a current (uses less iterations this way)
-					delta_current[0] = (voltageDel[0] == 0) ? 0 : ~(bus[indexer].S_dy[0]/voltageDel[0]);
+				base_mismatch[2*bus[indexer].Matrix_Loc + row_size + jindex] = mismatch_real;
+				base_mismatch[2*bus[indexer].Matrix_Loc + jindex] = mismatch_imag;
+			}
+		}
 
-					//Convert delta connected load to appropriate Wye
-					delta_current[0] += voltageDel[0] * (bus[indexer].Y_dy[0]);
+		//Scenarios that failed on an earlier island stay failed
+		active_count = 0;
+		for (kindex=0; kindex<scenario_count; kindex++)
+		{
+			if (scenario_iterations[kindex] >= 0)
+			{
+				active_list[active_count++] = kindex;
+			}
+		}
 
-				}
-				else
-				{
-					//Zero values - they shouldn't be used anyhow
-					voltageDel[0] = complex(0.0,0.0);
-					delta_current[0] = complex(0.0,0.0);
-				}
+		for (iteration=0; (iteration<NR_iteration_limit) && (active_count>0); iteration++)
+		{
+			//Full mismatch of each scenario at its present voltages
+			for (kindex=0; kindex<active_count; kindex++)
+			{
+				column = &rhs_scenario[kindex*m];
 
-				if ((bus[indexer].phases & 0x03) == 0x03)	//Check for BC
+				//Point the copies at the scenario - its voltages, and the base constant power plus its extra power
+				for (indexer=0; indexer<bus_count; indexer++)
 				{
-					//Voltage calculations
-					voltageDel[1] = bus[indexer].V[1] - bus[indexer].V[2];
+					scen_offset = (active_list[kindex]*bus_count+indexer)*3;
 
-					//Power - convert to a current (uses less iterations this way)
-					delta_current[1] = (voltageDel[1] == 0) ? 0 : ~(bus[indexer].S_dy[1]/voltageDel[1]);
+					scenario_bus[indexer].V = &scenario_voltage[scen_offset];
 
-					//Convert delta connected load to appropriate Wye
-					delta_current[1] += voltageDel[1] * (bus[indexer].Y_dy[1]);
+					if (bus[indexer].S != NULL)
+					{
+						for (jindex=0; jindex<3; jindex++)
+						{
+							scenario_S[indexer*3+jindex] = bus[indexer].S[jindex] + scenario_power[scen_offset+jindex];
+						}
 
-				}
-				else
-				{
-					//Zero unused
-					voltageDel[1] = complex(0.0,0.0);
-					delta_current[1] = complex(0.0,0.0);
+						scenario_bus[indexer].S = &scenario_S[indexer*3];
+					}
 				}
 
-				if ((bus[indexer].phases & 0x05) == 0x05)	//Check for CA
+				for (batch_type=0; batch_type<NR_LOAD_BATCH_TYPES; batch_type++)
 				{
-					//Voltage calculations
-					voltageDel[2] = bus[indexer].V[2] - bus[indexer].V[0];
-
-					//Power - convert to a current (uses less iterations this way)
-					delta_current[2] = (voltageDel[2] == 0) ? 0 : ~(bus[indexer].S_dy[2]/voltageDel[2]);
+					NR_load_batch_kernels(scenario_bus,&scenario_values,false,island_index,batch_type);
+				}
 
-					//Convert delta connected load to appropriate Wye
-					delta_current[2] += voltageDel[2] * (bus[indexer].Y_dy[2]);
+				memset(column,0,m*sizeof(double));
 
-				}
-				else
+				for (indexer=0; indexer<bus_count; indexer++)
 				{
-					//Zero unused
-					voltageDel[2] = complex(0.0,0.0);
-					delta_current[2] = complex(0.0,0.0);
-				}
+					if ((bus[indexer].island_number != island_index) || !((bus[indexer].type == 0) || ((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == false))))
+					{
+						continue;
+					}
 
-				//Populate the values for constant current -- adjusted to maintain PF (used to be deltamode-only)
-				//Create line-line nominal magnitude
-				adjust_nominal_voltage_val = bus[indexer].volt_base;
-				adjust_nominal_voltaged_val = bus[indexer].volt_base * sqrt(3.0);
-
-				//Create the nominal voltage vectors
-				adjust_temp_nominal_voltage[0].SetPolar(adjust_nominal_voltaged_val,PI/6.0);
-				adjust_temp_nominal_voltage[1].SetPolar(adjust_nominal_voltaged_val,-1.0*PI/2.0);
-				adjust_temp_nominal_voltage[2].SetPolar(adjust_nominal_voltaged_val,5.0*PI/6.0);
-				adjust_temp_nominal_voltage[3].SetPolar(adjust_nominal_voltage_val,0.0);
-				adjust_temp_nominal_voltage[4].SetPolar(adjust_nominal_voltage_val,-2.0*PI/3.0);
-				adjust_temp_nominal_voltage[5].SetPolar(adjust_nominal_voltage_val,2.0*PI/3.0);
-
-				//Compute delta voltages
-				voltageDel[0] = bus[indexer].V[0] - bus[indexer].V[1];
-				voltageDel[1] = bus[indexer].V[1] - bus[indexer].V[2];
-				voltageDel[2] = bus[indexer].V[2] - bus[indexer].V[0];
-
-				//Get magnitudes of all
-				adjust_temp_voltage_mag[0] = voltageDel[0].Mag();
-				adjust_temp_voltage_mag[1] = voltageDel[1].Mag();
-				adjust_temp_voltage_mag[2] = voltageDel[2].Mag();
-				adjust_temp_voltage_mag[3] = bus[indexer].V[0].Mag();
-				adjust_temp_voltage_mag[4] = bus[indexer].V[1].Mag();
-				adjust_temp_voltage_mag[5] = bus[indexer].V[2].Mag();
-
-				//Start adjustments - A
-				if ((bus[indexer].I_dy[3] != 0.0) && (adjust_temp_voltage_mag[3] != 0.0))
-				{
-					//calculate new value
-					adjusted_constant_current[3] = ~(adjust_temp_nominal_voltage[3] * ~bus[indexer].I_dy[3] * adjust_temp_voltage_mag[3] / (bus[indexer].V[0] * adjust_nominal_voltage_val));
-				}
-				else
-				{
-					adjusted_constant_current[3] = complex(0.0,0.0);
-				}
+					row_size = powerflow_values->BA_diag[indexer].size;
 
-				//Start adjustments - B
-				if ((bus[indexer].I_dy[4] != 0.0) && (adjust_temp_voltage_mag[4] != 0.0))
-				{
-					//calculate new value
-					adjusted_constant_current[4] = ~(adjust_temp_nominal_voltage[4] * ~bus[indexer].I_dy[4] * adjust_temp_voltage_mag[4] / (bus[indexer].V[1] * adjust_nominal_voltage_val));
-				}
-				else
-				{
-					adjusted_constant_current[4] = complex(0.0,0.0);
-				}
+					for (jindex=0; jindex<row_size; jindex++)
+					{
+						NR_bus_row_mismatch(scenario_bus,branch,powerflow_values,indexer,jindex,&mismatch_real,&mismatch_imag);
 
-				//Start adjustments - C
-				if ((bus[indexer].I_dy[5] != 0.0) && (adjust_temp_voltage_mag[5] != 0.0))
-				{
-					//calculate new value
-					adjusted_constant_current[5] = ~(adjust_temp_nominal_voltage[5] * ~bus[indexer].I_dy[5] * adjust_temp_voltage_mag[5] / (bus[indexer].V[2] * adjust_nominal_voltage_val));
-				}
-				else
-				{
-					adjusted_constant_current[5] = complex(0.0,0.0);
+						column[2*bus[indexer].Matrix_Loc + row_size + jindex] = mismatch_real - base_mismatch[2*bus[indexer].Matrix_Loc + row_size + jindex];
+						column[2*bus[indexer].Matrix_Loc + jindex] = mismatch_imag - base_mismatch[2*bus[indexer].Matrix_Loc + jindex];
+					}
 				}
+			}
 
-				//Start adjustments - AB
-				if ((bus[indexer].I_dy[0] != 0.0) && (adjust_temp_voltage_mag[0] != 0.0))
-				{
-					//calculate new value
-					adjusted_constant_current[0] = ~(adjust_temp_nominal_voltage[0] * ~bus[indexer].I_dy[0] * adjust_temp_voltage_mag[0] / (voltageDel[0] * adjust_nominal_voltaged_val));
-				}
-				else
-				{
-					adjusted_constant_current[0] = complex(0.0,0.0);
-				}
+			//One triangular solve for the chord steps of all the active scenarios
+			dCreate_Dense_Matrix(&B_scenario, m, active_count, rhs_scenario, m, SLU_DN, SLU_D, SLU_GE);
 
-				//Start adjustments - BC
-				if ((bus[indexer].I_dy[1] != 0.0) && (adjust_temp_voltage_mag[1] != 0.0))
-				{
-					//calculate new value
-					adjusted_constant_current[1] = ~(adjust_temp_nominal_voltage[1] * ~bus[indexer].I_dy[1] * adjust_temp_voltage_mag[1] / (voltageDel[1] * adjust_nominal_voltaged_val));
-				}
-				else
-				{
-					adjusted_constant_current[1] = complex(0.0,0.0);
-				}
+#ifdef MT
+			StatAlloc(m, NR_superLU_procs, sp_ienv(1), sp_ienv(2), &scenario_stat);
+			StatInit(m, NR_superLU_procs, &scenario_stat);
 
-				//Start adjustments - CA
-				if ((bus[indexer].I_dy[2] != 0.0) && (adjust_temp_voltage_mag[2] != 0.0))
-				{
-					//calculate new value
-					adjusted_constant_current[2] = ~(adjust_temp_nominal_voltage[2] * ~bus[indexer].I_dy[2] * adjust_temp_voltage_mag[2] / (voltageDel[2] * adjust_nominal_voltaged_val));
-				}
-				else
-				{
-					adjusted_constant_current[2] = complex(0.0,0.0);
-				}
+			dgstrs(NOTRANS, &superLU_vars->L_LU, &superLU_vars->U_LU, superLU_vars->perm_r, superLU_vars->perm_c, &B_scenario, &scenario_stat, &solver_info);
 
-				//Convert delta-current into a phase current, where appropriate - reuse temp variable
-				//Everything will be accumulated into the "current" field for ease (including differents)
-				//Also handle wye currents in here (was a differently connected child code before)
-				if ((bus[indexer].phases & 0x04) == 0x04)	//Has a phase A
-				{
-					undeltacurr[0]=(adjusted_constant_current[0]+delta_current[0])-(adjusted_constant_current[2]+delta_current[2]);
+			StatFree(&scenario_stat);
+#else
+			StatInit(&scenario_stat);
 
-					//Apply explicit wye-connected loads
+			dgstrs(NOTRANS, &superLU_vars->L_LU, &superLU_vars->U_LU, superLU_vars->perm_c, superLU_vars->perm_r, &B_scenario, &scenario_stat, &solver_info);
 
-					//Power values
-					undeltacurr[0] += (bus[indexer].V[0] == 0) ? 0 : ~(bus[indexer].S_dy[3]/bus[indexer].V[0]);
+			StatFree(&scenario_stat);
+#endif
 
-					//Shunt values
-					undeltacurr[0] += bus[indexer].Y_dy[3]*bus[indexer].V[0];
+			Destroy_SuperMatrix_Store(&B_scenario);
 
-					//Current values
-					undeltacurr[0] += adjusted_constant_current[3];
+			if (solver_info != 0)
+			{
+				break;	//Everything still active fails below
+			}
 
-					//Add any three-phase/non-triplex house contributions, if they exist
-					if ((bus[indexer].phases & 0x40) == 0x40)
-					{
-						//Update phase adjustments - use the temp array (not really needed)
-						temp_store[0].SetPolar(1.0,bus[indexer].V[0].Arg());
+			//Apply the steps
+			next_count = 0;
 
-						//Update these current contributions
-						undeltacurr[0] += bus[indexer].house_var[0]/(~temp_store[0]);		//Just denominator conjugated to keep math right (rest was conjugated in house)
-					}//End house-attached non-triplex
-				}
-				else
-				{
-					//Zero it, just in case
-					undeltacurr[0] = complex(0.0,0.0);
-				}
+			for (kindex=0; kindex<active_count; kindex++)
+			{
+				column = &rhs_scenario[kindex*m];
+				scenario_converged = true;
 
-				if ((bus[indexer].phases & 0x02) == 0x02)	//Has a phase B
+				for (indexer=0; indexer<bus_count; indexer++)
 				{
-					undeltacurr[1]=(adjusted_constant_current[1]+delta_current[1])-(adjusted_constant_current[0]+delta_current[0]);
+					if ((bus[indexer].island_number != island_index) || !((bus[indexer].type == 0) || ((bus[indexer].type > 1) && (bus[indexer].swing_functions_enabled == false))))
+					{
+						continue;
+					}
 
-					//Apply explicit wye-connected loads
+					row_size = powerflow_values->BA_diag[indexer].size;
 
-					//Power values
-					undeltacurr[1] += (bus[indexer].V[1] == 0) ? 0 : ~(bus[indexer].S_dy[4]/bus[indexer].V[1]);
+					for (jindex=0; jindex<row_size; jindex++)
+					{
+						if ((bus[indexer].phases & 0x80) == 0x80)	//Triplex rows are phase 1 and 2
+						{
+							temp_index_b = jindex;
+						}
+						else
+						{
+							NR_load_phase_index(bus[indexer].phases,jindex,&temp_index,&temp_index_b);
+						}
 
-					//Shunt values
-					undeltacurr[1] += bus[indexer].Y_dy[4]*bus[indexer].V[1];
+						scen_offset = (active_list[kindex]*bus_count+indexer)*3+temp_index_b;
 
-					//Current values
-					undeltacurr[1] += adjusted_constant_current[4];
+						V_delta = complex(column[2*bus[indexer].Matrix_Loc + jindex],column[2*bus[indexer].Matrix_Loc + row_size + jindex]);
 
-					//Add any three-phase/non-triplex house contributions, if they exist
-					if ((bus[indexer].phases & 0x40) == 0x40)
-					{
-						//Update phase adjustments - use the temp array (not really needed)
-						temp_store[1].SetPolar(1.0,bus[indexer].V[1].Arg());
+						if (V_delta.Mag() > bus[indexer].max_volt_error)
+						{
+							scenario_converged = false;
+						}
 
-						//Update these current contributions
-						undeltacurr[1] += bus[indexer].house_var[1]/(~temp_store[1]);		//Just denominator conjugated to keep math right (rest was conjugated in house)
-					}//End house-attached non-triplex
+						scenario_voltage[scen_offset] += V_delta;
+					}
 				}
-				else
+
+				if (scenario_converged == true)
 				{
-					//Zero it, just in case
-					undeltacurr[1] = complex(0.0,0.0);
+					if (scenario_iterations[active_list[kindex]] < (iteration+1))
+					{
+						scenario_iterations[active_list[kindex]] = iteration+1;
+					}
 				}
-
-				if ((bus[indexer].phases & 0x01) == 0x01)	//Has a phase C
+				else	//Still moving - step it again
 				{
-					undeltacurr[2]=(adjusted_constant_current[2]+delta_current[2])-(adjusted_constant_current[1]+delta_current[1]);
-
-					//Apply explicit wye-connected loads
-
-					//Power values
-					undeltacurr[2] += (bus[indexer].V[2] == 0) ? 0 : ~(bus[indexer].S_dy[5]/bus[indexer].V[2]);
+					active_list[next_count++] = active_list[kindex];
+				}
+			}
 
-					//Shunt values
-					undeltacurr[2] += bus[indexer].Y_dy[5]*bus[indexer].V[2];
+			active_count = next_count;
+		}
 
-					//Current values
-					undeltacurr[2] += adjusted_constant_current[5];
+		//Whatever is left didn't converge on this island
+		for (kindex=0; kindex<active_count; kindex++)
+		{
+			scenario_iterations[active_list[kindex]] = -NR_iteration_limit;
+		}
 
-					//Add any three-phase/non-triplex house contributions, if they exist
-					if ((bus[indexer].phases & 0x40) == 0x40)
-					{
-						//Update phase adjustments - use the temp array (not really needed)
-						temp_store[2].SetPolar(1.0,bus[indexer].V[2].Arg());
+		//Back to the base values for the next island
+		memcpy(scenario_bus,bus,bus_count*sizeof(BUSDATA));
+	}
 
-						//Update these current contributions
-						undeltacurr[2] += bus[indexer].house_var[2]/(~temp_store[2]);		//Just denominator conjugated to keep math right (rest was conjugated in house)
-					}//End house-attached non-triplex
-				}
-				else
-				{
-					//Zero it, just in case
-					undeltacurr[2] = complex(0.0,0.0);
-				}
+	gl_free(scenario_values.load_lane_data);
+	gl_free(scenario_bus);
+	gl_free(scenario_S);
+	gl_free(rhs_scenario);
+	gl_free(base_mismatch);
+	gl_free(active_list);
 
-				//Provide updates to relevant phases
-				//only compute and store phases that exist (make top heavy)
-				temp_index = -1;
-				temp_index_b = -1;
+	converged_count = 0;
+	for (kindex=0; kindex<scenario_count; kindex++)
+	{
+		if (scenario_iterations[kindex] >= 0)
+		{
+			converged_count++;
+		}
+	}
 
-				for ( jindex = 0 ; jindex < powerflow_values->BA_diag[indexer].size ; jindex++ )
-				{
-					switch(bus[indexer].phases & 0x07) {
-						case 0x01:	//C
-							{
-								temp_index=0;
-								temp_index_b=2;
-								break;
-							}
-						case 0x02:	//B
-							{
-								temp_index=0;
-								temp_index_b=1;
-								break;
-							}
-						case 0x03:	//BC
-							{
-								if (jindex==0)	//B
-								{
-									temp_index=0;
-									temp_index_b=1;
-								}
-								else			//C
-								{
-									temp_index=1;
-									temp_index_b=2;
-								}
-								break;
-							}
-						case 0x04:	//A
-							{
-								temp_index=0;
-								temp_index_b=0;
-								break;
-							}
-						case 0x05:	//AC
-							{
-								if (jindex==0)	//A
-								{
-									temp_index=0;
-									temp_index_b=0;
-								}
-								else			//C
-								{
-									temp_index=1;
-									temp_index_b=2;
-								}
-								break;
-							}
-						case 0x06:	//AB
-						case 0x07:	//ABC
-							{
-								temp_index=jindex;
-								temp_index_b=jindex;
-								break;
-							}
-						default:
-							break;
-					}//end case
+	return converged_count;
+}
 
-					if (jacobian_pass == false)	//Current injection update
-					{
-						if (((int)temp_index==-1) || ((int)temp_index_b==-1))
-						{
-							GL_THROW("NR: A scheduled power update element failed.");
-							//Defined below
-						}
+//Performs the load calculation portions of the current injection or Jacobian update
+//jacobian_pass should be set to true for the a,b,c, and d updates
+// For first approach, working on system load at each bus for current injection
+// For the second approach, calculate the elements of a,b,c,d in equations(14),(15),(16),(17).
+void compute_load_values(unsigned int bus_count, BUSDATA *bus, NR_SOLVER_STRUCT *powerflow_values, bool jacobian_pass, int island_number)
+{
+	unsigned int indexer, batch_index, batch_start, batch_end;
+	int batch_type;
+	STATUS temp_status;
 
-						//Real power calculations
-						tempPbus = (undeltacurr[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Re() + (undeltacurr[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Im();	// Real power portion of Constant current component multiply the magnitude of bus voltage
-						bus[indexer].PL[temp_index] += tempPbus;	//Real power portion - all is current based -- accumulate in case mixed and matched with old above
+	//Batches should be built for this solution already - but just in case
+	if ((powerflow_values->load_batch_valid == false) || (powerflow_values->load_batch_islands < NR_islands_detected))
+	{
+		NR_build_load_batches(bus_count,bus,powerflow_values);
+	}
 
-						//Reactive load calculations
-						tempQbus = (undeltacurr[temp_index_b]).Re() * (bus[indexer].V[temp_index_b]).Im() - (undeltacurr[temp_index_b]).Im() * (bus[indexer].V[temp_index_b]).Re();	// Reactive power portion of Constant current component multiply the magnitude of bus voltage
-						bus[indexer].QL[temp_index] += tempQbus;	//Reactive power portion - all is current based -- accumulate in case mixed and matched with old above
-					}
-					else	//Jacobian update
-					{
-						if (((int)temp_index==-1) || ((int)temp_index_b==-1))
-						{
-							GL_THROW("NR: A Jacobian update element failed.");
-							//Defined below
-						}
+	//Loop through the island's batches - delta, triplex, wye, then wye with "different" children - so each loop runs a single kernel
+	for (batch_type=0; batch_type<NR_LOAD_BATCH_TYPES; batch_type++)
+	{
+		batch_start = powerflow_values->load_batch_offset[NR_LOAD_BATCH_TYPES*island_number + batch_type];
+		batch_end = powerflow_values->load_batch_offset[NR_LOAD_BATCH_TYPES*island_number + batch_type + 1];
 
-						if ((bus[indexer].V[temp_index_b]).Mag()!=0)
-						{
-							//Apply as an accumulation, in case any "normal" connections are present too
-							bus[indexer].Jacob_A[temp_index] += ((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Re() + (undeltacurr[temp_index_b]).Im() *pow((bus[indexer].V[temp_index_b]).Im(),2))/pow((bus[indexer].V[temp_index_b]).Mag(),3); // + (undeltaimped[temp_index_b]).Im();// second part of equation(37) - no power term needed
-							bus[indexer].Jacob_B[temp_index] += -((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Im() + (undeltacurr[temp_index_b]).Re() *pow((bus[indexer].V[temp_index_b]).Re(),2))/pow((bus[indexer].V[temp_index_b]).Mag(),3); // - (undeltaimped[temp_index_b]).Re();// second part of equation(38) - no power term needed
-							bus[indexer].Jacob_C[temp_index] +=((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Im() - (undeltacurr[temp_index_b]).Re() *pow((bus[indexer].V[temp_index_b]).Im(),2))/pow((bus[indexer].V[temp_index_b]).Mag(),3); // - (undeltaimped[temp_index_b]).Re();// second part of equation(39) - no power term needed
-							bus[indexer].Jacob_D[temp_index] += ((bus[indexer].V[temp_index_b]).Re()*(bus[indexer].V[temp_index_b]).Im()*(undeltacurr[temp_index_b]).Re() - (undeltacurr[temp_index_b]).Im() *pow((bus[indexer].V[temp_index_b]).Re(),2))/pow((bus[indexer].V[temp_index_b]).Mag(),3); // - (undeltaimped[temp_index_b]).Im();// second part of equation(40) - no power term needed
-						}
-						else	//Zero voltage = only impedance is valid (others get divided by VMag, so are IND) - not entirely sure how this gets in here anyhow
-						{
-							bus[indexer].Jacob_A[temp_index] += -1e-4; //(undeltaimped[temp_index_b]).Im() - 1e-4;	//Small offset to avoid singularities (if impedance is zero too)
-							bus[indexer].Jacob_B[temp_index] += -1e-4; //-(undeltaimped[temp_index_b]).Re() - 1e-4;
-							bus[indexer].Jacob_C[temp_index] += -1e-4; //-(undeltaimped[temp_index_b]).Re() - 1e-4;
-							bus[indexer].Jacob_D[temp_index] += -1e-4; //-(undeltaimped[temp_index_b]).Im() - 1e-4;
-						}
-					}//End pass differentiation
-				}//End phase traversion
-			}//End delta/wye explicit loads
+		//Load update functions first, so the kernels see the present load values
+		for (batch_index=batch_start; batch_index<batch_end; batch_index++)
+		{
+			indexer = powerflow_values->load_batch_list[batch_index];
 
-			if (jacobian_pass == true)	//This part only gets done on the Jacobian update
+			//See if we have a load update function to call
+			if (bus[indexer].LoadUpdateFxn != NULL)
 			{
-				//Delta load components  get added to the Jacobian values too -- mostly because this is the most convenient place to do it
-				//See if we're even needed first
-				if (bus[indexer].full_Y_load != NULL)
-				{
-					//Provide updates to relevant phases
-					//only compute and store phases that exist (make top heavy)
-					temp_index = -1;
-					temp_index_b = -1;
-
-					for ( jindex = 0 ; jindex < powerflow_values->BA_diag[indexer].size ; jindex++ )
-					{
-						switch(bus[indexer].phases & 0x07) {
-							case 0x01:	//C
-								{
-									temp_index=0;
-									temp_index_b=2;
-									break;
-								}
-							case 0x02:	//B
-								{
-									temp_index=0;
-									temp_index_b=1;
-									break;
-								}
-							case 0x03:	//BC
-								{
-									if (jindex==0)	//B
-									{
-										temp_index=0;
-										temp_index_b=1;
-									}
-									else			//C
-									{
-										temp_index=1;
-										temp_index_b=2;
-									}
-									break;
-								}
-							case 0x04:	//A
-								{
-									temp_index=0;
-									temp_index_b=0;
-									break;
-								}
-							case 0x05:	//AC
-								{
-									if (jindex==0)	//A
-									{
-										temp_index=0;
-										temp_index_b=0;
-									}
-									else			//C
-									{
-										temp_index=1;
-										temp_index_b=2;
-									}
-									break;
-								}
-							case 0x06:	//AB
-							case 0x07:	//ABC
-								{
-									temp_index=jindex;
-									temp_index_b=jindex;
-									break;
-								}
-							default:
-								break;
-						}//end case
+				//Call the function
+				temp_status = ((STATUS (*)(OBJECT *))(*bus[indexer].LoadUpdateFxn))(bus[indexer].obj);
 
-						if (((int)temp_index==-1) || ((int)temp_index_b==-1))
-						{
-							GL_THROW("NR: A Jacobian update element failed.");
-							//Defined below
-						}
+				//Make sure it worked
+				if (temp_status == FAILED)
+				{
+					GL_THROW("NR: Load update failed for device %s",bus[indexer].obj->name ? bus[indexer].obj->name : "Unnamed");
+					/*  TROUBLESHOOT
+					While attempting to perform the load update function call, something failed.  Please try again.
+					If the error persists, please submit your code and a bug report via the ticketing system.
+					*/
+				}
+				//Default else - it worked
+			}
+		}
 
-						//Accumulate the values
-						bus[indexer].Jacob_A[temp_index] += bus[indexer].full_Y_load[temp_index_b].Im();
-						bus[indexer].Jacob_B[temp_index] += bus[indexer].full_Y_load[temp_index_b].Re();
-						bus[indexer].Jacob_C[temp_index] += bus[indexer].full_Y_load[temp_index_b].Re();
-						bus[indexer].Jacob_D[temp_index] -= bus[indexer].full_Y_load[temp_index_b].Im();
-					}//End phase traversion
-				}//End deltamode-enabled in-rush loads updates
-			}//End Jacobian pass for deltamode loads
-		}//End relevant island check
-	}//end bus traversion for Jacobian or current injection items
+		//Then the kernels, on the updated values
+		NR_load_batch_kernels(bus,powerflow_values,jacobian_pass,island_number,batch_type);
+	}//End batch type traversion
 }//End load update function
 
 //Function to free up array of NR_SOLVER_STRUCT variables
@@ -6387,6 +7792,8 @@ STATUS NR_array_structure_free(NR_SOLVER_STRUCT *struct_of_interest,int number_o
 				curr_island_superLU_vars = (SUPERLU_NR_vars*)struct_of_interest->island_matrix_values[index_val].LU_solver_vars;
 
 				//Free the others, if necessary
+				NR_chord_release(curr_island_superLU_vars);
+
 				if (curr_island_superLU_vars->A_LU.Store != NULL)
 					gl_free(curr_island_superLU_vars->A_LU.Store);
 				
@@ -50,6 +50,8 @@ typedef struct  {
 	OBJECT *ExtraCurrentInjFuncObject;	///< Link to the object that mapped the current injection function - needed for function calls
 	FUNCTIONADDR LoadUpdateFxn;			///< Link to load update function for load objects -- for impedance conversion (inrush or forced)
 	int island_number;		///< Numerical designation for which island this bus belongs to
+	bool admit_change;		///< Flag indicating the self-admittance of this bus needs a localized update
+	unsigned int diag_fixed_loc;	///< Starting index of this bus's entries in Y_diag_fixed - used for localized admittance updates
 } BUSDATA;
 
 typedef struct {
@@ -73,6 +75,9 @@ typedef struct {
 	FUNCTIONADDR limit_check;	////< Link to overload checking function (calculate_overlimit_link) -- restoration related
 	FUNCTIONADDR ExtraDeltaModeFunc;	///< Link to extra functions of deltamode -- notably, transformer saturation
 	int island_number;		///< Numerical designation for which island this branch belongs to
+	bool admit_change;		///< Flag indicating the admittance values (but not the topology) of this branch changed
+	unsigned int offdiag_loc;	///< Starting index of this branch's entries in Y_offdiag_PQ - used for localized admittance updates
+	unsigned long long offdiag_pattern;	///< Non-zero pattern of Yfrom/Yto when Y_offdiag_PQ was last built - localized updates require it unchanged
 } BRANCHDATA;
 
 typedef struct Y_NR{
@@ -148,9 +153,46 @@ typedef struct {
 	double max_mismatch_converge;		///Current difference for convergence checks
 } NR_MATRIX_CONSTRUCTION;
 
+//Connection-type batches per island used by compute_load_values - delta, triplex, wye, wye with "different" children
+#define NR_LOAD_BATCH_TYPES 4
+
+//Values gathered per wye lane/triplex bus into NR_SOLVER_STRUCT's load_lane_data
+#define NR_LOAD_LANE_FIELDS 42
+
+//Solve history entry - one per static solution, kept in NR_SOLVER_STRUCT's ring buffer
+typedef struct {
+	TIMESTAMP solve_time;				///Timestamp of the solution
+	int64 iterations;					///Iterations the solution took
+	bool converged;						///Flag to indicate if the solution converged
+	unsigned int predicted_buses;		///Number of buses the voltage predictor started from an extrapolated voltage
+	double predictor_error;				///Largest difference between a predicted and converged voltage (per-unit)
+} NR_SOLVE_RECORD;
+
 typedef struct {
 	NR_MATRIX_CONSTRUCTION *island_matrix_values;	///Structure pointer to the individual matrix element "population" portions
 	Bus_admit *BA_diag;					/// BA_diag store the diagonal elements of the bus admittance matrix, the off_diag elements of bus admittance matrix are equal to negative value of branch admittance
+	complex *V_history;					/// Converged voltages of the last two static solutions (2 x bus_count x 3) - used by the voltage predictor
+	TIMESTAMP V_history_time[2];		/// Timestamps of the V_history solutions (0 = not populated)
+	unsigned int V_history_buses;		/// Bus count V_history is allocated for
+	complex *V_predicted;				/// Starting voltages set by the voltage predictor for this solution (bus_count x 3)
+	unsigned int *V_predicted_bus;		/// Buses V_predicted applies to
+	unsigned int V_predicted_count;		/// Number of buses in V_predicted_bus
+	NR_SOLVE_RECORD *solve_history;		/// Ring buffer of the last NR_solve_history_size static solutions
+	unsigned int solve_history_size;	/// Allocated size of solve_history
+	unsigned int solve_history_next;	/// Slot in solve_history the next solution is written to
+	unsigned int solve_history_count;	/// Number of valid entries in solve_history
+	unsigned int *load_batch_list;		/// Bus indices grouped by island, then connection type (delta, triplex, wye, wye with "different" children) - used by compute_load_values
+	unsigned int *load_batch_offset;	/// Start of each island/connection-type batch in load_batch_list (NR_LOAD_BATCH_TYPES per island, plus the end)
+	unsigned int load_batch_buses;		/// Allocated size of load_batch_list
+	int load_batch_islands;				/// Island count load_batch_offset is allocated for
+	bool load_batch_valid;				/// Batches match the current islands - cleared by admittance/topology changes (NR_admit_change)
+	unsigned int *load_lane_bus;		/// Bus of each wye load lane (one per phase of the wye batches, in batch order)
+	unsigned char *load_lane_slot;		/// PL/QL/Jacobian entry each wye lane writes
+	unsigned char *load_lane_phase;		/// Voltage/load phase each wye lane reads
+	unsigned int *load_lane_offset;		/// Start of each island's wye lanes in load_lane_bus (one per island, plus the end)
+	unsigned int load_lane_count;		/// Allocated size of the load_lane_bus/slot/phase arrays
+	double *load_lane_data;				/// Structure-of-arrays scratch for the wye lanes and triplex buses - NR_LOAD_LANE_FIELDS arrays of load_lane_stride values
+	unsigned int load_lane_stride;		/// Length of each load_lane_data array
 } NR_SOLVER_STRUCT;
 
 //Mesh-fault-related structure - passing information
@@ -168,6 +210,8 @@ typedef struct {
 
 int64 solver_nr(unsigned int bus_count, BUSDATA *bus, unsigned int branch_count, BRANCHDATA *branch, NR_SOLVER_STRUCT *powerflow_values, NRSOLVERMODE powerflow_type , NR_MESHFAULT_IMPEDANCE *mesh_imped_vals, bool *bad_computations);
 void compute_load_values(unsigned int bus_count, BUSDATA *bus, NR_SOLVER_STRUCT *powerflow_values, bool jacobian_pass, int island_number);
+int solver_nr_scenarios(unsigned int bus_count, BUSDATA *bus, BRANCHDATA *branch, NR_SOLVER_STRUCT *powerflow_values, unsigned int scenario_count, complex *scenario_power, complex *scenario_voltage, int64 *scenario_iterations);
+void NR_solve_history_dump(NR_SOLVER_STRUCT *powerflow_values, char *filename);
 
 //Newton-Raphson solver array handlers
 extern bool solver_dump_enable;
@@ -758,156 +758,206 @@ static struct s_map
 static int *bus_index = NULL;
 static int *branch_index = NULL;
 
-void sync_property(PyObject *data, size_t n, void *ptr, void (*convert)(void*,void*,bool), bool inverse)
+// Create a column of the model data
+//
+// Text columns are lists of str, all other columns are persistent numpy
+// arrays that are updated in place on each sync
+static PyObject *new_column(size_t count, char *source, struct s_map *map)
 {
-	PyObject *pValue = PyList_GetItem(data,n);
-	if ( inverse )
+	if ( map->convert == char_to_str )
 	{
-		if ( pValue && PyFloat_Check(pValue) )
+		PyObject *column = PyList_New(count);
+		char *ptr = source + map->offset;
+		for ( size_t n = 0 ; n < count ; n++, ptr += map->size )
 		{
-			double x = PyFloat_AsDouble(pValue);
-			if ( convert )
+			const char *name = *(const char**)ptr;
+			if ( name )
 			{
-				convert(&x,ptr,true);
+				PyList_SetItem(column,n,PyUnicode_FromString(name));
 			}
 			else
 			{
-				*(double*)ptr = x;
+				PyList_SetItem(column,n,Py_None);
+				Py_INCREF(Py_None);
 			}
 		}
+		return column;
 	}
-	else
+	npy_intp dims[] = {(npy_intp)count};
+	return PyArray_ZEROS(1,dims,NPY_DOUBLE,0);
+}
+
+// Copy the solver data into a column
+static void gather_column(PyObject *column, size_t count, char *source, struct s_map *map)
+{
+	double *x = (double*)PyArray_DATA((PyArrayObject*)column);
+	char *ptr = source + map->offset;
+	if ( ! map->is_ref )
 	{
-		if ( convert == char_to_str )
+		if ( map->convert == NULL )
 		{
-			if ( pValue == NULL )
-			{
-				if ( ptr )
-				{
-					const char *x = NULL;
-					convert(&x,ptr,false);
-					PyObject *pUnicode = PyUnicode_FromFormat("%s",*(const char**)ptr);
-					Py_INCREF(pUnicode);
-					PyList_SetItem(data,n,pUnicode);
-				}
-				else
-				{
-					PyList_SetItem(data,n,Py_None);
-					Py_INCREF(Py_None);
-				}
-			}
-			else
+			for ( size_t n = 0 ; n < count ; n++, ptr += map->size )
 			{
-				// no replacement allowed
+				x[n] = *(double*)ptr;
 			}
 		}
 		else
 		{
-			double x = convert ? (convert(&x,ptr,false),x) : *(double*)ptr;
-			if ( pValue == NULL || ! PyFloat_Check(pValue) || PyFloat_AsDouble(pValue) != x )
+			for ( size_t n = 0 ; n < count ; n++, ptr += map->size )
 			{
-				PyList_SetItem(data,n,PyFloat_FromDouble(x));
+				map->convert(x+n,ptr,false);
 			}
 		}
 	}
-}
-
-void sync_property_ref(PyObject *data, size_t n, void *ptr, int64 offset, bool inverse)
-{
-	double **ppx = (double**)ptr;
-	if ( ppx == NULL )
-		return;
-	double *px = (double*)(((char*)(*ppx))+offset);
-	if ( px == NULL )
-		return;
-	double &x = *px;
-	PyObject *pValue = PyList_GetItem(data,n);
-	if ( inverse )
-	{
-		if ( pValue && PyFloat_Check(pValue) )
-		{
-			x = PyFloat_AsDouble(pValue);
-		}
-	}
 	else
 	{
-		if ( pValue == NULL || ! PyFloat_Check(pValue) || PyFloat_AsDouble(pValue) != x )
+		for ( size_t n = 0 ; n < count ; n++, ptr += map->size )
 		{
-			PyObject *pDouble = PyFloat_FromDouble(x);
-			PyList_SetItem(data,n,pDouble);
+			char *ref = *(char**)ptr;
+			if ( ref == NULL )
+			{
+				x[n] = QNAN;
+			}
+			else if ( map->convert )
+			{
+				map->convert(x+n,ref+map->ref_offset,false);
+			}
+			else
+			{
+				x[n] = *(double*)(ref+map->ref_offset);
+			}
 		}
 	}
 }
 
-void sync_complex_ref(PyObject *data, size_t n, void *ptr, void (*convert)(double*,void*,bool), int64 offset, bool inverse)
+// Copy a column into the solver data (NaN values are not copied)
+static void scatter_column(PyObject *column, size_t count, char *source, struct s_map *map)
 {
-	complex **ppz = (complex**)ptr;
-	if ( ppz == NULL )
-		return;
-	complex *pz = (complex*)(((char*)(*ppz))+offset);
-	if ( pz == NULL )
-		return;
-	PyObject *pValue = PyList_GetItem(data,n);
-	if ( inverse )
+	PyArrayObject *array = (PyArrayObject*)PyArray_FROM_OTF(column,NPY_DOUBLE,NPY_ARRAY_IN_ARRAY);
+	if ( array == NULL )
 	{
-		if ( pValue && PyFloat_Check(pValue) )
-		{
-			double x = PyFloat_AsDouble(pValue);
-			convert(&x,pz,true);
-		}
-	}
-	else
-	{
-		double x;
-		convert(&x,pz,false);
-		if ( pValue == NULL || ! PyFloat_Check(pValue) || PyFloat_AsDouble(pValue) != x )
-		{
-			PyObject *pDouble = PyFloat_FromDouble(x);
-			PyList_SetItem(data,n,pDouble);
-		}
+		PyErr_Clear();
+		return;
 	}
-}
-
-void sync_none(PyObject *data, size_t n, bool inverse)
-{
-	if ( ! inverse )
+	if ( (size_t)PyArray_SIZE(array) >= count )
 	{
-		PyObject *pValue = PyList_GetItem(data,n);
-		if ( pValue != Py_None )
+		double *x = (double*)PyArray_DATA(array);
+		char *ptr = source + map->offset;
+		for ( size_t n = 0 ; n < count ; n++, ptr += map->size )
 		{
-			PyList_SetItem(data,n,Py_None);
-			Py_INCREF(Py_None);
+			if ( isnan(x[n]) )
+			{
+				continue;
+			}
+			void *target = ptr;
+			if ( map->is_ref )
+			{
+				char *ref = *(char**)ptr;
+				if ( ref == NULL )
+				{
+					continue;
+				}
+				target = ref + map->ref_offset;
+			}
+			if ( map->convert )
+			{
+				map->convert(x+n,target,true);
+			}
+			else
+			{
+				*(double*)target = x[n];
+			}
 		}
 	}
+	Py_DECREF(array);
 }
 
-void sync_data(PyObject *data, size_t n, void *source, struct s_map *map, e_dir dir)
+// Synchronize the solver data with the model data columns
+static void sync_mapped(
+	PyObject *pModel,
+	const char *key,
+	size_t ntags,
+	const char **tags,
+	int *&index,
+	size_t &data_count,
+	struct s_map *map,
+	size_t nmap,
+	size_t count,
+	void *data,
+	e_dir dir)
 {
-	if ( dir & map->dir )
-	{
-		if ( map->offset >= 0 && map->offset < map->size )
+	char *source = (char*)data;
+	PyObject *pData = PyDict_GetItemString(pModel,key);
+	if ( pData == NULL || data_count != count )
+	{
+		pData = PyList_New(ntags);
+		PyDict_SetItemString(pModel,key,pData);
+		Py_DECREF(pData);
+		if ( index == NULL )
 		{
-			void *ptr = (void*)((char*)source + map->offset);
-			if ( ptr == NULL )
-			{
-				return;
-			}
-			if ( ! map->is_ref )
+			index = new int[ntags];
+			for ( size_t t = 0 ; t < ntags ; t++ )
 			{
-				sync_property(data,n,ptr,map->convert,(dir&ED_IN));
+				index[t] = -1;
+				for ( size_t m = 0 ; m < nmap ; m++ )
+				{
+					if ( strcmp(tags[t],map[m].tag) == 0 )
+					{
+						index[t] = m;
+						break;
+					}
+				}
+				if ( index[t] < 0 )
+				{
+					gl_error("%s: %s tag '%s' not found", (const char*)solver_py_config, key, tags[t]);
+				}
 			}
-			else if ( *(double**)ptr != NULL ) // pointers are never converted but have an offset
+		}
+		for ( size_t t = 0 ; t < ntags ; t++ )
+		{
+			int m = index[t];
+			if ( m >= 0 && map[m].offset >= 0 && map[m].offset < map[m].size )
 			{
-				sync_property_ref(data,n,ptr,map->ref_offset,(dir&ED_IN));
+				PyObject *column = new_column(count,source,&map[m]);
+				if ( map[m].convert != char_to_str )
+				{
+					gather_column(column,count,source,&map[m]);
+				}
+				PyList_SetItem(pData,t,column);
 			}
-			else // everything else if NULL
+			else
 			{
-				sync_none(data,n,(dir&ED_IN));
+				PyList_SetItem(pData,t,Py_None);
+				Py_INCREF(Py_None);
 			}
 		}
+		data_count = count;
+	}
+	for ( size_t t = 0 ; t < ntags ; t++ )
+	{
+		int m = index[t];
+		if ( m < 0 || ( dir & map[m].dir ) == 0 || map[m].convert == char_to_str )
+		{
+			continue;
+		}
+		PyObject *column = PyList_GetItem(pData,t);
+		if ( column == NULL || column == Py_None )
+		{
+			continue;
+		}
+		if ( dir & ED_IN )
+		{
+			scatter_column(column,count,source,&map[m]);
+		}
 		else
 		{
-			sync_none(data,n,(dir&ED_IN));
+			if ( ! PyArray_Check(column) || (size_t)PyArray_SIZE((PyArrayObject*)column) != count )
+			{
+				// the python solver replaced the column
+				column = new_column(count,source,&map[m]);
+				PyList_SetItem(pData,t,column);
+			}
+			gather_column(column,count,source,&map[m]);
 		}
 	}
 }
@@ -991,62 +1041,9 @@ void sync_busdata_raw(PyObject *pModel,unsigned int &bus_count,BUSDATA *&bus,e_d
 
 void sync_busdata_mapped(PyObject *pModel,unsigned int &bus_count,BUSDATA *&bus,e_dir dir)
 {
-	PyObject *busdata = PyDict_GetItemString(pModel,"busdata");
-	if ( busdata == NULL )
-	{
-		busdata = PyList_New(python_nbustags);
-		PyDict_SetItemString(pModel,"busdata",busdata);
-		bus_index = new int[python_nbustags];
-		memset(bus_index,-1,python_nbustags*sizeof(int));
-		for ( size_t m = 0 ; m < sizeof(busmap)/sizeof(busmap[0]) ; m++ )
-		{
-			int t = strfind(python_nbustags,python_bustags,busmap[m].tag);
-			PyObject *data = PyList_New(bus_count);
-			PyList_SetItem(busdata,t,data);
-			if ( t >= 0 )
-			{
-				bus_index[t] = m;
-				for ( size_t n = 0 ; n < bus_count ; n++ )
-				{
-					sync_data(data,n,(void*)&bus[n],&busmap[m],ED_INIT);
-				}
-			}
-		}
-		for ( size_t t = 0 ; t < python_nbustags ; t++ )
-		{
-			PyObject *data = PyList_GetItem(busdata,t);
-			if ( data == NULL )
-			{
-				PyList_SetItem(busdata,t,Py_None);
-				Py_INCREF(Py_None);
-			}
-		}
-	}
-	for ( size_t t = 0 ; t < python_nbustags ; t++ )
-	{
-		int m = bus_index[t];
-		PyObject *data = PyList_GetItem(busdata,t);
-		if ( m >= 0 )
-		{
-			for ( size_t n = 0 ; n < bus_count ; n++ )
-			{
-				sync_data(data,n,(void*)&bus[n],&busmap[m],dir);
-			}
-		}
-		else if ( m == -1 )
-		{
-			if ( dir & (ED_INIT|ED_OUT) )
-			{
-				for ( size_t n = 0 ; n < bus_count ; n++ )
-				{
-					PyList_SetItem(data,n,Py_None);
-					Py_INCREF(Py_None);
-				}
-			}
-			bus_index[t] = -2;
-			gl_error("%s: bus tag '%s' not found", (const char*)solver_py_config, python_bustags[t]);
-		}
-	}
+	static size_t data_count = 0;
+	sync_mapped(pModel,"busdata",python_nbustags,python_bustags,bus_index,data_count,
+		busmap,sizeof(busmap)/sizeof(busmap[0]),bus_count,bus,dir);
 }
 
 void sync_branchdata_raw(PyObject *pModel,unsigned int &branch_count,BRANCHDATA *&branch,e_dir dir)
@@ -1064,63 +1061,9 @@ void sync_branchdata_raw(PyObject *pModel,unsigned int &branch_count,BRANCHDATA
 
 void sync_branchdata_mapped(PyObject *pModel,unsigned int &branch_count,BRANCHDATA *&branch,e_dir dir)
 {
-	PyObject *branchdata = PyDict_GetItemString(pModel,"branchdata");
-	if ( branchdata == NULL )
-	{
-		branchdata = PyList_New(python_nbranchtags);
-		PyDict_SetItemString(pModel,"branchdata",branchdata);
-		Py_INCREF(branchdata);
-		branch_index = new int[python_nbranchtags];
-		memset(branch_index,-1,python_nbranchtags*sizeof(int));
-		for ( size_t m = 0 ; m < sizeof(branchmap)/sizeof(branchmap[0]) ; m++ )
-		{
-			int t = strfind(python_nbranchtags,python_branchtags,branchmap[m].tag);
-			if ( t >= 0 )
-			{
-				PyObject *data = PyList_New(branch_count);
-				PyList_SetItem(branchdata,t,data);
-				branch_index[t] = m;
-				for ( size_t n = 0 ; n < branch_count ; n++ )
-				{
-					sync_data(data,n,(void*)&branch[n],&branchmap[m],ED_INIT);
-				}
-			}
-		}
-		for ( size_t t = 0 ; t < python_nbranchtags ; t++ )
-		{
-			PyObject *data = PyList_GetItem(branchdata,t);
-			if ( data == NULL )
-			{
-				PyList_SetItem(branchdata,t,Py_None);
-				Py_INCREF(Py_None);
-			}
-		}
-	}
-	for ( size_t t = 0 ; t < python_nbranchtags ; t++ )
-	{
-		int m = branch_index[t];
-		PyObject *data = PyList_GetItem(branchdata,t);
-		if ( m >= 0 )
-		{
-			for ( size_t n = 0 ; n < branch_count ; n++ )
-			{
-				sync_data(data,n,(void*)&branch[n],&branchmap[m],dir);
-			}
-		}
-		else if ( m == -1 )
-		{
-			if ( dir & (ED_INIT|ED_OUT) )
-			{
-				for ( size_t n = 0 ; n < branch_count ; n++ )
-				{
-					PyList_SetItem(data,n,Py_None);
-					Py_INCREF(Py_None);
-				}
-			}
-			branch_index[t] = -2;
-			gl_error("%s: branch tag '%s' not found", (const char*)solver_py_config, python_branchtags[t]);
-		}
-	}
+	static size_t data_count = 0;
+	sync_mapped(pModel,"branchdata",python_nbranchtags,python_branchtags,branch_index,data_count,
+		branchmap,sizeof(branchmap)/sizeof(branchmap[0]),branch_count,branch,dir);
 }
 
 static PyObject *sync_model(
@@ -1192,7 +1135,8 @@ int solver_python_solve (
 		sync_model(bus_count,bus,branch_count,branch,ED_OUT);
 		PyObject *pResult = NULL;
         extern bool NR_admit_change;
-        PyDict_SetItemString(pModel,"topology_hashcode",PyLong_FromLong(get_linkhash(branch_count,branch,NR_admit_change)));
+        extern bool NR_admit_branch_change;
+        PyDict_SetItemString(pModel,"topology_hashcode",PyLong_FromLong(get_linkhash(branch_count,branch,NR_admit_change||NR_admit_branch_change)));
 		if ( ! python_call(pModule,(void*)&pResult,"solve","O",pModel) )
 		{
 			solver_python_log(1,"solver_python_solve(bus_count=%d,...): solver failed",bus_count);
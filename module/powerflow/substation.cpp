@@ -389,7 +389,7 @@ TIMESTAMP substation::sync(TIMESTAMP t0, TIMESTAMP t1)
 		}
 	}
 
-	if((solver_method == SM_NR && NR_admit_change == false) || solver_method == SM_FBS){
+	if((solver_method == SM_NR && NR_admit_change == false && NR_admit_branch_change == false) || solver_method == SM_FBS){
 		distribution_power_A = voltageA * (~current_inj[0]);
 		distribution_power_B = voltageB * (~current_inj[1]);
 		distribution_power_C = voltageC * (~current_inj[2]);
@@ -462,7 +462,7 @@ SIMULATIONMODE substation::inter_deltaupdate_substation(unsigned int64 delta_tim
 		//Perform postsync-like updates on the values
 		BOTH_node_postsync_fxn(obj);
 
-		if((solver_method == SM_NR && NR_admit_change == false) || solver_method == SM_FBS){
+		if((solver_method == SM_NR && NR_admit_change == false && NR_admit_branch_change == false) || solver_method == SM_FBS){
 			distribution_power_A = voltageA * (~current_inj[0]);
 			distribution_power_B = voltageB * (~current_inj[1]);
 			distribution_power_C = voltageC * (~current_inj[2]);
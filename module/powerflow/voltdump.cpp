@@ -54,6 +54,11 @@ voltdump::voltdump(MODULE *mod)
 			PT_int32, "version", PADDR(version),
 				PT_DEFAULT, "0",
 				PT_DESCRIPTION, "dump format version",
+			PT_enumeration, "format", PADDR(format),
+				PT_DEFAULT, "csv",
+				PT_DESCRIPTION, "output file format",
+				PT_KEYWORD, "csv", (enumeration)VDF_CSV,
+				PT_KEYWORD, "binary", (enumeration)VDF_BINARY,
 			PT_double, "interval[s]", PADDR(interval),
 				PT_DEFAULT, "0 s",
 				PT_DESCRIPTION, "interval at which voltdump runs",
@@ -66,11 +71,17 @@ voltdump::voltdump(MODULE *mod)
 int voltdump::create(void)
 {
 	group.erase();
+	node_list = NULL;
+	node_count = 0;
+	outfile = NULL;
 	return 1;
 }
 
 int voltdump::init(OBJECT *parent)
 {
+	FINDLIST *nodes = NULL;
+	OBJECT *obj = NULL;
+
 	unlink(filename);
 	if ( interval < 0 )
 	{
@@ -108,6 +119,34 @@ int voltdump::init(OBJECT *parent)
 	{
 		version = 2;
 	}
+
+	// resolve the node list once - the model's nodes don't change after load
+	if ( group[0] == 0 )
+	{
+		nodes = gl_find_objects(FL_NEW,FT_MODULE,SAME,"powerflow",FT_END);
+	}
+	else
+	{
+		nodes = gl_find_objects(FL_NEW,FT_MODULE,SAME,"powerflow",AND,FT_GROUPID,SAME,group.get_string(),FT_END);
+	}
+	if ( nodes != NULL )
+	{
+		node_list = (OBJECT**)gl_malloc((nodes->hit_count+1)*sizeof(OBJECT*));
+		if ( node_list == NULL )
+		{
+			gl_error("voltdump unable to allocate the node list");
+			gl_free(nodes);
+			return 0;
+		}
+		while ( (obj=gl_find_next(nodes,obj)) != NULL )
+		{
+			if ( gl_object_isa(obj, "node", "powerflow") )
+			{
+				node_list[node_count++] = obj;
+			}
+		}
+		gl_free(nodes);
+	}
 	return 1;
 }
 
@@ -119,64 +158,67 @@ int voltdump::isa(CLASSNAME classname)
 void voltdump::dump(TIMESTAMP t)
 {
 	char timestr[64];
-	FINDLIST *nodes = NULL;
 	OBJECT *obj = NULL;
-	FILE *outfile = NULL;
 	node *pnode;
+	int n;
 
-	if ( group[0] == 0 )
-	{
-		nodes = gl_find_objects(FL_NEW,FT_MODULE,SAME,"powerflow",FT_END);
-	} 
-	else 
-	{
-		nodes = gl_find_objects(FL_NEW,FT_MODULE,SAME,"powerflow",AND,FT_GROUPID,SAME,group.get_string(),FT_END);
-	}
-
-	if ( nodes == NULL )
+	if ( node_list == NULL )
 	{
 		warning("no nodes were found to dump");
 		return;
 	}
 
-	if (strcmp(filemode,"a")==0)
-	{
-		verbose("voltdump is appending data to %s",filename.get_string());
-	}
-	outfile = fopen(filename, filemode);
-	if ( outfile == NULL ) 
+	if ( ! open_file() )
 	{
-		gl_error("voltdump unable to open %s for output", filename.get_string());
 		return;
 	}
 
-	int node_count = 0;
-	while ( (obj=gl_find_next(nodes,obj)) )
+	gl_printtime(t, timestr, 64);
+	if ( format == VDF_BINARY )
 	{
-		if ( gl_object_isa(obj, "node", "powerflow") )
+		/* binary record: timestamp, count, then 6 doubles per node */
+		int64 timestamp = (int64)t;
+		int32 count = node_count;
+		double values[6];
+		fwrite(&timestamp,sizeof(timestamp),1,outfile);
+		fwrite(&count,sizeof(count),1,outfile);
+		for ( n = 0 ; n < node_count ; n++ )
 		{
-			node_count += 1;
+			pnode = OBJECTDATA(node_list[n],node);
+			for ( int k = 0 ; k < 3 ; k++ )
+			{
+				if ( mode == VDM_POLAR )
+				{
+					values[2*k] = pnode->voltage[k].Mag();
+					values[2*k+1] = pnode->voltage[k].Arg();
+				}
+				else
+				{
+					values[2*k] = pnode->voltage[k].Re();
+					values[2*k+1] = pnode->voltage[k].Im();
+				}
+			}
+			fwrite(values,sizeof(double),6,outfile);
 		}
 	}
-	/* print column names */
-	gl_printtime(t, timestr, 64);
-	if ( version < 2 )
-	{
-		fprintf(outfile,"# %s run at %s on %i nodes\nnode_name,", filename.get_string(), timestr, node_count);
-	}
 	else
 	{
-		fprintf(outfile,"node_name,datetime,");
-	}
-	if (mode == VDM_RECT)
-		fprintf(outfile,"voltA_real,voltA_imag,voltB_real,voltB_imag,voltC_real,voltC_imag\n");
-	else if (mode == VDM_POLAR)
-		fprintf(outfile,"voltA_mag,voltA_angle,voltB_mag,voltB_angle,voltC_mag,voltC_angle\n");
-	obj = 0;
-	while ( (obj=gl_find_next(nodes,obj)) )
-	{
-		if ( gl_object_isa(obj, "node", "powerflow") )
+		/* print column names */
+		if ( version < 2 )
+		{
+			fprintf(outfile,"# %s run at %s on %i nodes\nnode_name,", filename.get_string(), timestr, node_count);
+		}
+		else
+		{
+			fprintf(outfile,"node_name,datetime,");
+		}
+		if (mode == VDM_RECT)
+			fprintf(outfile,"voltA_real,voltA_imag,voltB_real,voltB_imag,voltC_real,voltC_imag\n");
+		else if (mode == VDM_POLAR)
+			fprintf(outfile,"voltA_mag,voltA_angle,voltB_mag,voltB_angle,voltC_mag,voltC_angle\n");
+		for ( n = 0 ; n < node_count ; n++ )
 		{
+			obj = node_list[n];
 			pnode = OBJECTDATA(obj,node);
 			if ( obj->name == NULL ) 
 			{
@@ -200,7 +242,72 @@ void voltdump::dump(TIMESTAMP t)
 			}
 		}
 	}
-	fclose(outfile);
+
+	/* append mode keeps the file open for the next dump */
+	if ( strcmp(filemode,"a") == 0 )
+	{
+		fflush(outfile);
+	}
+	else
+	{
+		fclose(outfile);
+		outfile = NULL;
+	}
+}
+
+bool voltdump::open_file(void)
+{
+	if ( outfile != NULL )
+	{
+		return true;
+	}
+	if ( strcmp(filemode,"a") == 0 )
+	{
+		verbose("voltdump is appending data to %s",filename.get_string());
+	}
+	outfile = fopen(filename, filemode);
+	if ( outfile == NULL )
+	{
+		gl_error("voltdump unable to open %s for output", filename.get_string());
+		return false;
+	}
+	if ( format == VDF_BINARY )
+	{
+		write_binary_header();
+	}
+	return true;
+}
+
+void voltdump::write_binary_header(void)
+{
+	/* binary header: magic, format version, mode, count, then the null-terminated node names */
+	char name[1024];
+	int32 header[3] = {1, (int32)mode, node_count};
+	fwrite("VOLTDUMP",1,8,outfile);
+	fwrite(header,sizeof(int32),3,outfile);
+	for ( int n = 0 ; n < node_count ; n++ )
+	{
+		OBJECT *obj = node_list[n];
+		if ( obj->name == NULL )
+		{
+			snprintf(name,sizeof(name),"%s:%i", obj->oclass->name, obj->id);
+		}
+		else
+		{
+			snprintf(name,sizeof(name),"%s", obj->name);
+		}
+		fwrite(name,1,strlen(name)+1,outfile);
+	}
+}
+
+int voltdump::finalize(void)
+{
+	if ( outfile != NULL )
+	{
+		fclose(outfile);
+		outfile = NULL;
+	}
+	return 1;
 }
 
 TIMESTAMP voltdump::commit(TIMESTAMP t)
@@ -288,6 +395,15 @@ EXPORT TIMESTAMP commit_voltdump(OBJECT *obj, TIMESTAMP t1, TIMESTAMP t2){
 	I_CATCHALL(commit,voltdump);
 }
 
+EXPORT int finalize_voltdump(OBJECT *obj)
+{
+	try {
+		voltdump *my = OBJECTDATA(obj,voltdump);
+		return my->finalize();
+	}
+	I_CATCHALL(finalize,voltdump);
+}
+
 EXPORT int isa_voltdump(OBJECT *obj, CLASSNAME classname)
 {
 	return OBJECTDATA(obj,voltdump)->isa(classname);
@@ -13,6 +13,11 @@ typedef enum {
 	VDM_POLAR
 } VDMODE;
 
+typedef enum {
+	VDF_CSV,
+	VDF_BINARY
+} VDFORMAT;
+
 class voltdump : public gld_object
 {
 public:
@@ -25,6 +30,13 @@ public:
 	char8 filemode;
 	double interval;
 	int32 version;
+	enumeration format;		///< output file format (csv or binary)
+private:
+	OBJECT **node_list;		///< nodes to dump, resolved at init
+	int node_count;
+	FILE *outfile;			///< output file, kept open between dumps in append mode
+	bool open_file(void);
+	void write_binary_header(void);
 public:
 	static CLASS *oclass;
 public:
@@ -34,6 +46,8 @@ public:
 	TIMESTAMP commit(TIMESTAMP t);
 	int isa(CLASSNAME classname);
 
+	int finalize(void);
+
 	void dump(TIMESTAMP t);
 };
 
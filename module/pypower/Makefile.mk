@@ -3,13 +3,17 @@
 
 pkglib_LTLIBRARIES += module/pypower/pypower.la
 
-module_pypower_pypower_la_CPPFLAGS =
+module_pypower_pypower_la_CPPFLAGS = -I$(shell $(bindir)/python3 -c 'import numpy; print(numpy.get_include())')
+module_pypower_pypower_la_CPPFLAGS += -I$(top_srcdir)/third_party/superLU_MT
 module_pypower_pypower_la_CPPFLAGS += $(AM_CPPFLAGS)
 
 module_pypower_pypower_la_LDFLAGS =
 module_pypower_pypower_la_LDFLAGS += $(AM_LDFLAGS)
 
 module_pypower_pypower_la_LIBADD = 
+module_pypower_pypower_la_LIBADD += third_party/superLU_MT/libsuperlu.la
+module_pypower_pypower_la_LIBADD += $(PTHREAD_CFLAGS)
+module_pypower_pypower_la_LIBADD += $(PTHREAD_LIBS)
 
 module_pypower_pypower_la_SOURCES =
 module_pypower_pypower_la_SOURCES += module/pypower/pypower.cpp module/pypower/pypower.h
@@ -25,6 +29,7 @@ module_pypower_pypower_la_SOURCES += module/pypower/powerplant.cpp module/pypowe
 module_pypower_pypower_la_SOURCES += module/pypower/relay.cpp module/pypower/relay.h
 module_pypower_pypower_la_SOURCES += module/pypower/scada.cpp module/pypower/scada.h
 module_pypower_pypower_la_SOURCES += module/pypower/shunt.cpp module/pypower/shunt.h
+module_pypower_pypower_la_SOURCES += module/pypower/solver_nr.cpp module/pypower/solver_nr.h
 module_pypower_pypower_la_SOURCES += module/pypower/transformer.cpp module/pypower/transformer.h
 module_pypower_pypower_la_SOURCES += module/pypower/weather.cpp module/pypower/weather.h
 
@@ -0,0 +1,47 @@
+"""Compare the native and python pypower solvers
+
+Syntax: python3 benchmark.py [CASE ...]
+
+Each case is run once with each solver engine and the total solver time
+reported by the pypower module is compared.
+"""
+import sys, os, json, subprocess
+
+cases = sys.argv[1:] if len(sys.argv) > 1 else ["9","14","30","39","57","118"]
+engines = ["PYTHON","NATIVE"]
+DIR = os.path.dirname(os.path.abspath(__file__))
+
+def run(case,engine):
+    name = f"benchmark_case{case}_{engine.lower()}"
+    with open(f"{name}.glm","w") as fh:
+        print(f"""clock
+{{
+    timezone "PST+8PDT";
+    starttime "2020-01-01 00:00:00 PST";
+    stoptime "2020-01-02 00:00:00 PST";
+}}
+#input "{DIR}/case{case}.py" -t pypower
+module pypower
+{{
+    solver_engine {engine};
+    maximum_timestep 3600;
+}}
+#set savefile={name}.json
+""",file=fh)
+    result = subprocess.run(["gridlabd",f"{name}.glm"],capture_output=True,text=True)
+    if result.returncode != 0:
+        print(result.stderr,file=sys.stderr)
+        return None
+    with open(f"{name}.json","r") as fh:
+        model = json.load(fh)
+    return float(model["globals"]["pypower::solver_time"]["value"].split()[0])
+
+print("Case    Python(s) Native(s) Speedup")
+print("------- --------- --------- -------")
+for case in cases:
+    times = [run(case,engine) for engine in engines]
+    if None in times:
+        print(f"{case:7s} failed")
+    else:
+        speedup = times[0]/times[1] if times[1] > 0 else float('inf')
+        print(f"{case:7s} {times[0]:9.4f} {times[1]:9.4f} {speedup:7.1f}")
@@ -4,9 +4,13 @@
 #define DLMAIN
 
 #include "pypower.h"
+#include "solver_nr.h"
 
 #include "Python.h"
 
+#define NPY_NO_DEPRECATED_API NPY_1_7_API_VERSION
+#include <numpy/arrayobject.h>
+
 bool enable_opf = false;
 double opf_update_interval = 0;
 double base_MVA = 100.0;
@@ -20,6 +24,13 @@ typedef enum {
     PPSM_GS = 4, // Gauss-Seidel
 } PYPOWERSOLVERMETHOD;
 enumeration solver_method = PPSM_NR;
+typedef enum {
+    PPSE_PYTHON = 0, // pypower python solver
+    PPSE_NATIVE = 1, // native solver with python fallback
+} PYPOWERSOLVERENGINE;
+enumeration solver_engine = PPSE_PYTHON;
+double solver_time = 0; // seconds
+int32 solver_iterations = 0;
 int32 maximum_iterations = 0; // default to pypower default for solver_method
 double solution_tolerance = 0; // default to pypower default
 double solver_update_resolution = 1e-8; 
@@ -98,6 +109,25 @@ EXPORT CLASS *init(CALLBACKS *fntable, MODULE *module, int argc, char *argv[])
         NULL
         );
 
+    gl_global_create("pypower::solver_engine",
+        PT_enumeration, &solver_engine,
+        PT_KEYWORD, "PYTHON", (enumeration)PPSE_PYTHON,
+        PT_KEYWORD, "NATIVE", (enumeration)PPSE_NATIVE,
+        PT_DESCRIPTION, "Powerflow solver implementation (NATIVE falls back to PYTHON for OPF, GS, DC, Q limits, and failed solutions)",
+        NULL
+        );
+
+    gl_global_create("pypower::solver_time",
+        PT_double, &solver_time,
+        PT_UNITS, "s",
+        PT_DESCRIPTION, "Total processor time used by the powerflow solver",
+        NULL);
+
+    gl_global_create("pypower::solver_iterations",
+        PT_int32, &solver_iterations,
+        PT_DESCRIPTION, "Iterations used by the last native powerflow solution",
+        NULL);
+
     gl_global_create("pypower::maximum_timestep",
         PT_double, &maximum_timestep, 
         PT_UNITS, "s",
@@ -234,14 +264,17 @@ PyObject *data = NULL;
 size_t nbus = 0;
 bus *buslist[MAXENT];
 PyObject *busdata = NULL;
+PyObject *busdirty = NULL;
 
 size_t nbranch = 0;
 branch *branchlist[MAXENT];
 PyObject *branchdata = NULL;
+PyObject *branchdirty = NULL;
 
 size_t ngen = 0;
 gen *genlist[MAXENT];
 PyObject *gendata = NULL;
+PyObject *gendirty = NULL;
 
 size_t ngencost = 0;
 gencost *gencostlist[MAXENT];
@@ -261,6 +294,64 @@ static void PyMatrix_INIT(PyObject *a,size_t n,size_t m,double value=0)
 
 }
 
+// bus, branch, and gen data are persistent numpy arrays that are updated in place
+static void *PyArray_INIT(void)
+{
+    import_array();
+    return NULL;
+}
+
+static PyObject *PyArray_MATRIX(size_t n,size_t m)
+{
+    npy_intp dims[] = {(npy_intp)n,(npy_intp)m};
+    return PyArray_ZEROS(2,dims,NPY_DOUBLE,0);
+}
+
+static PyObject *PyArray_MASK(size_t n)
+{
+    npy_intp dims[] = {(npy_intp)n};
+    return PyArray_ZEROS(1,dims,NPY_BOOL,0);
+}
+
+inline double *PyArray_ROW(PyObject *a,size_t n)
+{
+    return (double*)PyArray_GETPTR2((PyArrayObject*)a,n,0);
+}
+
+inline npy_bool *PyArray_MASKDATA(PyObject *a)
+{
+    return (npy_bool*)PyArray_DATA((PyArrayObject*)a);
+}
+
+static void PyArray_CLEARMASK(PyObject *a)
+{
+    memset(PyArray_DATA((PyArrayObject*)a),0,PyArray_NBYTES((PyArrayObject*)a));
+}
+
+// get a solver result as a 2-D double array (returns a new reference)
+static PyObject *PyArray_RESULT(PyObject *result,const char *name,size_t n,size_t m)
+{
+    PyObject *value = PyDict_GetItemString(result,name);
+    if ( value == NULL )
+    {
+        return NULL;
+    }
+    PyObject *array = PyArray_FROM_OTF(value,NPY_DOUBLE,NPY_ARRAY_IN_ARRAY);
+    if ( array == NULL )
+    {
+        PyErr_Clear();
+        return NULL;
+    }
+    PyArrayObject *a = (PyArrayObject*)array;
+    if ( PyArray_NDIM(a) != 2 || (size_t)PyArray_DIM(a,0) < n || (size_t)PyArray_DIM(a,1) < m )
+    {
+        gl_error("pypower solver returned %s data with the wrong shape",name);
+        Py_DECREF(array);
+        return NULL;
+    }
+    return array;
+}
+
 inline bool opf_needed(TIMESTAMP t)
 {
     return enable_opf && ( opf_update_interval == 0 || fmod(t,opf_update_interval) == 0 );
@@ -415,21 +506,30 @@ EXPORT bool on_init(void)
     }
 
     // first time setup of arrays
+    PyArray_INIT();
     data = PyDict_New();
     PyDict_SetItemString(data,"version",PyLong_FromLong((long)pypower_version));
     PyDict_SetItemString(data,"baseMVA",PyFloat_FromDouble((double)base_MVA));
 
-    busdata = PyList_New(nbus);
-    PyMatrix_INIT(busdata,nbus,enable_opf?17:13,0.0);
+    busdata = PyArray_MATRIX(nbus,enable_opf?17:13);
     PyDict_SetItemString(data,"bus",busdata);
+    busdirty = PyArray_MASK(nbus);
 
-    branchdata = PyList_New(nbranch);
-    PyMatrix_INIT(branchdata,nbranch,13,0.0);
+    branchdata = PyArray_MATRIX(nbranch,13);
     PyDict_SetItemString(data,"branch",branchdata);
+    branchdirty = PyArray_MASK(nbranch);
 
-    gendata = PyList_New(ngen);
-    PyMatrix_INIT(gendata,ngen,enable_opf?25:21,0.0);
+    gendata = PyArray_MATRIX(ngen,enable_opf?25:21);
     PyDict_SetItemString(data,"gen",gendata);
+    gendirty = PyArray_MASK(ngen);
+
+    // rows changed since the last solver run
+    PyObject *dirty = PyDict_New();
+    PyDict_SetItemString(dirty,"bus",busdirty);
+    PyDict_SetItemString(dirty,"branch",branchdirty);
+    PyDict_SetItemString(dirty,"gen",gendirty);
+    PyDict_SetItemString(data,"dirty",dirty);
+    Py_DECREF(dirty);
 
     if ( enable_opf )
     {
@@ -481,8 +581,15 @@ EXPORT bool on_init(void)
     return true;
 }
 
-// conditional solver send/receive (only if value differs or is not set yet)
-#define SENDX(INDEX,NAME,FROM,TO) { PyObject *py = PyList_GET_ITEM(pyobj,INDEX); \
+// conditional solver send/receive (only if value differs)
+#define SENDX(INDEX,NAME) { double a = (double)obj->get_##NAME(); \
+    if ( fabs(a-row[INDEX]) > solver_update_resolution ) { \
+        row[INDEX] = a; \
+        dirty[n] = NPY_TRUE; \
+}}
+
+// conditional gencost send (gencost data is a list because costs are strings)
+#define SENDC(INDEX,NAME,FROM,TO) { PyObject *py = PyList_GET_ITEM(pyobj,INDEX); \
     if ( py == NULL || fabs(obj->get_##NAME()-Py##TO##_As##FROM(py)) > solver_update_resolution ) { \
         PyObject *value = Py##TO##_From##FROM(obj->get_##NAME()); \
         if ( value == NULL ) { \
@@ -497,81 +604,84 @@ static TIMESTAMP update_controller(TIMESTAMP t0,PyObject *command,const char *na
 {
     TIMESTAMP t1 = TS_NEVER;
     // send values out to solver
+    npy_bool *dirty = PyArray_MASKDATA(busdirty);
     for ( size_t n = 0 ; n < nbus ; n++ )
     {
         bus *obj = buslist[n];
-        PyObject *pyobj = PyList_GetItem(busdata,n);
-        SENDX(0,bus_i,Double,Float)
-        SENDX(1,type,Long,Long)
-        SENDX(2,Pd,Double,Float)
-        SENDX(3,Qd,Double,Float)
-        SENDX(4,Gs,Double,Float)
-        SENDX(5,Bs,Double,Float)
-        SENDX(6,area,Long,Long)
-        SENDX(7,Vm,Double,Float)
-        SENDX(8,Va,Double,Float)
-        SENDX(9,baseKV,Double,Float)
-        SENDX(10,zone,Long,Long)
-        SENDX(11,Vmax,Double,Float)
-        SENDX(12,Vmin,Double,Float)
+        double *row = PyArray_ROW(busdata,n);
+        SENDX(0,bus_i)
+        SENDX(1,type)
+        SENDX(2,Pd)
+        SENDX(3,Qd)
+        SENDX(4,Gs)
+        SENDX(5,Bs)
+        SENDX(6,area)
+        SENDX(7,Vm)
+        SENDX(8,Va)
+        SENDX(9,baseKV)
+        SENDX(10,zone)
+        SENDX(11,Vmax)
+        SENDX(12,Vmin)
         if ( opf_needed(t0) )
         {
-            SENDX(13,lam_P,Double,Float)
-            SENDX(14,lam_Q,Double,Float)
-            SENDX(15,mu_Vmax,Double,Float)
-            SENDX(16,mu_Vmin,Double,Float)
+            SENDX(13,lam_P)
+            SENDX(14,lam_Q)
+            SENDX(15,mu_Vmax)
+            SENDX(16,mu_Vmin)
         }
     }
+    dirty = PyArray_MASKDATA(branchdirty);
     for ( size_t n = 0 ; n < nbranch ; n++ )
     {
         branch *obj = branchlist[n];
-        PyObject *pyobj = PyList_GetItem(branchdata,n);
-        SENDX(0,fbus,Long,Long)
-        SENDX(1,tbus,Long,Long)
-        SENDX(2,r,Double,Float)
-        SENDX(3,x,Double,Float)
-        SENDX(4,b,Double,Float)
-        SENDX(5,rateA,Double,Float)
-        SENDX(6,rateB,Double,Float)
-        SENDX(7,rateC,Double,Float)
-        SENDX(8,ratio,Double,Float)
-        SENDX(9,angle,Double,Float)
-        SENDX(10,status,Long,Long)
-        SENDX(11,angmin,Double,Float)
-        SENDX(12,angmax,Double,Float)
+        double *row = PyArray_ROW(branchdata,n);
+        SENDX(0,fbus)
+        SENDX(1,tbus)
+        SENDX(2,r)
+        SENDX(3,x)
+        SENDX(4,b)
+        SENDX(5,rateA)
+        SENDX(6,rateB)
+        SENDX(7,rateC)
+        SENDX(8,ratio)
+        SENDX(9,angle)
+        SENDX(10,status)
+        SENDX(11,angmin)
+        SENDX(12,angmax)
 
     }
+    dirty = PyArray_MASKDATA(gendirty);
     for ( size_t n = 0 ; n < ngen ; n++ )
     {
         gen *obj = genlist[n];
-        PyObject *pyobj = PyList_GetItem(gendata,n);
-        SENDX(0,bus,Long,Long)
-        SENDX(1,Pg,Double,Float)
-        SENDX(2,Qg,Double,Float)
-        SENDX(3,Qmax,Double,Float)
-        SENDX(4,Qmin,Double,Float)
-        SENDX(5,Vg,Double,Float)
-        SENDX(6,mBase,Double,Float)
-        SENDX(7,status,Long,Long)
-        SENDX(8,Pmax,Double,Float)
-        SENDX(9,Pmin,Double,Float)
-        SENDX(10,Pc1,Double,Float)
-        SENDX(11,Pc2,Double,Float)
-        SENDX(12,Qc1min,Double,Float)
-        SENDX(13,Qc1max,Double,Float)
-        SENDX(14,Qc2min,Double,Float)
-        SENDX(15,Qc2max,Double,Float)
-        SENDX(16,ramp_agc,Double,Float)
-        SENDX(17,ramp_10,Double,Float)
-        SENDX(18,ramp_30,Double,Float)
-        SENDX(19,ramp_q,Double,Float)
-        SENDX(20,apf,Double,Float)
+        double *row = PyArray_ROW(gendata,n);
+        SENDX(0,bus)
+        SENDX(1,Pg)
+        SENDX(2,Qg)
+        SENDX(3,Qmax)
+        SENDX(4,Qmin)
+        SENDX(5,Vg)
+        SENDX(6,mBase)
+        SENDX(7,status)
+        SENDX(8,Pmax)
+        SENDX(9,Pmin)
+        SENDX(10,Pc1)
+        SENDX(11,Pc2)
+        SENDX(12,Qc1min)
+        SENDX(13,Qc1max)
+        SENDX(14,Qc2min)
+        SENDX(15,Qc2max)
+        SENDX(16,ramp_agc)
+        SENDX(17,ramp_10)
+        SENDX(18,ramp_30)
+        SENDX(19,ramp_q)
+        SENDX(20,apf)
         if ( opf_needed(t0) )
         {
-            SENDX(21,mu_Pmax,Double,Float)
-            SENDX(22,mu_Pmin,Double,Float)
-            SENDX(23,mu_Qmax,Double,Float)
-            SENDX(24,mu_Qmin,Double,Float)
+            SENDX(21,mu_Pmax)
+            SENDX(22,mu_Pmin)
+            SENDX(23,mu_Qmax)
+            SENDX(24,mu_Qmin)
         }
     }
     if ( gencostdata )
@@ -586,9 +696,9 @@ static TIMESTAMP update_controller(TIMESTAMP t0,PyObject *command,const char *na
             gencost *obj = genlist[i]->cost;
             size_t n = obj->index;
             PyObject *pyobj = PyList_GetItem(gencostdata,n);
-            SENDX(0,model,Long,Long)
-            SENDX(1,startup,Double,Float)
-            SENDX(2,shutdown,Double,Float)
+            SENDC(0,model,Long,Long)
+            SENDC(1,startup,Double,Float)
+            SENDC(2,shutdown,Double,Float)
             PyObject *py = PyList_GetItem(pyobj,3);
             if ( py == NULL || strcmp((const char*)PyUnicode_DATA(py),obj->get_costs())!=0 )
             {
@@ -631,7 +741,19 @@ static TIMESTAMP update_controller(TIMESTAMP t0,PyObject *command,const char *na
     return t1;
 }
 
-#define SEND(INDEX,NAME,FROM,TO,CHANGE) { PyObject *py = PyList_GET_ITEM(pyobj,INDEX); \
+#define SEND(INDEX,NAME,CHANGE) { double a = (double)obj->get_##NAME(); \
+    double b = row[INDEX]; \
+    if ( fabs(a-b) > solver_update_resolution ) { \
+        row[INDEX] = a; \
+        dirty[n] = NPY_TRUE; \
+        if ( CHANGE ) { \
+            gl_debug("pypower.update_solution(t=%lld): sending bus %d %s, updating from %lf to %lf", \
+                t0,n,#NAME,b,a); \
+            n_changes++; \
+        } \
+}}
+
+#define SENDL(INDEX,NAME,FROM,TO,CHANGE) { PyObject *py = PyList_GET_ITEM(pyobj,INDEX); \
     double a = obj->get_##NAME(); \
     double b = Py##TO##_As##FROM(py); \
     if ( py == NULL || fabs(a-b) > solver_update_resolution ) { \
@@ -649,9 +771,9 @@ static TIMESTAMP update_controller(TIMESTAMP t0,PyObject *command,const char *na
             Py_XDECREF(py); \
 }}}
 
-#define RECV(NAME,INDEX,FROM,TO,CHANGE) { PyObject *py = PyList_GET_ITEM(pyobj,INDEX);\
+#define RECV(NAME,INDEX,CHANGE) { \
     double a = obj->get_##NAME(); \
-    double b = Py##FROM##_As##TO(py); \
+    double b = row[INDEX]; \
     if ( fabs(a-b) > solver_update_resolution ) { \
         if ( CHANGE ) { \
             gl_debug("pypower.update_solution(t=%lld): receiving bus %d %s, updating from %lf to %lf", \
@@ -677,87 +799,90 @@ static TIMESTAMP update_solution(TIMESTAMP t0)
     // send values out to solver
     gl_verbose("updating bus data");
     PyDict_SetItemString(data,"bus",busdata);
+    npy_bool *dirty = PyArray_MASKDATA(busdirty);
     for ( size_t n = 0 ; n < nbus ; n++ )
     {
         bus *obj = buslist[n];
-        PyObject *pyobj = PyList_GetItem(busdata,n);
-        SEND(0,bus_i,Double,Float,true)
-        SEND(1,type,Long,Long,true)
-        SEND(2,Pd,Double,Float,true)
-        SEND(3,Qd,Double,Float,true)
-        SEND(4,Gs,Double,Float,true)
-        SEND(5,Bs,Double,Float,true)
-        SEND(6,area,Long,Long,false)
-        SEND(7,Vm,Double,Float,false)
-        SEND(8,Va,Double,Float,false)
-        SEND(9,baseKV,Double,Float,false)
-        SEND(10,zone,Long,Long,false)
-        SEND(11,Vmax,Double,Float,false)
-        SEND(12,Vmin,Double,Float,false)
+        double *row = PyArray_ROW(busdata,n);
+        SEND(0,bus_i,true)
+        SEND(1,type,true)
+        SEND(2,Pd,true)
+        SEND(3,Qd,true)
+        SEND(4,Gs,true)
+        SEND(5,Bs,true)
+        SEND(6,area,false)
+        SEND(7,Vm,false)
+        SEND(8,Va,false)
+        SEND(9,baseKV,false)
+        SEND(10,zone,false)
+        SEND(11,Vmax,false)
+        SEND(12,Vmin,false)
         if ( do_opf )
         {
-            SEND(13,lam_P,Double,Float,false)
-            SEND(14,lam_Q,Double,Float,false)
-            SEND(15,mu_Vmax,Double,Float,false)
-            SEND(16,mu_Vmin,Double,Float,false)
+            SEND(13,lam_P,false)
+            SEND(14,lam_Q,false)
+            SEND(15,mu_Vmax,false)
+            SEND(16,mu_Vmin,false)
         }
     }
 
     gl_verbose("updating branch data");
     PyDict_SetItemString(data,"branch",branchdata);
+    dirty = PyArray_MASKDATA(branchdirty);
     for ( size_t n = 0 ; n < nbranch ; n++ )
     {
         branch *obj = branchlist[n];
-        PyObject *pyobj = PyList_GetItem(branchdata,n);
-        SEND(0,fbus,Long,Long,true)
-        SEND(1,tbus,Long,Long,true)
-        SEND(2,r,Double,Float,true)
-        SEND(3,x,Double,Float,true)
-        SEND(4,b,Double,Float,true)
-        SEND(5,rateA,Double,Float,do_opf)
-        SEND(6,rateB,Double,Float,do_opf)
-        SEND(7,rateC,Double,Float,do_opf)
-        SEND(8,ratio,Double,Float,true)
-        SEND(9,angle,Double,Float,true)
-        SEND(10,status,Long,Long,true)
-        SEND(11,angmin,Double,Float,true)
-        SEND(12,angmax,Double,Float,true)
+        double *row = PyArray_ROW(branchdata,n);
+        SEND(0,fbus,true)
+        SEND(1,tbus,true)
+        SEND(2,r,true)
+        SEND(3,x,true)
+        SEND(4,b,true)
+        SEND(5,rateA,do_opf)
+        SEND(6,rateB,do_opf)
+        SEND(7,rateC,do_opf)
+        SEND(8,ratio,true)
+        SEND(9,angle,true)
+        SEND(10,status,true)
+        SEND(11,angmin,true)
+        SEND(12,angmax,true)
 
     }
 
     gl_verbose("updating gen data");
     PyDict_SetItemString(data,"gen",gendata);
+    dirty = PyArray_MASKDATA(gendirty);
     for ( size_t n = 0 ; n < ngen ; n++ )
     {
         gen *obj = genlist[n];
-        PyObject *pyobj = PyList_GetItem(gendata,n);
-        SEND(0,bus,Long,Long,true)
-        SEND(1,Pg,Double,Float,true)
-        SEND(2,Qg,Double,Float,true)
-        SEND(3,Qmax,Double,Float,true)
-        SEND(4,Qmin,Double,Float,true)
-        SEND(5,Vg,Double,Float,true)
-        SEND(6,mBase,Double,Float,true)
-        SEND(7,status,Long,Long,true)
-        SEND(8,Pmax,Double,Float,true)
-        SEND(9,Pmin,Double,Float,true)
-        SEND(10,Pc1,Double,Float,true)
-        SEND(11,Pc2,Double,Float,true)
-        SEND(12,Qc1min,Double,Float,true)
-        SEND(13,Qc1max,Double,Float,true)
-        SEND(14,Qc2min,Double,Float,true)
-        SEND(15,Qc2max,Double,Float,true)
-        SEND(16,ramp_agc,Double,Float,false)
-        SEND(17,ramp_10,Double,Float,false)
-        SEND(18,ramp_30,Double,Float,false)
-        SEND(19,ramp_q,Double,Float,false)
-        SEND(20,apf,Double,Float,false)
+        double *row = PyArray_ROW(gendata,n);
+        SEND(0,bus,true)
+        SEND(1,Pg,true)
+        SEND(2,Qg,true)
+        SEND(3,Qmax,true)
+        SEND(4,Qmin,true)
+        SEND(5,Vg,true)
+        SEND(6,mBase,true)
+        SEND(7,status,true)
+        SEND(8,Pmax,true)
+        SEND(9,Pmin,true)
+        SEND(10,Pc1,true)
+        SEND(11,Pc2,true)
+        SEND(12,Qc1min,true)
+        SEND(13,Qc1max,true)
+        SEND(14,Qc2min,true)
+        SEND(15,Qc2max,true)
+        SEND(16,ramp_agc,false)
+        SEND(17,ramp_10,false)
+        SEND(18,ramp_30,false)
+        SEND(19,ramp_q,false)
+        SEND(20,apf,false)
         if ( do_opf )
         {
-            SEND(21,mu_Pmax,Double,Float,false)
-            SEND(22,mu_Pmin,Double,Float,false)
-            SEND(23,mu_Qmax,Double,Float,false)
-            SEND(24,mu_Qmin,Double,Float,false)
+            SEND(21,mu_Pmax,false)
+            SEND(22,mu_Pmin,false)
+            SEND(23,mu_Qmax,false)
+            SEND(24,mu_Qmin,false)
         }
     }
 
@@ -769,9 +894,9 @@ static TIMESTAMP update_solution(TIMESTAMP t0)
         {
             gencost *obj = gencostlist[n];
             PyObject *pyobj = PyList_GetItem(gencostdata,n);
-            SEND(0,model,Long,Long,do_opf)
-            SEND(1,startup,Double,Float,do_opf)
-            SEND(2,shutdown,Double,Float,do_opf)
+            SENDL(0,model,Long,Long,do_opf)
+            SENDL(1,startup,Double,Float,do_opf)
+            SENDL(2,shutdown,Double,Float,do_opf)
             PyObject *py = PyList_GetItem(pyobj,3);
             if ( py == NULL || strcmp((const char*)PyUnicode_DATA(py),obj->get_costs())!=0 )
             {
@@ -826,13 +951,40 @@ static TIMESTAMP update_solution(TIMESTAMP t0)
         n_changes = 0;
 
         // run pypower solver
-        if ( result != data )
+        Py_XDECREF(result);
+        PyErr_Clear();
+        clock_t start = clock();
+        result = NULL;
+        if ( solver_engine == PPSE_NATIVE && ! do_opf && ! use_dc_powerflow && ! enforce_q_limits && solver_method != PPSM_GS )
+        {
+            gl_verbose("running native powerflow solver");
+            PYPOWERNATIVESTATUS status = pypower_solve_nr(solver_method,base_MVA,
+                nbus,PyArray_ROW(busdata,0),PyArray_DIM((PyArrayObject*)busdata,1),
+                nbranch,PyArray_ROW(branchdata,0),PyArray_DIM((PyArrayObject*)branchdata,1),
+                ngen,ngen>0?PyArray_ROW(gendata,0):NULL,PyArray_DIM((PyArrayObject*)gendata,1),
+                maximum_iterations,solution_tolerance,&solver_iterations);
+            if ( status == PNS_SUCCESS )
+            {
+                // hold a reference like the python solver call does
+                Py_INCREF(data);
+                result = data;
+            }
+            else
+            {
+                gl_verbose("native powerflow solver failed (status %d), using pypower solver",status);
+            }
+        }
+        if ( result == NULL )
         {
-            Py_XDECREF(result);
+            gl_verbose("running pypower solver");
+            result = PyObject_CallOneArg(solver,data);
+
+            // the masks track the rows changed since the pypower solver last copied them
+            PyArray_CLEARMASK(busdirty);
+            PyArray_CLEARMASK(branchdirty);
+            PyArray_CLEARMASK(gendirty);
         }
-        PyErr_Clear();
-        gl_verbose("running pypower solver");
-        result = PyObject_CallOneArg(solver,data);
+        solver_time += (double)(clock()-start)/CLOCKS_PER_SEC;
 
         // receive results (if new)
         if ( result != NULL )
@@ -874,7 +1026,7 @@ static TIMESTAMP update_solution(TIMESTAMP t0)
             }
 
             // copy values back from solver
-            PyObject *busdata = PyDict_GetItemString(result,"bus");
+            PyObject *busdata = PyArray_RESULT(result,"bus",nbus,do_opf?17:13);
             if ( nbus > 0 && busdata == NULL )
             {
                 gl_error("pypower solver did not return any bus data");
@@ -885,25 +1037,26 @@ static TIMESTAMP update_solution(TIMESTAMP t0)
             for ( size_t n = 0 ; n < nbus ; n++ )
             {
                 bus *obj = buslist[n];
-                PyObject *pyobj = PyList_GetItem(busdata,n);
-                if ( ! isnan(PyFloat_AsDouble(PyList_GET_ITEM(pyobj,7))) )
+                double *row = PyArray_ROW(busdata,n);
+                if ( ! isnan(row[7]) )
                 {
-                    RECV(Vm,7,Float,Double,false)
+                    RECV(Vm,7,false)
                 }
-                if ( ! isnan(PyFloat_AsDouble(PyList_GET_ITEM(pyobj,8))) )
+                if ( ! isnan(row[8]) )
                 {
-                    RECV(Va,8,Float,Double,false)
+                    RECV(Va,8,false)
                 }
 
                 if ( do_opf )
                 {
-                    RECV(lam_P,13,Float,Double,false)
-                    RECV(lam_Q,14,Float,Double,false)
-                    RECV(mu_Vmax,15,Float,Double,false)
-                    RECV(mu_Vmin,16,Float,Double,false)
+                    RECV(lam_P,13,false)
+                    RECV(lam_Q,14,false)
+                    RECV(mu_Vmax,15,false)
+                    RECV(mu_Vmin,16,false)
                 }
                 obj->V.SetPolar(obj->get_Vm(),obj->get_Va());
             }
+            Py_XDECREF(busdata);
 
             gl_verbose("reading branch data");
             for ( size_t n = 0 ; n < nbranch ; n++ )
@@ -934,7 +1087,7 @@ static TIMESTAMP update_solution(TIMESTAMP t0)
             }
 
             gl_verbose("reading gencost data");
-            PyObject *gendata = PyDict_GetItemString(result,"gen");
+            PyObject *gendata = PyArray_RESULT(result,"gen",ngen,do_opf?25:21);
             if ( ngencost > 0 && gendata == NULL )
             {
                 gl_error("pypower solver did not return any gen data");
@@ -943,34 +1096,35 @@ static TIMESTAMP update_solution(TIMESTAMP t0)
             }
             generation_shortfall = 0;
             gl_verbose("reading gen data");
-            for ( size_t n = 0 ; n < ngen ; n++ )
+            for ( size_t n = 0 ; gendata != NULL && n < ngen ; n++ )
             {
                 gen *obj = genlist[n];
-                PyObject *pyobj = PyList_GetItem(gendata,n);
+                double *row = PyArray_ROW(gendata,n);
 
                 // if doing OPF and powerplant are connected to this generation object
                 if ( do_opf && obj->get_powerplant_count() > 0 )
                 {
                     // only update generation setpoints (powerplant control active)
-                    RECV(Ps,1,Float,Double,true)
-                    RECV(Qs,2,Float,Double,true)
+                    RECV(Ps,1,true)
+                    RECV(Qs,2,true)
                 }
                 else
                 {   
                     // update actual generation (not powerplant controls active)
-                    RECV(Pg,1,Float,Double,true)
-                    RECV(Qg,2,Float,Double,true)
+                    RECV(Pg,1,true)
+                    RECV(Qg,2,true)
                 }
-                RECV(apf,20,Float,Double,false)
+                RECV(apf,20,false)
                 if ( do_opf )
                 {
-                    RECV(mu_Pmax,21,Float,Double,false)
-                    RECV(mu_Pmin,22,Float,Double,false)
-                    RECV(mu_Qmax,23,Float,Double,false)
-                    RECV(mu_Qmin,24,Float,Double,false)
+                    RECV(mu_Pmax,21,false)
+                    RECV(mu_Pmin,22,false)
+                    RECV(mu_Qmax,23,false)
+                    RECV(mu_Qmin,24,false)
                 }
                 generation_shortfall += max(obj->get_Pg() - obj->get_Pmax(),0.0);
             }
+            Py_XDECREF(gendata);
             gl_verbose("%d changes detected",n_changes);
         }
     }
@@ -1094,8 +1248,11 @@ EXPORT int do_kill(void*)
 {
     // if global memory needs to be released, this is a good time to do it
     Py_XDECREF(busdata);
+    Py_XDECREF(busdirty);
     Py_XDECREF(branchdata);
+    Py_XDECREF(branchdirty);
     Py_XDECREF(gendata);
+    Py_XDECREF(gendirty);
     Py_XDECREF(gencostdata);
 
     return 0;
@@ -39,6 +39,36 @@ csv_headers = {
 class PypowerError(Exception):
     pass
 
+# solver copy of the case tables, kept between solutions and updated from the dirty rows only
+casecache = {}
+genmap = []
+
+def update_cache(pf_case):
+    """Copy the rows of the model tables that changed since the last solution
+
+    The first call, or a call with a table whose shape changed, copies the whole table.
+    Returns True if the generator rows changed.
+    """
+    dirty = pf_case['dirty'] if 'dirty' in pf_case else {}
+    gen_changed = False
+    for name in ['bus','branch','gen']:
+        if name not in pf_case:
+            continue
+        source = pf_case[name]
+        mask = dirty[name] if name in dirty else None
+        if name not in casecache or mask is None or casecache[name].shape != source.shape:
+            casecache[name] = array(source,dtype=float)
+            changed = True
+        else:
+            changed = mask.any()
+            if changed:
+                casecache[name][mask] = source[mask]
+        if debug and mask is not None:
+            print(f"{name} rows changed: {int(mask.sum())} of {len(mask)}",file=sys.stderr)
+        if name == 'gen':
+            gen_changed = changed
+    return gen_changed
+
 def write_case(data,filename,diagnostics=True):
     name,ext = os.path.splitext(filename)
     if ext == ".py":
@@ -145,6 +175,8 @@ def jsonify(data):
 
 def solver(pf_case):
 
+    global genmap
+
     try:
 
         # read options from case
@@ -191,10 +223,11 @@ def solver(pf_case):
         # setup casedata
         casedata = dict(version=str(pf_case['version']),baseMVA=pf_case['baseMVA'])
 
-        # copy from model
+        # copy the changed rows from the model (the model arrays are persistent and are updated in place)
+        gen_changed = update_cache(pf_case)
         for name in ['bus','branch']:
-            if name in pf_case:
-                casedata[name] = array(pf_case[name])
+            if name in casecache:
+                casedata[name] = casecache[name]
 
         # output detailed solver debugging information 
         if debug and verbose:
@@ -218,9 +251,10 @@ def solver(pf_case):
                     + f" {['OUT','IN'][int(row[10])]:9.9s} {row[11]:6.1f} {row[12]:6.1f}"
                     ,file=sys.stderr)
 
-        if 'gen' in pf_case:
-            genmap = [n for n,x in enumerate(pf_case['gen']) if x[7] == 1]
-            casedata['gen'] = array([pf_case['gen'][n] for n in genmap])
+        if 'gen' in casecache:
+            if gen_changed:
+                genmap = [n for n,x in enumerate(casecache['gen']) if x[7] == 1]
+            casedata['gen'] = casecache['gen'][genmap]
 
         # output detailed solver debugging information 
         if debug and verbose:
@@ -291,10 +325,20 @@ def solver(pf_case):
             if stop_on_failure:
                 return False
             
-        for name in ['bus','branch']:
-            pf_case[name] = results[name].tolist()
-        for n,m in enumerate(genmap):
-            pf_case['gen'][m] = results['gen'][n].tolist()
+        def update(target,source,rows=slice(None)):
+            if not hasattr(target,"shape"):
+                target = array(target,dtype=float)
+            ncols = min(target.shape[1],source.shape[1])
+            target[rows,:ncols] = source[:,:ncols]
+            return target
+        pf_case['bus'] = update(pf_case['bus'],results['bus'])
+        pf_case['branch'] = results['branch']
+        pf_case['gen'] = update(pf_case['gen'],results['gen'],genmap)
+
+        # keep the solver copy in step with the results so the next solution starts from them
+        update(casecache['bus'],results['bus'])
+        if 'gen' in casecache:
+            update(casecache['gen'],results['gen'],genmap)
 
         return pf_case
         
@@ -0,0 +1,693 @@
+// module/pypower/solver_nr.cpp
+// Copyright (C) 2024 Regents of the Leland Stanford Junior University
+//
+// Native AC powerflow solver for pypower case data.  The algorithms follow
+// the pypower/MATPOWER implementations of newtonpf() and fdpf() so that the
+// native and python solvers give the same results.
+
+#include "pypower.h"
+#include "solver_nr.h"
+
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <cfloat>
+
+#include <pdsp_defs.h> // superLU_MT
+
+// MATPOWER column indexes
+#define BUS_I 0
+#define BUS_TYPE 1
+#define PD 2
+#define QD 3
+#define GS 4
+#define BS 5
+#define VM 7
+#define VA 8
+
+#define F_BUS 0
+#define T_BUS 1
+#define BR_R 2
+#define BR_X 3
+#define BR_B 4
+#define TAP 8
+#define SHIFT 9
+#define BR_STATUS 10
+
+#define GEN_BUS 0
+#define PG 1
+#define QG 2
+#define QMAX 3
+#define QMIN 4
+#define VG 5
+#define GEN_STATUS 7
+
+// MATPOWER bus types
+#define PQ 1
+#define PV 2
+#define REF 3
+
+#define DEG (180/M_PI)
+
+typedef std::vector< std::pair<int,complex> > YROW;
+typedef std::vector<YROW> YBUS;
+
+typedef struct s_triplet {
+    int row;
+    int col;
+    double value;
+} TRIPLET;
+
+static bool compare_triplet(const TRIPLET &a, const TRIPLET &b)
+{
+    return a.col < b.col || ( a.col == b.col && a.row < b.row );
+}
+
+// options for building modified admittance matrices (see MATPOWER makeB)
+#define YB_NOSHUNT 0x01 // zero bus shunts
+#define YB_NOCHARGING 0x02 // zero line charging
+#define YB_NOTAP 0x04 // cancel taps
+#define YB_NORESISTANCE 0x08 // zero line resistance
+#define YB_NOSHIFT 0x10 // zero phase shifters
+
+static void build_ybus(
+    YBUS &Y,
+    const std::vector<int> &index,
+    double base_MVA,
+    size_t nbus, const double *bus, size_t bus_cols,
+    size_t nbranch, const double *branch, size_t branch_cols,
+    int options = 0)
+{
+    std::vector< std::map<int,complex> > A(nbus);
+    if ( ! ( options & YB_NOSHUNT ) )
+    {
+        for ( size_t n = 0 ; n < nbus ; n++ )
+        {
+            const double *row = bus + n*bus_cols;
+            A[n][n] += complex(row[GS],row[BS]) / base_MVA;
+        }
+    }
+    for ( size_t n = 0 ; n < nbranch ; n++ )
+    {
+        const double *row = branch + n*branch_cols;
+        if ( row[BR_STATUS] == 0 )
+        {
+            continue;
+        }
+        int f = index[(int)row[F_BUS]];
+        int t = index[(int)row[T_BUS]];
+        double r = ( options & YB_NORESISTANCE ) ? 0.0 : row[BR_R];
+        double b = ( options & YB_NOCHARGING ) ? 0.0 : row[BR_B];
+        double tap = ( ( options & YB_NOTAP ) || row[TAP] == 0 ) ? 1.0 : row[TAP];
+        double shift = ( options & YB_NOSHIFT ) ? 0.0 : row[SHIFT]/DEG;
+        complex Ys = complex(1,0) / complex(r,row[BR_X]);
+        complex Ytt = Ys + complex(0,b/2);
+        complex T(tap*cos(shift),tap*sin(shift));
+        A[f][f] += Ytt / (tap*tap);
+        A[f][t] -= Ys / ~T;
+        A[t][f] -= Ys / T;
+        A[t][t] += Ytt;
+    }
+    Y.resize(nbus);
+    for ( size_t n = 0 ; n < nbus ; n++ )
+    {
+        Y[n].assign(A[n].begin(),A[n].end());
+    }
+}
+
+// Assemble triplets in compressed column form (duplicate entries are summed)
+static void compress_columns(int size, std::vector<TRIPLET> &entries,
+    std::vector<double> &nzval, std::vector<int> &rowind, std::vector<int> &colptr)
+{
+    std::sort(entries.begin(),entries.end(),compare_triplet);
+    nzval.clear();
+    rowind.clear();
+    colptr.assign(size+1,0);
+    nzval.reserve(entries.size());
+    rowind.reserve(entries.size());
+    for ( std::vector<TRIPLET>::iterator item = entries.begin() ; item != entries.end() ; item++ )
+    {
+        if ( ! rowind.empty() && colptr[item->col+1] > 0 && rowind.back() == item->row )
+        {
+            nzval.back() += item->value;
+        }
+        else
+        {
+            nzval.push_back(item->value);
+            rowind.push_back(item->row);
+            colptr[item->col+1]++;
+        }
+    }
+    for ( int n = 0 ; n < size ; n++ )
+    {
+        colptr[n+1] += colptr[n];
+    }
+}
+
+// Solve A x = b using superLU_MT (b is overwritten by x)
+static bool sparse_solve(int size, std::vector<TRIPLET> &entries, double *b)
+{
+    if ( size <= 0 || entries.empty() )
+    {
+        return size <= 0;
+    }
+    std::vector<double> nzval;
+    std::vector<int> rowind, colptr;
+    compress_columns(size,entries,nzval,rowind,colptr);
+
+    SuperMatrix A, B, L, U;
+    std::vector<int> perm_r(size), perm_c(size);
+    int info = 0;
+    dCreate_CompCol_Matrix(&A,size,size,(int)nzval.size(),&nzval[0],&rowind[0],&colptr[0],SLU_NC,SLU_D,SLU_GE);
+    dCreate_Dense_Matrix(&B,size,1,b,size,SLU_DN,SLU_D,SLU_GE);
+    get_perm_c(1,&A,&perm_c[0]);
+    pdgssv(1,&A,&perm_c[0],&perm_r[0],&L,&U,&B,&info);
+    Destroy_SuperNode_SCP(&L);
+    Destroy_CompCol_NCP(&U);
+    Destroy_SuperMatrix_Store(&A);
+    Destroy_SuperMatrix_Store(&B);
+    return info == 0;
+}
+
+// Retained LU factors of a constant matrix
+typedef struct s_sparsefactor {
+    int size;
+    bool factored;
+    SuperMatrix L, U;
+    std::vector<int> perm_r, perm_c;
+} SPARSEFACTOR;
+
+// Factor A once so that later solves only need the triangular solves
+static bool sparse_factor(SPARSEFACTOR &F, int size, std::vector<TRIPLET> &entries)
+{
+    F.size = size;
+    F.factored = false;
+    if ( size <= 0 || entries.empty() )
+    {
+        return size <= 0;
+    }
+    std::vector<double> nzval;
+    std::vector<int> rowind, colptr;
+    compress_columns(size,entries,nzval,rowind,colptr);
+
+    SuperMatrix A, B;
+    std::vector<double> b(size,0.0);
+    int info = 0;
+    F.perm_r.resize(size);
+    F.perm_c.resize(size);
+    dCreate_CompCol_Matrix(&A,size,size,(int)nzval.size(),&nzval[0],&rowind[0],&colptr[0],SLU_NC,SLU_D,SLU_GE);
+    dCreate_Dense_Matrix(&B,size,1,&b[0],size,SLU_DN,SLU_D,SLU_GE);
+    get_perm_c(1,&A,&F.perm_c[0]);
+    pdgssv(1,&A,&F.perm_c[0],&F.perm_r[0],&F.L,&F.U,&B,&info);
+    Destroy_SuperMatrix_Store(&A);
+    Destroy_SuperMatrix_Store(&B);
+    F.factored = ( info >= 0 ); // L and U are allocated unless the arguments were rejected
+    return info == 0;
+}
+
+// Solve A x = b with the retained factors of A (b is overwritten by x)
+static bool sparse_resolve(SPARSEFACTOR &F, double *b)
+{
+    if ( F.size <= 0 )
+    {
+        return true;
+    }
+    if ( ! F.factored )
+    {
+        return false;
+    }
+    SuperMatrix B;
+    Gstat_t stat;
+    int info = 0;
+    dCreate_Dense_Matrix(&B,F.size,1,b,F.size,SLU_DN,SLU_D,SLU_GE);
+    StatAlloc(F.size,1,sp_ienv(1),sp_ienv(2),&stat);
+    StatInit(F.size,1,&stat);
+    dgstrs(NOTRANS,&F.L,&F.U,&F.perm_r[0],&F.perm_c[0],&B,&stat,&info);
+    StatFree(&stat);
+    Destroy_SuperMatrix_Store(&B);
+    return info == 0;
+}
+
+// Release the retained factors
+static void sparse_release(SPARSEFACTOR &F)
+{
+    if ( F.factored )
+    {
+        Destroy_SuperNode_SCP(&F.L);
+        Destroy_CompCol_NCP(&F.U);
+        F.factored = false;
+    }
+}
+
+// Compute the power mismatch V.*conj(Ybus*V)-Sbus and the bus currents
+static void compute_mismatch(const YBUS &Y, const std::vector<complex> &V, const std::vector<complex> &S,
+    std::vector<complex> &I, std::vector<complex> &mis)
+{
+    for ( size_t i = 0 ; i < Y.size() ; i++ )
+    {
+        complex sum(0,0);
+        for ( YROW::const_iterator y = Y[i].begin() ; y != Y[i].end() ; y++ )
+        {
+            sum += y->second * V[y->first];
+        }
+        I[i] = sum;
+        mis[i] = V[i] * ~sum - S[i];
+    }
+}
+
+// Infinity norm of P mismatch on PV/PQ buses and Q mismatch on PQ buses
+static double mismatch_norm(std::vector<complex> &mis,
+    const std::vector<int> &pvpq, const std::vector<int> &pq,
+    const std::vector<double> *scale = NULL)
+{
+    double norm = 0;
+    for ( std::vector<int>::const_iterator i = pvpq.begin() ; i != pvpq.end() ; i++ )
+    {
+        double x = fabs(mis[*i].Re()) / ( scale ? (*scale)[*i] : 1.0 );
+        if ( x > norm ) norm = x;
+    }
+    for ( std::vector<int>::const_iterator i = pq.begin() ; i != pq.end() ; i++ )
+    {
+        double x = fabs(mis[*i].Im()) / ( scale ? (*scale)[*i] : 1.0 );
+        if ( x > norm ) norm = x;
+    }
+    return norm;
+}
+
+// Extract -imag(B) restricted to the given buses
+static void reduced_susceptance(YBUS &B, const std::vector<int> &buses, const std::vector<int> &position, std::vector<TRIPLET> &entries)
+{
+    entries.clear();
+    for ( std::vector<int>::const_iterator i = buses.begin() ; i != buses.end() ; i++ )
+    {
+        for ( YROW::iterator y = B[*i].begin() ; y != B[*i].end() ; y++ )
+        {
+            if ( position[y->first] >= 0 )
+            {
+                TRIPLET item = {position[*i],position[y->first],-y->second.Im()};
+                entries.push_back(item);
+            }
+        }
+    }
+}
+
+PYPOWERNATIVESTATUS pypower_solve_nr(
+    int method,
+    double base_MVA,
+    size_t nbus, double *bus, size_t bus_cols,
+    size_t nbranch, const double *branch, size_t branch_cols,
+    size_t ngen, double *gen, size_t gen_cols,
+    int maximum_iterations,
+    double tolerance,
+    int *iterations)
+{
+    if ( iterations )
+    {
+        *iterations = 0;
+    }
+    if ( method < 1 || method > 3 || nbus == 0 || base_MVA <= 0 )
+    {
+        return PNS_INVALID;
+    }
+    if ( maximum_iterations <= 0 )
+    {
+        maximum_iterations = ( method == 1 ? 10 : 30 );
+    }
+    if ( tolerance <= 0 )
+    {
+        tolerance = 1e-8;
+    }
+
+    // map bus ids to rows
+    int maxid = 0;
+    for ( size_t n = 0 ; n < nbus ; n++ )
+    {
+        int id = (int)bus[n*bus_cols+BUS_I];
+        if ( id < 0 || id > MAXENT )
+        {
+            // bus ids index a lookup table, so they are capped at the entity limit
+            gl_warning("pypower native solver: bus %d id %d is outside the supported range 0 to %d (renumber bus_i or use the pypower solver engine)",(int)n,id,MAXENT);
+            return PNS_INVALID;
+        }
+        maxid = max(maxid,id);
+    }
+    std::vector<int> index(maxid+1,-1);
+    for ( size_t n = 0 ; n < nbus ; n++ )
+    {
+        index[(int)bus[n*bus_cols+BUS_I]] = n;
+    }
+    for ( size_t n = 0 ; n < nbranch ; n++ )
+    {
+        const double *row = branch + n*branch_cols;
+        int f = (int)row[F_BUS], t = (int)row[T_BUS];
+        if ( f < 0 || f > maxid || t < 0 || t > maxid || index[f] < 0 || index[t] < 0 )
+        {
+            gl_warning("pypower native solver: branch %d refers to bus id %d or %d, which is not in the bus data",(int)n,f,t);
+            return PNS_INVALID;
+        }
+    }
+    for ( size_t n = 0 ; n < ngen ; n++ )
+    {
+        int b = (int)gen[n*gen_cols+GEN_BUS];
+        if ( b < 0 || b > maxid || index[b] < 0 )
+        {
+            gl_warning("pypower native solver: gen %d refers to bus id %d, which is not in the bus data",(int)n,b);
+            return PNS_INVALID;
+        }
+    }
+
+    // bus injections and initial voltages
+    std::vector<complex> S(nbus,complex(0,0));
+    std::vector<double> Vm(nbus), Va(nbus);
+    std::vector<int> ngen_on(nbus,0);
+    for ( size_t n = 0 ; n < nbus ; n++ )
+    {
+        const double *row = bus + n*bus_cols;
+        S[n] = complex(-row[PD],-row[QD]) / base_MVA;
+        Vm[n] = row[VM];
+        Va[n] = row[VA]/DEG;
+    }
+    for ( size_t n = 0 ; n < ngen ; n++ )
+    {
+        const double *row = gen + n*gen_cols;
+        if ( row[GEN_STATUS] > 0 )
+        {
+            int i = index[(int)row[GEN_BUS]];
+            S[i] += complex(row[PG],row[QG]) / base_MVA;
+            if ( ngen_on[i]++ == 0 )
+            {
+                Vm[i] = row[VG];
+            }
+        }
+    }
+
+    // bus types (PV and REF buses require an online generator)
+    std::vector<int> ref, pv, pq;
+    for ( size_t n = 0 ; n < nbus ; n++ )
+    {
+        int type = (int)bus[n*bus_cols+BUS_TYPE];
+        if ( type == REF && ngen_on[n] > 0 )
+        {
+            ref.push_back(n);
+        }
+        else if ( ( type == PV || type == REF ) && ngen_on[n] > 0 )
+        {
+            pv.push_back(n);
+        }
+        else if ( type == PQ || type == PV || type == REF )
+        {
+            pq.push_back(n);
+        }
+    }
+    if ( ref.empty() )
+    {
+        if ( pv.empty() )
+        {
+            return PNS_NOREF;
+        }
+        ref.push_back(pv.front());
+        pv.erase(pv.begin());
+    }
+    std::vector<int> pvpq(pv);
+    pvpq.insert(pvpq.end(),pq.begin(),pq.end());
+    size_t npvpq = pvpq.size(), npq = pq.size();
+    std::vector<int> angle_var(nbus,-1), magnitude_var(nbus,-1);
+    for ( size_t n = 0 ; n < npvpq ; n++ )
+    {
+        angle_var[pvpq[n]] = n;
+    }
+    for ( size_t n = 0 ; n < npq ; n++ )
+    {
+        magnitude_var[pq[n]] = npvpq + n;
+    }
+
+    YBUS Y;
+    build_ybus(Y,index,base_MVA,nbus,bus,bus_cols,nbranch,branch,branch_cols);
+    std::vector<complex> V(nbus), I(nbus), mis(nbus);
+    for ( size_t n = 0 ; n < nbus ; n++ )
+    {
+        V[n].SetPolar(Vm[n],Va[n]);
+    }
+    compute_mismatch(Y,V,S,I,mis);
+
+    bool converged = false;
+    int iteration = 0;
+    if ( method == 1 )
+    {
+        // Newton-Raphson
+        std::vector<TRIPLET> J;
+        std::vector<double> dx(npvpq+npq);
+        converged = ( mismatch_norm(mis,pvpq,pq) < tolerance );
+        while ( ! converged && iteration < maximum_iterations )
+        {
+            iteration++;
+
+            // jacobian
+            J.clear();
+            for ( size_t i = 0 ; i < nbus ; i++ )
+            {
+                int P_eq = angle_var[i], Q_eq = magnitude_var[i];
+                if ( P_eq < 0 && Q_eq < 0 )
+                {
+                    continue;
+                }
+                complex Vnorm_i = V[i] / Vm[i];
+                for ( YROW::const_iterator y = Y[i].begin() ; y != Y[i].end() ; y++ )
+                {
+                    int k = y->first;
+                    complex dS_dVa, dS_dVm;
+                    if ( k == (int)i )
+                    {
+                        dS_dVa = complex(0,1) * V[i] * ~(I[i] - y->second * V[i]);
+                        dS_dVm = V[i] * ~(y->second * Vnorm_i) + ~I[i] * Vnorm_i;
+                    }
+                    else
+                    {
+                        dS_dVa = complex(0,-1) * V[i] * ~(y->second * V[k]);
+                        dS_dVm = V[i] * ~(y->second * (V[k] / Vm[k]));
+                    }
+                    if ( P_eq >= 0 )
+                    {
+                        if ( angle_var[k] >= 0 )
+                        {
+                            TRIPLET item = {P_eq,angle_var[k],dS_dVa.Re()};
+                            J.push_back(item);
+                        }
+                        if ( magnitude_var[k] >= 0 )
+                        {
+                            TRIPLET item = {P_eq,magnitude_var[k],dS_dVm.Re()};
+                            J.push_back(item);
+                        }
+                    }
+                    if ( Q_eq >= 0 )
+                    {
+                        if ( angle_var[k] >= 0 )
+                        {
+                            TRIPLET item = {Q_eq,angle_var[k],dS_dVa.Im()};
+                            J.push_back(item);
+                        }
+                        if ( magnitude_var[k] >= 0 )
+                        {
+                            TRIPLET item = {Q_eq,magnitude_var[k],dS_dVm.Im()};
+                            J.push_back(item);
+                        }
+                    }
+                }
+            }
+
+            // update
+            for ( size_t n = 0 ; n < npvpq ; n++ )
+            {
+                dx[n] = -mis[pvpq[n]].Re();
+            }
+            for ( size_t n = 0 ; n < npq ; n++ )
+            {
+                dx[npvpq+n] = -mis[pq[n]].Im();
+            }
+            if ( ! sparse_solve(npvpq+npq,J,&dx[0]) )
+            {
+                return PNS_SINGULAR;
+            }
+            for ( size_t n = 0 ; n < npvpq ; n++ )
+            {
+                Va[pvpq[n]] += dx[n];
+            }
+            for ( size_t n = 0 ; n < npq ; n++ )
+            {
+                Vm[pq[n]] += dx[npvpq+n];
+            }
+            for ( size_t n = 0 ; n < nbus ; n++ )
+            {
+                V[n].SetPolar(Vm[n],Va[n]);
+            }
+            compute_mismatch(Y,V,S,I,mis);
+            converged = ( mismatch_norm(mis,pvpq,pq) < tolerance );
+        }
+    }
+    else
+    {
+        // fast-decoupled
+        YBUS Bp, Bpp;
+        int zero_r = ( method == 2 ? YB_NORESISTANCE : 0 );
+        build_ybus(Bp,index,base_MVA,nbus,bus,bus_cols,nbranch,branch,branch_cols,
+            YB_NOSHUNT|YB_NOCHARGING|YB_NOTAP|zero_r);
+        zero_r = ( method == 3 ? YB_NORESISTANCE : 0 );
+        build_ybus(Bpp,index,base_MVA,nbus,bus,bus_cols,nbranch,branch,branch_cols,
+            YB_NOSHIFT|zero_r);
+        std::vector<int> position_p(nbus,-1), position_q(nbus,-1);
+        for ( size_t n = 0 ; n < npvpq ; n++ )
+        {
+            position_p[pvpq[n]] = n;
+        }
+        for ( size_t n = 0 ; n < npq ; n++ )
+        {
+            position_q[pq[n]] = n;
+        }
+        // B' and B'' are constant so they are factored only once
+        std::vector<TRIPLET> Bp_entries, Bpp_entries;
+        SPARSEFACTOR Fp, Fpp;
+        reduced_susceptance(Bp,pvpq,position_p,Bp_entries);
+        reduced_susceptance(Bpp,pq,position_q,Bpp_entries);
+        bool factored = sparse_factor(Fp,npvpq,Bp_entries);
+        factored = sparse_factor(Fpp,npq,Bpp_entries) && factored;
+        std::vector<double> dVa(npvpq), dVm(npq);
+        converged = ( mismatch_norm(mis,pvpq,pq,&Vm) < tolerance );
+        while ( factored && ! converged && iteration < maximum_iterations )
+        {
+            iteration++;
+
+            // P iteration
+            for ( size_t n = 0 ; n < npvpq ; n++ )
+            {
+                dVa[n] = -mis[pvpq[n]].Re() / Vm[pvpq[n]];
+            }
+            if ( ! sparse_resolve(Fp,dVa.data()) )
+            {
+                factored = false;
+                break;
+            }
+            for ( size_t n = 0 ; n < npvpq ; n++ )
+            {
+                Va[pvpq[n]] += dVa[n];
+                V[pvpq[n]].SetPolar(Vm[pvpq[n]],Va[pvpq[n]]);
+            }
+            compute_mismatch(Y,V,S,I,mis);
+            if ( ( converged = ( mismatch_norm(mis,pvpq,pq,&Vm) < tolerance ) ) )
+            {
+                break;
+            }
+
+            // Q iteration
+            for ( size_t n = 0 ; n < npq ; n++ )
+            {
+                dVm[n] = -mis[pq[n]].Im() / Vm[pq[n]];
+            }
+            if ( ! sparse_resolve(Fpp,dVm.data()) )
+            {
+                factored = false;
+                break;
+            }
+            for ( size_t n = 0 ; n < npq ; n++ )
+            {
+                Vm[pq[n]] += dVm[n];
+                V[pq[n]].SetPolar(Vm[pq[n]],Va[pq[n]]);
+            }
+            compute_mismatch(Y,V,S,I,mis);
+            converged = ( mismatch_norm(mis,pvpq,pq,&Vm) < tolerance );
+        }
+        sparse_release(Fp);
+        sparse_release(Fpp);
+        if ( ! factored )
+        {
+            if ( iterations )
+            {
+                *iterations = iteration;
+            }
+            return PNS_SINGULAR;
+        }
+    }
+    if ( iterations )
+    {
+        *iterations = iteration;
+    }
+    if ( ! converged )
+    {
+        return PNS_DIVERGED;
+    }
+
+    // update bus voltages
+    for ( size_t n = 0 ; n < nbus ; n++ )
+    {
+        if ( angle_var[n] >= 0 || magnitude_var[n] >= 0 || std::find(ref.begin(),ref.end(),(int)n) != ref.end() )
+        {
+            bus[n*bus_cols+VM] = Vm[n];
+            bus[n*bus_cols+VA] = Va[n]*DEG;
+        }
+    }
+
+    // update generator reactive outputs (as MATPOWER pfsoln does, the
+    // reactive output at a bus is split in proportion to each generator's
+    // reactive range, or equally when the range is zero)
+    std::vector<bool> is_ref(nbus,false);
+    for ( std::vector<int>::iterator i = ref.begin() ; i != ref.end() ; i++ )
+    {
+        is_ref[*i] = true;
+    }
+    bool has_qlimits = ( gen_cols > QMIN );
+    std::vector<double> Qtotal(nbus,0.0), Qminimum(nbus,0.0), Qmaximum(nbus,0.0);
+    for ( size_t n = 0 ; n < ngen ; n++ )
+    {
+        double *row = gen + n*gen_cols;
+        int i = index[(int)row[GEN_BUS]];
+        if ( row[GEN_STATUS] <= 0 )
+        {
+            continue;
+        }
+        complex Sg = ( V[i] * ~I[i] ) * base_MVA + complex(bus[i*bus_cols+PD],bus[i*bus_cols+QD]);
+        row[QG] = Sg.Im() / ngen_on[i];
+        Qtotal[i] = Sg.Im();
+        if ( has_qlimits )
+        {
+            Qminimum[i] += row[QMIN];
+            Qmaximum[i] += row[QMAX];
+        }
+    }
+    for ( size_t n = 0 ; has_qlimits && n < ngen ; n++ )
+    {
+        double *row = gen + n*gen_cols;
+        int i = index[(int)row[GEN_BUS]];
+        if ( row[GEN_STATUS] > 0 && ngen_on[i] > 1 && Qmaximum[i] != Qminimum[i] )
+        {
+            row[QG] = row[QMIN] + ( Qtotal[i] - Qminimum[i] ) / ( Qmaximum[i] - Qminimum[i] + DBL_EPSILON ) * ( row[QMAX] - row[QMIN] );
+        }
+    }
+
+    // update real output of the first generator at REF buses
+    std::vector<bool> first(nbus,true);
+    std::vector<double> Pother(nbus,0.0);
+    for ( size_t n = 0 ; n < ngen ; n++ )
+    {
+        double *row = gen + n*gen_cols;
+        int i = index[(int)row[GEN_BUS]];
+        if ( row[GEN_STATUS] > 0 && is_ref[i] )
+        {
+            if ( ! first[i] )
+            {
+                Pother[i] += row[PG];
+            }
+            first[i] = false;
+        }
+    }
+    for ( size_t n = 0 ; n < ngen ; n++ )
+    {
+        double *row = gen + n*gen_cols;
+        int i = index[(int)row[GEN_BUS]];
+        if ( row[GEN_STATUS] > 0 && is_ref[i] )
+        {
+            complex Sg = ( V[i] * ~I[i] ) * base_MVA + complex(bus[i*bus_cols+PD],bus[i*bus_cols+QD]);
+            row[PG] = Sg.Re() - Pother[i];
+            is_ref[i] = false; // only the first generator takes up the slack
+        }
+    }
+    return PNS_SUCCESS;
+}
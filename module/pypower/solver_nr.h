@@ -0,0 +1,32 @@
+// module/pypower/solver_nr.h
+// Copyright (C) 2024 Regents of the Leland Stanford Junior University
+
+#ifndef _PYPOWER_SOLVER_NR_H
+#define _PYPOWER_SOLVER_NR_H
+
+#include <stdlib.h>
+
+typedef enum {
+    PNS_SUCCESS = 0, // solution found
+    PNS_NOREF = 1, // no REF or PV bus found
+    PNS_INVALID = 2, // invalid case data
+    PNS_SINGULAR = 3, // matrix factorization failed
+    PNS_DIVERGED = 4, // iteration limit reached
+} PYPOWERNATIVESTATUS;
+
+// Solve the AC powerflow using the native Newton-Raphson or fast-decoupled solver
+//
+// The bus, branch, and gen matrices are row-major MATPOWER case data.  On
+// success the bus Vm and Va values are updated and the gen Pg and Qg values
+// of the reference and PV buses are updated.
+PYPOWERNATIVESTATUS pypower_solve_nr(
+    int method, // 1=NR, 2=FD-XB, 3=FD-BX
+    double base_MVA,
+    size_t nbus, double *bus, size_t bus_cols,
+    size_t nbranch, const double *branch, size_t branch_cols,
+    size_t ngen, double *gen, size_t gen_cols,
+    int maximum_iterations, // 0 for default
+    double tolerance, // 0 for default
+    int *iterations = NULL); // iterations used (optional)
+
+#endif
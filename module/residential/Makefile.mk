@@ -13,6 +13,7 @@ module_residential_residential_la_SOURCES += module/residential/appliance.cpp mo
 module_residential_residential_la_SOURCES += module/residential/clotheswasher.cpp module/residential/clotheswasher.h
 module_residential_residential_la_SOURCES += module/residential/dishwasher.cpp module/residential/dishwasher.h
 module_residential_residential_la_SOURCES += module/residential/dryer.cpp module/residential/dryer.h
+module_residential_residential_la_SOURCES += module/residential/etp_population.cpp module/residential/etp_population.h
 module_residential_residential_la_SOURCES += module/residential/evcharger.cpp module/residential/evcharger_det.cpp
 module_residential_residential_la_SOURCES += module/residential/evcharger_det.h module/residential/evcharger.h
 module_residential_residential_la_SOURCES += module/residential/freezer.cpp module/residential/freezer.h
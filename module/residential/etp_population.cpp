@@ -0,0 +1,135 @@
+/** $Id: etp_population.cpp $
+	Copyright (C) 2008 Battelle Memorial Institute
+	@file etp_population.cpp
+	@addtogroup house_e
+	@{
+ **/
+
+#include <math.h>
+#include "residential.h"
+#include "etp_population.h"
+
+std::vector<etp_population*> etp_population::populations;
+bool *etp_population::event_scheduler = NULL;
+
+etp_population::etp_population(double *Tout)
+{
+	pTout = Tout;
+	curves_valid = false;
+}
+
+etp_population *etp_population::attach(OBJECT *obj, double *Tout, unsigned int &index)
+{
+	etp_population *pop = NULL;
+	for ( std::vector<etp_population*>::iterator p = populations.begin() ; p != populations.end() ; p++ )
+	{
+		if ( (*p)->pTout == Tout )
+		{
+			pop = *p;
+			break;
+		}
+	}
+	if ( pop == NULL )
+	{
+		if ( event_scheduler == NULL )
+		{
+			GLOBALVAR *var = gl_global_find("event_scheduler");
+			if ( var != NULL )
+				event_scheduler = (bool*)var->prop->addr;
+		}
+		pop = new etp_population(Tout);
+		populations.push_back(pop);
+	}
+	index = (unsigned int)pop->clock.size();
+	pop->clock.push_back(obj->clock);
+	pop->next.push_back(TS_ZERO);
+	pop->k1.push_back(0);
+	pop->r1.push_back(0);
+	pop->k2.push_back(0);
+	pop->r2.push_back(0);
+	pop->valid.push_back(0);
+	pop->e1.push_back(0);
+	pop->e2.push_back(0);
+	pop->t0.push_back(TS_NEVER);
+	pop->t1.push_back(TS_NEVER);
+	return pop;
+}
+
+void etp_population::advance_all(TIMESTAMP t)
+{
+	for ( std::vector<etp_population*>::iterator p = populations.begin() ; p != populations.end() ; p++ )
+		(*p)->advance(t);
+}
+
+void etp_population::advance(TIMESTAMP t)
+{
+	// same expressions as house_e::update_system
+	const double Tout = *pTout;
+	if ( !curves_valid || curves.Tout != Tout )
+	{
+		const double Th = ( Tout > 80 ? 80 : Tout );
+		const double Tc = ( Tout < 40 ? 40 : Tout );
+		curves.Tout = Tout;
+		curves.heating_cop = 2.03914613 - 0.03906753*Th + 0.00045617*Th*Th - 0.00000203*Th*Th*Th;
+		curves.cooling_cop = -0.01363961 + 0.01066989*Tc;
+		curves.heating_capacity = 0.34148808 + 0.00894102*Tout + 0.00010787*Tout*Tout;
+		curves.cooling_capacity = 1.48924533 - 0.00514995*Tout;
+		curves_valid = true;
+	}
+
+	// the event scheduler only syncs houses whose next event is due (a house that
+	// could not predict its next event is synced every timestep)
+	const bool skipping = ( event_scheduler != NULL && *event_scheduler );
+	const size_t n = clock.size();
+	const TIMESTAMP *clk = &clock[0], *nxt = &next[0];
+	const double *K1 = &k1[0], *R1 = &r1[0], *K2 = &k2[0], *R2 = &r2[0];
+	const unsigned char *ok = &valid[0];
+	double *E1 = &e1[0], *E2 = &e2[0];
+	TIMESTAMP *T0 = &t0[0], *T1 = &t1[0];
+	for ( size_t i = 0 ; i < n ; i++ )
+	{
+		// same interval the house's presync will see (see sync_house)
+		TIMESTAMP ts = clk[i] <= ROUNDOFF ? t : clk[i];
+		const double dt = (double)((t-ts)*TS_SECOND)/3600;
+		const TIMESTAMP tn = ( nxt[i] < 0 ? -nxt[i] : nxt[i] );
+		if ( T0[i] == ts && T1[i] == t )
+			continue; // already advanced over this interval
+		else if ( ts > 0 && dt > 0 && ok[i] && ( !skipping || tn <= t || nxt[i] == TS_NEVER ) )
+		{
+			E1[i] = K1[i]*exp(R1[i]*dt);
+			E2[i] = K2[i]*exp(R2[i]*dt);
+			T0[i] = ts;
+			T1[i] = t;
+		}
+		else
+			T1[i] = TS_NEVER;
+	}
+}
+
+void etp_population::set_model(unsigned int index, double K1, double R1, double K2, double R2, bool ok)
+{
+	k1[index] = K1;
+	r1[index] = R1;
+	k2[index] = K2;
+	r2[index] = R2;
+	valid[index] = ok ? 1 : 0;
+	// decay terms computed from the old constants no longer apply
+	t1[index] = TS_NEVER;
+}
+
+bool etp_population::get_decay(unsigned int index, TIMESTAMP T0, TIMESTAMP T1, double &E1, double &E2)
+{
+	if ( t1[index] != T1 || t0[index] != T0 )
+		return false;
+	E1 = e1[index];
+	E2 = e2[index];
+	return true;
+}
+
+const ETPCURVES *etp_population::get_curves(void) const
+{
+	// the climate may update the temperature after the population is advanced
+	return ( curves_valid && curves.Tout == *pTout ) ? &curves : NULL;
+}
+
+/**@}**/
@@ -0,0 +1,71 @@
+// etp_population.h
+//	Copyright (C) 2008 Battelle Memorial Institute
+//
+// Population-level ETP state for houses sharing a climate
+//
+// When residential::etp_population is set, each house registers with the
+// population of houses that read the same outdoor temperature.  The
+// population keeps the ETP solution constants and a copy of each house's
+// clock in contiguous arrays so the thermal decay terms of all houses are
+// advanced in one pass at the start of each iteration, before the houses'
+// own presync runs, without touching the house objects.  Only houses whose
+// next event is due are advanced when the event scheduler may skip the
+// others.  The HVAC performance curves, which depend only on the outdoor
+// temperature, are evaluated in the same pass and only read by the houses.
+
+#ifndef _ETP_POPULATION_H
+#define _ETP_POPULATION_H
+
+#include <vector>
+#include "gridlabd.h"
+
+/// Outdoor temperature adjustments of the default HVAC performance curves
+typedef struct s_etp_curves {
+	double Tout; ///< outdoor temperature the curves were evaluated at
+	double heating_cop; ///< divisor of heating_COP (heating_cop_curve=DEFAULT)
+	double cooling_cop; ///< divisor of cooling_COP (cooling_cop_curve=DEFAULT)
+	double heating_capacity; ///< factor of design_heating_capacity (heating_cap_curve=DEFAULT)
+	double cooling_capacity; ///< factor of design_cooling_capacity (cooling_cap_curve=DEFAULT)
+} ETPCURVES;
+
+class etp_population {
+private:
+	static std::vector<etp_population*> populations;
+	double *pTout; ///< outdoor temperature shared by the population
+	ETPCURVES curves;
+	bool curves_valid;
+	static bool *event_scheduler; ///< global event_scheduler flag
+	// structure of arrays, one entry per house
+	std::vector<TIMESTAMP> clock; ///< house clocks, as the houses set them after each sync
+	std::vector<TIMESTAMP> next; ///< next event of each house, as returned by its sync
+	std::vector<double> k1, r1, k2, r2; ///< ETP decay constants from update_model
+	std::vector<unsigned char> valid; ///< decay constants are usable (c2!=0)
+	std::vector<double> e1, e2; ///< decay terms advanced to t1
+	std::vector<TIMESTAMP> t0, t1; ///< interval the decay terms cover
+private:
+	etp_population(double *Tout);
+	void advance(TIMESTAMP t);
+public:
+	/** Register a house with the population of its climate
+		@return the index of the house in the population
+	 **/
+	static etp_population *attach(OBJECT *obj, double *Tout, unsigned int &index);
+	/** Advance every population to time t (called from the module's on_presync) **/
+	static void advance_all(TIMESTAMP t);
+	/** Store the clock of a house, which the house sets to t after its sync passes **/
+	inline void set_clock(unsigned int index, TIMESTAMP t) { clock[index] = t; };
+	/** Store the next event of a house, as its sync returns it **/
+	inline void set_next(unsigned int index, TIMESTAMP t) { next[index] = t; };
+	/** Store the decay constants of a house after its model is updated **/
+	void set_model(unsigned int index, double k1, double r1, double k2, double r2, bool valid);
+	/** Retrieve the decay terms of a house for the interval (t0,t1)
+		@return true if the population advanced the house over that interval
+	 **/
+	bool get_decay(unsigned int index, TIMESTAMP t0, TIMESTAMP t1, double &e1, double &e2);
+	/** Get the default HVAC curve adjustments at the current outdoor temperature
+		@return NULL if the temperature changed since the population was advanced
+	 **/
+	const ETPCURVES *get_curves(void) const;
+};
+
+#endif
@@ -56,6 +56,7 @@
 
 #include "house_e.h"
 #include "freezer.h"
+#include "solvers.h"
 
 //////////////////////////////////////////////////////////////////////////
 // underground_line_conductor CLASS FUNCTIONS
@@ -137,6 +138,7 @@ int freezer::init(OBJECT *parent)
 
 	OBJECT *hdr = THISOBJECTHDR;
 	hdr->flags |= OF_SKIPSAFE;
+	hdr->flags |= OF_COALESCE; // thermostat events may be delayed by event_tolerance
 
 	
 	pTempProp = gl_get_property(parent, "air_temperature");
@@ -263,11 +265,14 @@ TIMESTAMP freezer::sync(TIMESTAMP t0, TIMESTAMP t1)
 	}
 
 	// compute constants
-	// const double C1 = Cf/(UAr+UAf);
-	// const double C2 = Tout - Qr/UAr;
+	const double C1 = Cf/(UAr+UAf);
+	const double C2 = Tout - Qr/UAr;
 	
 	// compute time to next internal event
 	// dt = t = -log((Tevent - C2)/(Tair-C2))*C1;
+	t = e2solve(Tair-C2,-1/C1,0,0,C2-Tevent);
+	if ( isnan(t) ) // event temperature cannot be reached in this motor state
+		return TS_NEVER;
 
 	if(t == 0){
 		GL_THROW("freezer control logic error, dt = 0");
@@ -1110,6 +1110,8 @@ int house_e::create()
 	last_temperature = 75;
 	default_frequency = 60.0;
 	error_flag = 0;
+	population = NULL;
+	population_index = 0;
 
 	return result;
 }
@@ -1614,6 +1616,7 @@ int house_e::init(OBJECT *parent)
 	}
 	OBJECT *hdr = THISOBJECTHDR;
 	hdr->flags |= OF_SKIPSAFE;
+	hdr->flags |= OF_COALESCE; // thermostat events may be delayed by event_tolerance
 
 	heat_start = false;
 
@@ -2019,6 +2022,11 @@ int house_e::init(OBJECT *parent)
 	else 
 		load.power_factor = hvac_power_factor;
 
+	// join the ETP population of this climate
+	extern bool etp_population_enable;
+	if ( etp_population_enable )
+		population = etp_population::attach(obj,pTout,population_index);
+
 	// connect any implicit loads
 	attach_implicit_enduses();
 	update_system();
@@ -2341,6 +2349,8 @@ void house_e::update_model(double dt)
 	k1 = (r2*Tair - r2*Teq - dTa)/(r2-r1);
 	k2 = Tair - Teq - k1;
 	//printf("update model %f %f %f\n",Tair,Teq,k1);
+	if ( population!=NULL )
+		population->set_model(population_index,k1,r1,k2,r2,c2!=0);
 
 }
 
@@ -2367,8 +2377,14 @@ void house_e::update_system(double dt)
 	double cooling_capacity_adj=0;
 	double temp_c;
 	temp_c = 5*((*pTout) - 32)/9;
+
+	// the default curves depend only on the outdoor temperature, so the population evaluates them once for all its houses
+	const ETPCURVES *curves = ( population!=NULL ? population->get_curves() : NULL );
 	
-	if(heating_cop_curve == HC_DEFAULT){
+	if(heating_cop_curve == HC_DEFAULT && curves!=NULL){
+		heating_cop_adj = heating_COP / curves->heating_cop;
+	}
+	else if(heating_cop_curve == HC_DEFAULT){
 		if(*pTout > 80){
 			temp_temperature = 80;
 			heating_cop_adj = heating_COP / (2.03914613 - 0.03906753*temp_temperature + 0.00045617*temp_temperature*temp_temperature - 0.00000203*temp_temperature*temp_temperature*temp_temperature);
@@ -2391,7 +2407,10 @@ void house_e::update_system(double dt)
 		error_flag = 1;
 	}
 
-	if(cooling_cop_curve == CC_DEFAULT){
+	if(cooling_cop_curve == CC_DEFAULT && curves!=NULL){
+		cooling_cop_adj = cooling_COP / curves->cooling_cop;
+	}
+	else if(cooling_cop_curve == CC_DEFAULT){
 		if(*pTout < 40){
 			temp_temperature = 40;
 			cooling_cop_adj = cooling_COP / (-0.01363961 + 0.01066989*temp_temperature);
@@ -2436,7 +2455,10 @@ void house_e::update_system(double dt)
 
 	//double heating_capacity_adj = design_heating_capacity*(0.34148808 + 0.00894102*(*pTout) + 0.00010787*(*pTout)*(*pTout)); 
 	//double cooling_capacity_adj = design_cooling_capacity*(1.48924533 - 0.00514995*(*pTout));
-	if(heating_cap_curve == HP_DEFAULT){
+	if(heating_cap_curve == HP_DEFAULT && curves!=NULL){
+		heating_capacity_adj = design_heating_capacity*curves->heating_capacity;
+	}
+	else if(heating_cap_curve == HP_DEFAULT){
 		heating_capacity_adj = design_heating_capacity*(0.34148808 + 0.00894102*(*pTout) + 0.00010787*(*pTout)*(*pTout));
 	}
 	if(heating_cap_curve == HP_FLAT){
@@ -2451,7 +2473,10 @@ void house_e::update_system(double dt)
 		error_flag = 1;
 	}
 
-	if(cooling_cap_curve == CP_DEFAULT){
+	if(cooling_cap_curve == CP_DEFAULT && curves!=NULL){
+		cooling_capacity_adj = design_cooling_capacity*curves->cooling_capacity;
+	}
+	else if(cooling_cap_curve == CP_DEFAULT){
 		cooling_capacity_adj = design_cooling_capacity*(1.48924533 - 0.00514995*(*pTout));
 	}
 	if(cooling_cap_curve == CP_FLAT){
@@ -2761,9 +2786,13 @@ TIMESTAMP house_e::presync(TIMESTAMP t0, TIMESTAMP t1)
 		/* calculate model update, if possible */
 		if (c2!=0)
 		{
-			/* update temperatures */
-			const double e1 = k1*exp(r1*dt);
-			const double e2 = k2*exp(r2*dt);
+			/* update temperatures (use the population's decay terms when it has advanced this house) */
+			double e1, e2;
+			if ( population==NULL || !population->get_decay(population_index,t0,t1,e1,e2) )
+			{
+				e1 = k1*exp(r1*dt);
+				e2 = k2*exp(r2*dt);
+			}
 			Tair = e1 + e2 + Teq;
 			if (window_open == 1)
 				Tmaterials = A3*e1 + A4*e2 + Qm/Hm + (Qm+Qa)/(10*Ua) + Tout;
@@ -3085,6 +3114,8 @@ TIMESTAMP house_e::sync(TIMESTAMP t0, TIMESTAMP t1)
 	}
 	//output("glsovers returns %f.",dt2);
 	//Update the off-return value
+	if ( population!=NULL )
+		population->set_next(population_index,t2);
 	return t2;
 }
 
@@ -3117,6 +3148,10 @@ TIMESTAMP house_e::postsync(TIMESTAMP t0, TIMESTAMP t1)
 	if (obj->parent != NULL)
 		wunlock(obj->parent);
 
+	// sync_house sets the clock to t1 after this pass
+	if ( population!=NULL )
+		population->set_clock(population_index,t1);
+
 	TIMESTAMP rv = paneldump_interval>0 ? ((gl_globalclock/paneldump_interval)+1)*paneldump_interval : TS_NEVER;
 	debug("house postsync based on paneldump_interval=%lld --> %lld", paneldump_interval, rv);
 	return rv;
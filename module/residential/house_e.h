@@ -15,6 +15,7 @@
 #include "enduse.h"
 #include "loadshape.h"
 #include "residential_enduse.h"
+#include "etp_population.h"
 
 DECL_METHOD(house_e,smart_breaker);
 
@@ -478,6 +479,9 @@ private:
 	bool deltamode_inclusive;	//Boolean for deltamode calls - pulled from object flags
 	bool deltamode_registered;	//Boolean for deltamode registration -- basically a "first run" flag
 
+	etp_population *population;	//Shared ETP population (NULL unless residential::etp_population is set)
+	unsigned int population_index;	//Index of this house in the population arrays
+
 public:
 	int error_flag;
 	static CLASS *oclass, *pclass;
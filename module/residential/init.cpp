@@ -11,6 +11,7 @@
 #include <errno.h>
 #include <math.h>
 #include "residential.h"
+#include "solvers.h"
 
 // obsolete as of 3.0: #include "house_a.h"
 #include "appliance.h"
@@ -46,6 +47,7 @@ double default_outdoor_temperature = 74.0;
 double default_humidity = 75.0;
 double default_solar[9] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
 int64 default_etp_iterations = 100;
+bool etp_population_enable = false;	/* advance the ETP models of houses sharing a climate together */
 
 //Deltamode inclusion
 bool enable_subsecond_models = false; 				/* normally not operating in delta mode */
@@ -78,6 +80,7 @@ EXPORT CLASS *init(CALLBACKS *fntable, MODULE *module, int argc, char *argv[])
 	gl_global_create("residential::default_humidity",PT_double,&default_humidity,PT_UNITS,"%",PT_DESCRIPTION,"humidity when no climate data is found",NULL);
 	gl_global_create("residential::default_solar",PT_double,&default_solar,PT_SIZE,9,PT_UNITS,"Btu/sf",PT_DESCRIPTION,"solar gains when no climate data is found",NULL);
 	gl_global_create("residential::default_etp_iterations",PT_int64,&default_etp_iterations,PT_DESCRIPTION,"number of iterations ETP solver will run",NULL);
+	gl_global_create("residential::etp_population",PT_bool,&etp_population_enable,PT_DESCRIPTION,"enable population-level ETP updates of houses sharing a climate",NULL);
 	gl_global_create("residential::ANSI_voltage_check",PT_bool,&ANSI_voltage_check,PT_DESCRIPTION,"enable or disable messages about ANSI voltage limit violations in the house",NULL);
 	gl_global_create("residential::enable_subsecond_models", PT_bool, &enable_subsecond_models,PT_DESCRIPTION,"Enable deltamode capabilities within the residential module",NULL);
 	gl_global_create("residential::deltamode_timestep", PT_double, &deltamode_timestep_publish,PT_UNITS,"ns",PT_DESCRIPTION,"Desired minimum timestep for deltamode-related simulations",NULL);
@@ -107,6 +110,13 @@ EXPORT CLASS *init(CALLBACKS *fntable, MODULE *module, int argc, char *argv[])
 	return residential_enduse::oclass;
 }
 
+EXPORT TIMESTAMP on_presync(TIMESTAMP t)
+{
+	if ( etp_population_enable )
+		etp_population::advance_all(t);
+	return TS_NEVER;
+}
+
 EXPORT void term(void)
 {
 	extern FILE *paneldump_fh;
@@ -416,5 +426,11 @@ EXPORT int check(){
 	return 0;
 }
 
+EXPORT void test(int argc, char *argv[])
+{
+	int failed = e2solve_test();
+	gl_output("residential e2solve test %s (%d failures)", failed==0 ? "passed" : "failed", failed);
+}
+
 
 /**@}**/
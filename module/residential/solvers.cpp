@@ -4,56 +4,64 @@
 
 #define USE_GLSOLVERS
 #include "gridlabd.h"
+#include "solvers.h"
 
 #ifdef USE_NEWSOLVER
 
-double a=0,n=0,b=0,m=0,c=0;
+#define E2SOLVE_MAXITER 32
 
-double ft(double t)
+typedef struct {
+	unsigned int n; // dimensions (default 1)
+	double *x; // current values of x
+	double (**f)(double,void*); // functions
+	double (**df)(double,void*); // derivatives
+	double *p; // precision
+	unsigned int *m; // multiplicities (default is 1)
+	unsigned char *s; // status (0=failed, 1=converge, 2=non-converged)
+	void *context; // caller data passed to the functions
+	unsigned int i; // maximum iterations
+} NMDATA;
+
+typedef struct {
+	double a,n,b,m,c;
+} E2DATA;
+
+static double ft(double t, void *context)
 {
-	return a*exp(t*n) + b*exp(t*m) + c;
+	E2DATA *k = (E2DATA*)context;
+	return k->a*exp(t*k->n) + k->b*exp(t*k->m) + k->c;
 }
-double dfdt(double t)
+static double dfdt(double t, void *context)
 {
-	return a*n*exp(t*n) + b*m*exp(t*m);
+	E2DATA *k = (E2DATA*)context;
+	return k->a*k->n*exp(t*k->n) + k->b*k->m*exp(t*k->m);
+}
+static gld_solver *load_newton_method(void)
+{
+	gld_solver *solver = new gld_solver("newton_method");
+	unsigned int version=0;
+	if ( solver->get("solver_version",&version,NULL)==0 || version!=2 )
+		throw "newton_method version incorrect";
+	return solver;
 }
 double e2solve(double _a, double _n, double _b, double _m, double _c, double p, double *e)
 {
-	static glsolver *newton_method = NULL;
-	static struct {
-		unsigned int n; // dimensions (default 1)
-		double *x; // current values of x
-		double (**f)(double); // functions
-		double (**df)(double); // derivatives
-		double *p; // precision
-		unsigned int *m; // multiplicities (default is 1)
-		unsigned char *s; // status (0=failed, 1=converge, 2=non-converged)
-	} data;
-
-	// load the solver if not yet loaded
-	if ( newton_method==NULL )
-	{
-		newton_method = new glsolver("newton_method");
-		unsigned int version=0;
-		if ( newton_method->get("version",&version,NULL)==0 || version!=1 )
-			throw "newton_method version incorrect";
-		if ( newton_method->set("dimensions",1,NULL)==0 )
-			throw "newton_method dimensions can't be set";
-		if ( newton_method->get("init",&data,NULL)==0 )
-			throw "newton_method data can't be obtained";
-		data.f[0] = ft;
-		data.df[0] = dfdt;
-	}
+	// loaded once; the solver keeps no other state so e2solve is reentrant
+	static gld_solver *newton_method = load_newton_method();
 
 	// solve it
-	data.x[0] = 0.0;
-	data.p[0] = p;
-	a=_a; b=_b; c=_c; n=_n; m=_m; 
-	if ( newton_method->solve(&data) )
+	E2DATA k = {_a,_n,_b,_m,_c};
+	double x = 0.0;
+	double (*f)(double,void*) = ft;
+	double (*df)(double,void*) = dfdt;
+	unsigned int mult = 1;
+	unsigned char status = 1;
+	NMDATA data = {1,&x,&f,&df,&p,&mult,&status,&k,E2SOLVE_MAXITER};
+	if ( newton_method->solve(&data)==1 )
 	{
 		if ( e!=NULL )
-			*e = data.x[0] / dfdt(data.x[0]);
-		return data.x[0];
+			*e = x / dfdt(x,&k);
+		return x;
 	}
 	else
 		return NaN;
@@ -61,41 +69,183 @@ double e2solve(double _a, double _n, double _b, double _m, double _c, double p,
 
 #else
 
-double e2solve(double a, double n, double b, double m, double c, double p, double *e)
+#define EVAL(t,a,n,b,m,c) (a*exp(n*t) + b*exp(m*t) + c)
+
+// bracketed Newton steps converge in under 20 iterations on any solvable case
+#define E2SOLVE_MAXITER 32
+
+/** solve an equation of the form $f[ ae^{nt} + be^{mt} + c = 0 $f]
+
+	The solver keeps no state between calls so it may be used by objects synchronizing 
+	on different threads.  The case analysis of the ETP solver finds the first crossing 
+	and a starting point from which Newton's method approaches it monotonically.  The
+	Newton steps are bracketed by the last points on either side of the crossing, so
+	a step that overshoots falls back to bisection (or to extending the search when
+	no upper bound is known yet) and the iteration count stays small.  The count is
+	capped at E2SOLVE_MAXITER, or at residential::default_etp_iterations if lower.
+
+	@returns the solution in $f[ t $f], or NaN if none found
+ **/
+double e2solve(double a,/**< the parameter \p a */
+	double n,	/**< the parameter \p n (should be negative) */
+	double b,	/**< the parameter \p b */
+	double m,	/**< the parameter \p m (should be negative) */
+	double c,	/**< the constant \p c */
+	double p,	/**< the precision (1e-8 if omitted) */
+	double *e)	/**< pointer to error estimate (null if none desired) */
 {
-	// load the solver if not yet loaded
-	static gld_solver *etp = NULL;
-	static struct etpdata {
-		double t,a,n,b,m,c,p,e;
-		unsigned int i;
-	} data;
-	if ( etp==NULL )
+	extern int64 default_etp_iterations;
+	double t = 0;
+	double f = EVAL(t,a,n,b,m,c);
+
+	// check for degenerate cases (1 exponential term is dominant)
+	// solve for t in dominant exponential, but only when a solution exists
+	// (c must be opposite sign of scalar and have less magnitude than scalar)
+	if ( fabs(a/b) < p )
 	{
-		etp = new gld_solver("etp");
-		int version;
-		if ( etp->get("version",&version,NULL)==0 || version!=1 )
-			throw "incorrect ETP solver version";
-		if ( etp->get("init",&data,NULL)==0 )
-			throw "unable to initialize ETP solver data";
-		data.i = 100;
+		// b is dominant
+		return c*b<0 && fabs(c)<fabs(b) ? log(-c/b)/m : NaN;
+	}
+	else if ( fabs(b/a) < p )
+	{
+		// a is dominant
+		return c*a<0 && fabs(c)<fabs(a) ? log(-c/a)/n : NaN;
 	}
 
-	// solve it
-	data.t = 0;
-	data.a = a;
-	data.b = b;
-	data.c = c;
-	data.n = n;
-	data.m = m;
-	data.p = p;
-	if ( etp->solve(&data) )
+	// bracket of the crossing (hi is unbounded until a point past the crossing is found)
+	double lo = 0, hi = INFINITY;
+
+	// is there an extremum/inflexion to consider
+	if ( a*b < 0 )
 	{
-		if ( e!=NULL )
-			*e = data.e;
-		return data.t;
+		// compute the times tm and ti at which they occur
+		double an_bm = -a*n/(b*m);
+		double tm = log(an_bm)/(m-n);
+		double fm = EVAL(tm,a,n,b,m,c);
+		double ti = log(an_bm*n/m)/(m-n);
+		if ( tm > 0 ) // extremum in domain
+		{
+			if ( f*fm < 0 )
+			{
+				// first solution is in range
+				t = 0;
+				hi = tm;
+			}
+			else if ( c*fm < 0 )
+			{
+				// second solution is in range
+				t = ti;
+				lo = tm;
+			}
+			else
+			{
+				// no solution is in range
+				return NaN;
+			}
+		}
+		else if ( tm < 0 && ti > 0 )
+		{
+			// no extremum but inflexion in domain (f is monotonic from t=0)
+			if ( f*c < 0 )
+				t = ti;
+			else
+				return NaN;
+		}
+		else if ( ti < 0 ) 
+		{
+			// no extremum or inflexion in domain (f is monotonic from t=0)
+			if ( f*c < 0 )
+				t = 0;
+			else
+				return NaN;
+		}
+		else
+		{
+			// no solution possible (includes tm==0 and ti==0)
+			return NaN;
+		}
 	}
-	else
+	else if ( f*c > 0 )
+	{
+		// solution is not reachable from t=0 (same sign)
 		return NaN;
+	}
+
+	// sign of f before the crossing
+	const double s = EVAL(lo,a,n,b,m,c);
+
+	// slowest time constant, used to extend the search when the bracket is open
+	const double tau = 1/fmax(fmin(fabs(n),fabs(m)),1e-9);
+
+	// solve using bracketed Newton's method
+	if ( t != 0 ) // initial t changed to inflexion point
+		f = EVAL(t,a,n,b,m,c);
+	double dfdt = EVAL(t,a*n,n,b*m,m,0);
+	int64 iter = default_etp_iterations < E2SOLVE_MAXITER ? default_etp_iterations : E2SOLVE_MAXITER;
+	while ( fabs(f) > p && iter-- > 0 )
+	{
+		// narrow the bracket
+		if ( f*s > 0 )
+			lo = t;
+		else
+			hi = t;
+
+		// take the Newton step unless it leaves the bracket
+		double tn = t - f/dfdt;
+		if ( !(tn > lo && tn < hi) )
+			tn = isfinite(hi) ? (lo+hi)/2 : 2*lo + tau;
+		t = tn;
+		f = EVAL(t,a,n,b,m,c);
+		dfdt = EVAL(t,a*n,n,b*m,m,0);
+	}
+	if ( fabs(f) > p )
+	{
+		gl_error("e2solve(a=%.4f,n=%.4f,b=%.4f,m=%.4f,c=%.4f,prec=%.g) failed to converge",a,n,b,m,c,p);
+		return NaN;
+	}
+	if ( e != NULL )
+		*e = p/dfdt;
+	return t>0 ? t : NaN;
 }
 
 #endif
+
+/** test e2solve on cases whose first crossing is known (run by gridlabd --modtest residential)
+	@returns the number of cases that failed
+ **/
+int e2solve_test(void)
+{
+	static const struct {
+		const char *name;
+		double a,n,b,m,c;
+		double t; // first crossing (NaN if none)
+	} cases[] = {
+		{"single exponential", 10,-0.5, 0,0, -5, 2*log(2.0)},
+		{"monotonic", 1,-1, 1,-2, -0.5, -log((sqrt(3.0)-1)/2)},
+		{"bracketed by the extremum", -1,-1, 2,-2, 0.1, -log((1+sqrt(0.2))/4)},
+		{"near tangent at the extremum", -1,-1, 2,-2, 0.125-1e-6, -log((1+sqrt(8e-6))/4)},
+		{"inflexion in domain", 3,-1, -1,-2, -1.5, -log((3-sqrt(3.0))/2)},
+		{"no root past the extremum", -1,-1, 2,-2, 0.2, NaN},
+		{"no root from a monotonic start", 3,-1, -1,-2, -2.2, NaN},
+		{"no root with same signs", 1,-1, 1,-2, 0.5, NaN},
+	};
+	int failed = 0;
+	for ( size_t i = 0 ; i < sizeof(cases)/sizeof(cases[0]) ; i++ )
+	{
+		double t = e2solve(cases[i].a,cases[i].n,cases[i].b,cases[i].m,cases[i].c);
+		if ( isnan(t) != isnan(cases[i].t) || ( !isnan(t) && fabs(t-cases[i].t) > 1e-4 ) )
+		{
+			gl_error("e2solve test '%s' failed: t=%g, expected %g",cases[i].name,t,cases[i].t);
+			failed++;
+		}
+	}
+
+	// the extremum touches zero at t=ln(4), so either no crossing or the tangent point is acceptable
+	double t = e2solve(-1,-1,2,-2,0.125);
+	if ( !isnan(t) && fabs(t-log(4.0)) > 1e-3 )
+	{
+		gl_error("e2solve test 'tangent at the extremum' failed: t=%g, expected %g or nan",t,log(4.0));
+		failed++;
+	}
+	return failed;
+}
@@ -8,6 +8,10 @@
 #ifndef _SOLVERS_H
 #define _SOLVERS_H
 
+// solves a*exp(n*t) + b*exp(m*t) + c = 0 for the first t>0 (NaN if none); reentrant
 double e2solve( double a,double n,double b,double m,double c,double p=1e-8,double *e=NULL);
 
+// tests e2solve on cases with known solutions; returns the number of failures
+int e2solve_test(void);
+
 #endif
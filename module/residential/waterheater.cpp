@@ -237,6 +237,7 @@ int waterheater::init(OBJECT *parent)
 	}
 
 	hdr->flags |= OF_SKIPSAFE;
+	hdr->flags |= OF_COALESCE; // thermostat events may be delayed by event_tolerance
 
 	static double sTair = 74;
 	static double sTout = 68;
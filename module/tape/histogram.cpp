@@ -70,6 +70,10 @@ histogram::histogram(MODULE *mod)
 		group_list = NULL;
 		binctr = NULL;
 		prop_ptr = NULL;
+		comp_part = CP_NONE;
+		member_count = 0;
+		member_addr = NULL;
+		sample = NULL;
 		next_count = t_count = next_sample = t_sample = TS_ZERO;
 		strcpy(mode, "file");
 		flags[0]='w';
@@ -362,6 +366,9 @@ int histogram::init(OBJECT *parent)
 		return 0;
 	}
 
+	if(resolve_members(prop) == 0)
+		return 0;
+
 	/* open file ~ copied from recorder.c */
 		/* if prefix is omitted (no colons found) */
 //	if (sscanf(filename,"%32[^:]:%1024[^:]:%[^:]",ftype,fname,flags)==1)
@@ -386,104 +393,144 @@ int histogram::init(OBJECT *parent)
 	return ops->open(this, fname, flags);
 }
 
-int histogram::feed_bins(OBJECT *obj)
+/**
+ *	Resolves the address of the sampled property in every member object once,
+ *	so that each sample is a straight gather over a contiguous pointer array.
+ *	@param prop the sampled property of the parent, or of any group member
+ *	@note for a group, every member must match the property type of the first member
+ *	@return 1 on success, 0 on error
+ */
+int histogram::resolve_members(PROPERTY *prop)
+{
+	OBJECT *obj = THISOBJECTHDR;
+
+	sample_type = prop->ptype;
+	member_count = ( group_list == NULL ? 1 : group_list->hit_count );
+	member_addr = (void **)gl_malloc(sizeof(void*) * member_count);
+	sample = (double *)gl_malloc(sizeof(double) * member_count);
+	if(member_addr == NULL || sample == NULL){
+		gl_error("Histogram malloc error: unable to alloc %i members for %s", member_count, obj->name ? obj->name : "(anon. histogram)");
+		return 0;
+	}
+	memset(sample, 0, sizeof(double) * member_count);
+
+	if(group_list == NULL){
+		member_addr[0] = GETADDR(obj->parent, prop);
+	} else {
+		OBJECT *member = NULL;
+		int n = 0;
+		while( n < member_count && (member = gl_find_next(group_list, member)) != NULL )
+		{
+			PROPERTY *p = gl_find_property(member->oclass, property.get_string());
+			if(n == 0 && p != NULL)
+				sample_type = p->ptype;
+			if(p == NULL || p->ptype != sample_type){
+				gl_error("Histogram group member '%s' property '%s' does not match the type of the other group members", member->name ? member->name : "(anon)", property.get_string());
+				return 0;
+			}
+			member_addr[n++] = GETADDR(member, p);
+		}
+		member_count = n;
+	}
+	return 1;
+}
+
+/**
+ *	Copies the current value of every member into the sample array.
+ *	@return 1 if the samples can be binned, 0 if the property type is not supported
+ */
+int histogram::gather_samples(void)
 {
-	double value = 0.0;
-	complex cval = 0.0; //gl_get_complex(obj, ;
-	int64 ival = 0;
-	int i = 0;
+	int i;
 
-	switch(prop_ptr->ptype){
+	switch(sample_type){
 		case PT_complex:
-			cval = (prop_ptr ? *gl_get_complex(obj, prop_ptr) : *gl_get_complex_by_name(obj, property) );
-			switch(this->comp_part){
+			switch(comp_part){
 				case REAL:
-					value = cval.Re();
+					for(i = 0; i < member_count; ++i)
+						sample[i] = ((complex *)member_addr[i])->Re();
 					break;
 				case IMAG:
-					value = cval.Im();
+					for(i = 0; i < member_count; ++i)
+						sample[i] = ((complex *)member_addr[i])->Im();
 					break;
 				case MAG:
-					value = cval.Mag();
+					for(i = 0; i < member_count; ++i)
+						sample[i] = ((complex *)member_addr[i])->Mag();
 					break;
 				case ANG:
-					value = cval.Arg();
+					for(i = 0; i < member_count; ++i)
+						sample[i] = ((complex *)member_addr[i])->Arg();
 					break;
 				default:
-					gl_error("Complex property with no part defined in %s", (obj->name ? obj->name : "(unnamed)"));
+					{
+						OBJECT *obj = THISOBJECTHDR;
+						gl_error("Complex property with no part defined in %s", (obj->name ? obj->name : "(unnamed)"));
+					}
+					memset(sample, 0, sizeof(double) * member_count);
+					break;
 			}
-			ival = 1;
-			/* fall through */
+			break;
 		case PT_double:
-			if(ival == 0) 
-				value = (prop_ptr ? *gl_get_double(obj, prop_ptr) : *gl_get_double_by_name(obj, property.get_string()) );
-			for(i = 0; i < bin_count; ++i){
-				if(value > bin_list[i].low_val && value < bin_list[i].high_val){
-					++binctr[i];
-				} else if(bin_list[i].low_inc && bin_list[i].low_val == value){
-					++binctr[i];
-				} else if(bin_list[i].high_inc && bin_list[i].high_val == value){
-					++binctr[i];
-				}
-			}
+			for(i = 0; i < member_count; ++i)
+				sample[i] = *(double *)member_addr[i];
 			break;
 		case PT_int16:
-			ival = (prop_ptr ? *gl_get_int16(obj, prop_ptr) : *gl_get_int16_by_name(obj, property.get_string()) );
-			value = 1.0;
+			for(i = 0; i < member_count; ++i)
+				sample[i] = (double)*(int16 *)member_addr[i];
+			break;
 		case PT_int32:
-			if(value == 0.0){
-				ival = (prop_ptr ? *gl_get_int32(obj, prop_ptr) : *gl_get_int32_by_name(obj, property.get_string()) );
-				value = 1.0;
-			}
+			for(i = 0; i < member_count; ++i)
+				sample[i] = (double)*(int32 *)member_addr[i];
+			break;
 		case PT_int64:
-			if(value == 0.0){
-				ival = (prop_ptr ? *gl_get_int64(obj, prop_ptr) : *gl_get_int64_by_name(obj, property.get_string()) );
-				value = 1.0;
-			}
+			for(i = 0; i < member_count; ++i)
+				sample[i] = (double)*(int64 *)member_addr[i];
+			break;
 		case PT_enumeration:
-			if(value == 0.0){
-				ival = (prop_ptr ? *gl_get_enum(obj, prop_ptr) : *gl_get_enum_by_name(obj, property.get_string()) );
-				value = 1.0;
-			}
+			for(i = 0; i < member_count; ++i)
+				sample[i] = (double)*(enumeration *)member_addr[i];
+			break;
 		case PT_set:
-			if(value == 0.0){
-				ival = (prop_ptr ? *gl_get_set(obj, prop_ptr) : *gl_get_set_by_name(obj, property.get_string()) );
-				value = 1.0;
-			}
-			
-			/* may be prone to fractional errors */
-			for(i = 0; i < bin_count; ++i){
-				if(ival > bin_list[i].low_val && ival < bin_list[i].high_val){
-					++binctr[i];
-				} else if(bin_list[i].low_inc && bin_list[i].low_val == ival){
-					++binctr[i];
-				} else if(bin_list[i].high_inc && bin_list[i].high_val == ival){
-					++binctr[i];
-				}
-			}
+			for(i = 0; i < member_count; ++i)
+				sample[i] = (double)*(set *)member_addr[i];
 			break;
 		default:
-			break;
+			return 0;
 	}
+	return 1;
+}
 
-	return 0;
+/**
+ *	Counts the gathered samples into the bins.  The inner loop has no branches
+ *	so the compiler can vectorize it over the whole group.
+ */
+void histogram::feed_bins(void)
+{
+	int i, b;
+
+	for(b = 0; b < bin_count; ++b){
+		const double low = bin_list[b].low_val;
+		const double high = bin_list[b].high_val;
+		const int low_inc = (bin_list[b].low_inc != 0);
+		const int high_inc = (bin_list[b].high_inc != 0);
+		int count = 0;
+		for(i = 0; i < member_count; ++i){
+			const double value = sample[i];
+			count += ((value > low) & (value < high)) | (low_inc & (value == low)) | (high_inc & (value == high));
+		}
+		binctr[b] += count;
+	}
 }
 
 TIMESTAMP histogram::sync(TIMESTAMP t0, TIMESTAMP t1)
 {
-	OBJECT *obj = THISOBJECTHDR;
-
 	if((sampling_interval == -1.0 && t_count > t1) ||
 		sampling_interval == 0.0 ||
 		(sampling_interval > 0.0 && t1 >= next_sample))
 	{
-		if(group_list == NULL){
-			feed_bins(obj->parent);
-		} else {
-			OBJECT *obj = gl_find_next(group_list, NULL);
-			for(; obj != NULL; obj = gl_find_next(group_list, obj)){
-				feed_bins(obj);
-			}
+		if(gather_samples()){
+			feed_bins();
 		}
 		t_sample = t1;
 		if(sampling_interval > 0.0001){
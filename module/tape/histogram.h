@@ -26,6 +26,10 @@ protected:
 	CPLPT comp_part;
 	PROPERTY *prop_ptr;
 	TAPEOPS *ops;
+	PROPERTYTYPE sample_type;	/* property type shared by all members */
+	int member_count;			/* number of objects sampled */
+	void **member_addr;			/* resolved property address of each member */
+	double *sample;				/* member values gathered each sample */
 
 public:
     static CLASS *oclass;
@@ -67,7 +71,9 @@ public:
 	int isa(char *classname);
 protected:
 	void test_for_complex(char *, char *);
-	int feed_bins(OBJECT *);
+	int resolve_members(PROPERTY *);
+	int gather_samples(void);
+	void feed_bins(void);
 };
 
 #endif // C++
@@ -174,6 +174,31 @@ int violation_recorder::init(OBJECT *obj){
 	tplx_meter_list_v7 = uniqueList_alloc_fxn(tplx_meter_list_v7);
 	comm_meter_list_v7 = uniqueList_alloc_fxn(comm_meter_list_v7);
 
+	//Resolve the limit checks once so each check is a pass over flat arrays
+	xfrmr_checks_v1 = vcheckarray_alloc_fxn(3*xfrmr_obj_list->length());
+	line_checks_v1 = vcheckarray_alloc_fxn(3*(ohl_obj_list->length() + ugl_obj_list->length()) + 2*tplxl_obj_list->length());
+	voltage_checks_v2 = vcheckarray_alloc_fxn(3*(node_obj_list->length() + comm_mtr_obj_list->length()) + tplx_node_obj_list->length() + tplx_mtr_obj_list->length());
+	voltage_checks_v3 = vcheckarray_alloc_fxn(3*comm_mtr_obj_list->length() + tplx_node_obj_list->length() + tplx_mtr_obj_list->length());
+	inverter_checks_v6 = vcheckarray_alloc_fxn(3*inverter_obj_list->length());
+	voltage_rise_checks_v7 = vcheckarray_alloc_fxn(6*tplx_mtr_obj_list->length() + 3*comm_mtr_obj_list->length());
+	if (add_xfrmr_thermal_checks(xfrmr_checks_v1, xfrmr_obj_list, XFMR, xfrmr_list_v1) == 0
+		|| add_line_thermal_checks(line_checks_v1, ohl_obj_list, OHLN, ohl_list_v1) == 0
+		|| add_line_thermal_checks(line_checks_v1, ugl_obj_list, UGLN, ugl_list_v1) == 0
+		|| add_line_thermal_checks(line_checks_v1, tplxl_obj_list, TPXL, tplxl_list_v1) == 0
+		|| add_voltage_checks(voltage_checks_v2, node_obj_list, NODE, node_list_v2, false) == 0
+		|| add_voltage_checks(voltage_checks_v2, comm_mtr_obj_list, CMTR, comm_meter_list_v2, false) == 0
+		|| add_voltage_checks(voltage_checks_v2, tplx_node_obj_list, TPXN, tplx_node_list_v2, true) == 0
+		|| add_voltage_checks(voltage_checks_v2, tplx_mtr_obj_list, TPXM, tplx_meter_list_v2, true) == 0
+		|| add_voltage_checks(voltage_checks_v3, tplx_node_obj_list, TPXN, tplx_node_list_v3, true) == 0
+		|| add_voltage_checks(voltage_checks_v3, tplx_mtr_obj_list, TPXM, tplx_meter_list_v3, true) == 0
+		|| add_voltage_checks(voltage_checks_v3, comm_mtr_obj_list, CMTR, comm_meter_list_v3, false) == 0
+		|| add_inverter_checks(inverter_checks_v6, inverter_obj_list) == 0
+		|| add_voltage_rise_checks(voltage_rise_checks_v7, tplx_mtr_obj_list, TPXM, tplx_meter_list_v7, true) == 0
+		|| add_voltage_rise_checks(voltage_rise_checks_v7, comm_mtr_obj_list, CMTR, comm_meter_list_v7, false) == 0)
+	{
+		return 0;
+	}
+
 	return 1;
 }
 
@@ -453,178 +478,26 @@ int violation_recorder::check_violations(TIMESTAMP t1) {
 // Exceeding device thermal limit
 int violation_recorder::check_violation_1(TIMESTAMP t1) 
 {
-	check_xfrmr_thermal_limit(t1, xfrmr_obj_list, xfrmr_list_v1, XFMR, xfrmr_thermal_limit_upper, xfrmr_thermal_limit_lower);
-	check_line_thermal_limit(t1, ohl_obj_list, ohl_list_v1, OHLN, line_thermal_limit_upper, line_thermal_limit_lower);
-	check_line_thermal_limit(t1, ugl_obj_list, ugl_list_v1, UGLN, line_thermal_limit_upper, line_thermal_limit_lower);
-	check_line_thermal_limit(t1, tplxl_obj_list, tplxl_list_v1, TPXL, line_thermal_limit_upper, line_thermal_limit_lower);
+	report_thermal_violations(t1, xfrmr_checks_v1, xfrmr_thermal_limit_upper, xfrmr_thermal_limit_lower, "Power violates thermal limit.");
+	report_thermal_violations(t1, line_checks_v1, line_thermal_limit_upper, line_thermal_limit_lower, "Current violates thermal limit.");
 
 	return 1;
 
 }
 
-int violation_recorder::check_line_thermal_limit(TIMESTAMP t1, vobjlist *list, uniqueList *uniq_list, int type, double upper_bound, double lower_bound) {
+int violation_recorder::report_thermal_violations(TIMESTAMP t1, vcheckarray *checks, double upper_bound, double lower_bound, const char *str) {
 
-	vobjlist *curr = 0;
-	double nominal, nominalA=0, nominalB=0, nominalC=0;
 	char objname[128];
-	double retval;
-
-	for(curr = list; curr != 0; curr = curr->next){
-		if (curr->obj == 0) continue;
-		//p_ptr = gl_get_property(curr->obj, "continuous_rating");
-		//nominal = get_observed_double_value(curr->obj, p_ptr);
-		if (has_phase(curr->obj, PHASE_S)) { // split phase line
-			triplex_line *pTriplex_line = OBJECTDATA(curr->obj,triplex_line);
-			triplex_line_configuration *pConfiguration1 = OBJECTDATA(pTriplex_line->configuration,triplex_line_configuration);
-			
-			triplex_line_conductor *pConfigurationA = OBJECTDATA(pConfiguration1->phaseA_conductor,triplex_line_conductor);
-			nominal = pConfigurationA->summer.continuous;
-			if (fails_static_condition(curr->obj, "current_out_A", upper_bound, lower_bound, nominal, &retval)) {
-				uniq_list->insert(curr->obj->name);
-				increment_violation(VIOLATION1, type);
-				write_to_stream(t1, echo, "VIOLATION1, %f, %f, %f, %s, %s, S1, Current violates thermal limit.", retval, upper_bound, lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name);
-			}
-			triplex_line_conductor *pConfigurationB = OBJECTDATA(pConfiguration1->phaseB_conductor,triplex_line_conductor);
-			nominal = pConfigurationB->summer.continuous;
-			if (fails_static_condition(curr->obj, "current_out_B", upper_bound, lower_bound, nominal, &retval)) {
-				uniq_list->insert(curr->obj->name);
-				increment_violation(VIOLATION1, type);
-				write_to_stream(t1, echo, "VIOLATION1, %f, %f, %f, %s, %s, S2, Current violates thermal limit.", retval, upper_bound, lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name);
-			}
-		} else { // 'normal' 3-phase line
-			if ( gl_object_isa(curr->obj,"underground_line","powerflow") ) {
-				underground_line *pThree_phase_line = OBJECTDATA(curr->obj,underground_line);
-				line_configuration *pConfiguration1 = OBJECTDATA(pThree_phase_line->configuration,line_configuration);
-
-				if (has_phase(curr->obj, PHASE_A)) {
-					underground_line_conductor *pConfigurationA = OBJECTDATA(pConfiguration1->phaseA_conductor,underground_line_conductor);
-					if ( pConfigurationA == NULL)
-						nominalA = pConfiguration1->summer.continuous;
-					else
-						nominalA = pConfigurationA->summer.continuous;
-				}
-					
-				if (has_phase(curr->obj, PHASE_B)) {
-					underground_line_conductor *pConfigurationB = OBJECTDATA(pConfiguration1->phaseB_conductor,underground_line_conductor);	
-					if ( pConfigurationB == NULL)
-						nominalB = pConfiguration1->summer.continuous;
-					else
-						nominalB = pConfigurationB->summer.continuous;
-				}
-
-				if (has_phase(curr->obj, PHASE_C)) {
-					underground_line_conductor *pConfigurationC = OBJECTDATA(pConfiguration1->phaseC_conductor,underground_line_conductor);	
-					if ( pConfigurationC == NULL)
-						nominalC = pConfiguration1->summer.continuous;
-					else
-						nominalC = pConfigurationC->summer.continuous;
-				}
-			}
-			else {
-				overhead_line *pThree_phase_line = OBJECTDATA(curr->obj,overhead_line);
-				line_configuration *pConfiguration1 = OBJECTDATA(pThree_phase_line->configuration,line_configuration);
-
-				if (has_phase(curr->obj, PHASE_A)) {
-					overhead_line_conductor *pConfigurationA = OBJECTDATA(pConfiguration1->phaseA_conductor,overhead_line_conductor);
-					if ( pConfigurationA == NULL)
-						nominalA = pConfiguration1->summer.continuous;
-					else
-						nominalA = pConfigurationA->summer.continuous;
-				}
-
-				if (has_phase(curr->obj, PHASE_B)) {
-					overhead_line_conductor *pConfigurationB = OBJECTDATA(pConfiguration1->phaseB_conductor,overhead_line_conductor);
-					if ( pConfigurationB == NULL)
-						nominalB = pConfiguration1->summer.continuous;
-					else
-						nominalB = pConfigurationB->summer.continuous;
-				}
-
-				if (has_phase(curr->obj, PHASE_C)) {
-					overhead_line_conductor *pConfigurationC = OBJECTDATA(pConfiguration1->phaseC_conductor,overhead_line_conductor);
-					if ( pConfigurationC == NULL)
-						nominalC = pConfiguration1->summer.continuous;
-					else
-						nominalC = pConfigurationC->summer.continuous;
-				}				
-				
-			}		
-			if (has_phase(curr->obj, PHASE_A)) {
-				if (fails_static_condition(curr->obj, "current_out_A", upper_bound, lower_bound, nominalA, &retval)) {
-					uniq_list->insert(curr->obj->name);
-					increment_violation(VIOLATION1, type);
-					write_to_stream(t1, echo, "VIOLATION1, %f, %f, %f, %s, %s, A, Current violates thermal limit.", retval, upper_bound, lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name);
-				}
-			}
-			if (has_phase(curr->obj, PHASE_B)) {
-				if (fails_static_condition(curr->obj, "current_out_B", upper_bound, lower_bound, nominalB, &retval)) {
-					uniq_list->insert(curr->obj->name);
-					increment_violation(VIOLATION1, type);
-					write_to_stream(t1, echo, "VIOLATION1, %f, %f, %f, %s, %s, B, Current violates thermal limit.", retval, upper_bound, lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name);
-				}
-			}
-			if (has_phase(curr->obj, PHASE_C)) {
-				if (fails_static_condition(curr->obj, "current_out_C", upper_bound, lower_bound, nominalC, &retval)) {
-					uniq_list->insert(curr->obj->name);
-					increment_violation(VIOLATION1, type);
-					write_to_stream(t1, echo, "VIOLATION1, %f, %f, %f, %s, %s, C, Current violates thermal limit.", retval, upper_bound, lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name);
-				}
-			}
-		}
-	}
+	int i;
 
-	return 1;
-
-}
-
-int violation_recorder::check_xfrmr_thermal_limit(TIMESTAMP t1, vobjlist *list, uniqueList *uniq_list, int type, double upper_bound, double lower_bound) {
-
-	vobjlist *curr = 0;
-	double nominal;
-	char objname[128];
-	double retval;
+	if (checks == 0 || evaluate_static_checks(checks, upper_bound, lower_bound) == 0)
+		return 1;
 
-	for(curr = list; curr != 0; curr = curr->next){
-		if (curr->obj == 0) continue;
-		// this is for the triplex transformers b/c phase is meaningless
-		if (has_phase(curr->obj, PHASE_S)) {
-			transformer *pTransformer = OBJECTDATA(curr->obj,transformer);
-			transformer_configuration *pConfiguration = OBJECTDATA(pTransformer->configuration,transformer_configuration);
-			nominal = pConfiguration->kVA_rating*1000.;
-			if (fails_static_condition(curr->obj, "power_out", upper_bound, lower_bound, nominal, &retval)) {
-				uniq_list->insert(curr->obj->name);
-				increment_violation(VIOLATION1, type);
-				write_to_stream(t1, echo, "VIOLATION1, %f, %f, %f, %s, %s, S, Power violates thermal limit.", retval, upper_bound, lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name);
-			}
-		// this is for the other transformers which have 3 phases, each of which can violate the limit
-		} else {
-			transformer *pTransformer = OBJECTDATA(curr->obj,transformer);
-			transformer_configuration *pConfiguration = OBJECTDATA(pTransformer->configuration,transformer_configuration);
-			if (has_phase(curr->obj, PHASE_A)) {
-				nominal = pConfiguration->phaseA_kVA_rating*1000.;
-				if (fails_static_condition(curr->obj, "power_out_A", upper_bound, lower_bound, nominal, &retval)) {
-					uniq_list->insert(curr->obj->name);
-					increment_violation(VIOLATION1, type);
-					write_to_stream(t1, echo, "VIOLATION1, %f, %f, %f, %s, %s, A, Power violates thermal limit.", retval, upper_bound, lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name);
-				}
-			}
-			if (has_phase(curr->obj, PHASE_B)) {
-				nominal = pConfiguration->phaseB_kVA_rating*1000.;
-				if (fails_static_condition(curr->obj, "power_out_B", upper_bound, lower_bound, nominal, &retval)) {
-					uniq_list->insert(curr->obj->name);
-					increment_violation(VIOLATION1, type);
-					write_to_stream(t1, echo, "VIOLATION1, %f, %f, %f, %s, %s, B, Power violates thermal limit.", retval, upper_bound, lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name);
-				}
-			}
-			if (has_phase(curr->obj, PHASE_C)) {
-				nominal = pConfiguration->phaseC_kVA_rating*1000.;
-				if (fails_static_condition(curr->obj, "power_out_C", upper_bound, lower_bound, nominal, &retval)) {
-					uniq_list->insert(curr->obj->name);
-					increment_violation(VIOLATION1, type);
-					write_to_stream(t1, echo, "VIOLATION1, %f, %f, %f, %s, %s, C, Power violates thermal limit.", retval, upper_bound, lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name);
-				}
-			}
-		}
+	for(i = 0; i < checks->count; i++){
+		if (checks->fails[i] == 0) continue;
+		checks->uniq[i]->insert(checks->obj[i]->name);
+		increment_violation(VIOLATION1, checks->type[i]);
+		write_to_stream(t1, echo, "VIOLATION1, %f, %f, %f, %s, %s, %s, %s", checks->pu[i], upper_bound, lower_bound, gl_name(checks->obj[i], objname, 127), checks->obj[i]->oclass->name, checks->phase[i], str);
 	}
 
 	return 1;
@@ -634,92 +507,20 @@ int violation_recorder::check_xfrmr_thermal_limit(TIMESTAMP t1, vobjlist *list,
 // Instantaneous voltage of node over 1.1pu
 int violation_recorder::check_violation_2(TIMESTAMP t1) 
 {
-	vobjlist *curr = 0;
-	PROPERTY *p_ptr;
-	double nominal;
+	vcheckarray *checks = voltage_checks_v2;
 	char objname[128];
 	double node_upper_bound = node_instantaneous_voltage_limit_upper;
 	double node_lower_bound = node_instantaneous_voltage_limit_lower;
-	double retval;
+	int i;
 
-	for(curr = node_obj_list; curr != 0; curr = curr->next){
-		if (curr->obj == 0) continue;
-		p_ptr = gl_get_property(curr->obj, "nominal_voltage");
-		nominal = get_observed_double_value(curr->obj, p_ptr);
-		if (has_phase(curr->obj, PHASE_A)) {
-			if (fails_static_condition(curr->obj, "voltage_A", node_upper_bound, node_lower_bound, nominal, &retval)) {
-				node_list_v2->insert(curr->obj->name);
-				increment_violation(VIOLATION2, NODE);
-				write_to_stream(t1, echo, "VIOLATION2, %f, %f, %f, %s, %s, A, Per unit voltage violates limit.", retval, node_upper_bound, node_lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name);
-			}
-		}
-		if (has_phase(curr->obj, PHASE_B)) {
-			if (fails_static_condition(curr->obj, "voltage_B", node_upper_bound, node_lower_bound, nominal, &retval)) {
-				node_list_v2->insert(curr->obj->name);
-				increment_violation(VIOLATION2, NODE);
-				write_to_stream(t1, echo, "VIOLATION2, %f, %f, %f, %s, %s, B, Per unit voltage violates limit.", retval, node_upper_bound, node_lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name);
-			}
-		}
-		if (has_phase(curr->obj, PHASE_C)) {
-			if (fails_static_condition(curr->obj, "voltage_C", node_upper_bound, node_lower_bound, nominal, &retval)) {
-				node_list_v2->insert(curr->obj->name);
-				increment_violation(VIOLATION2, NODE);
-				write_to_stream(t1, echo, "VIOLATION2, %f, %f, %f, %s, %s, C, Per unit voltage violates limit.", retval, node_upper_bound, node_lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name);
-			}
-		}
-	}
-
-	for(curr = comm_mtr_obj_list; curr != 0; curr = curr->next){
-		if (curr->obj == 0) continue;
-		p_ptr = gl_get_property(curr->obj, "nominal_voltage");
-		nominal = get_observed_double_value(curr->obj, p_ptr);
-		if (has_phase(curr->obj, PHASE_A)) {
-			if (fails_static_condition(curr->obj, "voltage_A", node_upper_bound, node_lower_bound, nominal, &retval)) {
-				comm_meter_list_v2->insert(curr->obj->name);
-				increment_violation(VIOLATION2, CMTR);
-				write_to_stream(t1, echo, "VIOLATION2, %f, %f, %f, %s, %s, A, Per unit voltage violates limit.", retval, node_upper_bound, node_lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name);
-			}
-		}
-		if (has_phase(curr->obj, PHASE_B)) {
-			if (fails_static_condition(curr->obj, "voltage_B", node_upper_bound, node_lower_bound, nominal, &retval)) {
-				comm_meter_list_v2->insert(curr->obj->name);
-				increment_violation(VIOLATION2, CMTR);
-				write_to_stream(t1, echo, "VIOLATION2, %f, %f, %f, %s, %s, B, Per unit voltage violates limit.", retval, node_upper_bound, node_lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name);
-			}
-		}
-		if (has_phase(curr->obj, PHASE_C)) {
-			if (fails_static_condition(curr->obj, "voltage_C", node_upper_bound, node_lower_bound, nominal, &retval)) {
-				comm_meter_list_v2->insert(curr->obj->name);
-				increment_violation(VIOLATION2, CMTR);
-				write_to_stream(t1, echo, "VIOLATION2, %f, %f, %f, %s, %s, C, Per unit voltage violates limit.", retval, node_upper_bound, node_lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name);
-			}
-		}
-	}
-
-	for(curr = tplx_node_obj_list; curr != 0; curr = curr->next){
-		if (curr->obj == 0) continue;
-		p_ptr = gl_get_property(curr->obj, "nominal_voltage");
-		nominal = get_observed_double_value(curr->obj, p_ptr) * 2.;
-		if (has_phase(curr->obj, PHASE_S1) && has_phase(curr->obj, PHASE_S2)) {
-			if (fails_static_condition(curr->obj, "voltage_12", node_upper_bound, node_lower_bound, nominal, &retval)) {
-				tplx_node_list_v2->insert(curr->obj->name);
-				increment_violation(VIOLATION2, TPXN);
-				write_to_stream(t1, echo, "VIOLATION2, %f, %f, %f, %s, %s, S, Per unit voltage violates limit.", retval, node_upper_bound, node_lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name);
-			}
-		}
-	}
+	if (checks == 0 || evaluate_static_checks(checks, node_upper_bound, node_lower_bound) == 0)
+		return 1;
 
-	for(curr = tplx_mtr_obj_list; curr != 0; curr = curr->next){
-		if (curr->obj == 0) continue;
-		p_ptr = gl_get_property(curr->obj, "nominal_voltage");
-		nominal = get_observed_double_value(curr->obj, p_ptr) * 2.;
-		if (has_phase(curr->obj, PHASE_S1) && has_phase(curr->obj, PHASE_S2)) {
-			if (fails_static_condition(curr->obj, "voltage_12", node_upper_bound, node_lower_bound, nominal, &retval)) {
-				tplx_meter_list_v2->insert(curr->obj->name);
-				increment_violation(VIOLATION2, TPXM);
-				write_to_stream(t1, echo, "VIOLATION2, %f, %f, %f, %s, %s, S, Per unit voltage violates limit.", retval, node_upper_bound, node_lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name);
-			}
-		}
+	for(i = 0; i < checks->count; i++){
+		if (checks->fails[i] == 0) continue;
+		checks->uniq[i]->insert(checks->obj[i]->name);
+		increment_violation(VIOLATION2, checks->type[i]);
+		write_to_stream(t1, echo, "VIOLATION2, %f, %f, %f, %s, %s, %s, Per unit voltage violates limit.", checks->pu[i], node_upper_bound, node_lower_bound, gl_name(checks->obj[i], objname, 127), checks->obj[i]->oclass->name, checks->phase[i]);
 	}
 
 	return 1;
@@ -729,65 +530,25 @@ int violation_recorder::check_violation_2(TIMESTAMP t1)
 // Voltage of node over 1.05pu or under 0.95pu for 5 minutes or more
 int violation_recorder::check_violation_3(TIMESTAMP t1) 
 {
-	vobjlist *curr = 0;
-	PROPERTY *p_ptr;
-	double nominal;
+	vcheckarray *checks = voltage_checks_v3;
 	char objname[128];
 	double node_upper_bound = node_continuous_voltage_limit_upper;
 	double node_lower_bound = node_continuous_voltage_limit_lower;
 	double interval = node_continuous_voltage_interval;
 	double retval;
+	int i;
 
-	for(curr = tplx_node_obj_list; curr != 0; curr = curr->next){
-		if (curr->obj == 0) continue;
-		p_ptr = gl_get_property(curr->obj, "nominal_voltage");
-		nominal = get_observed_double_value(curr->obj, p_ptr) * 2.;
-		if (has_phase(curr->obj, PHASE_S1) && has_phase(curr->obj, PHASE_S2)) { // We are now checking all objects regardless of parent // && gl_object_isa(curr->obj->parent,"transformer")) {
-			if (fails_continuous_condition(curr, 0, "voltage_12", t1, interval, node_upper_bound, node_lower_bound, nominal, &retval)) {
-				tplx_node_list_v3->insert(curr->obj->name);
-				increment_violation(VIOLATION3, TPXN);
-				write_to_stream(t1, echo, "VIOLATION3, %f, %f, %f, %s, %s, S, Per unit voltage violates limit continuously over %is interval.", retval, node_upper_bound, node_lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name, (int)node_continuous_voltage_interval);
-			}
-		}
-	}
+	if (checks == 0)
+		return 1;
 
-	for(curr = tplx_mtr_obj_list; curr != 0; curr = curr->next){
-		if (curr->obj == 0) continue;
-		p_ptr = gl_get_property(curr->obj, "nominal_voltage");
-		nominal = get_observed_double_value(curr->obj, p_ptr) * 2.;
-		if (has_phase(curr->obj, PHASE_S1) && has_phase(curr->obj, PHASE_S2)) { // We are now checking all objects regardless of parent // && gl_object_isa(curr->obj->parent,"transformer")) {
-			if (fails_continuous_condition(curr, 0, "voltage_12", t1, interval, node_upper_bound, node_lower_bound, nominal, &retval)) {
-				tplx_meter_list_v3->insert(curr->obj->name);
-				increment_violation(VIOLATION3, TPXM);
-				write_to_stream(t1, echo, "VIOLATION3, %f, %f, %f, %s, %s, S, Per unit voltage violates limit continuously over %is interval.", retval, node_upper_bound, node_lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name, (int)node_continuous_voltage_interval);
-			}
-		}
-	}
+	evaluate_per_unit(checks);
 
-	for(curr = comm_mtr_obj_list; curr != 0; curr = curr->next){
-		if (curr->obj == 0) continue;
-		p_ptr = gl_get_property(curr->obj, "nominal_voltage");
-		nominal = get_observed_double_value(curr->obj, p_ptr);
-		if (has_phase(curr->obj, PHASE_A)) {
-			if (fails_continuous_condition(curr, 0, "voltage_A", t1, interval, node_upper_bound, node_lower_bound, nominal, &retval)) {
-				comm_meter_list_v3->insert(curr->obj->name);
-				increment_violation(VIOLATION3, CMTR);
-				write_to_stream(t1, echo, "VIOLATION3, %f, %f, %f, %s, %s, A, Per unit voltage violates limit continuously over %is interval.", retval, node_upper_bound, node_lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name, (int)node_continuous_voltage_interval);
-			}
-		}
-		if (has_phase(curr->obj, PHASE_B)) {
-			if (fails_continuous_condition(curr, 0, "voltage_B", t1, interval, node_upper_bound, node_lower_bound, nominal, &retval)) {
-				comm_meter_list_v3->insert(curr->obj->name);
-				increment_violation(VIOLATION3, CMTR);
-				write_to_stream(t1, echo, "VIOLATION3, %f, %f, %f, %s, %s, B, Per unit voltage violates limit continuously over %is interval.", retval, node_upper_bound, node_lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name, (int)node_continuous_voltage_interval);
-			}
-		}
-		if (has_phase(curr->obj, PHASE_C)) {
-			if (fails_continuous_condition(curr, 0, "voltage_C", t1, interval, node_upper_bound, node_lower_bound, nominal, &retval)) {
-				comm_meter_list_v3->insert(curr->obj->name);
-				increment_violation(VIOLATION3, CMTR);
-				write_to_stream(t1, echo, "VIOLATION3, %f, %f, %f, %s, %s, C, Per unit voltage violates limit continuously over %is interval.", retval, node_upper_bound, node_lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name, (int)node_continuous_voltage_interval);
-			}
+	// the time condition keeps state per object, so it stays a scalar pass
+	for(i = 0; i < checks->count; i++){
+		if (fails_continuous_condition(checks->history[i], checks->slot[i], checks->pu[i], t1, interval, node_upper_bound, node_lower_bound, &retval)) {
+			checks->uniq[i]->insert(checks->obj[i]->name);
+			increment_violation(VIOLATION3, checks->type[i]);
+			write_to_stream(t1, echo, "VIOLATION3, %f, %f, %f, %s, %s, %s, Per unit voltage violates limit continuously over %is interval.", retval, node_upper_bound, node_lower_bound, gl_name(checks->obj[i], objname, 127), checks->obj[i]->oclass->name, checks->phase[i], (int)node_continuous_voltage_interval);
 		}
 	}
 
@@ -852,44 +613,24 @@ int violation_recorder::check_reverse_flow_violation(TIMESTAMP t1, int violation
 // Any voltage change at a PV POC that is greater than 1.5% between two one-minute simulation time-steps.
 int violation_recorder::check_violation_6(TIMESTAMP t1) {
 //	gl_output("VIOLATION 6");
-	vobjlist *curr = 0;
+	vcheckarray *checks = inverter_checks_v6;
 	char objname[128];
 	double upper_bound = inverter_v_chng_per_interval_upper_bound;
 	double lower_bound = inverter_v_chng_per_interval_lower_bound;
 	double interval = inverter_v_chng_interval;
-	double nominal = 1.0;
 	double retval;
+	int i;
 
-	for(curr = inverter_obj_list; curr != 0; curr = curr->next){
-		if (curr->obj == 0) continue;
-		if (has_phase(curr->obj, PHASE_S)) { // inverter connected to a triplex system, only checking one phase here
-			if (fails_dynamic_condition(curr, 1, "phaseB_V_Out", t1, interval, upper_bound, lower_bound, nominal, &retval)) { // this is S1 !?!
-				inverter_list_v6->insert(curr->obj->name);
-				increment_violation(VIOLATION6);
-				write_to_stream(t1, echo, "VIOLATION6, %f, %f, %f, %s, %s, S, Voltage change between %is intervals violates limit.", retval, upper_bound, lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name, (int)inverter_v_chng_interval);
-			}
-		} else { // assume we are a three phase inverter
-			if (has_phase(curr->obj, PHASE_A)) {
-				if (fails_dynamic_condition(curr, 0, "phaseA_V_Out", t1, interval, upper_bound, lower_bound, nominal, &retval)) {
-					inverter_list_v6->insert(curr->obj->name);
-					increment_violation(VIOLATION6);
-					write_to_stream(t1, echo, "VIOLATION6, %f, %f, %f, %s, %s, A, Voltage change between %is intervals violates limit.", retval, upper_bound, lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name, (int)inverter_v_chng_interval);
-				}
-			}
-			if (has_phase(curr->obj, PHASE_B)) {
-				if (fails_dynamic_condition(curr, 1, "phaseB_V_Out", t1, interval, upper_bound, lower_bound, nominal, &retval)) {
-					inverter_list_v6->insert(curr->obj->name);
-					increment_violation(VIOLATION6);
-					write_to_stream(t1, echo, "VIOLATION6, %f, %f, %f, %s, %s, B, Voltage change between %is intervals violates limit.", retval, upper_bound, lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name, (int)inverter_v_chng_interval);
-				}
-			}
-			if (has_phase(curr->obj, PHASE_C)) {
-				if (fails_dynamic_condition(curr, 2, "phaseC_V_Out", t1, interval, upper_bound, lower_bound, nominal, &retval)) {
-					inverter_list_v6->insert(curr->obj->name);
-					increment_violation(VIOLATION6);
-					write_to_stream(t1, echo, "VIOLATION6, %f, %f, %f, %s, %s, C, Voltage change between %is intervals violates limit.", retval, upper_bound, lower_bound, gl_name(curr->obj, objname, 127), curr->obj->oclass->name, (int)inverter_v_chng_interval);
-				}
-			}
+	if (checks == 0)
+		return 1;
+
+	evaluate_per_unit(checks);
+
+	for(i = 0; i < checks->count; i++){
+		if (fails_dynamic_condition(checks->history[i], checks->slot[i], checks->pu[i], t1, interval, upper_bound, lower_bound, &retval)) {
+			inverter_list_v6->insert(checks->obj[i]->name);
+			increment_violation(VIOLATION6);
+			write_to_stream(t1, echo, "VIOLATION6, %f, %f, %f, %s, %s, %s, Voltage change between %is intervals violates limit.", retval, upper_bound, lower_bound, gl_name(checks->obj[i], objname, 127), checks->obj[i]->oclass->name, checks->phase[i], (int)inverter_v_chng_interval);
 		}
 	}
 
@@ -899,151 +640,21 @@ int violation_recorder::check_violation_6(TIMESTAMP t1) {
 // 3V rise across the secondary distribution system
 int violation_recorder::check_violation_7(TIMESTAMP t1) {
 //	gl_output("VIOLATION 7");
-	vobjlist *curr = 0;
-	PROPERTY *p_ptr;
-	double meter_voltage, meter_nominal, xfrmr_voltage, xfrmr_nominal, pu;
+	vcheckarray *checks = voltage_rise_checks_v7;
 	char metername[128];
 	char xfrmrname[128];
 	double pu_upper_bound = secondary_dist_voltage_rise_upper_limit;
 	double pu_lower_bound = secondary_dist_voltage_rise_lower_limit;
-	double retval;
+	int i;
 
-	for(curr = tplx_mtr_obj_list; curr != 0; curr = curr->next){
-		if (curr->obj == 0) continue;
-		if (curr->ref_obj == 0) continue;
-		p_ptr = gl_get_property(curr->obj, "nominal_voltage");
-		meter_nominal = get_observed_double_value(curr->obj, p_ptr);
-		pu = 0;
-		if (has_phase(curr->obj, PHASE_S1)) {
-			p_ptr = gl_get_property(curr->obj, "voltage_1");
-			meter_voltage = get_observed_double_value(curr->obj, p_ptr);
-			if (has_phase(curr->obj, PHASE_A)) {
-				p_ptr = gl_get_property(curr->ref_obj, "nominal_voltage");
-				xfrmr_nominal = get_observed_double_value(curr->ref_obj, p_ptr);
-				p_ptr = gl_get_property(curr->ref_obj, "voltage_A");
-				xfrmr_voltage = get_observed_double_value(curr->ref_obj, p_ptr);
-				pu = meter_voltage/meter_nominal-xfrmr_voltage/xfrmr_nominal;
-				if (fails_static_condition(pu, pu_upper_bound, pu_lower_bound, 1.0, &retval)) {
-					tplx_meter_list_v7->insert(curr->obj->name);
-					increment_violation(VIOLATION7, TPXM);
-					write_to_stream(t1, echo, "VIOLATION7, %f, %f, %f, %s %s, %s %s, A S1, Per unit voltage difference between objects violates limit.", retval, pu_upper_bound, pu_lower_bound, gl_name(curr->obj, metername, 127), gl_name(curr->ref_obj, xfrmrname, 127), curr->obj->oclass->name, curr->ref_obj->oclass->name);
-				}
-			}
-			if (has_phase(curr->obj, PHASE_B)) {
-				p_ptr = gl_get_property(curr->ref_obj, "nominal_voltage");
-				xfrmr_nominal = get_observed_double_value(curr->ref_obj, p_ptr);
-				p_ptr = gl_get_property(curr->ref_obj, "voltage_B");
-				xfrmr_voltage = get_observed_double_value(curr->ref_obj, p_ptr);
-				pu = meter_voltage/meter_nominal-xfrmr_voltage/xfrmr_nominal;
-				if (fails_static_condition(pu, pu_upper_bound, pu_lower_bound, 1.0, &retval)) {
-					tplx_meter_list_v7->insert(curr->obj->name);
-					increment_violation(VIOLATION7, TPXM);
-					write_to_stream(t1, echo, "VIOLATION7, %f, %f, %f, %s %s, %s %s, B S1, Per unit voltage difference between objects violates limit.", retval, pu_upper_bound, pu_lower_bound, gl_name(curr->obj, metername, 127), gl_name(curr->ref_obj, xfrmrname, 127), curr->obj->oclass->name, curr->ref_obj->oclass->name);
-				}
-			}
-			if (has_phase(curr->obj, PHASE_C)) {
-				p_ptr = gl_get_property(curr->ref_obj, "nominal_voltage");
-				xfrmr_nominal = get_observed_double_value(curr->ref_obj, p_ptr);
-				p_ptr = gl_get_property(curr->ref_obj, "voltage_C");
-				xfrmr_voltage = get_observed_double_value(curr->ref_obj, p_ptr);
-				pu = meter_voltage/meter_nominal-xfrmr_voltage/xfrmr_nominal;
-				if (fails_static_condition(pu, pu_upper_bound, pu_lower_bound, 1.0, &retval)) {
-					tplx_meter_list_v7->insert(curr->obj->name);
-					increment_violation(VIOLATION7, TPXM);
-					write_to_stream(t1, echo, "VIOLATION7, %f, %f, %f, %s %s, %s %s, C S1, Per unit voltage difference between objects violates limit.", retval, pu_upper_bound, pu_lower_bound, gl_name(curr->obj, metername, 127), gl_name(curr->ref_obj, xfrmrname, 127), curr->obj->oclass->name, curr->ref_obj->oclass->name);
-				}
-			}
-		}
-		if (has_phase(curr->obj, PHASE_S2)) {
-			p_ptr = gl_get_property(curr->obj, "voltage_2");
-			meter_voltage = get_observed_double_value(curr->obj, p_ptr);
-			if (has_phase(curr->obj, PHASE_A)) {
-				p_ptr = gl_get_property(curr->ref_obj, "nominal_voltage");
-				xfrmr_nominal = get_observed_double_value(curr->ref_obj, p_ptr);
-				p_ptr = gl_get_property(curr->ref_obj, "voltage_A");
-				xfrmr_voltage = get_observed_double_value(curr->ref_obj, p_ptr);
-				pu = meter_voltage/meter_nominal-xfrmr_voltage/xfrmr_nominal;
-				if (fails_static_condition(pu, pu_upper_bound, pu_lower_bound, 1.0, &retval)) {
-					tplx_meter_list_v7->insert(curr->obj->name);
-					increment_violation(VIOLATION7, TPXM);
-					write_to_stream(t1, echo, "VIOLATION7, %f, %f, %f, %s %s, %s %s, A S2, Per unit voltage difference between objects violates limit.", retval, pu_upper_bound, pu_lower_bound, gl_name(curr->obj, metername, 127), gl_name(curr->ref_obj, xfrmrname, 127), curr->obj->oclass->name, curr->ref_obj->oclass->name);
-				}
-			}
-			if (has_phase(curr->obj, PHASE_B)) {
-				p_ptr = gl_get_property(curr->ref_obj, "nominal_voltage");
-				xfrmr_nominal = get_observed_double_value(curr->ref_obj, p_ptr);
-				p_ptr = gl_get_property(curr->ref_obj, "voltage_B");
-				xfrmr_voltage = get_observed_double_value(curr->ref_obj, p_ptr);
-				pu = meter_voltage/meter_nominal-xfrmr_voltage/xfrmr_nominal;
-				if (fails_static_condition(pu, pu_upper_bound, pu_lower_bound, 1.0, &retval)) {
-					tplx_meter_list_v7->insert(curr->obj->name);
-					increment_violation(VIOLATION7, TPXM);
-					write_to_stream(t1, echo, "VIOLATION7, %f, %f, %f, %s %s, %s %s, B S2, Per unit voltage difference between objects violates limit.", retval, pu_upper_bound, pu_lower_bound, gl_name(curr->obj, metername, 127), gl_name(curr->ref_obj, xfrmrname, 127), curr->obj->oclass->name, curr->ref_obj->oclass->name);
-				}
-			}
-			if (has_phase(curr->obj, PHASE_C)) {
-				p_ptr = gl_get_property(curr->ref_obj, "nominal_voltage");
-				xfrmr_nominal = get_observed_double_value(curr->ref_obj, p_ptr);
-				p_ptr = gl_get_property(curr->ref_obj, "voltage_C");
-				xfrmr_voltage = get_observed_double_value(curr->ref_obj, p_ptr);
-				pu = meter_voltage/meter_nominal-xfrmr_voltage/xfrmr_nominal;
-				if (fails_static_condition(pu, pu_upper_bound, pu_lower_bound, 1.0, &retval)) {
-					tplx_meter_list_v7->insert(curr->obj->name);
-					increment_violation(VIOLATION7, TPXM);
-					write_to_stream(t1, echo, "VIOLATION7, %f, %f, %f, %s %s, %s %s, C S2, Per unit voltage difference between objects violates limit.", retval, pu_upper_bound, pu_lower_bound, gl_name(curr->obj, metername, 127), gl_name(curr->ref_obj, xfrmrname, 127), curr->obj->oclass->name, curr->ref_obj->oclass->name);
-				}
-			}
-		}
-	}
+	if (checks == 0 || evaluate_difference_checks(checks, pu_upper_bound, pu_lower_bound) == 0)
+		return 1;
 
-	for(curr = comm_mtr_obj_list; curr != 0; curr = curr->next){
-		if (curr->obj == 0) continue;
-		if (curr->ref_obj == 0) continue;
-		p_ptr = gl_get_property(curr->obj, "nominal_voltage");
-		meter_nominal = get_observed_double_value(curr->obj, p_ptr);
-		pu = 0;
-		if (has_phase(curr->obj, PHASE_A)) {
-			p_ptr = gl_get_property(curr->obj, "voltage_A");
-			meter_voltage = get_observed_double_value(curr->obj, p_ptr);
-			p_ptr = gl_get_property(curr->ref_obj, "nominal_voltage");
-			xfrmr_nominal = get_observed_double_value(curr->ref_obj, p_ptr);
-			p_ptr = gl_get_property(curr->ref_obj, "voltage_A");
-			xfrmr_voltage = get_observed_double_value(curr->ref_obj, p_ptr);
-			pu = meter_voltage/meter_nominal-xfrmr_voltage/xfrmr_nominal;
-			if (fails_static_condition(pu, pu_upper_bound, pu_lower_bound, 1.0, &retval)) {
-				comm_meter_list_v7->insert(curr->obj->name);
-				increment_violation(VIOLATION7, CMTR);
-				write_to_stream(t1, echo, "VIOLATION7, %f, %f, %f, %s %s, %s %s, A, Per unit voltage difference between objects violates limit.", retval, pu_upper_bound, pu_lower_bound, gl_name(curr->obj, metername, 127), gl_name(curr->ref_obj, xfrmrname, 127), curr->obj->oclass->name, curr->ref_obj->oclass->name);
-			}
-		}
-		if (has_phase(curr->obj, PHASE_B)) {
-			p_ptr = gl_get_property(curr->obj, "voltage_B");
-			meter_voltage = get_observed_double_value(curr->obj, p_ptr);
-			p_ptr = gl_get_property(curr->ref_obj, "nominal_voltage");
-			xfrmr_nominal = get_observed_double_value(curr->ref_obj, p_ptr);
-			p_ptr = gl_get_property(curr->ref_obj, "voltage_B");
-			xfrmr_voltage = get_observed_double_value(curr->ref_obj, p_ptr);
-			pu = meter_voltage/meter_nominal-xfrmr_voltage/xfrmr_nominal;
-			if (fails_static_condition(pu, pu_upper_bound, pu_lower_bound, 1.0, &retval)) {
-				comm_meter_list_v7->insert(curr->obj->name);
-				increment_violation(VIOLATION7, CMTR);
-				write_to_stream(t1, echo, "VIOLATION7, %f, %f, %f, %s %s, %s %s, B, Per unit voltage difference between objects violates limit.", retval, pu_upper_bound, pu_lower_bound, gl_name(curr->obj, metername, 127), gl_name(curr->ref_obj, xfrmrname, 127), curr->obj->oclass->name, curr->ref_obj->oclass->name);
-			}
-		}
-		if (has_phase(curr->obj, PHASE_C)) {
-			p_ptr = gl_get_property(curr->obj, "voltage_C");
-			meter_voltage = get_observed_double_value(curr->obj, p_ptr);
-			p_ptr = gl_get_property(curr->ref_obj, "nominal_voltage");
-			xfrmr_nominal = get_observed_double_value(curr->ref_obj, p_ptr);
-			p_ptr = gl_get_property(curr->ref_obj, "voltage_C");
-			xfrmr_voltage = get_observed_double_value(curr->ref_obj, p_ptr);
-			pu = meter_voltage/meter_nominal-xfrmr_voltage/xfrmr_nominal;
-			if (fails_static_condition(pu, pu_upper_bound, pu_lower_bound, 1.0, &retval)) {
-				comm_meter_list_v7->insert(curr->obj->name);
-				increment_violation(VIOLATION7, CMTR);
-				write_to_stream(t1, echo, "VIOLATION7, %f, %f, %f, %s %s, %s %s, C, Per unit voltage difference between objects violates limit.", retval, pu_upper_bound, pu_lower_bound, gl_name(curr->obj, metername, 127), gl_name(curr->ref_obj, xfrmrname, 127), curr->obj->oclass->name, curr->ref_obj->oclass->name);
-			}
-		}
+	for(i = 0; i < checks->count; i++){
+		if (checks->fails[i] == 0) continue;
+		checks->uniq[i]->insert(checks->obj[i]->name);
+		increment_violation(VIOLATION7, checks->type[i]);
+		write_to_stream(t1, echo, "VIOLATION7, %f, %f, %f, %s %s, %s %s, %s, Per unit voltage difference between objects violates limit.", checks->pu[i], pu_upper_bound, pu_lower_bound, gl_name(checks->obj[i], metername, 127), gl_name(checks->ref[i], xfrmrname, 127), checks->obj[i]->oclass->name, checks->ref[i]->oclass->name, checks->phase[i]);
 	}
 
 	return 1;
@@ -1134,14 +745,7 @@ int violation_recorder::fails_static_condition (double value, double upper_bound
 	return 0;
 }
 
-int violation_recorder::fails_dynamic_condition (vobjlist *curr, int i, PROPERTYNAME prop_name, TIMESTAMP t1, double interval, double upper_bound, double lower_bound, double normalization_value, double *retval) {
-	PROPERTY *p_ptr;
-	double value, pu;
-	p_ptr = gl_get_property(curr->obj, prop_name);
-	if (p_ptr == NULL)
-		return 0;
-	value = get_observed_double_value(curr->obj, p_ptr);
-	pu = value/normalization_value;
+int violation_recorder::fails_dynamic_condition (vobjlist *curr, int i, double pu, TIMESTAMP t1, double interval, double upper_bound, double lower_bound, double *retval) {
 	if (curr->last_t[i] == 0) {
 		// this one can not violate on the first timestep
 		curr->update_last(i, pu, t1, 0);
@@ -1175,15 +779,8 @@ int violation_recorder::fails_dynamic_condition (vobjlist *curr, int i, PROPERTY
 	return 0;
 }
 
-int violation_recorder::fails_continuous_condition (vobjlist *curr, int i, PROPERTYNAME prop_name, TIMESTAMP t1, double interval, double upper_bound, double lower_bound, double normalization_value, double *retval) {
-	PROPERTY *p_ptr;
-	double value, pu;
-	p_ptr = gl_get_property(curr->obj, prop_name);
-	if (p_ptr == NULL)
-		return 0;
+int violation_recorder::fails_continuous_condition (vobjlist *curr, int i, double pu, TIMESTAMP t1, double interval, double upper_bound, double lower_bound, double *retval) {
 	int s_curr = 0, s_prev = 0;
-	value = get_observed_double_value(curr->obj, p_ptr);
-	pu = value/normalization_value;
 	*retval = pu;
 	// first time through
 	if (curr->last_t[i] == 0) {
@@ -1234,6 +831,252 @@ int violation_recorder::has_phase(OBJECT *obj, int phase)
 	return 0;
 }
 
+// appends one check on a complex property, returns 0 if the array is full
+int violation_recorder::add_check(vcheckarray *checks, OBJECT *obj, PROPERTY *p_value, double *nominal, double scale, const char *phase, int type, uniqueList *uniq_list, vobjlist *history, int slot)
+{
+	if (p_value == NULL || p_value->ptype != PT_complex || nominal == NULL)
+		return 1;
+	if (checks->count >= checks->size) {
+		gl_error("violation_recorder::add_check(): too many checks for the space allocated");
+		return 0;
+	}
+	checks->obj[checks->count] = obj;
+	checks->ref[checks->count] = NULL;
+	checks->value[checks->count] = gl_get_complex(obj, p_value);
+	checks->nominal[checks->count] = nominal;
+	checks->scale[checks->count] = scale;
+	checks->ref_value[checks->count] = NULL;
+	checks->ref_nominal[checks->count] = NULL;
+	checks->phase[checks->count] = phase;
+	checks->type[checks->count] = type;
+	checks->uniq[checks->count] = uniq_list;
+	checks->history[checks->count] = history;
+	checks->slot[checks->count] = slot;
+	checks->count++;
+	return 1;
+}
+
+// resolves the voltage and nominal voltage of each connected phase in the list
+int violation_recorder::add_voltage_checks(vcheckarray *checks, vobjlist *list, int type, uniqueList *uniq_list, bool triplex)
+{
+	static const int three_phase[] = {PHASE_A, PHASE_B, PHASE_C};
+	static const char *three_phase_prop[] = {"voltage_A", "voltage_B", "voltage_C"};
+	static const char *three_phase_label[] = {"A", "B", "C"};
+	static const int split_phase[] = {PHASE_S1|PHASE_S2};
+	static const char *split_phase_prop[] = {"voltage_12"};
+	static const char *split_phase_label[] = {"S"};
+	const int *phase_flag = triplex ? split_phase : three_phase;
+	const char **prop_name = triplex ? split_phase_prop : three_phase_prop;
+	const char **phase_label = triplex ? split_phase_label : three_phase_label;
+	int n_phases = triplex ? 1 : 3;
+	vobjlist *curr = 0;
+	PROPERTY *p_nominal;
+	int i;
+
+	for(curr = list; curr != 0; curr = curr->next){
+		if (curr->obj == 0) continue;
+		p_nominal = gl_get_property(curr->obj, "nominal_voltage");
+		if (p_nominal == NULL || p_nominal->ptype != PT_double) continue;
+		for(i = 0; i < n_phases; i++){
+			if (!has_phase(curr->obj, phase_flag[i])) continue;
+			// the continuous check keeps one history slot per object
+			if (add_check(checks, curr->obj, gl_get_property(curr->obj, prop_name[i]), gl_get_double(curr->obj, p_nominal), triplex ? 2. : 1., phase_label[i], type, uniq_list, curr, 0) == 0)
+				return 0;
+		}
+	}
+	return 1;
+}
+
+// resolves the current and conductor rating of each line phase in the list
+int violation_recorder::add_line_thermal_checks(vcheckarray *checks, vobjlist *list, int type, uniqueList *uniq_list)
+{
+	static const int three_phase[] = {PHASE_A, PHASE_B, PHASE_C};
+	static const char *current_prop[] = {"current_out_A", "current_out_B", "current_out_C"};
+	static const char *three_phase_label[] = {"A", "B", "C"};
+	static const char *split_phase_label[] = {"S1", "S2"};
+	vobjlist *curr = 0;
+	OBJECT *conductor[3];
+	double *rating;
+	int i;
+
+	for(curr = list; curr != 0; curr = curr->next){
+		if (curr->obj == 0) continue;
+		if (has_phase(curr->obj, PHASE_S)) { // split phase line
+			triplex_line *pTriplex_line = OBJECTDATA(curr->obj,triplex_line);
+			if (pTriplex_line->configuration == NULL) continue;
+			triplex_line_configuration *pConfiguration1 = OBJECTDATA(pTriplex_line->configuration,triplex_line_configuration);
+			conductor[0] = pConfiguration1->phaseA_conductor;
+			conductor[1] = pConfiguration1->phaseB_conductor;
+			for(i = 0; i < 2; i++){
+				if (conductor[i] == NULL) continue;
+				rating = &(OBJECTDATA(conductor[i],triplex_line_conductor)->summer.continuous);
+				if (add_check(checks, curr->obj, gl_get_property(curr->obj, (PROPERTYNAME)current_prop[i]), rating, 1., split_phase_label[i], type, uniq_list, curr, i) == 0)
+					return 0;
+			}
+		} else { // 'normal' 3-phase line
+			line *pThree_phase_line = OBJECTDATA(curr->obj,line);
+			if (pThree_phase_line->configuration == NULL) continue;
+			line_configuration *pConfiguration1 = OBJECTDATA(pThree_phase_line->configuration,line_configuration);
+			conductor[0] = pConfiguration1->phaseA_conductor;
+			conductor[1] = pConfiguration1->phaseB_conductor;
+			conductor[2] = pConfiguration1->phaseC_conductor;
+			for(i = 0; i < 3; i++){
+				if (!has_phase(curr->obj, three_phase[i])) continue;
+				// fall back to the configuration rating when the conductor is not given
+				if (conductor[i] == NULL)
+					rating = &(pConfiguration1->summer.continuous);
+				else if (gl_object_isa(curr->obj,"underground_line","powerflow"))
+					rating = &(OBJECTDATA(conductor[i],underground_line_conductor)->summer.continuous);
+				else
+					rating = &(OBJECTDATA(conductor[i],overhead_line_conductor)->summer.continuous);
+				if (add_check(checks, curr->obj, gl_get_property(curr->obj, (PROPERTYNAME)current_prop[i]), rating, 1., three_phase_label[i], type, uniq_list, curr, i) == 0)
+					return 0;
+			}
+		}
+	}
+	return 1;
+}
+
+// resolves the power and kVA rating of each transformer phase in the list
+int violation_recorder::add_xfrmr_thermal_checks(vcheckarray *checks, vobjlist *list, int type, uniqueList *uniq_list)
+{
+	static const int three_phase[] = {PHASE_A, PHASE_B, PHASE_C};
+	static const char *power_prop[] = {"power_out_A", "power_out_B", "power_out_C"};
+	static const char *three_phase_label[] = {"A", "B", "C"};
+	vobjlist *curr = 0;
+	double *rating[3];
+	int i;
+
+	for(curr = list; curr != 0; curr = curr->next){
+		if (curr->obj == 0) continue;
+		transformer *pTransformer = OBJECTDATA(curr->obj,transformer);
+		if (pTransformer->configuration == NULL) continue;
+		transformer_configuration *pConfiguration = OBJECTDATA(pTransformer->configuration,transformer_configuration);
+		// this is for the triplex transformers b/c phase is meaningless
+		if (has_phase(curr->obj, PHASE_S)) {
+			if (add_check(checks, curr->obj, gl_get_property(curr->obj, "power_out"), &(pConfiguration->kVA_rating), 1000., "S", type, uniq_list, curr, 0) == 0)
+				return 0;
+		// this is for the other transformers which have 3 phases, each of which can violate the limit
+		} else {
+			rating[0] = &(pConfiguration->phaseA_kVA_rating);
+			rating[1] = &(pConfiguration->phaseB_kVA_rating);
+			rating[2] = &(pConfiguration->phaseC_kVA_rating);
+			for(i = 0; i < 3; i++){
+				if (!has_phase(curr->obj, three_phase[i])) continue;
+				if (add_check(checks, curr->obj, gl_get_property(curr->obj, (PROPERTYNAME)power_prop[i]), rating[i], 1000., three_phase_label[i], type, uniq_list, curr, i) == 0)
+					return 0;
+			}
+		}
+	}
+	return 1;
+}
+
+// resolves the output voltage of each inverter phase in the list
+int violation_recorder::add_inverter_checks(vcheckarray *checks, vobjlist *list)
+{
+	static const int three_phase[] = {PHASE_A, PHASE_B, PHASE_C};
+	static const char *voltage_prop[] = {"phaseA_V_Out", "phaseB_V_Out", "phaseC_V_Out"};
+	static const char *three_phase_label[] = {"A", "B", "C"};
+	static double unit_nominal = 1.0;
+	vobjlist *curr = 0;
+	int i;
+
+	for(curr = list; curr != 0; curr = curr->next){
+		if (curr->obj == 0) continue;
+		if (has_phase(curr->obj, PHASE_S)) { // inverter connected to a triplex system, only checking one phase here
+			if (add_check(checks, curr->obj, gl_get_property(curr->obj, "phaseB_V_Out"), &unit_nominal, 1., "S", INVT, inverter_list_v6, curr, 1) == 0) // this is S1 !?!
+				return 0;
+		} else { // assume we are a three phase inverter
+			for(i = 0; i < 3; i++){
+				if (!has_phase(curr->obj, three_phase[i])) continue;
+				if (add_check(checks, curr->obj, gl_get_property(curr->obj, (PROPERTYNAME)voltage_prop[i]), &unit_nominal, 1., three_phase_label[i], INVT, inverter_list_v6, curr, i) == 0)
+					return 0;
+			}
+		}
+	}
+	return 1;
+}
+
+// resolves the meter voltages and the primary node voltages they are compared to
+int violation_recorder::add_voltage_rise_checks(vcheckarray *checks, vobjlist *list, int type, uniqueList *uniq_list, bool triplex)
+{
+	static const int three_phase[] = {PHASE_A, PHASE_B, PHASE_C};
+	static const char *three_phase_prop[] = {"voltage_A", "voltage_B", "voltage_C"};
+	static const char *three_phase_label[] = {"A", "B", "C"};
+	static const int split_phase[] = {PHASE_S1, PHASE_S2};
+	static const char *split_phase_prop[] = {"voltage_1", "voltage_2"};
+	static const char *split_phase_label[][3] = {{"A S1", "B S1", "C S1"}, {"A S2", "B S2", "C S2"}};
+	vobjlist *curr = 0;
+	PROPERTY *p_nominal, *p_ref_nominal, *p_value, *p_ref_value;
+	int i, j;
+
+	for(curr = list; curr != 0; curr = curr->next){
+		if (curr->obj == 0) continue;
+		if (curr->ref_obj == 0) continue;
+		p_nominal = gl_get_property(curr->obj, "nominal_voltage");
+		p_ref_nominal = gl_get_property(curr->ref_obj, "nominal_voltage");
+		if (p_nominal == NULL || p_nominal->ptype != PT_double || p_ref_nominal == NULL || p_ref_nominal->ptype != PT_double) continue;
+		// triplex meters compare each secondary line to every primary phase of the meter
+		for(i = 0; i < (triplex ? 2 : 1); i++){
+			if (triplex && !has_phase(curr->obj, split_phase[i])) continue;
+			for(j = 0; j < 3; j++){
+				if (!has_phase(curr->obj, three_phase[j])) continue;
+				p_value = gl_get_property(curr->obj, (PROPERTYNAME)(triplex ? split_phase_prop[i] : three_phase_prop[j]));
+				p_ref_value = gl_get_property(curr->ref_obj, (PROPERTYNAME)three_phase_prop[j]);
+				if (p_value == NULL || p_value->ptype != PT_complex || p_ref_value == NULL || p_ref_value->ptype != PT_complex) continue;
+				if (add_check(checks, curr->obj, p_value, gl_get_double(curr->obj, p_nominal), 1., triplex ? split_phase_label[i][j] : three_phase_label[j], type, uniq_list, curr, j) == 0)
+					return 0;
+				checks->ref[checks->count-1] = curr->ref_obj;
+				checks->ref_value[checks->count-1] = gl_get_complex(curr->ref_obj, p_ref_value);
+				checks->ref_nominal[checks->count-1] = gl_get_double(curr->ref_obj, p_ref_nominal);
+			}
+		}
+	}
+	return 1;
+}
+
+// per unit test of every check against the bounds, returns the number of failures
+int violation_recorder::evaluate_static_checks(vcheckarray *checks, double upper_bound, double lower_bound)
+{
+	int i, n_fails = 0;
+
+	for(i = 0; i < checks->count; i++){
+		const double value = checks->value[i]->Mag();
+		const double normalization_value = *(checks->nominal[i]) * checks->scale[i];
+		const double pu = (normalization_value != 0. && normalization_value != 1.) ? value/normalization_value : value;
+		const unsigned char fails = (pu > upper_bound) | (pu < lower_bound);
+		checks->pu[i] = pu;
+		checks->fails[i] = fails;
+		n_fails += fails;
+	}
+	return n_fails;
+}
+
+// per unit difference between each check and its reference against the bounds, returns the number of failures
+int violation_recorder::evaluate_difference_checks(vcheckarray *checks, double upper_bound, double lower_bound)
+{
+	int i, n_fails = 0;
+
+	for(i = 0; i < checks->count; i++){
+		const double pu = checks->value[i]->Mag()/(*(checks->nominal[i]) * checks->scale[i]) - checks->ref_value[i]->Mag()/(*(checks->ref_nominal[i]));
+		const unsigned char fails = (pu > upper_bound) | (pu < lower_bound);
+		checks->pu[i] = pu;
+		checks->fails[i] = fails;
+		n_fails += fails;
+	}
+	return n_fails;
+}
+
+// per unit value of every check, the time conditions are applied by the caller
+void violation_recorder::evaluate_per_unit(vcheckarray *checks)
+{
+	int i;
+
+	for(i = 0; i < checks->count; i++){
+		checks->pu[i] = checks->value[i]->Mag()/(*(checks->nominal[i]) * checks->scale[i]);
+	}
+}
+
 int violation_recorder::increment_violation(int number) {
 	violation_count[(int)l2(number)][0]++;
 	return 1;
@@ -1537,6 +1380,49 @@ uniqueList *violation_recorder::uniqueList_alloc_fxn(uniqueList *input_unlist)
 	return input_unlist;
 }
 
+//Allocate a vcheckarray with room for size checks
+vcheckarray *violation_recorder::vcheckarray_alloc_fxn(int size)
+{
+	OBJECT *obj = THISOBJECTHDR;
+	vcheckarray *checks = (vcheckarray *)gl_malloc(sizeof(vcheckarray));
+
+	if (checks != NULL)
+	{
+		if (size < 1)
+			size = 1;
+		checks->count = 0;
+		checks->size = size;
+		checks->obj = (OBJECT **)gl_malloc(sizeof(OBJECT *)*size);
+		checks->ref = (OBJECT **)gl_malloc(sizeof(OBJECT *)*size);
+		checks->value = (complex **)gl_malloc(sizeof(complex *)*size);
+		checks->nominal = (double **)gl_malloc(sizeof(double *)*size);
+		checks->scale = (double *)gl_malloc(sizeof(double)*size);
+		checks->ref_value = (complex **)gl_malloc(sizeof(complex *)*size);
+		checks->ref_nominal = (double **)gl_malloc(sizeof(double *)*size);
+		checks->phase = (const char **)gl_malloc(sizeof(const char *)*size);
+		checks->type = (int *)gl_malloc(sizeof(int)*size);
+		checks->uniq = (uniqueList **)gl_malloc(sizeof(uniqueList *)*size);
+		checks->history = (vobjlist **)gl_malloc(sizeof(vobjlist *)*size);
+		checks->slot = (int *)gl_malloc(sizeof(int)*size);
+		checks->pu = (double *)gl_malloc(sizeof(double)*size);
+		checks->fails = (unsigned char *)gl_malloc(sizeof(unsigned char)*size);
+	}
+
+	//Check it
+	if (checks == NULL || checks->obj == NULL || checks->ref == NULL || checks->value == NULL || checks->nominal == NULL || checks->scale == NULL
+		|| checks->ref_value == NULL || checks->ref_nominal == NULL || checks->phase == NULL || checks->type == NULL || checks->uniq == NULL
+		|| checks->history == NULL || checks->slot == NULL || checks->pu == NULL || checks->fails == NULL)
+	{
+		GL_THROW("violation_recorder:%d %s - Failed to allocate space for voltage checks",obj->id,obj->name ? obj->name : "Unnamed");
+		/*  TROUBLESHOOT
+		While attempting to allocate the memory for the voltage checks within the violation recorder, an error occurred.  Please check your
+		file and try again.  If the error persists, please submit you code and a bug report via the ticketing system.
+		*/
+	}
+
+	return checks;
+}
+
 //////////////////////////////
 
 
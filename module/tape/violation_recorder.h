@@ -199,6 +199,32 @@ public:
 	}
 };
 
+/** Limit checks with their property addresses resolved at init.
+	Entries are stored in the same order as the object list scan so that
+	the violations are reported in the same order as before.  Checks against
+	a reference object (secondary voltage rise) also fill the ref_ arrays, and
+	checks with a time condition keep their history in the vobjlist entry.
+ **/
+class vcheckarray{
+public:
+	int count;
+	int size;
+	OBJECT **obj;			/**< object checked */
+	OBJECT **ref;			/**< reference object, if any */
+	complex **value;		/**< observed value */
+	double **nominal;		/**< normalization value */
+	double *scale;			/**< multiplier applied to the normalization value */
+	complex **ref_value;	/**< observed value of the reference object */
+	double **ref_nominal;	/**< normalization value of the reference object */
+	const char **phase;		/**< phase label used in the report */
+	int *type;				/**< object type used to count violations */
+	uniqueList **uniq;		/**< list of objects with violations */
+	vobjlist **history;		/**< list entry holding the last value, time and sign */
+	int *slot;				/**< history slot used by the check */
+	double *pu;				/**< per unit value of the last check */
+	unsigned char *fails;	/**< nonzero if the last check failed */
+};
+
 class violation_recorder{
 public:
 	static violation_recorder *defaults;
@@ -256,8 +282,7 @@ private:
 	int check_violation_6(TIMESTAMP);
 	int check_violation_7(TIMESTAMP);
 	int check_violation_8(TIMESTAMP);
-	int check_line_thermal_limit(TIMESTAMP, vobjlist *, uniqueList *, int, double, double);
-	int check_xfrmr_thermal_limit(TIMESTAMP, vobjlist *, uniqueList *, int, double, double);
+	int report_thermal_violations(TIMESTAMP, vcheckarray *, double, double, const char *);
 	int check_reverse_flow_violation(TIMESTAMP, int, double, const char*);
 	int write_to_stream (TIMESTAMP, bool, const char *, ...);
 	double get_observed_double_value(OBJECT *, PROPERTY *);
@@ -266,10 +291,20 @@ private:
 	int assoc_meter_w_xfrmr_node(vobjlist *, vobjlist *, vobjlist *);
 	int find_substation_node(char256, vobjlist *);
 	int has_phase(OBJECT *, int);
+	vcheckarray *vcheckarray_alloc_fxn(int);
+	int add_check(vcheckarray *, OBJECT *, PROPERTY *, double *, double, const char *, int, uniqueList *, vobjlist *, int);
+	int add_voltage_checks(vcheckarray *, vobjlist *, int, uniqueList *, bool);
+	int add_line_thermal_checks(vcheckarray *, vobjlist *, int, uniqueList *);
+	int add_xfrmr_thermal_checks(vcheckarray *, vobjlist *, int, uniqueList *);
+	int add_inverter_checks(vcheckarray *, vobjlist *);
+	int add_voltage_rise_checks(vcheckarray *, vobjlist *, int, uniqueList *, bool);
+	int evaluate_static_checks(vcheckarray *, double, double);
+	int evaluate_difference_checks(vcheckarray *, double, double);
+	void evaluate_per_unit(vcheckarray *);
 	int fails_static_condition (OBJECT *, PROPERTYNAME, double, double, double, double *);
 	int fails_static_condition (double, double, double, double, double *);
-	int fails_dynamic_condition (vobjlist *, int, PROPERTYNAME, TIMESTAMP, double, double, double, double, double *);
-	int fails_continuous_condition (vobjlist *, int, PROPERTYNAME, TIMESTAMP, double, double, double, double, double *);
+	int fails_dynamic_condition (vobjlist *, int, double, TIMESTAMP, double, double, double, double *);
+	int fails_continuous_condition (vobjlist *, int, double, TIMESTAMP, double, double, double, double *);
 	int increment_violation (int);
 	int increment_violation (int, int);
 	int get_violation_count(int);
@@ -318,6 +353,12 @@ private:
 	uniqueList *inverter_list_v6;
 	uniqueList *tplx_meter_list_v7;
 	uniqueList *comm_meter_list_v7;
+	vcheckarray *xfrmr_checks_v1;
+	vcheckarray *line_checks_v1;
+	vcheckarray *voltage_checks_v2;
+	vcheckarray *voltage_checks_v3;
+	vcheckarray *inverter_checks_v6;
+	vcheckarray *voltage_rise_checks_v7;
 
 	int write_count;
 	TIMESTAMP next_write;
@@ -0,0 +1,17 @@
+import numpy as np
+
+def driver_init(obj,t):
+
+    x = gldcore.property_array("test","x")
+    assert(len(x) == 3)
+    values = np.asarray(x)
+    values += 1
+    assert((np.asarray(x) == values).all()) # uncommitted writes are not re-gathered
+    x.commit()
+
+    z = gldcore.property_array("test","z")
+    values = np.asarray(z)
+    values *= 2
+    z.commit()
+
+    return 0
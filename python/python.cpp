@@ -10,6 +10,7 @@
 #include <frameobject.h>
 #include "python_embed.h"
 #include "python_property.h"
+#include "python_property_array.h"
 
 SET_MYCONTEXT(DMC_PYTHON)
 
@@ -55,6 +56,7 @@ static PyObject *gridlabd_get_int64(PyObject *self, PyObject *args);
 static PyObject *gridlabd_get_int32(PyObject *self, PyObject *args);
 static PyObject *gridlabd_get_int16(PyObject *self, PyObject *args);
 static PyObject *gridlabd_get_bool(PyObject *self, PyObject *args);
+static PyObject *gridlabd_property_array(PyObject *self, PyObject *args);
 
 static PyObject *gridlabd_set_global(PyObject *self, PyObject *args);
 static PyObject *gridlabd_set_value(PyObject *self, PyObject *args);
@@ -118,6 +120,7 @@ static PyMethodDef module_methods[] = {
     {"get_int32", gridlabd_get_int32, METH_VARARGS, "Get a GridLAB-D object property value as an int32"},
     {"get_int16", gridlabd_get_int16, METH_VARARGS, "Get a GridLAB-D object property value as an int16"},
     {"get_bool", gridlabd_get_bool, METH_VARARGS, "Get a GridLAB-D object property value as a bool"},
+    {"property_array", gridlabd_property_array, METH_VARARGS, "Get a GridLAB-D property of a class or group of objects as an array buffer"},
     // sets
     {"set_global", gridlabd_set_global, METH_VARARGS, "Set a GridLAB-D global variable"},
     {"set_value", gridlabd_set_value, METH_VARARGS, "Set a GridLAB-D object property"},
@@ -407,6 +410,16 @@ PyMODINIT_FUNC PyInit_gldcore(void)
         return NULL;
     }
     Py_INCREF(proptype);
+    PyObject *arraytype = python_property_array_gettype();
+    if ( PyType_Ready((PyTypeObject*)arraytype) < 0 )
+    {
+        return NULL;
+    }
+    if ( PyModule_AddObject(this_module,"property_array_type",arraytype) < 0 )
+    {
+        return NULL;
+    }
+    Py_INCREF(arraytype);
     char version[1024];
     snprintf(version,sizeof(version)-1,"%d.%d.%d-%d",global_version_major,global_version_minor,global_version_patch,global_version_build);
     PyModule_AddObject(this_module,"__version__",Py_BuildValue("s",version));
@@ -1599,6 +1612,18 @@ static PyObject *gridlabd_get_bool(PyObject *self, PyObject *args)
         Py_RETURN_FALSE;
 }
 
+//
+// >>> gridlabd.property_array(class_or_group,property)
+//
+// Returns: buffer of the property values (use numpy.asarray() to get a vector)
+//
+static PyObject *gridlabd_property_array(PyObject *self, PyObject *args)
+{
+    restore_environ();
+    ReadLock rlock;
+    return PyObject_CallObject(python_property_array_gettype(),args);
+}
+
 static PyObject *gridlabd_set_double(PyObject *self, PyObject *args)
 {
     double *addr;
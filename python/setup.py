@@ -97,6 +97,7 @@ gldcore = Extension('gldcore',
 		'source/property.cpp',
 		'source/python_embed.cpp',
 		'source/python_property.cpp',
+		'source/python_property_array.cpp',
 		'source/random.cpp',
 		'source/realtime.cpp',
 		'source/sanitize.cpp',
@@ -785,6 +785,7 @@ struct s_object_list {
 	LOCKVAR lock; /**< object lock */
 	unsigned int rng_state; /**< random number generator state */
 	TIMESTAMP heartbeat; /**< heartbeat call interval (in sim-seconds) */
+	TIMESTAMP event_tolerance; /**< time by which the object's soft events may be delayed (0 uses the event_tolerance global) */
 	unsigned long long guid[2]; /**< globally unique identifier */
 	EVENTHANDLERS events;
 	/* IMPORTANT: flags must be last */
@@ -1007,6 +1008,7 @@ typedef struct s_enduse {
 #define OF_FORECAST 0x0040 /**< Object flag; inidcates that the object has a valid forecast available */
 #define OF_DEFERRED	0x0080	/**< Object flag; indicates that the object started to be initialized, but requested deferral */
 #define OF_INIT		0x0100	/**< Object flag; indicates that the object has been successfully initialized */
+#define OF_COALESCE	0x0200	/**< Object flag; indicates that the object's events may be delayed by up to event_tolerance */
 #define OF_RERANK	0x4000 /**< Internal use only */
 #define OF_QUIET		0x00010000  /**< Object flag; disables error messages from the object */
 #define OF_WARNING		0x00020000  /**< Object flag; enables warning messages from the object */
@@ -1187,6 +1189,9 @@ typedef struct s_transform {
 	struct s_transform *next; ///* next item in linked list
 } TRANSFORM;
 
+typedef struct s_tpbatch TPBATCH; /**< core thread pool batch */
+typedef void (*TPTASKCALL)(void*,unsigned int); /**< core thread pool task call (data, task number) */
+
 typedef struct s_callbacks {
 	TIMESTAMP *global_clock;
 	double *global_delta_curr_clock;
@@ -1426,6 +1431,13 @@ typedef struct s_callbacks {
 		bool (*call)(PyObject *pModule, const char *method, const char *vargsfmt, va_list varargs, void *result);
 		PyObject *(*property_type)(void);
 	} python;
+	struct {
+		TPBATCH *(*batch)(const char *name);
+		void (*submit)(TPBATCH *batch, TPTASKCALL call, void *data, unsigned int n_tasks);
+		void (*wait)(TPBATCH *batch);
+		void (*run)(TPBATCH *batch, TPTASKCALL call, void *data, unsigned int n_tasks);
+		unsigned int (*size)(void);
+	} threadpool;
 	long unsigned int magic; /* used to check structure alignment */
 } CALLBACKS; /**< core callback function table */
 
@@ -1593,6 +1605,10 @@ inline double gl_random_gamma(double a) { return callback->random.gamma(NULL,a);
 inline double gl_random_weibull(double a, double b) { return callback->random.weibull(NULL,a,b);};
 inline double gl_random_rayleigh(double a) { return callback->random.rayleigh(NULL,a);};
 
+inline TPBATCH *gl_threadpool_batch(const char *name) { return callback->threadpool.batch(name);};
+inline void gl_threadpool_run(TPBATCH *batch, TPTASKCALL call, void *data, unsigned int n_tasks) { callback->threadpool.run(batch,call,data,n_tasks);};
+inline unsigned int gl_threadpool_size(void) { return callback->threadpool.size();};
+
 inline bool gl_object_isa(OBJECT *obj, char *type) { return callback->object_isa(obj,type)==1;};
 inline DATETIME *gl_localtime(TIMESTAMP ts,DATETIME *dt) { return callback->time.local_datetime(ts,dt)?dt:NULL;};
 inline DATETIME *gl_localtime_delta(double ts,DATETIME *dt) { return callback->time.local_datetime_delta(ts,dt)?dt:NULL;};
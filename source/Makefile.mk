@@ -50,6 +50,7 @@ gridlabd_bin_SOURCES += source/platform.h
 gridlabd_bin_SOURCES += source/property.cpp source/property.h
 gridlabd_bin_SOURCES += source/python_embed.cpp source/python_embed.h
 gridlabd_bin_SOURCES += source/python_property.cpp source/python_property.h
+gridlabd_bin_SOURCES += source/python_property_array.cpp source/python_property_array.h
 gridlabd_bin_SOURCES += source/random.cpp source/random.h
 gridlabd_bin_SOURCES += source/realtime.cpp source/realtime.h
 gridlabd_bin_SOURCES += source/sanitize.cpp source/sanitize.h
@@ -0,0 +1,67 @@
+import json
+import sys
+import datetime
+
+savefile = sys.argv[1] if len(sys.argv) > 1 else "gridlabd.json"
+tolerance = int(sys.argv[2]) if len(sys.argv) > 2 else 0
+with open(savefile) as f:
+	data = json.load(f)
+
+def get(name):
+	return int(data["globals"][name]["value"])
+
+delayed = get("event_coalesced")
+delay_max = get("event_delay_max")
+if delayed <= 0:
+	raise Exception(f"no events were coalesced (event_coalesced={delayed})")
+if delay_max > tolerance:
+	raise Exception(f"event delayed by more than the tolerance (event_delay_max={delay_max}, tolerance={tolerance})")
+
+def load(file):
+	rows = []
+	with open(file) as f:
+		for line in f:
+			if line.startswith("#"):
+				continue
+			values = line.strip().split(",")
+			t = datetime.datetime.strptime(values[0][:19],"%Y-%m-%d %H:%M:%S").timestamp()
+			rows.append([t] + values[1:])
+	return rows
+
+def transitions(rows):
+	result = []
+	for n in range(1,len(rows)):
+		if rows[n][1] != rows[n-1][1]:
+			result.append((rows[n][0],rows[n][1],float(rows[n][2])))
+	return result
+
+# thermostat events may be late by up to each house's tolerance
+slopes = {}
+for house,window in [(1,tolerance),(2,tolerance),(3,0),(4,0)]:
+	exact = load(f"house_{house}_0.csv")
+	slope = max([abs(float(b[2])-float(a[2]))/(b[0]-a[0]) for a,b in zip(exact[:-1],exact[1:])])
+	slopes[house] = slope
+	events = transitions(exact)
+	result = transitions(load(f"house_{house}_{tolerance}.csv"))
+	if [x[1] for x in result] != [x[1] for x in events]:
+		raise Exception(f"house_{house} thermostat modes differ from the exact run")
+	lag = 0
+	for (t0,mode,T0),(t1,_,T1) in zip(events,result):
+		delay = (t1-t0) - lag
+		lag = t1-t0
+		if delay < -1 or delay > window+1:
+			raise Exception(f"house_{house} switched to {mode} {delay:.0f} s late (tolerance={window})")
+		if abs(T1-T0) > slope*(abs(lag)+1):
+			raise Exception(f"house_{house} switched to {mode} at {T1} instead of {T0}")
+
+# recorder samples are hard events and are never delayed
+samples = load(f"sampler_{tolerance}.csv")
+for a,b in zip(samples[:-1],samples[1:]):
+	if b[0]-a[0] != 300:
+		raise Exception(f"sampler skipped or delayed a sample at {b[0]}")
+reference = load("sampler_0.csv")
+if len(samples) != len(reference):
+	raise Exception(f"sampler recorded {len(samples)} samples instead of {len(reference)}")
+for a,b in zip(reference,samples):
+	if a[0] != b[0] or abs(float(a[1])-float(b[1])) > slopes[3]*2:
+		raise Exception(f"sampler result at {b[0]} differs from the exact run")
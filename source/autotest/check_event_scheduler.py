@@ -0,0 +1,10 @@
+import json
+import sys
+
+savefile = sys.argv[1] if len(sys.argv) > 1 else "gridlabd.json"
+with open(savefile) as f:
+	data = json.load(f)
+
+skips = int(data["globals"]["event_skips"]["value"])
+if skips <= 0:
+	raise Exception(f"event scheduler did not skip any syncs (event_skips={skips})")
@@ -0,0 +1,16 @@
+import json
+
+with open("gridlabd.json") as f:
+	data = json.load(f)
+
+def get(name):
+	return int(data["globals"][name]["value"])
+
+tolerance = get("event_tolerance")
+delayed = get("event_coalesced")
+delay_max = get("event_delay_max")
+avoided = get("event_steps_avoided")
+if delayed <= 0 or avoided <= 0:
+	raise Exception(f"no events were coalesced (event_coalesced={delayed}, event_steps_avoided={avoided})")
+if delay_max > tolerance:
+	raise Exception(f"event delayed by more than the tolerance (event_delay_max={delay_max}, event_tolerance={tolerance})")
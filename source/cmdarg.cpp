@@ -2273,6 +2273,13 @@ DEPRECATED static int sublime_syntax(void *main, int argc, const char *argv[])
 
 DEPRECATED static int csvloadshape(void *main, int argc, const char *argv[])
 {
+	/* schedules must be complete before they can be generated */
+	if ( global_threadcount>1 && schedule_createwait()==FAILED )
+	{
+		output_error("unable to generate loadshape when a schedule error persists");
+		return CMDERR;
+	}
+
 	FILE *fh = stdout;
 	if ( strchr(argv[0],'=') )
 	{
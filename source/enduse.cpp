@@ -252,78 +252,35 @@ TIMESTAMP enduse_sync(enduse *e, PASSCONFIG pass, TIMESTAMP t1)
 }
 
 typedef struct s_endusesyncdata {
-	unsigned int n;
-	pthread_t pt;
-	bool ok;
 	enduse *e;
 	unsigned int ne;
-	TIMESTAMP t0;
-	unsigned int ran;
+	TIMESTAMP t2;
 } ENDUSESYNCDATA;
 
-static pthread_cond_t start_ed = PTHREAD_COND_INITIALIZER;
-static pthread_mutex_t startlock_ed = PTHREAD_MUTEX_INITIALIZER;
-static pthread_cond_t done_ed = PTHREAD_COND_INITIALIZER;
-static pthread_mutex_t donelock_ed = PTHREAD_MUTEX_INITIALIZER;
-static TIMESTAMP next_t1_ed, next_t2_ed;
-static unsigned int donecount_ed;
-static unsigned int run = 0;
+static TIMESTAMP next_t1_ed;
 
 clock_t enduse_synctime = 0;
 
-void *enduse_syncproc(void *ptr)
+static void enduse_synctask(void *ptr, unsigned int n)
 {
-	ENDUSESYNCDATA *data = (ENDUSESYNCDATA*)ptr;
+	ENDUSESYNCDATA *data = (ENDUSESYNCDATA*)ptr + n;
 	enduse *e;
-	unsigned int n;
-	TIMESTAMP t2;
+	unsigned int m;
 
-	// begin processing loop
-	while (data->ok) 
+	// process the list for this task
+	data->t2 = TS_NEVER;
+	for ( e = data->e, m = 0 ; e != NULL && m < data->ne ; e = e->next, m++ )
 	{
-		// lock access to start condition
-		pthread_mutex_lock(&startlock_ed);
-
-		// wait for thread start condition
-		while (data->t0==next_t1_ed && data->ran==run) 
-			pthread_cond_wait(&start_ed,&startlock_ed);
-		
-		// unlock access to start count
-		pthread_mutex_unlock(&startlock_ed);
-
-		// process the list for this thread
-		t2 = TS_NEVER;
-		for ( e = data->e, n = 0 ; e != NULL && n < data->ne ; e = e->next, n++ )
-		{
-			TIMESTAMP t = enduse_sync(e, PC_PRETOPDOWN, next_t1_ed);
-			if (t<t2) t2 = t;
-		}
-
-		// signal completed condition
-		data->t0 = next_t1_ed;
-		data->ran++;
-
-		// lock access to done condition
-		pthread_mutex_lock(&donelock_ed);
-
-		// signal thread is done for now
-		donecount_ed--;
-		if ( t2<next_t2_ed ) next_t2_ed = t2;
-
-		// signal change in done condition
-		pthread_cond_broadcast(&done_ed);
-
-		// unlock access to done count
-		pthread_mutex_unlock(&donelock_ed);
+		TIMESTAMP t = enduse_sync(e, PC_PRETOPDOWN, next_t1_ed);
+		if (t<data->t2) data->t2 = t;
 	}
-	pthread_exit((void*)0);
-	return (void*)0;
 }
 
 TIMESTAMP enduse_syncall(TIMESTAMP t1)
 {
 	static unsigned int n_threads_ed=0;
 	static ENDUSESYNCDATA *thread_ed = NULL;
+	static TPBATCH *batch_ed = NULL;
 	TIMESTAMP t2 = TS_NEVER;
 	clock_t ts = (clock_t)exec_clock();
 	
@@ -331,7 +288,7 @@ TIMESTAMP enduse_syncall(TIMESTAMP t1)
 	if (n_enduses == 0)
 		return TS_NEVER;
 
-	// number of threads desired
+	// number of tasks desired
 	if (n_threads_ed==0)
 	{
 		enduse *e;
@@ -339,32 +296,31 @@ TIMESTAMP enduse_syncall(TIMESTAMP t1)
 
 		IN_MYCONTEXT output_debug("enduse_syncall setting up for %d enduses", n_enduses);
 
-		// determine needed threads
-		n_threads_ed = global_threadcount;
+		// determine needed tasks
+		n_threads_ed = global_threadcount>1 ? threadpool_size() : 1;
 		if (n_threads_ed>1)
 		{
-			unsigned int n;
 			if (n_enduses<n_threads_ed*4)
 				n_threads_ed = n_enduses/4;
 
-			// only need 1 thread if n_enduses is less than 4
+			// only need 1 task if n_enduses is less than 4
 			if (n_threads_ed == 0)
 				n_threads_ed = 1;
 
-			// determine enduses per thread
+			// determine enduses per task
 			n_items = n_enduses/n_threads_ed;
 			n_threads_ed = n_enduses/n_items;
 			if (n_threads_ed*n_items<n_enduses) // not enough slots yet
-				n_threads_ed++; // add one underused thread
+				n_threads_ed++; // add one underused task
 
-			IN_MYCONTEXT output_debug("enduse_syncall is using %d of %d available threads", n_threads_ed,global_threadcount);
+			IN_MYCONTEXT output_debug("enduse_syncall is using %d of %d available threads", n_threads_ed,threadpool_size());
 			IN_MYCONTEXT output_debug("enduse_syncall is assigning %d enduses per thread", n_items);
 
-			// allocate thread list
+			// allocate task list
 			thread_ed = (ENDUSESYNCDATA*)malloc(sizeof(ENDUSESYNCDATA)*n_threads_ed);
 			memset(thread_ed,0,sizeof(ENDUSESYNCDATA)*n_threads_ed);
 
-			// assign starting enduse for each thread
+			// assign starting enduse for each task
 			for (e=enduse_list; e!=NULL; e=e->next)
 			{
 				if (thread_ed[en].ne==n_items)
@@ -373,19 +329,7 @@ TIMESTAMP enduse_syncall(TIMESTAMP t1)
 					thread_ed[en].e = e;
 				thread_ed[en].ne++;
 			}
-
-			// create threads
-			for (n=0; n<n_threads_ed; n++)
-			{
-				thread_ed[n].ok = true;
-				if (pthread_create(&(thread_ed[n].pt),NULL,enduse_syncproc,&(thread_ed[n]))!=0)
-				{
-					output_fatal("enduse_sync thread creation failed");
-					thread_ed[n].ok = false;
-				}
-				else 
-					thread_ed[n].n = n;
-			}
+			batch_ed = threadpool_batch("enduse");
 		}
 	}
 
@@ -399,40 +343,20 @@ TIMESTAMP enduse_syncall(TIMESTAMP t1)
 			TIMESTAMP t3 = enduse_sync(e, PC_PRETOPDOWN, t1);
 			if (t3<t2) t2 = t3;
 		}
-		next_t2_ed = t2;
 	}
 	else 
 	{
-		// lock access to done count
-		pthread_mutex_lock(&donelock_ed);
+		unsigned int n;
 
-		// initialize wait count
-		donecount_ed = n_threads_ed;
-
-		// lock access to start condition
-		pthread_mutex_lock(&startlock_ed);
-
-		// update start condition
+		// run the tasks on the thread pool
 		next_t1_ed = t1;
-		next_t2_ed = TS_NEVER;
-		run++;
-
-		// signal all the threads
-		pthread_cond_broadcast(&start_ed);
+		threadpool_run(batch_ed,enduse_synctask,thread_ed,n_threads_ed);
 
-		// unlock access to start count
-		pthread_mutex_unlock(&startlock_ed);
-
-		// begin wait 
-		while (donecount_ed>0)
-			pthread_cond_wait(&done_ed,&donelock_ed);
-		IN_MYCONTEXT output_debug("passed donecount==0 condition");
-
-		// unclock done count
-		pthread_mutex_unlock(&donelock_ed);
-
-		// process results from all threads
-		if (next_t2_ed<t2) t2=next_t2_ed;
+		// process results from all tasks
+		for (n=0; n<n_threads_ed; n++)
+		{
+			if (thread_ed[n].t2<t2) t2 = thread_ed[n].t2;
+		}
 	}
 
 	enduse_synctime += (clock_t)exec_clock() - ts;
@@ -195,10 +195,10 @@ DEPRECATED static int exec_commit_reject(MTI *mti, MTIDATA value)
 {
 	return my_instance->get_exec()->commit_reject(mti,value);
 }
-DEPRECATED static void *exec_obj_syncproc(void *ptr)
+DEPRECATED static void exec_obj_synctask(void *ptr, unsigned int n)
 {
-	OBJSYNCDATA *data = (OBJSYNCDATA*)ptr;
-	return data->main->get_exec()->obj_syncproc(data);
+	OBJSYNCDATA *data = (OBJSYNCDATA*)ptr + n;
+	data->main->get_exec()->obj_synctask(data);
 }
 DEPRECATED void *exec_slave_node_proc(void *args)
 {
@@ -407,12 +407,8 @@ GldExec::GldExec(GldMain *main)
 	pthread_cond_init(&mls_svr_signal,NULL);
 	mls_created = 0;
 	mls_destroyed = 0;
-	startlock = NULL;
-	donelock = NULL;
-	start = NULL;
-	done = NULL;
-	next_t1 = NULL;
-	donecount = NULL;
+	sync_tasks = NULL;
+	sync_batch = NULL;
 	n_threads = NULL; 
 	main_sync.step_to = TS_NEVER;
 	main_sync.hard_event = 0;
@@ -422,6 +418,20 @@ GldExec::GldExec(GldMain *main)
 	script_exports = NULL;
 	pass = 0;
 	iteration_counter = 0;
+	event_time = NULL;
+	event_iteration = NULL;
+	event_child_start = NULL;
+	event_children = NULL;
+	memset(event_rank_next,0,sizeof(event_rank_next));
+	memset(event_rank_hard,0,sizeof(event_rank_hard));
+	event_rank_touched = NULL;
+	memset(event_rank_scanned,0,sizeof(event_rank_scanned));
+	event_iteration_count = 0;
+	event_step_iteration = 0;
+	coalesce_time = NULL;
+	coalesce_iteration = NULL;
+	coalesce_delayed = NULL;
+	coalesce_count = 0;
 }
 
 #define PASSINIT(p) (p % 2 ? ranks[p]->first_used : ranks[p]->last_used)
@@ -442,13 +452,21 @@ GldExec::~GldExec(void)
 	free_simplelist(script_exports);
 	if ( thread_data ) free(thread_data);
 	if ( arg_data_array ) free(arg_data_array);
-	if ( next_t1 ) free(next_t1);
-	if ( donecount ) free(donecount);
 	if ( n_threads ) free(n_threads);
-	if ( startlock ) free(startlock);
-	if ( donelock ) free(donelock);
-	if ( start ) free(start);
-	if ( done ) free(done);
+	if ( event_time ) free(event_time);
+	if ( event_iteration ) free(event_iteration);
+	if ( event_child_start ) free(event_child_start);
+	if ( event_children ) free(event_children);
+	for ( int n = 0 ; n < 3 ; n++ )
+	{
+		if ( event_rank_next[n] ) free(event_rank_next[n]);
+		if ( event_rank_hard[n] ) free(event_rank_hard[n]);
+		if ( event_rank_scanned[n] ) free(event_rank_scanned[n]);
+	}
+	if ( event_rank_touched ) free(event_rank_touched);
+	if ( coalesce_time ) free(coalesce_time);
+	if ( coalesce_iteration ) free(coalesce_iteration);
+	if ( coalesce_delayed ) free(coalesce_delayed);
 }
 
 void GldExec::free_simplelist(SIMPLELIST *list)
@@ -795,8 +813,16 @@ void GldExec::ss_do_object_sync(int thread, void *item)
 	//printf("thread %d\t%d\t%s\n", thread, obj->rank, obj->name);
 	//this_t = object_sync(obj, global_clock, passtype[pass]);
 
+	/* event scheduler - skip-safe objects with nothing due keep their last event */
+	bool skipped = ( event_time != NULL && (obj->flags&OF_SKIPSAFE) && ! event_due(obj) );
+	if ( skipped )
+	{
+		this_t = event_time[obj->id];
+		__sync_fetch_and_add(&global_event_skips,1);
+	}
+
 	/* check in and out-of-service dates */
-	if (global_clock<obj->in_svc)
+	else if (global_clock<obj->in_svc)
 		this_t = obj->in_svc; /* yet to go in service */
 	else if ((global_clock==obj->in_svc) && (obj->in_svc_micro != 0))	/* If our in service is a little higher, delay to next time */
 		this_t = obj->in_svc + 1;	/* Technically yet to go into service -- deltamode handled separately */
@@ -866,8 +892,15 @@ void GldExec::ss_do_object_sync(int thread, void *item)
 	else 
 		this_t = TS_NEVER; /* already out of service */
 
+	/* record the next event of objects the event scheduler may skip */
+	if ( event_time != NULL && ! skipped && (obj->flags&OF_SKIPSAFE) )
+	{
+		event_update(obj,this_t);
+	}
+
 	/* check for "soft" event (events that are ignored when stopping) */
-	if (this_t < -1)
+	bool soft = ( this_t < -1 );
+	if (soft)
 		this_t = -this_t;
 	else if (this_t != TS_NEVER)
 		data->hard_event++;  /* this counts the number of hard events */
@@ -899,6 +932,10 @@ void GldExec::ss_do_object_sync(int thread, void *item)
 			 */
 		}
 
+		/* delay soft events that may share a later timestep (hard events stay on time) */
+		if (coalesce_time!=NULL && soft)
+			this_t = event_coalesce(obj,this_t);
+
 		/* manage minimum timestep */
 		if (global_minimum_timestep>1 && this_t>global_clock && this_t<TS_NEVER)
 			this_t = (((this_t-1)/global_minimum_timestep)+1)*global_minimum_timestep;
@@ -934,6 +971,395 @@ void *GldExec::ss_do_object_sync_list(void *threadarg)
 	return NULL;
 }
 
+/***********************************************************************/
+// event scheduler
+//
+// When global_event_scheduler is set, skip-safe objects (OF_SKIPSAFE) whose
+// last event was a hard event are only synced when that event arrives.  A
+// skip-safe parent and its skip-safe children are scheduled as a group, since
+// parents read their children's state on every sync (e.g., a house and its
+// enduses), so the whole group syncs when any of its members is due.  Groups
+// whose top object has a parent that is not skip-safe are synced on every
+// timestep, because objects post their loads to such parents on every pass
+// (e.g., a house attached to a meter), so houses in a powerflow model are
+// never skipped.  Soft events are estimates, so groups that return them are
+// synced on every timestep as usual.  A top object that returns TS_NEVER
+// could not predict its next event, so its group is synced on every timestep
+// too.  Skipped objects
+// report the event they returned last, so the clock advances exactly as if
+// they had been synced.  Ranks made only of skip-safe objects with nothing due
+// are skipped as a whole.
+
+STATUS GldExec::event_init(void)
+{
+	OBJECT *obj;
+	OBJECTNUM n, max_id = 0;
+	unsigned int n_children = 0, n_attached = 0;
+	int p, max_rank = 0;
+
+	for ( obj = object_get_first() ; obj != NULL ; obj = object_get_next(obj) )
+	{
+		if ( obj->id > max_id )
+		{
+			max_id = obj->id;
+		}
+		if ( (int)obj->rank > max_rank )
+		{
+			max_rank = obj->rank;
+		}
+		if ( obj->parent != NULL && (obj->flags&OF_SKIPSAFE) )
+		{
+			n_children++;
+			if ( ! (obj->parent->flags&OF_SKIPSAFE) )
+			{
+				n_attached++;
+			}
+		}
+	}
+
+	event_time = (TIMESTAMP*)malloc(sizeof(TIMESTAMP)*(max_id+1));
+	event_iteration = (int64*)malloc(sizeof(int64)*(max_id+1));
+	event_child_start = (unsigned int*)malloc(sizeof(unsigned int)*(max_id+2));
+	event_children = (OBJECT**)malloc(sizeof(OBJECT*)*(n_children+1));
+	event_rank_touched = (int64*)malloc(sizeof(int64)*(max_rank+1));
+	if ( event_time == NULL || event_iteration == NULL || event_child_start == NULL || event_children == NULL || event_rank_touched == NULL )
+	{
+		output_error("event scheduler memory allocation failed");
+		return FAILED;
+	}
+
+	/* skip-safe children of each object (compressed rows by parent id) */
+	memset(event_child_start,0,sizeof(unsigned int)*(max_id+2));
+	for ( obj = object_get_first() ; obj != NULL ; obj = object_get_next(obj) )
+	{
+		if ( obj->parent != NULL && (obj->flags&OF_SKIPSAFE) )
+		{
+			event_child_start[obj->parent->id+1]++;
+		}
+	}
+	for ( n = 0 ; n <= max_id ; n++ )
+	{
+		event_child_start[n+1] += event_child_start[n];
+		event_iteration[n] = 0;
+	}
+	for ( obj = object_get_first() ; obj != NULL ; obj = object_get_next(obj) )
+	{
+		if ( obj->parent != NULL && (obj->flags&OF_SKIPSAFE) )
+		{
+			/* event_iteration is not used until the run starts, so it counts the fill */
+			OBJECTNUM id = obj->parent->id;
+			event_children[event_child_start[id]+(event_iteration[id]++)] = obj;
+		}
+	}
+
+	/* every object is due on the first timestep */
+	for ( n = 0 ; n <= max_id ; n++ )
+	{
+		event_time[n] = TS_ZERO;
+		event_iteration[n] = -1;
+	}
+
+	/* rank summaries are computed when first needed */
+	for ( p = 0 ; p <= max_rank ; p++ )
+	{
+		event_rank_touched[p] = 0;
+	}
+	for ( p = 0 ; p < 3 ; p++ )
+	{
+		int r;
+		event_rank_next[p] = (TIMESTAMP*)malloc(sizeof(TIMESTAMP)*(ranks[p]->last_ordinal+1));
+		event_rank_hard[p] = (unsigned int*)malloc(sizeof(unsigned int)*(ranks[p]->last_ordinal+1));
+		event_rank_scanned[p] = (int64*)malloc(sizeof(int64)*(ranks[p]->last_ordinal+1));
+		if ( event_rank_next[p] == NULL || event_rank_hard[p] == NULL || event_rank_scanned[p] == NULL )
+		{
+			output_error("event scheduler memory allocation failed");
+			return FAILED;
+		}
+		for ( r = 0 ; r <= ranks[p]->last_ordinal ; r++ )
+		{
+			event_rank_next[p][r] = TS_ZERO;
+			event_rank_hard[p][r] = 0;
+			event_rank_scanned[p][r] = -1;
+		}
+	}
+
+	IN_MYCONTEXT output_verbose("event scheduler enabled with %u skip-safe children", n_children);
+	if ( n_attached > 0 )
+	{
+		output_warning("event scheduler cannot skip %u skip-safe objects attached to parents that are not skip-safe", n_attached);
+		/* TROUBLESHOOT
+			Skip-safe objects such as houses post their loads to their parents on every pass,
+			so they are synced on every timestep when the parent is not skip-safe, such as
+			a house attached to a triplex_meter.  The event scheduler only skips objects
+			whose parents are skip-safe or that have no parent, so it saves little in
+			powerflow models.
+		 */
+	}
+	return SUCCESS;
+}
+
+TIMESTAMP GldExec::event_pending(OBJECT *obj)
+{
+	TIMESTAMP t;
+	unsigned int n;
+
+	/* a skip-safe parent and its skip-safe children are scheduled together */
+	if ( ! (obj->flags&OF_SKIPSAFE) )
+	{
+		return TS_ZERO;
+	}
+	if ( obj->parent != NULL && (obj->parent->flags&OF_SKIPSAFE) )
+	{
+		obj = obj->parent;
+	}
+	t = event_time[obj->id];
+
+	/* groups posting to a parent that always syncs must sync too, and so must groups
+	   whose top object could not predict its next event (e.g., a house whose air
+	   temperature turns around before reaching its thermostat setpoint) */
+	if ( obj->parent != NULL || t < 0 || t == TS_NEVER || t <= global_clock || event_iteration[obj->id] == event_iteration_count )
+	{
+		return TS_ZERO;
+	}
+	for ( n = event_child_start[obj->id] ; n < event_child_start[obj->id+1] ; n++ )
+	{
+		OBJECTNUM id = event_children[n]->id;
+		TIMESTAMP c = event_time[id];
+		if ( c < 0 || c <= global_clock || event_iteration[id] == event_iteration_count )
+		{
+			return TS_ZERO;
+		}
+		else if ( c < t )
+		{
+			t = c;
+		}
+	}
+	return t;
+}
+
+bool GldExec::event_due(OBJECT *obj)
+{
+	return event_iteration[obj->id] == event_iteration_count
+		|| event_pending(obj) == TS_ZERO;
+}
+
+void GldExec::event_update(OBJECT *obj, TIMESTAMP t)
+{
+	/* keep the earliest event over the passes of this iteration, soft events first */
+	if ( event_iteration[obj->id] != event_iteration_count )
+	{
+		unsigned int n;
+		event_iteration[obj->id] = event_iteration_count;
+		event_time[obj->id] = t;
+
+		/* rank summaries of the object's group are now stale */
+		event_rank_touched[obj->rank] = event_iteration_count;
+		if ( obj->parent != NULL )
+		{
+			event_rank_touched[obj->parent->rank] = event_iteration_count;
+		}
+		for ( n = event_child_start[obj->id] ; n < event_child_start[obj->id+1] ; n++ )
+		{
+			event_rank_touched[event_children[n]->rank] = event_iteration_count;
+		}
+	}
+	else if ( t < 0 || ( event_time[obj->id] >= 0 && t < event_time[obj->id] ) )
+	{
+		event_time[obj->id] = t;
+	}
+}
+
+bool GldExec::event_rank_skip(int thread, unsigned int pass, int rank)
+{
+	struct sync_data *data = &get_thread_data()->data[thread];
+	TIMESTAMP t;
+
+	/* objects that synced earlier in this iteration must finish their passes */
+	if ( event_rank_touched[rank] == event_iteration_count )
+	{
+		return false;
+	}
+
+	/* the summary is stale once an object of the rank synced in any pass */
+	if ( event_rank_scanned[pass][rank] < event_rank_touched[rank] )
+	{
+		event_rank_update(pass,rank);
+	}
+	t = event_rank_next[pass][rank];
+	if ( t <= global_clock )
+	{
+		return false;
+	}
+
+	/* report the rank's events as its objects would */
+	if ( global_minimum_timestep>1 && t<TS_NEVER )
+	{
+		t = (((t-1)/global_minimum_timestep)+1)*global_minimum_timestep;
+	}
+	if ( data->step_to > t )
+	{
+		data->step_to = t;
+	}
+	data->hard_event += event_rank_hard[pass][rank];
+	__sync_fetch_and_add(&global_event_skips,ranks[pass]->ordinal[rank]->size);
+	return true;
+}
+
+void GldExec::event_rank_update(unsigned int pass, int rank)
+{
+	LISTITEM *ptr;
+	TIMESTAMP next = TS_NEVER;
+	unsigned int hard = 0;
+
+	for ( ptr = ranks[pass]->ordinal[rank]->first ; ptr != NULL ; ptr = ptr->next )
+	{
+		OBJECT *obj = (OBJECT*)(ptr->data);
+		TIMESTAMP t;
+
+		/* objects that sync on every timestep keep the rank from being skipped */
+		t = event_pending(obj);
+		if ( t == TS_ZERO )
+		{
+			next = TS_ZERO;
+			break;
+		}
+		if ( event_time[obj->id] != TS_NEVER )
+		{
+			hard++;
+		}
+		if ( t < next )
+		{
+			next = t;
+		}
+	}
+	event_rank_next[pass][rank] = next;
+	event_rank_hard[pass][rank] = hard;
+	event_rank_scanned[pass][rank] = event_iteration_count;
+}
+
+/***********************************************************************/
+// event coalescing
+//
+// When global_event_tolerance is set, the soft events of objects flagged with
+// OF_COALESCE (e.g., thermostatic loads) are reported event_tolerance seconds
+// late.  An object's event_tolerance header property overrides the global for
+// that object, and setting it makes the object's soft events coalescable even
+// without the flag.  Hard events are never delayed.  The clock then advances to
+// the earliest such deadline (or to an earlier event of any other object), and
+// every coalescable event that falls before it is processed in that one
+// timestep, so no event is delayed by more than its object's tolerance.  The
+// events that were passed over are counted at each clock advance, along with
+// their delay and the number of distinct event times that would otherwise
+// have been timesteps.
+
+STATUS GldExec::event_coalesce_init(void)
+{
+	OBJECT *obj;
+	OBJECTNUM n;
+	bool any = false;
+
+	coalesce_count = 0;
+	for ( obj = object_get_first() ; obj != NULL ; obj = object_get_next(obj) )
+	{
+		if ( obj->id >= coalesce_count )
+		{
+			coalesce_count = obj->id+1;
+		}
+		if ( event_coalesce_window(obj) > 0 )
+		{
+			any = true;
+		}
+	}
+
+	/* nothing to coalesce */
+	if ( ! any )
+	{
+		coalesce_count = 0;
+		return SUCCESS;
+	}
+
+	coalesce_time = (TIMESTAMP*)malloc(sizeof(TIMESTAMP)*(coalesce_count+1));
+	coalesce_iteration = (int64*)malloc(sizeof(int64)*(coalesce_count+1));
+	coalesce_delayed = (TIMESTAMP*)malloc(sizeof(TIMESTAMP)*(coalesce_count+1));
+	if ( coalesce_time == NULL || coalesce_iteration == NULL || coalesce_delayed == NULL )
+	{
+		return FAILED;
+	}
+	for ( n = 0 ; n < coalesce_count ; n++ )
+	{
+		coalesce_time[n] = TS_NEVER;
+		coalesce_iteration[n] = -1;
+	}
+	return SUCCESS;
+}
+
+TIMESTAMP GldExec::event_coalesce_window(OBJECT *obj)
+{
+	if ( obj->event_tolerance > 0 )
+	{
+		return obj->event_tolerance;
+	}
+	return (obj->flags&OF_COALESCE) ? global_event_tolerance : 0;
+}
+
+TIMESTAMP GldExec::event_coalesce(OBJECT *obj, TIMESTAMP t)
+{
+	TIMESTAMP window = event_coalesce_window(obj);
+	if ( window <= 0 || t <= global_clock || t >= TS_NEVER )
+	{
+		return t;
+	}
+
+	/* keep the earliest event over the passes of the last iteration */
+	if ( coalesce_iteration[obj->id] != event_iteration_count || t < coalesce_time[obj->id] )
+	{
+		coalesce_time[obj->id] = t;
+		coalesce_iteration[obj->id] = event_iteration_count;
+	}
+	return t + window;
+}
+
+static int timestamp_compare(const void *a, const void *b)
+{
+	TIMESTAMP ta = *(const TIMESTAMP*)a, tb = *(const TIMESTAMP*)b;
+	return ta < tb ? -1 : ( ta > tb ? 1 : 0 );
+}
+
+void GldExec::event_coalesce_step(TIMESTAMP t)
+{
+	OBJECTNUM n;
+	size_t delayed = 0, i;
+
+	for ( n = 0 ; n < coalesce_count ; n++ )
+	{
+		TIMESTAMP c = coalesce_time[n];
+		if ( c < t )
+		{
+			TIMESTAMP delay = t - c;
+			global_event_coalesced++;
+			global_event_delay_total += delay;
+			if ( delay > global_event_delay_max )
+			{
+				global_event_delay_max = delay;
+			}
+			coalesce_delayed[delayed++] = c;
+		}
+		coalesce_time[n] = TS_NEVER;
+	}
+	if ( delayed > 0 )
+	{
+		qsort(coalesce_delayed,delayed,sizeof(TIMESTAMP),timestamp_compare);
+		global_event_steps_avoided++;
+		for ( i = 1 ; i < delayed ; i++ )
+		{
+			if ( coalesce_delayed[i] != coalesce_delayed[i-1] )
+			{
+				global_event_steps_avoided++;
+			}
+		}
+	}
+}
+
 STATUS GldExec::init_by_creation(void)
 {
 	OBJECT *obj;
@@ -1720,47 +2146,16 @@ void GldExec::sleep(unsigned int usec)
 #endif
 }
 
-void *GldExec::obj_syncproc(OBJSYNCDATA *data)
+void GldExec::obj_synctask(OBJSYNCDATA *data)
 {
 	LISTITEM *s;
 	unsigned int n;
-	int i = data->i;
 
-	// begin processing loop
-	while (data->ok)
+	// process the list for this task
+	for ( s = data->ls, n = 0 ; s != NULL && n < data->nObj ; s = s->next, n++ ) 
 	{
-		// lock access to start condition
-		pthread_mutex_lock(&startlock[i]);
-
-		// wait for thread start condition)
-		while (data->t0 == next_t1[i]) 
-			pthread_cond_wait(&start[i], &startlock[i]);
-		// unlock access to start count
-		pthread_mutex_unlock(&startlock[i]);
-
-		// process the list for this thread
-		for ( s = data->ls, n = 0 ; s != NULL || n < data->nObj ; s = s->next, n++ ) 
-		{
-			my_instance->get_exec()->ss_do_object_sync(data->n, s->data);
-		}
-
-		// signal completed condition
-		data->t0 = next_t1[i];
-
-		// lock access to done condition
-		pthread_mutex_lock(&donelock[i]);
-
-		// signal thread is done for now
-		donecount[i] --; 
-
-		// signal change in done condition
-		pthread_cond_broadcast(&done[i]);
-
-		//unlock access to done count
-		pthread_mutex_unlock(&donelock[i]);
+		ss_do_object_sync(data->n, s->data);
 	}
-	pthread_exit((void*)0);
-	return (void*)0;
 }
 
 /** MAIN LOOP CONTROL ******************************************************************/
@@ -2213,22 +2608,6 @@ void GldExec::wunlock_sync(void)
 	wunlock(&sync_lock);
 }
 
-void GldExec::create_lockdata(int nObjRankList)
-{
-	size_t k;
-	startlock = (pthread_mutex_t*)malloc(sizeof(startlock[0])*nObjRankList);
-	donelock = (pthread_mutex_t*)malloc(sizeof(donelock[0])*nObjRankList);
-	start = (pthread_cond_t*)malloc(sizeof(start[0])*nObjRankList);
-	done = (pthread_cond_t*)malloc(sizeof(done[0])*nObjRankList);
-	for ( k = 0 ; k < (size_t)nObjRankList ; k++ ) 
-	{
-		pthread_mutex_init(&startlock[k], NULL);
-		pthread_mutex_init(&donelock[k], NULL);
-		pthread_cond_init(&start[k], NULL);
-		pthread_cond_init(&done[k], NULL);
-	}
-}
-
 /******************************************************************
  *  MAIN EXEC LOOP
  ******************************************************************/
@@ -2248,11 +2627,9 @@ STATUS GldExec::exec_start(void)
 	int incr;
 	INDEX **ranks = getranks();
 
-	// Only setup threadpool for each object rank list at the first iteration;
+	// Only setup the sync tasks for each object rank list at the first iteration;
 	// After the first iteration, setTP = false;
 	bool setTP = true; 
-	//int n_threads; //number of thread used in the threadpool of an object rank list
-	OBJSYNCDATA *thread = NULL;
 
 	int nObjRankList, iObjRankList;
 
@@ -2294,6 +2671,28 @@ STATUS GldExec::exec_start(void)
 		ranks = getranks();
 	}
 
+	/* establish event scheduler if requested */
+	if ( global_event_scheduler && event_time == NULL && event_init() == FAILED )
+	{
+		output_error("event scheduler setup failed");
+		/* TROUBLESHOOT
+			The event scheduler could not allocate its object tables.  Try
+			running without the event_scheduler global or free up memory.
+		 */
+		return FAILED;
+	}
+
+	/* establish event coalescing if requested */
+	if ( coalesce_time == NULL && event_coalesce_init() == FAILED )
+	{
+		output_error("event coalescing setup failed");
+		/* TROUBLESHOOT
+			The event coalescing table could not be allocated.  Try
+			running without event tolerances or free up memory.
+		 */
+		return FAILED;
+	}
+
 	/* run checks */
 	if ( global_runchecks )
 	{
@@ -2435,17 +2834,11 @@ STATUS GldExec::exec_start(void)
 	/* allocate and initialize thread data */
 	IN_MYCONTEXT output_debug("nObjRankList=%d ",nObjRankList);
 
-	next_t1 = (unsigned int*)malloc(sizeof(next_t1[0])*nObjRankList);
-	memset(next_t1,0,sizeof(next_t1[0])*nObjRankList);
-
-	donecount = (unsigned int*)malloc(sizeof(donecount[0])*nObjRankList);
-	memset(donecount,0,sizeof(donecount[0])*nObjRankList);
-
 	n_threads = (unsigned int*)malloc(sizeof(n_threads[0])*nObjRankList);
 	memset(n_threads,0,sizeof(n_threads[0])*nObjRankList);
 
-	// allocation and nitialize mutex and cond for object rank lists
-	create_lockdata(nObjRankList);
+	sync_tasks = (OBJSYNCDATA**)malloc(sizeof(sync_tasks[0])*nObjRankList);
+	memset(sync_tasks,0,sizeof(sync_tasks[0])*nObjRankList);
 
 	// global test mode
 	if ( global_test_mode == TRUE )
@@ -2664,6 +3057,11 @@ STATUS GldExec::exec_start(void)
 				}
 			}
 			iObjRankList = -1;
+			event_iteration_count++;
+			if ( iteration_counter == global_iteration_limit )
+			{
+				event_step_iteration = event_iteration_count;
+			}
 
 			/* scan the ranks of objects for each pass */
 			for ( pass = 0 ; ranks[pass] != NULL; pass++ )
@@ -2719,6 +3117,11 @@ STATUS GldExec::exec_start(void)
 						//sjin: if global_threadcount == 1, no pthread multhreading
 						if ( global_threadcount == 1 ) 
 						{
+							/* ranks with no skip-safe object due need not be scanned */
+							if ( event_time != NULL && event_rank_skip(0,pass,i) )
+							{
+								continue;
+							}
 							for ( ptr = ranks[pass]->ordinal[i]->first ; ptr != NULL ; ptr=ptr->next ) 
 							{
 								OBJECT *obj = (OBJECT*)(ptr->data);
@@ -2736,20 +3139,20 @@ STATUS GldExec::exec_start(void)
 						else 
 						{ 
 							//sjin: implement pthreads
-							unsigned int n_items,objn=0,n;
+							unsigned int n_items,objn=0;
 							unsigned int n_obj = ranks[pass]->ordinal[i]->size;
 
-							// Only create threadpool for each object rank list at the first iteration. 
-							// Reuse the threadppol of each object rank list at all other iterations.
+							// Only partition each object rank list into sync tasks at the first iteration. 
+							// Reuse the sync tasks of each object rank list at all other iterations.
 							if ( setTP == true ) 
 							{ 
 								incr = (int)ceil((float) n_obj / global_threadcount);
-								// if the number of objects is less than or equal to the number of threads, each thread process one object 
+								// if the number of objects is less than or equal to the number of threads, each task process one object 
 								if (incr <= 1) {
 									n_threads[iObjRankList] = n_obj;
 									n_items = 1;
-								// if the number of objects is greater than the number of threads, each thread process the same number of 
-								// objects (incr), except that the last thread may process less objects 
+								// if the number of objects is greater than the number of threads, each task process the same number of 
+								// objects (incr), except that the last task may process less objects 
 								} 
 								else 
 								{
@@ -2761,62 +3164,37 @@ STATUS GldExec::exec_start(void)
 									throw("Running threads > global_threadcount");
 								}
 
-								// allocate thread list
-								thread = (OBJSYNCDATA*)malloc(sizeof(OBJSYNCDATA)*n_threads[iObjRankList]);
-								memset(thread,0,sizeof(OBJSYNCDATA)*n_threads[iObjRankList]);
-								// assign starting obj for each thread
+								// allocate task list
+								OBJSYNCDATA *task = (OBJSYNCDATA*)malloc(sizeof(OBJSYNCDATA)*n_threads[iObjRankList]);
+								memset(task,0,sizeof(OBJSYNCDATA)*n_threads[iObjRankList]);
+								// assign starting obj for each task
 								for ( ptr = ranks[pass]->ordinal[i]->first ; ptr != NULL ; ptr = ptr->next )
 								{
-									if (thread[objn].nObj==n_items)
+									if (task[objn].nObj==n_items)
 									{
 										objn++;
 									}
-									if (thread[objn].nObj==0) 
+									if (task[objn].nObj==0) 
 									{
-										thread[objn].ls=ptr;
+										task[objn].ls=ptr;
 									}
-									thread[objn].nObj++;
+									task[objn].nObj++;
 								}
-								// create threads
-								for ( n=0 ; n < n_threads[iObjRankList] ; n++ ) 
+								// each task uses its own thread data slot
+								for ( objn=0 ; objn < n_threads[iObjRankList] ; objn++ ) 
 								{
-									thread[n].ok = true;
-									thread[n].i = iObjRankList;
-									thread[n].main = &instance;
-									if ( pthread_create(&(thread[n].pt),NULL,exec_obj_syncproc,&(thread[n])) != 0 ) 
-									{
-										output_fatal("obj_sync thread creation failed");
-										thread[n].ok = false;
-									} 
-									else
-									{
-										thread[n].n = n;
-									}
+									task[objn].main = &instance;
+									task[objn].n = objn;
+								}
+								sync_tasks[iObjRankList] = task;
+								if ( sync_batch == NULL )
+								{
+									sync_batch = threadpool_batch("object");
 								}
 							}
-														
-							// lock access to done count
-							pthread_mutex_lock(&donelock[iObjRankList]);
-							
-							// initialize wait count
-							donecount[iObjRankList] = n_threads[iObjRankList];
-
-							// lock access to start condition
-							pthread_mutex_lock(&startlock[iObjRankList]);
-
-							// update start condition
-							next_t1[iObjRankList] ++;
-
-							// signal all the threads
-							pthread_cond_broadcast(&start[iObjRankList]);
-							// unlock access to start count
-							pthread_mutex_unlock(&startlock[iObjRankList]);
-
-							// begin wait
-							while (donecount[iObjRankList]>0)
-								pthread_cond_wait(&done[iObjRankList],&donelock[iObjRankList]);
-							// unlock done count
-							pthread_mutex_unlock(&donelock[iObjRankList]);
+
+							// run the tasks on the thread pool
+							threadpool_run(sync_batch,exec_obj_synctask,sync_tasks[iObjRankList],n_threads[iObjRankList]);
 						}
 
 						struct thread_data * thread_data = get_thread_data();
@@ -2910,15 +3288,27 @@ STATUS GldExec::exec_start(void)
 					sync_set(NULL,commit_time,false);
 				}
 
-				/* make sure all clocks are set */
+				/* make sure all clocks are set - objects the event scheduler skipped for the whole
+				   timestep keep the clock of their last sync, so they integrate over the time skipped */
 				for ( obj = object_get_first() ; obj != NULL ; obj = object_get_next(obj) )
-					obj->clock = global_clock;
+				{
+					if ( event_time == NULL || ! (obj->flags&OF_SKIPSAFE) || event_iteration[obj->id] >= event_step_iteration )
+					{
+						obj->clock = global_clock;
+					}
+				}
 
 				/* reset iteration count */
 				iteration_counter = global_iteration_limit;
 
 				/* count number of timesteps */
 				tsteps++;
+
+				/* account for the events passed over by this step */
+				if ( coalesce_time != NULL && sync_get(NULL) < TS_NEVER )
+				{
+					event_coalesce_step(sync_get(NULL));
+				}
 			}
 
 			/* check iteration limit */
@@ -3029,14 +3419,8 @@ STATUS GldExec::exec_start(void)
 		output_error("termcall %d failed", rc);
 	}
 
-	// Destroy mutex and cond
-	for ( k = 0 ; k < nObjRankList ; k++ ) 
-	{
-		pthread_mutex_destroy(&startlock[k]);
-		pthread_mutex_destroy(&donelock[k]);
-		pthread_cond_destroy(&start[k]);
-		pthread_cond_destroy(&done[k]);
-	}
+	// Stop the thread pool
+	threadpool_term();
 
 	/* report performance */
 	if ( global_profiler && ! sync_isinvalid(NULL) )
@@ -3057,6 +3441,9 @@ STATUS GldExec::exec_start(void)
 		CLASS *cl;
 		DELTAPROFILE *dp = delta_getprofile();
 		double delta_runtime = 0, delta_simtime = 0;
+		TPSTATS tp;
+		TPBATCH *batch;
+		bool tp_used = threadpool_getstats(&tp) && tp.tasks > 0;
 		if (global_threadcount==0) global_threadcount=1;
 		for (cl=class_get_first_class(); cl!=NULL; cl=cl->next)
 			sync_time += ((double)cl->profiler.clocks)/CLOCKS_PER_SEC;
@@ -3091,11 +3478,30 @@ STATUS GldExec::exec_start(void)
 				output_profile("Simulation speed         %7.0lf object.hours/second", sim_speed*1000);
 			output_profile("Passes completed        %8d passes", passes);
 			output_profile("Time steps completed    %8d timesteps", tsteps);
+			if ( coalesce_time != NULL )
+			{
+				output_profile("Time steps avoided      %8" FMT_INT64 "d timesteps", global_event_steps_avoided);
+				output_profile("Events delayed          %8" FMT_INT64 "d events", global_event_coalesced);
+				output_profile("Average event delay     %8.1lf seconds", global_event_coalesced>0 ? (double)global_event_delay_total/global_event_coalesced : 0.0);
+				output_profile("Maximum event delay     %8" FMT_INT64 "d seconds", global_event_delay_max);
+			}
 			output_profile("Convergence efficiency  %8.02lf passes/timestep", (double)passes/tsteps);
 #ifndef NOLOCKS
 			output_profile("Read lock contention    %7.01lf%%", (my_instance->rlock_spin>0 ? (1-(double)my_instance->rlock_count/(double)my_instance->rlock_spin)*100 : 0));
 			output_profile("Write lock contention   %7.01lf%%", (my_instance->wlock_spin>0 ? (1-(double)my_instance->wlock_count/(double)my_instance->wlock_spin)*100 : 0));
 #endif
+			if ( tp_used )
+			{
+				output_profile("Thread pool workers     %8d threads on %d node%s", tp.workers, tp.nodes, tp.nodes>1?"s":"");
+				output_profile("Thread pool busy time   %8.1lf seconds", tp.busy/1e9);
+				output_profile("Thread pool idle time   %8.1lf seconds", tp.idle/1e9);
+				output_profile("Thread pool steals      %8d tasks", tp.steals);
+				for ( batch = threadpool_getnext(NULL) ; batch != NULL ; batch = threadpool_getnext(batch) )
+				{
+					if ( batch->tasks==0 ) continue;
+					output_profile("  %-22s%8d tasks, %.3lf s busy, %.3lf s queued", batch->name, batch->tasks, batch->busy/1e9, batch->wait/1e9);
+				}
+			}
 			output_profile("Average timestep        %7.0lf seconds/timestep", (double)(global_clock-global_starttime)/tsteps);
 			output_profile("Simulation rate         %7.0lf x realtime", (double)(global_clock-global_starttime)/elapsed_wall);
 			if ( dp->t_count>0 )
@@ -3140,11 +3546,33 @@ STATUS GldExec::exec_start(void)
 			output_profile("simulation_speed,%.1lf,object.hr/s", sim_speed*1000);
 			output_profile("passes_completed,%d,passes", passes);
 			output_profile("time_steps_completed,%d,timesteps", tsteps);
+			if ( coalesce_time != NULL )
+			{
+				output_profile("time_steps_avoided,%" FMT_INT64 "d,timesteps", global_event_steps_avoided);
+				output_profile("events_delayed,%" FMT_INT64 "d,events", global_event_coalesced);
+				output_profile("average_event_delay,%.1lf,s", global_event_coalesced>0 ? (double)global_event_delay_total/global_event_coalesced : 0.0);
+				output_profile("maximum_event_delay,%" FMT_INT64 "d,s", global_event_delay_max);
+			}
 			output_profile("convergence_efficiency,%.2lf,passes/timestep", (double)passes/tsteps);
 #ifndef NOLOCKS
 			output_profile("read_lock_contention,%.1lf,%%", (my_instance->rlock_spin>0 ? (1-(double)my_instance->rlock_count/(double)my_instance->rlock_spin)*100 : 0));
 			output_profile("write_lock_contention,%.1lf,%%", (my_instance->wlock_spin>0 ? (1-(double)my_instance->wlock_count/(double)my_instance->wlock_spin)*100 : 0));
 #endif
+			if ( tp_used )
+			{
+				output_profile("threadpool_workers,%d,threads", tp.workers);
+				output_profile("threadpool_nodes,%d,nodes", tp.nodes);
+				output_profile("threadpool_busy_time,%.3lf,s", tp.busy/1e9);
+				output_profile("threadpool_idle_time,%.3lf,s", tp.idle/1e9);
+				output_profile("threadpool_steals,%d,tasks", tp.steals);
+				for ( batch = threadpool_getnext(NULL) ; batch != NULL ; batch = threadpool_getnext(batch) )
+				{
+					if ( batch->tasks==0 ) continue;
+					output_profile("threadpool_%s_tasks,%d,tasks", batch->name, batch->tasks);
+					output_profile("threadpool_%s_busy_time,%.3lf,s", batch->name, batch->busy/1e9);
+					output_profile("threadpool_%s_queue_time,%.3lf,s", batch->name, batch->wait/1e9);
+				}
+			}
 			output_profile("average_timestep,%.1lf,s/timestep", (double)(global_clock-global_starttime)/tsteps);
 			output_profile("simulation_rate,%.1lf,pu", (double)(global_clock-global_starttime)/elapsed_wall);
 		}
@@ -3170,11 +3598,33 @@ STATUS GldExec::exec_start(void)
 			output_profile("    \"simulation_speed\" : { \"value\" : %.1lf, \"units\" : \"object.hr/s\"},", sim_speed*1000);
 			output_profile("    \"passes_completed\" : { \"value\" : %d, \"units\" : \"passes\"},", passes);
 			output_profile("    \"time_steps_completed\" : { \"value\" : %d, \"units\" : \"timesteps\"},", tsteps);
+			if ( coalesce_time != NULL )
+			{
+				output_profile("    \"time_steps_avoided\" : { \"value\" : %" FMT_INT64 "d, \"units\" : \"timesteps\"},", global_event_steps_avoided);
+				output_profile("    \"events_delayed\" : { \"value\" : %" FMT_INT64 "d, \"units\" : \"events\"},", global_event_coalesced);
+				output_profile("    \"average_event_delay\" : { \"value\" : %.1lf, \"units\" : \"s\"},", global_event_coalesced>0 ? (double)global_event_delay_total/global_event_coalesced : 0.0);
+				output_profile("    \"maximum_event_delay\" : { \"value\" : %" FMT_INT64 "d, \"units\" : \"s\"},", global_event_delay_max);
+			}
 			output_profile("    \"convergence_efficiency\" : { \"value\" : %.2lf, \"units\" : \"passes/timestep\"},", (double)passes/tsteps);
 #ifndef NOLOCKS
 			output_profile("    \"read_lock_contention\" : { \"value\" : %.1lf, \"units\" : \"%%\"},", (my_instance->rlock_spin>0 ? (1-(double)my_instance->rlock_count/(double)my_instance->rlock_spin)*100 : 0));
 			output_profile("    \"write_lock_contention\" : { \"value\" : %.1lf, \"units\" : \"%%\"},", (my_instance->wlock_spin>0 ? (1-(double)my_instance->wlock_count/(double)my_instance->wlock_spin)*100 : 0));
 #endif
+			if ( tp_used )
+			{
+				output_profile("    \"threadpool_workers\" : { \"value\" : %d, \"units\" : \"threads\"},", tp.workers);
+				output_profile("    \"threadpool_nodes\" : { \"value\" : %d, \"units\" : \"nodes\"},", tp.nodes);
+				output_profile("    \"threadpool_busy_time\" : { \"value\" : %.3lf, \"units\" : \"s\"},", tp.busy/1e9);
+				output_profile("    \"threadpool_idle_time\" : { \"value\" : %.3lf, \"units\" : \"s\"},", tp.idle/1e9);
+				output_profile("    \"threadpool_steals\" : { \"value\" : %d, \"units\" : \"tasks\"},", tp.steals);
+				for ( batch = threadpool_getnext(NULL) ; batch != NULL ; batch = threadpool_getnext(batch) )
+				{
+					if ( batch->tasks==0 ) continue;
+					output_profile("    \"threadpool_%s_tasks\" : { \"value\" : %d, \"units\" : \"tasks\"},", batch->name, batch->tasks);
+					output_profile("    \"threadpool_%s_busy_time\" : { \"value\" : %.3lf, \"units\" : \"s\"},", batch->name, batch->busy/1e9);
+					output_profile("    \"threadpool_%s_queue_time\" : { \"value\" : %.3lf, \"units\" : \"s\"},", batch->name, batch->wait/1e9);
+				}
+			}
 			output_profile("    \"average_timestep\" : { \"value\" : %.1lf, \"units\" : \"s/timestep\"},", (double)(global_clock-global_starttime)/tsteps);
 			output_profile("    \"simulation_rate\" : { \"value\" : %.1lf, \"units\" : \"pu\"}", (double)(global_clock-global_starttime)/elapsed_wall);
 			output_profile("  },");
@@ -3186,11 +3636,16 @@ STATUS GldExec::exec_start(void)
 		object_synctime_profile_dump(NULL);
 	}
 
-	/* terminate links */
-	if ( thread ) 
+	/* release the object sync tasks */
+	for ( k = 0 ; k < nObjRankList ; k++ ) 
 	{
-		free(thread);
+		if ( sync_tasks[k] ) 
+		{
+			free(sync_tasks[k]);
+		}
 	}
+	free(sync_tasks);
+	sync_tasks = NULL;
 	return sync_getstatus(NULL);
 }
 
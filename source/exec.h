@@ -153,24 +153,16 @@ DEPRECATED typedef struct s_simplelinklist
 
 	Fields:
 	main - main instance
-	n - thread id 0~n_threads for this object rank list
-	pt - thread data
-	ok - thread status
+	n - thread data slot of this task (0~n_threads) for this object rank list
 	ls - list
-	nOjb - number of obj in this object rank list
-	t0 - start time
-	i - index of mutex or cond this object rank list uses
+	nOjb - number of obj in this task
  */
 DEPRECATED typedef struct s_objsyncdata 
 {
 	GldMain *main;
 	unsigned int n; 
-	pthread_t pt;
-	bool ok;
 	LISTITEM *ls;
 	unsigned int nObj; 
-	unsigned int t0;
-	int i; 
 } OBJSYNCDATA;
 
 /*	Structure: arg_data
@@ -308,38 +300,18 @@ private:
 	 */
 	int mls_destroyed;
 
-	/* Field: startlock
-		Execution startup lock variable
+	/* Field: sync_tasks
+		Reference to the object sync tasks of each object rank list
 	 */
-	pthread_mutex_t *startlock;
+	OBJSYNCDATA **sync_tasks;
 
-	/* Field: donelock
-		Execution done lock variable
+	/* Field: sync_batch
+		Thread pool batch that runs the object sync tasks
 	 */
-	pthread_mutex_t *donelock;
-
-	/* Field: start
-		Mutex condition for start lock
-	 */
-	pthread_cond_t *start;
-
-	/* Field: done
-		Mutex condition for done lock
-	 */
-	pthread_cond_t *done;
-
-	/* Field: next_t1
-		Reference to timestamp values for threads
-	 */
-	unsigned int *next_t1;
-
-	/* Field: donecount
-		Reference to counters for threads
-	 */
-	unsigned int *donecount;
+	struct s_tpbatch *sync_batch;
 
 	/* Field: n_threads
-		Reference to number of threads
+		Reference to number of object sync tasks of each object rank list
 	 */
 	unsigned int *n_threads;
 
@@ -363,6 +335,76 @@ private:
 	 */
 	unsigned int pass;
 
+	/* Field: event_time
+		Next event of each skip-safe object, by object id (event scheduler)
+	 */
+	TIMESTAMP *event_time;
+
+	/* Field: event_iteration
+		Iteration in which each object last synced, by object id (event scheduler)
+	 */
+	int64 *event_iteration;
+
+	/* Field: event_child_start
+		First entry of each object in event_children, by object id (event scheduler)
+	 */
+	unsigned int *event_child_start;
+
+	/* Field: event_children
+		Skip-safe children of each object, grouped by parent (event scheduler)
+	 */
+	OBJECT **event_children;
+
+	/* Field: event_rank_next
+		Earliest event of each rank of each pass, TS_ZERO when the rank can't be skipped (event scheduler)
+	 */
+	TIMESTAMP *event_rank_next[3];
+
+	/* Field: event_rank_hard
+		Number of hard events of each rank of each pass (event scheduler)
+	 */
+	unsigned int *event_rank_hard[3];
+
+	/* Field: event_rank_touched
+		Iteration in which an object of each rank last synced (event scheduler)
+	 */
+	int64 *event_rank_touched;
+
+	/* Field: event_rank_scanned
+		Iteration in which event_rank_next of each rank of each pass was computed (event scheduler)
+	 */
+	int64 *event_rank_scanned[3];
+
+	/* Field: event_iteration_count
+		Number of iterations run (event scheduler)
+	 */
+	int64 event_iteration_count;
+
+	/* Field: event_step_iteration
+		First iteration of the current timestep (event scheduler)
+	 */
+	int64 event_step_iteration;
+
+	/* Field: coalesce_time
+		Earliest undelayed event of each coalescable object in the current timestep, by object id (event coalescing)
+	 */
+	TIMESTAMP *coalesce_time;
+
+	/* Field: coalesce_iteration
+		Iteration in which coalesce_time of each object was recorded (event coalescing)
+	 */
+	int64 *coalesce_iteration;
+
+	/* Field: coalesce_delayed
+		Event times delayed by the last timestep (event coalescing)
+	 */
+	TIMESTAMP *coalesce_delayed;
+
+	/* Field: coalesce_count
+		Number of entries in coalesce_time (event coalescing)
+	 */
+	OBJECTNUM coalesce_count;
+
 	/*	Field: initcalls
 	 */
 	std::list<INITCALL> initcalls;
@@ -548,6 +590,77 @@ public:
 	*/
 	void ss_do_object_sync(int thread, void *item);
 
+	/*	Method: event_init
+			Build the event scheduler tables
+		
+		Returns:
+			SUCCESS or FAILED
+	*/
+	STATUS event_init(void);
+
+	/*	Method: event_due
+			Check whether a skip-safe object must be synced
+		
+		Returns:
+			true if a member of the object's group has an event pending or already synced in this iteration
+	*/
+	bool event_due(OBJECT *obj);
+
+	/*	Method: event_pending
+			Get the next event of the group made of an object's skip-safe parent, or the object itself, and its skip-safe children
+		
+		Returns:
+			TS_ZERO if the object must sync now, otherwise the time of its next hard event
+	*/
+	TIMESTAMP event_pending(OBJECT *obj);
+
+	/*	Method: event_update
+			Record the next event of an object that synced
+	*/
+	void event_update(OBJECT *obj, TIMESTAMP t);
+
+	/*	Method: event_rank_skip
+			Skip a rank whose objects are all skip-safe and have no event due
+		
+		Returns:
+			true if the rank was skipped
+	*/
+	bool event_rank_skip(int thread, unsigned int pass, int rank);
+
+	/*	Method: event_rank_update
+			Recompute the earliest event of a rank
+	*/
+	void event_rank_update(unsigned int pass, int rank);
+
+	/*	Method: event_coalesce_init
+			Build the event coalescing tables (none if no object has a tolerance)
+		
+		Returns:
+			SUCCESS or FAILED
+	*/
+	STATUS event_coalesce_init(void);
+
+	/*	Method: event_coalesce_window
+			Get the time by which the soft events of an object may be delayed
+		
+		Returns:
+			the object's event_tolerance, the global event_tolerance for OF_COALESCE objects, or 0
+	*/
+	TIMESTAMP event_coalesce_window(OBJECT *obj);
+
+	/*	Method: event_coalesce
+			Delay the soft event of a coalescable object by its event tolerance
+		
+		Returns:
+			the time at which the object's event may be processed
+	*/
+	TIMESTAMP event_coalesce(OBJECT *obj, TIMESTAMP t);
+
+	/*	Method: event_coalesce_step
+			Collect the delay statistics of the events passed over by a clock advance to time t
+	*/
+	void event_coalesce_step(TIMESTAMP t);
+
 	/*	Method: 
 			
 		Returns:
@@ -700,7 +813,7 @@ public:
 		Returns:
 
 	*/
-	void *obj_syncproc(OBJSYNCDATA *data);
+	void obj_synctask(OBJSYNCDATA *data);
 
 	/*	Method: 
 			
@@ -856,13 +969,6 @@ public:
 	*/
 	void wunlock_sync(void);
 
-	/*	Method: 
-			
-		Returns:
-
-	*/
-	void create_lockdata(int nObjRankList);
-
 	/*	Method: exec_start
 			Start the execution flow control system
 
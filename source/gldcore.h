@@ -123,6 +123,7 @@ typedef enum e_status {FAILED=FALSE, SUCCESS=TRUE} STATUS;
 #include "property.h"
 #include "python_embed.h"
 #include "python_property.h"
+#include "python_property_array.h"
 #include "random.h"
 #include "realtime.h"
 #include "sanitize.h"
@@ -391,6 +391,7 @@ DEPRECATED static struct s_varmap {
 	{"dumpall", PT_bool, &global_dumpall, PA_PUBLIC, "dumpall enable flag"},
 	{"runchecks", PT_bool, &global_runchecks, PA_PUBLIC, "runchecks enable flag"},
 	{"threadcount", PT_int32, &global_threadcount, PA_PUBLIC, "number of threads to use while using multicore"},
+	{"thread_affinity", PT_bool, &global_thread_affinity, PA_PUBLIC, "bind thread pool workers to processors in NUMA node order"},
 	{"profiler", PT_bool, &global_profiler, PA_PUBLIC, "profiler enable flag"},
 	{"pauseatexit", PT_bool, &global_pauseatexit, PA_PUBLIC, "pause at exit flag"},
 	{"testoutputfile", PT_char1024, &global_testoutputfile, PA_PUBLIC, "filename for test output"},
@@ -420,6 +421,13 @@ DEPRECATED static struct s_varmap {
 	{"force_compile", PT_int32, &global_force_compile, PA_PUBLIC, "force recompile enable flag"},
 	{"nolocks", PT_bool, &global_nolocks, PA_PUBLIC, "locking disable flag"},
 	{"skipsafe", PT_bool, &global_skipsafe, PA_PUBLIC, "skip sync safe enable flag"},
+	{"event_scheduler", PT_bool, &global_event_scheduler, PA_PUBLIC, "event scheduler enable flag"},
+	{"event_skips", PT_int64, &global_event_skips, PA_REFERENCE, "number of object syncs skipped by the event scheduler"},
+	{"event_tolerance", PT_int32, &global_event_tolerance, PA_PUBLIC, "time in seconds by which events of coalescable objects may be delayed"},
+	{"event_coalesced", PT_int64, &global_event_coalesced, PA_REFERENCE, "number of object events delayed to a later timestep"},
+	{"event_delay_total", PT_int64, &global_event_delay_total, PA_REFERENCE, "total delay in seconds of the delayed events"},
+	{"event_delay_max", PT_int64, &global_event_delay_max, PA_REFERENCE, "longest delay in seconds of a delayed event"},
+	{"event_steps_avoided", PT_int64, &global_event_steps_avoided, PA_REFERENCE, "number of distinct event times that did not become a timestep"},
 	{"dateformat", PT_enumeration, &global_dateformat, PA_PUBLIC, "date format string", df_keys},
 	{"init_sequence", PT_enumeration, &global_init_sequence, PA_PUBLIC, "initialization sequence control flag", isc_keys},
 	{"minimum_timestep", PT_int32, &global_minimum_timestep, PA_PUBLIC, "minimum timestep"},
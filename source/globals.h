@@ -263,6 +263,9 @@ GLOBAL int global_runchecks INIT(FALSE); /**< Flags module check code to be call
 /* Variable: global_threadcount */
 GLOBAL int global_threadcount INIT(1); /**< the maximum thread limit, zero means automagically determine best thread count */
 
+/* Variable: global_thread_affinity */
+GLOBAL int global_thread_affinity INIT(FALSE); /**< Flags the core thread pool workers to be bound to processors in NUMA node order */
+
 /* Variable: global_profiler */
 GLOBAL int global_profiler INIT(0); /**< Flags the profiler to process class performance data */
 
@@ -351,6 +354,27 @@ GLOBAL int global_forbid_multiload INIT(0); /** flag to disable multiple GLM fil
 /* Variable: global_skipsafe */
 GLOBAL int global_skipsafe INIT(0); /** flag to allow skipping of safe syncs (see OF_SKIPSAFE) */
 
+/* Variable: global_event_scheduler */
+GLOBAL int global_event_scheduler INIT(0); /** flag to sync skip-safe objects only when they have an event due (see OF_SKIPSAFE) */
+
+/* Variable: global_event_skips */
+GLOBAL int64 global_event_skips INIT(0); /** number of object syncs skipped by the event scheduler */
+
+/* Variable: global_event_tolerance */
+GLOBAL int32 global_event_tolerance INIT(0); /** time in seconds by which events of coalescable objects may be delayed to share a timestep (see OF_COALESCE) */
+
+/* Variable: global_event_coalesced */
+GLOBAL int64 global_event_coalesced INIT(0); /** number of object events that were delayed to a later timestep */
+
+/* Variable: global_event_delay_total */
+GLOBAL int64 global_event_delay_total INIT(0); /** total delay in seconds of the events that were delayed */
+
+/* Variable: global_event_delay_max */
+GLOBAL int64 global_event_delay_max INIT(0); /** longest delay in seconds of an event that was delayed */
+
+/* Variable: global_event_steps_avoided */
+GLOBAL int64 global_event_steps_avoided INIT(0); /** number of distinct event times that did not become a timestep because they were delayed */
+
 /* Variable: global_dateformat */
 GLOBAL int global_dateformat INIT(DF_ISO); /** date format (ISO=0, US=1, EURO=2) */
 
@@ -1679,6 +1679,13 @@ inline DEPRECATED void wunlock(LOCKVAR* lock) { callback->unlock.write(lock); }
 
 #define LOCKED(X,C) DEPRECATED {WRITELOCK_OBJECT(X);(C);WRITEUNLOCK_OBJECT(X);} /**< @todo this is deprecated and should not be used anymore */
 
+// thread pool functions
+#ifdef __cplusplus
+inline TPBATCH *gl_threadpool_batch(const char *name) { return callback->threadpool.batch(name); } /**< Gets the core thread pool batch with the given name */
+inline void gl_threadpool_run(TPBATCH *batch, TPTASKCALL call, void *data, unsigned int n_tasks) { callback->threadpool.run(batch,call,data,n_tasks); } /**< Runs tasks 0 through n_tasks-1 on the core thread pool and waits for them */
+inline unsigned int gl_threadpool_size(void) { return callback->threadpool.size(); } /**< Gets the number of tasks the core thread pool can run at once */
+#endif
+
 #include <math.h>
 #define NaN NAN
 
@@ -484,6 +484,7 @@ int GldJsonWriter::write_objects(FILE *fp)
 		if ( obj->out_svc > TS_ZERO && obj->out_svc < TS_NEVER ) TUPLE("out","%llu",(int64)(obj->out_svc));
 		TUPLE("rng_state","%llu",(int64)(obj->rng_state));
 		if ( obj->heartbeat != 0 ) TUPLE("heartbeat","%llu",(int64)(obj->heartbeat));
+		if ( obj->event_tolerance != 0 ) TUPLE("event_tolerance","%llu",(int64)(obj->event_tolerance));
 		(len += write(",\n\t\t\t\"%s\" : \"%llX%llX\"","guid",(int64)(obj->guid[0]),(int64)(obj->guid[1])));
 		TUPLE("flags","0x%llx",(int64)(obj->flags));
 		for ( prop = object_get_first_property(obj) ; prop != NULL ; prop = object_get_next_property(prop) )
@@ -4781,6 +4781,17 @@ int GldLoader::object_properties(PARSER, CLASS *oclass, OBJECT *obj)
 						SAVETERM;
 						ACCEPT;
 					}
+					else if ( strcmp(propname,"event_tolerance")==0 )
+					{
+						obj->event_tolerance = convert_to_timestamp(propval);
+						if ( obj->event_tolerance == TS_INVALID || obj->event_tolerance < 0 )
+						{
+							syntax_error(filename,linenum,"event_tolerance %s is not valid", propval);
+							REJECT;
+						}
+						SAVETERM;
+						ACCEPT;
+					}
 					else if (strcmp(propname,"groupid")==0)
 					{
 						memcpy(obj->groupid, propval, sizeof(obj->groupid));
@@ -30,6 +30,9 @@
 
 #include "gldcore.h"
 
+#include <map>
+#include <vector>
+
 SET_MYCONTEXT(DMC_LOADSHAPE)
 
 static loadshape *loadshape_list = NULL;
@@ -933,79 +936,187 @@ TIMESTAMP loadshape_sync(loadshape *ls, TIMESTAMP t1)
 	return rt;
 }
 
-typedef struct s_loadshapesyncdata {
-	unsigned int n;
-	pthread_t pt;
-	bool ok;
-	loadshape *ls;
-	unsigned int ns;
-	TIMESTAMP t0;
-	unsigned int ran;
-} LOADSHAPESYNCDATA;
-
-static pthread_cond_t start_ls = PTHREAD_COND_INITIALIZER;
-static pthread_mutex_t startlock_ls = PTHREAD_MUTEX_INITIALIZER;
-static pthread_cond_t done_ls = PTHREAD_COND_INITIALIZER;
-static pthread_mutex_t donelock_ls = PTHREAD_MUTEX_INITIALIZER;
-static TIMESTAMP next_t1_ls, next_t2_ls;
-static unsigned int run = 0;
-static unsigned int donecount_ls;
-
-clock_t loadshape_synctime = 0;
+/* Analog and scheduled loadshapes draw no random numbers, so those with the same definition
+   and state produce the same results.  Only the first loadshape of each such group is
+   synchronized and the others copy its results when they change. */
+typedef struct s_loadshapegroup {
+	loadshape *first;	/* the loadshape synchronized for the group */
+	double load, q, r;	/* results of the first loadshape at the last update */
+	MACHINESTATE s;
+	TIMESTAMP t2;
+	bool changed;		/* results changed at the last update */
+} LOADSHAPEGROUP;
+typedef struct s_loadshapemember {
+	loadshape *ls;		/* a loadshape in a group other than its first */
+	int group;			/* the group of the loadshape, or -1 if its definition changed */
+} LOADSHAPEMEMBER;
+static std::vector<LOADSHAPEGROUP> groups;
+static std::vector<LOADSHAPEMEMBER> members; /* loadshapes removed from loadshape_list */
+
+/* only the definition is compared so that the loadshape is read as little as possible */
+static bool loadshape_samedef(loadshape *a, loadshape *b)
+{
+	if ( a->type != b->type || a->schedule != b->schedule )
+		return false;
+	switch ( a->type ) {
+	case MT_ANALOG:
+		return a->params.analog.energy == b->params.analog.energy && a->params.analog.power == b->params.analog.power;
+	case MT_SCHEDULED:
+		return memcmp(&(a->params.scheduled),&(b->params.scheduled),sizeof(a->params.scheduled)) == 0;
+	default:
+		return false;
+	}
+}
 
-void *loadshape_syncproc(void *ptr)
+static bool loadshape_groupkey(loadshape *ls, std::string &key)
 {
-	LOADSHAPESYNCDATA *data = (LOADSHAPESYNCDATA*)ptr;
-	loadshape *s;
-	unsigned int n;
-	TIMESTAMP t2;
+	size_t size;
+	switch ( ls->type ) {
+	case MT_ANALOG:
+		size = sizeof(ls->params.analog);
+		break;
+	case MT_SCHEDULED:
+		size = sizeof(ls->params.scheduled);
+		break;
+	default:
+		return false;
+	}
+	key.assign((const char*)&(ls->type),sizeof(ls->type));
+	key.append((const char*)&(ls->schedule),sizeof(ls->schedule));
+	key.append((const char*)&(ls->params),size);
+	key.append((const char*)&(ls->q),sizeof(ls->q));
+	key.append((const char*)&(ls->r),sizeof(ls->r));
+	key.append((const char*)&(ls->s),sizeof(ls->s));
+	key.append((const char*)&(ls->t0),sizeof(ls->t0));
+	key.append((const char*)&(ls->t2),sizeof(ls->t2));
+	return true;
+}
 
-	// begin processing loop
-	while ( data->ok )
+/* move loadshapes that have the same definition and state as an earlier one to the members of its group */
+static void loadshape_group(void)
+{
+	std::map<std::string,int> found;
+	std::string key;
+	loadshape *ls, *next, *last = NULL;
+	for ( ls=loadshape_list ; ls!=NULL ; ls=next )
 	{
-		// lock access to start condition
-		pthread_mutex_lock(&startlock_ls);
+		next = ls->next;
+		if ( ! loadshape_groupkey(ls,key) )
+		{
+			last = ls;
+			continue;
+		}
+		std::map<std::string,int>::iterator item = found.find(key);
+		if ( item == found.end() )
+		{
+			LOADSHAPEGROUP group = {ls, QNAN, QNAN, QNAN, MS_OFF, TS_NEVER, true};
+			found[key] = (int)groups.size();
+			groups.push_back(group);
+			last = ls;
+			continue;
+		}
+		if ( last == NULL )
+			loadshape_list = next;
+		else
+			last->next = next;
+		ls->next = NULL;
+		LOADSHAPEMEMBER member = {ls, item->second};
+		members.push_back(member);
+		n_shapes--;
+	}
 
-		// wait for thread start condition
-		while ( data->t0==next_t1_ls && data->ran==run ) 
-			pthread_cond_wait(&start_ls,&startlock_ls);
-		
-		// unlock access to start count
-		pthread_mutex_unlock(&startlock_ls);
+	// groups without members need not be checked
+	std::vector<int> index(groups.size(),-1);
+	std::vector<LOADSHAPEGROUP> used;
+	for ( std::vector<LOADSHAPEMEMBER>::iterator member=members.begin() ; member!=members.end() ; member++ )
+	{
+		if ( index[member->group] < 0 )
+		{
+			index[member->group] = (int)used.size();
+			used.push_back(groups[member->group]);
+		}
+		member->group = index[member->group];
+	}
+	groups.swap(used);
+	IN_MYCONTEXT output_verbose("loadshape_group(): %d loadshapes copy the results of %d loadshapes with the same definition", (int)members.size(), (int)groups.size());
+}
 
-		// process the list for this thread
-		t2 = TS_NEVER;
-		for ( s=data->ls, n=0 ; s!=NULL && n<data->ns ; s=s->next, n++ )
+/* copy the results of the groups to their members, synchronizing those whose definition changed since they
+   were grouped; t0 is the time of the previous update of all the loadshapes */
+static TIMESTAMP loadshape_syncgroups(TIMESTAMP t0, TIMESTAMP t1)
+{
+	TIMESTAMP t2 = TS_NEVER;
+	for ( std::vector<LOADSHAPEGROUP>::iterator group=groups.begin() ; group!=groups.end() ; group++ )
+	{
+		loadshape *ls = group->first;
+		group->changed = ( ls->load != group->load || ls->q != group->q || ls->r != group->r || ls->s != group->s || ls->t2 != group->t2 );
+		if ( group->changed )
+		{
+			group->load = ls->load;
+			group->q = ls->q;
+			group->r = ls->r;
+			group->s = ls->s;
+			group->t2 = ls->t2;
+		}
+		if ( group->t2 > 0 && group->t2 < t2 ) t2 = group->t2;
+	}
+	for ( std::vector<LOADSHAPEMEMBER>::iterator member=members.begin() ; member!=members.end() ; member++ )
+	{
+		loadshape *ls = member->ls;
+		if ( member->group >= 0 && ! loadshape_samedef(ls,groups[member->group].first) )
 		{
-			TIMESTAMP t = loadshape_sync(s,next_t1_ls);
-			if (t<t2) t2 = t;
+			IN_MYCONTEXT output_debug("loadshape_syncgroups(t1=%lld): loadshape %p definition changed, it is no longer grouped", (long long)t1, ls);
+			ls->t0 = t0;
+			member->group = -1;
 		}
+		if ( member->group < 0 )
+		{
+			TIMESTAMP t3 = loadshape_sync(ls,t1);
+			if ( t3 < t2 ) t2 = t3;
+		}
+		else if ( groups[member->group].changed )
+		{
+			LOADSHAPEGROUP &group = groups[member->group];
+			ls->load = group.load;
+			ls->q = group.q;
+			ls->r = group.r;
+			ls->s = group.s;
+			ls->t2 = group.t2;
+		}
+	}
+	return t2;
+}
 
-		// signal completed condition
-		data->t0 = next_t1_ls;
-		data->ran++;
+typedef struct s_loadshapesyncdata {
+	loadshape *ls;
+	unsigned int ns;
+	TIMESTAMP t2;
+} LOADSHAPESYNCDATA;
 
-		// lock access to done condition
-		pthread_mutex_lock(&donelock_ls);
+static TIMESTAMP next_t1_ls, next_t2_ls;
+static TIMESTAMP last_t1_ls = TS_ZERO; /* time of the last update of all the loadshapes */
 
-		// signal thread is done for now
-		donecount_ls--;
-		///printf("action: donecount_ls-- = %d\n", donecount_ls);
-		if ( t2<next_t2_ls ) next_t2_ls = t2;
+clock_t loadshape_synctime = 0;
 
-		// signal change in done condition
-		pthread_cond_broadcast(&done_ls);
+static void loadshape_synctask(void *ptr, unsigned int n)
+{
+	LOADSHAPESYNCDATA *data = (LOADSHAPESYNCDATA*)ptr + n;
+	loadshape *s;
+	unsigned int m;
 
-		// unlock access to done count
-		pthread_mutex_unlock(&donelock_ls);
+	// process the list for this task
+	data->t2 = TS_NEVER;
+	for ( s=data->ls, m=0 ; s!=NULL && m<data->ns ; s=s->next, m++ )
+	{
+		TIMESTAMP t = loadshape_sync(s,next_t1_ls);
+		if (t<data->t2) data->t2 = t;
 	}
-	pthread_exit((void*)0);
-	return (void*)0;
 }
 TIMESTAMP loadshape_syncall(TIMESTAMP t1)
 {
 	static unsigned int n_threads_ls=0;
 	static LOADSHAPESYNCDATA *thread_ls = NULL;
+	static TPBATCH *batch_ls = NULL;
 	TIMESTAMP t2 = TS_NEVER;
 	clock_t ts = (clock_t)exec_clock();
 
@@ -1013,7 +1124,15 @@ TIMESTAMP loadshape_syncall(TIMESTAMP t1)
 	if (n_shapes == 0)
 		return TS_NEVER;
 
-	// number of threads desired
+	// group the loadshapes once their objects are initialized
+	static bool grouped = false;
+	if ( ! grouped )
+	{
+		loadshape_group();
+		grouped = true;
+	}
+
+	// number of tasks desired
 	if (n_threads_ls==0) 
 	{
 		loadshape *s;
@@ -1021,32 +1140,31 @@ TIMESTAMP loadshape_syncall(TIMESTAMP t1)
 
 		IN_MYCONTEXT output_debug("loadshape_syncall setting up for %d shapes", n_shapes);
 
-		// determine needed threads
-		n_threads_ls = global_threadcount;
+		// determine needed tasks
+		n_threads_ls = global_threadcount>1 ? threadpool_size() : 1;
 		if (n_threads_ls>1)
 		{
-			unsigned int n;
 			if (n_shapes<n_threads_ls*4)
 				n_threads_ls = n_shapes/4;
 
-			// only need 1 thread if n_shapes is less than 4
+			// only need 1 task if n_shapes is less than 4
 			if (n_threads_ls == 0)
 				n_threads_ls = 1;
 
-			// determine shapes per thread
+			// determine shapes per task
 			n_items = n_shapes/n_threads_ls;
 			n_threads_ls = n_shapes/n_items;
 			if (n_threads_ls*n_items<n_shapes) // not enough slots yet
-				n_threads_ls++; // add one underused threads
+				n_threads_ls++; // add one underused task
 
-			IN_MYCONTEXT output_debug("loadshape_syncall is using %d of %d available threads", n_threads_ls, global_threadcount);
+			IN_MYCONTEXT output_debug("loadshape_syncall is using %d of %d available threads", n_threads_ls, threadpool_size());
 			IN_MYCONTEXT output_debug("loadshape_syncall is assigning %d shapes per thread", n_items);
 
-			// allocate thread list
+			// allocate task list
 			thread_ls = (LOADSHAPESYNCDATA*)malloc(sizeof(LOADSHAPESYNCDATA)*n_threads_ls);
 			memset(thread_ls,0,sizeof(LOADSHAPESYNCDATA)*n_threads_ls);
 
-			// assign starting shape for each thread
+			// assign starting shape for each task
 			for (s=loadshape_list; s!=NULL; s=s->next)
 			{
 				if (thread_ls[ln].ns==n_items)
@@ -1055,19 +1173,7 @@ TIMESTAMP loadshape_syncall(TIMESTAMP t1)
 					thread_ls[ln].ls = s;
 				thread_ls[ln].ns++;
 			}
-
-			// create threads
-			for (n=0; n<n_threads_ls; n++)
-			{
-				thread_ls[n].ok = true;
-				if ( pthread_create(&(thread_ls[n].pt),NULL,loadshape_syncproc,&(thread_ls[n]))!=0 )
-				{
-					output_fatal("loadshape_sync thread creation failed");
-					thread_ls[n].ok = false;
-				}
-				else
-					thread_ls[n].n = n;
-			}
+			batch_ls = threadpool_batch("loadshape");
 		}
 	}
 
@@ -1085,45 +1191,28 @@ TIMESTAMP loadshape_syncall(TIMESTAMP t1)
 			TIMESTAMP t3 = loadshape_sync(s,t1);
 			if (t3<t2) t2 = t3;
 		}
-		next_t2_ls = t2;
 	}
 	else
 	{
-		// lock access to done count
-		pthread_mutex_lock(&donelock_ls);
-
-		// initialize wait count
-		donecount_ls = n_threads_ls;
-
-		// lock access to start condition
-		pthread_mutex_lock(&startlock_ls);
+		unsigned int n;
 
-		// update start condition
+		// run the tasks on the thread pool
 		next_t1_ls = t1;
-		next_t2_ls = TS_NEVER;
-		run++;
-
-		// signal all the threads
-		pthread_cond_broadcast(&start_ls);
-
-		// unlock access to start count
-		pthread_mutex_unlock(&startlock_ls);
+		threadpool_run(batch_ls,loadshape_synctask,thread_ls,n_threads_ls);
 
-		// begin wait
-		while (donecount_ls>0) {
-			///printf("status: donecount_ls-- = %d\n", donecount_ls);
-			///printf("thread_ls.ok=%d\n",thread_ls->ok);
-			pthread_cond_wait(&done_ls,&donelock_ls);
+		// process results from all tasks
+		for (n=0; n<n_threads_ls; n++)
+		{
+			if (thread_ls[n].t2<t2) t2 = thread_ls[n].t2;
 		}
-		IN_MYCONTEXT output_debug("passed donecount==0 condition");
-
-		// unlock done count
-		pthread_mutex_unlock(&donelock_ls);
-
-		// process results from all threads
-		if (next_t2_ls<t2) t2=next_t2_ls;
 	}
 
+	// copy results to grouped shapes
+	TIMESTAMP t3 = loadshape_syncgroups(last_t1_ls,t1);
+	if (t3<t2) t2 = t3;
+	next_t2_ls = t2;
+
+	last_t1_ls = t1;
 	loadshape_synctime += exec_clock() - ts;
 	return t2;
 }
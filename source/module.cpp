@@ -240,6 +240,7 @@ static CALLBACKS callbacks = {
 	{version_major,version_minor,version_patch,version_build,version_branch},
 	call_external_callback,
 	{NULL,python_embed_import,python_embed_call,python_property_gettype},
+	{threadpool_batch,threadpool_submit,threadpool_wait,threadpool_run,threadpool_size},
 	MAGIC /* used to check structure */
 };
 CALLBACKS *module_callbacks(void) { return &callbacks; }
@@ -64,7 +64,8 @@ KEYWORD oflags[] = {
 	{"QUIET", OF_QUIET, oflags + 7},
 	{"WARNING", OF_WARNING, oflags + 8},
 	{"VERBOSE", OF_VERBOSE, oflags + 9},
-	{"DEBUG", OF_DEBUG, NULL},
+	{"DEBUG", OF_DEBUG, oflags + 10},
+	{"COALESCE", OF_COALESCE, NULL},
 };
 
 /* WARNING: untested. -d3p988 30 Jan 08 */
@@ -193,6 +194,11 @@ static const char *header_heartbeat_to_string(OBJECT *obj)
 	return obj->heartbeat != 0 && snprintf(header_string,sizeof(header_string),"%llu",obj->heartbeat) > 0 ? header_string : NULL;
 }
 
+static const char *header_event_tolerance_to_string(OBJECT *obj)
+{
+	return obj->event_tolerance != 0 && snprintf(header_string,sizeof(header_string),"%llu",obj->event_tolerance) > 0 ? header_string : NULL;
+}
+
 static const char *header_guid_to_string(OBJECT *obj)
 {
 	return snprintf(header_string,sizeof(header_string),"%llX%llX",obj->guid[0],obj->guid[1]) > 0 ? header_string : NULL;
@@ -298,6 +304,7 @@ HEADERDATA headerdata[] = {
 	HDATA(out_svc,"timestamp")
 	HDATA(rng_state,"int32")
 	HDATA(heartbeat,"int64")
+	HDATA(event_tolerance,"int64")
 	HDATAX(guid,"int64",header_guid_to_string,2)
 	HDATAX(profiler.presync,"int32",header_profiler_presync_to_string,0)
 	HDATAX(profiler.sync,"int32",header_profiler_sync_to_string,0)
@@ -610,6 +617,7 @@ OBJECT *object_create_single(CLASS *oclass) /**< the class of the object */
 	obj->flags = OF_NONE;
 	obj->rng_state = randwarn(NULL);
 	obj->heartbeat = 0;
+	obj->event_tolerance = 0;
 	obj->events = oclass->events;
 	random_key(obj->guid,sizeof(obj->guid)/sizeof(obj->guid[0]));
 
@@ -1246,6 +1254,20 @@ static int set_header_value(OBJECT *obj, const char *name, const char *value,boo
 			return SUCCESS;
 		}
 	}
+	else if ( strcmp(name,"event_tolerance")==0 )
+	{
+		TIMESTAMP t = convert_to_timestamp(value);
+		if ( t == TS_INVALID || t < 0 )
+		{
+			output_error("object %s:%d event_tolerance '%s' is invalid", obj->oclass->name, obj->id, value);
+			return FAILED;
+		}
+		else
+		{
+			obj->event_tolerance = t;
+			return SUCCESS;
+		}
+	}
 	else if ( strcmp(name,"groupid")==0 )
 	{
 		if ( strlen(value)<sizeof(obj->groupid) )
@@ -1273,7 +1295,7 @@ static int set_header_value(OBJECT *obj, const char *name, const char *value,boo
 		output_error("object %s:%d called set_header_value() for invalid field '%s'", obj->oclass->name, obj->id, name);
 		/*	TROUBLESHOOT
 			The valid header fields are "name", "parent", "rank", "clock", "valid_to", "latitude",
-			"longitude", "in_svc", "out_svc", "heartbeat", and "flags".
+			"longitude", "in_svc", "out_svc", "heartbeat", "event_tolerance", and "flags".
 		*/
 		return FAILED;
 	}
@@ -1359,6 +1381,10 @@ const char *object_get_header_string(OBJECT *obj, const char *item, char *buffer
 	{
 		snprintf(buffer,len,"%llu",obj->heartbeat);
 	}
+	else if ( strcmp(item,"event_tolerance") == 0 )
+	{
+		snprintf(buffer,len,"%llu",obj->event_tolerance);
+	}
 	else if ( strcmp(item,"groupid") == 0 )
 	{
 		snprintf(buffer,len,"%s",(const char*)obj->groupid);
@@ -2576,6 +2602,8 @@ int object_saveall(FILE *fp) /**< the stream to write to */
 				count += fprintf(fp, "\tout_svc_micro \"%u\";\n", obj->out_svc_micro);
 			if ( obj->heartbeat != 0 )
 				count += fprintf(fp, "\theartbeat \"%lld\";\n", (int64)obj->heartbeat);
+			if ( obj->event_tolerance != 0 )
+				count += fprintf(fp, "\tevent_tolerance \"%lld\";\n", (int64)obj->event_tolerance);
 			if ( obj->guid[0] != 0 || obj->guid[1] != 0 )
 				count += fprintf(fp, "\tguid \"%08llX%08llX\";\n", obj->guid[0], obj->guid[1]);
 			if ( obj->events.init )
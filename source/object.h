@@ -47,6 +47,7 @@ HASH hash(OBJECTNAME name);
 #define OF_FORECAST		0x00000040	/**< Object flag; inidcates that the object has a valid forecast available */
 #define OF_DEFERRED		0x00000080	/**< Object flag; indicates that the object started to be initialized, but requested deferral */
 #define OF_INIT			0x00000100	/**< Object flag; indicates that the object has been successfully initialized */
+#define OF_COALESCE		0x00000200	/**< Object flag; indicates that the object's events may be delayed by up to event_tolerance */
 #define OF_RERANK		0x00004000	/**< Internal use only */
 #define OF_QUIET		0x00010000  /**< Object flag; disables error messages from the object */
 #define OF_WARNING		0x00020000  /**< Object flag; disables warning messages from the object */
@@ -122,6 +123,7 @@ typedef struct s_object_list {
 	LOCKVAR lock; /**< object lock */
 	unsigned int rng_state; /**< random number generator state */
 	TIMESTAMP heartbeat; /**< heartbeat call interval (in sim-seconds) */
+	TIMESTAMP event_tolerance; /**< time by which the object's soft events may be delayed (0 uses the event_tolerance global) */
 	unsigned long long guid[2]; /**< globally unique identifier */
 	EVENTHANDLERS events;
 	/* IMPORTANT: flags must be last */
@@ -371,6 +373,13 @@ typedef struct s_callbacks {
 		bool (*call)(PyObject *pModule, const char *method, const char *vargsfmt, va_list varargs, void *result);
 		PyObject *(*property_type)(void);
 	} python;
+	struct {
+		struct s_tpbatch *(*batch)(const char *name);
+		void (*submit)(struct s_tpbatch *batch, void (*call)(void*,unsigned int), void *data, unsigned int n_tasks);
+		void (*wait)(struct s_tpbatch *batch);
+		void (*run)(struct s_tpbatch *batch, void (*call)(void*,unsigned int), void *data, unsigned int n_tasks);
+		unsigned int (*size)(void);
+	} threadpool;
 	long unsigned int magic; /* used to check structure alignment */
 } CALLBACKS; /**< core callback function table */
 
@@ -0,0 +1,400 @@
+// File: source/python_property_array.cpp
+
+#include "gldcore.h"
+
+#define LF "\n"
+
+static PyMethodDef python_property_array_methods[] =
+{
+    { "refresh", (PyCFunction)python_property_array_refresh, METH_NOARGS, "Gather the object values into the array buffer, discarding uncommitted writes"},
+    { "commit", (PyCFunction)python_property_array_commit, METH_NOARGS, "Scatter the array buffer values to the objects"},
+    { "is_view", (PyCFunction)python_property_array_is_view, METH_NOARGS, "Check whether the array is a view of the object data"},
+    { NULL } // sentinel for iterators
+};
+
+static PyMemberDef python_property_array_members[] =
+{
+    { NULL } // sentinel for iterators
+};
+
+static PySequenceMethods python_property_array_sequence =
+{
+    python_property_array_length,    // sq_length
+};
+
+static PyBufferProcs python_property_array_buffer =
+{
+    python_property_array_getbuffer, // bf_getbuffer
+    NULL,                            // bf_releasebuffer
+};
+
+static const char *python_property_array_doc = PACKAGE ".property_array" LF
+    LF "Use this object to get vector access to a property of many objects,"
+    LF "e.g., numpy.asarray(" PACKAGE ".property_array('house','air_temperature'))";
+
+PyTypeObject python_property_array_type =
+{
+    PyVarObject_HEAD_INIT(NULL, 0)
+    PACKAGE ".property_array",             // tp_name
+    sizeof(python_property_array),         // tp_basicsize
+    0,                                     // tp_itemsize
+    python_property_array_dealloc,         // tp_dealloc
+    0,                                     // tp_vectorcall_offset
+    0,                                     // tp_getattr
+    0,                                     // tp_setattr
+    0,                                     // tp_as_async
+    python_property_array_repr,            // tp_repr
+    0,                                     // tp_as_number
+    &python_property_array_sequence,       // tp_as_sequence
+    0,                                     // tp_as_mapping
+    0,                                     // tp_hash
+    0,                                     // tp_call
+    0,                                     // tp_str
+    0,                                     // tp_getattro
+    0,                                     // tp_setattro
+    &python_property_array_buffer,         // tp_as_buffer
+    Py_TPFLAGS_DEFAULT,                    // tp_flags
+    python_property_array_doc,             // tp_doc
+    0,                                     // tp_traverse
+    0,                                     // tp_clear
+    0,                                     // tp_richcompare
+    0,                                     // tp_weaklistoffset
+    0,                                     // tp_iter
+    0,                                     // tp_iternext
+    python_property_array_methods,         // tp_methods
+    python_property_array_members,         // tp_members
+    0,                                     // tp_getset
+    0,                                     // tp_base
+    0,                                     // tp_dict
+    0,                                     // tp_descr_get
+    0,                                     // tp_descr_set
+    0,                                     // tp_dictoffset
+    python_property_array_create,          // tp_init
+    0,                                     // tp_alloc
+    python_property_array_new,             // tp_new
+};
+
+/// @returns Python object type definition
+PyObject *python_property_array_gettype ( void )
+{
+    return to_python(&python_property_array_type);
+}
+
+/// Get the python representation of obj
+PyObject *python_property_array_repr(PyObject *self)
+{
+    python_property_array *pyarray = to_python_property_array(self);
+    return PyUnicode_FromFormat("<" PACKAGE ".property_array:%s[%zd]%s>",
+        pyarray->prop ? pyarray->prop->name : "", pyarray->count,
+        pyarray->buffer ? "" : " view");
+}
+
+/// @returns Python object reference
+PyObject *python_property_array_new (
+    PyTypeObject* type, /// **gridlabd.property_array** type specification
+    PyObject*,
+    PyObject* )
+{
+    python_property_array *self = to_python_property_array(type->tp_alloc(type,0));
+    if ( self != NULL )
+    {
+        self->prop = NULL;
+        self->count = 0;
+        self->addr = NULL;
+        self->buffer = NULL;
+        self->shadow = NULL;
+        self->stride = 0;
+        self->itemsize = 0;
+        self->format = NULL;
+    }
+    return to_python(self);
+}
+
+void python_property_array_dealloc ( PyObject * self ) ///< Object reference
+{
+    python_property_array *pyarray = to_python_property_array(self);
+    free(pyarray->addr);
+    free(pyarray->buffer);
+    free(pyarray->shadow);
+    Py_TYPE(self)->tp_free(self);
+}
+
+/// Get the buffer format of a property type
+/// @returns element size, or 0 if the type cannot be exposed as an array
+static Py_ssize_t property_array_format(PROPERTYTYPE ptype, const char **format)
+{
+    switch ( ptype )
+    {
+    case PT_double:
+        *format = "d";
+        return sizeof(double);
+    case PT_complex:
+        *format = "Zd";
+        return 2*sizeof(double);
+    case PT_int16:
+        *format = "h";
+        return sizeof(int16);
+    case PT_int32:
+        *format = "i";
+        return sizeof(int32);
+    case PT_int64:
+    case PT_timestamp:
+        *format = "q";
+        return sizeof(int64);
+    case PT_enumeration:
+        *format = "I";
+        return sizeof(enumeration);
+    case PT_set:
+        *format = "Q";
+        return sizeof(set);
+    case PT_bool:
+        *format = "?";
+        return sizeof(bool);
+    default:
+        return 0;
+    }
+}
+
+/// Check whether the object belongs to the class or one of its subclasses
+static bool property_array_isa(OBJECT *obj, CLASS *oclass)
+{
+    for ( CLASS *c = obj->oclass ; c != NULL ; c = c->parent )
+    {
+        if ( c == oclass )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Copy the object values into the buffer
+static void property_array_gather(python_property_array *pyarray)
+{
+    char *buffer = pyarray->buffer;
+    const Py_ssize_t size = pyarray->itemsize;
+    for ( Py_ssize_t n = 0 ; n < pyarray->count ; n++, buffer += size )
+    {
+        memcpy(buffer,pyarray->addr[n],size);
+    }
+    memcpy(pyarray->shadow,pyarray->buffer,size*pyarray->count);
+}
+
+/// Copy the buffer values into the objects
+static void property_array_scatter(python_property_array *pyarray)
+{
+    const char *buffer = pyarray->buffer;
+    const Py_ssize_t size = pyarray->itemsize;
+    for ( Py_ssize_t n = 0 ; n < pyarray->count ; n++, buffer += size )
+    {
+        memcpy(pyarray->addr[n],buffer,size);
+    }
+    memcpy(pyarray->shadow,pyarray->buffer,size*pyarray->count);
+}
+
+/// Check whether python wrote to the buffer since the last gather or scatter
+static bool property_array_dirty(python_property_array *pyarray)
+{
+    return memcmp(pyarray->buffer,pyarray->shadow,pyarray->itemsize*pyarray->count) != 0;
+}
+
+/// Add an object to the array
+/// @returns 0 on success, -1 on failure (with python error set)
+static int property_array_add(python_property_array *pyarray, OBJECT *obj, const char *property_name, Py_ssize_t size)
+{
+    PROPERTY *prop = object_get_property(obj,property_name,NULL);
+    if ( prop == NULL )
+    {
+        PyErr_Format(PyExc_Exception,"object %s:%d has no property '%s'",obj->oclass->name,obj->id,property_name);
+        return -1;
+    }
+    if ( pyarray->prop == NULL )
+    {
+        pyarray->prop = prop;
+        pyarray->itemsize = property_array_format(prop->ptype,&pyarray->format);
+        if ( pyarray->itemsize == 0 )
+        {
+            PyErr_Format(PyExc_Exception,"property '%s' type cannot be used in an array",property_name);
+            return -1;
+        }
+        pyarray->addr = (void**)malloc(sizeof(void*)*size);
+        if ( pyarray->addr == NULL )
+        {
+            PyErr_NoMemory();
+            return -1;
+        }
+    }
+    else if ( prop->ptype != pyarray->prop->ptype )
+    {
+        PyErr_Format(PyExc_Exception,"object %s:%d property '%s' type differs from the other objects",obj->oclass->name,obj->id,property_name);
+        return -1;
+    }
+    pyarray->addr[pyarray->count++] = property_addr(obj,prop);
+    return 0;
+}
+
+/// @returns
+///   * 0: gridlabd.property_array created
+///   * -1: Invalid arguments
+///   * -2: Invalid class name or group expression
+///   * -3: Invalid property name or type
+int python_property_array_create (
+    PyObject* self, ///< Python **gridlabd.property_array** reference
+    PyObject* args, ///< Python argument list (class name or group expression, property name)
+    PyObject* kwds ) ///< Python keywords list
+{
+    python_property_array *pyarray = to_python_property_array(self);
+    static char *kwlist[] =
+    {
+        strdup("objects"),
+        strdup("property"),
+        NULL,
+    };
+    char *objects = NULL;
+    char *property_name = NULL;
+
+    if ( ! PyArg_ParseTupleAndKeywords(args, kwds, "ss", kwlist,
+            &objects, &property_name))
+    {
+        return -1;
+    }
+
+    // collect the property address of each object
+    CLASS *oclass = class_get_class_from_classname(objects);
+    if ( oclass != NULL )
+    {
+        Py_ssize_t size = 0;
+        OBJECT *obj;
+        for ( obj = object_get_first() ; obj != NULL ; obj = object_get_next(obj) )
+        {
+            if ( property_array_isa(obj,oclass) ) size++;
+        }
+        for ( obj = object_get_first() ; obj != NULL ; obj = object_get_next(obj) )
+        {
+            if ( property_array_isa(obj,oclass) && property_array_add(pyarray,obj,property_name,size) < 0 )
+            {
+                return -3;
+            }
+        }
+    }
+    else
+    {
+        FINDLIST *list = find_objects(FL_GROUP,objects);
+        if ( list == NULL )
+        {
+            PyErr_Format(PyExc_Exception,"'%s' is not a class name or a valid group expression",objects);
+            return -2;
+        }
+        for ( OBJECT *obj = find_first(list) ; obj != NULL ; obj = find_next(list,obj) )
+        {
+            if ( property_array_add(pyarray,obj,property_name,list->hit_count) < 0 )
+            {
+                module_free(list);
+                return -3;
+            }
+        }
+        module_free(list);
+    }
+    if ( pyarray->count == 0 )
+    {
+        PyErr_Format(PyExc_Exception,"'%s' does not match any objects",objects);
+        return -2;
+    }
+
+    // use a view when the addresses are equally spaced
+    pyarray->stride = pyarray->count > 1 ? (char*)pyarray->addr[1] - (char*)pyarray->addr[0] : pyarray->itemsize;
+    bool strided = ( pyarray->stride != 0 );
+    for ( Py_ssize_t n = 2 ; strided && n < pyarray->count ; n++ )
+    {
+        strided = ( (char*)pyarray->addr[n] - (char*)pyarray->addr[n-1] == pyarray->stride );
+    }
+    if ( ! strided )
+    {
+        pyarray->stride = pyarray->itemsize;
+        pyarray->buffer = (char*)malloc(pyarray->itemsize*pyarray->count);
+        pyarray->shadow = (char*)malloc(pyarray->itemsize*pyarray->count);
+        if ( pyarray->buffer == NULL || pyarray->shadow == NULL )
+        {
+            PyErr_NoMemory();
+            return -1;
+        }
+        property_array_gather(pyarray);
+    }
+    return 0;
+}
+
+/// Get the number of objects
+Py_ssize_t python_property_array_length(PyObject *self)
+{
+    return to_python_property_array(self)->count;
+}
+
+/// Gather the object values into the buffer
+PyObject *python_property_array_refresh(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    python_property_array *pyarray = to_python_property_array(self);
+    if ( pyarray->buffer != NULL )
+    {
+        property_array_gather(pyarray);
+    }
+    Py_RETURN_NONE;
+}
+
+/// Scatter the buffer values back to the objects
+PyObject *python_property_array_commit(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    python_property_array *pyarray = to_python_property_array(self);
+    if ( pyarray->buffer != NULL )
+    {
+        property_array_scatter(pyarray);
+    }
+    Py_RETURN_NONE;
+}
+
+/// Check whether the buffer is a view of the object data
+PyObject *python_property_array_is_view(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    if ( to_python_property_array(self)->buffer == NULL )
+    {
+        Py_RETURN_TRUE;
+    }
+    else
+    {
+        Py_RETURN_FALSE;
+    }
+}
+
+/// Export the array using the python buffer protocol
+int python_property_array_getbuffer(PyObject *self, Py_buffer *view, int flags)
+{
+    python_property_array *pyarray = to_python_property_array(self);
+    if ( pyarray->count == 0 )
+    {
+        PyErr_SetString(PyExc_BufferError,"property array is not initialized");
+        view->obj = NULL;
+        return -1;
+    }
+    if ( pyarray->stride != pyarray->itemsize && (flags&PyBUF_STRIDES) != PyBUF_STRIDES )
+    {
+        PyErr_SetString(PyExc_BufferError,"property array view is not contiguous");
+        view->obj = NULL;
+        return -1;
+    }
+    if ( pyarray->buffer != NULL && ! property_array_dirty(pyarray) )
+    {
+        property_array_gather(pyarray);
+    }
+    view->obj = self;
+    view->buf = pyarray->buffer ? pyarray->buffer : pyarray->addr[0];
+    view->len = pyarray->itemsize * pyarray->count;
+    view->readonly = 0;
+    view->itemsize = pyarray->itemsize;
+    view->format = (flags&PyBUF_FORMAT) ? (char*)pyarray->format : NULL;
+    view->ndim = 1;
+    view->shape = (flags&PyBUF_ND) ? &pyarray->count : NULL;
+    view->strides = (flags&PyBUF_STRIDES) == PyBUF_STRIDES ? &pyarray->stride : NULL;
+    view->suboffsets = NULL;
+    view->internal = NULL;
+    Py_INCREF(self);
+    return 0;
+}
@@ -0,0 +1,62 @@
+#ifndef _PYTHON_PROPERTY_ARRAY_H
+#define _PYTHON_PROPERTY_ARRAY_H
+
+/// Typedef for struct #s_python_property_array
+typedef struct s_python_property_array python_property_array;
+
+/// python_property_array data
+///
+/// The array exposes one property of many objects through the python buffer
+/// protocol.  When the property addresses are equally spaced (e.g., objects
+/// of the same class allocated contiguously) the buffer is a strided view of
+/// the live object data.  Otherwise values are gathered into a contiguous
+/// buffer by refresh() and scattered back to the objects by commit().  A
+/// buffer export only re-gathers when python has not written to the buffer
+/// since the last gather or commit, so uncommitted writes are kept.
+struct s_python_property_array
+{
+    PyObject_HEAD
+    PROPERTY *prop; ///< property of the first object
+    Py_ssize_t count; ///< number of objects
+    void **addr; ///< address of the property in each object
+    char *buffer; ///< gather/scatter buffer (NULL for strided views)
+    char *shadow; ///< buffer values as of the last gather or commit
+    Py_ssize_t stride; ///< byte stride between elements
+    Py_ssize_t itemsize; ///< size of one element
+    const char *format; ///< struct format of one element
+};
+
+/// Convert python property array to python_property_array data
+inline python_property_array *to_python_property_array(PyObject *obj) { return (python_property_array*)obj; };
+
+/// Get python type data for python_property_array
+PyObject *python_property_array_gettype(void);
+
+/// Allocate a new python property array object
+PyObject *python_property_array_new(PyTypeObject *type, PyObject *args, PyObject *kwds);
+
+/// Delete a python property array object
+void python_property_array_dealloc(PyObject *self);
+
+/// Create a python property array object
+int python_property_array_create(PyObject *obj, PyObject *args, PyObject *kwds);
+
+/// Get the python representation of obj
+PyObject *python_property_array_repr(PyObject *obj);
+
+/// Get the number of objects
+Py_ssize_t python_property_array_length(PyObject *self);
+
+/// Gather object values into the buffer
+PyObject *python_property_array_refresh(PyObject *self, PyObject *args, PyObject *kwds);
+
+/// Scatter buffer values back to the objects
+PyObject *python_property_array_commit(PyObject *self, PyObject *args, PyObject *kwds);
+
+/// Check whether the buffer is a view of the object data
+PyObject *python_property_array_is_view(PyObject *self, PyObject *args, PyObject *kwds);
+
+/// Buffer protocol
+int python_property_array_getbuffer(PyObject *self, Py_buffer *view, int flags);
+
+#endif
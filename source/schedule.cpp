@@ -513,26 +513,16 @@ int schedule_compile(SCHEDULE *sch)
 	return 1;
 }
 
-static pthread_cond_t sc_active = PTHREAD_COND_INITIALIZER;
-static pthread_mutex_t sc_activelock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t sc_statuslock = PTHREAD_MUTEX_INITIALIZER;
 static STATUS sc_status = SUCCESS;
-static int sc_running=0, sc_started=0, sc_done=0;
+static TPBATCH *sc_batch = NULL;
 
 void *schedule_createproc(void *args)
 {
 	STATUS status = SUCCESS;
 	SCHEDULE *sch = (SCHEDULE *)args;
 
-	pthread_mutex_lock(&sc_activelock);
-	while ( sc_running>=global_threadcount )
-	{
-		IN_MYCONTEXT output_debug("schedule '%s' creation waiting (%d of %d active)", sch->name, sc_running, global_threadcount);
-		pthread_cond_wait(&sc_active,&sc_activelock);
-	}
-	sc_running++;
-	IN_MYCONTEXT output_debug("deferred schedule '%s' creation starting (%d of %d active)", sch->name, sc_running, global_threadcount);
-	pthread_cond_broadcast(&sc_active);
-	pthread_mutex_unlock(&sc_activelock);
+	IN_MYCONTEXT output_debug("deferred schedule '%s' creation starting", sch->name);
 
 	/* compile the schedule */
 	if (schedule_compile(sch))
@@ -612,8 +602,8 @@ void *schedule_createproc(void *args)
 				 */
 		}
 
-		/* normalize */
-		if (sch->flags!=0)
+		/* normalize (the loader may already have marked a deferred schedule as user-defined) */
+		if ((sch->flags&~SN_USERDEFINED)!=0)
 			schedule_normalize(sch,sch->flags);
 
 		/* validate */
@@ -633,12 +623,12 @@ void *schedule_createproc(void *args)
 	else
 		status = FAILED;
 Done:
-	pthread_mutex_lock(&sc_activelock);
-	sc_running--;
-	sc_done++;
-	if ( status==FAILED ) sc_status=status;
-	pthread_cond_broadcast(&sc_active);
-	pthread_mutex_unlock(&sc_activelock);
+	if ( status==FAILED )
+	{
+		pthread_mutex_lock(&sc_statuslock);
+		sc_status = status;
+		pthread_mutex_unlock(&sc_statuslock);
+	}
 	if ( status==SUCCESS )
 	{
 		IN_MYCONTEXT output_debug("deferred creation of schedule '%s' completed", sch->name);
@@ -650,30 +640,22 @@ Done:
 	return new bool(status==SUCCESS) ;
 }
 
-std::list<pthread_t> thread_list;
+static void schedule_createtask(void *sch, unsigned int n)
+{
+	delete (bool*)schedule_createproc(sch);
+}
+
 /** Wait for deferred schedule creations to finish 
     @return the global status of schedule creation
  **/
 int schedule_createwait(void)
 {
-	int status = SUCCESS;
-	for ( std::list<pthread_t>::iterator thread = thread_list.begin() ; thread != thread_list.end() ; thread++ )
+	if ( sc_batch!=NULL )
 	{
-		void *rc;
-		pthread_join(*thread,&rc);
-		status |= *(int*)rc;
+		threadpool_wait(sc_batch);
+		IN_MYCONTEXT output_debug("all deferred schedule creations completed %s", sc_status==SUCCESS ? "successfully" : "with at least one failure");
 	}
-	return status;
-	// if ( sc_running==0 && sc_done==sc_started ) return sc_status;
-	// pthread_mutex_lock(&sc_activelock);
-	// while ( sc_running>0 || sc_done<sc_started )
-	// {
-	// 	IN_MYCONTEXT output_debug("waiting for deferred schedule creations to complete (%d of %d active)", sc_running, global_threadcount);
-	// 	pthread_cond_wait(&sc_active,&sc_activelock);
-	// }
-	// IN_MYCONTEXT output_debug("all deferred schedule creations completed %s", sc_status==SUCCESS ? "successfully" : "with at least one failure");
-	// pthread_mutex_unlock(&sc_activelock);
-	// return sc_status;
+	return sc_status;
 }
 
 /** Create a schedule. 
@@ -767,15 +749,9 @@ SCHEDULE *schedule_create(const char *name,		/**< the name of the schedule */
 	/* multithreaded creation */
 	else
 	{
-		static pthread_t thread_id;
-		if ( pthread_create(&thread_id,NULL,schedule_createproc,(void*)sch)!=0 )
-		{
-			/* fails so do it inline */
-			output_warning("schedule_createproc failed, schedule '%s' created inline instead", sch->name);
-			return schedule_createproc(sch) ? sch : NULL;
-		}
-		thread_list.push_back(thread_id);
-		sc_started++;
+		if ( sc_batch==NULL )
+			sc_batch = threadpool_batch("schedule_create");
+		threadpool_submit(sc_batch,schedule_createtask,(void*)sch,1);
 		return sch;
 	}
 }
@@ -1066,70 +1042,29 @@ TIMESTAMP schedule_sync(SCHEDULE *sch, /**< the schedule that is to be synchroni
 }
 
 typedef struct s_schedulesyncdata {
-	unsigned int n;
-	pthread_t pt;
-	bool ok;
 	SCHEDULE *sch;
 	unsigned int nsch;
-	TIMESTAMP t0;
+	TIMESTAMP t2;
 } SCHEDULESYNCDATA;
 
-static pthread_cond_t start_sch = PTHREAD_COND_INITIALIZER;
-static pthread_mutex_t startlock_sch = PTHREAD_MUTEX_INITIALIZER;
-static pthread_cond_t done_sch = PTHREAD_COND_INITIALIZER;
-static pthread_mutex_t donelock_sch = PTHREAD_MUTEX_INITIALIZER;
 static TIMESTAMP next_t1_sch;
 static TIMESTAMP next_t2_sch = TS_ZERO;
-static unsigned int donecount_sch;
 
 clock_t schedule_synctime = 0;
 
-void *schedule_syncproc(void *ptr)
+static void schedule_synctask(void *ptr, unsigned int n)
 {
-	SCHEDULESYNCDATA *data = (SCHEDULESYNCDATA*)ptr;
+	SCHEDULESYNCDATA *data = (SCHEDULESYNCDATA*)ptr + n;
 	SCHEDULE *sch;
-	unsigned int n;
-	TIMESTAMP t2;
+	unsigned int m;
 
-	// begin processing loop
-	while ( data->ok )
+	// process the list for this task
+	data->t2 = TS_NEVER;
+	for ( sch = data->sch, m=0 ; sch != NULL && m < data->nsch ; sch = sch->next, m++ )
 	{
-		// lock access to start condition
-		pthread_mutex_lock(&startlock_sch);
-
-		// wait for thread start condition
-		while (data->t0==next_t1_sch) 
-			pthread_cond_wait(&start_sch,&startlock_sch);
-		
-		// unlock access to start count
-		pthread_mutex_unlock(&startlock_sch);
-
-		// process the list for this thread
-		t2 = TS_NEVER;
-		for ( sch = data->sch, n=0 ; sch != NULL && n < data->nsch ; sch = sch->next, n++ )
-		{
-			TIMESTAMP t = schedule_sync(sch,next_t1_sch);
-			if (t<t2) t2 = t;
-		}
-
-		// signal completed condition
-		data->t0 = next_t1_sch;
-
-		// lock access to done condition
-		pthread_mutex_lock(&donelock_sch);
-
-		// signal thread is done for now
-		donecount_sch--;
-		if ( t2<next_t2_sch ) next_t2_sch = t2;
-
-		// signal change in done condition
-		pthread_cond_broadcast(&done_sch);
-
-		// unlock access to done count
-		pthread_mutex_unlock(&donelock_sch);
+		TIMESTAMP t = schedule_sync(sch,next_t1_sch);
+		if (t<data->t2) data->t2 = t;
 	}
-	pthread_exit((void*)0);
-	return (void*)0;
 }
 
 /** synchronized all the schedules to the time given
@@ -1139,6 +1074,7 @@ TIMESTAMP schedule_syncall(TIMESTAMP t1) /**< the time to which the schedule is
 {
 	static unsigned int n_threads_sch=0;
 	static SCHEDULESYNCDATA *thread_sch = NULL;
+	static TPBATCH *batch_sch = NULL;
 	TIMESTAMP t2 = TS_NEVER;
 	clock_t ts = (clock_t)exec_clock();
 
@@ -1147,40 +1083,39 @@ TIMESTAMP schedule_syncall(TIMESTAMP t1) /**< the time to which the schedule is
 		return TS_NEVER;
 
 
-	// number of threads desired
+	// number of tasks desired
 	if (n_threads_sch==0) 
 	{
 		SCHEDULE *sch;
 		size_t n_items, schn=0;
 
-		IN_MYCONTEXT output_debug("loadshape_syncall setting up for %d shapes", n_schedules);
+		IN_MYCONTEXT output_debug("schedule_syncall setting up for %d schedules", n_schedules);
 
-		// determine needed threads
-		n_threads_sch = global_threadcount;
+		// determine needed tasks
+		n_threads_sch = global_threadcount>1 ? threadpool_size() : 1;
 		if (n_threads_sch>1)
 		{
-			unsigned int n;
 			if (n_schedules<n_threads_sch*4)
 				n_threads_sch = n_schedules/4;
 
-			// only need 1 thread if n_schedules is less than 4
+			// only need 1 task if n_schedules is less than 4
 			if (n_threads_sch == 0)
 				n_threads_sch = 1;
 
-			// determine shapes per thread
+			// determine schedules per task
 			n_items = n_schedules/n_threads_sch;
 			n_threads_sch = n_schedules/n_items;
 			if (n_threads_sch*n_items<n_schedules) // not enough slots yet
-				n_threads_sch++; // add one underused threads
+				n_threads_sch++; // add one underused task
 
-			IN_MYCONTEXT output_debug("schedule_syncall is using %d of %d available threads", n_threads_sch, global_threadcount);
-			IN_MYCONTEXT output_debug("schedule_syncall is assigning %d shapes per thread", n_items);
+			IN_MYCONTEXT output_debug("schedule_syncall is using %d of %d available threads", n_threads_sch, threadpool_size());
+			IN_MYCONTEXT output_debug("schedule_syncall is assigning %d schedules per thread", n_items);
 
-			// allocate thread list
+			// allocate task list
 			thread_sch = (SCHEDULESYNCDATA*)malloc(sizeof(SCHEDULESYNCDATA)*n_threads_sch);
 			memset(thread_sch,0,sizeof(SCHEDULESYNCDATA)*n_threads_sch);
 
-			// assign starting shape for each thread
+			// assign starting schedule for each task
 			for (sch=schedule_list; sch!=NULL; sch=sch->next)
 			{
 				if (thread_sch[schn].nsch==n_items)
@@ -1189,19 +1124,7 @@ TIMESTAMP schedule_syncall(TIMESTAMP t1) /**< the time to which the schedule is
 					thread_sch[schn].sch = sch;
 				thread_sch[schn].nsch++;
 			}
-
-			// create threads
-			for (n=0; n<n_threads_sch; n++)
-			{
-				thread_sch[n].ok = true;
-				if ( pthread_create(&(thread_sch[n].pt),NULL,schedule_syncproc,&(thread_sch[n]))!=0 )
-				{
-					output_fatal("loadshape_sync thread creation failed");
-					thread_sch[n].ok = false;
-				}
-				else
-					thread_sch[n].n = n;
-			}
+			batch_sch = threadpool_batch("schedule");
 		}
 	}
 
@@ -1223,40 +1146,22 @@ TIMESTAMP schedule_syncall(TIMESTAMP t1) /**< the time to which the schedule is
 			TIMESTAMP t3 = schedule_sync(sch,t1);
 			if (t3<t2) t2 = t3;
 		}
-		next_t2_sch = t2;
 	}
 	else
 	{
-		// lock access to done count
-		pthread_mutex_lock(&donelock_sch);
+		unsigned int n;
 
-		// initialize wait count
-		donecount_sch = n_threads_sch;
-
-		// lock access to start condition
-		pthread_mutex_lock(&startlock_sch);
-
-		// update start condition
+		// run the tasks on the thread pool
 		next_t1_sch = t1;
-		next_t2_sch = TS_NEVER;
-
-		// signal all the threads
-		pthread_cond_broadcast(&start_sch);
-
-		// unlock access to start count
-		pthread_mutex_unlock(&startlock_sch);
+		threadpool_run(batch_sch,schedule_synctask,thread_sch,n_threads_sch);
 
-		// begin wait
-		while (donecount_sch>0) 
-			pthread_cond_wait(&done_sch,&donelock_sch);
-		IN_MYCONTEXT output_debug("passed donecount==0 condition");
-
-		// unlock done count
-		pthread_mutex_unlock(&donelock_sch);
-
-		// process results from all threads
-		if (next_t2_sch<t2) t2=next_t2_sch;
+		// process results from all tasks
+		for (n=0; n<n_threads_sch; n++)
+		{
+			if (thread_sch[n].t2<t2) t2 = thread_sch[n].t2;
+		}
 	}
+	next_t2_sch = t2;
 
 	schedule_synctime += (clock_t)exec_clock() - ts;
 	return t2;
@@ -12,3 +12,4 @@ source_solvers_glsolvers_la_SOURCES =
 source_solvers_glsolvers_la_SOURCES += source/solvers/etp.cpp
 source_solvers_glsolvers_la_SOURCES += source/solvers/main.cpp
 source_solvers_glsolvers_la_SOURCES += source/solvers/modified_euler.cpp
+source_solvers_glsolvers_la_SOURCES += source/solvers/newton_method.cpp
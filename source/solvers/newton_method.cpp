@@ -5,17 +5,21 @@
 #include "gldcore.h"
 #include "gridlabd.h"
 
-static unsigned int solver_version = 1; // change this each time to data structure changes
+static unsigned int solver_version = 2; // change this each time to data structure changes
 typedef struct {
 	unsigned int n; // dimensions (default 1)
 	double *x; // current values of x
-	double (**f)(double); // functions
-	double (**df)(double); // derivatives
+	double (**f)(double,void*); // functions
+	double (**df)(double,void*); // derivatives
 	double *p; // precisions
 	unsigned int *m; // multiplicities (default is 1)
 	unsigned char *s; // status (0=failed, 1=converge, 2=non-converged)
+	void *context; // caller data passed to the functions (default is NULL)
+	unsigned int i; // maximum iterations (default is max_iterations)
 } NMDATA;
 
+// the solver keeps no state between calls; each caller's problem is entirely in its NMDATA
+
 static unsigned int max_iterations = 100;
 static unsigned int dimensions = 1;
 
@@ -66,12 +70,14 @@ EXPORT int newton_method_get(char *param, ...)
 		{
 			NMDATA *data = (NMDATA*)va_arg(arg,NMDATA*);
 			data->n = dimensions;
-			data->df = (double(**)(double))malloc(sizeof(void*)*dimensions);
-			data->f = (double(**)(double))malloc(sizeof(void*)*dimensions);
+			data->df = (double(**)(double,void*))malloc(sizeof(void*)*dimensions);
+			data->f = (double(**)(double,void*))malloc(sizeof(void*)*dimensions);
 			data->x = (double*)malloc(sizeof(double)*dimensions);
 			data->m = (unsigned int*)malloc(sizeof(unsigned int)*dimensions);
 			data->p = (double*)malloc(sizeof(double)*dimensions);
 			data->s = (unsigned char*)malloc(sizeof(unsigned int)*dimensions);
+			data->context = NULL;
+			data->i = max_iterations;
 			size_t i;
 			for ( i=0 ; i<dimensions ; i++ )
 			{
@@ -101,13 +107,13 @@ EXPORT int newton_method_solve(NMDATA *data)
 	{
 		double &p = data->p[n];
 		double &x = data->x[n];
-		double (*f)(double) = data->f[n];
-		double (*df)(double) = data->df[n];
+		double (*f)(double,void*) = data->f[n];
+		double (*df)(double,void*) = data->df[n];
 		unsigned int &m = data->m[n];
-		double dx;
+		double dx = 0;
 		unsigned int i=0;
 		do { 
-			double dydx = (*df)(x);
+			double dydx = (*df)(x,data->context);
 			if ( isnan(dydx) || dydx==0 )
 			{
 				x = NaN;
@@ -118,13 +124,14 @@ EXPORT int newton_method_solve(NMDATA *data)
 				break;
 			else
 			{
-				dx = m*(*f)(x)/dydx;
+				dx = m*(*f)(x,data->context)/dydx;
 				x -= dx;
 			}
-			if ( i++>max_iterations )
+			if ( ++i>=data->i && fabs(dx)>p )
 			{
 				if ( s>0 ) s=2; // only flag if not already flagged for failure
 				data->s[n] = 2;
+				break;
 			}
 		} while ( fabs(dx)>p );
 	}
@@ -9,6 +9,12 @@
 
 #include "gldcore.h"
 
+#include <deque>
+#include <vector>
+#include <dirent.h>
+
+SET_MYCONTEXT(DMC_THREADPOOL)
+
 static int mti_debug_mode = 0;
 int mti_debug(MTI *mti, const char *fmt, ...)
 {
@@ -62,85 +68,430 @@ int processor_count(void)
 }
 #endif /* HAVE_GET_NPROCS */
 
-static MTICODE iterator_proc(MTIPROC *tp)
+/****************************************************************
+ * Core thread pool
+ ****************************************************************/
+
+typedef struct s_tptask {
+	TPBATCH *batch;		/**< batch to which the task belongs */
+	TPTASKCALL call;	/**< task call function */
+	void *data;			/**< data given to the task call */
+	unsigned int task;	/**< task number */
+	int64 queued;		/**< time the task was queued (ns) */
+} TPTASK; /**< queued task */
+
+typedef struct s_tpworker {
+	unsigned int id;	/**< worker number (0 is the waiting thread) */
+	int cpu;			/**< processor the worker is bound to (-1 if not bound) */
+	unsigned int node;	/**< NUMA node of the processor */
+	std::deque<TPTASK> queue; /**< tasks queued on this worker */
+	unsigned int tasks;	/**< number of tasks run */
+	unsigned int steals; /**< number of tasks taken from other workers */
+	int64 busy;			/**< time spent running tasks (ns) */
+	int64 idle;			/**< time spent waiting for tasks (ns) */
+} TPWORKER; /**< thread pool worker */
+
+static pthread_mutex_t tp_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t tp_work = PTHREAD_COND_INITIALIZER; /* tasks were queued or the pool is stopping */
+static pthread_cond_t tp_done = PTHREAD_COND_INITIALIZER; /* a batch completed */
+static std::vector<TPWORKER*> tp_worker;
+static std::vector<pthread_t> tp_thread;
+static unsigned int tp_nodes = 0;
+static unsigned int tp_queued = 0;
+static bool tp_stop = false;
+static TPBATCH *tp_batchlist = NULL;
+static thread_local TPWORKER *tp_self = NULL;
+static thread_local unsigned int tp_depth = 0; /* number of tasks the thread is running (waits inside a task are nested) */
+static pthread_t tp_main; /* thread that started the pool and waits as worker 0 */
+
+static int64 tp_now(void)
 {
-	MTI *mti = tp->mti;
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC,&ts);
+	return (int64)ts.tv_sec*1000000000 + ts.tv_nsec;
+}
 
-	/* create the final result */
-	MTIDATA final = mti->fn->set(NULL,NULL);
+/* list the processors this process may use in NUMA node order */
+static void tp_processors(std::vector<int> &cpus, std::vector<unsigned int> &nodes)
+{
+#if defined HAVE_SCHED_GETAFFINITY && defined HAVE_CPU_SET_MACROS
+	cpu_set_t allowed;
+	CPU_ZERO(&allowed);
+	if ( sched_getaffinity(0,sizeof(allowed),&allowed)!=0 )
+	{
+		output_warning("thread pool unable to get the processors available: %s", strerror(errno));
+		return;
+	}
 
-	/* loop as long as enabled */
-	while ( tp->enabled )
+	/* map the processors to their NUMA nodes */
+	std::vector<int> node_of(CPU_SETSIZE,0);
+	unsigned int n_nodes = 1;
+	DIR *dir = opendir("/sys/devices/system/node");
+	if ( dir!=NULL )
 	{
-		size_t n;
+		struct dirent *entry;
+		while ( (entry=readdir(dir))!=NULL )
+		{
+			unsigned int node;
+			char path[1024];
+			if ( sscanf(entry->d_name,"node%u",&node)!=1 )
+				continue;
+			snprintf(path,sizeof(path),"/sys/devices/system/node/%s/cpulist",entry->d_name);
+			FILE *fp = fopen(path,"r");
+			if ( fp==NULL )
+				continue;
+			int first, last;
+			while ( fscanf(fp,"%d",&first)==1 )
+			{
+				char sep = '\0';
+				last = first;
+				if ( fscanf(fp,"%c",&sep)==1 && sep=='-' )
+				{
+					sep = '\0';
+					if ( fscanf(fp,"%d",&last)!=1 )
+						break;
+					if ( fscanf(fp,"%c",&sep)!=1 )
+						sep = '\0';
+				}
+				for ( int cpu=first ; cpu<=last && cpu<CPU_SETSIZE ; cpu++ )
+					node_of[cpu] = node;
+				if ( node>=n_nodes )
+					n_nodes = node+1;
+				if ( sep!=',' )
+					break;
+			}
+			fclose(fp);
+		}
+		closedir(dir);
+	}
 
-		/* create the itermediate result */
-		MTIDATA result = mti->fn->set(NULL,NULL);
-		
-		/* lock access to the start condition */
-		pthread_mutex_lock(mti->start.lock);
+	/* order the processors by node */
+	for ( unsigned int node=0 ; node<n_nodes ; node++ )
+	{
+		for ( int cpu=0 ; cpu<CPU_SETSIZE ; cpu++ )
+		{
+			if ( CPU_ISSET(cpu,&allowed) && node_of[cpu]==(int)node )
+			{
+				cpus.push_back(cpu);
+				nodes.push_back(node);
+			}
+		}
+	}
+#else
+	output_warning("thread_affinity is not supported on this platform");
+#endif
+}
 
-		/* wait for the start condition to be satisfied */
-		mti_debug(mti,"iterator %d waiting for start condition",tp->id);
-		while ( mti->fn->compare(tp->data,mti->input)==0 )
-			pthread_cond_wait(mti->start.cond,mti->start.lock);
+/* bind the calling thread to the worker's processor */
+static void tp_bind(TPWORKER *worker)
+{
+#if defined HAVE_SCHED_SETAFFINITY && defined HAVE_CPU_SET_MACROS
+	if ( worker->cpu>=0 )
+	{
+		cpu_set_t cpuset;
+		CPU_ZERO(&cpuset);
+		CPU_SET(worker->cpu,&cpuset);
+		if ( sched_setaffinity(0,sizeof(cpuset),&cpuset)!=0 )
+			output_warning("unable to bind thread pool worker %d to processor %d: %s", worker->id, worker->cpu, strerror(errno));
+		else
+			IN_MYCONTEXT output_debug("thread pool worker %d bound to processor %d on node %d", worker->id, worker->cpu, worker->node);
+	}
+#endif
+}
 
-		/* unlock access to the start condition */
-		pthread_mutex_unlock(mti->start.lock);
+/* take the next task of a batch for a worker, from any worker's queue (tp_lock must be held) */
+static bool tp_take_batch(TPWORKER *self, TPTASK *task, TPBATCH *batch)
+{
+	size_t n_workers = tp_worker.size();
+	for ( size_t n=0 ; n<n_workers ; n++ )
+	{
+		TPWORKER *other = tp_worker[(self->id+n)%n_workers];
+		for ( std::deque<TPTASK>::iterator item=other->queue.begin() ; item!=other->queue.end() ; item++ )
+		{
+			if ( item->batch==batch )
+			{
+				*task = *item;
+				other->queue.erase(item);
+				tp_queued--;
+				if ( other!=self )
+					self->steals++;
+				return true;
+			}
+		}
+	}
+	return false;
+}
 
-		/* reset the final result */
-		mti->fn->set(final,NULL);
+/* take the next task for a worker, from another worker's queue if its own is empty (tp_lock must be held) */
+static bool tp_take(TPWORKER *self, TPTASK *task)
+{
+	if ( ! self->queue.empty() )
+	{
+		*task = self->queue.front();
+		self->queue.pop_front();
+		tp_queued--;
+		return true;
+	}
+	if ( tp_queued==0 )
+		return false;
 
-		/* process each item in the list */
-		mti_debug(mti,"iterator %d started", tp->id);
-		tp->active = TRUE;
-		for ( n=0 ; n<tp->n_items ; n++ )
+	/* look on the same node first */
+	size_t n_workers = tp_worker.size();
+	for ( int same_node=1 ; same_node>=0 ; same_node-- )
+	{
+		for ( size_t n=1 ; n<n_workers ; n++ )
 		{
-			/* reset the itermediate result */
-			mti->fn->set(result,NULL);
+			TPWORKER *other = tp_worker[(self->id+n)%n_workers];
+			if ( (other->node==self->node) == (same_node==1) && ! other->queue.empty() )
+			{
+				*task = other->queue.back();
+				other->queue.pop_back();
+				tp_queued--;
+				self->steals++;
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+/* run a task (tp_lock must be held, and is released while the task runs) */
+static void tp_exec(TPWORKER *self, TPTASK *task)
+{
+	pthread_mutex_unlock(&tp_lock);
+	int64 t0 = tp_now();
+	tp_depth++;
+	task->call(task->data,task->task);
+	tp_depth--;
+	int64 t1 = tp_now();
+	pthread_mutex_lock(&tp_lock);
+
+	TPBATCH *batch = task->batch;
+	self->tasks++;
+	self->busy += t1-t0;
+	batch->tasks++;
+	batch->busy += t1-t0;
+	batch->wait += t0-task->queued;
+	if ( --batch->pending==0 )
+		pthread_cond_broadcast(&tp_done);
+}
+
+static void *tp_workerproc(void *arg)
+{
+	TPWORKER *self = (TPWORKER*)arg;
+	tp_self = self;
+	tp_bind(self);
+	pthread_mutex_lock(&tp_lock);
+	while ( ! tp_stop )
+	{
+		TPTASK task;
+		if ( tp_take(self,&task) )
+			tp_exec(self,&task);
+		else
+		{
+			int64 t0 = tp_now();
+			pthread_cond_wait(&tp_work,&tp_lock);
+			self->idle += tp_now()-t0;
+		}
+	}
+	pthread_mutex_unlock(&tp_lock);
+	return NULL;
+}
 
-			/* make the call */
-			mti->fn->call(result,tp->item[n],mti->input);
+/* start the workers (tp_lock must be held) */
+static void tp_start(void)
+{
+	if ( ! tp_worker.empty() )
+		return;
+
+	unsigned int n_workers = global_threadcount>0 ? global_threadcount : processor_count();
+	std::vector<int> cpus;
+	std::vector<unsigned int> nodes;
+	if ( global_thread_affinity )
+		tp_processors(cpus,nodes);
+	tp_nodes = 1;
+	for ( unsigned int n=0 ; n<n_workers ; n++ )
+	{
+		TPWORKER *worker = new TPWORKER;
+		worker->id = n;
+		worker->cpu = cpus.empty() ? -1 : cpus[n%cpus.size()];
+		worker->node = nodes.empty() ? 0 : nodes[n%nodes.size()];
+		worker->tasks = worker->steals = 0;
+		worker->busy = worker->idle = 0;
+		if ( worker->node>=tp_nodes )
+			tp_nodes = worker->node+1;
+		tp_worker.push_back(worker);
+	}
+	IN_MYCONTEXT output_verbose("thread pool starting %d workers on %d node%s%s", n_workers, tp_nodes, tp_nodes>1?"s":"", cpus.empty()?"":" with processor affinity");
 
-			/* gather result */
-			mti->fn->gather(final,result);
+	/* the thread that starts the pool waits on batches as worker 0 */
+	tp_main = pthread_self();
+	tp_bind(tp_worker[0]);
+	for ( unsigned int n=1 ; n<n_workers ; n++ )
+	{
+		pthread_t thread_id;
+		if ( pthread_create(&thread_id,NULL,tp_workerproc,tp_worker[n])!=0 )
+		{
+			output_warning("thread pool worker %d creation failed, its tasks will be run by other workers", n);
+			/* TROUBLESHOOT
+			   The operating system refused to create a thread pool worker.  The
+			   simulation continues with fewer workers.  Reduce the threadcount
+			   or free up system resources and try again.
+			 */
+			continue;
 		}
-		tp->active = FALSE;
-		mti_debug(mti,"iterator %d completed", tp->id);
+		tp_thread.push_back(thread_id);
+	}
+}
 
-		/* update the current data */
-		mti->fn->set(tp->data,mti->input);
+TPBATCH *threadpool_batch(const char *name)
+{
+	pthread_mutex_lock(&tp_lock);
+	TPBATCH *batch;
+	for ( batch=tp_batchlist ; batch!=NULL ; batch=batch->next )
+	{
+		if ( strcmp(batch->name,name)==0 )
+			break;
+	}
+	if ( batch==NULL )
+	{
+		batch = new TPBATCH;
+		memset(batch,0,sizeof(TPBATCH));
+		batch->name = name;
+		TPBATCH **last = &tp_batchlist;
+		while ( *last!=NULL )
+			last = &(*last)->next;
+		*last = batch;
+	}
+	pthread_mutex_unlock(&tp_lock);
+	return batch;
+}
 
-		/* lock the stop condition */
-		pthread_mutex_lock(mti->stop.lock);
+void threadpool_submit(TPBATCH *batch, TPTASKCALL call, void *data, unsigned int n_tasks)
+{
+	if ( n_tasks==0 )
+		return;
+	pthread_mutex_lock(&tp_lock);
+	tp_start();
+	int64 now = tp_now();
+	size_t n_workers = tp_worker.size();
+	for ( unsigned int n=0 ; n<n_tasks ; n++ )
+	{
+		TPTASK task = {batch,call,data,n,now};
+		tp_worker[n%n_workers]->queue.push_back(task);
+	}
+	tp_queued += n_tasks;
+	batch->pending += n_tasks;
+	batch->submits++;
+	pthread_cond_broadcast(&tp_work);
+	pthread_mutex_unlock(&tp_lock);
+}
 
-		/* decrement the stop counter */
-		mti->stop.count--;
+void threadpool_wait(TPBATCH *batch)
+{
+	pthread_mutex_lock(&tp_lock);
+	TPWORKER *self = tp_self ? tp_self : ( tp_worker.empty() ? NULL : tp_worker[0] );
+	/* a wait inside a task only runs its own batch, since other tasks may need what the waiting task holds,
+	   and so does a wait by a thread that is not in the pool, since it may not be the one the main loop runs on */
+	bool own_batch = ( tp_depth>0 || ( tp_self==NULL && ! pthread_equal(pthread_self(),tp_main) ) );
+	while ( batch->pending>0 )
+	{
+		TPTASK task;
+		if ( self!=NULL && ( own_batch ? tp_take_batch(self,&task,batch) : tp_take(self,&task) ) )
+			tp_exec(self,&task);
+		else
+			pthread_cond_wait(&tp_done,&tp_lock);
+	}
+	pthread_mutex_unlock(&tp_lock);
+}
 
-		/* gather output */
-		mti->fn->gather(mti->output,final);
+void threadpool_run(TPBATCH *batch, TPTASKCALL call, void *data, unsigned int n_tasks)
+{
+	threadpool_submit(batch,call,data,n_tasks);
+	threadpool_wait(batch);
+}
 
-		/* notify all of stop condition */
-		pthread_cond_broadcast(mti->stop.cond);
+unsigned int threadpool_size(void)
+{
+	pthread_mutex_lock(&tp_lock);
+	tp_start();
+	unsigned int n_workers = (unsigned int)tp_worker.size();
+	pthread_mutex_unlock(&tp_lock);
+	return n_workers;
+}
 
-		/* unlock stop condition */
-		pthread_mutex_unlock(mti->stop.lock);
+TPBATCH *threadpool_getnext(TPBATCH *batch)
+{
+	return batch==NULL ? tp_batchlist : batch->next;
+}
 
-		/* free the itermediate result */
-		free(result);
+int threadpool_getstats(TPSTATS *stats)
+{
+	memset(stats,0,sizeof(TPSTATS));
+	pthread_mutex_lock(&tp_lock);
+	stats->workers = (unsigned int)tp_worker.size();
+	stats->nodes = tp_nodes;
+	for ( std::vector<TPWORKER*>::iterator worker=tp_worker.begin() ; worker!=tp_worker.end() ; worker++ )
+	{
+		stats->tasks += (*worker)->tasks;
+		stats->steals += (*worker)->steals;
+		stats->busy += (*worker)->busy;
+		stats->idle += (*worker)->idle;
 	}
+	pthread_mutex_unlock(&tp_lock);
+	return stats->workers>0 ? 1 : 0;
+}
+
+void threadpool_term(void)
+{
+	pthread_mutex_lock(&tp_lock);
+	tp_stop = true;
+	pthread_cond_broadcast(&tp_work);
+	pthread_mutex_unlock(&tp_lock);
+	for ( std::vector<pthread_t>::iterator thread=tp_thread.begin() ; thread!=tp_thread.end() ; thread++ )
+		pthread_join(*thread,NULL);
+	tp_thread.clear();
+}
+
+/****************************************************************
+ * Multi-threaded iterators
+ ****************************************************************/
+
+static void iterator_task(void *data, unsigned int n)
+{
+	MTI *mti = (MTI*)data;
+	MTIPROC *tp = &mti->process[n];
+	size_t m;
+
+	/* create the itermediate result */
+	MTIDATA result = mti->fn->set(NULL,NULL);
 
-	/* free the final result */
-	free(final);
+	/* reset the final result */
+	mti->fn->set(tp->data,NULL);
 
-	/* exit */
-	return (MTICODE)0;
+	/* process each item in the list */
+	mti_debug(mti,"iterator %d started", tp->id);
+	tp->active = TRUE;
+	for ( m=0 ; m<tp->n_items ; m++ )
+	{
+		/* reset the itermediate result */
+		mti->fn->set(result,NULL);
+
+		/* make the call */
+		mti->fn->call(result,tp->item[m],mti->input);
+
+		/* gather result */
+		mti->fn->gather(tp->data,result);
+	}
+	tp->active = FALSE;
+	mti_debug(mti,"iterator %d completed", tp->id);
+
+	/* free the itermediate result */
+	free(result);
 }
 
 MTI *mti_init(const char *name, MTIFUNCTIONS *fn, size_t minitems)
 {
-	pthread_cond_t new_cond = PTHREAD_COND_INITIALIZER;
-	pthread_mutex_t new_mutex = PTHREAD_MUTEX_INITIALIZER;
 	MTI *mti = NULL;
 	size_t nitems=0, items_per_process=0;
 	MTIITEM item = NULL;
@@ -162,23 +513,14 @@ MTI *mti_init(const char *name, MTIFUNCTIONS *fn, size_t minitems)
 	mti = (MTI*)malloc(sizeof(MTI));
 	if ( mti==NULL ) return NULL;
 	mti->name = name;
-	mti->start.cond = (pthread_cond_t*)malloc(sizeof(pthread_cond_t));
-	memcpy(mti->start.cond,&new_cond,sizeof(new_cond));
-	mti->start.lock = (pthread_mutex_t*)malloc(sizeof(pthread_mutex_t));
-	memcpy(mti->start.lock,&new_mutex,sizeof(new_mutex));
-	mti->start.count = 0;
-	mti->stop.cond = (pthread_cond_t*)malloc(sizeof(pthread_cond_t));
-	memcpy(mti->stop.cond,&new_cond,sizeof(new_cond));
-	mti->stop.lock = (pthread_mutex_t*)malloc(sizeof(pthread_mutex_t));
-	memcpy(mti->stop.lock,&new_mutex,sizeof(new_mutex));
-	mti->stop.count = 0;
+	mti->batch = threadpool_batch(name);
 	mti->input = fn->set(NULL,NULL);
 	mti->output = fn->set(NULL,NULL);
 	mti->runtime = 0;
 	mti->fn = fn;
 
-	/* compute number of threads */
-	mti->n_processes = global_threadcount;
+	/* compute number of iterators */
+	mti->n_processes = threadpool_size();
 	if ( nitems<mti->n_processes*minitems )
 		mti->n_processes = (unsigned int)(nitems/minitems);
 	if ( mti->n_processes==0 )
@@ -229,8 +571,7 @@ MTI *mti_init(const char *name, MTIFUNCTIONS *fn, size_t minitems)
 				item = fn->get(item);
 			}
 
-			/* create thread to handle the list */
-			proc->enabled  = ( pthread_create(&proc->thread_id,NULL,(void*(*)(void*))iterator_proc,proc)==0 );
+			proc->enabled = TRUE;
 			mti_debug(mti,"proc=%d; enabled=%d, nitems=%d", p, proc->enabled, proc->n_items);
 		}
 	}
@@ -265,31 +606,17 @@ int mti_run(MTIDATA result, MTI *mti, MTIDATA input)
 	{
 		mti_debug(mti,"starting %d iterators", mti->n_processes);
 
-		/* lock access to stop condition */
-		pthread_mutex_lock(mti->stop.lock);
-
-		/* reset the stop condition */
-		mti->stop.count = mti->n_processes;
-
-		/* lock access to the start condition */
-		pthread_mutex_lock(mti->start.lock);
-
 		/* set start condition */
 		mti->fn->set(mti->input,input);
 		mti->fn->set(mti->output,NULL);
 
-		/* broadcast start condition */
-		pthread_cond_broadcast(mti->start.cond);
+		/* run the iterators */
+		threadpool_run(mti->batch,iterator_task,mti,mti->n_processes);
 
-		/* unlock access to start condition */
-		pthread_mutex_unlock(mti->start.lock);
-
-		/* wait for stop condition */
-		while ( mti->stop.count>0 )
-			pthread_cond_wait(mti->stop.cond,mti->stop.lock);
-
-		/* unlock access to stop condition */
-		pthread_mutex_unlock(mti->stop.lock);
+		/* gather output */
+		unsigned int p;
+		for ( p=0 ; p<mti->n_processes ; p++ )
+			mti->fn->gather(mti->output,mti->process[p].data);
 
 		/* gather result */
 		mti->fn->gather(result,mti->output);
@@ -104,9 +104,8 @@ typedef struct s_mtifunctions
 typedef struct s_mtiterator {
     unsigned int id;            /**< id given to iterator */
     MTI *mti;                   /**< pointer to MTI that controls this iterator */
-    pthread_t thread_id;        /**< pthread handle/id */
-    int enabled;                /**< flag indicating thread is enabled */
-    int active;                 /**< flag indicating thread is active */
+    int enabled;                /**< flag indicating iterator is enabled */
+    int active;                 /**< flag indicating iterator is active */
     MTIITEM *item;              /**< pointer to array of items */
     unsigned int n_items  ;     /**< number of items */
     MTIDATA data;               /**< iterator data */
@@ -115,11 +114,7 @@ typedef struct s_mtiterator {
 /** Thread iterator control block */
 struct s_mtiteratorlist {
     const char *name;           /**< name given to iterator */
-    struct {
-        pthread_cond_t *cond;   /**< condition variable */    
-        pthread_mutex_t *lock;  /**< mutex object */
-        unsigned int count;     /**< start/stop counter */
-    } start, stop;              /**< start and stop cond/mutex */
+    struct s_tpbatch *batch;    /**< thread pool batch that runs the iterators */
     MTIDATA input;              /**< iterator input data */
     MTIDATA output;             /**< iterator output data */
     MTIFUNCTIONS *fn;		/**< function table */
@@ -156,5 +151,105 @@ int mti_run(MTIDATA result,   /**< result of iterator */
 
 int processor_count(void);
 
+/**@}*/
+
+/** @addtogroup threadpool Core thread pool
+    @ingroup core
+
+The core thread pool runs the parallel parts of the main loop (object
+sync, schedules, loadshapes, enduses, transforms, and MTIs) on a single
+set of persistent worker threads, so that no more than #global_threadcount
+threads are ever busy at once.
+
+Work is submitted in batches.  A batch is a named set of tasks that are
+run by calling the same function with the task number.  Task \p n of a
+batch is queued on worker \p n modulo the pool size, so a batch that is
+partitioned the same way each time runs each part on the same worker.
+Idle workers take tasks from other workers, first from those on the same
+NUMA node.  The thread that waits on a batch is worker 0 and runs tasks
+while it waits.
+
+When #global_thread_affinity is set, the workers are bound to the
+processors the process may use, in NUMA node order.
+
+Each batch and worker records the time tasks wait in the queue and the
+time they run, which the profiler reports.
+
+Modules reach the pool through the \p threadpool entries of the callback
+table.  A task, or a thread of a module's own, may submit and wait on a
+batch of its own, in which case the waiting thread only runs tasks of that
+batch.
+
+@{**/
+
+typedef struct s_tpbatch TPBATCH;
+
+/** Task call function prototype
+    The first argument is the data given when the batch was submitted, the
+    second is the task number.
+ **/
+typedef void (*TPTASKCALL)(void*,unsigned int);
+
+/** Thread pool batch control block */
+struct s_tpbatch {
+	const char *name;           /**< name given to batch */
+	unsigned int pending;       /**< number of tasks submitted but not completed */
+	unsigned int submits;       /**< number of times tasks were submitted */
+	unsigned int tasks;         /**< number of tasks completed */
+	int64 busy;                 /**< total time tasks ran (ns) */
+	int64 wait;                 /**< total time tasks waited in the queue (ns) */
+	struct s_tpbatch *next;     /**< next batch */
+};
+
+/** Thread pool statistics */
+typedef struct s_tpstats {
+	unsigned int workers;       /**< number of workers (including the waiting thread) */
+	unsigned int nodes;         /**< number of NUMA nodes the workers are placed on */
+	unsigned int tasks;         /**< number of tasks completed */
+	unsigned int steals;        /**< number of tasks taken from another worker's queue */
+	int64 busy;                 /**< total time workers ran tasks (ns) */
+	int64 idle;                 /**< total time helper workers waited for tasks (ns) */
+} TPSTATS;
+
+/** Get a thread pool batch
+    @returns the batch with the given name, which is created if needed
+ **/
+TPBATCH *threadpool_batch(const char *name);
+
+/** Submit tasks to a batch
+    The tasks \p 0 through \p n_tasks-1 are queued and started without waiting.
+ **/
+void threadpool_submit(TPBATCH *batch, /**< batch to which tasks are added */
+                       TPTASKCALL call, /**< task call function */
+                       void *data, /**< data given to the task call */
+                       unsigned int n_tasks); /**< number of tasks */
+
+/** Wait for all the tasks submitted to a batch to complete
+    When called from inside a task or from a thread that is not in the pool,
+    only tasks of \p batch are run while waiting.
+ **/
+void threadpool_wait(TPBATCH *batch);
+
+/** Submit tasks to a batch and wait for them to complete */
+void threadpool_run(TPBATCH *batch, TPTASKCALL call, void *data, unsigned int n_tasks);
+
+/** Get the number of workers in the thread pool
+    @returns the number of tasks that may run at once
+ **/
+unsigned int threadpool_size(void);
+
+/** Get the next thread pool batch
+    @returns the first batch if \p batch is NULL, NULL after the last batch
+ **/
+TPBATCH *threadpool_getnext(TPBATCH *batch);
+
+/** Get the thread pool statistics
+    @returns 0 if the pool was never started, 1 otherwise
+ **/
+int threadpool_getstats(TPSTATS *stats);
+
+/** Stop the thread pool workers */
+void threadpool_term(void);
+
 #endif /**@} _THREADPOOL_H */
 
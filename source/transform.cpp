@@ -4,6 +4,9 @@
 
 #include "gldcore.h"
 
+#include <set>
+#include <vector>
+
 SET_MYCONTEXT(DMC_TRANSFORM)
 
 static TRANSFORM *schedule_xformlist=NULL;
@@ -682,16 +685,173 @@ TIMESTAMP transform_apply(TIMESTAMP t1, TRANSFORM *xform, double *source)
 	return t2;
 }
 
+/* synchronize one transform */
+static TIMESTAMP transform_sync(TRANSFORM *xform, TIMESTAMP t1)
+{
+	TIMESTAMP t2 = TS_NEVER;
+	TIMESTAMP tskew, t;
+	if ( ( xform->source_type == XS_SCHEDULE ) 
+	  && ( xform->target_obj->schedule_skew != 0 ) )
+	{
+		IN_MYCONTEXT output_debug("transform_sync(t1=%lld): skew = %lld",t1,xform->target_obj->schedule_skew);
+	    tskew = t1 - xform->target_obj->schedule_skew; // subtract so the +12 is 'twelve seconds later', not earlier
+	    SCHEDULEINDEX index = schedule_index(xform->source_schedule,tskew);
+	    int32 dtnext = schedule_dtnext(xform->source_schedule,index)*60;
+	    double value = schedule_value(xform->source_schedule,index);
+	    t = (dtnext == 0 ? TS_NEVER : t1 + dtnext - (tskew % 60));
+	    if ( t < t2 ) t2 = t;
+		if ( ( tskew <= xform->source_schedule->since ) 
+				|| ( tskew >= xform->source_schedule->next_t ) )
+		{
+			t = transform_apply(t1,xform,&value);
+			if ( t<t2 ) t2=t;
+		} 
+		else 
+		{
+			t = transform_apply(t1,xform,NULL);
+			if ( t<t2 ) t2=t;
+		}
+	} 
+	else 
+	{
+		t = transform_apply(t1,xform,NULL);
+		if ( t<t2 ) t2=t;
+	}
+	return t2;
+}
+
+/* Linear transforms of schedules and loadshapes only read their source and write
+   their own target, so they can be run on the thread pool when their target is
+   not shared with another transform.
+ */
+typedef struct s_transformsyncdata {
+	TRANSFORM **xform;
+	unsigned int n;
+	TIMESTAMP t2;
+} TRANSFORMSYNCDATA;
+
+static std::vector<TRANSFORM*> parallel_xform;
+static std::set<void*> shared_targets;
+static TRANSFORMSYNCDATA *thread_xf = NULL;
+static unsigned int n_threads_xf = 0;
+static TRANSFORM *parallel_xformlist = NULL;
+static TIMESTAMP next_t1_xf;
+static TPBATCH *batch_xf = NULL;
+
+static void transform_synctask(void *ptr, unsigned int n)
+{
+	TRANSFORMSYNCDATA *data = (TRANSFORMSYNCDATA*)ptr + n;
+	unsigned int m;
+	data->t2 = TS_NEVER;
+	for ( m = 0 ; m < data->n ; m++ )
+	{
+		TIMESTAMP t = transform_sync(data->xform[m],next_t1_xf);
+		if ( t<data->t2 ) data->t2 = t;
+	}
+}
+
+static bool transform_isparallel(TRANSFORM *xform)
+{
+	return xform->function_type == XT_LINEAR
+		&& ( xform->source_type == XS_SCHEDULE || xform->source_type == XS_LOADSHAPE )
+		&& shared_targets.find((void*)xform->target) == shared_targets.end();
+}
+
+/* assign the transforms that can run in parallel to tasks */
+static void transform_setup_parallel(void)
+{
+	TRANSFORM *xform;
+	std::set<void*> targets;
+	size_t n_items, xn;
+
+	parallel_xform.clear();
+	shared_targets.clear();
+	free(thread_xf);
+	thread_xf = NULL;
+	n_threads_xf = 0;
+	parallel_xformlist = schedule_xformlist;
+	for ( xform=schedule_xformlist; xform!=NULL; xform=xform->next )
+	{
+		void *target;
+		switch ( xform->function_type ) {
+		case XT_LINEAR: target = (void*)xform->target; break;
+		case XT_EXTERNAL: target = gldvar_getaddr(xform->plhs,0); break;
+		case XT_FILTER: target = (void*)xform->y; break;
+		default: target = NULL; break;
+		}
+		if ( target != NULL && ! targets.insert(target).second )
+		{
+			shared_targets.insert(target);
+		}
+	}
+	for ( xform=schedule_xformlist; xform!=NULL; xform=xform->next )
+	{
+		if ( transform_isparallel(xform) )
+		{
+			parallel_xform.push_back(xform);
+		}
+	}
+
+	// determine needed tasks
+	n_threads_xf = threadpool_size();
+	if ( parallel_xform.size()<n_threads_xf*4 )
+		n_threads_xf = parallel_xform.size()/4;
+	if ( n_threads_xf<2 )
+	{
+		n_threads_xf = 0;
+		return;
+	}
+	n_items = parallel_xform.size()/n_threads_xf;
+	n_threads_xf = parallel_xform.size()/n_items;
+	if ( n_threads_xf*n_items<parallel_xform.size() ) // not enough slots yet
+		n_threads_xf++; // add one underused task
+	IN_MYCONTEXT output_debug("transform_syncall is running %d transforms on %d threads", parallel_xform.size(), n_threads_xf);
+
+	// assign the transforms of each task
+	thread_xf = (TRANSFORMSYNCDATA*)malloc(sizeof(TRANSFORMSYNCDATA)*n_threads_xf);
+	memset(thread_xf,0,sizeof(TRANSFORMSYNCDATA)*n_threads_xf);
+	for ( xn=0 ; xn<n_threads_xf ; xn++ )
+	{
+		thread_xf[xn].xform = &parallel_xform[xn*n_items];
+		thread_xf[xn].n = (unsigned int)( (xn+1)*n_items<=parallel_xform.size() ? n_items : parallel_xform.size()-xn*n_items );
+	}
+	if ( batch_xf == NULL )
+	{
+		batch_xf = threadpool_batch("transform");
+	}
+}
+
 clock_t transform_synctime = 0;
 TIMESTAMP transform_syncall(TIMESTAMP t1, TRANSFORMSOURCE source)
 {
 	TRANSFORM *xform;
 	clock_t start = (clock_t)exec_clock();
 	TIMESTAMP t2 = TS_NEVER;
-	TIMESTAMP tskew, t;
+	TIMESTAMP t;
+	bool parallel = false;
 
-	/* process the schedule transformations */
+	/* run the schedule and loadshape transforms on the thread pool */
 	IN_MYCONTEXT output_debug("transform_syncall(t1=%lld, TRANSFORMSOURCE=0x%04llx): entering",t1,(int64)source);
+	if ( global_threadcount > 1 && source == (XS_SCHEDULE|XS_LOADSHAPE) )
+	{
+		if ( parallel_xformlist != schedule_xformlist )
+		{
+			transform_setup_parallel();
+		}
+		if ( n_threads_xf > 1 )
+		{
+			unsigned int n;
+			next_t1_xf = t1;
+			threadpool_run(batch_xf,transform_synctask,thread_xf,n_threads_xf);
+			for ( n=0 ; n<n_threads_xf ; n++ )
+			{
+				if ( thread_xf[n].t2<t2 ) t2 = thread_xf[n].t2;
+			}
+			parallel = true;
+		}
+	}
+
+	/* process the schedule transformations */
 	for (xform=schedule_xformlist; xform!=NULL; xform=xform->next)
 	{	
 		IN_MYCONTEXT output_debug("transform_syncall(t1=%lld, TRANSFORMSOURCE=0x%04llx): xform->source_type = %04llx, &source = %04llx",t1,(int64)source,(int64)xform->source_type,(int64)(xform->source_type&source));
@@ -699,33 +859,12 @@ TIMESTAMP transform_syncall(TIMESTAMP t1, TRANSFORMSOURCE source)
  			output_warning("transform_syncall(...): transform to property '%s' of object '%s' has an unknown source type, it will always be run", xform->target_prop->name, xform->target_obj->name?xform->target_obj->name:"(unnamed)");
  		if ( xform->source_type == XS_UNKNOWN || (xform->source_type&source)!=0 )
  		{
-			if ( ( xform->source_type == XS_SCHEDULE ) 
-			  && ( xform->target_obj->schedule_skew != 0 ) )
-			{
-				IN_MYCONTEXT output_debug("transform_syncall(t1=%lld, TRANSFORMSOURCE=0x%04llx): skew = %lld",t1,(int64)source,xform->target_obj->schedule_skew);
-			    tskew = t1 - xform->target_obj->schedule_skew; // subtract so the +12 is 'twelve seconds later', not earlier
-			    SCHEDULEINDEX index = schedule_index(xform->source_schedule,tskew);
-			    int32 dtnext = schedule_dtnext(xform->source_schedule,index)*60;
-			    double value = schedule_value(xform->source_schedule,index);
-			    t = (dtnext == 0 ? TS_NEVER : t1 + dtnext - (tskew % 60));
-			    if ( t < t2 ) t2 = t;
-				if ( ( tskew <= xform->source_schedule->since ) 
-						|| ( tskew >= xform->source_schedule->next_t ) )
-				{
-					t = transform_apply(t1,xform,&value);
-					if ( t<t2 ) t2=t;
-				} 
-				else 
-				{
-					t = transform_apply(t1,xform,NULL);
-					if ( t<t2 ) t2=t;
-				}
-			} 
-			else 
+			if ( parallel && transform_isparallel(xform) )
 			{
-				t = transform_apply(t1,xform,NULL);
-				if ( t<t2 ) t2=t;
+				continue;
 			}
+			t = transform_sync(xform,t1);
+			if ( t<t2 ) t2=t;
 		}
 	}
 	transform_synctime += (clock_t)exec_clock() - start;
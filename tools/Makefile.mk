@@ -54,3 +54,4 @@ dist_pkgdata_DATA += tools/timeseries.py
 dist_pkgdata_DATA += tools/ucar_weather.py
 dist_pkgdata_DATA += tools/unitcalc.py
 dist_pkgdata_DATA += tools/weather.py
+dist_pkgdata_DATA += tools/weather_compile.py
@@ -1,6 +1,7 @@
 """Access weather data from NREL
 
 Syntax: gridlabd weather COUNTRY STATE COUNTY [OPTIONS ...]
+Syntax: gridlabd weather compile INPUT [OUTPUT] [OPTIONS ...]
 
 Options:
 
@@ -39,6 +40,10 @@ The following example create a typical weather model for December 2020 in Snohom
 gridlabd weather US WA Snohomish --player --model -type=tmy3 --start='2020-12-01 00:00:00-08:00' --end='2021-01-01 00:00:00-08:00'
 ~~~
 
+The `compile` command converts weather data, such as the player output of
+this tool, into a compiled weather file for the climate module (see
+[[/Tools/Weather_compile]]).
+
 See also:
 
 * [[/Tools/Census]]
@@ -241,6 +246,12 @@ def main(argv:list[str]) -> int:
 
         app.syntax(__doc__)
 
+    # compiling weather files is handled by weather_compile
+    if argv[1] == "compile":
+
+        import gridlabd.weather_compile as compiler
+        return compiler.main([argv[0]]+argv[2:])
+
     # handle stardard app arguments --debug, --warning, --verbose, --quiet, --silent
     args = app.read_stdargs(argv)
 
@@ -0,0 +1,363 @@
+"""Compile weather data for the climate module
+
+Syntax: gridlabd weather compile INPUT [OUTPUT] [OPTIONS ...]
+
+Options:
+
+* `--year=START[:STOP]`: years over which typical year data is repeated
+  (required for TMY3 input)
+
+* `--timezone=HOURS`: offset of local standard time from UTC for
+  timestamps that do not specify one (e.g., `-8` for PST)
+
+* `--latitude=DEG`: latitude of the station (default from the input)
+
+* `--longitude=DEG`: longitude of the station (default from the input)
+
+Description:
+
+The `weather compile` tool converts a weather file into a compiled weather
+file (extension `.glw`) that the `climate` object uses without parsing it.
+The output file name is the input file name with the extension `.glw`
+unless OUTPUT is given.
+
+A compiled weather file contains one row for each timestamp in the input,
+each made of the UTC timestamp followed by the values of each column, so
+that the climate object can map the file into memory and find the weather
+at any time by index arithmetic. The file is shared by all the climate
+objects that use it.
+
+The following input formats are supported:
+
+* `.tmy3`: NREL TMY3 data.  Because TMY3 data is a typical year without
+  a fixed calendar, the year is repeated for each year in the range given
+  by `--year`, using the March 1 data for February 29 of leap years, as
+  the climate object does when it reads TMY3 data.
+
+* `.csv`: a timestamp column followed by one column for each climate
+  property, e.g., the output of `gridlabd weather ... --player`. Column
+  names may include the unit of the data in brackets, e.g.,
+  `temperature[degC]`, in which case the climate object converts the
+  data to the unit of the property.  Property lines of the form
+  `$NAME=VALUE` (as read by `csv_reader`) provide the station information.
+
+Example:
+
+The following example compiles 15 years of typical weather for Burlington VT:
+
+~~~
+gridlabd weather get VT-Burlington_International_Ap.tmy3
+gridlabd weather compile $GLD_ETC/weather/US/VT-Burlington_International_Ap.tmy3 burlington.glw --year=2010:2024
+~~~
+
+and uses it in a model:
+
+~~~
+module climate;
+object climate
+{
+    tmyfile "burlington.glw";
+}
+~~~
+
+See also:
+
+* [[/Module/Climate/Climate]]
+* [[/Tools/Weather]]
+"""
+
+import os
+import sys
+import csv
+import math
+import struct
+import datetime as dt
+import gridlabd.framework as app
+
+GLW_MAGIC = b"GLDWTHR"
+GLW_VERSION = 1
+GLW_NAMESIZE = 64
+GLW_HEADER = "<8siiqqqdddd32s32s" # see module/climate/weather_binary.h
+
+# column names used by other weather sources for climate properties
+CLIMATE_PROPERTIES = {
+    "drybulb" : "temperature",
+    "solar_horizontal" : "solar_global",
+    "global_horizontal_extra" : "extraterrestrial_global_horizontal",
+    "direct_normal_extra" : "extraterrestrial_direct_normal",
+}
+
+# station information found in csv_reader property lines
+CSV_PROPERTIES = {
+    "city_name" : "city",
+    "state_name" : "region",
+    "timezone_offset" : "tz_offset",
+    "elevation" : "elevation",
+}
+
+DAYS_THRU_MONTH = [0,31,59,90,120,151,181,212,243,273,304,334]
+
+class WeatherCompileError(Exception):
+    """Weather compile exception"""
+
+def _atoi(x:str) -> int:
+    """Convert TMY3 field as the climate module does"""
+    return int(float(x)) if x.strip() else 0
+
+def _tenths(x:str) -> float:
+    """Convert a TMY3 field to tenths as the climate module does"""
+    return int(float(x)*10)/10.0 if x.strip() else 0.0
+
+def read_tmy3(file:str,years:list[int]) -> dict:
+    """Read TMY3 data
+
+    Arguments:
+
+    * `file`: TMY3 file name
+
+    * `years`: list of years over which the data is repeated
+
+    Returns:
+
+    * `dict`: station information, column names, and rows
+    """
+    with open(file,"r") as fh:
+        reader = csv.reader(fh)
+        station = next(reader)
+        next(reader) # column headings
+        data = {}
+        for row in reader:
+            if len(row) < 56:
+                continue
+            month,day = [int(x) for x in row[0].split("/")[0:2]]
+            hour = int(row[1].split(":")[0])
+            doy = DAYS_THRU_MONTH[month-1] + day
+            data[(doy,hour)] = [
+                _tenths(row[31]), # temperature
+                _atoi(row[37])/100.0, # humidity
+                _atoi(row[7]), # solar_direct
+                _atoi(row[10]), # solar_diffuse
+                _atoi(row[4]), # solar_global
+                _atoi(row[3]), # extraterrestrial_direct_normal
+                _atoi(row[2]), # extraterrestrial_global_horizontal
+                _atoi(row[40]), # pressure
+                _tenths(row[46]), # wind_speed
+                _atoi(row[43]), # wind_dir
+                int(float(row[55])*10)*0.03937 if row[55].strip() else 0.0, # rainfall (as read by climate)
+                _atoi(row[28])/10.0, # opq_sky_cov
+                ]
+    if len(data) < 8760:
+        raise WeatherCompileError(f"{file} does not contain a full year of data ({len(data)} hours found)")
+    tz = float(station[3])
+    tzinfo = dt.timezone(dt.timedelta(hours=tz))
+    rows = []
+    for year in years:
+        date = dt.datetime(year,1,1,tzinfo=tzinfo)
+        while date.year == year:
+            # February 29 uses March 1 data, as the climate module does
+            doy = DAYS_THRU_MONTH[date.month-1] + date.day
+            for hour in range(1,25):
+                rows.append([int((date+dt.timedelta(hours=hour)).timestamp())] + data[(doy,hour)])
+            date += dt.timedelta(days=1)
+    return {
+        "city" : station[1],
+        "region" : station[2],
+        "tz_offset" : tz,
+        "latitude" : float(station[4]),
+        "longitude" : float(station[5]),
+        "elevation" : float(station[6]),
+        "columns" : [
+            "temperature[degC]",
+            "humidity[pu]",
+            "solar_direct[W/m^2]",
+            "solar_diffuse[W/m^2]",
+            "solar_global[W/m^2]",
+            "extraterrestrial_direct_normal[W/m^2]",
+            "extraterrestrial_global_horizontal[W/m^2]",
+            "pressure[mbar]",
+            "wind_speed[m/s]",
+            "wind_dir[deg]",
+            "rainfall[in/h]",
+            "opq_sky_cov[pu]",
+            ],
+        "rows" : rows,
+        }
+
+def read_csv(file:str,tz_offset:float|None=None) -> dict:
+    """Read CSV weather data
+
+    Arguments:
+
+    * `file`: CSV file name
+
+    * `tz_offset`: offset of local standard time from UTC of timestamps
+      without an offset (hours)
+
+    Returns:
+
+    * `dict`: station information, column names, and rows
+    """
+    result = {}
+    if not tz_offset is None:
+        result["tz_offset"] = tz_offset
+    lat = [math.nan,0.0]
+    lon = [math.nan,0.0]
+    header = None
+    columns = None
+    rows = []
+    with open(file,"r") as fh:
+        for line in csv.reader(fh):
+            if not line or not line[0].strip() or line[0].startswith("#"):
+                continue
+            if line[0].startswith("$"):
+                name,value = line[0][1:].split("=",1)
+                if name in CSV_PROPERTIES:
+                    tag = CSV_PROPERTIES[name]
+                    result[tag] = float(value) if tag in ["tz_offset","elevation"] else value
+                elif name in ["lat_deg","lat_min","long_deg","long_min"]:
+                    (lat if name.startswith("lat") else lon)[name.endswith("min")] = float(value)
+                continue
+            if header is None:
+                header = [x.strip() for x in line if x.strip()]
+                continue
+            if columns is None:
+                # csv_reader headers do not name the timestamp column
+                columns = []
+                for name in header[1:] if len(header) == len([x for x in line if x.strip()]) else header:
+                    prop,unit = (name[:-1].split("[",1) if name.endswith("]") else (name,None))
+                    prop = CLIMATE_PROPERTIES[prop] if prop in CLIMATE_PROPERTIES else prop
+                    columns.append(f"{prop}[{unit}]" if unit else prop)
+            try:
+                timestamp = dt.datetime.fromisoformat(line[0].strip())
+            except ValueError:
+                raise WeatherCompileError(f"{file}: '{line[0]}' is not a valid timestamp (typical year data must be converted to TMY3 or given with dates)")
+            if timestamp.tzinfo is None:
+                if not "tz_offset" in result:
+                    raise WeatherCompileError(f"{file}: timestamp '{line[0]}' has no timezone and --timezone is not specified")
+                timestamp = timestamp.replace(tzinfo=dt.timezone(dt.timedelta(hours=result["tz_offset"])))
+            values = [float(x) if x.strip() else math.nan for x in line[1:len(columns)+1]]
+            rows.append([int(timestamp.timestamp())] + values + [math.nan]*(len(columns)-len(values)))
+    if not columns or not rows:
+        raise WeatherCompileError(f"{file} contains no weather data")
+    rows.sort(key=lambda x:x[0])
+    if not math.isnan(lat[0]):
+        result["latitude"] = lat[0] + (lat[1] if lat[0] >= 0 else -lat[1])/60
+    if not math.isnan(lon[0]):
+        result["longitude"] = lon[0] + (lon[1] if lon[0] >= 0 else -lon[1])/60
+    result["columns"] = columns
+    result["rows"] = rows
+    return result
+
+def write(file:str,data:dict):
+    """Write a compiled weather file
+
+    Arguments:
+
+    * `file`: output file name
+
+    * `data`: station information, column names, and rows (see `read_tmy3()`)
+    """
+    rows = data["rows"]
+    columns = data["columns"]
+    for name in columns:
+        if len(name.encode()) >= GLW_NAMESIZE:
+            raise WeatherCompileError(f"column name '{name}' is too long")
+    steps = set(rows[n+1][0]-rows[n][0] for n in range(len(rows)-1))
+    interval = steps.pop() if len(steps) == 1 else 0
+    with open(file,"wb") as fh:
+        fh.write(struct.pack(GLW_HEADER,
+            GLW_MAGIC,
+            GLW_VERSION,
+            len(columns),
+            len(rows),
+            rows[0][0],
+            interval,
+            data.get("latitude",math.nan),
+            data.get("longitude",math.nan),
+            data.get("tz_offset",math.nan),
+            data.get("elevation",math.nan),
+            data.get("city","").encode()[:31],
+            data.get("region","").encode()[:31],
+            ))
+        for name in columns:
+            fh.write(struct.pack(f"{GLW_NAMESIZE}s",name.encode()))
+        layout = struct.Struct(f"<q{len(columns)}d")
+        for row in rows:
+            fh.write(layout.pack(*row))
+
+def main(argv:list[str]) -> int:
+    """Weather compile main routine
+
+    Arguments:
+
+    * `argv`: argument list (see Syntax for details)
+
+    Returns:
+
+    * `int`: exit code
+    """
+    # handle no options case -- typically a cry for help
+    if len(argv) == 1:
+
+        app.syntax(__doc__)
+
+    # handle stardard app arguments --debug, --warning, --verbose, --quiet, --silent
+    args = app.read_stdargs(argv)
+
+    files = []
+    years = None
+    options = {}
+    for key,value in args:
+
+        if key in ["-h","--help","help"] and len(value) == 0:
+            print(__doc__,file=sys.stdout)
+            return app.E_OK
+
+        elif key in ["--year"] and len(value) == 1:
+
+            span = [int(x) for x in value[0].split(":")]
+            years = list(range(span[0],span[-1]+1))
+
+        elif key in ["--timezone"] and len(value) == 1:
+
+            options["tz_offset"] = float(value[0])
+
+        elif key in ["--latitude","--longitude"] and len(value) == 1:
+
+            options[key[2:]] = float(value[0])
+
+        elif not key.startswith("-") and len(files) < 2:
+
+            files.append(key)
+
+        else:
+
+            app.error(f"'{key}={','.join(value) if value else 'None'}' is invalid")
+            return app.E_INVALID
+
+    if not files:
+        app.error("missing input file")
+        return app.E_MISSING
+    if len(files) == 1:
+        files.append(os.path.splitext(files[0])[0] + ".glw")
+
+    if files[0].endswith(".tmy3"):
+        if years is None:
+            app.error("TMY3 input requires --year")
+            return app.E_MISSING
+        data = read_tmy3(files[0],years)
+    elif files[0].endswith(".csv"):
+        data = read_csv(files[0],options.get("tz_offset"))
+    else:
+        app.error(f"'{files[0]}' is not a supported weather file format")
+        return app.E_INVALID
+    data.update(options)
+    write(files[1],data)
+    app.verbose(f"{files[1]}: {len(data['rows'])} rows of {len(data['columns'])} columns")
+
+    # normal termination condition
+    return app.E_OK
+
+if __name__ == "__main__":
+
+    app.run(main)